@@ -1,58 +0,0 @@
-/*This software is under the BSD licence:
-Copyright (c) 2007, Sebastien Riou
-
-All rights reserved.
-
-Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-
-Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer. 
-Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution. 
-Neither the name of "nimp software" nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission. 
-THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
-LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
-A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
-LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
-NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
-
-#include "error_msg.h"
-using namespace std;
-
-
-error_msg::error_msg(int err_code, std::string err_text)
-{
-	m_err_text="\n";
-	m_err_text+=err_text;
-	m_err_code=err_code;
-}
-error_msg::error_msg(std::string err_text)
-{
-	m_err_text="\n";
-	m_err_text+=err_text;
-	m_err_code=-1;
-}
-error_msg::~error_msg()
-{
-}
-int error_msg::get_err_code()
-{
-    return m_err_code;
-}
-std::string error_msg::get_err_text()
-{
-    return m_err_text;
-}
-void error_msg::set_err_code(int err_code)
-{
-    m_err_code=err_code;
-}
-int error_msg::add_to_err_text(std::string err_text)
-{
-    m_err_text=m_err_text+"\n"+err_text;
-    return 0;
-}
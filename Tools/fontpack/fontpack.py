@@ -0,0 +1,245 @@
+#!/usr/bin/env python3
+#
+# Convert a font in the column bitmap format used by src/Fonts/glcd*.cpp to the sparse packed format
+# that UTFT decodes directly, and report how much flash it saves.
+#
+# Usage: fontpack.py ../../src/Fonts/glcd19x21.cpp > ../../src/Fonts/glcd19x21_packed.cpp
+#
+# The column bitmap fonts hold either the Cyrillic or the Japanese characters after the Latin ones, shifted down to follow them.
+# The packed fonts hold the characters at their own code points, so a font can have both.
+#
+# Sparse packed format, after the usual 8-byte font header with the format byte set to 3 and the first and last character
+# codes set to the lowest and highest code points in the font:
+#	uint16_t numRanges				the number of runs of consecutive code points in the font
+#	ranges:							numRanges entries in ascending order of code point, each of
+#		uint16_t firstChar			the first code point of the run
+#		uint16_t lastChar			the last code point of the run
+#		uint16_t firstGlyph			the index of the glyph for firstChar
+#	uint16_t numEdges				the number of distinct edge columns, at most 256
+#	edges:							numEdges columns of (row height + 7)/8 bytes each, little endian with the top row in bit 0
+#	metrics:						numGlyphs entries, each of
+#		uint8_t width				the number of columns actually used by the glyph
+#		uint8_t leadingEdge			the edge that kerning looks at on the left: the first column, or the second if the first is blank
+#		uint8_t trailingEdge		the last column with any ink in it, or 0 if none
+#	uint16_t index[numGlyphs]		offset of each glyph from the end of the index
+#	glyphs:							column data, see below, one column after another from left to right
+#
+# All 16-bit values are little endian. Edge 0 is always a blank column.
+# UTFT measures text from the metrics alone, so it only has to decode a glyph when it draws it.
+# Each column is a sequence of bytes, each holding a run of background pixels in the low nibble followed by
+# a run of foreground pixels in the high nibble, starting from the top row. The column ends when the runs
+# add up to the row height. Runs longer than 15 pixels are split by a zero-length run of the other colour.
+# A column that starts with a zero byte is a repeat of the previous column.
+# Glyphs that are identical share the same data.
+
+import os
+import re
+import sys
+
+FORMAT_SPARSE = 3
+
+# The scripts that the font sources hold after the Latin characters: the preprocessor condition that selects them,
+# and how far UTFT shifts their code points down to index the column bitmap fonts
+SCRIPTS = [
+	('USE_CYRILLIC_CHARACTERS', 641),
+	('USE_JAPANESE_CHARACTERS', 11968),
+]
+
+# The combinations of scripts that we generate fonts for, and the preprocessor condition for each
+VARIANTS = [
+	('USE_CYRILLIC_CHARACTERS && USE_JAPANESE_CHARACTERS', ['USE_CYRILLIC_CHARACTERS', 'USE_JAPANESE_CHARACTERS']),
+	('USE_CYRILLIC_CHARACTERS', ['USE_CYRILLIC_CHARACTERS']),
+	('USE_JAPANESE_CHARACTERS', ['USE_JAPANESE_CHARACTERS']),
+	(None, []),
+]
+
+def read_font(text, macros):
+	"""Return the bytes of the font array that are compiled with the given macro values"""
+	body = text[text.index('{') + 1:text.rindex('}')]
+	values = []
+	stack = []					# for each nested #if, whether any branch has been taken yet and whether we are in the active one
+	for line in body.split('\n'):
+		directive = line.strip()
+		if directive.startswith('#if'):
+			taken = macros[directive.split()[1]]
+			stack.append([taken, taken])
+		elif directive.startswith('#elif'):
+			taken = not stack[-1][0] and macros[directive.split()[1]]
+			stack[-1] = [stack[-1][0] or taken, taken]
+		elif directive.startswith('#else'):
+			stack[-1] = [True, not stack[-1][0]]
+		elif directive.startswith('#endif'):
+			stack.pop()
+		elif all(active for _, active in stack):
+			line = re.sub(r'//.*', '', line)
+			values += [int(v, 0) for v in re.findall(r'0x[0-9A-Fa-f]+|\b\d+\b', line)]
+	return values
+
+def encode_column(column, height):
+	runs = []
+	row = 0
+	foreground = False
+	while row < height:
+		length = 0
+		while row < height and bool((column >> row) & 1) == foreground:
+			length += 1
+			row += 1
+		while length > 15:
+			runs += [15, 0]
+			length -= 15
+		runs.append(length)
+		foreground = not foreground
+	if len(runs) % 2 != 0:
+		runs.append(0)
+	return bytes(runs[i] | (runs[i + 1] << 4) for i in range(0, len(runs), 2))
+
+def split_glyphs(values):
+	"""Return the font header values and the column bitmap data of each glyph"""
+	bytes_per_char = values[0] * ((values[1] + 7) // 8) + 1
+	data = values[8:]
+	return values[:8], [data[i:i + bytes_per_char] for i in range(0, len(data) - bytes_per_char + 1, bytes_per_char)]
+
+def read_glyphs(text, scripts):
+	"""Return the font header values and a dictionary of the column bitmap data of each character, keyed by code point"""
+	header, latin = split_glyphs(read_font(text, { macro: False for macro, _ in SCRIPTS }))
+	first_char = header[4] | (header[5] << 8)
+	glyphs = { first_char + i: glyph for i, glyph in enumerate(latin) }
+	for macro, shift in SCRIPTS:
+		if macro in scripts:
+			_, all_glyphs = split_glyphs(read_font(text, { m: m == macro for m, _ in SCRIPTS }))
+			glyphs.update({ first_char + shift + i: glyph for i, glyph in enumerate(all_glyphs) if i >= len(latin) })
+	return header, glyphs
+
+def glyph_columns(glyph, height):
+	bytes_per_column = (height + 7) // 8
+	return [int.from_bytes(bytes(glyph[1 + c * bytes_per_column:1 + (c + 1) * bytes_per_column]), 'little') for c in range(glyph[0])]
+
+def glyph_edges(columns, height):
+	"""Return the columns that UTFT kerns against on the left and on the right of a glyph"""
+	columns = [column & ((1 << height) - 1) for column in columns]
+	leading = columns[0] if columns and columns[0] != 0 else columns[1] if len(columns) > 1 else 0
+	trailing = next((column for column in reversed(columns) if column != 0), 0)
+	return leading, trailing
+
+def encode_glyph(columns, height):
+	encoded = bytearray()
+	previous = None
+	for column in columns:
+		encoded += b'\x00' if column == previous else encode_column(column, height)
+		previous = column
+	return bytes(encoded)
+
+def pack_font(header, glyphs):
+	width, height, spaces = header[0], header[1], header[2]
+	codes = sorted(glyphs)
+
+	ranges = []
+	for i, code in enumerate(codes):
+		if ranges and ranges[-1][1] == code - 1:
+			ranges[-1][1] = code
+		else:
+			ranges.append([code, code, i])
+
+	edges = [0]
+	metrics = []
+	data = bytearray()
+	offsets = []
+	seen = {}
+	for code in codes:
+		columns = glyph_columns(glyphs[code], height)
+		metrics.append(len(columns))
+		for edge in glyph_edges(columns, height):
+			if edge not in edges:
+				edges.append(edge)
+			metrics.append(edges.index(edge))
+		encoded = encode_glyph(columns, height)
+		if encoded not in seen:
+			seen[encoded] = len(data)
+			data += encoded
+		offsets.append(seen[encoded])
+
+	if len(data) > 0xFFFF:
+		sys.exit('font is too big for 16-bit glyph offsets')
+	if len(edges) > 256:
+		sys.exit('font has too many distinct edge columns for 8-bit edge numbers')
+
+	header = [width, height, spaces, FORMAT_SPARSE] + le16(codes[0]) + le16(codes[-1])
+	table = le16(len(ranges))
+	for first, last, index in ranges:
+		table += le16(first) + le16(last) + le16(index)
+	edge_table = le16(len(edges))
+	for edge in edges:
+		edge_table += list(edge.to_bytes((height + 7) // 8, 'little'))
+	index = []
+	for offset in offsets:
+		index += le16(offset)
+	return header, table, edge_table, metrics, index, list(data)
+
+def le16(value):
+	return [value & 0xFF, value >> 8]
+
+def print_bytes(values, per_line=32):
+	for i in range(0, len(values), per_line):
+		print('\t' + ' '.join('0x%02X,' % v for v in values[i:i + per_line]))
+
+def main():
+	source = sys.argv[1]
+	name = os.path.splitext(os.path.basename(source))[0]
+	text = open(source).read()
+
+	packed = []
+	for condition, scripts in VARIANTS:
+		header, glyphs = read_glyphs(text, scripts)
+		bitmap_size = len(header) + sum(len(glyph) for glyph in glyphs.values())
+		packed.append((condition, scripts, bitmap_size) + pack_font(header, glyphs))
+
+	print('''/*
+ * %s_packed.cpp
+ *
+ * Generated from %s.cpp by Tools/fontpack/fontpack.py - do not edit.
+ *''' % (name, name))
+	for condition, scripts, bitmap_size, header, table, edges, metrics, index, glyphs in packed:
+		size = len(header) + len(table) + len(edges) + len(metrics) + len(index) + len(glyphs)
+		label = ' + '.join(['Latin'] + [macro[4:-11].capitalize() for macro in scripts])
+		print(' * %-29s %6d bytes as column bitmaps, %6d bytes packed (%d%% saved)'
+				% (label + ':', bitmap_size, size, 100 - (100 * size) // bitmap_size))
+	print(''' */
+
+#include <asf.h>
+
+#include "Configuration.hpp"
+''')
+
+	for i, (condition, scripts, bitmap_size, header, table, edges, metrics, index, glyphs) in enumerate(packed):
+		if condition is not None:
+			print('#%s %s' % ('if' if i == 0 else 'elif', condition))
+		else:
+			print('#else')
+		print('''
+extern const uint8_t %s_packed[] =
+{
+	%d,			// character width in pixels
+	%d,			// row height in pixels
+	%d,			// space columns between characters before kerning
+	%d,			// font format: sparse packed
+	0x%02X, 0x%02X,	// lowest character code (2 bytes, little endian)
+	0x%02X, 0x%02X,	// highest character code (2 bytes, little endian)
+
+	// Number of ranges, then the first code, last code and first glyph of each range (2 bytes each, little endian)''' % ((name,) + tuple(header)))
+		print('\t0x%02X, 0x%02X,' % tuple(table[:2]))
+		for r in range(2, len(table), 6):
+			print('\t' + ' '.join('0x%02X,' % v for v in table[r:r + 6]))
+		print('\n\t// Number of edge columns (2 bytes, little endian), then the edge columns')
+		print('\t0x%02X, 0x%02X,' % tuple(edges[:2]))
+		print_bytes(edges[2:], 8 * ((header[1] + 7) // 8))
+		print('\n\t// Width, leading edge and trailing edge of each glyph')
+		print_bytes(metrics, 30)
+		print('\n\t// Glyph offsets (2 bytes each, little endian)')
+		print_bytes(index)
+		print('\n\t// Glyphs')
+		print_bytes(glyphs)
+		print('};\n')
+	print('#endif\n\n// End')
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,354 @@
+/*
+ * HostPanel.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "HostPanel.hpp"
+#include "asf.h"
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+
+// PIO controllers
+
+HostPio hostPioA, hostPioB;
+
+void HostPioRegister::operator=(uint32_t val)
+{
+	pio->Write(function, val);
+}
+
+void HostPio::Write(HostPioRegister::Function f, uint32_t val)
+{
+	const uint32_t oldPins = pins;
+	switch (f)
+	{
+	case HostPioRegister::set:
+		pins |= val;
+		break;
+	case HostPioRegister::clear:
+		pins &= ~val;
+		break;
+	case HostPioRegister::output:
+		pins = (pins & ~outputWriteMask) | (val & outputWriteMask);		// only the pins enabled for output writes change
+		break;
+	}
+	PIO_PDSR = pins;
+	if (listener != nullptr && pins != oldPins)
+	{
+		listener(*this, oldPins);
+	}
+}
+
+void pio_enable_output_write(Pio *pio, uint32_t mask)
+{
+	pio->EnableOutputWrite(mask);
+}
+
+namespace HostPanel
+{
+	const uint16_t MaxWidth = 864, MaxHeight = 480;		// the largest panel that the SSD1963 can drive
+	const unsigned int DataShift = (SAM4S) ? 16 : 0;		// where the data bus is on PIOA
+
+	struct Pin
+	{
+		HostPio *pio;
+		uint32_t mask;
+
+		bool IsHigh() const { return (pio->GetPins() & mask) != 0; }
+	};
+
+	static Pin rs, wr, cs;
+	static Stats stats;
+
+	static uint16_t width = MaxWidth, height = MaxHeight;
+	static std::vector<uint16_t> frameBuffer(MaxWidth * MaxHeight, 0);
+
+	// Controller state
+	static uint8_t command = 0;
+	static size_t numParams = 0;
+	static uint8_t params[8];
+	static bool writingMemory = false;
+	static uint16_t startColumn = 0, endColumn = MaxWidth - 1, startPage = 0, endPage = MaxHeight - 1;
+	static uint16_t column = 0, page = 0;
+	static uint8_t addressMode = 0;
+	static uint16_t scrollTop = 0, scrollHeight = MaxHeight, scrollStart = 0;
+
+	static Pin MakePin(unsigned int pin)
+	{
+		return Pin{ (pin < 32) ? PIOA : PIOB, 1u << (pin & 31) };
+	}
+
+	static uint16_t Param16(size_t n)
+	{
+		return ((uint16_t)params[n] << 8) | params[n + 1];
+	}
+
+	static void Reset()
+	{
+		writingMemory = false;
+		startColumn = column = 0;
+		startPage = page = 0;
+		endColumn = width - 1;
+		endPage = height - 1;
+		addressMode = 0;
+		scrollTop = scrollStart = 0;
+		scrollHeight = height;
+	}
+
+	static void Command(uint8_t c)
+	{
+		++stats.commands;
+		command = c;
+		numParams = 0;
+		writingMemory = false;
+		switch (c)
+		{
+		case 0x01:					// software reset
+			Reset();
+			break;
+
+		case 0x2C:					// write memory start
+			++stats.windows;
+			column = startColumn;
+			page = startPage;
+			writingMemory = true;
+			break;
+
+		case 0x3C:					// write memory continue
+			writingMemory = true;
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	static void Pixel(uint16_t colour)
+	{
+		if (page > endPage)
+		{
+			++stats.overruns;
+			page = startPage;
+		}
+		if (column < width && page < height)
+		{
+			frameBuffer[(size_t)page * width + column] = colour;
+		}
+		++stats.pixels;
+		if (column == endColumn)
+		{
+			column = startColumn;
+			++page;
+		}
+		else
+		{
+			++column;
+		}
+	}
+
+	// Parameters are on the low 8 bits of the bus. Act on them when the command has all it needs.
+	static void Parameter(uint8_t val)
+	{
+		++stats.parameters;
+		if (numParams == sizeof(params))
+		{
+			++stats.strayWrites;
+			return;
+		}
+		params[numParams++] = val;
+		switch (command)
+		{
+		case 0x2A:					// set column address
+			if (numParams == 4)
+			{
+				startColumn = Param16(0);
+				endColumn = Param16(2);
+			}
+			break;
+
+		case 0x2B:					// set page address
+			if (numParams == 4)
+			{
+				startPage = Param16(0);
+				endPage = Param16(2);
+			}
+			break;
+
+		case 0x33:					// set scroll area
+			if (numParams == 6)
+			{
+				scrollTop = Param16(0);
+				scrollHeight = Param16(2);
+			}
+			break;
+
+		case 0x36:					// set address mode
+			addressMode = params[0];
+			break;
+
+		case 0x37:					// set scroll start
+			if (numParams == 2)
+			{
+				scrollStart = Param16(0);
+			}
+			break;
+
+		case 0xB0:					// set LCD mode, which includes the panel size
+			if (numParams == 6)
+			{
+				width = std::min<uint16_t>(Param16(2) + 1, MaxWidth);
+				height = std::min<uint16_t>(Param16(4) + 1, MaxHeight);
+				frameBuffer.assign((size_t)width * height, 0);
+				Reset();
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	// Called whenever an output pin changes. The controller latches the bus on the rising edge of WR while CS is low.
+	static void PinsChanged(const HostPio& pio, uint32_t oldPins)
+	{
+		if (&pio == wr.pio && (oldPins & wr.mask) == 0 && wr.IsHigh() && !cs.IsHigh())
+		{
+			const uint16_t data = (uint16_t)(PIOA->GetPins() >> DataShift);
+			if (!rs.IsHigh())
+			{
+				Command((uint8_t)data);
+			}
+			else if (writingMemory)
+			{
+				Pixel(data);
+			}
+			else if (command == 0 || command == 0x2C || command == 0x3C)
+			{
+				++stats.strayWrites;
+			}
+			else
+			{
+				Parameter((uint8_t)data);
+			}
+		}
+	}
+
+	void Init(unsigned int rsPin, unsigned int wrPin, unsigned int csPin)
+	{
+		rs = MakePin(rsPin);
+		wr = MakePin(wrPin);
+		cs = MakePin(csPin);
+		hostPioA.SetListener(PinsChanged);
+		hostPioB.SetListener(PinsChanged);
+		Reset();
+		ResetStats();
+	}
+
+	const Stats& GetStats()
+	{
+		return stats;
+	}
+
+	void ResetStats()
+	{
+		memset(&stats, 0, sizeof(stats));
+	}
+
+	uint16_t GetWidth()
+	{
+		return width;
+	}
+
+	uint16_t GetHeight()
+	{
+		return height;
+	}
+
+	// The flip bits of the address mode change how the frame buffer is shown, not how it is written
+	uint16_t GetPixel(uint16_t x, uint16_t y)
+	{
+		if (addressMode & 0x02)
+		{
+			x = width - 1 - x;
+		}
+		if (addressMode & 0x01)
+		{
+			y = height - 1 - y;
+		}
+		if (scrollHeight != 0 && y >= scrollTop && y < scrollTop + scrollHeight)
+		{
+			y = scrollTop + (y - scrollTop + scrollStart - scrollTop) % scrollHeight;
+		}
+		return frameBuffer[(size_t)y * width + x];
+	}
+
+	static void ToRgb(uint16_t colour, uint8_t *rgb)
+	{
+		const uint8_t r = colour >> 11, g = (colour >> 5) & 0x3F, b = colour & 0x1F;
+		rgb[0] = (r << 3) | (r >> 2);
+		rgb[1] = (g << 2) | (g >> 4);
+		rgb[2] = (b << 3) | (b >> 2);
+	}
+
+	static std::vector<uint8_t> Image()
+	{
+		std::vector<uint8_t> image((size_t)width * height * 3);
+		uint8_t *p = image.data();
+		for (uint16_t y = 0; y < height; ++y)
+		{
+			for (uint16_t x = 0; x < width; ++x)
+			{
+				ToRgb(GetPixel(x, y), p);
+				p += 3;
+			}
+		}
+		return image;
+	}
+
+	bool WritePpm(const char *filename)
+	{
+		FILE * const f = fopen(filename, "wb");
+		if (f == nullptr)
+		{
+			return false;
+		}
+		const std::vector<uint8_t> image = Image();
+		fprintf(f, "P6\n%u %u\n255\n", width, height);
+		const bool ok = fwrite(image.data(), 1, image.size(), f) == image.size();
+		return fclose(f) == 0 && ok;
+	}
+
+	int32_t Compare(const char *filename)
+	{
+		FILE * const f = fopen(filename, "rb");
+		if (f == nullptr)
+		{
+			return -1;
+		}
+		unsigned int w, h, maxVal;
+		const std::vector<uint8_t> image = Image();
+		std::vector<uint8_t> other(image.size());
+		const bool ok = fscanf(f, "P6 %u %u %u", &w, &h, &maxVal) == 3 && fgetc(f) != EOF
+						&& w == width && h == height && maxVal == 255
+						&& fread(other.data(), 1, other.size(), f) == other.size();
+		fclose(f);
+		if (!ok)
+		{
+			return -1;
+		}
+		int32_t differences = 0;
+		for (size_t i = 0; i < image.size(); i += 3)
+		{
+			if (memcmp(&image[i], &other[i], 3) != 0)
+			{
+				++differences;
+			}
+		}
+		return differences;
+	}
+}
+
+// End
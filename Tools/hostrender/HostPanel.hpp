@@ -0,0 +1,50 @@
+/*
+ * HostPanel.hpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * A model of an SSD1963 display controller and its frame buffer, driven by the writes that UTFT makes to the PIO pins.
+ * It decodes the command and data writes made while CS is low and the window, address mode and scroll commands,
+ * and counts the bus transactions so that the cost of drawing can be measured without the hardware.
+ */
+
+#ifndef TOOLS_HOSTRENDER_HOSTPANEL_HPP_
+#define TOOLS_HOSTRENDER_HOSTPANEL_HPP_
+
+#include <cstdint>
+#include <cstddef>
+
+namespace HostPanel
+{
+	struct Stats
+	{
+		uint32_t commands;			// number of command writes
+		uint32_t parameters;		// number of parameter writes
+		uint32_t windows;			// number of memory write commands, each of which starts filling a window
+		uint32_t pixels;			// number of pixels written to the frame buffer
+		uint32_t overruns;			// number of pixels written after the window was full
+		uint32_t strayWrites;		// number of data writes that no command was expecting
+	};
+
+	// Connect the panel to the pins passed to the UTFT constructor. The data bus is on PIOA, as on the real hardware.
+	void Init(unsigned int rsPin, unsigned int wrPin, unsigned int csPin);
+
+	const Stats& GetStats();
+	void ResetStats();
+
+	// The size of the panel, as set by the controller's LCD mode command
+	uint16_t GetWidth();
+	uint16_t GetHeight();
+
+	// Return the colour shown at a position on the panel, taking account of flipping and scrolling
+	uint16_t GetPixel(uint16_t x, uint16_t y);
+
+	// Write what the panel shows to a binary PPM file. Returns false if the file couldn't be written.
+	bool WritePpm(const char *filename);
+
+	// Compare what the panel shows with a PPM file written by WritePpm. Returns the number of pixels that differ,
+	// or -1 if the file couldn't be read or is a different size.
+	int32_t Compare(const char *filename);
+}
+
+#endif /* TOOLS_HOSTRENDER_HOSTPANEL_HPP_ */
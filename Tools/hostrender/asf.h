@@ -0,0 +1,100 @@
+/*
+ * asf.h
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Replacement for the ASF header when building the display driver for the host.
+ * The PIO controllers are modelled by HostPio objects, so that the pin and data bus writes made by UTFT and OneBitPort
+ * drive the simulated display controller in HostPanel.
+ */
+
+#ifndef ASF_H
+#define ASF_H
+
+#include <cstdint>
+
+#ifndef SAM4S
+# define SAM4S		(1)
+#endif
+#ifndef SAM3S
+# define SAM3S		(!SAM4S)
+#endif
+
+class HostPio;
+
+// A write-only PIO register. Assigning to it tells the owning PIO controller what was written.
+class HostPioRegister
+{
+public:
+	enum Function : uint8_t { set, clear, output };
+
+	constexpr HostPioRegister(HostPio *p, Function f) : pio(p), function(f) { }
+	void operator=(uint32_t val);
+
+private:
+	HostPio * const pio;
+	const Function function;
+};
+
+// A PIO controller. Only the registers that the display driver uses are provided.
+class HostPio
+{
+public:
+	// This is constexpr so that the PIOs are set up before any static constructors run, like the one for the UTFT object in the firmware
+	constexpr HostPio()
+		: PIO_SODR(this, HostPioRegister::set), PIO_CODR(this, HostPioRegister::clear), PIO_ODSR(this, HostPioRegister::output),
+		  PIO_PDSR(0xFFFFFFFF), pins(0xFFFFFFFF), outputWriteMask(0), listener(nullptr)
+	{
+	}
+
+	HostPioRegister PIO_SODR, PIO_CODR, PIO_ODSR;
+	uint32_t PIO_PDSR;
+
+	void Write(HostPioRegister::Function f, uint32_t val);
+
+	// The bus model is told about every change to the output pins, with the previous state of the pins
+	typedef void (*Listener)(const HostPio& pio, uint32_t oldPins);
+	void SetListener(Listener l) { listener = l; }
+
+	uint32_t GetPins() const { return pins; }
+	void EnableOutputWrite(uint32_t mask) { outputWriteMask |= mask; }
+
+private:
+	uint32_t pins;
+	uint32_t outputWriteMask;		// the pins that writes to PIO_ODSR change
+	Listener listener;
+};
+
+typedef HostPio Pio;
+
+// The backlight driver isn't built for the host, but its header is included by the user interface
+struct pwm_channel_t;
+
+extern HostPio hostPioA, hostPioB;
+
+#define PIOA	(&hostPioA)
+#define PIOB	(&hostPioB)
+
+#define PIO_INPUT		(0)
+#define PIO_OUTPUT_0	(1)
+#define PIO_PULLUP		(1)
+
+static inline uint32_t pio_configure(Pio *, uint32_t, uint32_t, uint32_t) { return 1; }
+void pio_enable_output_write(Pio *pio, uint32_t mask);
+
+// CMSIS intrinsics used by the display driver
+static inline uint32_t __RBIT(uint32_t val)
+{
+	uint32_t result = 0;
+	for (unsigned int i = 0; i < 32; ++i)
+	{
+		result = (result << 1) | (val & 1);
+		val >>= 1;
+	}
+	return result;
+}
+
+// The host display doesn't need any time to initialise
+static inline void delay_ms(uint32_t) { }
+
+#endif // ASF_H
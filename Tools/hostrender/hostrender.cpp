@@ -0,0 +1,997 @@
+/*
+ * hostrender.cpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Render a set of test scenes with the UTFT driver on the host, using the SSD1963 model in HostPanel.
+ * Each scene is drawn in each of the orientations that PanelDue supports and written to a PPM file.
+ * The bus activity counted by UTFT and by the model is printed, so that the cost of changes to the drawing code can be compared.
+ * Each scene is also drawn using band rendering, which must give the same image as drawing it directly.
+ * Scenes that have a reference drawing are drawn again by simpler means, such as one pixel at a time using drawPixel or without
+ * hardware scrolling, which must give the same image.
+ * If a reference folder is given, the images are compared with the ones in that folder instead of being written.
+ *
+ * Usage: hostrender [-o output-folder] [-r reference-folder] [splash.qoi]
+ */
+
+#include "asf.h"
+#include <Hardware/UTFT.hpp>
+#include <Icons/Icons.hpp>
+#include <UI/DisplaySize.hpp>
+#include "HostPanel.hpp"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+extern const uint8_t glcd19x21_packed[], glcd28x32_packed[];
+
+const unsigned int PinRS = 15, PinWR = 14, PinCS = 0, PinRST = 39;		// as on version 3.0 boards
+const uint16_t BandLines = 16;
+
+// The host has plenty of memory, but UTFT::allocateBand asks how much is free before taking the band buffer
+static uint32_t freeMemory = 0;
+
+uint32_t GetFreeMemory()
+{
+	return freeMemory;
+}
+
+static std::vector<uint8_t> splash;
+
+struct Scene
+{
+	const char *name;
+	void (*draw)(UTFT& lcd);
+	void (*reference)(UTFT& lcd);	// if not null, draws the same image by simpler means
+	bool banded;					// false if the scene can't be drawn using band rendering
+};
+
+// Draw a rectangle one pixel at a time. getPixel(col, row) returns the colour at that offset within the rectangle.
+// If 'transparent' is true then white pixels are skipped, as the bitmap drawing functions do.
+template<class F> static void DrawByPixel(UTFT& lcd, int x, int y, int sx, int sy, bool transparent, F getPixel)
+{
+	for (int row = 0; row < sy; ++row)
+	{
+		for (int col = 0; col < sx; ++col)
+		{
+			const uint16_t colour = getPixel(col, row);
+			if (!transparent || colour != white)
+			{
+				lcd.setColor(colour);
+				lcd.drawPixel(x + col, y + row);
+			}
+		}
+	}
+}
+
+static void DrawText(UTFT& lcd)
+{
+	lcd.fillScr(black);
+	const uint8_t * const fonts[] = { glcd19x21_packed, glcd28x32_packed };
+	uint16_t y = 4;
+	for (const uint8_t *font : fonts)
+	{
+		lcd.setFont(font);
+		lcd.setColor(white);
+		lcd.setBackColor(black);
+		lcd.setTextPos(4, y);
+		lcd.printf("The quick brown fox jumps over the lazy dog 0123456789");
+		y += lcd.getFontHeight() + 2;
+		lcd.setColor(UTFT::fromRGB(255, 255, 0));
+		lcd.setBackColor(UTFT::fromRGB(0, 0, 160));
+		lcd.setTextPos(4, y, lcd.getDisplayXSize()/2);
+		lcd.printf("Clipped at the margin, with a background");
+		lcd.clearToMargin();
+		y += lcd.getFontHeight() + 2;
+		lcd.setColor(UTFT::fromRGB(0, 255, 0));
+		lcd.setTransparentBackground(true);
+		lcd.setTextPos(4, y);
+		lcd.printf("Transparent: Gr\xC3\xBC\xC3\x9F\xC3\xA9 %d%% %.1f\xC2\xB0" "C", 42, 215.5);
+		lcd.setTransparentBackground(false);
+		y += lcd.getFontHeight() + 6;
+	}
+}
+
+// The characters to measure: printable ASCII, Latin-1 and Latin Extended-A, Cyrillic, and the Japanese kana.
+// Characters that the fonts in this build don't have are drawn as a box.
+static const uint16_t measuredRanges[][2] = { { 0x21, 0x7E }, { 0xA1, 0x17E }, { 0x400, 0x491 }, { 0x3041, 0x30FE } };
+
+static void AppendUtf8(std::string& s, uint16_t c)
+{
+	if (c < 0x80)
+	{
+		s += (char)c;
+	}
+	else if (c < 0x800)
+	{
+		s += (char)(0xC0 | (c >> 6));
+		s += (char)(0x80 | (c & 0x3F));
+	}
+	else
+	{
+		s += (char)(0xE0 | (c >> 12));
+		s += (char)(0x80 | ((c >> 6) & 0x3F));
+		s += (char)(0x80 | (c & 0x3F));
+	}
+}
+
+// Print a line of text with a box around it, as wide as measureText says the text is, or as wide as it turned out to be if byPrinting is true.
+// If fitText doesn't agree with measureText then mark the line in red.
+static void PrintMeasuredLine(UTFT& lcd, const std::string& line, uint16_t y, bool byPrinting)
+{
+	const uint16_t x = 4;
+	uint16_t width = lcd.measureText(line.c_str(), lcd.getDisplayXSize());
+	const bool fits = lcd.fitText(line.c_str(), width) == line.size() && lcd.fitText(line.c_str(), width - 1) < line.size();
+	lcd.setColor(white);
+	lcd.setTextPos(x, y);
+	lcd.printf("%s", line.c_str());
+	if (byPrinting)
+	{
+		width = lcd.getTextX() - x;
+	}
+	else if (!fits)
+	{
+		lcd.setColor(UTFT::fromRGB(255, 0, 0));
+		lcd.fillRect(0, y, 2, y + lcd.getFontHeight() - 1);
+	}
+	lcd.setColor(UTFT::fromRGB(0, 160, 255));
+	lcd.drawRect(x - 1, y - 1, x + width, y + lcd.getFontHeight());
+}
+
+// Print the characters of both fonts in lines as wide as the display, for as many lines as fit
+static void Measure(UTFT& lcd, bool byPrinting)
+{
+	lcd.fillScr(black);
+	lcd.setBackColor(black);
+	const uint8_t * const fonts[] = { glcd19x21_packed, glcd28x32_packed };
+	const uint16_t maxWidth = lcd.getDisplayXSize() - 8;
+	uint16_t y = 2;
+	for (const uint8_t *font : fonts)
+	{
+		lcd.setFont(font);
+		std::string line;
+		for (const auto& range : measuredRanges)
+		{
+			for (uint16_t c = range[0]; c <= range[1]; ++c)
+			{
+				std::string longer = line;
+				AppendUtf8(longer, c);
+				if (lcd.measureText(longer.c_str(), maxWidth + 1) > maxWidth)
+				{
+					if (y + lcd.getFontHeight() + 1 >= lcd.getDisplayYSize())
+					{
+						return;
+					}
+					PrintMeasuredLine(lcd, line, y, byPrinting);
+					y += lcd.getFontHeight() + 3;
+					longer.clear();
+					AppendUtf8(longer, c);
+				}
+				line = longer;
+			}
+		}
+		if (y + lcd.getFontHeight() + 1 < lcd.getDisplayYSize())
+		{
+			PrintMeasuredLine(lcd, line, y, byPrinting);
+			y += lcd.getFontHeight() + 3;
+		}
+	}
+}
+
+static void DrawMeasure(UTFT& lcd)
+{
+	Measure(lcd, false);
+}
+
+static void DrawMeasureByPrinting(UTFT& lcd)
+{
+	Measure(lcd, true);
+}
+
+static DisplayOrientation currentOrientation;
+
+static void DrawShapes(UTFT& lcd)
+{
+	lcd.fillScr(UTFT::fromRGB(40, 40, 40));
+	lcd.setColor(UTFT::fromRGB(255, 0, 0));
+	lcd.fillRect(10, 10, 150, 90);
+	lcd.setColor(UTFT::fromRGB(0, 0, 255));
+	lcd.fillRect(170, 10, 310, 90, UTFT::fromRGB(0, 255, 255), 2);
+	lcd.setColor(white);
+	lcd.drawRect(330, 10, 470, 90);
+	lcd.setColor(UTFT::fromRGB(0, 255, 0));
+	lcd.fillRoundRect(10, 110, 150, 190);
+	lcd.setColor(white);
+	lcd.drawRoundRect(170, 110, 310, 190);
+	lcd.setColor(UTFT::fromRGB(255, 128, 0));
+	lcd.fillCircle(390, 150, 40);
+	lcd.setColor(white);
+	lcd.drawCircle(390, 150, 50);
+	for (int i = 0; i <= 8; ++i)
+	{
+		lcd.setColor(UTFT::fromRGB(i * 31, 255 - i * 31, 128));
+		lcd.drawLine(10, 210, 10 + i * 55, 260);
+		lcd.drawLine(10 + i * 55, 210, 450, 260);
+	}
+	lcd.drawPixel(470, 260);
+}
+
+// Per-pixel versions of the UTFT shape functions, as they were before they drew spans, except that fillCircle now fills the whole of each row
+static void PixelHLine(UTFT& lcd, int x, int y, int len)
+{
+	for (int i = 0; i < len; ++i)
+	{
+		lcd.drawPixel(x + i, y);
+	}
+}
+
+static void PixelVLine(UTFT& lcd, int x, int y, int len)
+{
+	for (int i = 0; i < len; ++i)
+	{
+		lcd.drawPixel(x, y + i);
+	}
+}
+
+static void PixelLine(UTFT& lcd, int x1, int y1, int x2, int y2)
+{
+	const int dx = std::abs(x2 - x1), dy = std::abs(y2 - y1);
+	const int sx = (x1 < x2) ? 1 : -1, sy = (y1 < y2) ? 1 : -1;
+	int err = dx - dy;
+	for (;;)
+	{
+		lcd.drawPixel(x1, y1);
+		if (x1 == x2 && y1 == y2)
+		{
+			break;
+		}
+		const int e2 = err + err;
+		if (e2 > -dy)
+		{
+			err -= dy;
+			x1 += sx;
+		}
+		if (e2 < dx)
+		{
+			err += dx;
+			y1 += sy;
+		}
+	}
+}
+
+static void PixelRect(UTFT& lcd, int x1, int y1, int x2, int y2)
+{
+	PixelHLine(lcd, x1, y1, x2 - x1 + 1);
+	PixelHLine(lcd, x1, y2, x2 - x1 + 1);
+	PixelVLine(lcd, x1, y1, y2 - y1 + 1);
+	PixelVLine(lcd, x2, y1, y2 - y1 + 1);
+}
+
+static void PixelRoundRect(UTFT& lcd, int x1, int y1, int x2, int y2)
+{
+	lcd.drawPixel(x1 + 1, y1 + 1);
+	lcd.drawPixel(x2 - 1, y1 + 1);
+	lcd.drawPixel(x1 + 1, y2 - 1);
+	lcd.drawPixel(x2 - 1, y2 - 1);
+	PixelHLine(lcd, x1 + 2, y1, x2 - x1 - 3);
+	PixelHLine(lcd, x1 + 2, y2, x2 - x1 - 3);
+	PixelVLine(lcd, x1, y1 + 2, y2 - y1 - 3);
+	PixelVLine(lcd, x2, y1 + 2, y2 - y1 - 3);
+}
+
+// The gradient changes along columns if 'byCols' is true, else along rows. fillRect uses columns when the orientation swaps X and Y.
+static void PixelFillRect(UTFT& lcd, Colour colour, int x1, int y1, int x2, int y2, Colour grad, uint8_t gradChange, bool byCols)
+{
+	const int numLines = (byCols) ? x2 - x1 + 1 : y2 - y1 + 1;
+	for (int i = 0; i < numLines; ++i)
+	{
+		lcd.setColor(colour + grad * (i / gradChange));
+		if (byCols)
+		{
+			PixelVLine(lcd, x1 + i, y1, y2 - y1 + 1);
+		}
+		else
+		{
+			PixelHLine(lcd, x1, y1 + i, x2 - x1 + 1);
+		}
+	}
+}
+
+static void PixelFillRoundRect(UTFT& lcd, Colour colour, int x1, int y1, int x2, int y2, Colour grad, uint8_t gradChange)
+{
+	for (int i = 0; y1 + i <= y2; ++i)
+	{
+		const int inset = (i == 0 || y1 + i == y2) ? 2 : (i == 1 || y1 + i == y2 - 1) ? 1 : 0;
+		lcd.setColor(colour + grad * (i / gradChange));
+		PixelHLine(lcd, x1 + inset, y1 + i, x2 - x1 + 1 - 2 * inset);
+	}
+}
+
+static void PixelCircle(UTFT& lcd, int x, int y, int radius, bool fill)
+{
+	int f = 1 - radius, ddF_x = 1, ddF_y = -2 * radius, x1 = 0, y1 = radius;
+	lcd.drawPixel(x, y + radius);
+	lcd.drawPixel(x, y - radius);
+	if (fill)
+	{
+		PixelHLine(lcd, x - radius, y, 2 * radius + 1);
+	}
+	else
+	{
+		lcd.drawPixel(x + radius, y);
+		lcd.drawPixel(x - radius, y);
+	}
+	while (x1 < y1)
+	{
+		if (f >= 0)
+		{
+			y1--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x1++;
+		ddF_x += 2;
+		f += ddF_x;
+		if (fill)
+		{
+			PixelHLine(lcd, x - x1, y + y1, 2 * x1 + 1);
+			PixelHLine(lcd, x - x1, y - y1, 2 * x1 + 1);
+			PixelHLine(lcd, x - y1, y + x1, 2 * y1 + 1);
+			PixelHLine(lcd, x - y1, y - x1, 2 * y1 + 1);
+		}
+		else
+		{
+			for (int sx : { -1, 1 })
+			{
+				for (int sy : { -1, 1 })
+				{
+					lcd.drawPixel(x + sx * x1, y + sy * y1);
+					lcd.drawPixel(x + sx * y1, y + sy * x1);
+				}
+			}
+		}
+	}
+}
+
+// Draw the shapes that exercise the span code, either with the UTFT functions or one pixel at a time
+static void Spans(UTFT& lcd, bool byPixel)
+{
+	const Colour background = UTFT::fromRGB(0, 0, 60);
+	lcd.fillScr(background);
+
+	// Gradient fills, changing every 1, 2 and 3 lines, and flat fills
+	const bool gradByCols = (currentOrientation & SwapXY) != 0;
+	for (uint8_t gradChange = 1; gradChange <= 3; ++gradChange)
+	{
+		const int x1 = 4 + (gradChange - 1) * 80, y1 = 4, x2 = x1 + 70, y2 = y1 + 50;
+		const Colour colour = UTFT::fromRGB(40, 40, 200), grad = (gradChange == 3) ? 0 : UTFT::fromRGB(0, 4, 0);
+		if (byPixel)
+		{
+			PixelFillRect(lcd, colour, x1, y1, x2, y2, grad, gradChange, gradByCols);
+			PixelFillRoundRect(lcd, colour, x1, y2 + 6, x2, y2 + 56, grad, gradChange);
+		}
+		else
+		{
+			lcd.setColor(colour);
+			lcd.fillRect(x1, y1, x2, y2, grad, gradChange);
+			lcd.fillRoundRect(x1, y2 + 6, x2, y2 + 56, grad, gradChange);
+		}
+	}
+
+	// Outlines
+	lcd.setColor(white);
+	for (int i = 0; i < 4; ++i)
+	{
+		const int x1 = 250 + i * 40, y1 = 4, x2 = x1 + 6 + i * 9, y2 = y1 + 6 + i * 13;
+		if (byPixel)
+		{
+			PixelRect(lcd, x1, y1, x2, y2);
+			PixelRoundRect(lcd, x1, y2 + 6, x2, 2 * y2 + 2);
+		}
+		else
+		{
+			lcd.drawRect(x1, y1, x2, y2);
+			lcd.drawRoundRect(x1, y2 + 6, x2, 2 * y2 + 2);
+		}
+	}
+
+	// Circles of every radius up to 12, and a large one
+	for (int radius = 0; radius <= 12; ++radius)
+	{
+		const int x = 14 + radius * 30, y = 150;
+		lcd.setColor(UTFT::fromRGB(255, 128, radius * 20));
+		if (byPixel)
+		{
+			PixelCircle(lcd, x, y, radius, true);
+		}
+		else
+		{
+			lcd.fillCircle(x, y, radius);
+		}
+		lcd.setColor(white);
+		if (byPixel)
+		{
+			PixelCircle(lcd, x, y + 30, radius, false);
+		}
+		else
+		{
+			lcd.drawCircle(x, y + 30, radius);
+		}
+	}
+	lcd.setColor(UTFT::fromRGB(0, 200, 0));
+	if (byPixel)
+	{
+		PixelCircle(lcd, 80, 300, 57, true);
+		lcd.setColor(white);
+		PixelCircle(lcd, 80, 300, 63, false);
+	}
+	else
+	{
+		lcd.fillCircle(80, 300, 57);
+		lcd.setColor(white);
+		lcd.drawCircle(80, 300, 63);
+	}
+
+	// Lines from the centre of a square to points all round its edge, which covers every octant and the horizontal and vertical cases
+	const int cx = 300, cy = 330, half = 90;
+	for (int i = -half; i <= half; i += 15)
+	{
+		const int ends[4][2] = { { cx + i, cy - half }, { cx + half, cy + i }, { cx - i, cy + half }, { cx - half, cy - i } };
+		for (const auto& end : ends)
+		{
+			lcd.setColor(UTFT::fromRGB(128 + i, 128 - i, 255));
+			if (byPixel)
+			{
+				PixelLine(lcd, cx, cy, end[0], end[1]);
+			}
+			else
+			{
+				lcd.drawLine(cx, cy, end[0], end[1]);
+			}
+		}
+	}
+}
+
+static void DrawSpans(UTFT& lcd)
+{
+	Spans(lcd, false);
+}
+
+static void DrawSpansByPixel(UTFT& lcd)
+{
+	Spans(lcd, true);
+}
+
+// Decode a 4-bit run-length compressed icon into one palette index per pixel, a row at a time from top to bottom.
+// Each byte of the data holds the palette index in the top 4 bits and the run length - 1 in the bottom 4 bits. Runs may continue onto the next row.
+static std::vector<uint8_t> DecodeIcon(const uint8_t *icon)
+{
+	std::vector<uint8_t> indices;
+	const size_t numPixels = (size_t)icon[0] * icon[1];
+	for (const uint8_t *data = icon + 2; indices.size() < numPixels; ++data)
+	{
+		indices.insert(indices.end(), (*data & 0x0F) + 1, *data >> 4);
+	}
+	return indices;
+}
+
+// Draw the icons using drawCompressedBitmap4, or if 'byPixel' is true then decode them here and draw them using drawPixel
+static void Icons(UTFT& lcd, bool byPixel)
+{
+	lcd.fillScr(UTFT::fromRGB(200, 200, 200));
+	const uint8_t * const icons[] =
+	{
+		IconNozzle, IconSpindle, IconHomeAll, IconBedComp, IconBed, IconChamber, IconOk, IconCancel, IconFiles, IconKeyboard, IconTrash,
+		IconBackspace, IconEnter
+	};
+	const Palette palettes[] = { IconPaletteLight, IconPaletteDark };
+	uint16_t y = 4;
+	for (bool transparent : { false, true })
+	{
+		for (Palette palette : palettes)
+		{
+			uint16_t x = 4, rowHeight = 0;
+			lcd.setTransparentBackground(transparent);
+			for (const uint8_t *icon : icons)
+			{
+				if (byPixel)
+				{
+					const std::vector<uint8_t> indices = DecodeIcon(icon);
+					const int width = icon[0];
+					DrawByPixel(lcd, x, y, icon[0], icon[1], transparent, [&](int col, int row) { return palette[indices[row * width + col]]; });
+				}
+				else
+				{
+					lcd.drawCompressedBitmap4(x, y, icon[0], icon[1], icon + 2, palette);
+				}
+				x += icon[0] + 4;
+				rowHeight = std::max<uint16_t>(rowHeight, icon[1]);
+			}
+			lcd.setTransparentBackground(false);
+			y += rowHeight + 4;
+		}
+	}
+}
+
+static void DrawIcons(UTFT& lcd)
+{
+	Icons(lcd, false);
+}
+
+static void DrawIconsByPixel(UTFT& lcd)
+{
+	Icons(lcd, true);
+}
+
+// The bitmaps used to exercise the blit code. They have odd sizes, vary along both axes so that a transposed or mirrored image shows,
+// and have stripes of white for the transparent paths to skip.
+const int BlitWidth = 23, BlitHeight = 17;
+static std::vector<uint16_t> blitRows, blitCols, blitRunsByCol, blitRunsBottomToTop;
+static std::vector<uint8_t> blit4Rows, blit4Cols, blit4Runs;
+static std::vector<uint32_t> blitRgba;
+static uint16_t blitPalette[16];
+
+static uint16_t BlitPixel(int col, int row)
+{
+	return ((col + 2 * row) % 7 < 2) ? white : UTFT::fromRGB((col / 4) * 40, (row / 3) * 35, col * row);
+}
+
+static uint8_t BlitIndex(int col, int row)
+{
+	return ((col / 3) + 5 * (row / 2)) % 16;
+}
+
+// Append (count - 1, colour) pairs for the pixels returned by getPixel(i) for i from 0 to n - 1
+template<class F> static void AppendRuns(std::vector<uint16_t>& runs, int n, F getPixel)
+{
+	for (int i = 0; i < n; )
+	{
+		const uint16_t colour = getPixel(i);
+		int len = 1;
+		while (i + len < n && getPixel(i + len) == colour)
+		{
+			++len;
+		}
+		runs.push_back(len - 1);
+		runs.push_back(colour);
+		i += len;
+	}
+}
+
+static void MakeBlitData()
+{
+	std::vector<uint8_t> indices;
+	for (int row = 0; row < BlitHeight; ++row)
+	{
+		for (int col = 0; col < BlitWidth; ++col)
+		{
+			blitRows.push_back(BlitPixel(col, row));
+			blitRgba.push_back(0xFF000000 | (((uint32_t)col * 11) << 16) | (((uint32_t)row * 15) << 8) | (uint32_t)((col * 7 + row * 5) & 0xFF));
+			indices.push_back(BlitIndex(col, row));
+		}
+	}
+	for (int col = 0; col < BlitWidth; ++col)
+	{
+		for (int row = 0; row < BlitHeight; ++row)
+		{
+			blitCols.push_back(BlitPixel(col, row));
+		}
+	}
+
+	// 4-bit bitmaps hold two pixels per byte, first pixel in the top 4 bits
+	auto pack = [](std::vector<uint8_t>& data, int i, uint8_t index)
+				{
+					if ((i & 1) == 0)
+					{
+						data.push_back(index << 4);
+					}
+					else
+					{
+						data.back() |= index;
+					}
+				};
+	for (int i = 0; i < BlitWidth * BlitHeight; ++i)
+	{
+		pack(blit4Rows, i, indices[i]);
+		pack(blit4Cols, i, BlitIndex(i / BlitHeight, i % BlitHeight));
+	}
+
+	// Compressed 4-bit runs are one byte each, index in the top 4 bits and length - 1 in the bottom 4 bits, a row at a time
+	for (int i = 0; i < BlitWidth * BlitHeight; )
+	{
+		int len = 1;
+		while (len < 16 && i + len < BlitWidth * BlitHeight && indices[i + len] == indices[i])
+		{
+			++len;
+		}
+		blit4Runs.push_back((indices[i] << 4) | (len - 1));
+		i += len;
+	}
+
+	AppendRuns(blitRunsByCol, BlitWidth * BlitHeight, [](int i) { return BlitPixel(i / BlitHeight, i % BlitHeight); });
+	AppendRuns(blitRunsBottomToTop, BlitWidth * BlitHeight, [](int i) { return BlitPixel(i % BlitWidth, BlitHeight - 1 - i / BlitWidth); });
+
+	for (unsigned int i = 0; i < 16; ++i)
+	{
+		blitPalette[i] = (i == 5) ? white : UTFT::fromRGB(i * 16, 255 - i * 16, (i & 3) * 80);
+	}
+}
+
+static uint16_t RgbaPixel(uint32_t rgba)
+{
+	return UTFT::fromRGB(rgba & 0xFF, (rgba >> 8) & 0xFF, (rgba >> 16) & 0xFF);
+}
+
+// Draw each kind of bitmap at scales 1 and 2, with and without a transparent background, either with the bitmap functions or one pixel at a time
+static void Blits(UTFT& lcd, bool byPixel)
+{
+	lcd.fillScr(UTFT::fromRGB(60, 0, 60));
+	int x = 4, y = 4;
+	auto next = [&x, &y](int sx)
+				{
+					x += sx + 6;
+					if (x > 400)
+					{
+						x = 4;
+						y += 2 * BlitHeight + 6;
+					}
+				};
+
+	for (bool transparent : { false, true })
+	{
+		lcd.setTransparentBackground(transparent);
+		for (int scale : { 1, 2 })
+		{
+			for (bool byCols : { false, true })
+			{
+				const int sx = BlitWidth * scale, sy = BlitHeight * scale;
+				if (byPixel)
+				{
+					DrawByPixel(lcd, x, y, sx, sy, transparent, [scale](int col, int row) { return BlitPixel(col / scale, row / scale); });
+				}
+				else
+				{
+					lcd.drawBitmap16(x, y, BlitWidth, BlitHeight, (byCols) ? blitCols.data() : blitRows.data(), scale, byCols);
+				}
+				next(sx);
+
+				if (byPixel)
+				{
+					DrawByPixel(lcd, x, y, sx, sy, transparent, [scale](int col, int row) { return blitPalette[BlitIndex(col / scale, row / scale)]; });
+				}
+				else
+				{
+					lcd.drawBitmap4(x, y, BlitWidth, BlitHeight, (byCols) ? blit4Cols.data() : blit4Rows.data(), blitPalette, scale, byCols);
+				}
+				next(sx);
+			}
+		}
+
+		if (byPixel)
+		{
+			DrawByPixel(lcd, x, y, BlitWidth, BlitHeight, transparent, [](int col, int row) { return blitPalette[BlitIndex(col, row)]; });
+		}
+		else
+		{
+			lcd.drawCompressedBitmap4(x, y, BlitWidth, BlitHeight, blit4Runs.data(), blitPalette);
+		}
+		next(BlitWidth);
+	}
+	lcd.setTransparentBackground(false);
+
+	// The 16-bit compressed bitmaps have no transparent background
+	if (byPixel)
+	{
+		DrawByPixel(lcd, x, y, BlitWidth, BlitHeight, false, BlitPixel);
+		next(BlitWidth);
+		DrawByPixel(lcd, x, y, BlitWidth, BlitHeight, false, BlitPixel);
+	}
+	else
+	{
+		lcd.drawCompressedBitmap(x, y, BlitWidth, BlitHeight, blitRunsByCol.data());
+		next(BlitWidth);
+		lcd.drawCompressedBitmapBottomToTop(x, y, BlitWidth, BlitHeight, blitRunsBottomToTop.data());
+	}
+	next(BlitWidth);
+
+	// Send the RGBA stream in pieces that start and end part way along a row. Between them they cover the whole bitmap.
+	if (byPixel)
+	{
+		DrawByPixel(lcd, x, y, BlitWidth, BlitHeight, false, [](int col, int row) { return RgbaPixel(blitRgba[row * BlitWidth + col]); });
+	}
+	else
+	{
+		const size_t pieces[] = { 0, 5, 50, BlitWidth * 4, BlitWidth * 4 + 1, BlitWidth * BlitHeight };
+		for (size_t i = 0; i + 1 < sizeof(pieces)/sizeof(pieces[0]); ++i)
+		{
+			lcd.drawBitmapRgbaStream(x, y, BlitWidth, BlitHeight, pieces[i], blitRgba.data() + pieces[i], pieces[i + 1] - pieces[i]);
+		}
+	}
+}
+
+static void DrawBlits(UTFT& lcd)
+{
+	Blits(lcd, false);
+}
+
+static void DrawBlitsByPixel(UTFT& lcd)
+{
+	Blits(lcd, true);
+}
+
+static void DrawSplash(UTFT& lcd)
+{
+	lcd.drawQoiBitmap(0, 0, lcd.getDisplayXSize(), lcd.getDisplayYSize(), splash.data());
+}
+
+const uint16_t ScrollRows = 10, ScrollLines = 2 * ScrollRows + 3;
+
+static uint16_t ScrollRowHeight(UTFT& lcd)
+{
+	return lcd.getFontHeight() + 2;
+}
+
+static void DrawScrollHeader(UTFT& lcd)
+{
+	lcd.fillScr(black);
+	lcd.setFont(glcd19x21_packed);
+	lcd.setColor(white);
+	lcd.setBackColor(black);
+	lcd.setTextPos(4, 4);
+	lcd.printf("Header above the scroll area");
+}
+
+// Draw the footer, and shapes and a bitmap that cross the edges of the scroll area and the row where it wraps
+static void DrawScrollFooter(UTFT& lcd)
+{
+	const uint16_t rowHeight = ScrollRowHeight(lcd), top = 2 * rowHeight, bottom = top + ScrollRows * rowHeight - 1;
+	lcd.setColor(white);
+	lcd.setTextPos(4, bottom + 5);
+	lcd.printf("Footer below the scroll area");
+	lcd.setColor(UTFT::fromRGB(255, 0, 0));
+	lcd.fillRect(300, top - 10, 340, bottom + 10);
+	lcd.setColor(UTFT::fromRGB(0, 255, 0));
+	lcd.fillCircle(400, top + 3, 20);
+	lcd.drawLine(360, top - 15, 460, bottom + 15);
+	lcd.drawBitmap16(480, top + 10, BlitWidth, BlitHeight, blitRows.data(), 8, false);
+
+	// Windows two rows high starting at every row from just above the scroll area, so that one starts on each edge and on the wrap row
+	for (uint16_t y = top - 1; y <= bottom; ++y)
+	{
+		lcd.setColor(UTFT::fromRGB(255, y, 255 - y));
+		lcd.fillRect(240 + y - top, y, 240 + y - top, y + 1);
+	}
+}
+
+// Fill a scroll area with numbered lines, then scroll it and add more. Only landscape orientations without a vertical flip can scroll.
+static void DrawScroll(UTFT& lcd)
+{
+	DrawScrollHeader(lcd);
+	const uint16_t rowHeight = ScrollRowHeight(lcd), top = 2 * rowHeight, numRows = ScrollRows;
+	const bool canScroll = lcd.setScrollArea(top, numRows * rowHeight);
+	for (unsigned int line = 0; line < ScrollLines; ++line)
+	{
+		uint16_t row = line;
+		if (line >= numRows)
+		{
+			row = numRows - 1;
+			if (canScroll)
+			{
+				lcd.scrollUp(rowHeight);
+			}
+			else
+			{
+				// Without hardware scrolling, redraw the lines that remain visible
+				for (uint16_t r = 0; r < numRows - 1; ++r)
+				{
+					lcd.setTextPos(4, top + r * rowHeight);
+					lcd.printf("Message line %u", line - (numRows - 1) + r);
+					lcd.clearToMargin();
+				}
+			}
+		}
+		lcd.setTextPos(4, top + row * rowHeight);
+		lcd.printf("Message line %u", line);
+		lcd.clearToMargin();
+	}
+	DrawScrollFooter(lcd);
+}
+
+// Draw what the scroll scene ends up showing, without scrolling
+static void DrawScrollResult(UTFT& lcd)
+{
+	lcd.InitLCD(currentOrientation, IS_24BIT, IS_ER);		// this removes the scroll area
+	DrawScrollHeader(lcd);
+	const uint16_t rowHeight = ScrollRowHeight(lcd), top = 2 * rowHeight;
+	for (uint16_t row = 0; row < ScrollRows; ++row)
+	{
+		lcd.setTextPos(4, top + row * rowHeight);
+		lcd.printf("Message line %u", ScrollLines - ScrollRows + row);
+		lcd.clearToMargin();
+	}
+	DrawScrollFooter(lcd);
+}
+
+static const Scene scenes[] =
+{
+	{ "text", DrawText, nullptr, true },
+	{ "measure", DrawMeasure, DrawMeasureByPrinting, true },
+	{ "shapes", DrawShapes, nullptr, true },
+	{ "icons", DrawIcons, DrawIconsByPixel, true },
+	{ "blits", DrawBlits, DrawBlitsByPixel, true },
+	{ "spans", DrawSpans, DrawSpansByPixel, true },
+	{ "splash", DrawSplash, nullptr, true },
+	{ "scroll", DrawScroll, DrawScrollResult, false },
+};
+
+static const DisplayOrientation orientations[] =
+{
+	Default,
+	static_cast<DisplayOrientation>(ReverseX | ReverseY),
+	static_cast<DisplayOrientation>(SwapXY | ReverseX),
+	static_cast<DisplayOrientation>(SwapXY | ReverseY),
+};
+
+static bool Passed(const char *result)
+{
+	return strcmp(result, "ok") == 0 || strcmp(result, "matches reference") == 0;
+}
+
+static std::vector<uint8_t> ReadFile(const char *filename)
+{
+	std::vector<uint8_t> data;
+	FILE * const f = fopen(filename, "rb");
+	if (f != nullptr)
+	{
+		uint8_t buffer[4096];
+		size_t n;
+		while ((n = fread(buffer, 1, sizeof(buffer), f)) != 0)
+		{
+			data.insert(data.end(), buffer, buffer + n);
+		}
+		fclose(f);
+	}
+	return data;
+}
+
+static std::vector<uint16_t> Capture()
+{
+	std::vector<uint16_t> pixels;
+	for (uint16_t y = 0; y < HostPanel::GetHeight(); ++y)
+	{
+		for (uint16_t x = 0; x < HostPanel::GetWidth(); ++x)
+		{
+			pixels.push_back(HostPanel::GetPixel(x, y));
+		}
+	}
+	return pixels;
+}
+
+int main(int argc, char **argv)
+{
+	const char *outputFolder = ".", *referenceFolder = nullptr;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+		{
+			outputFolder = argv[++i];
+		}
+		else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+		{
+			referenceFolder = argv[++i];
+		}
+		else
+		{
+			splash = ReadFile(argv[i]);
+			if (!UTFT::isQoiBitmap(splash.data(), DISPLAY_X, DISPLAY_Y))
+			{
+				fprintf(stderr, "%s is not a %ux%u QOI image\n", argv[i], DISPLAY_X, DISPLAY_Y);
+				return 2;
+			}
+		}
+	}
+
+	static UTFT lcd(DISPLAY_CONTROLLER, PinRS, PinWR, PinCS, PinRST);
+	HostPanel::Init(PinRS, PinWR, PinCS);
+
+	// The band buffer must not be taken if that would leave less than the reserve free
+	const uint32_t bandBytes = std::max(DISPLAY_X, DISPLAY_Y) * BandLines * sizeof(uint16_t), reserve = 8192;
+	freeMemory = bandBytes + reserve - 4;
+	if (lcd.allocateBand(BandLines, reserve) || lcd.getBandLines() != 0)
+	{
+		printf("Band buffer was allocated without enough free memory\n");
+		return 1;
+	}
+	freeMemory = bandBytes + reserve;
+	if (!lcd.allocateBand(BandLines, reserve) || lcd.getBandLines() != BandLines)
+	{
+		printf("Band buffer was not allocated with enough free memory\n");
+		return 1;
+	}
+	MakeBlitData();
+
+	printf("%-8s %-6s %8s %8s %8s %8s %8s %8s  %s\n", "scene", "orient", "windows", "commands", "pixels", "writes", "params", "banded", "result");
+	unsigned int failures = 0;
+	for (const Scene& scene : scenes)
+	{
+		if (scene.draw == DrawSplash && splash.empty())
+		{
+			continue;
+		}
+		for (DisplayOrientation orientation : orientations)
+		{
+			char filename[256];
+			snprintf(filename, sizeof(filename), "%s/%s-o%u.ppm", (referenceFolder != nullptr) ? referenceFolder : outputFolder, scene.name, orientation);
+
+			currentOrientation = orientation;
+			lcd.InitLCD(orientation, IS_24BIT, IS_ER);
+			lcd.resetBusStats();
+			HostPanel::ResetStats();
+			scene.draw(lcd);
+			const UTFT::BusStats bus = lcd.getBusStats();
+			const HostPanel::Stats panel = HostPanel::GetStats();
+
+			// Draw the reference image. If the images match then the panel is left showing the same image.
+			bool sameAsReference = true;
+			if (scene.reference != nullptr)
+			{
+				const std::vector<uint16_t> image = Capture();
+				lcd.fillScr(black);
+				scene.reference(lcd);
+				sameAsReference = (Capture() == image);
+			}
+
+			const char *result = "ok";
+			if (panel.windows != bus.windows || panel.pixels != bus.pixels || panel.commands != bus.commands)
+			{
+				result = "UTFT and panel counts differ";
+			}
+			else if (panel.overruns != 0 || panel.strayWrites != 0)
+			{
+				result = "window overrun or stray data";
+			}
+			else if (!sameAsReference)
+			{
+				result = "differs from reference drawing";
+			}
+			else if (referenceFolder != nullptr)
+			{
+				const int32_t differences = HostPanel::Compare(filename);
+				result = (differences < 0) ? "no reference image" : (differences != 0) ? "differs from reference" : "matches reference";
+			}
+			else if (!HostPanel::WritePpm(filename))
+			{
+				result = "can't write image";
+			}
+
+			// Draw the scene again a band at a time and check that it looks the same
+			uint32_t bandedWrites = 0;
+			if (scene.banded && lcd.getBandLines() != 0 && Passed(result))
+			{
+				lcd.InitLCD(orientation, IS_24BIT, IS_ER);
+				lcd.resetBusStats();
+				for (uint16_t top = 0; top < lcd.getDisplayYSize(); top += lcd.getBandLines())
+				{
+					lcd.beginBand(top);
+					scene.draw(lcd);
+					lcd.endBand();
+				}
+				bandedWrites = lcd.getBusStats().writes;
+				if (HostPanel::Compare(filename) != 0)
+				{
+					result = "band rendering differs";
+				}
+			}
+
+			printf("%-8s %-6u %8u %8u %8u %8u %8u %8u  %s\n", scene.name, orientation, bus.windows, bus.commands, bus.pixels, bus.writes, panel.parameters, bandedWrites, result);
+			if (!Passed(result))
+			{
+				++failures;
+			}
+		}
+	}
+	return (failures == 0) ? 0 : 1;
+}
+
+// End
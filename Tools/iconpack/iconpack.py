@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+#
+# Convert the icon bitmaps in src/Icons to the run-length encoded palette format that UTFT::drawCompressedBitmap4 draws.
+#
+# Usage:	iconpack.py						regenerate src/Icons/*.cpp from the .bmp files in that folder
+#			iconpack.py icon.bmp [...]		print the arrays for the given bitmaps, e.g. for custom icons
+#
+# The bitmaps must be in 24-bit or 32-bit BMP format and use only the colours in PALETTE.
+#
+# Icon format:
+#	uint8_t width, height
+#	runs:		one byte per run, with the palette index in the top 4 bits and the run length minus one in the bottom 4 bits
+#
+# The pixels are stored a row at a time from top to bottom, each row from left to right. Runs do not cross rows.
+
+import os
+import struct
+import sys
+
+ICONS_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'src', 'Icons')
+
+# The icon palette. Index 1 is white, which is drawn as transparent.
+PALETTE = [
+	(0x0000, 'black'),
+	(0xFFFF, 'white, drawn as transparent'),
+	(0x20E4, 'dark grey'),
+	(0xFFDF, 'very light grey, used to replace white'),
+	(0x18E3, 'very dark grey'),
+	(0xF79E, 'light grey'),
+	(0xC986, 'red'),
+	(0xD30C, 'lighter red'),
+	(0xC103, 'red'),
+	(0xFF52, 'light yellow'),
+	(0xFFFB, 'very light yellow'),
+	(0x4569, 'green'),
+	(0x9492, 'grey'),
+	(0x0000, 'unused'),
+	(0x0000, 'unused'),
+	(0x0000, 'unused'),
+]
+
+MAX_RUN = 16
+
+# The source files that we generate, the icons in each and the name of the bitmaps they come from.
+# The bitmaps have the suffix _30h for builds with the large font and _21h for the others.
+SOURCES = [
+	('HomeIcons.cpp', [('IconHomeAll', 'HomeAll'), ('IconBedComp', 'BedComp')]),
+	('KeyIcons.cpp', [('IconBackspace', 'Backspace'), ('IconEnter', 'Enter')]),
+	('MiscIcons.cpp', [('IconOk', 'OK'), ('IconCancel', 'Cancel'), ('IconFiles', 'File'), ('IconKeyboard', 'Keyboard'), ('IconTrash', 'trash')]),
+	('NozzleIcons.cpp', [('IconNozzle', 'Nozzle'), ('IconSpindle', 'Spindle'), ('IconBed', 'Bed'), ('IconChamber', 'Chamber')]),
+]
+
+PALETTE_SOURCE = 'HomeIcons.cpp'
+
+def to_colour(r, g, b):
+	return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+def read_bmp(filename):
+	"""Return the width, height and rows of palette indices of a bitmap"""
+	data = open(filename, 'rb').read()
+	if data[:2] != b'BM':
+		sys.exit('%s: not a BMP file' % filename)
+	offset = struct.unpack_from('<I', data, 10)[0]
+	width, height, _, bpp, compression = struct.unpack_from('<iiHHI', data, 18)
+	if bpp not in (24, 32) or compression not in (0, 3):
+		sys.exit('%s: only uncompressed 24-bit and 32-bit bitmaps are supported' % filename)
+	bottom_up = height > 0
+	height = abs(height)
+	bytes_per_pixel = bpp // 8
+	stride = (width * bytes_per_pixel + 3) & ~3
+	indices = { colour: i for i, (colour, _) in reversed(list(enumerate(PALETTE[:13]))) }
+	rows = []
+	for y in range(height):
+		start = offset + ((height - 1 - y) if bottom_up else y) * stride
+		row = []
+		for x in range(width):
+			b, g, r = data[start + x * bytes_per_pixel:start + x * bytes_per_pixel + 3]
+			colour = to_colour(r, g, b)
+			if colour not in indices:
+				print('%s: colour #%02X%02X%02X at (%d, %d) is not in the palette, using black' % (filename, r, g, b, x, y), file=sys.stderr)
+			row.append(indices.get(colour, 0))
+		rows.append(row)
+	return width, height, rows
+
+def encode_row(row):
+	runs = []
+	x = 0
+	while x < len(row):
+		length = 1
+		while x + length < len(row) and row[x + length] == row[x] and length < MAX_RUN:
+			length += 1
+		runs.append((row[x] << 4) | (length - 1))
+		x += length
+	return runs
+
+def icon_array(name, filename):
+	"""Return the C source for one icon, and its size as 4-bit pixels and run-length encoded"""
+	width, height, rows = read_bmp(filename)
+	if width > 255 or height > 255:
+		sys.exit('%s: icons must be no more than 255 pixels in each direction' % filename)
+	lines = ['extern const uint8_t %s[] =' % name, '{\t%d, %d,\t\t// width, height' % (width, height)]
+	size = 2
+	for row in rows:
+		runs = encode_row(row)
+		lines.append('\t' + ' '.join('0x%02X,' % v for v in runs))
+		size += len(runs)
+	lines.append('};')
+	return '\n'.join(lines) + '\n', 2 + (width * height + 1) // 2, size
+
+def palette_arrays():
+	text = ''
+	for name in ('IconPaletteLight', 'IconPaletteDark'):
+		text += 'extern const uint16_t %s[] =\n{\n' % name
+		text += ''.join('\t0x%04X,\t\t// %d: %s\n' % (colour, i, comment) for i, (colour, comment) in enumerate(PALETTE))
+		text += '};\n\n'
+	return text
+
+def generate(source, icons):
+	variants = []
+	for suffix in ('30h', '21h'):
+		arrays = [icon_array(name, os.path.join(ICONS_DIR, '%s_%s.bmp' % (bitmap, suffix))) for name, bitmap in icons]
+		variants.append(arrays)
+
+	text = '/*\n * %s\n *\n * Generated from the bitmaps in this folder by Tools/iconpack/iconpack.py - do not edit.\n *\n' % source
+	for macro, arrays in zip(('LARGE_FONT', 'Small font'), variants):
+		unpacked = sum(a[1] for a in arrays)
+		packed = sum(a[2] for a in arrays)
+		text += ' * %-12s %5d bytes as 4-bit pixels, %5d bytes run-length encoded\n' % (macro + ':', unpacked, packed)
+	text += ' */\n\n#include "asf.h"\n#include "Configuration.hpp"\n#include "Icons.hpp"\n\n'
+	if source == PALETTE_SOURCE:
+		text += palette_arrays()
+	text += '#if LARGE_FONT\n\n'
+	text += '\n'.join(a[0] for a in variants[0])
+	text += '\n#else\n\n'
+	text += '\n'.join(a[0] for a in variants[1])
+	text += '\n#endif\n\n// End\n'
+	return text
+
+def main():
+	if len(sys.argv) > 1:
+		for filename in sys.argv[1:]:
+			name = 'Icon' + os.path.splitext(os.path.basename(filename))[0].split('_')[0]
+			print(icon_array(name, filename)[0])
+		return
+
+	for source, icons in SOURCES:
+		with open(os.path.join(ICONS_DIR, source), 'w', newline='\n') as f:
+			f.write(generate(source, icons))
+		print('Wrote %s' % source)
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,68 @@
+/*
+ * asf.h
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Replacement for the ASF header when building SerialIo for the host. The PIO controllers come from hostrender,
+ * and the UART is modelled closely enough to show what is lost when it is initialised again while it is still sending.
+ */
+
+#ifndef SERIALIO_ASF_H
+#define SERIALIO_ASF_H
+
+#include "../hostrender/asf.h"
+
+// A UART with a transmit holding register and a shift register, as on the SAM3S and SAM4S.
+// Time only passes when the firmware waits for the transmitter, one character each time.
+struct Uart
+{
+	uint32_t UART_SR;
+	uint32_t UART_CR;
+	uint32_t UART_RHR;
+};
+
+extern Uart hostUart;
+
+#define UART0	(&hostUart)
+#define UART1	(&hostUart)
+
+#define UART_SR_RXRDY	(1u << 0)
+#define UART_SR_OVRE	(1u << 5)
+#define UART_SR_FRAME	(1u << 6)
+#define UART_CR_RSTSTA	(1u << 8)
+#define UART_IER_RXRDY	UART_SR_RXRDY
+#define UART_IER_OVRE	UART_SR_OVRE
+#define UART_IER_FRAME	UART_SR_FRAME
+#define US_MR_PAR_NO	(4u << 9)
+
+#define PIO_PERIPH_A	(0)
+#define PIO_PA9			(1u << 9)
+#define PIO_PA10		(1u << 10)
+#define PIO_PB2			(1u << 2)
+#define PIO_PB3			(1u << 3)
+
+enum IRQn_Type { UART0_IRQn = 8, UART1_IRQn = 9 };
+
+struct sam_uart_opt_t
+{
+	uint32_t ul_mck;
+	uint32_t ul_baudrate;
+	uint32_t ul_mode;
+};
+typedef sam_uart_opt_t sam_uart_opt;
+
+// Reset and set up the UART. Like the real one, this resets the transmitter, so the characters in it are lost.
+uint32_t uart_init(Uart *p_uart, const sam_uart_opt_t *p_uart_opt);
+
+// Put a character in the holding register. Return 1 if it is full, after letting one character time pass.
+uint32_t uart_write(Uart *p_uart, const uint8_t uc_data);
+
+// Return 1 if the holding register and the shift register are both empty, else let one character time pass and return 0
+uint32_t uart_is_tx_empty(Uart *p_uart);
+
+inline void uart_enable_interrupt(Uart *, uint32_t) { }
+inline void uart_disable_interrupt(Uart *, uint32_t) { }
+inline void irq_register_handler(IRQn_Type, uint32_t) { }
+inline uint32_t sysclk_get_main_hz() { return 240000000; }
+
+#endif /* SERIALIO_ASF_H */
@@ -0,0 +1,200 @@
+/*
+ * serialio-test.cpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Feeds a request to change the baud rate to SerialIo through a model of the UART and checks that the whole reply,
+ * including the *NNNNN CRC suffix, has been sent at the old baud rate before the UART is set up for the new one.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "asf.h"
+#include <Hardware/SerialIo.hpp>
+#include <Hardware/SysTick.hpp>
+#include <FirmwareFeatures.hpp>
+
+extern "C" void UART0_Handler();
+
+HostPio hostPioA, hostPioB;
+Uart hostUart;
+
+// The UART model. A character takes one step to move from the holding register to the shift register
+// and another to leave the shift register.
+static const int empty = -1;
+static int holdingRegister = empty;
+static int shiftRegister = empty;
+static uint32_t baudRate = 0;
+static std::string wire;							// the characters sent at the rate in wireRate
+static uint32_t wireRate = 0;
+static unsigned int charactersLost = 0;
+
+static void Step()
+{
+	if (shiftRegister != empty)
+	{
+		if (baudRate != wireRate)
+		{
+			wire.clear();
+			wireRate = baudRate;
+		}
+		wire += (char)shiftRegister;
+	}
+	shiftRegister = holdingRegister;
+	holdingRegister = empty;
+}
+
+uint32_t uart_init(Uart *, const sam_uart_opt_t *p_uart_opt)
+{
+	charactersLost += (holdingRegister != empty) + (shiftRegister != empty);
+	holdingRegister = shiftRegister = empty;
+	baudRate = p_uart_opt->ul_baudrate;
+	return 0;
+}
+
+uint32_t uart_write(Uart *, const uint8_t uc_data)
+{
+	if (holdingRegister != empty)
+	{
+		Step();
+		return 1;
+	}
+	holdingRegister = uc_data;
+	if (shiftRegister == empty)
+	{
+		Step();
+	}
+	return 0;
+}
+
+uint32_t uart_is_tx_empty(Uart *)
+{
+	if (holdingRegister == empty && shiftRegister == empty)
+	{
+		return 1;
+	}
+	Step();
+	return 0;
+}
+
+uint32_t SystemTick::GetTickCount()
+{
+	return 0;
+}
+
+const FirmwareFeatureMap& GetFirmwareFeatures()
+{
+	static FirmwareFeatureMap features;
+	return features;
+}
+
+// Callbacks that reply to a baud rate change the way PanelDue does
+static std::vector<std::string> received;
+static uint32_t rateAtMessageEnd = 0;
+
+static void StartReceivedMessage()
+{
+	received.clear();
+}
+
+static void EndReceivedMessage()
+{
+	rateAtMessageEnd = baudRate;
+}
+
+static void ProcessReceivedValue(StringRef id, const char val[], const size_t[])
+{
+	received.push_back(std::string(id.c_str()) + "=" + val);
+	if (strcmp(id.c_str(), "controlCommand") == 0 && strcmp(val, "baudRate 57600") == 0)
+	{
+		SerialIo::Sendf("M118 P2 S\"baudRate 57600\"\n");
+		SerialIo::SetBaudRate(57600);
+	}
+}
+
+static SerialIo::SerialIoCbs callbacks =
+{
+	.StartReceivedMessage = StartReceivedMessage,
+	.EndReceivedMessage = EndReceivedMessage,
+	.ProcessReceivedValue = ProcessReceivedValue,
+	.ProcessArrayElementEnd = nullptr,
+	.ProcessArrayEnd = nullptr,
+	.ParserErrorEncountered = nullptr,
+};
+
+static void Receive(const char *s)
+{
+	for (; *s != 0; ++s)
+	{
+		hostUart.UART_SR = UART_SR_RXRDY;
+		hostUart.UART_RHR = (uint8_t)*s;
+		UART0_Handler();
+		SerialIo::CheckInput();
+	}
+	hostUart.UART_SR = 0;
+}
+
+static int failures = 0;
+
+static void Check(bool ok, const char *what)
+{
+	printf("%s: %s\n", ok ? "ok" : "FAILED", what);
+	if (!ok)
+	{
+		++failures;
+	}
+}
+
+// Return true if the characters sent are the command with a line number, a *NNNNN CRC and a newline
+static bool IsNumberedLine(const std::string& sent, const char *command)
+{
+	const size_t start = sent.find(' ') + 1;
+	const size_t end = start + strlen(command);
+	return sent[0] == 'N' && start != 0 && sent.compare(start, end - start, command) == 0
+		&& sent.size() == end + 7 && sent[end] == '*' && strspn(sent.c_str() + end + 1, "0123456789") == 5 && sent.back() == '\n';
+}
+
+// The reply to a message that asks for a new baud rate
+static void TestChangeRequestedByMessage()
+{
+	SerialIo::Init(115200, &callbacks);
+	wire.clear();
+	wireRate = baudRate;
+	charactersLost = 0;
+
+	Receive("{\"controlCommand\":\"baudRate 57600\",\"seq\":3}\n");
+
+	Check(wireRate == 115200 && IsNumberedLine(wire, "M118 P2 S\"baudRate 57600\""), "the whole reply was sent at the old baud rate");
+	Check(charactersLost == 0, "no characters were lost when the baud rate changed");
+	Check(received.size() == 2 && received[1] == "seq=3", "the rest of the message was processed");
+	Check(rateAtMessageEnd == 115200, "the baud rate was unchanged when the message ended");
+	Check(baudRate == 57600, "the baud rate changed once the message had ended");
+}
+
+// A change made from the user interface, between messages
+static void TestChangeBetweenMessages()
+{
+	SerialIo::Init(57600, &callbacks);
+	wire.clear();
+	wireRate = baudRate;
+	charactersLost = 0;
+
+	SerialIo::Sendf("M120\n");
+	SerialIo::SetBaudRate(115200);
+
+	Check(wireRate == 57600 && IsNumberedLine(wire, "M120"), "a command sent just before the change was sent at the old baud rate");
+	Check(charactersLost == 0, "no characters were lost when the baud rate changed");
+	Check(baudRate == 115200, "the baud rate changed straight away");
+}
+
+int main()
+{
+	TestChangeRequestedByMessage();
+	TestChangeBetweenMessages();
+	return (failures == 0) ? 0 : 1;
+}
+
+// End
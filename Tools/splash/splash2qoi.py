@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+#
+# Convert a splash screen image to the QOI format (https://qoiformat.org) that PanelDue decodes at boot.
+# The input can be an uncompressed 24- or 32-bit .bmp file, or a splash screen in the older run-length encoded .bin format
+# produced by bmp2c -binary. Colours are reduced to the 16-bit colours of the display first, which also makes the image
+# compress better.
+#
+# Usage: splash2qoi.py mysplashscreen.bmp mysplashscreen.qoi
+#
+# Then append the output to the firmware binary in the same way as the older format, e.g.
+#	cat paneldue.bin mysplashscreen.qoi > paneldue-logo.bin
+
+import struct
+import sys
+
+def read_bmp(data):
+	"""Return the width, height and rows of (r, g, b) pixels from top to bottom of an uncompressed 24- or 32-bit bitmap"""
+	offset, = struct.unpack_from('<I', data, 10)
+	width, height, planes, bpp, compression = struct.unpack_from('<iiHHI', data, 18)
+	if bpp not in (24, 32) or compression not in (0, 3):
+		sys.exit('only uncompressed 24- and 32-bit bitmaps are supported')
+	top_down = height < 0
+	height = abs(height)
+	stride = (width * bpp // 8 + 3) & ~3
+	rows = []
+	for y in range(height):
+		row = offset + y * stride
+		rows.append([(data[row + x * bpp // 8 + 2], data[row + x * bpp // 8 + 1], data[row + x * bpp // 8]) for x in range(width)])
+	if not top_down:
+		rows.reverse()
+	return width, height, rows
+
+def read_rle(data):
+	"""Return the width, height and rows of (r, g, b) pixels from top to bottom of a splash screen in the run-length encoded format"""
+	width, height = struct.unpack_from('<HH', data, 0)
+	pixels = []
+	pos = 4
+	while len(pixels) < width * height:
+		count, colour = struct.unpack_from('<HH', data, pos)
+		pos += 4
+		pixels += [((colour >> 8) & 0xF8, (colour >> 3) & 0xFC, (colour << 3) & 0xF8)] * (count + 1)
+	rows = [pixels[y * width:(y + 1) * width] for y in range(height)]
+	rows.reverse()					# stored from bottom to top
+	return width, height, rows
+
+def to_display_colour(pixel):
+	"""Reduce a pixel to 5 bits of red and blue and 6 bits of green, then expand it again by replicating the top bits"""
+	r, g, b = pixel[0] >> 3, pixel[1] >> 2, pixel[2] >> 3
+	return ((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2))
+
+def encode_qoi(width, height, rows):
+	out = bytearray(b'qoif' + struct.pack('>II', width, height) + bytes([3, 0]))
+	index = [(0, 0, 0, 0)] * 64
+	prev = (0, 0, 0, 255)
+	run = 0
+	pixels = [to_display_colour(p) + (255,) for row in rows for p in row]
+	for n, px in enumerate(pixels):
+		if px == prev:
+			run += 1
+			if run == 62 or n == len(pixels) - 1:
+				out.append(0xC0 | (run - 1))
+				run = 0
+			continue
+		if run != 0:
+			out.append(0xC0 | (run - 1))
+			run = 0
+		r, g, b, a = px
+		pos = (r * 3 + g * 5 + b * 7 + a * 11) % 64
+		if index[pos] == px:
+			out.append(pos)
+		else:
+			index[pos] = px
+			dr = (r - prev[0] + 128) % 256 - 128
+			dg = (g - prev[1] + 128) % 256 - 128
+			db = (b - prev[2] + 128) % 256 - 128
+			if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+				out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+			elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+				out += bytes([0x80 | (dg + 32), ((dr - dg + 8) << 4) | (db - dg + 8)])
+			else:
+				out += bytes([0xFE, r, g, b])
+		prev = px
+	out += bytes([0, 0, 0, 0, 0, 0, 0, 1])
+	return out
+
+def main():
+	if len(sys.argv) != 3:
+		sys.exit('usage: splash2qoi.py input.bmp|input.bin output.qoi')
+	data = open(sys.argv[1], 'rb').read()
+	width, height, rows = read_bmp(data) if data[:2] == b'BM' else read_rle(data)
+	qoi = encode_qoi(width, height, rows)
+	open(sys.argv[2], 'wb').write(qoi)
+	print('%s: %dx%d, %d bytes as input, %d bytes as QOI' % (sys.argv[1], width, height, len(data), len(qoi)))
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,231 @@
+/*
+ * subscription-test.cpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Host test of Subscription, which asks the host to push object model changes to PanelDue instead of PanelDue polling for them.
+ * A stand-in host reads each status request that Subscription sends, and answers it as a host with or without the extension would,
+ * or not at all. The answer is passed back to Subscription field by field, as PanelDue does when it parses a message.
+ *
+ * Usage: subscription-test		prints each check and exits with status 1 if any failed
+ */
+
+#include <Subscription.hpp>
+#include <Hardware/SerialIo.hpp>
+#include <UI/MessageLog.hpp>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// What Subscription sends to the host
+static std::string sent;
+
+size_t SerialIo::Sendf(const char *fmt, ...)
+{
+	char buffer[256];
+	va_list vargs;
+	va_start(vargs, fmt);
+	const int ret = vsnprintf(buffer, sizeof(buffer), fmt, vargs);
+	va_end(vargs);
+	sent += buffer;
+	return ret;
+}
+
+void MessageLog::AppendMessage(LogLevel, const char *)
+{
+}
+
+static const char * const keys[] = { "boards", "fans", "heat" };
+
+// Send the periodic status request and return the line that was sent, or an empty string if nothing was sent
+static std::string StatusRequest()
+{
+	sent.clear();
+	const bool wasSent = Subscription::SendStatusRequest([](size_t i) { return keys[i]; }, sizeof(keys)/sizeof(keys[0]));
+	return (wasSent) ? sent : std::string();
+}
+
+// Pass a message from the host to Subscription. Null values are fields that the message doesn't have.
+static void Message(const char *flags, const char *subscribed)
+{
+	Subscription::StartReceivedMessage();
+	if (flags != nullptr)
+	{
+		Subscription::ProcessFlags(flags);
+	}
+	if (subscribed != nullptr)
+	{
+		// PanelDue only passes the value on if it is an unsigned integer
+		char *end;
+		const unsigned long val = strtoul(subscribed, &end, 10);
+		if (subscribed[0] != 0 && *end == 0)
+		{
+			Subscription::ProcessSubscribed(val);
+		}
+	}
+	Subscription::EndReceivedMessage();
+}
+
+// The host end of the link
+class Host
+{
+public:
+	enum class Kind { pushes, polledOnly, silent, garbled };
+
+	explicit Host(Kind k) : kind(k), pushing(false) { }
+
+	// Answer a request as the host would
+	void Answer(const std::string& request)
+	{
+		unsigned long heartbeat;
+		const bool isSubscription = sscanf(request.c_str(), "M409 F\"d99fps\" H%lu", &heartbeat) == 1;
+		if (request.compare(0, 5, "M409 ") != 0 || kind == Kind::silent)
+		{
+			return;
+		}
+
+		// A host without the extension ignores the H and S parameters and echoes the flags, so the response to a poll is all it sends
+		const std::string flags = request.substr(7, request.find('"', 7) - 7);
+		if (!isSubscription || kind == Kind::polledOnly)
+		{
+			Message(flags.c_str(), nullptr);
+			return;
+		}
+		if (kind == Kind::garbled)
+		{
+			Message(flags.c_str(), "yes");
+			return;
+		}
+		pushing = heartbeat != 0;
+		char interval[16];
+		snprintf(interval, sizeof(interval), "%lu", heartbeat);
+		Message(flags.c_str(), interval);
+	}
+
+	// Send a message with some changes, as a host that pushes them does
+	void Push()
+	{
+		if (pushing)
+		{
+			Message(nullptr, nullptr);
+		}
+	}
+
+	bool IsPushing() const { return pushing; }
+
+private:
+	Kind kind;
+	bool pushing;
+};
+
+static int failures = 0;
+
+static void Check(bool ok, const char *what)
+{
+	printf("%s: %s\n", ok ? "ok" : "FAILED", what);
+	if (!ok)
+	{
+		++failures;
+	}
+}
+
+static const std::string subscribeRequest = "M409 F\"d99fps\" H5000 S\"boards,fans,heat\"\n";
+static const std::string stopRequest = "M409 F\"d99fps\" H0\n";
+static const std::string poll = "M409 F\"d99fp\"\n";
+
+// Connect to a host with push updates turned on, and return the first status request
+static std::string Connect(bool enabled)
+{
+	Subscription::SetEnabled(enabled);
+	Subscription::Reset();
+	return StatusRequest();
+}
+
+static void TestDisabledByDefault()
+{
+	Check(!Subscription::IsEnabled(), "push updates are off by default");
+	Check(StatusRequest() == poll, "with push updates off, the status request is a poll");
+}
+
+static void TestSubscribeAndUnsubscribe()
+{
+	Host host(Host::Kind::pushes);
+	const std::string request = Connect(true);
+	Check(request == subscribeRequest, "the first status request asks the host to push the keys");
+	host.Answer(request);
+	Check(Subscription::IsActive() && Subscription::GetHeartbeatInterval() == 5000, "the host's acknowledgement makes the subscription active");
+	host.Push();
+	Check(StatusRequest().empty(), "no status requests are sent while the host pushes changes");
+	Check(Subscription::IsActive(), "messages pushed by the host leave the subscription active");
+
+	Subscription::SetEnabled(false);
+	const std::string stop = StatusRequest();
+	Check(stop == stopRequest, "turning push updates off asks the host to stop");
+	host.Push();
+	Check(!Subscription::IsActive(), "no longer relying on the host once we have asked it to stop");
+	host.Answer(stop);
+	Check(!host.IsPushing(), "the host has stopped pushing");
+	Check(StatusRequest() == poll && StatusRequest() == poll, "the panel polls after the host has stopped");
+
+	Subscription::SetEnabled(true);
+	Check(StatusRequest() == subscribeRequest, "turning push updates on again asks the host again");
+}
+
+static void TestLateResponse()
+{
+	Host host(Host::Kind::pushes);
+	const std::string request = Connect(true);
+	Message("d99fp", nullptr);
+	host.Answer(request);
+	Check(Subscription::IsActive(), "the response to an earlier poll doesn't count as the answer, so the answer that follows it is accepted");
+}
+
+static void TestHostWithoutExtension()
+{
+	Host host(Host::Kind::polledOnly);
+	host.Answer(Connect(true));
+	Check(!Subscription::IsActive(), "a normal status response doesn't make the subscription active");
+	Check(StatusRequest() == poll && StatusRequest() == poll, "the panel falls back to polling");
+	Subscription::Reset();
+	Check(StatusRequest() == subscribeRequest, "the panel asks again after a reconnect");
+}
+
+static void TestUnknownReply()
+{
+	Host host(Host::Kind::garbled);
+	host.Answer(Connect(true));
+	Check(!Subscription::IsActive(), "an invalid subscribed value doesn't make the subscription active");
+	Check(StatusRequest() == poll, "the panel falls back to polling after an invalid reply");
+}
+
+static void TestTimeout()
+{
+	Host host(Host::Kind::silent);
+	host.Answer(Connect(true));
+	Subscription::RequestTimedOut();
+	Check(!Subscription::IsActive(), "no answer doesn't make the subscription active");
+	Check(StatusRequest() == poll, "the panel falls back to polling after a timeout");
+
+	// The host acknowledges, then goes quiet when asked to stop
+	Host pusher(Host::Kind::pushes);
+	pusher.Answer(Connect(true));
+	Subscription::SetEnabled(false);
+	StatusRequest();
+	Subscription::RequestTimedOut();
+	Check(StatusRequest() == poll, "the panel polls if the request to stop times out");
+}
+
+int main()
+{
+	TestDisabledByDefault();
+	TestSubscribeAndUnsubscribe();
+	TestLateResponse();
+	TestHostWithoutExtension();
+	TestUnknownReply();
+	TestTimeout();
+	return (failures == 0) ? 0 : 1;
+}
+
+// End
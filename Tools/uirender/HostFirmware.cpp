@@ -0,0 +1,209 @@
+/*
+ * HostFirmware.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "HostFirmware.hpp"
+#include "asf.h"
+#include "HostPanel.hpp"
+#include <PanelDue.hpp>
+#include <RequestTimer.hpp>
+#include <Hardware/Mem.hpp>
+#include <Hardware/SerialIo.hpp>
+#include <Hardware/SysTick.hpp>
+#include <UI/MessageLog.hpp>
+#include <UI/RenderStats.hpp>
+#include <UI/UserInterface.hpp>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+const unsigned int PinRS = 15, PinWR = 14, PinCS = 0, PinRST = 39;		// as on version 3.0 boards
+
+UTFT lcd(DISPLAY_CONTROLLER, PinRS, PinWR, PinCS, PinRST);
+
+static const ColourScheme *colours = &colourSchemes[0];
+static OM::PrinterStatus status = OM::PrinterStatus::connecting;
+static FirmwareFeatureMap firmwareFeatures;
+static uint32_t tickCount = 0;
+
+namespace HostFirmware
+{
+	uint32_t InitLcd()
+	{
+		HostPanel::Init(PinRS, PinWR, PinCS);
+		lcd.InitLCD(nvData.lcdOrientation, IS_24BIT, IS_ER);
+		colours = &colourSchemes[nvData.colourScheme];
+		UI::InitColourScheme(colours);
+		const uint32_t freeMemory = GetFreeMemory();
+		UI::CreateFields(nvData.language, *colours, nvData.infoTimeout);
+		const uint32_t fieldsMemory = freeMemory - GetFreeMemory();
+		lcd.fillScr(black);
+		return fieldsMemory;
+	}
+
+	void SetStatus(OM::PrinterStatus newStatus)
+	{
+		if (newStatus != status)
+		{
+			UI::ChangeStatus(status, newStatus);
+			status = newStatus;
+			UI::UpdatePrintingFields();
+		}
+	}
+
+	void AdvanceTime(uint32_t milliseconds)
+	{
+		tickCount += milliseconds;
+	}
+}
+
+// Functions that PanelDue.cpp provides to the user interface
+bool IsPrintingStatus(OM::PrinterStatus status)
+{
+	return status == OM::PrinterStatus::printing
+			|| status == OM::PrinterStatus::paused
+			|| status == OM::PrinterStatus::pausing
+			|| status == OM::PrinterStatus::resuming
+			|| status == OM::PrinterStatus::simulating;
+}
+
+bool PrintInProgress()
+{
+	return IsPrintingStatus(status);
+}
+
+OM::PrinterStatus GetStatus()
+{
+	return status;
+}
+
+void TouchBeep() { }
+void ErrorBeep() { }
+void CalibrateTouch() { }
+void FactoryReset() { }
+void SaveSettings() { }
+void MirrorDisplay() { }
+void InvertDisplay() { }
+void CurrentAlertModeClear() { }
+
+void RecreateUserInterface()
+{
+	colours = &colourSchemes[nvData.colourScheme];
+	UI::InitColourScheme(colours);
+	if (!UI::RecreateFields(nvData.language, *colours, nvData.infoTimeout))
+	{
+		fprintf(stderr, "The user interface could not be recreated in place, so the firmware would reset\n");
+		exit(1);
+	}
+	debugField->Show(false);
+	MessageLog::UpdateMessages(true);
+	mgr.Refresh(true);
+}
+
+void SetBaudRate(uint32_t rate)
+{
+	nvData.SetBaudRate(rate);
+}
+
+void SetBrightness(int percent)
+{
+	nvData.SetBrightness(percent);
+}
+
+FirmwareFeatureMap GetFirmwareFeatures()
+{
+	return firmwareFeatures;
+}
+
+const char* _ecv_array CondStripDrive(const char* _ecv_array arg)
+{
+	return arg;
+}
+
+void Delay(uint32_t milliSeconds)
+{
+	tickCount += milliSeconds;
+}
+
+// The tick counter only moves on when the program says so, so that the pages are drawn the same way every time
+uint32_t SystemTick::GetTickCount()
+{
+	return tickCount;
+}
+
+// Commands for the printer are discarded
+namespace SerialIo
+{
+	void SendChar(char) { }
+
+	size_t Sendf(const char *fmt, ...)
+	{
+		va_list args;
+		va_start(args, fmt);
+		const int len = vsnprintf(nullptr, 0, fmt, args);
+		va_end(args);
+		return len;
+	}
+
+	void SendFilename(const char * _ecv_array, const char * _ecv_array) { }
+}
+
+// There is no printer to send requests to, so the file manager's requests are never sent
+RequestTimer::RequestTimer(uint32_t del, const char * _ecv_array cmd, const char * _ecv_array null ex)
+	: startTime(0), delayTime(del), command(cmd), extra(ex), quoteArgument(false)
+{
+	timerState = stopped;
+}
+
+bool RequestTimer::Process()
+{
+	timerState = stopped;
+	return false;
+}
+
+// Refreshes are not timed on the host
+namespace RenderStats
+{
+	void BeginField() { }
+	void EndField(FieldKind, PixelNumber, PixelNumber) { }
+}
+
+// The user interface relies on the heap being a bump allocator that can be rewound, as it is in Mem.cpp.
+// Everything else on the host uses it too, so it has plenty of room.
+static unsigned char heap[64 * 1024 * 1024] __attribute__((aligned(16)));
+static size_t heapUsed = 0;
+
+void* operator new(size_t objsize)
+{
+	if (heapUsed + objsize > sizeof(heap))
+	{
+		fprintf(stderr, "Out of memory\n");
+		abort();
+	}
+	void * const p = heap + heapUsed;
+	heapUsed += (objsize + 15) & ~(size_t)15;
+	return p;
+}
+
+void operator delete(void*) noexcept { }
+void operator delete(void*, size_t) noexcept { }
+
+void *GetHeapTop()
+{
+	return heap + heapUsed;
+}
+
+void SetHeapTop(void *top)
+{
+	heapUsed = static_cast<unsigned char *>(top) - heap;
+}
+
+uint32_t GetFreeMemory()
+{
+	return sizeof(heap) - heapUsed;
+}
+
+// End
@@ -0,0 +1,29 @@
+/*
+ * HostFirmware.hpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Stand-ins for the parts of the firmware that the user interface calls but that can't run on the host:
+ * the functions that PanelDue.cpp provides, the serial link, the tick counter and the heap.
+ */
+
+#ifndef TOOLS_UIRENDER_HOSTFIRMWARE_HPP_
+#define TOOLS_UIRENDER_HOSTFIRMWARE_HPP_
+
+#include <cstdint>
+#include <ObjectModel/PrinterStatus.hpp>
+
+namespace HostFirmware
+{
+	// Connect the display controller model, then set up the display and create the fields as PanelDue.cpp does at startup.
+	// Return the amount of heap that the fields used.
+	uint32_t InitLcd();
+
+	// Change the printer status and tell the user interface, as PanelDue.cpp does when the host reports a new status
+	void SetStatus(OM::PrinterStatus newStatus);
+
+	// Move the tick counter on
+	void AdvanceTime(uint32_t milliseconds);
+}
+
+#endif /* TOOLS_UIRENDER_HOSTFIRMWARE_HPP_ */
@@ -0,0 +1,19 @@
+/*
+ * flash_efc.h
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Replacement for the ASF flash service when building the user interface for the host.
+ * Nothing is stored, so the settings always start at their defaults.
+ */
+
+#ifndef FLASH_EFC_H_INCLUDED
+#define FLASH_EFC_H_INCLUDED
+
+#include <cstdint>
+
+static inline uint32_t flash_read_user_signature(uint32_t *, uint32_t) { return 0; }
+static inline uint32_t flash_erase_user_signature() { return 0; }
+static inline uint32_t flash_write_user_signature(const void *, uint32_t) { return 0; }
+
+#endif // FLASH_EFC_H_INCLUDED
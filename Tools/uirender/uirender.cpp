@@ -0,0 +1,551 @@
+/*
+ * uirender.cpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Render the pages and popups of the user interface on the host, using the UserInterface module from the firmware
+ * and the SSD1963 model from hostrender. The printer is given three axes, a bed and two tools by calling the same
+ * UserInterface functions that PanelDue.cpp calls when it receives the object model. Each page is reached from the
+ * Control page by touching the buttons that a user would touch, and is then written to a PPM file.
+ * If a reference folder is given, the pages are compared with the images in that folder instead of being written.
+ * The heap used by the fields and the bus activity needed to draw each page from the Control page are printed,
+ * so that the cost of changes can be compared.
+ * Then some changes that are drawn incrementally, such as new temperatures or a popup closing, are made and checked against
+ * drawing the whole display again. These checks don't need reference images. Last, the language and colour scheme are
+ * changed, which creates the fields again, and the heap is checked to be the same afterwards.
+ *
+ * Usage: uirender [-o output-folder] [-r reference-folder]
+ */
+
+#include "asf.h"
+#include "HostFirmware.hpp"
+#include "HostPanel.hpp"
+#include <PanelDue.hpp>
+#include <FileManager.hpp>
+#include <Hardware/Mem.hpp>
+#include <UI/Events.hpp>
+#include <UI/MessageLog.hpp>
+#include <UI/UserInterface.hpp>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// Touch the first button found that sends event 'ev', and with parameter 'param' unless it is negative.
+// The display is searched the same way PanelDue.cpp looks up a touch, so popups are searched first.
+static bool Touch(event_t ev, int param = -1)
+{
+	for (PixelNumber y = 0; y < DisplayY; y += 2)
+	{
+		for (PixelNumber x = 0; x < DisplayX; x += 2)
+		{
+			const ButtonPress bp = mgr.FindEvent(x, y);
+			if (bp.IsValid() && bp.GetEvent() == ev && (param < 0 || bp.GetIParam() == param))
+			{
+				UI::ProcessTouch(bp);
+				HostFirmware::AdvanceTime(100);
+				UI::ProcessRelease(bp);
+				return true;
+			}
+		}
+	}
+	fprintf(stderr, "No button with event %u found\n", (unsigned int)ev);
+	return false;
+}
+
+// Refresh the display as the main loop does, until all the changes have been drawn
+static void Refresh()
+{
+	HostFirmware::AdvanceTime(1000);
+	do
+	{
+		mgr.Refresh(false);
+	} while (mgr.IsRefreshing());
+}
+
+// Give the user interface the state of a printer with X, Y and Z axes, a heated bed and two tools, which is idle
+static void SetUpPrinter()
+{
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		UI::SetAxisLetter(axis, "XYZ"[axis]);
+		UI::SetAxisVisible(axis, true);
+		UI::SetAxisMax(axis, (axis == 2) ? 200.0f : 235.0f);
+		UI::UpdateHomedStatus(axis, true);
+	}
+	UI::UpdateGeometry(3, false);
+	UI::UpdateAxisPosition(0, 117.5f);
+	UI::UpdateAxisPosition(1, 82.25f);
+	UI::UpdateAxisPosition(2, 10.0f);
+
+	UI::SetBedOrChamberHeater(0, 0);
+	for (size_t tool = 0; tool < 2; ++tool)
+	{
+		UI::SetToolHeater(tool, 0, tool + 1);
+		UI::SetToolExtruder(tool, tool);
+		UI::SetToolFan(tool, 0);
+	}
+	UI::AllToolsSeen();
+	UI::SetCurrentTool(0);
+
+	const float currentTemps[] = { 59.8f, 210.1f, 23.4f };
+	const int activeTemps[] = { 60, 210, 0 };
+	const OM::HeaterStatus states[] = { OM::HeaterStatus::active, OM::HeaterStatus::active, OM::HeaterStatus::off };
+	for (size_t heater = 0; heater < 3; ++heater)
+	{
+		UI::UpdateCurrentTemperature(heater, currentTemps[heater]);
+		UI::UpdateActiveTemperature(heater, activeTemps[heater]);
+		UI::UpdateStandbyTemperature(heater, 0);
+		UI::UpdateHeaterStatus(heater, states[heater]);
+	}
+	for (size_t tool = 0; tool < 2; ++tool)
+	{
+		UI::UpdateToolTemp(tool, 0, activeTemps[tool + 1], true);
+		UI::UpdateToolTemp(tool, 0, 150, false);
+		UI::UpdateToolStatus(tool, (tool == 0) ? OM::ToolStatus::active : OM::ToolStatus::off);
+		UI::UpdateExtrusionFactor(tool, 100);
+	}
+	UI::UpdateFanPercent(0, 50);
+	UI::UpdateSpeedPercent(100);
+	UI::UpdateMachineName("uirender");
+	UI::UpdateIP("192.168.1.10");
+
+	MessageLog::AppendMessage(MessageLog::LogLevel::Normal, "Connected");
+	MessageLog::AppendMessage(MessageLog::LogLevel::Normal, "G28");
+	MessageLog::AppendMessage(MessageLog::LogLevel::Normal, "M104 S210");
+
+	HostFirmware::SetStatus(OM::PrinterStatus::idle);
+}
+
+// Give the file manager a list of files or macros, as PanelDue.cpp does when it receives the response to M20
+static void ReceiveFiles(const char *dir, const char * const *files, size_t numFiles)
+{
+	FileManager::BeginNewMessage();
+	FileManager::ReceiveDirectoryName(dir);
+	FileManager::BeginReceivingFiles();
+	for (size_t i = 0; i < numFiles; ++i)
+	{
+		FileManager::ReceiveFile(files[i]);
+	}
+	FileManager::EndReceivedMessage();
+}
+
+static bool ShowControl()
+{
+	return true;
+}
+
+static bool ShowPrint()
+{
+	return Touch(evTabStatus);
+}
+
+static bool ShowConsole()
+{
+	return Touch(evTabMsg);
+}
+
+static bool ShowSetup()
+{
+	return Touch(evTabSetup);
+}
+
+static bool ShowToolTemperature()
+{
+	return Touch(evAdjustToolActiveTemp, 0);
+}
+
+static bool ShowMove()
+{
+	return Touch(evMovePopup);
+}
+
+static bool ShowExtrude()
+{
+	return Touch(evExtrudePopup);
+}
+
+static bool ShowFiles()
+{
+	static const char * const files[] = { "*Calibration", "benchy.gcode", "bracket.gcode", "cube.gcode", "vase.gcode" };
+	if (!Touch(evListFiles))
+	{
+		return false;
+	}
+	ReceiveFiles("0:/gcodes", files, sizeof(files)/sizeof(files[0]));
+	return true;
+}
+
+static bool ShowMacros()
+{
+	static const char * const macros[] = { "*Filament", "Bed level", "Clean nozzle", "Park" };
+	if (!Touch(evListMacros))
+	{
+		return false;
+	}
+	ReceiveFiles(FileManager::GetMacrosRootDir(), macros, sizeof(macros)/sizeof(macros[0]));
+	return true;
+}
+
+static bool ShowKeyboard()
+{
+	return Touch(evTabMsg) && Touch(evKeyboard);
+}
+
+static bool ShowBaudRate()
+{
+	return Touch(evTabSetup) && Touch(evSetBaudRate);
+}
+
+static bool ShowLanguage()
+{
+	return Touch(evTabSetup) && Touch(evSetLanguage);
+}
+
+static bool ShowColours()
+{
+	return Touch(evTabSetup) && Touch(evSetColours);
+}
+
+static bool ShowBabystep()
+{
+	return Touch(evTabStatus) && Touch(evBabyStepPopup);
+}
+
+static bool ShowAlert()
+{
+	Alert alert;
+	alert.mode = Alert::ConfirmCancel;
+	alert.seq = 1;
+	alert.controls = 0;
+	alert.timeout = 0.0f;
+	alert.title.copy("Check the nozzle");
+	alert.text.copy("Is the nozzle clean and free of filament?");
+	alert.flags.SetFromRaw(Alert::GotAll);
+	UI::ProcessAlert(alert);
+	return true;
+}
+
+// A print that is under way, shown on the Print page
+static bool ShowPrinting()
+{
+	HostFirmware::SetStatus(OM::PrinterStatus::printing);
+	UI::PrintStarted();
+	UI::PrintingFilenameChanged("benchy.gcode");
+	UI::SetPrintProgressPercent(42);
+	UI::UpdateDuration(1260);
+	UI::UpdateTimesLeft(0, 1740);
+	UI::UpdateTimesLeft(1, 1690);
+	UI::UpdateTimesLeft(2, 1800);
+	return Touch(evTabStatus);
+}
+
+// A repeatable sequence of numbers for the changes below, so that every run draws the same thing
+static uint32_t NextRandom(uint32_t limit)
+{
+	static uint32_t seed = 1;
+	seed = seed * 1103515245u + 12345u;
+	return (seed >> 16) % limit;
+}
+
+// Temperatures, positions and percentages as the host reports them twice a second. The values cross
+// between one, two and three digits and go negative, so the numeric fields change width as well as digits.
+static void UpdateNumbers()
+{
+	for (unsigned int step = 0; step < 200; ++step)
+	{
+		for (size_t heater = 0; heater < 3; ++heater)
+		{
+			if (NextRandom(3) != 0)
+			{
+				UI::UpdateCurrentTemperature(heater, (float)((int)NextRandom(4200) - 200)/10.0f);
+			}
+			if (NextRandom(8) == 0)
+			{
+				UI::UpdateActiveTemperature(heater, NextRandom(300));
+			}
+		}
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			if (NextRandom(2) != 0)
+			{
+				UI::UpdateAxisPosition(axis, (float)((int)NextRandom(100000) - 1000)/100.0f);
+			}
+		}
+		if (NextRandom(10) == 0)
+		{
+			UI::UpdateFanPercent(0, NextRandom(101));
+			UI::UpdateSpeedPercent(50 + NextRandom(200));
+			UI::UpdateExtrusionFactor(NextRandom(2), 80 + NextRandom(40));
+		}
+		HostFirmware::AdvanceTime(500);
+		do
+		{
+			mgr.Refresh(false);
+		} while (mgr.IsRefreshing());
+	}
+}
+
+static bool UpdateControl()
+{
+	UpdateNumbers();
+	return true;
+}
+
+static bool UpdatePrint()
+{
+	if (!Touch(evTabStatus))
+	{
+		return false;
+	}
+	Refresh();
+	UpdateNumbers();
+	return true;
+}
+
+// Open an alert on top of the popup that 'ev' brings up, then close the alert
+static bool CloseAlertOver(event_t ev, int param = -1)
+{
+	if (!Touch(ev, param))
+	{
+		return false;
+	}
+	Refresh();
+	(void)ShowAlert();
+	Refresh();
+	return Touch(evCloseAlert);
+}
+
+// The alert is inside the move popup, which is then closed too
+static bool CloseMovePopup()
+{
+	if (!CloseAlertOver(evMovePopup))
+	{
+		return false;
+	}
+	Refresh();
+	return Touch(evCancel);
+}
+
+// The Z axis goes away while the tool temperature popup covers the bottom of its home button. The rest of the button
+// must be cleared when it is hidden, because closing the popup only repaints the area the popup covered.
+static bool HideUnderPopup()
+{
+	if (!Touch(evAdjustToolActiveTemp, 0))
+	{
+		return false;
+	}
+	Refresh();
+	UI::SetAxisVisible(2, false);
+	UI::UpdateGeometry(2, false);
+	Refresh();
+	return Touch(evSetInt);
+}
+
+// Change the language and then the colour scheme, and change each back again. The fields are created again each time.
+static bool ChangeSettings()
+{
+	static const event_t changes[][2] = { { evSetLanguage, evAdjustLanguage }, { evSetColours, evAdjustColours } };
+	for (const event_t *change : changes)
+	{
+		for (int value : { 1, 0 })
+		{
+			if (!Touch(evTabSetup))
+			{
+				return false;
+			}
+			Refresh();
+			if (!Touch(change[0]))
+			{
+				return false;
+			}
+			Refresh();
+			if (!Touch(change[1], value))
+			{
+				return false;
+			}
+			Refresh();
+		}
+	}
+	return true;
+}
+
+struct Page
+{
+	const char *name;
+	bool (*show)();		// bring up the page, starting from the Control page with no popup. Return false if a button wasn't found.
+};
+
+// The printing page must be last because it leaves the printer printing
+static const Page pages[] =
+{
+	{ "control", ShowControl },
+	{ "print", ShowPrint },
+	{ "console", ShowConsole },
+	{ "setup", ShowSetup },
+	{ "tooltemp", ShowToolTemperature },
+	{ "move", ShowMove },
+	{ "extrude", ShowExtrude },
+	{ "files", ShowFiles },
+	{ "macros", ShowMacros },
+	{ "keyboard", ShowKeyboard },
+	{ "baudrate", ShowBaudRate },
+	{ "language", ShowLanguage },
+	{ "colours", ShowColours },
+	{ "babystep", ShowBabystep },
+	{ "alert", ShowAlert },
+	{ "printing", ShowPrinting },
+};
+
+// These are run after the pages, so they see the printer printing. The last one leaves it with two axes.
+static const Page updates[] =
+{
+	{ "controlnum", UpdateControl },
+	{ "printnum", UpdatePrint },
+	{ "closemove", CloseMovePopup },
+	{ "hideunder", HideUnderPopup },
+};
+
+// The fields must be created again in the memory they used before, leaving the heap as it was
+static const Page recreate = { "recreate", ChangeSettings };
+
+static std::vector<uint16_t> Capture()
+{
+	std::vector<uint16_t> pixels;
+	pixels.reserve((size_t)HostPanel::GetWidth() * HostPanel::GetHeight());		// memory is never given back, so don't let the vector grow
+	for (uint16_t y = 0; y < HostPanel::GetHeight(); ++y)
+	{
+		for (uint16_t x = 0; x < HostPanel::GetWidth(); ++x)
+		{
+			pixels.push_back(HostPanel::GetPixel(x, y));
+		}
+	}
+	return pixels;
+}
+
+// Bring up a page or make some changes from the Control page with no popup, measuring the bus activity.
+// Return nullptr if that went well, else the reason it failed.
+static const char *Run(const Page& page, UTFT::BusStats& bus)
+{
+	mgr.ClearAllPopups();
+	UI::ShowDefaultPage();
+	Refresh();
+
+	lcd.resetBusStats();
+	HostPanel::ResetStats();
+	const bool shown = page.show();
+	Refresh();
+	bus = lcd.getBusStats();
+	const HostPanel::Stats panel = HostPanel::GetStats();
+
+	if (!shown)
+	{
+		return "button not found";
+	}
+	if (panel.windows != bus.windows || panel.pixels != bus.pixels || panel.commands != bus.commands)
+	{
+		return "UTFT and panel counts differ";
+	}
+	if (panel.overruns != 0 || panel.strayWrites != 0)
+	{
+		return "window overrun or stray data";
+	}
+	return nullptr;
+}
+
+int main(int argc, char **argv)
+{
+	const char *outputFolder = ".", *referenceFolder = nullptr;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+		{
+			outputFolder = argv[++i];
+		}
+		else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+		{
+			referenceFolder = argv[++i];
+		}
+		else
+		{
+			fprintf(stderr, "Usage: uirender [-o output-folder] [-r reference-folder]\n");
+			return 2;
+		}
+	}
+
+	// Start up the way PanelDue.cpp does, without the splash screen
+	const uint32_t fieldsMemory = HostFirmware::InitLcd();
+	MessageLog::Init();
+	SetUpPrinter();
+	mgr.Refresh(true);
+	UI::UpdatePrintingFields();
+	debugField->Show(false);
+	UI::ShowDefaultPage();
+	Refresh();
+
+	printf("The fields use %u bytes of heap\n", (unsigned int)fieldsMemory);
+	printf("%-10s %8s %8s %8s %8s  %s\n", "page", "windows", "commands", "pixels", "writes", "result");
+	unsigned int failures = 0;
+	for (const Page& page : pages)
+	{
+		char filename[256];
+		snprintf(filename, sizeof(filename), "%s/%s.ppm", (referenceFolder != nullptr) ? referenceFolder : outputFolder, page.name);
+
+		UTFT::BusStats bus;
+		const char *result = Run(page, bus);
+		if (result == nullptr)
+		{
+			if (referenceFolder != nullptr)
+			{
+				const int32_t differences = HostPanel::Compare(filename);
+				result = (differences < 0) ? "no reference image" : (differences != 0) ? "differs from reference" : "matches reference";
+			}
+			else
+			{
+				result = (HostPanel::WritePpm(filename)) ? "ok" : "can't write image";
+			}
+		}
+
+		printf("%-10s %8u %8u %8u %8u  %s\n", page.name, bus.windows, bus.commands, bus.pixels, bus.writes, result);
+		if (strcmp(result, "ok") != 0 && strcmp(result, "matches reference") != 0)
+		{
+			++failures;
+		}
+	}
+
+	for (const Page& update : updates)
+	{
+		UTFT::BusStats bus;
+		const char *result = Run(update, bus);
+		if (result == nullptr)
+		{
+			const std::vector<uint16_t> drawn = Capture();
+			mgr.Refresh(true);
+			result = (Capture() == drawn) ? "matches full redraw" : "differs from full redraw";
+		}
+
+		printf("%-10s %8u %8u %8u %8u  %s\n", update.name, bus.windows, bus.commands, bus.pixels, bus.writes, result);
+		if (strcmp(result, "matches full redraw") != 0)
+		{
+			++failures;
+		}
+	}
+
+	{
+		const void * const heapTop = GetHeapTop();
+		UTFT::BusStats bus;
+		const char *result = Run(recreate, bus);
+		if (result == nullptr)
+		{
+			result = (GetHeapTop() == heapTop) ? "heap unchanged" : "heap changed";
+		}
+
+		printf("%-10s %8u %8u %8u %8u  %s\n", recreate.name, bus.windows, bus.commands, bus.pixels, bus.writes, result);
+		if (strcmp(result, "heap unchanged") != 0)
+		{
+			++failures;
+		}
+	}
+	return (failures == 0) ? 0 : 1;
+}
+
+// End
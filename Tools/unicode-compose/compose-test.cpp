@@ -0,0 +1,134 @@
+/*
+ * compose-test.cpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Host test of UnicodeComposer, which SerialIo uses to compose combining diacritical marks in string values as they are received.
+ * Each case is fed to the composer split into two chunks at every possible point, as it might arrive from the UART.
+ *
+ * Usage: compose-test		prints each failing case and exits with status 1 if any failed
+ */
+
+#include <Library/UnicodeComposer.hpp>
+#include <cstdio>
+#include <cstring>
+
+// A fixed-capacity string with the members of String that UnicodeComposer uses
+class TestString
+{
+public:
+	explicit TestString(size_t cap) : capacity(cap), len(0) { buf[0] = 0; }
+
+	bool cat(char c)
+	{
+		if (len >= capacity)
+		{
+			return true;
+		}
+		buf[len++] = c;
+		buf[len] = 0;
+		return false;
+	}
+
+	size_t strlen() const { return len; }
+	void Truncate(size_t l) { if (l < len) { len = l; buf[len] = 0; } }
+	const char *c_str() const { return buf; }
+
+private:
+	char buf[64];
+	size_t capacity;
+	size_t len;
+};
+
+struct TestCase
+{
+	const char *name;
+	const char *input;
+	const char *expected;
+	size_t capacity;
+};
+
+static const TestCase cases[] =
+{
+	{ "acute",						"Caf" "e\xCC\x81",				"Caf\xC3\xA9",				63 },
+	{ "caron on D",					"\x44\xCC\x8C",					"\xC4\x8E",					63 },		// U+010E, which the old hand-written table got wrong
+	{ "several in one string",		"n\xCC\x8C" "a" "o\xCC\x88" "!",	"\xC5\x88" "a\xC3\xB6!",		63 },
+	{ "no composed form",			"q\xCC\x81",					"q\xCC\x81",				63 },
+	{ "mark after a digit",			"1\xCC\x81",					"1\xCC\x81",				63 },
+	{ "mark at the start",			"\xCC\x81" "e",					"\xCC\x81" "e",				63 },
+	{ "two marks",					"e\xCC\x81\xCC\x81",			"\xC3\xA9\xCC\x81",			63 },
+	{ "mark after a composed letter", "\xC3\xA9\xCC\x81",			"\xC3\xA9\xCC\x81",			63 },
+	{ "mark outside U+0300-033F",	"e\xCD\x81",					"e\xCD\x81",				63 },
+	{ "0xCC before a non-continuation byte", "e\xCC" "a",			"e\xCC" "a",				63 },
+	{ "dangling 0xCC",				"e\xCC",						"e",						63 },
+	{ "letter fills the string",	"abc" "e\xCC\x81",				"abce",						4 },
+	{ "composed form just fits",	"abc" "e\xCC\x81",				"abc\xC3\xA9",				5 },
+};
+
+// Feed 'input' to a new composer in two chunks, split after 'split' bytes
+static void Compose(const char *input, size_t split, TestString& result)
+{
+	UnicodeComposer composer;
+	composer.Reset();
+	const size_t len = strlen(input);
+	for (size_t start = 0; start < len; start = split, split = len)
+	{
+		for (size_t i = start; i < split; ++i)
+		{
+			composer.Append(result, input[i]);
+		}
+	}
+}
+
+static void PrintBytes(const char *s)
+{
+	for (; *s != 0; ++s)
+	{
+		printf(" %02X", (uint8_t)*s);
+	}
+}
+
+int main()
+{
+	unsigned int failures = 0, checks = 0;
+	for (const TestCase& tc : cases)
+	{
+		for (size_t split = 0; split <= strlen(tc.input); ++split)
+		{
+			TestString result(tc.capacity);
+			Compose(tc.input, split, result);
+			++checks;
+			if (strcmp(result.c_str(), tc.expected) != 0)
+			{
+				printf("%s, split after %u bytes: got", tc.name, (unsigned int)split);
+				PrintBytes(result.c_str());
+				printf(", expected");
+				PrintBytes(tc.expected);
+				printf("\n");
+				++failures;
+			}
+		}
+	}
+
+	// Every entry in the table must compose to its character, encoded as 2 bytes of UTF8
+	for (const UnicodeCompositionEntry& e : unicodeCompositions)
+	{
+		const char input[] = { (char)(e.key & 0xFF), (char)0xCC, (char)(0x80 | (e.key >> 8)), 0 };
+		const char expected[] = { (char)(0xC0 | (e.composed >> 6)), (char)(0x80 | (e.composed & 0x3F)), 0 };
+		TestString result(63);
+		Compose(input, 2, result);
+		++checks;
+		if (strcmp(result.c_str(), expected) != 0)
+		{
+			printf("table entry U+%04X: got", e.composed);
+			PrintBytes(result.c_str());
+			printf("\n");
+			++failures;
+		}
+	}
+
+	printf("%u checks, %u failed\n", checks, failures);
+	return (failures == 0) ? 0 : 1;
+}
+
+// End
@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+#
+# Generate src/Library/UnicodeComposition.hpp, the table used by SerialIo to compose
+# an ASCII letter followed by a combining diacritical mark into a single precomposed
+# character from the Latin-1 Supplement or Latin Extended-A blocks.
+#
+# Usage: gen-compose.py > ../../src/Library/UnicodeComposition.hpp
+
+import unicodedata
+
+FIRST = 0x00C0
+LAST = 0x017F
+
+entries = []
+for cp in range(FIRST, LAST + 1):
+	decomposition = unicodedata.decomposition(chr(cp)).split()
+	if len(decomposition) != 2 or decomposition[0].startswith('<'):
+		continue
+	base, mark = (int(d, 16) for d in decomposition)
+	# SerialIo only composes ASCII letters with marks encoded as 0xCC followed by one continuation byte
+	if base >= 0x80 or not (0x0300 <= mark <= 0x033F):
+		continue
+	entries.append((mark & 0x3F, base, cp))
+
+entries.sort()
+
+print('''/*
+ * UnicodeComposition.hpp
+ *
+ * Generated by Tools/unicode-compose/gen-compose.py - do not edit.
+ *
+ * Composition of an ASCII letter followed by a combining diacritical mark in the range U+0300 to U+033F
+ * into a precomposed character in the range U+%04X to U+%04X.
+ */
+
+#ifndef SRC_LIBRARY_UNICODECOMPOSITION_HPP_
+#define SRC_LIBRARY_UNICODECOMPOSITION_HPP_
+
+#include <cstdint>
+
+struct UnicodeCompositionEntry
+{
+	uint16_t key;			// low 6 bits of the combining mark in the high byte, base character in the low byte
+	uint16_t composed;
+};
+
+// This table is sorted by key
+constexpr UnicodeCompositionEntry unicodeCompositions[] =
+{''' % (FIRST, LAST))
+for mark, base, cp in entries:
+	print('\t{ 0x%04X, 0x%04X },\t\t// %s' % ((mark << 8) | base, cp, unicodedata.name(chr(cp))))
+print('''};
+
+#endif /* SRC_LIBRARY_UNICODECOMPOSITION_HPP_ */''')
@@ -55,10 +55,19 @@
 #define IS_ER			(false)
 #endif
 
+// The packed fonts can hold any combination of these. Adding the Japanese characters to the Cyrillic ones costs 9.1Kb of flash
+// in the small font and 13.4Kb in the large one, plus about 2.3Kb for the Japanese strings. Every target has 256Kb of flash,
+// but the release builds haven't been sized with Japanese added, so it stays off until they have.
 #define USE_CYRILLIC_CHARACTERS		(1)
 #define USE_JAPANESE_CHARACTERS		(0)
+#define USE_PACKED_FONTS			(1)		// use the fonts generated by Tools/fontpack instead of the column bitmap fonts they are generated from
+
+#if USE_CYRILLIC_CHARACTERS && USE_JAPANESE_CHARACTERS && !USE_PACKED_FONTS
+# error "The column bitmap fonts can hold the Cyrillic or the Japanese characters but not both"
+#endif
 
 const uint32_t DefaultBaudRate = 57600;
+const int BaudRates[] = { 9600, 19200, 38400, 57600, 115200 };	// the rates offered by the baud rate popup, which are the only ones we accept from the host
 const uint32_t DimDisplayTimeout = 60000;				// dim this display after no activity for this number of milliseconds
 const uint32_t DefaultScreensaverTimeout = 120000;		// enable screensaver after no activity for this number of milliseconds
 const uint32_t ScreensaverMoveTime = 10000;				// Jog around screen saver text after this number of milliseconds
@@ -68,8 +77,16 @@ const uint16_t DefaultFeedrate = 6000;					// default feedrate in mm/min
 
 const uint32_t MinimumEncoderCommandInterval = 100;		// minimum time in milliseconds between serial commands sent due to encoder movement
 
-constexpr uint32_t MinimumLineQuietTime = 200;			// the minimum time in milliseconds that we require the receive data line to be quiet before we transmit a non-command request
+const uint16_t DefaultPrinterPollInterval = 500;		// poll interval in milliseconds
+const uint16_t DefaultSlowPrinterPollInterval = 4000;	// poll interval in milliseconds when screensaver active
+const uint16_t DefaultLineQuietTime = 200;				// the minimum time in milliseconds that we require the receive data line to be quiet before we transmit a non-command request
 
 const size_t MaxFilnameLength = 120;
 
+const uint16_t DisplayBandLines = 16;					// the number of display rows composed in RAM at a time when redrawing the whole screen, if supported
+const uint32_t MinFreeMemoryAfterBand = 8192;			// don't use band rendering unless this much RAM is left for the stack and the object model after the band buffer
+const uint32_t RefreshSlicePixels = 32000;				// the number of pixels redrawn per pass of the main loop when changing page, so that serial input and touches are not held up
+const uint8_t DefaultFrameRate = 25;					// the most times per second that the main loop redraws changed fields, except straight after a touch
+const uint32_t MaxFrameDeferral = 250;					// the longest time in milliseconds that we put off redrawing while a response from the printer is arriving
+
 #endif /* CONFIGURATION_H_ */
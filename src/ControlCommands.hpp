@@ -8,13 +8,33 @@
 #ifndef SRC_CONTROLCOMMANDS_HPP_
 #define SRC_CONTROLCOMMANDS_HPP_
 
+#include <cstddef>
+
 enum class ControlCommand
 {
 	invalid,
 	reset,
 	eraseAndReset,
+	latencyExport,
+	latencyReset,
+	latencyShow,
+	busStats,
+	displayBenchmark,
+	glyphCacheStats,
+	renderReset,
+	renderShow,
+	baudRate,
+	frameRate,
+	lineQuietTime,
+	logLevel,
+	pollInterval,
+	pushUpdates,
+	saveSettings,
+	slowPollInterval,
 };
 
+const size_t MaxControlCommandLength = 32;		// longest command name we accept, excluding any value
+
 
 struct ControlCommandMapEntry
 {
@@ -25,8 +45,24 @@ struct ControlCommandMapEntry
 // This table has to be kept in alphabetical order of the keys
 const ControlCommandMapEntry controlCommandMap[] =
 {
-	{ "eraseAndReset",	ControlCommand::eraseAndReset },
-	{ "reset",			ControlCommand::reset },
+	{ "baudRate",			ControlCommand::baudRate },
+	{ "busStats",			ControlCommand::busStats },
+	{ "displayBenchmark",	ControlCommand::displayBenchmark },
+	{ "eraseAndReset",		ControlCommand::eraseAndReset },
+	{ "frameRate",			ControlCommand::frameRate },
+	{ "glyphCacheStats",	ControlCommand::glyphCacheStats },
+	{ "latencyExport",		ControlCommand::latencyExport },
+	{ "latencyReset",		ControlCommand::latencyReset },
+	{ "latencyShow",		ControlCommand::latencyShow },
+	{ "lineQuietTime",		ControlCommand::lineQuietTime },
+	{ "logLevel",			ControlCommand::logLevel },
+	{ "pollInterval",		ControlCommand::pollInterval },
+	{ "pushUpdates",		ControlCommand::pushUpdates },
+	{ "renderReset",		ControlCommand::renderReset },
+	{ "renderShow",			ControlCommand::renderShow },
+	{ "reset",				ControlCommand::reset },
+	{ "saveSettings",		ControlCommand::saveSettings },
+	{ "slowPollInterval",	ControlCommand::slowPollInterval },
 };
 
 #endif /* SRC_CONTROLCOMMANDS_HPP_ */
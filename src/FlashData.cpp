@@ -22,7 +22,11 @@ bool FlashData::IsValid() const
 		&& displayDimmerType < DisplayDimmerType::NumTypes
 		&& babystepAmountIndex < ARRAY_SIZE(babystepAmounts)
 		&& feedrate > 0
-		&& heaterCombineType < HeaterCombineType::NumTypes;
+		&& heaterCombineType < HeaterCombineType::NumTypes
+		&& pollInterval != 0
+		&& slowPollInterval != 0
+		&& frameRate != 0
+		&& pushUpdates <= 1;
 }
 
 bool FlashData::operator==(const FlashData& other)
@@ -45,7 +49,12 @@ bool FlashData::operator==(const FlashData& other)
 		&& babystepAmountIndex == other.babystepAmountIndex
 		&& feedrate == other.feedrate
 		&& heaterCombineType == other.heaterCombineType
-		&& logLevel == other.logLevel;
+		&& logLevel == other.logLevel
+		&& pollInterval == other.pollInterval
+		&& slowPollInterval == other.slowPollInterval
+		&& lineQuietTime == other.lineQuietTime
+		&& frameRate == other.frameRate
+		&& pushUpdates == other.pushUpdates;
 }
 
 void FlashData::SetDefaults()
@@ -68,6 +77,11 @@ void FlashData::SetDefaults()
 	feedrate = DefaultFeedrate;
 	heaterCombineType = HeaterCombineType::notCombined;
 	logLevel = MessageLog::LogLevel::Normal;
+	pollInterval = DefaultPrinterPollInterval;
+	slowPollInterval = DefaultSlowPrinterPollInterval;
+	lineQuietTime = DefaultLineQuietTime;
+	frameRate = DefaultFrameRate;
+	pushUpdates = 0;
 	magic = magicVal;
 }
 
@@ -32,7 +32,7 @@ struct FlashData
 {
 	// The magic value should be changed whenever the layout of the NVRAM changes
 	// We now use a different magic value for each display size, to force the "touch the spot" screen to be displayed when you change the display size
-	static const uint32_t magicVal = 0x3AB64A50 + DISPLAY_TYPE;
+	static const uint32_t magicVal = 0x3AB64D50 + DISPLAY_TYPE;
 	static const uint32_t muggleVal = 0xFFFFFFFF;
 
 	alignas(4) uint32_t magic;
@@ -54,6 +54,11 @@ struct FlashData
 	uint16_t feedrate;
 	HeaterCombineType heaterCombineType;
 	MessageLog::LogLevel logLevel;
+	uint16_t pollInterval;
+	uint16_t slowPollInterval;
+	uint16_t lineQuietTime;
+	uint8_t frameRate;
+	uint8_t pushUpdates;
 	alignas(4) char dummy;								// must be at a multiple of 4 bytes from the start because flash is read/written in whole dwords
 
 	FlashData() : magic(muggleVal) { SetDefaults(); }
@@ -95,6 +100,21 @@ struct FlashData
 	void SetBaudRate(uint32_t rate) { nvData.baudRate = rate; }
 	uint32_t GetBaudRate() { return nvData.baudRate; }
 
+	void SetPollInterval(uint16_t interval) { nvData.pollInterval = interval; }
+	uint16_t GetPollInterval() { return nvData.pollInterval; }
+
+	void SetSlowPollInterval(uint16_t interval) { nvData.slowPollInterval = interval; }
+	uint16_t GetSlowPollInterval() { return nvData.slowPollInterval; }
+
+	void SetLineQuietTime(uint16_t quietTime) { nvData.lineQuietTime = quietTime; }
+	uint16_t GetLineQuietTime() { return nvData.lineQuietTime; }
+
+	void SetFrameRate(uint8_t rate) { nvData.frameRate = rate; }
+	uint8_t GetFrameRate() { return nvData.frameRate; }
+
+	void SetPushUpdates(bool enabled) { nvData.pushUpdates = enabled; }
+	bool GetPushUpdates() { return nvData.pushUpdates != 0; }
+
 	void SetBrightness(uint32_t percent) { nvData.brightness =
 		constrain<int>(percent, Backlight::MinBrightness, Backlight::MaxBrightness); }
 	int GetBrightness() { return (int)nvData.brightness; }
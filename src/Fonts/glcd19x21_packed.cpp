@@ -0,0 +1,2222 @@
+/*
+ * glcd19x21_packed.cpp
+ *
+ * Generated from glcd19x21.cpp by Tools/fontpack/fontpack.py - do not edit.
+ *
+ * Latin + Cyrillic + Japanese:   39970 bytes as column bitmaps,  22611 bytes packed (44% saved)
+ * Latin + Cyrillic:              28834 bytes as column bitmaps,  13275 bytes packed (54% saved)
+ * Latin + Japanese:              31502 bytes as column bitmaps,  19649 bytes packed (38% saved)
+ * Latin:                         20366 bytes as column bitmaps,  10304 bytes packed (50% saved)
+ */
+
+#include <asf.h>
+
+#include "Configuration.hpp"
+
+#if USE_CYRILLIC_CHARACTERS && USE_JAPANESE_CHARACTERS
+
+extern const uint8_t glcd19x21_packed[] =
+{
+	19,			// character width in pixels
+	21,			// row height in pixels
+	2,			// space columns between characters before kerning
+	3,			// font format: sparse packed
+	0x20, 0x00,	// lowest character code (2 bytes, little endian)
+	0xFE, 0x30,	// highest character code (2 bytes, little endian)
+
+	// Number of ranges, then the first code, last code and first glyph of each range (2 bytes each, little endian)
+	0x03, 0x00,
+	0x20, 0x00, 0x7E, 0x01, 0x00, 0x00,
+	0x00, 0x04, 0x91, 0x04, 0x5F, 0x01,
+	0x3F, 0x30, 0xFE, 0x30, 0xF1, 0x01,
+
+	// Number of edge columns (2 bytes, little endian), then the edge columns
+	0xEE, 0x00,
+	0x00, 0x00, 0x00, 0xF8, 0x9F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3E, 0x00, 0x0C, 0x00, 0x18, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x09,
+	0x00, 0x80, 0x07, 0x00, 0x18, 0x00, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x60, 0x00, 0x01, 0x40, 0x80, 0x01, 0xC0, 0x00, 0x01,
+	0x60, 0x60, 0x00, 0x60, 0x78, 0x00, 0x80, 0x63, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x1F, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0xE0, 0x78, 0x00,
+	0xE0, 0x43, 0x00, 0xC0, 0x1F, 0x00, 0xC0, 0x80, 0x01, 0xC0, 0x80, 0x09, 0xC0, 0x80, 0x07, 0x00, 0x07, 0x00, 0x30, 0x60, 0x00, 0x80, 0x10, 0x00,
+	0x60, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFF, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x78, 0x00, 0x08, 0x00, 0x01, 0x08, 0x04, 0x00, 0x60, 0x7C, 0x00,
+	0xF8, 0x7F, 0x00, 0x00, 0x60, 0x00, 0xF8, 0x0F, 0x00, 0x78, 0x00, 0x00, 0x08, 0x80, 0x01, 0xFC, 0xFF, 0x1F, 0x04, 0x00, 0x10, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF1, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x7F, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x3F, 0x00,
+	0x00, 0x4E, 0x00, 0x40, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x7F, 0x04, 0xC0, 0xFF, 0x03, 0x00, 0xFF, 0x01, 0xCC, 0xFF, 0x01, 0xCC, 0xFF, 0x0F,
+	0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x80, 0xC3, 0x00, 0x80, 0xF1, 0x00, 0x40, 0x00, 0x01, 0xC0, 0x7F, 0x00, 0x00, 0x08, 0x00,
+	0xFC, 0xFF, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x60, 0x00, 0x18, 0x00, 0x03, 0xC0, 0xFC, 0x0F, 0x00, 0x06, 0x00, 0xC0, 0x38, 0x00,
+	0x00, 0x82, 0x01, 0x00, 0x40, 0x00, 0x00, 0x0E, 0x00, 0xFC, 0xE3, 0x1F, 0x10, 0x86, 0x01, 0x00, 0x0F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x1C, 0x00,
+	0x80, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01, 0xF0, 0x08, 0x00, 0x10, 0x0C, 0x00, 0x70, 0x07, 0x00, 0xF0, 0x01, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x18, 0x10, 0x08, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFA, 0xFF, 0x01, 0x03, 0x00, 0x00, 0x60, 0x30, 0x00,
+	0x80, 0x1F, 0x01, 0x88, 0x1F, 0x00, 0x80, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF9, 0x00, 0xD0, 0xFF, 0x01, 0x00, 0x1C, 0x01, 0x40, 0x1C, 0x00,
+	0x00, 0xF2, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1F, 0x00, 0x00, 0xC3, 0x00, 0x20, 0xC3, 0x00, 0x08, 0xC3, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x01,
+	0x10, 0x00, 0x11, 0x00, 0x7E, 0x04, 0x80, 0xFF, 0x03, 0xF0, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x30, 0x00, 0x00, 0x98, 0xFF, 0x1F, 0xF6, 0xFF, 0x01,
+	0x80, 0xFF, 0x01, 0xF0, 0x1F, 0x00, 0x98, 0xFF, 0x01, 0x98, 0xFF, 0x0F, 0xF4, 0x1F, 0x00, 0x30, 0x00, 0x10, 0xF8, 0xFF, 0x15, 0xF8, 0xFF, 0x0D,
+	0xB0, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xFE, 0x0F, 0x08, 0x7E, 0x00, 0x80, 0x00, 0x01, 0x88, 0x01, 0x00, 0x80, 0xFF, 0x15, 0x80, 0x01, 0x00,
+	0x88, 0xFF, 0x01, 0x40, 0x70, 0x00, 0x00, 0xC7, 0x00, 0x00, 0xF3, 0x00, 0x80, 0x00, 0x1D, 0x80, 0x08, 0x00, 0x80, 0x08, 0x01, 0x80, 0xFF, 0x00,
+	0x80, 0xFF, 0x11, 0x10, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x01, 0x01, 0x88, 0x01, 0x01, 0x00, 0xFE, 0x00, 0x80, 0x60, 0x00, 0xC0, 0x41, 0x00,
+	0xF0, 0x7F, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x71, 0x00, 0xC0, 0x01, 0x00, 0x18, 0x7E, 0x00, 0x00, 0xF7, 0x00,
+	0x80, 0xFF, 0x1F, 0x00, 0x42, 0x00, 0x80, 0x01, 0x10, 0x80, 0x0F, 0x00, 0x00, 0xFF, 0x0F, 0x88, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x88, 0x00, 0x01,
+	0x98, 0x01, 0x00, 0x1F, 0x00, 0x00, 0xFE, 0xFF, 0x1F, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x01, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0C,
+	0x00, 0x00, 0x04, 0xC0, 0x80, 0x03, 0x80, 0x01, 0x08, 0x1C, 0x18, 0x00, 0x00, 0x01, 0x00, 0xC6, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x1E, 0x00, 0xC0, 0x80, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x01, 0x00, 0x80, 0x00, 0x40, 0x00, 0x03, 0x00, 0xFE, 0x03,
+	0x1C, 0x00, 0x01, 0x1C, 0x20, 0x00, 0x18, 0x20, 0x00, 0xE0, 0x00, 0x02, 0x00, 0x00, 0x02, 0x80, 0x00, 0x02, 0x18, 0x02, 0x06, 0x60, 0x70, 0x00,
+	0x00, 0xF0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0E, 0x00, 0x12, 0x00, 0x00, 0x03, 0x06, 0x80, 0x61, 0x00, 0xE0, 0xFF, 0x07,
+	0xC0, 0x01, 0x06, 0x20, 0x00, 0x01, 0x70, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x24, 0x00, 0x00, 0x1C, 0x80, 0x00, 0xF0, 0xFF, 0x0F, 0xF8, 0x1F, 0x00,
+	0xF0, 0xFF, 0x07, 0xC0, 0xC0, 0x00, 0x30, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x1E, 0xC0, 0x00, 0xF8, 0xFF, 0x1F,
+
+	// Width, leading edge and trailing edge of each glyph
+	0x07, 0x00, 0x00, 0x02, 0x01, 0x01, 0x05, 0x02, 0x02, 0x0C, 0x03, 0x04, 0x0C, 0x05, 0x06, 0x11, 0x07, 0x08, 0x0D, 0x09, 0x0A, 0x02, 0x02, 0x02, 0x05, 0x0B, 0x0C, 0x06, 0x0C, 0x0B,
+	0x06, 0x0D, 0x0D, 0x0A, 0x0E, 0x0E, 0x02, 0x0F, 0x10, 0x05, 0x11, 0x11, 0x02, 0x12, 0x12, 0x06, 0x12, 0x13, 0x0A, 0x14, 0x14, 0x09, 0x15, 0x0A, 0x0A, 0x16, 0x17, 0x0A, 0x18, 0x19,
+	0x0B, 0x03, 0x03, 0x0A, 0x1A, 0x1B, 0x0A, 0x1C, 0x1B, 0x0A, 0x1D, 0x1E, 0x0A, 0x1F, 0x1F, 0x0A, 0x20, 0x21, 0x02, 0x22, 0x22, 0x02, 0x23, 0x24, 0x0A, 0x25, 0x26, 0x0A, 0x27, 0x27,
+	0x0A, 0x26, 0x25, 0x0A, 0x28, 0x29, 0x11, 0x2A, 0x21, 0x0D, 0x0A, 0x0A, 0x0B, 0x2B, 0x2C, 0x0D, 0x1C, 0x18, 0x0C, 0x2B, 0x1C, 0x0B, 0x2B, 0x2D, 0x0A, 0x2B, 0x2E, 0x0D, 0x1C, 0x2F,
+	0x0A, 0x2B, 0x2B, 0x02, 0x2B, 0x2B, 0x09, 0x05, 0x30, 0x0B, 0x2B, 0x0A, 0x09, 0x2B, 0x0A, 0x0D, 0x2B, 0x2B, 0x0A, 0x2B, 0x2B, 0x0E, 0x1C, 0x1C, 0x0B, 0x2B, 0x29, 0x0E, 0x1C, 0x1C,
+	0x0C, 0x2B, 0x0A, 0x0C, 0x31, 0x2C, 0x0C, 0x1D, 0x1D, 0x0C, 0x32, 0x32, 0x0D, 0x1D, 0x1D, 0x13, 0x33, 0x33, 0x0C, 0x2D, 0x2D, 0x0C, 0x1E, 0x1E, 0x0B, 0x34, 0x2D, 0x04, 0x35, 0x36,
+	0x06, 0x13, 0x12, 0x04, 0x36, 0x35, 0x08, 0x37, 0x37, 0x0C, 0x38, 0x38, 0x04, 0x39, 0x3A, 0x0B, 0x3B, 0x0A, 0x09, 0x3C, 0x3D, 0x09, 0x0B, 0x3E, 0x09, 0x3D, 0x3C, 0x0A, 0x3F, 0x40,
+	0x06, 0x41, 0x42, 0x09, 0x43, 0x44, 0x09, 0x3C, 0x45, 0x02, 0x46, 0x46, 0x03, 0x38, 0x47, 0x09, 0x3C, 0x0A, 0x02, 0x3C, 0x3C, 0x0E, 0x48, 0x45, 0x09, 0x48, 0x45, 0x0A, 0x3D, 0x3D,
+	0x09, 0x49, 0x3D, 0x09, 0x3D, 0x49, 0x06, 0x48, 0x4A, 0x09, 0x4B, 0x4C, 0x06, 0x41, 0x4D, 0x09, 0x4E, 0x48, 0x0B, 0x41, 0x41, 0x0F, 0x4A, 0x4A, 0x08, 0x22, 0x22, 0x0B, 0x41, 0x41,
+	0x07, 0x16, 0x17, 0x07, 0x4F, 0x36, 0x02, 0x35, 0x35, 0x07, 0x36, 0x4F, 0x0A, 0x0E, 0x0E, 0x05, 0x50, 0x50, 0x02, 0x00, 0x00, 0x13, 0x51, 0x51, 0x0A, 0x28, 0x28, 0x13, 0x51, 0x51,
+	0x0A, 0x52, 0x52, 0x0A, 0x53, 0x53, 0x0A, 0x54, 0x54, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x55, 0x55,
+	0x09, 0x56, 0x57, 0x0B, 0x58, 0x59, 0x0A, 0x37, 0x5A, 0x0C, 0x1D, 0x1D, 0x02, 0x5B, 0x5B, 0x0A, 0x0A, 0x5C, 0x06, 0x13, 0x13, 0x0F, 0x5D, 0x5D, 0x07, 0x5E, 0x37, 0x0A, 0x5F, 0x60,
+	0x0A, 0x0E, 0x61, 0x05, 0x11, 0x11, 0x0F, 0x5D, 0x5D, 0x0C, 0x62, 0x62, 0x06, 0x28, 0x28, 0x0A, 0x63, 0x63, 0x06, 0x4F, 0x64, 0x05, 0x65, 0x66, 0x04, 0x3A, 0x39, 0x0A, 0x49, 0x0A,
+	0x09, 0x67, 0x1D, 0x02, 0x56, 0x56, 0x03, 0x68, 0x69, 0x06, 0x6A, 0x4F, 0x08, 0x29, 0x29, 0x0A, 0x60, 0x5F, 0x10, 0x6A, 0x59, 0x10, 0x6A, 0x0A, 0x10, 0x65, 0x59, 0x0A, 0x12, 0x6B,
+	0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x13, 0x12, 0x2D, 0x0D, 0x1C, 0x18, 0x0B, 0x2B, 0x2D, 0x0B, 0x2B, 0x2D,
+	0x0B, 0x2B, 0x2D, 0x0B, 0x2B, 0x2D, 0x03, 0x6C, 0x6D, 0x03, 0x6D, 0x6C, 0x05, 0x62, 0x62, 0x07, 0x6E, 0x6E, 0x0E, 0x0E, 0x1C, 0x0A, 0x2B, 0x2B, 0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C,
+	0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C, 0x08, 0x6F, 0x6F, 0x0E, 0x70, 0x71, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x1E, 0x1E,
+	0x0B, 0x2B, 0x72, 0x0B, 0x48, 0x73, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x11, 0x74, 0x40, 0x09, 0x0B, 0x3E,
+	0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x04, 0x39, 0x75, 0x04, 0x75, 0x39, 0x07, 0x3A, 0x3A, 0x06, 0x13, 0x13, 0x0A, 0x61, 0x3D, 0x09, 0x48, 0x45,
+	0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x0E, 0x0E, 0x0A, 0x76, 0x77, 0x09, 0x4E, 0x48, 0x09, 0x4E, 0x48, 0x09, 0x4E, 0x48,
+	0x09, 0x4E, 0x48, 0x0B, 0x41, 0x41, 0x0A, 0x35, 0x3D, 0x0B, 0x41, 0x41, 0x0D, 0x0A, 0x0A, 0x0A, 0x78, 0x0A, 0x0D, 0x0A, 0x0A, 0x0A, 0x78, 0x0A, 0x0D, 0x0A, 0x79, 0x0A, 0x78, 0x79,
+	0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7B, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7C, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7B, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7D, 0x0D, 0x00, 0x1C, 0x0D, 0x61, 0x7E,
+	0x0D, 0x37, 0x1C, 0x0B, 0x61, 0x0D, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x80, 0x0A, 0x61, 0x40,
+	0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82,
+	0x0C, 0x83, 0x83, 0x09, 0x2B, 0x45, 0x0D, 0x41, 0x41, 0x09, 0x3A, 0x45, 0x06, 0x84, 0x84, 0x06, 0x85, 0x85, 0x05, 0x39, 0x39, 0x05, 0x0D, 0x0D, 0x06, 0x6E, 0x6E, 0x06, 0x1E, 0x1E,
+	0x05, 0x00, 0x38, 0x04, 0x86, 0x38, 0x04, 0x00, 0x87, 0x04, 0x00, 0x88, 0x0D, 0x00, 0x89, 0x07, 0x8A, 0x8B, 0x09, 0x05, 0x8C, 0x05, 0x8D, 0x0D, 0x0C, 0x00, 0x7F, 0x09, 0x2B, 0x0A,
+	0x0A, 0x88, 0x0A, 0x0A, 0x00, 0x0A, 0x04, 0x6D, 0x6C, 0x0A, 0x00, 0x0A, 0x03, 0x8E, 0x8F, 0x0A, 0x00, 0x0A, 0x06, 0x2B, 0x7E, 0x0A, 0x00, 0x0A, 0x06, 0x2B, 0x56, 0x0A, 0x11, 0x0A,
+	0x04, 0x11, 0x56, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0A, 0x90, 0x45, 0x0D, 0x00, 0x91, 0x0A, 0x88, 0x92,
+	0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x61, 0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x61, 0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x93, 0x12, 0x91, 0x7F, 0x11, 0x61, 0x40, 0x0D, 0x00, 0x94, 0x06, 0x88, 0x95,
+	0x0D, 0x00, 0x94, 0x06, 0x96, 0x97, 0x0D, 0x00, 0x94, 0x07, 0x98, 0x1D, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B,
+	0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x3A, 0x3A, 0x05, 0x04, 0x9C, 0x0C, 0x3A, 0x3A, 0x07, 0x04, 0x7E, 0x0C, 0x3A, 0x3A, 0x05, 0x9D, 0x9E, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88,
+	0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x0A, 0x9F, 0x1D, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0xA0,
+	0x13, 0x3A, 0x3A, 0x0D, 0x97, 0x97, 0x0B, 0x85, 0x85, 0x09, 0x04, 0x04, 0x0B, 0x85, 0x85, 0x0B, 0xA1, 0x7F, 0x08, 0xA2, 0xA3, 0x0B, 0xA1, 0x7F, 0x08, 0xA2, 0xA3, 0x0B, 0xA1, 0x7F,
+	0x08, 0xA2, 0xA4, 0x05, 0x83, 0x1D, 0x0C, 0x00, 0x7F, 0x0F, 0x3A, 0xA5, 0x0A, 0x00, 0x3A, 0x0D, 0x00, 0xA6, 0x0C, 0xA7, 0x99, 0x04, 0x00, 0x83, 0x06, 0x84, 0x84, 0x09, 0x31, 0xA8,
+	0x13, 0x0A, 0x2C, 0x12, 0x00, 0x2C, 0x0E, 0x3A, 0xA9, 0x0B, 0x00, 0x7F, 0x0D, 0x00, 0x83, 0x0C, 0x7F, 0x3A, 0x0D, 0x00, 0x83, 0x0D, 0x0A, 0x0A, 0x0B, 0x00, 0xAA, 0x0C, 0x00, 0xAA,
+	0x0A, 0x00, 0x3A, 0x0E, 0xAB, 0xAB, 0x0C, 0x00, 0x7F, 0x12, 0x7F, 0x7F, 0x0A, 0x00, 0xAC, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0B, 0x00, 0x7F, 0x0B, 0x0A, 0x83, 0x0E, 0x00, 0x83,
+	0x0C, 0x00, 0x83, 0x0E, 0x00, 0x1C, 0x0C, 0x00, 0x83, 0x0C, 0x00, 0xAD, 0x0D, 0x00, 0xA6, 0x0B, 0x3A, 0x3A, 0x0C, 0x7F, 0x3A, 0x0D, 0x7A, 0x7A, 0x0D, 0x7F, 0x7F, 0x0E, 0x00, 0xAB,
+	0x0C, 0x00, 0x83, 0x10, 0x00, 0x83, 0x12, 0x00, 0xAB, 0x0E, 0x3A, 0x2C, 0x10, 0x00, 0x83, 0x0C, 0x00, 0x2C, 0x0D, 0x00, 0x1C, 0x12, 0x00, 0x1C, 0x0D, 0x0A, 0x83, 0x0A, 0x9B, 0x0A,
+	0x0A, 0x3F, 0xAE, 0x09, 0x88, 0xAF, 0x07, 0x88, 0x04, 0x0B, 0xAB, 0xAB, 0x0A, 0x61, 0x40, 0x0E, 0x94, 0x94, 0x08, 0x7B, 0xAF, 0x09, 0x88, 0x88, 0x09, 0x88, 0x8A, 0x08, 0x88, 0x94,
+	0x09, 0x0A, 0x88, 0x0C, 0x88, 0x88, 0x09, 0x88, 0x88, 0x0A, 0x61, 0x61, 0x08, 0x88, 0x88, 0x0A, 0xB0, 0x61, 0x09, 0x61, 0xB1, 0x08, 0x04, 0x04, 0x09, 0xB2, 0x97, 0x0F, 0x61, 0x61,
+	0x09, 0x94, 0x94, 0x0B, 0x88, 0xAB, 0x09, 0xB3, 0x88, 0x0D, 0x88, 0x88, 0x0F, 0x88, 0xAB, 0x0B, 0x04, 0x73, 0x0D, 0x88, 0x88, 0x0A, 0x88, 0x73, 0x09, 0xB1, 0x61, 0x0D, 0x88, 0x61,
+	0x09, 0x0A, 0x88, 0x0D, 0x00, 0x83, 0x0A, 0x61, 0x40, 0x09, 0x3A, 0xB4, 0x07, 0x88, 0xB5, 0x09, 0x61, 0xB1, 0x09, 0x9A, 0xB6, 0x03, 0x8A, 0x8A, 0x06, 0x85, 0x85, 0x03, 0x38, 0x8B,
+	0x10, 0x0A, 0x73, 0x0E, 0x88, 0x73, 0x09, 0x3A, 0x45, 0x08, 0x88, 0xB7, 0x0D, 0x00, 0x83, 0x09, 0xB2, 0xB8, 0x09, 0x88, 0x88, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83,
+	0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83,
+	0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83,
+	0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83,
+	0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x01, 0x85, 0x85, 0x01, 0x85, 0x85, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83,
+	0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x09, 0x00, 0xB9, 0x08, 0x88, 0x02, 0x12, 0xBA, 0xBA, 0x11, 0x00, 0xBB, 0x12, 0xBC, 0x73,
+	0x11, 0x00, 0xBD, 0x13, 0x00, 0x31, 0x0F, 0x00, 0x73, 0x10, 0x00, 0xBE, 0x11, 0x00, 0xBF, 0x12, 0xC0, 0xBF, 0x11, 0x00, 0x37, 0x13, 0xC1, 0x04, 0x13, 0xC2, 0x11, 0x13, 0xC2, 0xC3,
+	0x12, 0x00, 0x0E, 0x13, 0x56, 0x1E, 0x0E, 0x00, 0xC0, 0x11, 0x00, 0xC4, 0x12, 0x88, 0x97, 0x13, 0x88, 0xC5, 0x10, 0x00, 0x68, 0x13, 0x00, 0x1E, 0x12, 0x00, 0x41, 0x13, 0x00, 0xC6,
+	0x12, 0x00, 0x52, 0x12, 0x00, 0x52, 0x12, 0x28, 0x28, 0x13, 0x28, 0x1D, 0x13, 0xC7, 0x97, 0x13, 0x56, 0x1E, 0x11, 0x4F, 0x56, 0x13, 0x4F, 0x04, 0x13, 0x4A, 0xBF, 0x13, 0x4A, 0x3A,
+	0x11, 0x28, 0xBB, 0x13, 0x4A, 0x1E, 0x11, 0x00, 0x2C, 0x12, 0xC4, 0xC8, 0x13, 0xC4, 0x1D, 0x12, 0x41, 0x85, 0x13, 0x41, 0x37, 0x11, 0x00, 0x68, 0x13, 0x00, 0x13, 0x13, 0xC9, 0xC7,
+	0x12, 0xCA, 0xCB, 0x13, 0xCC, 0xCB, 0x13, 0xCD, 0x0A, 0x12, 0x1B, 0x0B, 0x13, 0xCA, 0xCE, 0x13, 0xCA, 0x54, 0x13, 0xCF, 0xD0, 0x13, 0x85, 0x03, 0x13, 0x28, 0xD1, 0x13, 0x28, 0xD2,
+	0x13, 0x68, 0x6B, 0x13, 0x6B, 0x41, 0x13, 0x6B, 0xD3, 0x13, 0x05, 0xD4, 0x13, 0x05, 0xD5, 0x13, 0x05, 0xD4, 0x13, 0xCA, 0x6B, 0x13, 0xCF, 0xC6, 0x13, 0xCF, 0x13, 0x11, 0x00, 0xD6,
+	0x13, 0xBB, 0x31, 0x13, 0xD7, 0xC4, 0x12, 0xD8, 0x1B, 0x11, 0x4F, 0xCC, 0x11, 0x03, 0xBE, 0x12, 0x51, 0x25, 0x11, 0x00, 0x1B, 0x12, 0x00, 0xC8, 0x10, 0x00, 0xBF, 0x11, 0xD9, 0x68,
+	0x11, 0x00, 0x73, 0x10, 0x00, 0x91, 0x11, 0x05, 0x73, 0x13, 0xCD, 0x6B, 0x11, 0x05, 0x73, 0x11, 0x00, 0x2C, 0x13, 0xCD, 0xBE, 0x12, 0xBC, 0x09, 0x12, 0xDA, 0xBF, 0x12, 0x03, 0xC7,
+	0x13, 0xDB, 0xBB, 0x13, 0xC4, 0x41, 0x12, 0x00, 0x06, 0x12, 0x00, 0x51, 0x12, 0xBA, 0xBA, 0x12, 0xBA, 0xBA, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x1E, 0x3A, 0x04, 0x42, 0x7E,
+	0x0F, 0x00, 0x52, 0x10, 0x00, 0x0D, 0x12, 0xBF, 0x41, 0x0E, 0x00, 0xDC, 0x11, 0x00, 0x97, 0x12, 0x85, 0x85, 0x10, 0x00, 0x04, 0x12, 0x03, 0x3A, 0x10, 0x00, 0x5D, 0x11, 0x00, 0x29,
+	0x10, 0x00, 0xDD, 0x12, 0x6B, 0x6B, 0x11, 0x00, 0x56, 0x12, 0x17, 0x4A, 0x11, 0xD4, 0x21, 0x13, 0xC0, 0x13, 0x12, 0xDE, 0x51, 0x13, 0xDE, 0x1D, 0x11, 0x4F, 0x28, 0x13, 0x4F, 0x1D,
+	0x13, 0x4F, 0x4A, 0x13, 0x03, 0xB8, 0x11, 0x00, 0xDF, 0x12, 0x68, 0x13, 0x12, 0x97, 0x97, 0x13, 0x97, 0x1E, 0x12, 0xC7, 0x0E, 0x13, 0x0E, 0x0D, 0x12, 0xC0, 0xC0, 0x13, 0xDA, 0x3A,
+	0x11, 0x56, 0xE0, 0x13, 0x56, 0x1E, 0x11, 0x00, 0x85, 0x12, 0x0D, 0x84, 0x11, 0x4F, 0x28, 0x13, 0x4F, 0x1D, 0x12, 0x56, 0x56, 0x13, 0x51, 0x04, 0x11, 0x00, 0xC7, 0x12, 0x0D, 0x85,
+	0x13, 0x28, 0x1D, 0x12, 0x56, 0x56, 0x13, 0x56, 0xC6, 0x11, 0x00, 0x03, 0x11, 0x00, 0x28, 0x12, 0x97, 0x97, 0x12, 0x6B, 0x6B, 0x11, 0x00, 0xE1, 0x13, 0x59, 0x59, 0x10, 0x00, 0x1E,
+	0x12, 0xC0, 0x68, 0x13, 0xD4, 0x3A, 0x13, 0xC0, 0x7E, 0x12, 0x00, 0x0A, 0x13, 0x00, 0x3A, 0x13, 0x00, 0x7E, 0x11, 0x00, 0xE2, 0x13, 0x00, 0xE3, 0x13, 0x00, 0xE4, 0x13, 0x05, 0x0A,
+	0x13, 0x05, 0x4D, 0x13, 0x05, 0x0A, 0x13, 0xC9, 0xCD, 0x13, 0xC9, 0x1D, 0x13, 0xC9, 0xE5, 0x12, 0x28, 0x41, 0x10, 0x00, 0x28, 0x13, 0x68, 0xBF, 0x11, 0xC0, 0x0A, 0x12, 0x51, 0x51,
+	0x11, 0x00, 0x0E, 0x12, 0xC7, 0x0D, 0x11, 0x00, 0x68, 0x13, 0x6B, 0x6B, 0x0F, 0x00, 0xB0, 0x11, 0x00, 0xE6, 0x11, 0x00, 0xC7, 0x0F, 0x00, 0xE7, 0x13, 0xD4, 0x11, 0x12, 0x00, 0x51,
+	0x11, 0x00, 0xE8, 0x11, 0x00, 0x0E, 0x12, 0x00, 0x0D, 0x13, 0xE9, 0x52, 0x12, 0x6B, 0xEA, 0x11, 0x00, 0x28, 0x12, 0x00, 0x5E, 0x13, 0x21, 0x1E, 0x10, 0x00, 0xA5, 0x11, 0x05, 0x56,
+	0x13, 0xEB, 0x1D, 0x13, 0xE9, 0xEC, 0x13, 0x68, 0x1D, 0x13, 0x00, 0x39, 0x0B, 0x00, 0x37, 0x12, 0x51, 0x51, 0x0F, 0x00, 0xCD, 0x10, 0x00, 0x41, 0x10, 0x00, 0xED,
+
+	// Glyph offsets (2 bytes each, little endian)
+	0x00, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x15, 0x00, 0x33, 0x00, 0x58, 0x00, 0x88, 0x00, 0xB2, 0x00, 0xB5, 0x00, 0xC1, 0x00, 0xCF, 0x00, 0xDC, 0x00, 0xE9, 0x00, 0xEE, 0x00, 0xF4, 0x00, 0xF7, 0x00,
+	0x04, 0x01, 0x18, 0x01, 0x2A, 0x01, 0x4E, 0x01, 0x69, 0x01, 0x83, 0x01, 0x9D, 0x01, 0xB8, 0x01, 0xD1, 0x01, 0xEE, 0x01, 0x0A, 0x02, 0x0E, 0x02, 0x15, 0x02, 0x2E, 0x02, 0x3A, 0x02, 0x53, 0x02,
+	0x6F, 0x02, 0xAF, 0x02, 0xD0, 0x02, 0xE8, 0x02, 0x07, 0x03, 0x1E, 0x03, 0x2F, 0x03, 0x3C, 0x03, 0x61, 0x03, 0x6E, 0x03, 0x71, 0x03, 0x85, 0x03, 0xA0, 0x03, 0xAC, 0x03, 0xC8, 0x03, 0xDC, 0x03,
+	0xFC, 0x03, 0x0E, 0x04, 0x33, 0x04, 0x4F, 0x04, 0x72, 0x04, 0x83, 0x04, 0x99, 0x04, 0xB5, 0x04, 0xDC, 0x04, 0xFE, 0x04, 0x17, 0x05, 0x3E, 0x05, 0x45, 0x05, 0x52, 0x05, 0x59, 0x05, 0x68, 0x05,
+	0x75, 0x05, 0x7F, 0x05, 0x9B, 0x05, 0xAD, 0x05, 0xBE, 0x05, 0xD0, 0x05, 0xE9, 0x05, 0xF4, 0x05, 0x0B, 0x06, 0x1A, 0x06, 0x1E, 0x06, 0x25, 0x06, 0x3A, 0x06, 0x3D, 0x06, 0x55, 0x06, 0x64, 0x06,
+	0x78, 0x06, 0x89, 0x06, 0x9A, 0x06, 0xA3, 0x06, 0xBD, 0x06, 0xC7, 0x06, 0xD7, 0x06, 0xED, 0x06, 0x0B, 0x07, 0x20, 0x07, 0x37, 0x07, 0x4E, 0x07, 0x5D, 0x07, 0x60, 0x07, 0x6F, 0x07, 0x7E, 0x07,
+	0x87, 0x07, 0x8A, 0x07, 0xA8, 0x07, 0xBE, 0x07, 0xDC, 0x07, 0xF2, 0x07, 0x0E, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08,
+	0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08,
+	0x2A, 0x08, 0x2C, 0x08, 0x30, 0x08, 0x49, 0x08, 0x67, 0x08, 0x7B, 0x08, 0xA2, 0x08, 0xA5, 0x08, 0xCE, 0x08, 0xD9, 0x08, 0x09, 0x09, 0x1B, 0x09, 0x35, 0x09, 0xEE, 0x00, 0x41, 0x09, 0x71, 0x09,
+	0x7F, 0x09, 0x8D, 0x09, 0x9D, 0x09, 0xB1, 0x09, 0xC2, 0x09, 0xCE, 0x09, 0xE0, 0x09, 0xF3, 0x09, 0xF6, 0x09, 0xFE, 0x09, 0x0A, 0x0A, 0x1A, 0x0A, 0x34, 0x0A, 0x5D, 0x0A, 0x8E, 0x0A, 0xBC, 0x0A,
+	0xDA, 0x0A, 0xFE, 0x0A, 0x22, 0x0B, 0x48, 0x0B, 0x70, 0x0B, 0x95, 0x0B, 0xB9, 0x0B, 0xDE, 0x0B, 0x04, 0x0C, 0x20, 0x0C, 0x3C, 0x0C, 0x64, 0x0C, 0x80, 0x0C, 0x89, 0x0C, 0x92, 0x0C, 0xA1, 0x0C,
+	0xAE, 0x0C, 0xCB, 0x0C, 0xE6, 0x0C, 0x0C, 0x0D, 0x32, 0x0D, 0x5D, 0x0D, 0x87, 0x0D, 0xAD, 0x0D, 0xC2, 0x0D, 0xF0, 0x0D, 0x0A, 0x0E, 0x24, 0x0E, 0x41, 0x0E, 0x5C, 0x0E, 0x79, 0x0E, 0x8B, 0x0E,
+	0xAD, 0x0E, 0xD3, 0x0E, 0xF9, 0x0E, 0x22, 0x0F, 0x47, 0x0F, 0x6A, 0x0F, 0x8D, 0x0F, 0xBD, 0x0F, 0xD5, 0x0F, 0xF7, 0x0F, 0x1D, 0x10, 0x46, 0x10, 0x69, 0x10, 0x75, 0x10, 0x81, 0x10, 0x96, 0x10,
+	0xA1, 0x10, 0xC1, 0x10, 0xDA, 0x10, 0xF8, 0x10, 0x16, 0x11, 0x37, 0x11, 0x55, 0x11, 0x71, 0x11, 0x80, 0x11, 0xA0, 0x11, 0xB5, 0x11, 0xCA, 0x11, 0xE3, 0x11, 0xF8, 0x11, 0x13, 0x12, 0x28, 0x12,
+	0x43, 0x12, 0x69, 0x12, 0x86, 0x12, 0xAC, 0x12, 0xCD, 0x12, 0xEE, 0x12, 0x07, 0x13, 0x2A, 0x13, 0x45, 0x13, 0x6C, 0x13, 0x87, 0x13, 0xA8, 0x13, 0xBF, 0x13, 0xE6, 0x13, 0x01, 0x14, 0x25, 0x14,
+	0x40, 0x14, 0x5A, 0x14, 0x74, 0x14, 0x8E, 0x14, 0xAB, 0x14, 0xCD, 0x14, 0xEA, 0x14, 0x04, 0x15, 0x22, 0x15, 0x3A, 0x15, 0x59, 0x15, 0x83, 0x15, 0xA5, 0x15, 0xD5, 0x15, 0xF3, 0x15, 0x1F, 0x16,
+	0x39, 0x16, 0x63, 0x16, 0x7D, 0x16, 0xA7, 0x16, 0xC5, 0x16, 0xDF, 0x16, 0xF5, 0x16, 0x08, 0x17, 0x1B, 0x17, 0x2D, 0x17, 0x3B, 0x17, 0x46, 0x17, 0x4F, 0x17, 0x5E, 0x17, 0x6C, 0x17, 0x75, 0x17,
+	0x7E, 0x17, 0x85, 0x17, 0x8B, 0x17, 0xA5, 0x17, 0xB4, 0x17, 0xCF, 0x17, 0xDB, 0x17, 0xFA, 0x17, 0x11, 0x18, 0x28, 0x18, 0x3C, 0x18, 0x47, 0x18, 0x5D, 0x18, 0x65, 0x18, 0x7A, 0x18, 0x86, 0x18,
+	0x98, 0x18, 0xA2, 0x18, 0xB7, 0x18, 0xBE, 0x18, 0xD8, 0x18, 0xEC, 0x18, 0x04, 0x19, 0x17, 0x19, 0x33, 0x19, 0x49, 0x19, 0x5B, 0x19, 0x76, 0x19, 0x86, 0x19, 0xA4, 0x19, 0xBC, 0x19, 0xE0, 0x19,
+	0xF8, 0x19, 0x25, 0x1A, 0x46, 0x1A, 0x67, 0x1A, 0x8F, 0x1A, 0xB3, 0x1A, 0xC1, 0x1A, 0xE3, 0x1A, 0xF0, 0x1A, 0x17, 0x1B, 0x2B, 0x1B, 0x57, 0x1B, 0x76, 0x1B, 0xA1, 0x1B, 0xC6, 0x1B, 0xEF, 0x1B,
+	0x0E, 0x1C, 0x39, 0x1C, 0x5E, 0x1C, 0x71, 0x1C, 0x7D, 0x1C, 0x9B, 0x1C, 0xAA, 0x1C, 0xBF, 0x1C, 0xCB, 0x1C, 0xE7, 0x1C, 0xFE, 0x1C, 0x17, 0x1D, 0x29, 0x1D, 0x42, 0x1D, 0x57, 0x1D, 0x72, 0x1D,
+	0x8B, 0x1D, 0xAB, 0x1D, 0xC7, 0x1D, 0xE1, 0x1D, 0xF2, 0x1D, 0x20, 0x1E, 0x41, 0x1E, 0x5B, 0x1E, 0x74, 0x1E, 0x8D, 0x1E, 0xB7, 0x1E, 0xD4, 0x1E, 0xFC, 0x1E, 0x18, 0x1F, 0x44, 0x1F, 0x64, 0x1F,
+	0x6E, 0x1F, 0x8C, 0x1F, 0xAD, 0x1F, 0xC9, 0x1F, 0xEA, 0x1F, 0x0B, 0x20, 0x11, 0x20, 0x1C, 0x20, 0x30, 0x20, 0x53, 0x20, 0x6F, 0x20, 0x85, 0x20, 0xA1, 0x20, 0xB3, 0x20, 0xD8, 0x20, 0xED, 0x20,
+	0x0B, 0x21, 0x21, 0x21, 0x3B, 0x21, 0x49, 0x21, 0x60, 0x21, 0x73, 0x21, 0x9C, 0x21, 0xB7, 0x21, 0xCE, 0x21, 0xEC, 0x21, 0x03, 0x22, 0x17, 0x22, 0x2F, 0x22, 0x3F, 0x22, 0x5C, 0x22, 0x6D, 0x22,
+	0x81, 0x22, 0x9D, 0x22, 0xAE, 0x22, 0xCC, 0x22, 0xE7, 0x22, 0x0B, 0x23, 0x1F, 0x23, 0x31, 0x23, 0x49, 0x23, 0x64, 0x23, 0x7C, 0x23, 0x96, 0x23, 0xAA, 0x23, 0xCB, 0x23, 0xEE, 0x23, 0x0C, 0x24,
+	0x28, 0x24, 0x46, 0x24, 0x58, 0x24, 0x62, 0x24, 0x77, 0x24, 0x91, 0x24, 0xB2, 0x24, 0xCC, 0x24, 0xDC, 0x24, 0xF5, 0x24, 0x07, 0x25, 0x17, 0x25, 0x2E, 0x25, 0x3B, 0x25, 0x50, 0x25, 0x5C, 0x25,
+	0x6F, 0x25, 0x85, 0x25, 0x90, 0x25, 0xA2, 0x25, 0xC3, 0x25, 0xDB, 0x25, 0xEC, 0x25, 0xFA, 0x25, 0x0F, 0x26, 0x27, 0x26, 0x3A, 0x26, 0x51, 0x26, 0x63, 0x26, 0x7B, 0x26, 0x95, 0x26, 0xA1, 0x20,
+	0xA9, 0x26, 0xCD, 0x26, 0xDF, 0x26, 0xF0, 0x26, 0x08, 0x27, 0x23, 0x27, 0x29, 0x27, 0x35, 0x27, 0x3C, 0x27, 0x58, 0x27, 0x70, 0x27, 0x83, 0x27, 0xA1, 0x20, 0x99, 0x27, 0xB2, 0x27, 0xA1, 0x20,
+	0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20,
+	0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20,
+	0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC3, 0x27, 0xC3, 0x27, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC5, 0x27,
+	0xD4, 0x27, 0xE0, 0x27, 0x1F, 0x28, 0x54, 0x28, 0x91, 0x28, 0xB1, 0x28, 0xD7, 0x28, 0xFF, 0x28, 0x2D, 0x29, 0x60, 0x29, 0x9A, 0x29, 0xCC, 0x29, 0x06, 0x2A, 0x37, 0x2A, 0x6B, 0x2A, 0xA7, 0x2A,
+	0xEA, 0x2A, 0x0D, 0x2B, 0x38, 0x2B, 0x5F, 0x2B, 0x8D, 0x2B, 0xA6, 0x2B, 0xC9, 0x2B, 0xFB, 0x2B, 0x33, 0x2C, 0x56, 0x2C, 0x7D, 0x2C, 0xA8, 0x2C, 0xDC, 0x2C, 0x03, 0x2D, 0x34, 0x2D, 0x6B, 0x2D,
+	0xAA, 0x2D, 0xD6, 0x2D, 0x0E, 0x2E, 0x3C, 0x2E, 0x73, 0x2E, 0x96, 0x2E, 0xBD, 0x2E, 0xEC, 0x2E, 0x12, 0x2F, 0x44, 0x2F, 0x71, 0x2F, 0xA5, 0x2F, 0xDB, 0x2F, 0xFE, 0x2F, 0x36, 0x30, 0x69, 0x30,
+	0x9A, 0x30, 0xCD, 0x30, 0x02, 0x31, 0x39, 0x31, 0x6C, 0x31, 0x9E, 0x31, 0xD2, 0x31, 0x08, 0x32, 0x3F, 0x32, 0x7A, 0x32, 0xA1, 0x32, 0xCF, 0x32, 0xFD, 0x32, 0x30, 0x33, 0x63, 0x33, 0x97, 0x33,
+	0xC7, 0x33, 0xFD, 0x33, 0x31, 0x34, 0x65, 0x34, 0x91, 0x34, 0xBA, 0x34, 0xE8, 0x34, 0x12, 0x35, 0x41, 0x35, 0x65, 0x35, 0x8F, 0x35, 0xC0, 0x35, 0xE5, 0x35, 0x22, 0x36, 0x50, 0x36, 0x87, 0x36,
+	0xB0, 0x36, 0xE1, 0x36, 0x1D, 0x37, 0x65, 0x37, 0xA6, 0x37, 0xD2, 0x37, 0x0A, 0x38, 0x35, 0x38, 0xE0, 0x27, 0xE0, 0x27, 0x2A, 0x08, 0x2A, 0x08, 0x54, 0x38, 0x62, 0x38, 0x69, 0x38, 0x87, 0x38,
+	0xAC, 0x38, 0xDE, 0x38, 0xEF, 0x38, 0x19, 0x39, 0x47, 0x39, 0x60, 0x39, 0x82, 0x39, 0xA7, 0x39, 0xCF, 0x39, 0xE7, 0x39, 0x02, 0x3A, 0x25, 0x3A, 0x52, 0x3A, 0x7A, 0x3A, 0xAA, 0x3A, 0xD5, 0x3A,
+	0x06, 0x3B, 0x34, 0x3B, 0x6C, 0x3B, 0x94, 0x3B, 0xC5, 0x3B, 0xDC, 0x3B, 0xFE, 0x3B, 0x1E, 0x3C, 0x48, 0x3C, 0x75, 0x3C, 0xAB, 0x3C, 0xDF, 0x3C, 0x16, 0x3D, 0x42, 0x3D, 0x77, 0x3D, 0x9B, 0x3D,
+	0xCA, 0x3D, 0xFE, 0x3D, 0x3A, 0x3E, 0x6A, 0x3E, 0xA1, 0x3E, 0xC6, 0x3E, 0xEF, 0x3E, 0x1E, 0x3F, 0x49, 0x3F, 0x7D, 0x3F, 0x97, 0x3F, 0xB9, 0x3F, 0xDA, 0x3F, 0xF3, 0x3F, 0x27, 0x40, 0x58, 0x40,
+	0x7A, 0x40, 0x9E, 0x40, 0xC9, 0x40, 0xF6, 0x40, 0x20, 0x41, 0x52, 0x41, 0x7F, 0x41, 0xA6, 0x41, 0xD5, 0x41, 0x00, 0x42, 0x26, 0x42, 0x53, 0x42, 0x81, 0x42, 0xAF, 0x42, 0xE3, 0x42, 0x17, 0x43,
+	0x47, 0x43, 0x7A, 0x43, 0xA7, 0x43, 0xD6, 0x43, 0xF6, 0x43, 0x1B, 0x44, 0x47, 0x44, 0x62, 0x44, 0x82, 0x44, 0x97, 0x44, 0xAE, 0x44, 0xDE, 0x44, 0xFB, 0x44, 0x21, 0x45, 0x44, 0x45, 0x5A, 0x45,
+	0x7D, 0x45, 0xA6, 0x45, 0xC4, 0x45, 0xED, 0x45, 0x20, 0x46, 0x4B, 0x46, 0x7D, 0x46, 0xA0, 0x46, 0xC3, 0x46, 0xF3, 0x46, 0x1B, 0x47, 0x4A, 0x47, 0x84, 0x47, 0x94, 0x47, 0xA8, 0x47, 0xC2, 0x47,
+	0xE2, 0x47,
+
+	// Glyphs
+	0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x22, 0x04, 0x00, 0x53, 0x0D, 0x00, 0x0F, 0x06, 0x33, 0x0F, 0x53, 0x0D, 0x1C, 0x08, 0x17, 0x14, 0x08, 0x17, 0x54, 0x04, 0x67, 0x08, 0x53,
+	0x14, 0x08, 0x17, 0x14, 0x08, 0x00, 0x17, 0x54, 0x04, 0x67, 0x08, 0x53, 0x14, 0x08, 0x17, 0x14, 0x08, 0x17, 0x0D, 0x1D, 0x07, 0x35, 0x35, 0x05, 0x54, 0x25, 0x05, 0x23, 0x23, 0x25, 0x04, 0x13,
+	0x15, 0x16, 0x04, 0xF1, 0x30, 0x02, 0x00, 0x13, 0x25, 0x15, 0x04, 0x23, 0x15, 0x15, 0x04, 0x24, 0x24, 0x13, 0x05, 0x15, 0x55, 0x05, 0x2C, 0x07, 0x64, 0x0B, 0x23, 0x24, 0x0A, 0x13, 0x16, 0x0A,
+	0x13, 0x16, 0x15, 0x04, 0x23, 0x24, 0x24, 0x04, 0x64, 0x33, 0x05, 0x2C, 0x07, 0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x26, 0x0D, 0x34, 0x63, 0x05, 0x23, 0x24, 0x24, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x19, 0x16, 0x04, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x5B, 0x05, 0x3A, 0x21, 0x05, 0x25, 0x22, 0x24, 0x04, 0x64, 0x16, 0x04, 0x23, 0x33, 0x15, 0x04, 0x13, 0x14, 0x31, 0x13, 0x04, 0x13, 0x14, 0x32,
+	0x21, 0x04, 0x23, 0x12, 0x35, 0x05, 0x44, 0x35, 0x05, 0x5C, 0x04, 0x3A, 0x13, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x53, 0x0D, 0x00, 0x59, 0x07, 0xB6, 0x04, 0x44, 0x47, 0x02, 0x23, 0x2D, 0x01, 0x22,
+	0x2F, 0x0F, 0x06, 0x22, 0x2F, 0x23, 0x2D, 0x01, 0x44, 0x47, 0x02, 0xB6, 0x04, 0x59, 0x07, 0x15, 0x0F, 0x16, 0x21, 0x0B, 0x53, 0x0D, 0x00, 0x16, 0x21, 0x0B, 0x15, 0x0F, 0x19, 0x0B, 0x00, 0x00,
+	0x00, 0x95, 0x07, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x2F, 0x12, 0x01, 0x4F, 0x02, 0x2B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x2F, 0x04, 0x5C, 0x04, 0x68, 0x07, 0x65, 0x0A, 0x52,
+	0x0E, 0x22, 0x0F, 0x02, 0x86, 0x07, 0xC4, 0x05, 0x14, 0x1A, 0x05, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x14, 0x1A, 0x05, 0xC4, 0x05, 0x86, 0x07, 0x25, 0x19, 0x04, 0x24, 0x1A, 0x04, 0x14, 0x1B,
+	0x04, 0xE3, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x16, 0x28, 0x04, 0x34, 0x37, 0x04, 0x14, 0x28, 0x11, 0x04, 0x13, 0x28, 0x12, 0x04, 0x13, 0x27, 0x13, 0x04, 0x13, 0x17, 0x14, 0x04,
+	0x13, 0x26, 0x14, 0x04, 0x23, 0x33, 0x15, 0x04, 0x64, 0x16, 0x04, 0x26, 0x18, 0x04, 0x25, 0x26, 0x06, 0x34, 0x36, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x23, 0x13,
+	0x11, 0x24, 0x04, 0x54, 0x61, 0x05, 0x25, 0x44, 0x06, 0x1C, 0x08, 0x3A, 0x08, 0x49, 0x08, 0x28, 0x12, 0x08, 0x27, 0x13, 0x08, 0x35, 0x14, 0x08, 0x34, 0x15, 0x08, 0x23, 0x17, 0x08, 0xE3, 0x04,
+	0x1C, 0x08, 0x00, 0x37, 0x23, 0x06, 0x73, 0x33, 0x05, 0x13, 0x15, 0x25, 0x04, 0x13, 0x14, 0x17, 0x04, 0x00, 0x00, 0x00, 0x13, 0x24, 0x25, 0x04, 0x13, 0x75, 0x05, 0x5A, 0x06, 0x67, 0x08, 0xA5,
+	0x06, 0x24, 0x13, 0x24, 0x05, 0x23, 0x13, 0x26, 0x04, 0x13, 0x14, 0x17, 0x04, 0x00, 0x00, 0x23, 0x23, 0x25, 0x04, 0x24, 0x73, 0x05, 0x5A, 0x06, 0x13, 0x0F, 0x02, 0x00, 0x00, 0x13, 0x49, 0x04,
+	0x13, 0x76, 0x04, 0x13, 0x44, 0x09, 0x13, 0x42, 0x0B, 0x13, 0x31, 0x0D, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0x35, 0x43, 0x06, 0x54, 0x61, 0x05, 0x23, 0x13, 0x11, 0x24, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x00, 0x00, 0x00, 0x23, 0x13, 0x11, 0x24, 0x04, 0x54, 0x61, 0x05, 0x35, 0x43, 0x06, 0x55, 0x14, 0x06, 0x74, 0x23, 0x05, 0x23, 0x25, 0x23, 0x04, 0x13, 0x17, 0x14, 0x04, 0x00, 0x00, 0x13, 0x17,
+	0x23, 0x04, 0x24, 0x14, 0x23, 0x05, 0xB4, 0x06, 0x76, 0x08, 0x26, 0x27, 0x04, 0x00, 0x26, 0x27, 0x12, 0x01, 0x26, 0x47, 0x02, 0x38, 0x0A, 0x18, 0x11, 0x0A, 0x27, 0x21, 0x09, 0x00, 0x26, 0x23,
+	0x08, 0x00, 0x16, 0x15, 0x08, 0x25, 0x25, 0x07, 0x15, 0x17, 0x07, 0x24, 0x27, 0x06, 0x17, 0x14, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x27, 0x06, 0x15, 0x17, 0x07,
+	0x25, 0x25, 0x07, 0x16, 0x15, 0x08, 0x26, 0x23, 0x08, 0x00, 0x27, 0x21, 0x09, 0x00, 0x18, 0x11, 0x0A, 0x38, 0x0A, 0x25, 0x0E, 0x34, 0x0E, 0x14, 0x0F, 0x01, 0x13, 0x0F, 0x02, 0x13, 0x27, 0x22,
+	0x04, 0x13, 0x36, 0x22, 0x04, 0x13, 0x25, 0x0A, 0x23, 0x14, 0x0B, 0x64, 0x0B, 0x45, 0x0C, 0x88, 0x05, 0x36, 0x36, 0x03, 0x25, 0x1A, 0x03, 0x14, 0x26, 0x15, 0x02, 0x23, 0x73, 0x23, 0x01, 0x13,
+	0x33, 0x24, 0x13, 0x01, 0x12, 0x23, 0x17, 0x13, 0x01, 0x12, 0x13, 0x18, 0x13, 0x01, 0x00, 0x12, 0x13, 0x17, 0x14, 0x01, 0x12, 0x14, 0x24, 0x15, 0x01, 0x12, 0x85, 0x12, 0x02, 0x22, 0x52, 0x14,
+	0x12, 0x02, 0x13, 0x12, 0x18, 0x21, 0x02, 0x23, 0x29, 0x05, 0x34, 0x35, 0x06, 0x76, 0x08, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x43, 0x14, 0x09, 0x23, 0x16,
+	0x09, 0x43, 0x14, 0x09, 0x55, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x16, 0x04, 0x54,
+	0x11, 0x14, 0x05, 0x44, 0x62, 0x05, 0x4B, 0x06, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x29, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x24, 0x19,
+	0x05, 0x34, 0x36, 0x05, 0x25, 0x26, 0x06, 0xE3, 0x04, 0x00, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x29, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04,
+	0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x08, 0xA5, 0x06,
+	0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13, 0x16, 0x15, 0x04, 0x00, 0x23, 0x15, 0x15, 0x04, 0x24, 0x14, 0x14, 0x05, 0x34, 0x13, 0x23, 0x05, 0x25, 0x53,
+	0x06, 0xE3, 0x04, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x00, 0xE3, 0x04, 0x00, 0x1D, 0x07, 0x3D, 0x05, 0x3E, 0x04, 0x0F, 0x11, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13, 0x2B,
+	0x04, 0xD3, 0x05, 0xC3, 0x06, 0xE3, 0x04, 0x00, 0x29, 0x0A, 0x28, 0x0B, 0x47, 0x0A, 0x26, 0x32, 0x08, 0x25, 0x34, 0x07, 0x24, 0x36, 0x06, 0x23, 0x38, 0x05, 0x13, 0x3A, 0x04, 0x0F, 0x11, 0x04,
+	0xE3, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x23, 0x0F, 0x01, 0x44, 0x0D, 0x56, 0x0A, 0x49, 0x08, 0x5B, 0x05, 0x2F, 0x04, 0x4C, 0x05, 0x59, 0x07, 0x47,
+	0x0A, 0x44, 0x0D, 0x23, 0x0F, 0x01, 0xE3, 0x04, 0xE3, 0x04, 0x33, 0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x38, 0x0A, 0x49, 0x08, 0x3B, 0x07, 0x3D, 0x05, 0x3E, 0x04, 0xE3, 0x04, 0x67, 0x08, 0xA5, 0x06,
+	0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x00, 0x13,
+	0x16, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x0A, 0x64, 0x0B, 0x45, 0x0C, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13,
+	0x4C, 0x01, 0x13, 0x1C, 0x21, 0x01, 0x23, 0x2A, 0x22, 0x14, 0x1A, 0x14, 0x34, 0x36, 0x14, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x00, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x00, 0x13, 0x26, 0x09, 0x13,
+	0x36, 0x08, 0x23, 0x24, 0x31, 0x06, 0x64, 0x43, 0x04, 0x64, 0x25, 0x04, 0x0F, 0x11, 0x04, 0x2D, 0x06, 0x54, 0x34, 0x05, 0x54, 0x16, 0x05, 0x23, 0x23, 0x25, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00,
+	0x13, 0x25, 0x15, 0x04, 0x00, 0x23, 0x15, 0x15, 0x04, 0x24, 0x24, 0x13, 0x05, 0x34, 0x63, 0x05, 0x4B, 0x06, 0x13, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x0F, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x2F, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x13, 0x0F, 0x02, 0x43, 0x0E, 0x54, 0x0C,
+	0x57, 0x09, 0x59, 0x07, 0x5C, 0x04, 0x2F, 0x04, 0x5C, 0x04, 0x59, 0x07, 0x57, 0x09, 0x54, 0x0C, 0x43, 0x0E, 0x13, 0x0F, 0x02, 0x43, 0x0E, 0x64, 0x0B, 0x67, 0x08, 0x6A, 0x05, 0x3E, 0x04, 0x4D,
+	0x04, 0x5A, 0x06, 0x66, 0x09, 0x63, 0x0C, 0x23, 0x0F, 0x01, 0x63, 0x0C, 0x66, 0x09, 0x5A, 0x06, 0x4D, 0x04, 0x3E, 0x04, 0x6B, 0x04, 0x77, 0x07, 0x64, 0x0B, 0x43, 0x0E, 0x13, 0x1C, 0x04, 0x23,
+	0x39, 0x04, 0x24, 0x37, 0x05, 0x35, 0x24, 0x07, 0x36, 0x31, 0x08, 0x48, 0x09, 0x38, 0x0A, 0x36, 0x31, 0x08, 0x35, 0x33, 0x07, 0x34, 0x36, 0x05, 0x23, 0x39, 0x04, 0x13, 0x1C, 0x04, 0x23, 0x0F,
+	0x01, 0x33, 0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x89, 0x04, 0x00, 0x37, 0x0B, 0x36, 0x0C, 0x34, 0x0E, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0x13, 0x2B, 0x04, 0x13, 0x3A, 0x04, 0x13, 0x38, 0x11,
+	0x04, 0x13, 0x37, 0x12, 0x04, 0x13, 0x26, 0x14, 0x04, 0x13, 0x34, 0x15, 0x04, 0x13, 0x33, 0x16, 0x04, 0x13, 0x22, 0x18, 0x04, 0x43, 0x19, 0x04, 0x33, 0x1A, 0x04, 0x13, 0x1C, 0x04, 0xF2, 0x40,
+	0x12, 0x0F, 0x12, 0x00, 0x00, 0x22, 0x0F, 0x02, 0x52, 0x0E, 0x65, 0x0A, 0x68, 0x07, 0x5C, 0x04, 0x2F, 0x04, 0x12, 0x0F, 0x12, 0x00, 0x00, 0xF2, 0x40, 0x1A, 0x0A, 0x47, 0x0A, 0x54, 0x0C, 0x33,
+	0x0F, 0x00, 0x54, 0x0C, 0x47, 0x0A, 0x1A, 0x0A, 0x0F, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0F, 0x03, 0x00, 0x22, 0x0F, 0x02, 0x14, 0x0F, 0x01, 0x18,
+	0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x00, 0x16, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0xF2, 0x04, 0x00, 0x27, 0x25,
+	0x05, 0x16, 0x19, 0x04, 0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x59, 0x07, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x00, 0x27, 0x25, 0x05, 0x00, 0x78, 0x06,
+	0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x27, 0x25, 0x05, 0xF2, 0x04, 0x00, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x16, 0x14, 0x14, 0x04, 0x00, 0x00, 0x00, 0x26,
+	0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x16, 0x0E, 0x00, 0xE3, 0x04, 0xF2, 0x04, 0x12, 0x13, 0x0E, 0x00, 0x78, 0x13, 0x02, 0x97, 0x22, 0x01, 0x26, 0x27, 0x22, 0x16, 0x19, 0x13,
+	0x00, 0x16, 0x18, 0x14, 0x27, 0x15, 0x24, 0xE6, 0x01, 0xC6, 0x03, 0xF2, 0x04, 0x00, 0x27, 0x0C, 0x16, 0x0E, 0x00, 0x00, 0x26, 0x0D, 0xA7, 0x04, 0x98, 0x04, 0x22, 0xB2, 0x04, 0x00, 0x0F, 0x15,
+	0x22, 0xF2, 0x22, 0xE2, 0x01, 0xF2, 0x04, 0x00, 0x2B, 0x08, 0x2A, 0x09, 0x59, 0x07, 0x37, 0x32, 0x06, 0x36, 0x34, 0x05, 0x16, 0x28, 0x04, 0x0F, 0x11, 0x04, 0xF2, 0x04, 0x00, 0xB6, 0x04, 0x00,
+	0x17, 0x0D, 0x16, 0x0E, 0x00, 0x00, 0xB6, 0x04, 0xA7, 0x04, 0x17, 0x0D, 0x16, 0x0E, 0x00, 0x26, 0x0D, 0xB6, 0x04, 0x98, 0x04, 0xB6, 0x04, 0x00, 0x27, 0x0C, 0x16, 0x0E, 0x00, 0x00, 0x26, 0x0D,
+	0xB6, 0x04, 0x98, 0x04, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0xF6, 0x00, 0x27, 0x25, 0x05, 0x16, 0x19, 0x04,
+	0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x27, 0x25, 0x05, 0xF6, 0x00, 0xB6, 0x04, 0x00, 0x28, 0x0B, 0x26,
+	0x0D, 0x00, 0x00, 0x37, 0x24, 0x05, 0x47, 0x14, 0x05, 0x16, 0x23, 0x14, 0x04, 0x00, 0x00, 0x16, 0x14, 0x14, 0x04, 0x26, 0x23, 0x13, 0x04, 0x27, 0x52, 0x05, 0x27, 0x43, 0x05, 0x16, 0x0E, 0x00,
+	0xD4, 0x04, 0x00, 0x16, 0x19, 0x04, 0x00, 0x96, 0x06, 0xA6, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x2E, 0x05, 0xB6, 0x04, 0x00, 0x16, 0x0E, 0x46, 0x0B, 0x57, 0x09, 0x5A, 0x06, 0x4D,
+	0x04, 0x2F, 0x04, 0x5C, 0x04, 0x5A, 0x06, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0x26, 0x0D, 0x66, 0x09, 0x69, 0x06, 0x4D, 0x04, 0x3E, 0x04, 0x6A, 0x05, 0x66, 0x09, 0x26, 0x0D, 0x66, 0x09, 0x6A,
+	0x05, 0x3E, 0x04, 0x4D, 0x04, 0x69, 0x06, 0x56, 0x0A, 0x26, 0x0D, 0x26, 0x27, 0x04, 0x36, 0x35, 0x04, 0x38, 0x31, 0x06, 0x49, 0x08, 0x00, 0x38, 0x31, 0x06, 0x36, 0x35, 0x04, 0x26, 0x27, 0x04,
+	0x16, 0x0E, 0x36, 0x1B, 0x57, 0x18, 0x4A, 0x25, 0x4C, 0x31, 0x01, 0x4F, 0x02, 0x4D, 0x04, 0x4A, 0x07, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0x16, 0x28, 0x04, 0x16, 0x46, 0x04, 0x16, 0x44, 0x11,
+	0x04, 0x16, 0x42, 0x13, 0x04, 0x56, 0x15, 0x04, 0x46, 0x16, 0x04, 0x26, 0x18, 0x04, 0x1B, 0x09, 0x00, 0x29, 0x21, 0x07, 0x83, 0x81, 0x01, 0x22, 0x2F, 0x12, 0x0F, 0x12, 0x00, 0xF2, 0x40, 0x00,
+	0x12, 0x0F, 0x12, 0x00, 0x22, 0x2F, 0x83, 0x81, 0x01, 0x29, 0x21, 0x07, 0x1B, 0x09, 0x00, 0x19, 0x0B, 0x18, 0x0C, 0x00, 0x00, 0x19, 0x0B, 0x00, 0x1A, 0x0A, 0x00, 0x00, 0x19, 0x0B, 0xE2, 0x05,
+	0x12, 0x1C, 0x05, 0x00, 0x00, 0xE2, 0x05, 0x0F, 0x06, 0x00, 0x2A, 0x09, 0x49, 0x08, 0x68, 0x07, 0x87, 0x06, 0x36, 0x21, 0x31, 0x05, 0x16, 0x23, 0x13, 0x05, 0x2A, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x0E, 0x24, 0x0F, 0x33, 0x0F, 0x32, 0x0F, 0x01, 0xF1, 0x40, 0x01, 0x00, 0x32, 0x0F, 0x01, 0x33, 0x0F, 0x34, 0x0E, 0x25, 0x0E, 0x2A, 0x09,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x23, 0x13, 0x05, 0x36, 0x21, 0x31, 0x05, 0x87, 0x06, 0x68, 0x07, 0x49, 0x08, 0x2A, 0x09, 0x2E, 0x05, 0x2F, 0x04,
+	0x3F, 0x03, 0x0F, 0x31, 0x02, 0xF1, 0x40, 0x01, 0x00, 0x0F, 0x31, 0x02, 0x3F, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x26, 0x25, 0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x23, 0x2B, 0x03, 0xF2, 0x20,
+	0x02, 0x00, 0x23, 0x2B, 0x03, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x26, 0x25, 0x06, 0x23, 0x2B, 0x03, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x26, 0x25, 0x06, 0x81, 0x83, 0x01, 0x00, 0x26, 0x25,
+	0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x23, 0x2B, 0x03, 0x0F, 0x06, 0x26, 0xA2, 0x01, 0x00, 0x29, 0x0A, 0x86, 0x07, 0x26, 0x24, 0x07, 0x15, 0x27, 0x06, 0x15, 0x18, 0x06, 0x33, 0x38, 0x04,
+	0x15, 0x18, 0x06, 0x25, 0x26, 0x06, 0x26, 0x33, 0x07, 0x19, 0x25, 0x04, 0x19, 0x43, 0x04, 0xB4, 0x11, 0x04, 0x33, 0x13, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x23, 0x14, 0x16, 0x04,
+	0x24, 0x29, 0x04, 0x2E, 0x05, 0x1E, 0x06, 0x1A, 0x0A, 0x96, 0x06, 0x27, 0x23, 0x07, 0x16, 0x17, 0x06, 0x00, 0x00, 0x00, 0x27, 0x23, 0x07, 0x96, 0x06, 0x39, 0x09, 0x13, 0x0F, 0x02, 0x23, 0x15,
+	0x12, 0x07, 0x34, 0x13, 0x12, 0x07, 0x45, 0x11, 0x12, 0x07, 0x47, 0x12, 0x07, 0x89, 0x04, 0x00, 0x47, 0x12, 0x07, 0x35, 0x12, 0x12, 0x07, 0x34, 0x13, 0x12, 0x07, 0x23, 0x15, 0x12, 0x07, 0x13,
+	0x0F, 0x02, 0x82, 0x83, 0x00, 0x0F, 0x11, 0x04, 0x43, 0x41, 0x24, 0x03, 0x52, 0x11, 0x22, 0x24, 0x02, 0x12, 0x23, 0x14, 0x15, 0x02, 0x12, 0x14, 0x14, 0x15, 0x02, 0x00, 0x12, 0x24, 0x23, 0x14,
+	0x02, 0x22, 0x23, 0x23, 0x23, 0x02, 0x23, 0x53, 0x41, 0x03, 0x14, 0x24, 0x24, 0x04, 0x22, 0x0F, 0x02, 0x00, 0x0F, 0x06, 0x00, 0x22, 0x0F, 0x02, 0x00, 0x48, 0x09, 0x26, 0x24, 0x07, 0x15, 0x18,
+	0x06, 0x14, 0x1A, 0x05, 0x14, 0x62, 0x12, 0x05, 0x13, 0x22, 0x24, 0x12, 0x04, 0x13, 0x12, 0x16, 0x12, 0x04, 0x00, 0x00, 0x13, 0x22, 0x24, 0x12, 0x04, 0x14, 0x12, 0x14, 0x12, 0x05, 0x14, 0x1A,
+	0x05, 0x15, 0x18, 0x06, 0x26, 0x24, 0x07, 0x48, 0x09, 0x37, 0x0B, 0x23, 0x51, 0x0A, 0x13, 0x12, 0x13, 0x0A, 0x00, 0x23, 0x11, 0x12, 0x0B, 0x74, 0x0A, 0x1A, 0x0A, 0x3A, 0x08, 0x59, 0x07, 0x28,
+	0x23, 0x06, 0x27, 0x25, 0x05, 0x17, 0x17, 0x05, 0x3A, 0x08, 0x59, 0x07, 0x28, 0x23, 0x06, 0x27, 0x25, 0x05, 0x17, 0x17, 0x05, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x06,
+	0x00, 0x48, 0x09, 0x26, 0x24, 0x07, 0x15, 0x18, 0x06, 0x14, 0x1A, 0x05, 0x00, 0x13, 0x82, 0x12, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x00, 0x13, 0x12, 0x33, 0x13, 0x04, 0x13, 0x52, 0x21, 0x12,
+	0x04, 0x14, 0x13, 0x14, 0x11, 0x05, 0x14, 0x1A, 0x05, 0x15, 0x18, 0x06, 0x26, 0x24, 0x07, 0x48, 0x09, 0x11, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+	0x0E, 0x23, 0x22, 0x0C, 0x13, 0x14, 0x0C, 0x00, 0x23, 0x22, 0x0C, 0x25, 0x0E, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x95, 0x12, 0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x24,
+	0x24, 0x09, 0x13, 0x15, 0x11, 0x09, 0x13, 0x14, 0x12, 0x09, 0x13, 0x23, 0x12, 0x09, 0x44, 0x13, 0x09, 0x14, 0x25, 0x09, 0x13, 0x17, 0x09, 0x13, 0x13, 0x13, 0x09, 0x13, 0x22, 0x13, 0x09, 0x34,
+	0x31, 0x0A, 0x14, 0x0F, 0x01, 0x13, 0x0F, 0x02, 0x22, 0x0F, 0x02, 0x12, 0x0F, 0x03, 0xF6, 0x00, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x2F, 0x04, 0x96, 0x06, 0xB6, 0x04, 0x0F, 0x11, 0x04, 0x00,
+	0x54, 0x0C, 0x73, 0x0B, 0x00, 0xF3, 0x20, 0x01, 0x00, 0x13, 0x0F, 0x02, 0x00, 0xF3, 0x20, 0x01, 0x13, 0x0F, 0x02, 0x29, 0x0A, 0x00, 0x0F, 0x22, 0x02, 0x0F, 0x13, 0x11, 0x0F, 0x24, 0x14, 0x16,
+	0x09, 0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x09, 0x00, 0x00, 0x45, 0x0C, 0x64, 0x0B, 0x23, 0x24, 0x0A, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x64, 0x0B, 0x45, 0x0C, 0x17, 0x17, 0x05, 0x27, 0x25, 0x05,
+	0x28, 0x23, 0x06, 0x59, 0x07, 0x3A, 0x08, 0x17, 0x17, 0x05, 0x27, 0x25, 0x05, 0x28, 0x23, 0x06, 0x59, 0x07, 0x3A, 0x08, 0x14, 0x16, 0x09, 0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x14, 0x04, 0x1B,
+	0x32, 0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x24, 0x06, 0x35, 0x34, 0x06, 0x24, 0x24, 0x12, 0x06, 0x23, 0x24, 0x13, 0x06, 0x98, 0x04, 0x00, 0x1E, 0x06, 0x14, 0x16, 0x09,
+	0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x14, 0x04, 0x1B, 0x32, 0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x17, 0x04, 0x35, 0x21, 0x24, 0x04, 0x24, 0x12, 0x15, 0x11, 0x04, 0x23,
+	0x13, 0x14, 0x12, 0x04, 0x18, 0x23, 0x12, 0x04, 0x49, 0x13, 0x04, 0x0F, 0x11, 0x04, 0x14, 0x25, 0x09, 0x13, 0x17, 0x09, 0x13, 0x13, 0x13, 0x09, 0x13, 0x22, 0x13, 0x14, 0x04, 0x34, 0x31, 0x33,
+	0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x24, 0x06, 0x35, 0x34, 0x06, 0x24, 0x24, 0x12, 0x06, 0x23, 0x24, 0x13, 0x06, 0x98, 0x04, 0x00, 0x1E, 0x06, 0x2F, 0x04, 0x5E, 0x02,
+	0x2D, 0x13, 0x02, 0x2C, 0x15, 0x01, 0x2B, 0x16, 0x01, 0x26, 0x32, 0x16, 0x01, 0x26, 0x12, 0x18, 0x01, 0x0F, 0x23, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x21, 0x03, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B,
+	0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x10, 0x42, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x11, 0x41, 0x14, 0x09, 0x55, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11,
+	0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x43, 0x14, 0x09, 0x11, 0x21, 0x16, 0x09, 0x10, 0x42, 0x14, 0x09, 0x10, 0x54, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F,
+	0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x11, 0x53, 0x11, 0x09, 0x20, 0x41, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x20, 0x41, 0x14, 0x09, 0x11, 0x53, 0x11, 0x09, 0x48,
+	0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x20, 0x46, 0x09, 0x10, 0x54, 0x11, 0x09, 0x10, 0x42, 0x14, 0x09, 0x20, 0x21, 0x16, 0x09, 0x11, 0x41,
+	0x14, 0x09, 0x11, 0x53, 0x11, 0x09, 0x20, 0x46, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x20, 0x46, 0x09, 0x20, 0x53, 0x11, 0x09, 0x43, 0x14,
+	0x09, 0x23, 0x16, 0x09, 0x43, 0x14, 0x09, 0x20, 0x53, 0x11, 0x09, 0x20, 0x46, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11,
+	0x09, 0x61, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x10, 0x42, 0x14, 0x09, 0x31, 0x51, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x3D, 0x05, 0x3B, 0x07, 0x39,
+	0x09, 0x37, 0x11, 0x09, 0x35, 0x13, 0x09, 0x33, 0x15, 0x09, 0x13, 0x17, 0x09, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0x67, 0x08,
+	0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x29, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x13, 0x3C, 0x02, 0x13, 0x1C, 0x11, 0x11, 0x13, 0x1C, 0x22, 0x23, 0x2A, 0x04, 0x24, 0x19, 0x05, 0x34, 0x36,
+	0x05, 0x25, 0x26, 0x06, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x10, 0x12, 0x15, 0x16, 0x04, 0x00, 0x11, 0x11, 0x15, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x13, 0x1C, 0x04,
+	0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x11, 0x11, 0x15, 0x16, 0x04, 0x10, 0x12, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x13,
+	0x15, 0x16, 0x04, 0x11, 0x11, 0x15, 0x16, 0x04, 0x20, 0x11, 0x15, 0x16, 0x04, 0x10, 0x12, 0x15, 0x16, 0x04, 0x20, 0x11, 0x15, 0x16, 0x04, 0x11, 0x11, 0x15, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x20, 0x11, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x20, 0x11, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x13, 0x1C, 0x04,
+	0x10, 0x0F, 0x05, 0x10, 0xE2, 0x04, 0x11, 0xE1, 0x04, 0x11, 0xE1, 0x04, 0x10, 0xE2, 0x04, 0x10, 0x0F, 0x05, 0x11, 0x0F, 0x04, 0x20, 0xE1, 0x04, 0x10, 0xE2, 0x04, 0x20, 0x0F, 0x04, 0x11, 0x0F,
+	0x04, 0x20, 0x0F, 0x04, 0x00, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x20, 0x0F, 0x04, 0x00, 0x19, 0x0B, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0x23, 0x2A,
+	0x04, 0x14, 0x29, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x33, 0x0F, 0x20, 0x32, 0x0E, 0x10, 0x35, 0x0C, 0x10, 0x37, 0x0A, 0x20, 0x47, 0x08, 0x11, 0x39, 0x07, 0x11, 0x3B,
+	0x05, 0x20, 0x3C, 0x04, 0xE3, 0x04, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x11, 0x11, 0x1C, 0x04, 0x23,
+	0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x11, 0x11, 0x1C, 0x04,
+	0x10, 0x12, 0x1C, 0x04, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x11,
+	0x11, 0x1C, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x11, 0x21, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5,
+	0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x20, 0x21, 0x2A, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x20, 0x11, 0x1C, 0x04, 0x11, 0x11, 0x1C, 0x04, 0x11, 0x21, 0x2A, 0x04, 0x20, 0x12, 0x1A, 0x05,
+	0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x20, 0x21, 0x2A, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x20, 0x21,
+	0x2A, 0x04, 0x20, 0x12, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x25, 0x25, 0x07, 0x26, 0x23, 0x08, 0x27, 0x21, 0x09, 0x38, 0x0A, 0x00, 0x27, 0x21, 0x09, 0x26, 0x23, 0x08, 0x25,
+	0x25, 0x07, 0x67, 0x13, 0x04, 0xC5, 0x04, 0x34, 0x36, 0x05, 0x14, 0x38, 0x05, 0x23, 0x27, 0x21, 0x04, 0x13, 0x27, 0x13, 0x04, 0x13, 0x35, 0x14, 0x04, 0x13, 0x34, 0x15, 0x04, 0x13, 0x23, 0x17,
+	0x04, 0x23, 0x21, 0x27, 0x04, 0x34, 0x18, 0x05, 0x34, 0x36, 0x05, 0xC3, 0x06, 0x13, 0x63, 0x08, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x10, 0x1F, 0x04, 0x00, 0x11,
+	0x1E, 0x04, 0x2F, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x11, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x00, 0x2F, 0x04, 0x3D, 0x05,
+	0xC3, 0x06, 0x93, 0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x11, 0x1E, 0x04, 0x20, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x20, 0x1E, 0x04, 0x11, 0x2D, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93,
+	0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x20, 0x2D, 0x04, 0x20, 0x1E, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x20, 0x2D, 0x04, 0x20, 0x3B, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x23, 0x0F, 0x01, 0x33,
+	0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x11, 0x87, 0x04, 0x10, 0x88, 0x04, 0x10, 0x36, 0x0B, 0x36, 0x0C, 0x34, 0x0E, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x15, 0x17, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x25, 0x24, 0x08, 0x76, 0x08, 0x47, 0x0A, 0xB6, 0x04, 0xE3, 0x04, 0x23, 0x0F, 0x01, 0x12, 0x0F, 0x03, 0x12, 0x2C, 0x04, 0x12, 0x1D, 0x04, 0x12, 0x44, 0x15, 0x04, 0x22,
+	0x22, 0x31, 0x14, 0x04, 0x43, 0x23, 0x14, 0x04, 0x24, 0x65, 0x04, 0x4C, 0x05, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x12, 0x23, 0x22, 0x14, 0x04, 0x12, 0x13, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13,
+	0x15, 0x04, 0x14, 0x11, 0x13, 0x15, 0x04, 0x16, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15,
+	0x04, 0x14, 0x11, 0x13, 0x15, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x14, 0x05, 0x12, 0x93, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x14,
+	0x21, 0x22, 0x14, 0x04, 0x23, 0x11, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x15, 0x04, 0x12, 0x13, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x14, 0x05, 0x23, 0x91, 0x06, 0x14, 0xA2, 0x04, 0x0F, 0x11,
+	0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x23, 0x21, 0x22, 0x14, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x00, 0x23, 0x11, 0x13, 0x15, 0x04, 0x14, 0x11, 0x13, 0x14, 0x05, 0x14, 0x91, 0x06,
+	0x13, 0xA3, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x22, 0x22, 0x22, 0x14, 0x04, 0x22, 0x12, 0x13, 0x15, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x22, 0x12, 0x13, 0x14,
+	0x05, 0x22, 0x92, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x31, 0x12, 0x13, 0x15, 0x04, 0x10, 0x13, 0x11, 0x13, 0x15, 0x04, 0x00,
+	0x31, 0x12, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x52, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x16, 0x13, 0x24, 0x04,
+	0x16, 0x13, 0x23, 0x05, 0x87, 0x06, 0x97, 0x05, 0x27, 0x12, 0x22, 0x05, 0x16, 0x14, 0x14, 0x04, 0x00, 0x00, 0x00, 0x26, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x59, 0x07, 0x97,
+	0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x16, 0x39, 0x02, 0x16, 0x19, 0x11, 0x11, 0x16, 0x19, 0x22, 0x27, 0x25, 0x05, 0x00, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x12, 0x13, 0x14,
+	0x14, 0x04, 0x00, 0x22, 0x12, 0x14, 0x14, 0x04, 0x14, 0x11, 0x14, 0x14, 0x04, 0x26, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x16,
+	0x14, 0x14, 0x04, 0x14, 0x11, 0x14, 0x14, 0x04, 0x13, 0x12, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x12, 0x23, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97,
+	0x05, 0x14, 0x21, 0x13, 0x13, 0x05, 0x23, 0x11, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x12, 0x13, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x23, 0x21, 0x13, 0x23, 0x04, 0x14,
+	0x52, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97, 0x05, 0x22, 0x22, 0x13, 0x13, 0x05, 0x22, 0x12, 0x14, 0x14, 0x04, 0x16, 0x14, 0x14, 0x04, 0x00, 0x22, 0x12, 0x14, 0x14, 0x04, 0x22, 0x22,
+	0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x12, 0x0F, 0x03, 0x22, 0x0F, 0x02, 0x13, 0xB2, 0x04, 0x14, 0xB1, 0x04, 0x14, 0xB1, 0x04, 0x13, 0xB2, 0x04, 0x22, 0x0F, 0x02, 0x12, 0x0F,
+	0x03, 0x14, 0x0F, 0x01, 0x23, 0x0F, 0x01, 0x22, 0xB2, 0x04, 0x12, 0xB3, 0x04, 0x22, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x22, 0x0F, 0x02, 0x00, 0xB6, 0x04, 0x00, 0x22, 0x0F, 0x02,
+	0x00, 0x69, 0x06, 0x88, 0x05, 0x12, 0x12, 0x21, 0x26, 0x04, 0x12, 0x11, 0x12, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x00, 0x33, 0x11, 0x18, 0x04, 0x22, 0x41, 0x26, 0x04, 0x12, 0xA3, 0x05, 0x78,
+	0x06, 0xB6, 0x04, 0x23, 0xB1, 0x04, 0x13, 0x23, 0x0C, 0x13, 0x12, 0x0E, 0x23, 0x11, 0x0E, 0x14, 0x11, 0x0E, 0x14, 0x21, 0x0D, 0x13, 0xB2, 0x04, 0x98, 0x04, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27,
+	0x04, 0x12, 0x13, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x13, 0x12, 0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16,
+	0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x13, 0x12, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x12, 0x23, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x14, 0x21, 0x27, 0x04, 0x23, 0x11,
+	0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x12, 0x13, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x23, 0x21, 0x27, 0x04, 0x14, 0x92, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x23, 0x21, 0x27, 0x04, 0x13,
+	0x12, 0x19, 0x04, 0x00, 0x23, 0x11, 0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x14, 0x21, 0x27, 0x04, 0x13, 0x93, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x22, 0x22, 0x27, 0x04, 0x22, 0x12, 0x19,
+	0x04, 0x16, 0x19, 0x04, 0x00, 0x22, 0x12, 0x19, 0x04, 0x22, 0x22, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x25, 0x12, 0x22, 0x07, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00,
+	0x3A, 0x13, 0x04, 0xA7, 0x04, 0x27, 0x25, 0x05, 0x16, 0x35, 0x11, 0x04, 0x16, 0x24, 0x13, 0x04, 0x16, 0x23, 0x14, 0x04, 0x16, 0x31, 0x15, 0x04, 0x27, 0x25, 0x05, 0xA6, 0x05, 0x16, 0x33, 0x08,
+	0x96, 0x06, 0xA6, 0x05, 0x12, 0x2C, 0x04, 0x22, 0x1C, 0x04, 0x13, 0x1C, 0x04, 0x14, 0x1B, 0x04, 0x2E, 0x05, 0xB6, 0x04, 0x00, 0x96, 0x06, 0xA6, 0x05, 0x2F, 0x04, 0x14, 0x1B, 0x04, 0x13, 0x1C,
+	0x04, 0x22, 0x1C, 0x04, 0x12, 0x2B, 0x05, 0xB6, 0x04, 0x00, 0x96, 0x06, 0x14, 0xA1, 0x05, 0x23, 0x2A, 0x04, 0x22, 0x1C, 0x04, 0x12, 0x1D, 0x04, 0x22, 0x1C, 0x04, 0x23, 0x29, 0x05, 0x14, 0xB1,
+	0x04, 0xB6, 0x04, 0x96, 0x06, 0x22, 0xA2, 0x05, 0x22, 0x2B, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x22, 0x1C, 0x04, 0x22, 0x2A, 0x05, 0xB6, 0x04, 0x00, 0x16, 0x0E, 0x36, 0x1B, 0x57, 0x18, 0x4A, 0x25,
+	0x14, 0x47, 0x31, 0x01, 0x13, 0x4B, 0x02, 0x22, 0x49, 0x04, 0x12, 0x47, 0x07, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0xF2, 0x40, 0x00, 0x18, 0x25, 0x05, 0x17, 0x17, 0x05, 0x16, 0x19, 0x04, 0x00,
+	0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x16, 0x0E, 0x36, 0x1B, 0x22, 0x53, 0x18, 0x22, 0x46, 0x25, 0x4C, 0x31, 0x01, 0x4F, 0x02, 0x22, 0x49, 0x04, 0x22, 0x46, 0x07, 0x57, 0x09, 0x46,
+	0x0B, 0x16, 0x0E, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x12, 0x53, 0x11, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x11, 0x17, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x53, 0x11, 0x08,
+	0x49, 0x08, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x15, 0x22, 0x31, 0x21, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00, 0x15, 0x21, 0x12, 0x22, 0x05, 0x98,
+	0x04, 0x89, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x20, 0x54, 0x11, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x11, 0x17, 0x08, 0x12, 0x41, 0x14, 0x08, 0x20,
+	0x54, 0x11, 0x08, 0x49, 0x08, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x28, 0x31, 0x21, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00,
+	0x15, 0x21, 0x12, 0x22, 0x05, 0x23, 0x93, 0x04, 0x89, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x56, 0x11, 0x08, 0x44, 0x14, 0x08, 0x14, 0x17, 0x08, 0x44,
+	0x14, 0x08, 0x56, 0x11, 0x08, 0x49, 0x08, 0x4B, 0x42, 0x5D, 0x12, 0x0F, 0x11, 0x13, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x28, 0x31, 0x21, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x00, 0x27, 0x12, 0x22,
+	0x05, 0xD8, 0x99, 0x12, 0x0F, 0x11, 0x13, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x12, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x00,
+	0x10, 0x14, 0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x15, 0x11, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x13, 0x23,
+	0x26, 0x04, 0x28, 0x24, 0x05, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x00, 0x21, 0x11,
+	0x1B, 0x04, 0x12, 0x12, 0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x14, 0x12, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x00, 0x24,
+	0x21, 0x26, 0x04, 0x15, 0x22, 0x24, 0x05, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x15,
+	0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x24, 0x11, 0x18, 0x04, 0x00, 0x17, 0x18, 0x04, 0x27, 0x26, 0x04, 0x28, 0x24, 0x05, 0x0F,
+	0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x10, 0x13, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x14, 0x19, 0x05,
+	0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x13, 0x23, 0x26, 0x04, 0x23, 0x12, 0x18, 0x04, 0x24, 0x11, 0x18, 0x04, 0x00, 0x23, 0x22, 0x26, 0x04, 0x13, 0x24, 0x24,
+	0x05, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x1B, 0x04, 0x10, 0x13, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x14, 0x19, 0x05, 0x25, 0x27,
+	0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0x18, 0x16, 0x05, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x23, 0x11, 0x0E, 0x33, 0x0F,
+	0x1A, 0x0A, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x14, 0x1B, 0x04, 0x00, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05,
+	0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x15, 0x12, 0x16, 0x05, 0xE3, 0x04, 0x00, 0x15, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x12, 0x11, 0x15,
+	0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x12, 0x23, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00,
+	0x15, 0x21, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x12, 0x11, 0x15, 0x15, 0x04, 0x00, 0x00,
+	0x20, 0x12, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x23, 0x22, 0x12, 0x23, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00, 0x23,
+	0x22, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00,
+	0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x12, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x00, 0x27, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39,
+	0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x55, 0x14, 0x15, 0x25, 0x12, 0x14, 0x1B, 0x13, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05,
+	0x27, 0x12, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x17, 0x13, 0x54, 0x17, 0x13, 0x24, 0x12, 0x27, 0x12, 0x23, 0x13, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15,
+	0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04,
+	0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x13, 0x23, 0x12, 0x23, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x00, 0x23, 0x22, 0x12, 0x23, 0x04, 0x13, 0x44,
+	0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x20, 0x12, 0x15,
+	0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x12, 0x21, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x15, 0x21, 0x26,
+	0x22, 0x14, 0x12, 0x18, 0x13, 0x23, 0x12, 0x18, 0x13, 0x00, 0x24, 0x22, 0x24, 0x23, 0x15, 0xD1, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x20,
+	0x12, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x12, 0x11, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F,
+	0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x23, 0x22, 0x26, 0x22, 0x15, 0x11, 0x18, 0x13, 0x00, 0x00, 0x23, 0x23, 0x24, 0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25,
+	0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x21, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62,
+	0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x27, 0x26, 0x22, 0x24, 0x11, 0x18, 0x13, 0x00, 0x17, 0x18, 0x13, 0x28, 0x24, 0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67,
+	0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x14, 0x1B, 0x11, 0x11, 0x14, 0x15, 0x15, 0x21, 0x01, 0x14, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12,
+	0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x27, 0x26, 0x22, 0x33, 0x11, 0x18, 0x13, 0x12, 0x21, 0x11, 0x18, 0x13, 0x17, 0x18, 0x13, 0x28, 0x24,
+	0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x19, 0x0B, 0x12, 0x16, 0x0B, 0x21, 0x16, 0x0B, 0x20, 0x17, 0x0B, 0x00, 0x21, 0x16, 0x0B, 0x12, 0x16, 0x0B, 0xD4, 0x04, 0x00, 0x0F,
+	0x06, 0xE3, 0x04, 0x11, 0xE1, 0x04, 0x20, 0x16, 0x0C, 0x10, 0x16, 0x0D, 0x00, 0x20, 0x15, 0x0D, 0x11, 0xA5, 0x04, 0x98, 0x04, 0x16, 0x0E, 0xD4, 0x04, 0x00, 0x16, 0x13, 0x0A, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x16, 0x0E, 0x14, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x14, 0x12, 0x0D, 0x17, 0x0D, 0x00, 0xA7, 0x04, 0x98, 0x04, 0x21, 0x0F, 0x03, 0x11, 0x0F,
+	0x04, 0x11, 0xD2, 0x04, 0x12, 0xD1, 0x04, 0x12, 0x0F, 0x03, 0x21, 0x0F, 0x03, 0x0F, 0x06, 0x24, 0x0F, 0x14, 0xA2, 0x04, 0x24, 0xA1, 0x04, 0x15, 0x0F, 0x24, 0x0F, 0x12, 0x0F, 0x03, 0x00, 0x12,
+	0xD1, 0x04, 0x00, 0x12, 0x0F, 0x03, 0x15, 0x0F, 0x00, 0x15, 0xA1, 0x04, 0x00, 0x15, 0x0F, 0x0F, 0x06, 0x20, 0x0F, 0x04, 0x12, 0xD1, 0x04, 0x00, 0x12, 0x0F, 0x03, 0x20, 0x0F, 0x04, 0x0F, 0x06,
+	0x23, 0x0F, 0x01, 0x15, 0xA1, 0x04, 0x00, 0x15, 0x0F, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0xF4, 0x20, 0xE4, 0x12, 0x0F, 0x15, 0x0F, 0x06, 0x23, 0xE2, 0x23, 0xB2, 0x12, 0x0F, 0x15, 0x0F, 0x06,
+	0x00, 0x21, 0xD1, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1D, 0x07, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x14, 0x2A,
+	0x04, 0xC4, 0x05, 0x94, 0x08, 0x0F, 0x06, 0x23, 0xA2, 0x04, 0x00, 0x0F, 0x06, 0x0F, 0x15, 0x23, 0xE2, 0x23, 0xD2, 0x01, 0x1D, 0x07, 0x3D, 0x05, 0x2F, 0x04, 0x12, 0x1D, 0x04, 0x21, 0x11, 0x1B,
+	0x04, 0x20, 0x12, 0x1B, 0x04, 0x20, 0x12, 0x2A, 0x04, 0x21, 0xC1, 0x05, 0x12, 0x91, 0x08, 0x24, 0x1E, 0x23, 0xE2, 0x23, 0xD2, 0x01, 0x14, 0x0F, 0x01, 0x15, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04,
+	0x2A, 0x09, 0x29, 0x0A, 0x38, 0x0A, 0x27, 0x21, 0x16, 0x11, 0x26, 0x23, 0x25, 0x01, 0x25, 0x35, 0x06, 0x24, 0x37, 0x05, 0x14, 0x39, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x2B,
+	0x08, 0x3A, 0x15, 0x11, 0x29, 0x31, 0x23, 0x01, 0x37, 0x33, 0x05, 0x17, 0x27, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x2B, 0x08, 0x3A, 0x08, 0x59, 0x07, 0x28, 0x23, 0x06, 0x27,
+	0x25, 0x05, 0x17, 0x27, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x12, 0x1D, 0x04, 0x20, 0x1E, 0x04, 0x00, 0x10, 0x1F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x0F, 0x06, 0x11, 0xE1,
+	0x04, 0x10, 0xE2, 0x04, 0x10, 0x0F, 0x05, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x0F, 0x11, 0x11, 0x11, 0x0F, 0x11, 0x21, 0x01, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x0F, 0x06, 0xE3,
+	0x11, 0x11, 0xE3, 0x21, 0x01, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x24, 0x11, 0x18, 0x04, 0x34, 0x19, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x0F,
+	0x06, 0x23, 0x11, 0x0E, 0x33, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x29, 0x15, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x29,
+	0x0A, 0x00, 0x2B, 0x08, 0x1B, 0x09, 0xD4, 0x04, 0x29, 0x15, 0x04, 0x19, 0x16, 0x04, 0x28, 0x16, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x2B, 0x08, 0xE3, 0x04, 0x00, 0x29, 0x0A, 0x0F, 0x06,
+	0xD4, 0x04, 0x00, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x12, 0x36, 0x09, 0x20, 0x39, 0x07, 0x20, 0x3A, 0x06, 0x10, 0x3D, 0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17,
+	0x0D, 0x15, 0x11, 0x0D, 0x23, 0x12, 0x0D, 0x13, 0xA3, 0x04, 0x98, 0x04, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x39, 0x16, 0x11, 0x3B, 0x24, 0x01, 0x3C, 0x06, 0x3E,
+	0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x1A, 0x11, 0x17, 0x2A, 0x01, 0x17, 0x0D, 0xA7, 0x04, 0x98, 0x04, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x34, 0x0E, 0x10, 0x35,
+	0x0C, 0x20, 0x35, 0x0B, 0x21, 0x36, 0x09, 0x21, 0x38, 0x07, 0x20, 0x3A, 0x06, 0x10, 0x3D, 0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x13, 0xA3, 0x04, 0x23, 0x13, 0x0C, 0x24, 0x11, 0x0D,
+	0x00, 0x23, 0x12, 0x0D, 0x13, 0xA3, 0x04, 0x98, 0x04, 0x24, 0x11, 0x0D, 0x44, 0x0D, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x98, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04,
+	0x26, 0x0D, 0x15, 0x0F, 0x00, 0x14, 0x1A, 0x05, 0x14, 0x2A, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x34, 0x28, 0x04, 0xB5, 0x05, 0x77, 0x07, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x0D, 0x00,
+	0x17, 0x1C, 0x00, 0xE7, 0xB9, 0x01, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05,
+	0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x00, 0x15, 0x21, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0x77, 0x07,
+	0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x20, 0x12, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08,
+	0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x23, 0x22, 0x26, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x00, 0x23, 0x22, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27,
+	0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x13, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x20, 0x13, 0x19, 0x05, 0x10, 0x24, 0x27, 0x05,
+	0x10, 0x95, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x24, 0x11, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x13, 0x11, 0x11, 0x18, 0x04, 0x24, 0x21, 0x26, 0x04,
+	0x23, 0x83, 0x05, 0x13, 0x65, 0x06, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0x27, 0x26, 0x04, 0x88, 0x05, 0x00, 0x27, 0x12, 0x23, 0x04, 0x17,
+	0x13, 0x14, 0x04, 0x00, 0x00, 0x27, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x12, 0x11, 0x15, 0x0A, 0x20, 0x12, 0x15,
+	0x0A, 0x20, 0x12, 0x35, 0x08, 0x10, 0x13, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x15, 0x12, 0x0C, 0x23, 0x22, 0x0C, 0x13, 0x23,
+	0x0C, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x14, 0x15, 0x17, 0x11, 0x14, 0x15, 0x27, 0x01, 0x14, 0x35, 0x08, 0x14, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04,
+	0x17, 0x18, 0x04, 0x0F, 0x06, 0xA7, 0x11, 0x11, 0xA7, 0x21, 0x01, 0x18, 0x0C, 0x27, 0x0C, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x10, 0x13, 0x15, 0x0A, 0x20, 0x12, 0x15, 0x0A,
+	0x21, 0x11, 0x15, 0x0A, 0x00, 0x20, 0x12, 0x35, 0x08, 0x10, 0x13, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0x13, 0xA3, 0x04, 0x23, 0xA2, 0x04, 0x24,
+	0x12, 0x0C, 0x24, 0x21, 0x0C, 0x23, 0x22, 0x0C, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x14, 0x14, 0x16, 0x04, 0x14, 0x24, 0x15, 0x04, 0x12, 0x11,
+	0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x24, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x57, 0x23, 0x04, 0x17,
+	0x13, 0x14, 0x04, 0x00, 0x15, 0x11, 0x23, 0x13, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x13, 0x23, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25,
+	0x04, 0x12, 0x11, 0x14, 0x16, 0x04, 0x21, 0x11, 0x24, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x00, 0x21, 0x11, 0x15, 0x15, 0x04, 0x12, 0x21, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35,
+	0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x15, 0x51, 0x23, 0x04, 0x14, 0x12, 0x13, 0x14, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x24, 0x11, 0x23, 0x13, 0x04, 0x15, 0x21,
+	0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x14, 0x14, 0x16, 0x04, 0x14, 0x24, 0x15, 0x13, 0x14, 0x15, 0x35, 0x11, 0x14, 0x15, 0x15,
+	0x31, 0x14, 0x15, 0x15, 0x04, 0x24, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x57, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x17, 0x13, 0x14, 0x13, 0x17,
+	0x23, 0x33, 0x11, 0x17, 0x23, 0x13, 0x31, 0x27, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x10, 0x13, 0x14, 0x16, 0x04, 0x20, 0x12,
+	0x24, 0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x23, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x13, 0x53,
+	0x23, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x24, 0x11, 0x23, 0x13, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x13, 0x23, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x14, 0x0F,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x13, 0xF4, 0x11, 0x14, 0x3D, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x17, 0x0D, 0x97, 0x05, 0xC5, 0x13, 0x17, 0x38, 0x11, 0x17, 0x18, 0x31, 0x14, 0x0F, 0x01,
+	0x00, 0x00, 0x10, 0x13, 0x0F, 0x01, 0x20, 0x12, 0x0F, 0x01, 0x21, 0xD1, 0x04, 0x00, 0x20, 0x12, 0x0F, 0x01, 0x10, 0x13, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x17, 0x0D, 0x97, 0x05, 0xC5,
+	0x04, 0x17, 0x18, 0x04, 0x00, 0x23, 0x11, 0x0E, 0x33, 0x0F, 0x14, 0x0F, 0x01, 0x00, 0x14, 0x15, 0x0A, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x14, 0x0F, 0x01, 0x00, 0x17,
+	0x13, 0x09, 0x97, 0x05, 0xC5, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x21, 0x2C, 0x04, 0x11, 0x1E, 0x04, 0x00, 0x12, 0x1D, 0x04, 0x12, 0x2C, 0x04,
+	0x21, 0x2B, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x24, 0x1A, 0x04, 0x14, 0x1B, 0x04, 0x24, 0x1A, 0x04, 0x15, 0x19, 0x05, 0x24, 0xA1, 0x04, 0xA7, 0x04, 0x0F, 0x06,
+	0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x12, 0x2C, 0x04, 0x12, 0x1D, 0x04, 0x00, 0x00, 0x12, 0x2C, 0x04, 0x2E, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0x15, 0xA1, 0x04, 0x15, 0x1A,
+	0x04, 0x00, 0x00, 0x15, 0x19, 0x05, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x20, 0x2D, 0x04, 0x12, 0x1D, 0x04, 0x00, 0x00, 0x20, 0x2D, 0x04, 0x2E, 0x05, 0xB4, 0x06,
+	0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x23, 0x1B, 0x04, 0x15, 0x1A, 0x04, 0x00, 0x15, 0x19, 0x05, 0x23, 0xA2, 0x04, 0xA7, 0x04, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x2F,
+	0x04, 0x40, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x21, 0x2C, 0x04, 0x2E, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x42, 0x1A, 0x04, 0x12, 0x12,
+	0x1A, 0x04, 0x12, 0x12, 0x19, 0x05, 0x23, 0xA2, 0x04, 0xA7, 0x04, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x12, 0x2B, 0x05, 0x21, 0x2C, 0x04, 0x20, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x12, 0x1D, 0x04,
+	0x20, 0x2D, 0x04, 0x10, 0x2D, 0x05, 0x10, 0xB3, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x15, 0x1A, 0x04, 0x24, 0x1A, 0x04, 0x23, 0x1B, 0x04, 0x13, 0x11, 0x19, 0x05, 0x24, 0xA1,
+	0x04, 0x23, 0xA2, 0x04, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x51, 0x0F, 0x21, 0x12, 0x2F, 0x13, 0x2E, 0x05, 0xB4, 0x06, 0x94,
+	0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x1F, 0x41, 0xB7, 0x12, 0xA7, 0x13, 0x14, 0x0F, 0x01, 0x44, 0x0D, 0x66, 0x09, 0x69, 0x06, 0x5C, 0x04, 0x2F, 0x04, 0x5B,
+	0x05, 0x12, 0x55, 0x08, 0x21, 0x52, 0x0B, 0x20, 0x22, 0x0F, 0x20, 0x62, 0x0B, 0x21, 0x55, 0x08, 0x12, 0x58, 0x05, 0x2F, 0x04, 0x5C, 0x04, 0x69, 0x06, 0x66, 0x09, 0x44, 0x0D, 0x14, 0x0F, 0x01,
+	0x27, 0x0C, 0x67, 0x08, 0x6B, 0x04, 0x0F, 0x11, 0x04, 0x15, 0x56, 0x04, 0x14, 0x62, 0x08, 0x23, 0x12, 0x0D, 0x23, 0x62, 0x08, 0x24, 0x56, 0x04, 0x15, 0x29, 0x04, 0x5B, 0x05, 0x67, 0x08, 0x27,
+	0x0C, 0x0F, 0x06, 0x24, 0x0F, 0x34, 0x0E, 0x12, 0x33, 0x0C, 0x21, 0x35, 0x0A, 0x20, 0x87, 0x04, 0x00, 0x21, 0x35, 0x0A, 0x12, 0x33, 0x0C, 0x34, 0x0E, 0x24, 0x0F, 0x17, 0x0D, 0x47, 0x19, 0x15,
+	0x53, 0x25, 0x14, 0x47, 0x22, 0x01, 0x23, 0x4A, 0x02, 0x23, 0x57, 0x04, 0x24, 0x53, 0x07, 0x15, 0x41, 0x0A, 0x17, 0x0D, 0x0F, 0x06, 0x24, 0x0F, 0x34, 0x0E, 0x21, 0x33, 0x0C, 0x21, 0x35, 0x0A,
+	0x89, 0x04, 0x00, 0x21, 0x35, 0x0A, 0x21, 0x33, 0x0C, 0x34, 0x0E, 0x24, 0x0F, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04, 0x14, 0x37, 0x11, 0x04, 0x14, 0x26, 0x13, 0x04, 0x12, 0x11, 0x25,
+	0x14, 0x04, 0x20, 0x12, 0x33, 0x15, 0x04, 0x20, 0x12, 0x22, 0x17, 0x04, 0x10, 0x13, 0x21, 0x18, 0x04, 0x34, 0x19, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27, 0x04, 0x17, 0x45, 0x04, 0x17,
+	0x34, 0x11, 0x04, 0x15, 0x11, 0x32, 0x13, 0x04, 0x23, 0x12, 0x31, 0x14, 0x04, 0x13, 0x33, 0x16, 0x04, 0x27, 0x17, 0x04, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04, 0x14, 0x37, 0x11, 0x04,
+	0x14, 0x26, 0x13, 0x04, 0x21, 0x11, 0x25, 0x14, 0x04, 0x21, 0x11, 0x33, 0x15, 0x04, 0x14, 0x22, 0x17, 0x04, 0x14, 0x21, 0x18, 0x04, 0x34, 0x19, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27,
+	0x04, 0x17, 0x45, 0x04, 0x23, 0x12, 0x34, 0x11, 0x04, 0x23, 0x12, 0x32, 0x13, 0x04, 0x17, 0x31, 0x14, 0x04, 0x37, 0x16, 0x04, 0x27, 0x17, 0x04, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04,
+	0x10, 0x13, 0x37, 0x11, 0x04, 0x20, 0x12, 0x26, 0x13, 0x04, 0x21, 0x11, 0x25, 0x14, 0x04, 0x21, 0x11, 0x33, 0x15, 0x04, 0x20, 0x12, 0x22, 0x17, 0x04, 0x10, 0x13, 0x21, 0x18, 0x04, 0x34, 0x19,
+	0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27, 0x04, 0x13, 0x13, 0x45, 0x04, 0x23, 0x12, 0x34, 0x11, 0x04, 0x24, 0x11, 0x32, 0x13, 0x04, 0x24, 0x11, 0x31, 0x14, 0x04, 0x23, 0x32, 0x16, 0x04,
+	0x13, 0x23, 0x17, 0x04, 0x0F, 0x06, 0xD4, 0x04, 0xE3, 0x04, 0x13, 0x0F, 0x02, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x21,
+	0x11, 0x15, 0x15, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x00, 0x14, 0x13, 0x16, 0x05, 0x14,
+	0x13, 0x17, 0x04, 0x18, 0x17, 0x04, 0x28, 0x16, 0x04, 0x98, 0x04, 0x79, 0x05, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x0F, 0x01, 0x12, 0x11, 0x0F, 0x01, 0x21, 0x11, 0x0F, 0x01, 0x20, 0x12,
+	0x0F, 0x01, 0x10, 0x13, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x67, 0x08, 0x96, 0x06, 0x35, 0x12, 0x32, 0x05, 0x24, 0x14, 0x24, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x14, 0x1B,
+	0x04, 0x15, 0x19, 0x05, 0x35, 0x26, 0x05, 0x17, 0x25, 0x06, 0x0F, 0x06, 0x36, 0x15, 0x06, 0x55, 0x33, 0x05, 0x24, 0x13, 0x25, 0x04, 0x14, 0x24, 0x15, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00,
+	0x00, 0x24, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x21, 0x0F, 0x03, 0x00, 0xD4, 0x04, 0x00, 0x21, 0x0F, 0x03, 0x00, 0x2D, 0x06, 0x3D, 0x05,
+	0x2F, 0x04, 0x0F, 0x11, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x14, 0x2A, 0x04, 0xC4, 0x05, 0xB4, 0x06, 0x0F, 0x06, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x4C, 0x05, 0xA5, 0x06, 0x64, 0x0B, 0x14, 0x0F, 0x01,
+	0x00, 0x00, 0xD4, 0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x4B, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xD4,
+	0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x4B, 0x06, 0x0F, 0x06, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x98, 0x04, 0x89, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1A, 0x0A, 0x12, 0x17, 0x0A, 0x21, 0x45, 0x09, 0x20, 0x25, 0x32, 0x07, 0x10, 0x34, 0x44, 0x05, 0x24, 0x38, 0x04, 0x14, 0x1B,
+	0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x0F, 0x06, 0x14, 0x1B, 0x04, 0x34, 0x19, 0x04, 0x20, 0x43, 0x17, 0x04, 0x30,
+	0x34, 0x25, 0x04, 0x12, 0x36, 0x22, 0x05, 0x12, 0x57, 0x06, 0x12, 0x37, 0x08, 0x30, 0x35, 0x0A, 0x20, 0x34, 0x0C, 0x34, 0x0E, 0x14, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x11,
+	0x04, 0x00, 0x00, 0x0F, 0x51, 0x00, 0x0F, 0x11, 0x04, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x4B, 0x06, 0x58, 0x08, 0x55, 0x12, 0x08, 0x34, 0x15, 0x08, 0x00, 0x55,
+	0x12, 0x08, 0x58, 0x08, 0x5A, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x14, 0x25, 0x23, 0x04, 0x14, 0x56, 0x05, 0x3C,
+	0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x24, 0x23, 0x15, 0x04, 0x55, 0x11, 0x23, 0x04, 0x45, 0x52, 0x05, 0x3C, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04,
+	0x00, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x51, 0x00, 0x3E, 0x04, 0x98, 0x04, 0x84, 0x14, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x51, 0x00,
+	0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x14, 0x1B, 0x04, 0x24, 0x38, 0x04, 0x35, 0x35, 0x05, 0x27, 0x32,
+	0x07, 0x48, 0x09, 0x1A, 0x0A, 0x00, 0xD4, 0x04, 0x00, 0x1A, 0x0A, 0x00, 0x39, 0x09, 0x58, 0x08, 0x36, 0x33, 0x06, 0x25, 0x36, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x00, 0x26,
+	0x25, 0x06, 0x25, 0x27, 0x05, 0x24, 0x1A, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x24, 0x33, 0x23, 0x04, 0x55, 0x51, 0x05, 0x36, 0x33, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x3E, 0x04, 0x3C,
+	0x06, 0x3B, 0x07, 0x39, 0x09, 0x37, 0x0B, 0x36, 0x0C, 0x34, 0x0E, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x20, 0x3C, 0x04, 0x30, 0x39, 0x06, 0x12, 0x38, 0x07, 0x12, 0x36, 0x09,
+	0x12, 0x34, 0x0B, 0x30, 0x33, 0x0C, 0x20, 0x32, 0x0E, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1A, 0x0A, 0x00, 0x48, 0x09, 0x27, 0x32, 0x07, 0x35, 0x44, 0x05, 0x24, 0x38, 0x04,
+	0x14, 0x1B, 0x04, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x4C, 0x05, 0xA5, 0x06, 0x64, 0x0B, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x45, 0x0C, 0x57,
+	0x09, 0x5A, 0x06, 0x4D, 0x04, 0x00, 0x5A, 0x06, 0x48, 0x09, 0x45, 0x0C, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F,
+	0x06, 0x00, 0x67, 0x08, 0x96, 0x06, 0x25, 0x36, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x00, 0xD4,
+	0x04, 0x00, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x24, 0x23, 0x0A, 0x55, 0x0B, 0x36,
+	0x0C, 0x0F, 0x06, 0x00, 0x67, 0x08, 0x96, 0x06, 0x25, 0x36, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x15, 0x19, 0x05, 0x35, 0x26, 0x05, 0x17, 0x25, 0x06, 0x0F, 0x06, 0x14,
+	0x0F, 0x01, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x14, 0x1B, 0x04, 0x34, 0x19, 0x04, 0x45, 0x17, 0x04, 0x37, 0x25, 0x04, 0x39, 0x22, 0x05, 0x5A,
+	0x06, 0x3A, 0x08, 0x38, 0x0A, 0x36, 0x0C, 0x34, 0x0E, 0x14, 0x0F, 0x01, 0x0F, 0x06, 0x58, 0x08, 0x77, 0x07, 0x26, 0x25, 0x06, 0x16, 0x17, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x16, 0x17, 0x06, 0x00,
+	0x26, 0x25, 0x06, 0x77, 0x07, 0x58, 0x08, 0x0F, 0x06, 0x14, 0x1B, 0x04, 0x24, 0x29, 0x04, 0x25, 0x36, 0x05, 0x26, 0x34, 0x06, 0x37, 0x21, 0x08, 0x48, 0x09, 0x39, 0x09, 0x37, 0x21, 0x08, 0x26,
+	0x34, 0x06, 0x25, 0x36, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x51, 0x00, 0x0F,
+	0x06, 0x00, 0x74, 0x0A, 0x84, 0x09, 0x2A, 0x09, 0x1B, 0x09, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00,
+	0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04,
+	0x00, 0x0F, 0x51, 0x00, 0x0F, 0x06, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x4B, 0x06, 0x0F, 0x06, 0x00, 0xD4,
+	0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x4B, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x19, 0x16, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x4B, 0x06, 0x0F, 0x06, 0x00, 0x17, 0x25, 0x06, 0x35, 0x35, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x24,
+	0x14, 0x24, 0x04, 0x35, 0x12, 0x32, 0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1A, 0x0A, 0x00, 0x58, 0x08, 0x96, 0x06, 0x25, 0x36, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B,
+	0x04, 0x00, 0x00, 0x00, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x0F, 0x11, 0x04, 0x36, 0x26, 0x04, 0x55, 0x33, 0x05, 0x24, 0x23, 0x31, 0x06, 0x14, 0x35, 0x08,
+	0x14, 0x25, 0x09, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x28, 0x42, 0x05, 0x28, 0x52, 0x04, 0x27, 0x22, 0x13, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x27, 0x12, 0x13,
+	0x05, 0xA7, 0x04, 0x98, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x68, 0x07, 0x36, 0x61, 0x05, 0x15, 0x22, 0x25, 0x04, 0x24, 0x12, 0x17, 0x04, 0x14, 0x22, 0x17, 0x04, 0x00, 0x23, 0x13, 0x26, 0x04,
+	0x23, 0x83, 0x05, 0x23, 0x64, 0x06, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x17, 0x13, 0x14, 0x04, 0x00, 0x00, 0x00, 0x47, 0x51, 0x04, 0x38, 0x41, 0x05, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x17, 0x0D, 0x00,
+	0x00, 0x00, 0x0F, 0x51, 0x6F, 0x5C, 0x04, 0x77, 0x12, 0x04, 0x37, 0x16, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0xA7, 0x04, 0xE7, 0x0F, 0x51, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x12, 0x23,
+	0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x00, 0x27, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x17, 0x18, 0x04, 0x27, 0x35, 0x04, 0x28, 0x23, 0x06, 0x59, 0x07, 0x2A, 0x09, 0x1B, 0x09,
+	0xA7, 0x04, 0x00, 0x1B, 0x09, 0x2A, 0x09, 0x59, 0x07, 0x28, 0x23, 0x06, 0x27, 0x35, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0x28, 0x24, 0x05, 0x37, 0x34, 0x04, 0x27, 0x12, 0x23, 0x04, 0x17, 0x13,
+	0x14, 0x04, 0x17, 0x32, 0x13, 0x04, 0x47, 0x51, 0x04, 0x38, 0x41, 0x05, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x2E, 0x05, 0x2C, 0x07, 0x2A, 0x09, 0x28, 0x0B, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04,
+	0x23, 0xA2, 0x04, 0x33, 0x28, 0x05, 0x15, 0x26, 0x07, 0x15, 0x24, 0x09, 0x15, 0x22, 0x0B, 0x33, 0xA1, 0x04, 0x23, 0xA2, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B, 0x09, 0x3A, 0x08, 0x29, 0x31,
+	0x06, 0x27, 0x35, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x5B, 0x05, 0x77, 0x07, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x37, 0x0B, 0x49, 0x08,
+	0x4C, 0x05, 0x0F, 0x11, 0x04, 0x4C, 0x05, 0x49, 0x08, 0x37, 0x0B, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B, 0x09, 0x00, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x69, 0x06, 0x88,
+	0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0x27, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xE7, 0x00,
+	0x18, 0x16, 0x05, 0x17, 0x18, 0x04, 0x00, 0x00, 0x27, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x27, 0x26, 0x04, 0x28,
+	0x24, 0x05, 0x19, 0x14, 0x06, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x17, 0x0D, 0x00, 0x00, 0x27, 0x1B, 0x47, 0x19, 0x4A, 0x25, 0x8C, 0x01, 0x4F, 0x02, 0x4C, 0x05, 0x4A, 0x07, 0x47, 0x0A,
+	0x27, 0x0C, 0x0F, 0x06, 0x69, 0x06, 0x98, 0x04, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x18, 0x16, 0x05, 0xF3, 0x30, 0x00, 0x18, 0x16, 0x05, 0x17, 0x18, 0x04, 0x00, 0x27, 0x26, 0x04, 0x88,
+	0x05, 0x69, 0x06, 0x17, 0x18, 0x04, 0x27, 0x26, 0x04, 0x38, 0x32, 0x05, 0x4A, 0x07, 0x2B, 0x08, 0x4A, 0x07, 0x38, 0x32, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00,
+	0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x04, 0xE7, 0x0F, 0x51, 0x0F, 0x06, 0x57, 0x09, 0x67, 0x08, 0x1C, 0x08, 0x00, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x0F,
+	0x11, 0x04, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00,
+	0x00, 0xA7, 0x04, 0x00, 0x0F, 0x51, 0x00, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x1B, 0x14, 0x04, 0x00, 0x00, 0x1B, 0x23, 0x04, 0x5B, 0x05, 0x4C, 0x05, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B,
+	0x14, 0x04, 0x00, 0x00, 0x1B, 0x23, 0x04, 0x5B, 0x05, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B, 0x14, 0x04, 0x00, 0x00, 0x00, 0x2B, 0x22, 0x04, 0x5B,
+	0x05, 0x4C, 0x05, 0x0F, 0x06, 0x19, 0x14, 0x06, 0x28, 0x24, 0x05, 0x27, 0x26, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x27, 0x12, 0x23, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0xA7, 0x04, 0x00,
+	0x1B, 0x09, 0x00, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x27, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x11, 0x04, 0x48, 0x23, 0x04, 0x67, 0x21, 0x05, 0x17, 0x34,
+	0x06, 0x17, 0x14, 0x08, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x24, 0x21, 0x12, 0x23, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x17, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13,
+	0x14, 0x04, 0x24, 0x21, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x14, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x14, 0x12, 0x0D, 0x00, 0x17, 0x1C, 0xE7, 0xC8, 0x01, 0x0F,
+	0x06, 0xA7, 0x04, 0x00, 0x15, 0x11, 0x0D, 0x14, 0x12, 0x0D, 0x23, 0x12, 0x0D, 0x13, 0x13, 0x0D, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x12, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x27,
+	0x26, 0x04, 0x28, 0x24, 0x05, 0x19, 0x14, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x57, 0x22, 0x05, 0x17, 0x22, 0x23, 0x04, 0x17, 0x23, 0x13, 0x04, 0x00, 0x27, 0x22, 0x13, 0x04, 0x28, 0x52, 0x04,
+	0x28, 0x33, 0x05, 0x0F, 0x06, 0x23, 0xA2, 0x04, 0x00, 0x0F, 0x06, 0x24, 0x0F, 0x24, 0xA1, 0x04, 0xA7, 0x04, 0x24, 0x0F, 0x00, 0x0F, 0x15, 0x23, 0xE2, 0x23, 0xD2, 0x01, 0x0F, 0x11, 0x04, 0x2F,
+	0x04, 0x5B, 0x05, 0x97, 0x05, 0x57, 0x09, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x1B, 0x14, 0x04, 0x00, 0x00, 0x00, 0x6B, 0x04, 0x4C, 0x05, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B, 0x09, 0x00,
+	0x00, 0xA7, 0x04, 0x00, 0x1B, 0x14, 0x04, 0x00, 0x00, 0x1B, 0x23, 0x04, 0x5B, 0x05, 0x4C, 0x05, 0x14, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x14, 0x12, 0x0D, 0x00, 0x17, 0x0D, 0xA7,
+	0x04, 0x98, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B, 0x09, 0x15, 0x34, 0x08, 0x14, 0x24, 0x31, 0x06, 0x23, 0x22, 0x35, 0x04, 0x13, 0x13, 0x18, 0x04, 0x27, 0x1B, 0x47, 0x19, 0x23, 0x45, 0x25,
+	0x33, 0x86, 0x01, 0x15, 0x49, 0x02, 0x15, 0x46, 0x05, 0x15, 0x44, 0x07, 0x33, 0x41, 0x0A, 0x23, 0x22, 0x0C, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x0F, 0x51, 0x00, 0x0F, 0x11, 0x04,
+	0xA7, 0x04, 0x00, 0x24, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x50, 0x0F, 0x01, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x17, 0x0D, 0x00, 0x00, 0x53, 0x0D, 0x00,
+	0x0F, 0x06, 0xF1, 0x50, 0x21, 0x0F, 0x21, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x22, 0x2A, 0x12, 0x11, 0x14, 0x18, 0x14, 0x11, 0x15, 0x16, 0x15, 0x11, 0x16, 0x14, 0x16, 0x11, 0x17, 0x12, 0x17, 0x11,
+	0x28, 0x18, 0x11, 0x17, 0x12, 0x17, 0x11, 0x16, 0x14, 0x16, 0x11, 0x15, 0x16, 0x15, 0x11, 0x14, 0x18, 0x14, 0x11, 0x22, 0x2A, 0x12, 0x11, 0x11, 0x1E, 0x11, 0x21, 0x0F, 0x21, 0xF1, 0x50, 0x0F,
+	0x06, 0x00, 0x3F, 0x03, 0x27, 0x55, 0x02, 0x27, 0x24, 0x22, 0x02, 0x27, 0x23, 0x23, 0x02, 0x27, 0x13, 0x14, 0x03, 0xC6, 0x03, 0xE5, 0x02, 0x35, 0x13, 0x43, 0x02, 0x26, 0x22, 0x22, 0x05, 0x26,
+	0x52, 0x23, 0x01, 0x26, 0x41, 0x25, 0x01, 0x25, 0x12, 0x21, 0x24, 0x02, 0x25, 0x24, 0x23, 0x03, 0x6C, 0x03, 0x3D, 0x05, 0x0F, 0x06, 0x4E, 0x03, 0x25, 0x66, 0x02, 0x25, 0x34, 0x23, 0x02, 0x25,
+	0x24, 0x24, 0x02, 0x25, 0x23, 0x15, 0x03, 0xB4, 0x21, 0x03, 0xF2, 0x20, 0x02, 0x42, 0x23, 0x44, 0x02, 0x24, 0x22, 0x24, 0x05, 0x24, 0x22, 0x32, 0x13, 0x02, 0x24, 0x52, 0x25, 0x01, 0x14, 0x42,
+	0x27, 0x01, 0x23, 0x32, 0x27, 0x02, 0x23, 0x24, 0x26, 0x02, 0x2A, 0x33, 0x03, 0x7A, 0x04, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x00, 0x87, 0x06, 0xB7, 0x03, 0x4F, 0x02, 0x0F, 0x23, 0x01, 0x00, 0x0F,
+	0x22, 0x02, 0x4E, 0x03, 0x0F, 0x06, 0x00, 0x18, 0x0C, 0x38, 0x0A, 0x59, 0x07, 0x6B, 0x04, 0x3E, 0x04, 0x0F, 0x06, 0x00, 0x94, 0x08, 0xC4, 0x05, 0x5D, 0x03, 0x0F, 0x31, 0x02, 0x0F, 0x22, 0x02,
+	0x00, 0x0F, 0x21, 0x03, 0x4D, 0x04, 0x1E, 0x06, 0x0F, 0x06, 0x00, 0x15, 0x0F, 0x25, 0x0E, 0x45, 0x0C, 0x67, 0x08, 0x79, 0x05, 0x2D, 0x06, 0x0F, 0x06, 0x00, 0x00, 0x1A, 0x0A, 0x2A, 0x09, 0x16,
+	0x23, 0x09, 0x25, 0x23, 0x17, 0x01, 0x25, 0x22, 0x27, 0x01, 0x16, 0x22, 0x27, 0x01, 0x26, 0x21, 0x17, 0x02, 0x26, 0x21, 0x26, 0x02, 0x00, 0x26, 0x22, 0x33, 0x03, 0x7A, 0x04, 0x4C, 0x05, 0x0F,
+	0x06, 0x00, 0x18, 0x0C, 0x38, 0x0A, 0x28, 0x0B, 0x22, 0x24, 0x18, 0x02, 0x22, 0x24, 0x28, 0x01, 0x22, 0x23, 0x29, 0x01, 0x13, 0x23, 0x19, 0x02, 0x23, 0x22, 0x28, 0x02, 0x00, 0x23, 0x22, 0x27,
+	0x03, 0x23, 0x32, 0x35, 0x03, 0x23, 0x33, 0x33, 0x04, 0x79, 0x05, 0x4A, 0x07, 0x0F, 0x06, 0x00, 0x00, 0x0F, 0x13, 0x02, 0x2A, 0x35, 0x01, 0x2A, 0x34, 0x02, 0x25, 0x23, 0x24, 0x03, 0x25, 0x23,
+	0x23, 0x04, 0x25, 0x23, 0x22, 0x05, 0x16, 0x13, 0x32, 0x05, 0x26, 0x12, 0x11, 0x31, 0x04, 0x26, 0x32, 0x33, 0x02, 0x26, 0x31, 0x26, 0x01, 0x16, 0x13, 0x27, 0x01, 0x0F, 0x23, 0x01, 0x00, 0x00,
+	0x0F, 0x06, 0x0F, 0x13, 0x02, 0x18, 0x38, 0x01, 0x28, 0x36, 0x02, 0x28, 0x35, 0x03, 0x22, 0x24, 0x34, 0x04, 0x22, 0x24, 0x33, 0x05, 0x22, 0x14, 0x24, 0x06, 0x22, 0x14, 0x33, 0x06, 0x13, 0x14,
+	0x12, 0x21, 0x06, 0x23, 0x13, 0x21, 0x42, 0x03, 0x23, 0x33, 0x35, 0x02, 0x23, 0x32, 0x28, 0x01, 0x23, 0x13, 0x29, 0x01, 0x0F, 0x23, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x29, 0x25, 0x03,
+	0x29, 0x44, 0x02, 0x29, 0x14, 0x22, 0x01, 0x29, 0x13, 0x23, 0x01, 0xE6, 0x01, 0xD6, 0x02, 0x29, 0x12, 0x07, 0x19, 0x22, 0x07, 0x28, 0x22, 0x24, 0x01, 0x2C, 0x24, 0x01, 0x18, 0x23, 0x23, 0x02,
+	0x18, 0x24, 0x22, 0x02, 0x28, 0x53, 0x03, 0x29, 0x33, 0x04, 0x1A, 0x0A, 0x0F, 0x06, 0x26, 0x37, 0x03, 0x26, 0x56, 0x02, 0x26, 0x25, 0x22, 0x02, 0x26, 0x15, 0x24, 0x01, 0x26, 0x24, 0x24, 0x01,
+	0xF2, 0x30, 0x01, 0xF2, 0x20, 0x02, 0x26, 0x23, 0x08, 0x25, 0x23, 0x09, 0x25, 0x23, 0x26, 0x01, 0x00, 0x2A, 0x26, 0x01, 0x24, 0x34, 0x24, 0x02, 0x25, 0x24, 0x33, 0x02, 0x25, 0x74, 0x03, 0x26,
+	0x45, 0x04, 0x27, 0x0C, 0x17, 0x0D, 0x27, 0x1A, 0x01, 0x27, 0x38, 0x01, 0x27, 0x46, 0x02, 0x27, 0x44, 0x04, 0x27, 0x51, 0x06, 0x84, 0x09, 0x62, 0x2A, 0x01, 0x12, 0x23, 0x2A, 0x01, 0x26, 0x2A,
+	0x01, 0x26, 0x39, 0x01, 0x36, 0x46, 0x02, 0xB7, 0x03, 0x78, 0x06, 0x0F, 0x06, 0x25, 0x0E, 0x45, 0x0C, 0x47, 0x0A, 0x49, 0x08, 0x2B, 0x08, 0x27, 0x1A, 0x01, 0x27, 0x38, 0x01, 0x27, 0x46, 0x02,
+	0x27, 0x44, 0x04, 0x27, 0x51, 0x06, 0x84, 0x09, 0x72, 0x29, 0x01, 0x13, 0x23, 0x29, 0x01, 0x27, 0x29, 0x01, 0x00, 0x37, 0x36, 0x02, 0xA8, 0x03, 0x69, 0x06, 0x0F, 0x06, 0x12, 0x22, 0x0E, 0x22,
+	0x41, 0x0C, 0x14, 0x42, 0x0A, 0x21, 0x56, 0x07, 0x32, 0x26, 0x08, 0x0F, 0x06, 0x00, 0x29, 0x0A, 0x25, 0x22, 0x43, 0x03, 0x25, 0x22, 0x62, 0x02, 0x25, 0x22, 0x12, 0x23, 0x02, 0x25, 0x22, 0x27,
+	0x01, 0x00, 0x00, 0x12, 0x22, 0x22, 0x27, 0x01, 0x52, 0x22, 0x27, 0x01, 0x74, 0x22, 0x23, 0x01, 0x25, 0x31, 0x13, 0x23, 0x01, 0x34, 0x42, 0x11, 0x23, 0x01, 0x24, 0x13, 0x32, 0x23, 0x01, 0x24,
+	0x13, 0x23, 0x06, 0x28, 0x0B, 0x19, 0x0B, 0x0F, 0x06, 0x29, 0x0A, 0x25, 0x22, 0x43, 0x03, 0x25, 0x22, 0x62, 0x02, 0x25, 0x22, 0x12, 0x23, 0x02, 0x25, 0x22, 0x27, 0x01, 0x00, 0x00, 0x12, 0x22,
+	0x22, 0x27, 0x01, 0x52, 0x22, 0x27, 0x01, 0x74, 0x22, 0x23, 0x01, 0x25, 0x41, 0x21, 0x23, 0x01, 0x25, 0x62, 0x23, 0x01, 0x24, 0x13, 0x32, 0x23, 0x01, 0x12, 0x21, 0x13, 0x33, 0x05, 0x23, 0x23,
+	0x0B, 0x11, 0x22, 0x0F, 0x31, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x00, 0x2A, 0x09, 0x49, 0x08, 0x28, 0x31, 0x07, 0x27, 0x33, 0x06, 0x26, 0x25, 0x06, 0x25, 0x27, 0x05, 0x34, 0x28,
+	0x04, 0x24, 0x2A, 0x03, 0x32, 0x3B, 0x02, 0x13, 0x3D, 0x01, 0x0F, 0x13, 0x02, 0x0F, 0x06, 0x00, 0x00, 0x2A, 0x09, 0x49, 0x08, 0x28, 0x31, 0x07, 0x27, 0x33, 0x06, 0x26, 0x25, 0x06, 0x25, 0x27,
+	0x05, 0x34, 0x28, 0x04, 0x24, 0x2A, 0x03, 0x32, 0x12, 0x38, 0x02, 0x13, 0x33, 0x37, 0x01, 0x19, 0x18, 0x02, 0x26, 0x0D, 0x27, 0x0C, 0x18, 0x0C, 0x0F, 0x06, 0xA7, 0x04, 0xF3, 0x10, 0x02, 0x33,
+	0x49, 0x02, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x27, 0x0C, 0x00, 0x27, 0x1A, 0x01, 0x27, 0x29, 0x01, 0x27, 0x38, 0x01, 0x27, 0x46, 0x02, 0xF2, 0x10, 0x03, 0xD2, 0x06, 0x27, 0x0C, 0x00, 0x00, 0x0F,
+	0x06, 0xA7, 0x04, 0xF3, 0x10, 0x02, 0x33, 0x49, 0x02, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x27, 0x0C, 0x00, 0x27, 0x1A, 0x01, 0x27, 0x29, 0x01, 0x27, 0x38, 0x01, 0x27, 0x46, 0x02, 0xF2, 0x04, 0xD2,
+	0x06, 0x27, 0x0C, 0x22, 0x23, 0x0C, 0x10, 0x13, 0x22, 0x0C, 0x21, 0x33, 0x0C, 0x0F, 0x06, 0x00, 0x4D, 0x04, 0x5D, 0x03, 0x24, 0x2B, 0x02, 0x00, 0x24, 0x2C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0x22, 0x02, 0x0F, 0x06, 0x00, 0x5D, 0x03, 0x00, 0x25, 0x2A, 0x02, 0x00, 0x25, 0x2B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x21, 0x2B, 0x01, 0x32, 0x2C,
+	0x02, 0x24, 0x0F, 0x22, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x26, 0x0D, 0x26, 0x36, 0x04, 0x26, 0x64, 0x03, 0x26, 0x15, 0x23, 0x02, 0x26, 0x29, 0x02, 0x26, 0x2A, 0x01, 0x00, 0x00,
+	0x22, 0x22, 0x2A, 0x01, 0x62, 0x24, 0x24, 0x01, 0x55, 0x22, 0x24, 0x01, 0x56, 0x21, 0x24, 0x01, 0x25, 0x43, 0x24, 0x01, 0x25, 0x25, 0x07, 0x25, 0x0E, 0x16, 0x0E, 0x0F, 0x06, 0x00, 0x26, 0x0D,
+	0x26, 0x36, 0x04, 0x26, 0x64, 0x03, 0x26, 0x15, 0x23, 0x02, 0x26, 0x29, 0x02, 0x26, 0x2A, 0x01, 0x00, 0x00, 0x22, 0x22, 0x2A, 0x01, 0x62, 0x24, 0x24, 0x01, 0x55, 0x22, 0x24, 0x01, 0x56, 0x21,
+	0x24, 0x01, 0x25, 0x43, 0x24, 0x01, 0x12, 0x22, 0x25, 0x07, 0x43, 0x0E, 0x11, 0x12, 0x11, 0x0E, 0x31, 0x0F, 0x02, 0x0F, 0x06, 0x00, 0x00, 0x00, 0xF2, 0x04, 0xF2, 0x20, 0x02, 0x0F, 0x22, 0x02,
+	0x0F, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x32, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x31, 0x02, 0x3F, 0x03, 0x3E, 0x04, 0x2E, 0x05, 0x0F, 0x06, 0x00, 0x00, 0x00, 0xF2, 0x04, 0xF2, 0x20, 0x02,
+	0x0F, 0x22, 0x02, 0x0F, 0x23, 0x01, 0x00, 0x00, 0x00, 0x14, 0x2D, 0x01, 0x34, 0x3A, 0x01, 0x26, 0x29, 0x02, 0x23, 0x3B, 0x02, 0x24, 0x39, 0x03, 0x25, 0x37, 0x04, 0x2E, 0x05, 0x0F, 0x06, 0x25,
+	0x0E, 0x00, 0x00, 0x00, 0x25, 0x43, 0x15, 0x01, 0x25, 0x62, 0x24, 0x25, 0x31, 0x32, 0x22, 0x01, 0x25, 0x21, 0x24, 0x22, 0x01, 0x25, 0x21, 0x24, 0x21, 0x02, 0x92, 0x52, 0x03, 0xF2, 0x04, 0x25,
+	0x44, 0x06, 0x25, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x25, 0x0E, 0x00, 0x00, 0x00, 0x25, 0x43, 0x15, 0x01, 0x25, 0x62, 0x24, 0x25, 0x31, 0x32, 0x22, 0x01, 0x25, 0x21, 0x24, 0x12, 0x02,
+	0x25, 0x21, 0x33, 0x21, 0x02, 0xF2, 0x10, 0x03, 0x72, 0x42, 0x06, 0x25, 0x0E, 0x00, 0x12, 0x22, 0x0E, 0x43, 0x0E, 0x21, 0x31, 0x0E, 0x22, 0x21, 0x0E, 0x13, 0x0F, 0x02, 0x28, 0x0B, 0x00, 0x00,
+	0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x28, 0x37, 0x01, 0x28, 0x28, 0x01, 0x00, 0x18, 0x29, 0x01, 0x27, 0x24, 0x23, 0x01, 0x00, 0x00, 0xC3, 0x23, 0x01, 0xB3, 0x24, 0x01, 0x27, 0x29, 0x01, 0x00,
+	0x27, 0x0C, 0x00, 0x29, 0x0A, 0x38, 0x0A, 0x28, 0x0B, 0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x28, 0x37, 0x01, 0x28, 0x28, 0x01, 0x18, 0x29, 0x01, 0x27, 0x24, 0x23, 0x01, 0x00, 0x00, 0xC3, 0x23,
+	0x01, 0xB3, 0x24, 0x01, 0x27, 0x29, 0x01, 0x22, 0x23, 0x29, 0x01, 0x24, 0x21, 0x0C, 0x12, 0x24, 0x0C, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x1B, 0x09, 0x2A, 0x09, 0x00, 0x23, 0x25, 0x09, 0x23, 0x34,
+	0x09, 0x23, 0x34, 0x32, 0x04, 0x23, 0xA3, 0x03, 0x23, 0x22, 0x11, 0x11, 0x33, 0x02, 0x23, 0x12, 0x22, 0x25, 0x02, 0x23, 0x11, 0x32, 0x26, 0x01, 0x43, 0x22, 0x27, 0x01, 0x33, 0x23, 0x27, 0x01,
+	0x32, 0x24, 0x27, 0x01, 0x14, 0x24, 0x17, 0x02, 0x29, 0x0A, 0x00, 0x0F, 0x06, 0x1B, 0x09, 0x2A, 0x09, 0x00, 0x23, 0x25, 0x09, 0x23, 0x34, 0x09, 0x23, 0x34, 0x32, 0x04, 0x23, 0xA3, 0x03, 0x23,
+	0x22, 0x11, 0x11, 0x33, 0x02, 0x23, 0x12, 0x22, 0x25, 0x02, 0x23, 0x11, 0x32, 0x26, 0x01, 0x43, 0x22, 0x27, 0x01, 0x33, 0x23, 0x27, 0x01, 0x32, 0x24, 0x27, 0x01, 0x14, 0x11, 0x22, 0x17, 0x02,
+	0x17, 0x21, 0x0A, 0x15, 0x23, 0x0A, 0x26, 0x0D, 0x17, 0x0D, 0x0F, 0x06, 0x26, 0x0D, 0x26, 0x2A, 0x01, 0x26, 0x57, 0x01, 0x26, 0x64, 0x03, 0x86, 0x07, 0x92, 0x0A, 0x32, 0x21, 0x0D, 0x16, 0x0E,
+	0x25, 0x47, 0x03, 0x25, 0x21, 0x54, 0x02, 0x25, 0x21, 0x27, 0x02, 0x28, 0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x23, 0x01, 0x26, 0x0D, 0x26, 0x2A, 0x01, 0x26, 0x57, 0x01, 0x26, 0x64,
+	0x03, 0x26, 0x61, 0x06, 0xA2, 0x09, 0x32, 0x21, 0x0D, 0x16, 0x0E, 0x25, 0x47, 0x03, 0x25, 0x22, 0x53, 0x02, 0x25, 0x22, 0x26, 0x02, 0x29, 0x27, 0x01, 0x00, 0x00, 0x23, 0x24, 0x27, 0x01, 0x34,
+	0x22, 0x27, 0x01, 0x22, 0x12, 0x22, 0x27, 0x01, 0x33, 0x2C, 0x01, 0x14, 0x0F, 0x01, 0x0F, 0x06, 0x25, 0x0E, 0x00, 0x25, 0x26, 0x06, 0x25, 0x53, 0x06, 0x95, 0x13, 0x03, 0x62, 0x14, 0x25, 0x01,
+	0x12, 0x22, 0x24, 0x25, 0x01, 0x25, 0x14, 0x26, 0x01, 0x25, 0x23, 0x26, 0x01, 0x00, 0x00, 0x24, 0x24, 0x25, 0x02, 0x00, 0x24, 0x25, 0x33, 0x02, 0x7B, 0x03, 0x3D, 0x05, 0x26, 0x0D, 0x00, 0x26,
+	0x25, 0x06, 0x26, 0x52, 0x06, 0x86, 0x13, 0x03, 0x63, 0x13, 0x25, 0x01, 0x13, 0x22, 0x23, 0x25, 0x01, 0x26, 0x13, 0x26, 0x01, 0x26, 0x22, 0x26, 0x01, 0x00, 0x00, 0x25, 0x23, 0x25, 0x02, 0x00,
+	0x25, 0x24, 0x23, 0x03, 0x22, 0x77, 0x03, 0x33, 0x37, 0x05, 0x12, 0x12, 0x0F, 0x31, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x1B, 0x09, 0x2A, 0x09, 0x00, 0x1A, 0x0A, 0x29, 0x17, 0x02,
+	0x29, 0x27, 0x01, 0x00, 0x28, 0x28, 0x01, 0x28, 0x27, 0x02, 0x00, 0x00, 0x38, 0x25, 0x03, 0x39, 0x33, 0x03, 0x7A, 0x04, 0x4B, 0x06, 0x18, 0x0C, 0x28, 0x0B, 0x18, 0x0C, 0x27, 0x0C, 0x00, 0x26,
+	0x0D, 0x26, 0x29, 0x02, 0x00, 0x25, 0x2A, 0x02, 0x25, 0x1A, 0x03, 0x25, 0x29, 0x03, 0x00, 0x00, 0x25, 0x28, 0x04, 0x26, 0x36, 0x04, 0x36, 0x34, 0x05, 0x87, 0x06, 0x49, 0x08, 0x18, 0x0C, 0x28,
+	0x0B, 0x18, 0x0C, 0x27, 0x0C, 0x00, 0x26, 0x0D, 0x26, 0x29, 0x02, 0x00, 0x16, 0x2A, 0x02, 0x25, 0x1A, 0x03, 0x25, 0x29, 0x03, 0x00, 0x00, 0x25, 0x28, 0x04, 0x12, 0x23, 0x36, 0x04, 0x23, 0x31,
+	0x34, 0x05, 0x11, 0x12, 0x82, 0x06, 0x21, 0x46, 0x08, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x16, 0x0E, 0x25, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x25, 0x44, 0x06, 0x25, 0x82, 0x04, 0x15, 0x22, 0x35, 0x03,
+	0x15, 0x21, 0x27, 0x03, 0x35, 0x29, 0x02, 0x34, 0x2A, 0x02, 0x24, 0x2C, 0x01, 0x00, 0x00, 0x24, 0x0F, 0x00, 0x0F, 0x06, 0x16, 0x0E, 0x25, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x25, 0x44, 0x06, 0x25,
+	0x82, 0x04, 0x15, 0x22, 0x35, 0x03, 0x15, 0x21, 0x27, 0x03, 0x35, 0x29, 0x02, 0x34, 0x2A, 0x02, 0x24, 0x2C, 0x01, 0x24, 0x22, 0x28, 0x01, 0x24, 0x33, 0x26, 0x01, 0x24, 0x12, 0x12, 0x09, 0x24,
+	0x22, 0x0B, 0x1A, 0x0A, 0x0F, 0x06, 0x00, 0x00, 0x4D, 0x04, 0x23, 0x67, 0x03, 0x43, 0x34, 0x23, 0x02, 0x45, 0x21, 0x25, 0x02, 0x47, 0x27, 0x01, 0x29, 0x27, 0x01, 0x28, 0x28, 0x01, 0x00, 0x27,
+	0x29, 0x01, 0x17, 0x2A, 0x01, 0x26, 0x2A, 0x01, 0x16, 0x2B, 0x01, 0x25, 0x3A, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x06, 0x00, 0x00, 0x4D, 0x04, 0x23, 0x67, 0x03, 0x43, 0x34, 0x23, 0x02, 0x45, 0x21,
+	0x25, 0x02, 0x47, 0x27, 0x01, 0x29, 0x27, 0x01, 0x28, 0x28, 0x01, 0x00, 0x27, 0x29, 0x01, 0x17, 0x2A, 0x01, 0x26, 0x2A, 0x01, 0x25, 0x2B, 0x01, 0x13, 0x12, 0x3A, 0x01, 0x24, 0x2B, 0x02, 0x21,
+	0x12, 0x0F, 0x22, 0x0F, 0x02, 0x0F, 0x06, 0x26, 0x17, 0x05, 0x26, 0x26, 0x05, 0x26, 0x34, 0x06, 0x26, 0x42, 0x07, 0x66, 0x09, 0x55, 0x26, 0x03, 0x62, 0x47, 0x02, 0x32, 0x11, 0x27, 0x22, 0x01,
+	0x25, 0x27, 0x22, 0x01, 0x00, 0x2E, 0x22, 0x01, 0xA9, 0x02, 0x16, 0x92, 0x03, 0x35, 0x27, 0x04, 0x26, 0x18, 0x04, 0x27, 0x27, 0x03, 0x27, 0x18, 0x03, 0x28, 0x0B, 0x0F, 0x06, 0xA8, 0x03, 0xF3,
+	0x20, 0x01, 0x53, 0x57, 0x01, 0x2D, 0x06, 0x0F, 0x06, 0x00, 0x4D, 0x04, 0x25, 0x56, 0x03, 0x25, 0x29, 0x03, 0x25, 0x2A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x31, 0x02, 0x4D, 0x04,
+	0x7B, 0x03, 0x34, 0x23, 0x25, 0x02, 0x46, 0x27, 0x02, 0x48, 0x34, 0x02, 0x27, 0x32, 0x31, 0x03, 0x26, 0x45, 0x04, 0x26, 0x43, 0x06, 0x25, 0x51, 0x08, 0x82, 0x35, 0x03, 0x52, 0x57, 0x02, 0x25,
+	0x26, 0x23, 0x01, 0x00, 0x35, 0x25, 0x23, 0x01, 0x26, 0x16, 0x22, 0x02, 0x36, 0x55, 0x02, 0x98, 0x04, 0x99, 0x03, 0x0F, 0x31, 0x02, 0x1F, 0x05, 0x26, 0x36, 0x04, 0x26, 0x15, 0x07, 0x26, 0x23,
+	0x08, 0x26, 0xA2, 0x01, 0xF2, 0x30, 0x01, 0x82, 0x0B, 0x16, 0x21, 0x0B, 0x27, 0x0C, 0x17, 0x27, 0x04, 0x26, 0x46, 0x03, 0x16, 0x26, 0x22, 0x02, 0x25, 0x26, 0x22, 0x02, 0x00, 0x00, 0x36, 0x15,
+	0x21, 0x03, 0xA7, 0x04, 0x79, 0x05, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x5A, 0x06, 0x98, 0x04, 0x37, 0x35, 0x03, 0x36, 0x27, 0x03, 0x35, 0x28, 0x03, 0x25, 0x28, 0x04, 0x34, 0x36, 0x05, 0x24, 0x63,
+	0x06, 0x84, 0x16, 0x02, 0x34, 0x2B, 0x01, 0x24, 0x1C, 0x02, 0x15, 0x2B, 0x02, 0x25, 0x2A, 0x02, 0x26, 0x28, 0x03, 0x36, 0x35, 0x04, 0x88, 0x05, 0x59, 0x07, 0x0F, 0x06, 0xA8, 0x03, 0xF3, 0x20,
+	0x01, 0x53, 0x57, 0x01, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x3F, 0x03, 0x27, 0x55, 0x02, 0x27, 0x25, 0x31, 0x01, 0x27, 0x24, 0x23, 0x01, 0x00, 0x27, 0x24, 0x32, 0x01, 0xF3, 0x10, 0x02, 0xF3, 0x03,
+	0x13, 0x22, 0x26, 0x05, 0x26, 0x27, 0x04, 0x26, 0x28, 0x03, 0x16, 0x29, 0x03, 0x0F, 0x06, 0xA8, 0x03, 0xF3, 0x20, 0x01, 0x43, 0x67, 0x01, 0x2C, 0x07, 0x0F, 0x06, 0x3F, 0x03, 0x27, 0x55, 0x02,
+	0x27, 0x25, 0x31, 0x01, 0x27, 0x24, 0x23, 0x01, 0x00, 0x00, 0xC3, 0x32, 0x01, 0xF3, 0x10, 0x02, 0x27, 0x63, 0x03, 0x22, 0x23, 0x25, 0x05, 0x24, 0x21, 0x26, 0x04, 0x12, 0x14, 0x28, 0x03, 0x23,
+	0x2B, 0x03, 0x0F, 0x06, 0x99, 0x03, 0xF3, 0x20, 0x01, 0x43, 0x67, 0x01, 0x2C, 0x07, 0x0F, 0x06, 0x3F, 0x03, 0x27, 0x55, 0x02, 0x27, 0x25, 0x31, 0x01, 0x27, 0x24, 0x23, 0x01, 0x00, 0x00, 0xC3,
+	0x32, 0x01, 0xF3, 0x10, 0x02, 0x27, 0x63, 0x03, 0x32, 0x22, 0x25, 0x05, 0x11, 0x13, 0x21, 0x26, 0x04, 0x11, 0x13, 0x21, 0x27, 0x03, 0x32, 0x1B, 0x04, 0x0F, 0x06, 0x24, 0x0F, 0x24, 0x65, 0x04,
+	0x24, 0x93, 0x03, 0x24, 0x32, 0x35, 0x02, 0x14, 0x31, 0x38, 0x01, 0x43, 0x2B, 0x01, 0x33, 0x2C, 0x01, 0x23, 0x2D, 0x01, 0x0F, 0x23, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x31, 0x02, 0x23, 0x3A, 0x03,
+	0xE3, 0x04, 0xA4, 0x07, 0x37, 0x0B, 0x39, 0x09, 0x4A, 0x07, 0x1C, 0x08, 0x0F, 0x06, 0x25, 0x0E, 0x25, 0x65, 0x03, 0x25, 0x93, 0x02, 0x25, 0x32, 0x35, 0x01, 0x15, 0x31, 0x38, 0x44, 0x2B, 0x34,
+	0x2C, 0x24, 0x2D, 0x0F, 0x24, 0x0F, 0x23, 0x01, 0x0F, 0x32, 0x01, 0x24, 0x3A, 0x02, 0xE4, 0x03, 0xA5, 0x06, 0x13, 0x34, 0x0A, 0x33, 0x34, 0x08, 0x12, 0x48, 0x06, 0x32, 0x18, 0x07, 0x0F, 0x06,
+	0x25, 0x0E, 0x25, 0x65, 0x03, 0x25, 0x93, 0x02, 0x25, 0x32, 0x35, 0x01, 0x15, 0x31, 0x38, 0x35, 0x2B, 0x34, 0x2C, 0x24, 0x2D, 0x0F, 0x24, 0x0F, 0x23, 0x01, 0x0F, 0x32, 0x01, 0x14, 0x4A, 0x02,
+	0xE4, 0x03, 0xA5, 0x06, 0x23, 0x33, 0x0A, 0x12, 0x12, 0x34, 0x08, 0x12, 0x12, 0x45, 0x06, 0x23, 0x18, 0x07, 0x0F, 0x22, 0x02, 0x0F, 0x21, 0x03, 0x2F, 0x04, 0x3E, 0x04, 0x2E, 0x05, 0x2D, 0x12,
+	0x03, 0x0F, 0x23, 0x01, 0x13, 0x25, 0x27, 0x01, 0x23, 0x25, 0x26, 0x01, 0x14, 0x26, 0x25, 0x01, 0x24, 0x11, 0x34, 0x32, 0x01, 0x35, 0x65, 0x02, 0x25, 0x38, 0x03, 0x0F, 0x06, 0x1B, 0x09, 0x2B,
+	0x08, 0x3C, 0x06, 0x4E, 0x03, 0x0F, 0x21, 0x03, 0x0F, 0x21, 0x03, 0x2F, 0x04, 0x00, 0x2E, 0x05, 0x2D, 0x12, 0x03, 0x0F, 0x23, 0x01, 0x13, 0x25, 0x27, 0x01, 0x23, 0x25, 0x26, 0x01, 0x14, 0x26,
+	0x25, 0x01, 0x24, 0x11, 0x34, 0x32, 0x01, 0x35, 0x65, 0x02, 0x25, 0x38, 0x03, 0x0F, 0x06, 0x1B, 0x09, 0x25, 0x24, 0x08, 0x26, 0x34, 0x06, 0x14, 0x49, 0x03, 0x25, 0x29, 0x03, 0x16, 0x0E, 0x0F,
+	0x21, 0x03, 0x2F, 0x04, 0x00, 0x2E, 0x05, 0x2D, 0x12, 0x03, 0x0F, 0x23, 0x01, 0x23, 0x24, 0x27, 0x01, 0x23, 0x25, 0x26, 0x01, 0x24, 0x25, 0x25, 0x01, 0x24, 0x21, 0x33, 0x32, 0x01, 0x35, 0x65,
+	0x02, 0x26, 0x37, 0x03, 0x0F, 0x06, 0x1C, 0x08, 0x35, 0x33, 0x07, 0x14, 0x13, 0x33, 0x06, 0x14, 0x13, 0x35, 0x04, 0x14, 0x13, 0x36, 0x03, 0x35, 0x19, 0x03, 0x1D, 0x07, 0x3C, 0x06, 0x3B, 0x07,
+	0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x36, 0x0C, 0x26, 0x0D, 0x00, 0x37, 0x0B, 0x38, 0x0A, 0x39, 0x09, 0x3A, 0x08, 0x2C, 0x07, 0x2D, 0x06, 0x2E, 0x05, 0x2F, 0x04, 0x0F, 0x31, 0x02, 0x0F, 0x12,
+	0x03, 0x1D, 0x07, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x36, 0x0C, 0x26, 0x0D, 0x36, 0x0C, 0x37, 0x0B, 0x38, 0x0A, 0x39, 0x09, 0x15, 0x34, 0x08, 0x25, 0x25, 0x07, 0x36,
+	0x24, 0x06, 0x14, 0x13, 0x25, 0x05, 0x24, 0x29, 0x04, 0x35, 0x38, 0x02, 0x17, 0x19, 0x03, 0x1D, 0x07, 0x2D, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x39, 0x09, 0x28, 0x0B, 0x27, 0x0C, 0x26, 0x0D, 0x00,
+	0x27, 0x0C, 0x38, 0x0A, 0x39, 0x09, 0x3A, 0x08, 0x35, 0x33, 0x07, 0x14, 0x13, 0x24, 0x06, 0x14, 0x13, 0x25, 0x05, 0x14, 0x13, 0x26, 0x04, 0x35, 0x38, 0x02, 0x0F, 0x12, 0x03, 0x0F, 0x06, 0xA8,
+	0x03, 0xF3, 0x20, 0x01, 0x53, 0x57, 0x01, 0x3C, 0x06, 0x0F, 0x06, 0x00, 0x3F, 0x03, 0x24, 0x23, 0x53, 0x02, 0x24, 0x23, 0x22, 0x23, 0x01, 0x00, 0x00, 0xB4, 0x23, 0x01, 0xF4, 0x02, 0x24, 0x23,
+	0x43, 0x03, 0x14, 0x24, 0x14, 0x05, 0x14, 0x24, 0x24, 0x04, 0x29, 0x25, 0x03, 0x0F, 0x21, 0x03, 0x0F, 0x06, 0x99, 0x03, 0xF3, 0x20, 0x01, 0x43, 0x58, 0x01, 0x2D, 0x06, 0x0F, 0x06, 0x0F, 0x21,
+	0x03, 0x24, 0x23, 0x44, 0x02, 0x24, 0x23, 0x23, 0x22, 0x01, 0x00, 0x00, 0x00, 0xF4, 0x02, 0x00, 0x24, 0x23, 0x24, 0x04, 0x24, 0x23, 0x15, 0x04, 0x42, 0x23, 0x25, 0x03, 0x24, 0x23, 0x16, 0x03,
+	0x31, 0x0F, 0x02, 0x0F, 0x06, 0x99, 0x03, 0xF3, 0x20, 0x01, 0x43, 0x58, 0x01, 0x2D, 0x06, 0x0F, 0x06, 0x0F, 0x21, 0x03, 0x24, 0x23, 0x44, 0x02, 0x24, 0x23, 0x23, 0x22, 0x01, 0x00, 0x00, 0x00,
+	0xF4, 0x02, 0x00, 0x24, 0x23, 0x24, 0x04, 0x42, 0x23, 0x15, 0x04, 0x11, 0x12, 0x24, 0x25, 0x03, 0x11, 0x12, 0x1C, 0x03, 0x22, 0x0F, 0x02, 0x0F, 0x06, 0x00, 0x00, 0x25, 0x22, 0x34, 0x03, 0x25,
+	0x22, 0x53, 0x02, 0x25, 0x22, 0x23, 0x22, 0x01, 0x25, 0x22, 0x22, 0x23, 0x01, 0x00, 0x00, 0xF2, 0x20, 0x02, 0xF2, 0x10, 0x03, 0x24, 0x23, 0x23, 0x05, 0x00, 0x24, 0x23, 0x24, 0x04, 0x00, 0x14,
+	0x24, 0x25, 0x03, 0x23, 0x14, 0x27, 0x02, 0x3D, 0x05, 0x5C, 0x04, 0x2B, 0x23, 0x03, 0x2A, 0x24, 0x03, 0x23, 0x15, 0x34, 0x03, 0x23, 0x15, 0x33, 0x04, 0x23, 0x55, 0x06, 0x23, 0x44, 0x08, 0x23,
+	0x42, 0x0A, 0x63, 0x11, 0x17, 0x02, 0x33, 0x14, 0x27, 0x01, 0x13, 0x26, 0x25, 0x02, 0x2A, 0x34, 0x02, 0x1B, 0x33, 0x03, 0x5B, 0x05, 0x68, 0x07, 0x00, 0x3C, 0x06, 0x2D, 0x06, 0x0F, 0x06, 0x25,
+	0x35, 0x06, 0x25, 0x63, 0x05, 0x25, 0x32, 0x23, 0x04, 0x25, 0x22, 0x44, 0x02, 0xF2, 0x20, 0x02, 0xD2, 0x23, 0x01, 0x25, 0x2B, 0x01, 0x00, 0x15, 0x2C, 0x01, 0x24, 0x2C, 0x01, 0x0F, 0x23, 0x01,
+	0x00, 0x15, 0x2C, 0x01, 0x24, 0x2B, 0x02, 0x25, 0x57, 0x02, 0x26, 0x46, 0x03, 0x37, 0x0B, 0x18, 0x0C, 0x0F, 0x06, 0x5C, 0x04, 0x7B, 0x03, 0x13, 0x35, 0x34, 0x02, 0x73, 0x27, 0x02, 0x65, 0x26,
+	0x02, 0x17, 0x41, 0x23, 0x03, 0x26, 0x54, 0x04, 0x25, 0x45, 0x05, 0x25, 0x43, 0x21, 0x04, 0x75, 0x27, 0x62, 0x1B, 0x01, 0x22, 0x21, 0x2B, 0x01, 0x26, 0x2A, 0x01, 0x36, 0x28, 0x02, 0x37, 0x35,
+	0x03, 0x98, 0x04, 0x5A, 0x06, 0x1B, 0x09, 0x25, 0x23, 0x09, 0x25, 0x14, 0x09, 0x16, 0x24, 0x08, 0x26, 0x23, 0x08, 0x26, 0x81, 0x04, 0xF2, 0x20, 0x02, 0x82, 0x21, 0x24, 0x02, 0x26, 0x23, 0x25,
+	0x01, 0x00, 0x00, 0x00, 0x0F, 0x23, 0x01, 0x1A, 0x26, 0x02, 0x3A, 0x33, 0x02, 0x7B, 0x03, 0x4D, 0x04, 0x0F, 0x06, 0x1C, 0x08, 0x2C, 0x07, 0x17, 0x14, 0x08, 0x37, 0x21, 0x08, 0x48, 0x09, 0x5A,
+	0x06, 0x1A, 0x52, 0x03, 0x25, 0x22, 0x55, 0x26, 0x21, 0x12, 0x25, 0x37, 0x24, 0x05, 0x28, 0x24, 0x05, 0x00, 0x00, 0x38, 0x32, 0x05, 0x69, 0x06, 0x4A, 0x07, 0x2A, 0x09, 0x29, 0x0A, 0x14, 0x24,
+	0x0A, 0x43, 0x12, 0x0B, 0x55, 0x0B, 0x48, 0x09, 0x27, 0x51, 0x06, 0x12, 0x24, 0x63, 0x03, 0x22, 0x22, 0x57, 0x01, 0x23, 0x21, 0x2A, 0x01, 0x14, 0x11, 0x34, 0x07, 0x25, 0x25, 0x07, 0x00, 0x00,
+	0x00, 0x26, 0x23, 0x08, 0x76, 0x08, 0x38, 0x0A, 0x0F, 0x06, 0x00, 0x00, 0x88, 0x05, 0xB7, 0x03, 0x17, 0x33, 0x07, 0x2A, 0x09, 0x19, 0x33, 0x13, 0x01, 0x28, 0x25, 0x31, 0x16, 0x11, 0x37, 0x02,
+	0xC6, 0x03, 0x87, 0x21, 0x03, 0x18, 0x27, 0x03, 0x18, 0x36, 0x03, 0x29, 0x33, 0x04, 0x79, 0x05, 0x5A, 0x06, 0x0F, 0x06, 0x00, 0x96, 0x06, 0xD4, 0x04, 0x14, 0x35, 0x13, 0x04, 0x29, 0x0A, 0x27,
+	0x23, 0x07, 0x26, 0x25, 0x14, 0x01, 0x26, 0x26, 0x31, 0x01, 0x12, 0x22, 0x57, 0x02, 0xF2, 0x04, 0xA4, 0x21, 0x04, 0x25, 0x28, 0x04, 0x00, 0x26, 0x26, 0x05, 0x36, 0x34, 0x05, 0x87, 0x06, 0x49,
+	0x08, 0x0F, 0x06, 0x00, 0x00, 0x0F, 0x31, 0x02, 0x5F, 0x01, 0x3E, 0x31, 0x2E, 0x23, 0x00, 0xA6, 0x23, 0xE6, 0x01, 0x29, 0x44, 0x02, 0x29, 0x24, 0x04, 0x29, 0x15, 0x04, 0x29, 0x25, 0x03, 0x29,
+	0x26, 0x02, 0x0F, 0x23, 0x01, 0x0F, 0x06, 0x3F, 0x03, 0x5E, 0x02, 0x2E, 0x31, 0x01, 0x2D, 0x23, 0x01, 0x00, 0x00, 0x00, 0xD2, 0x32, 0x01, 0xF2, 0x20, 0x02, 0x36, 0x45, 0x03, 0x36, 0x25, 0x05,
+	0x26, 0x17, 0x05, 0x26, 0x27, 0x04, 0x26, 0x18, 0x04, 0x26, 0x28, 0x03, 0x0F, 0x22, 0x02, 0x0F, 0x06, 0x00, 0x00, 0x15, 0x72, 0x06, 0x86, 0x07, 0x13, 0x27, 0x15, 0x02, 0x22, 0x27, 0x25, 0x01,
+	0x22, 0x26, 0x26, 0x01, 0x22, 0x16, 0x27, 0x01, 0x13, 0x25, 0x27, 0x01, 0x23, 0x24, 0x27, 0x01, 0x00, 0x23, 0x24, 0x26, 0x02, 0x23, 0x34, 0x25, 0x02, 0x2A, 0x33, 0x03, 0x7B, 0x03, 0x4C, 0x05,
+	0x0F, 0x06, 0x00, 0x00, 0x86, 0x07, 0xC2, 0x07, 0x22, 0x33, 0x0B, 0x26, 0x2A, 0x01, 0x25, 0x2B, 0x01, 0x24, 0x1C, 0x02, 0x23, 0x2C, 0x02, 0x00, 0x23, 0x2B, 0x03, 0x33, 0x39, 0x03, 0x44, 0x45,
+	0x04, 0xB5, 0x05, 0x77, 0x07, 0x0F, 0x06, 0x1D, 0x07, 0x2D, 0x06, 0x2C, 0x07, 0x23, 0x26, 0x08, 0x23, 0x35, 0x23, 0x03, 0x23, 0x34, 0x43, 0x02, 0x23, 0x43, 0x22, 0x22, 0x01, 0x23, 0x13, 0x11,
+	0x23, 0x22, 0x01, 0x23, 0x42, 0x23, 0x22, 0x01, 0x23, 0x21, 0x21, 0x24, 0x21, 0x01, 0x43, 0x22, 0x54, 0x01, 0x33, 0x23, 0x36, 0x01, 0x23, 0x25, 0x25, 0x02, 0x14, 0x35, 0x33, 0x02, 0x7B, 0x03,
+	0x4C, 0x05, 0x1F, 0x05, 0x26, 0x36, 0x04, 0x26, 0x15, 0x07, 0x26, 0x23, 0x08, 0x16, 0xA3, 0x01, 0xF2, 0x30, 0x01, 0x92, 0x0A, 0x16, 0x21, 0x0B, 0x18, 0x0C, 0x17, 0x0D, 0x26, 0x0D, 0x25, 0x0E,
+	0x00, 0x25, 0x56, 0x03, 0xE5, 0x02, 0x47, 0x26, 0x02, 0x0F, 0x22, 0x02, 0x00, 0x0F, 0x21, 0x03, 0x0F, 0x06, 0x1D, 0x07, 0x2D, 0x06, 0x2C, 0x07, 0x23, 0x26, 0x08, 0x23, 0x35, 0x15, 0x02, 0x23,
+	0x34, 0x26, 0x01, 0x00, 0x23, 0x13, 0x11, 0x27, 0x01, 0x23, 0x12, 0x21, 0x27, 0x01, 0x23, 0x21, 0x21, 0x27, 0x01, 0x43, 0x22, 0x17, 0x02, 0x33, 0x23, 0x26, 0x02, 0x23, 0x25, 0x25, 0x02, 0x14,
+	0x35, 0x23, 0x03, 0x7B, 0x03, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x28, 0x26, 0x03, 0x28, 0x24, 0x05, 0x28, 0x13, 0x07, 0x28, 0x82, 0x01, 0xF5, 0x01, 0x75, 0x09, 0x18, 0x11, 0x0A, 0x29, 0x0A, 0x19,
+	0x18, 0x02, 0x28, 0x27, 0x02, 0x00, 0x28, 0x26, 0x03, 0x29, 0x34, 0x03, 0x7A, 0x04, 0x4B, 0x06, 0x1F, 0x05, 0x26, 0x36, 0x04, 0x26, 0x25, 0x06, 0x26, 0x23, 0x08, 0x25, 0xA3, 0x01, 0xF2, 0x30,
+	0x01, 0x92, 0x0A, 0x16, 0x12, 0x0B, 0x18, 0x0C, 0x27, 0x0C, 0x17, 0x19, 0x03, 0x26, 0x29, 0x02, 0x00, 0x26, 0x19, 0x03, 0x26, 0x28, 0x03, 0x27, 0x26, 0x04, 0x37, 0x34, 0x04, 0x88, 0x05, 0x4A,
+	0x07, 0x0F, 0x06, 0x4E, 0x03, 0x7C, 0x02, 0x3B, 0x23, 0x02, 0x23, 0x25, 0x25, 0x02, 0x23, 0x24, 0x25, 0x03, 0x23, 0x14, 0x34, 0x04, 0x23, 0x23, 0x41, 0x06, 0x23, 0x53, 0x23, 0x03, 0x23, 0x51,
+	0x44, 0x02, 0x63, 0x25, 0x22, 0x01, 0x23, 0x22, 0x25, 0x22, 0x01, 0x27, 0x25, 0x22, 0x01, 0x27, 0x26, 0x21, 0x01, 0x28, 0x27, 0x02, 0x29, 0x35, 0x02, 0x8A, 0x03, 0x5B, 0x05, 0x0F, 0x14, 0x01,
+	0x19, 0x28, 0x01, 0x29, 0x26, 0x02, 0x28, 0x26, 0x03, 0x23, 0x13, 0x26, 0x04, 0x23, 0x22, 0x21, 0x32, 0x04, 0x23, 0x12, 0x72, 0x04, 0x23, 0x21, 0x11, 0x32, 0x21, 0x03, 0x23, 0x11, 0x12, 0x22,
+	0x23, 0x02, 0x43, 0x12, 0x22, 0x24, 0x01, 0x43, 0x52, 0x33, 0x01, 0x23, 0x11, 0x43, 0x22, 0x03, 0x23, 0x11, 0x25, 0x21, 0x04, 0x13, 0x22, 0x23, 0x22, 0x04, 0x57, 0x23, 0x04, 0x38, 0x25, 0x03,
+	0x0F, 0x42, 0x0F, 0x23, 0x01, 0x0F, 0x06, 0x1C, 0x08, 0x25, 0x34, 0x07, 0x25, 0x33, 0x08, 0x25, 0x22, 0x0A, 0x25, 0x31, 0x34, 0x03, 0x35, 0x11, 0x54, 0x02, 0x52, 0x21, 0x23, 0x32, 0x01, 0x22,
+	0x21, 0x21, 0x22, 0x24, 0x01, 0x25, 0x31, 0x11, 0x25, 0x01, 0x25, 0x72, 0x22, 0x01, 0x25, 0x63, 0x22, 0x01, 0x25, 0x23, 0x26, 0x01, 0x15, 0x14, 0x27, 0x01, 0x24, 0x23, 0x27, 0x01, 0x38, 0x27,
+	0x01, 0x28, 0x28, 0x01, 0x28, 0x0B, 0x0F, 0x06, 0x0F, 0x32, 0x01, 0x5F, 0x01, 0x4D, 0x04, 0x4B, 0x06, 0x59, 0x07, 0x67, 0x08, 0x45, 0x21, 0x09, 0x43, 0x23, 0x09, 0x23, 0x25, 0x09, 0x13, 0x96,
+	0x02, 0x7C, 0x02, 0x0F, 0x23, 0x01, 0x00, 0x00, 0x0F, 0x32, 0x01, 0x0F, 0x31, 0x02, 0x4E, 0x03, 0x3D, 0x05, 0x0F, 0x06, 0x18, 0x0C, 0x38, 0x0A, 0x28, 0x0B, 0x22, 0x24, 0x18, 0x02, 0x22, 0x24,
+	0x28, 0x01, 0x22, 0x23, 0x29, 0x01, 0x13, 0x23, 0x19, 0x02, 0x23, 0x22, 0x28, 0x02, 0x00, 0x23, 0x22, 0x27, 0x03, 0x23, 0x32, 0x35, 0x03, 0x23, 0x33, 0x33, 0x04, 0x14, 0x74, 0x05, 0x34, 0x43,
+	0x07, 0x26, 0x0D, 0x23, 0x0F, 0x01, 0x34, 0x0E, 0x16, 0x0E, 0x0F, 0x06, 0x00, 0x1A, 0x0A, 0x2A, 0x35, 0x01, 0x29, 0x35, 0x02, 0x29, 0x42, 0x04, 0x69, 0x06, 0x66, 0x26, 0x01, 0x26, 0x21, 0x27,
+	0x01, 0x29, 0x27, 0x01, 0x29, 0x36, 0x01, 0x8A, 0x03, 0x5B, 0x05, 0x17, 0x0D, 0x27, 0x0C, 0x38, 0x0A, 0x5A, 0x06, 0x2C, 0x07, 0x0F, 0x06, 0x00, 0x00, 0x8A, 0x03, 0xE7, 0x27, 0x57, 0x1F, 0x05,
+	0x0F, 0x06, 0x2A, 0x09, 0x00, 0x2A, 0x18, 0x2A, 0x27, 0x2A, 0x35, 0x01, 0xD6, 0x02, 0xB6, 0x04, 0x2A, 0x09, 0x00, 0x00, 0x23, 0x0F, 0x01, 0x15, 0x0F, 0x11, 0x0F, 0x04, 0x22, 0x0F, 0x02, 0x14,
+	0x0F, 0x01, 0x12, 0x13, 0x0E, 0x00, 0x00, 0x33, 0x0F, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0D, 0x26, 0x18, 0x04, 0x27, 0x27, 0x03, 0x38, 0x15, 0x04, 0x39, 0x23, 0x04, 0x3A, 0x22,
+	0x04, 0x5B, 0x05, 0x4C, 0x05, 0x2E, 0x05, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0E, 0x26, 0x18, 0x04, 0x27, 0x27, 0x03, 0x28, 0x16, 0x04, 0x29, 0x24, 0x04, 0x14, 0x35, 0x22, 0x04, 0x34,
+	0x54, 0x05, 0x26, 0x44, 0x05, 0x23, 0x38, 0x05, 0x34, 0x0E, 0x15, 0x0F, 0x0F, 0x06, 0x0F, 0x23, 0x01, 0x0F, 0x32, 0x01, 0x4F, 0x02, 0x3E, 0x04, 0x4C, 0x13, 0x01, 0x4A, 0x24, 0x01, 0x58, 0x26,
+	0x46, 0x21, 0x26, 0x44, 0x22, 0x27, 0x51, 0x24, 0x27, 0x21, 0x12, 0x24, 0x26, 0x01, 0x25, 0x33, 0x33, 0x02, 0x25, 0x74, 0x03, 0x25, 0x45, 0x05, 0x16, 0x0E, 0x26, 0x0D, 0x16, 0x0E, 0x0F, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x19, 0x12, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x27, 0x0C, 0x27, 0x1A, 0x01, 0x27, 0x2A, 0x27, 0x29, 0x01, 0x27, 0x28, 0x02, 0x27,
+	0x46, 0x02, 0x27, 0x71, 0x04, 0x27, 0x51, 0x06, 0x27, 0x0C, 0x27, 0x13, 0x08, 0x27, 0x23, 0x07, 0x27, 0x31, 0x08, 0x57, 0x09, 0x37, 0x0B, 0x27, 0x0C, 0x0F, 0x06, 0x24, 0x0F, 0x24, 0x1C, 0x02,
+	0x24, 0x2C, 0x01, 0x00, 0x24, 0x2B, 0x02, 0x24, 0x3A, 0x02, 0x24, 0x48, 0x03, 0x24, 0x82, 0x05, 0x24, 0x52, 0x08, 0x24, 0x0F, 0x24, 0x14, 0x0A, 0x24, 0x24, 0x09, 0x24, 0x23, 0x0A, 0x24, 0x22,
+	0x0B, 0x54, 0x0C, 0x44, 0x0D, 0x24, 0x0F, 0x0F, 0x06, 0x00, 0x2D, 0x06, 0x00, 0x00, 0x2C, 0x07, 0x00, 0x2B, 0x08, 0x00, 0xBA, 0x00, 0x29, 0x0A, 0x28, 0x0B, 0x27, 0x0C, 0x36, 0x0C, 0x17, 0x0D,
+	0x0F, 0x06, 0x1C, 0x08, 0x2B, 0x08, 0x00, 0x00, 0x2A, 0x09, 0x00, 0x29, 0x0A, 0x00, 0x28, 0x0B, 0xC8, 0x01, 0xD7, 0x01, 0x36, 0x0C, 0x26, 0x0D, 0x25, 0x0E, 0x24, 0x0F, 0x23, 0x0F, 0x01, 0x14,
+	0x0F, 0x01, 0x0F, 0x06, 0x00, 0x00, 0x68, 0x07, 0x00, 0x28, 0x0B, 0x28, 0x19, 0x01, 0x28, 0x28, 0x01, 0x46, 0x28, 0x01, 0x46, 0x27, 0x02, 0x28, 0x27, 0x02, 0x28, 0x26, 0x03, 0x28, 0x25, 0x04,
+	0x28, 0x33, 0x05, 0x78, 0x06, 0x48, 0x09, 0x0F, 0x06, 0x00, 0x75, 0x09, 0x00, 0x25, 0x0E, 0x00, 0x25, 0x2B, 0x01, 0x25, 0x2A, 0x02, 0x61, 0x2A, 0x02, 0x61, 0x29, 0x03, 0x25, 0x29, 0x03, 0x25,
+	0x28, 0x04, 0x25, 0x27, 0x05, 0x25, 0x35, 0x06, 0x25, 0x43, 0x07, 0x75, 0x09, 0x45, 0x0C, 0x0F, 0x06, 0x00, 0x0F, 0x22, 0x02, 0x28, 0x27, 0x02, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x02, 0x00, 0x28,
+	0x27, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x03, 0x00, 0x25, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x03, 0x00, 0x25, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0x21, 0x03, 0x0F, 0x06, 0x00, 0x00, 0x29, 0x26, 0x02, 0x29, 0x25, 0x03, 0x29, 0x15, 0x04, 0x29, 0x24, 0x04, 0x29, 0x23, 0x05, 0x29, 0x22, 0x24, 0x29, 0x21, 0x25, 0x49, 0x26, 0xF6, 0xE6, 0x01,
+	0x29, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x26, 0x18, 0x04, 0x26, 0x27, 0x04, 0x26, 0x26, 0x05, 0x00, 0x26, 0x25, 0x06, 0x26, 0x24, 0x07, 0x26, 0x23, 0x25, 0x01, 0x26, 0x22, 0x26, 0x01, 0x26,
+	0x21, 0x27, 0x01, 0x46, 0x28, 0x01, 0xF2, 0x30, 0x01, 0xF2, 0x20, 0x02, 0x26, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x0F, 0x12, 0x03, 0x26, 0x29, 0x02, 0x26, 0x38, 0x02, 0x26, 0x37, 0x03,
+	0x26, 0x36, 0x04, 0x26, 0x44, 0x05, 0x26, 0x51, 0x07, 0xA2, 0x09, 0x72, 0x0C, 0x26, 0x29, 0x02, 0x00, 0x00, 0x00, 0x26, 0x47, 0x02, 0xB6, 0x04, 0x76, 0x08, 0x0F, 0x13, 0x02, 0x26, 0x2A, 0x01,
+	0x26, 0x39, 0x01, 0x26, 0x38, 0x02, 0x26, 0x37, 0x03, 0x26, 0x45, 0x04, 0x26, 0x61, 0x06, 0xB2, 0x08, 0x72, 0x0C, 0x26, 0x2A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x12, 0x23, 0x57, 0x01, 0x23, 0xC1,
+	0x03, 0x14, 0x81, 0x07, 0x21, 0x0F, 0x03, 0x22, 0x0F, 0x02, 0x0F, 0x06, 0x27, 0x24, 0x06, 0x00, 0x17, 0x25, 0x06, 0x17, 0x15, 0x07, 0x26, 0x15, 0x07, 0x26, 0x24, 0x07, 0x62, 0x24, 0x07, 0x92,
+	0x21, 0x07, 0xA6, 0x05, 0x16, 0x85, 0x01, 0x25, 0x15, 0x34, 0x01, 0x25, 0x24, 0x08, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x2A, 0x09, 0x0F, 0x06, 0x27, 0x24, 0x06, 0x00, 0x00, 0x00, 0x17, 0x15, 0x07,
+	0x00, 0x53, 0x24, 0x07, 0xB3, 0x07, 0xB6, 0x04, 0x26, 0x84, 0x01, 0x26, 0x14, 0x25, 0x01, 0x16, 0x15, 0x08, 0x16, 0x24, 0x08, 0x12, 0x22, 0x24, 0x08, 0x43, 0x24, 0x08, 0x11, 0x12, 0x26, 0x08,
+	0x31, 0x18, 0x08, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x1B, 0x09, 0x2A, 0x09, 0x29, 0x17, 0x02, 0x28, 0x28, 0x01, 0x37, 0x28, 0x01, 0x35, 0x29, 0x02, 0x43, 0x2A, 0x02, 0x52, 0x29, 0x03, 0x12, 0x22,
+	0x38, 0x03, 0x25, 0x37, 0x04, 0x25, 0x36, 0x05, 0x25, 0x35, 0x06, 0x25, 0x33, 0x08, 0x75, 0x09, 0x55, 0x0B, 0x25, 0x0E, 0x1B, 0x09, 0x2A, 0x09, 0x29, 0x17, 0x02, 0x38, 0x27, 0x01, 0x37, 0x28,
+	0x01, 0x36, 0x28, 0x02, 0x34, 0x2A, 0x02, 0x52, 0x29, 0x03, 0x22, 0x21, 0x38, 0x03, 0x25, 0x37, 0x04, 0x25, 0x27, 0x05, 0x25, 0x35, 0x06, 0x25, 0x34, 0x07, 0x25, 0x41, 0x09, 0x21, 0x62, 0x0A,
+	0x62, 0x0D, 0x11, 0x12, 0x0F, 0x01, 0x21, 0x0F, 0x03, 0x13, 0x0F, 0x02, 0x1B, 0x09, 0x2A, 0x09, 0x39, 0x09, 0x38, 0x0A, 0x46, 0x0B, 0x53, 0x1A, 0x02, 0x62, 0x2A, 0x01, 0x12, 0x23, 0x29, 0x02,
+	0x26, 0x37, 0x03, 0x26, 0x36, 0x04, 0x26, 0x53, 0x05, 0x86, 0x07, 0x56, 0x0A, 0x26, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x08, 0x2B, 0x08, 0x3A, 0x08, 0x39, 0x09, 0x47, 0x0A, 0x54, 0x1A,
+	0x01, 0x63, 0x2A, 0x13, 0x23, 0x29, 0x01, 0x27, 0x37, 0x02, 0x27, 0x36, 0x03, 0x27, 0x53, 0x04, 0x87, 0x06, 0x57, 0x09, 0x27, 0x0C, 0x13, 0x23, 0x0C, 0x23, 0x22, 0x0C, 0x24, 0x21, 0x0C, 0x12,
+	0x24, 0x0C, 0x23, 0x22, 0x0C, 0x0F, 0x06, 0x00, 0x0F, 0x21, 0x03, 0x25, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x02, 0x00, 0x0F, 0x06, 0x0F, 0x22,
+	0x02, 0x25, 0x2A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x2A, 0x02, 0xF2, 0x30, 0x01, 0x13, 0xF1, 0x01, 0x21, 0x0F, 0x03, 0x22, 0x0F, 0x02, 0x0F, 0x06,
+	0x27, 0x0C, 0x00, 0x00, 0x00, 0xB3, 0x07, 0x00, 0x27, 0x1A, 0x01, 0x27, 0x29, 0x01, 0x00, 0x27, 0x37, 0x02, 0x27, 0x45, 0x03, 0xE3, 0x04, 0xB3, 0x07, 0x27, 0x0C, 0x00, 0x00, 0x00, 0x27, 0x0C,
+	0x00, 0x00, 0x00, 0xB3, 0x07, 0x00, 0x27, 0x1A, 0x01, 0x27, 0x29, 0x01, 0x00, 0x27, 0x28, 0x02, 0x27, 0x37, 0x02, 0x27, 0x45, 0x03, 0xE3, 0x04, 0xB3, 0x07, 0x27, 0x0C, 0x13, 0x23, 0x0C, 0x24,
+	0x21, 0x0C, 0x12, 0x24, 0x0C, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x28, 0x0B, 0x28, 0x18, 0x02, 0x29, 0x27, 0x01, 0x14, 0x24, 0x27, 0x01, 0x23, 0x25, 0x25, 0x02, 0x24, 0x14, 0x26, 0x02, 0x25, 0x29,
+	0x03, 0x00, 0x16, 0x38, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x2D, 0x06, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x48, 0x09, 0x19, 0x0B, 0x0F, 0x06, 0x19, 0x0B, 0x38, 0x17, 0x02, 0x29, 0x27, 0x01, 0x14,
+	0x25, 0x26, 0x01, 0x24, 0x24, 0x25, 0x02, 0x24, 0x15, 0x25, 0x02, 0x25, 0x2A, 0x02, 0x26, 0x28, 0x03, 0x16, 0x29, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x3D, 0x05, 0x14, 0x28, 0x06, 0x34, 0x25, 0x07,
+	0x26, 0x23, 0x08, 0x23, 0x34, 0x09, 0x34, 0x31, 0x0A, 0x15, 0x0F, 0x0F, 0x06, 0x0F, 0x13, 0x02, 0x0F, 0x22, 0x02, 0x24, 0x2B, 0x02, 0x24, 0x2A, 0x03, 0x00, 0x24, 0x29, 0x04, 0x24, 0x28, 0x05,
+	0x24, 0x27, 0x06, 0x24, 0x26, 0x07, 0x24, 0x25, 0x08, 0x24, 0x53, 0x07, 0x24, 0x32, 0x22, 0x06, 0x54, 0x25, 0x05, 0x44, 0x27, 0x04, 0x24, 0x2A, 0x03, 0x0F, 0x32, 0x01, 0x0F, 0x13, 0x02, 0x0F,
+	0x06, 0x0F, 0x14, 0x01, 0x0F, 0x33, 0x25, 0x2B, 0x01, 0x25, 0x2A, 0x02, 0x00, 0x25, 0x29, 0x03, 0x25, 0x28, 0x04, 0x25, 0x27, 0x05, 0x25, 0x26, 0x06, 0x25, 0x34, 0x07, 0x25, 0x63, 0x05, 0x25,
+	0x31, 0x33, 0x04, 0x55, 0x35, 0x03, 0x22, 0x31, 0x38, 0x02, 0x33, 0x3B, 0x01, 0x12, 0x12, 0x3C, 0x31, 0x0F, 0x02, 0x14, 0x0F, 0x01, 0x29, 0x0A, 0x00, 0x00, 0x19, 0x0B, 0x00, 0xF3, 0x03, 0xF3,
+	0x10, 0x02, 0x28, 0x37, 0x01, 0x28, 0x28, 0x01, 0x18, 0x29, 0x01, 0x00, 0x27, 0x14, 0x24, 0x01, 0x27, 0x23, 0x24, 0x01, 0x27, 0x22, 0x25, 0x01, 0x17, 0x31, 0x26, 0x01, 0x46, 0x28, 0x01, 0x36,
+	0x28, 0x02, 0x29, 0x0A, 0x00, 0x00, 0x19, 0x0B, 0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x28, 0x37, 0x01, 0x28, 0x28, 0x01, 0x18, 0x29, 0x01, 0x00, 0x27, 0x14, 0x24, 0x01, 0x27, 0x23, 0x24, 0x01,
+	0x27, 0x22, 0x25, 0x01, 0x12, 0x14, 0x31, 0x26, 0x01, 0x73, 0x28, 0x01, 0x11, 0x12, 0x31, 0x28, 0x02, 0x31, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x15, 0x0F, 0x44, 0x0D, 0x36, 0x0C,
+	0x47, 0x17, 0x02, 0x29, 0x27, 0x01, 0x0F, 0x22, 0x02, 0x00, 0x0F, 0x21, 0x03, 0x2F, 0x04, 0x3D, 0x05, 0x3C, 0x06, 0x4A, 0x07, 0x57, 0x09, 0x64, 0x0B, 0x24, 0x0F, 0x0F, 0x06, 0x15, 0x0F, 0x44,
+	0x0D, 0x36, 0x0C, 0x47, 0x17, 0x02, 0x29, 0x27, 0x01, 0x0F, 0x32, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x21, 0x03, 0x3F, 0x03, 0x3E, 0x04, 0x3D, 0x05, 0x3B, 0x07, 0x12, 0x46, 0x08, 0x22, 0x61, 0x0A,
+	0x13, 0x31, 0x0D, 0x11, 0x12, 0x0F, 0x01, 0x21, 0x0F, 0x03, 0x0F, 0x06, 0x1B, 0x09, 0x3A, 0x08, 0x39, 0x17, 0x01, 0x38, 0x37, 0x37, 0x28, 0x01, 0x36, 0x19, 0x02, 0x34, 0x23, 0x25, 0x02, 0x52,
+	0x24, 0x23, 0x03, 0x22, 0x21, 0x24, 0x32, 0x03, 0x25, 0x55, 0x04, 0x25, 0x36, 0x05, 0x25, 0x35, 0x06, 0x25, 0x33, 0x21, 0x05, 0x25, 0x41, 0x23, 0x04, 0x55, 0x15, 0x05, 0x25, 0x0E, 0x1B, 0x09,
+	0x3A, 0x08, 0x2A, 0x17, 0x01, 0x38, 0x28, 0x37, 0x28, 0x01, 0x36, 0x29, 0x01, 0x44, 0x22, 0x25, 0x02, 0x52, 0x23, 0x34, 0x02, 0x22, 0x21, 0x24, 0x23, 0x03, 0x25, 0x25, 0x21, 0x04, 0x25, 0x45,
+	0x05, 0x25, 0x35, 0x06, 0x25, 0x54, 0x05, 0x25, 0x32, 0x32, 0x04, 0x12, 0x62, 0x14, 0x05, 0x63, 0x0C, 0x11, 0x22, 0x0F, 0x31, 0x0F, 0x02, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x29, 0x0A, 0x14, 0x24,
+	0x0A, 0x24, 0x23, 0x0A, 0x24, 0x23, 0x17, 0x02, 0x24, 0x23, 0x27, 0x01, 0x24, 0x23, 0x26, 0x02, 0x24, 0x23, 0x25, 0x03, 0x24, 0x23, 0x33, 0x04, 0xC4, 0x05, 0xA4, 0x07, 0x24, 0x23, 0x0A, 0x14,
+	0x24, 0x0A, 0x23, 0x24, 0x0A, 0x00, 0x00, 0x29, 0x0A, 0x00, 0x2A, 0x09, 0x14, 0x25, 0x09, 0x24, 0x24, 0x09, 0x24, 0x24, 0x17, 0x01, 0x24, 0x24, 0x27, 0x24, 0x24, 0x26, 0x01, 0x24, 0x24, 0x25,
+	0x02, 0x24, 0x24, 0x33, 0x03, 0xD4, 0x04, 0xB4, 0x06, 0x24, 0x24, 0x09, 0x14, 0x25, 0x09, 0x23, 0x25, 0x09, 0x00, 0x23, 0x21, 0x22, 0x09, 0x27, 0x21, 0x09, 0x15, 0x24, 0x09, 0x26, 0x0D, 0x17,
+	0x0D, 0x0F, 0x06, 0x00, 0x00, 0x19, 0x0B, 0x48, 0x11, 0x07, 0x3A, 0x16, 0x01, 0x0F, 0x24, 0x00, 0x27, 0x29, 0x01, 0x57, 0x26, 0x01, 0x2A, 0x25, 0x02, 0x0F, 0x21, 0x03, 0x2F, 0x04, 0x3D, 0x05,
+	0x5A, 0x06, 0x58, 0x08, 0x28, 0x0B, 0x0F, 0x06, 0x15, 0x0F, 0x44, 0x0D, 0x46, 0x0B, 0x28, 0x17, 0x03, 0x0F, 0x22, 0x02, 0x00, 0x23, 0x2B, 0x03, 0x43, 0x29, 0x03, 0x45, 0x26, 0x04, 0x18, 0x25,
+	0x05, 0x3D, 0x05, 0x3C, 0x06, 0x3B, 0x07, 0x39, 0x09, 0x56, 0x0A, 0x54, 0x0C, 0x24, 0x0F, 0x0F, 0x06, 0x25, 0x0E, 0x45, 0x0C, 0x47, 0x0A, 0x29, 0x17, 0x02, 0x0F, 0x23, 0x01, 0x00, 0x24, 0x2B,
+	0x02, 0x54, 0x28, 0x02, 0x37, 0x26, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x2D, 0x06, 0x3B, 0x07, 0x22, 0x45, 0x08, 0x23, 0x51, 0x0A, 0x11, 0x24, 0x0D, 0x31, 0x0F, 0x02, 0x13, 0x0F, 0x02, 0x0F, 0x06,
+	0x29, 0x0A, 0x00, 0x23, 0x24, 0x0A, 0x23, 0x24, 0x18, 0x01, 0x23, 0x24, 0x37, 0x23, 0x24, 0x27, 0x01, 0x23, 0x24, 0x26, 0x02, 0x23, 0x24, 0x43, 0x03, 0x23, 0x84, 0x04, 0x23, 0x54, 0x07, 0x23,
+	0x24, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x29, 0x0A, 0x00, 0x0F, 0x06, 0x29, 0x0A, 0x00, 0x24, 0x23, 0x0A, 0x24, 0x23, 0x18, 0x01, 0x24, 0x23, 0x37, 0x24, 0x23, 0x27, 0x01, 0x24, 0x23, 0x26, 0x02,
+	0x24, 0x23, 0x43, 0x03, 0x24, 0x83, 0x04, 0x24, 0x53, 0x07, 0x24, 0x23, 0x0A, 0x00, 0x00, 0x00, 0x22, 0x25, 0x0A, 0x33, 0x23, 0x0A, 0x12, 0x12, 0x23, 0x0A, 0x31, 0x0F, 0x02, 0x0F, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF3, 0x20, 0x01, 0x00, 0x29, 0x0A, 0x00, 0x1A, 0x0A, 0x2A, 0x09, 0x00, 0x2B, 0x08, 0x00, 0x3B, 0x07, 0x1C, 0x08, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x20, 0x01,
+	0x00, 0x29, 0x0A, 0x00, 0x2A, 0x09, 0x00, 0x14, 0x25, 0x09, 0x24, 0x25, 0x08, 0x35, 0x23, 0x08, 0x13, 0x13, 0x24, 0x07, 0x24, 0x16, 0x08, 0x25, 0x0E, 0x0F, 0x06, 0x27, 0x0C, 0x00, 0x27, 0x19,
+	0x02, 0x00, 0x27, 0x28, 0x02, 0x27, 0x27, 0x03, 0x27, 0x36, 0x03, 0x27, 0x43, 0x05, 0xD2, 0x06, 0xB2, 0x08, 0x27, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x0F, 0x21, 0x03, 0x00,
+	0x25, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x03, 0x00, 0x0F, 0x06, 0x00, 0x0F, 0x13, 0x02, 0x24, 0x2C, 0x01, 0x24, 0x14, 0x26, 0x02,
+	0x24, 0x23, 0x26, 0x02, 0x00, 0x24, 0x24, 0x24, 0x03, 0x24, 0x25, 0x22, 0x04, 0x24, 0x25, 0x21, 0x05, 0x24, 0x46, 0x05, 0x24, 0x36, 0x06, 0x24, 0x54, 0x06, 0x24, 0x42, 0x22, 0x05, 0x64, 0x25,
+	0x04, 0x44, 0x37, 0x03, 0x15, 0x1A, 0x04, 0x0F, 0x06, 0x1E, 0x06, 0x25, 0x27, 0x05, 0x25, 0x17, 0x06, 0x25, 0x26, 0x06, 0x00, 0x25, 0x25, 0x07, 0x00, 0x25, 0x24, 0x08, 0x52, 0x94, 0x01, 0x52,
+	0xA3, 0x01, 0x25, 0x32, 0x09, 0x25, 0x22, 0x0A, 0x55, 0x12, 0x08, 0x45, 0x23, 0x07, 0x35, 0x25, 0x06, 0x16, 0x26, 0x06, 0x2E, 0x05, 0x1E, 0x06, 0x0F, 0x06, 0x00, 0x0F, 0x12, 0x03, 0x0F, 0x22,
+	0x02, 0x0F, 0x21, 0x03, 0x00, 0x2F, 0x04, 0x3E, 0x04, 0x3D, 0x05, 0x3C, 0x06, 0x3B, 0x07, 0x49, 0x08, 0x38, 0x0A, 0x55, 0x0B, 0x43, 0x0E, 0x23, 0x0F, 0x01, 0x0F, 0x13, 0x02, 0x0F, 0x31, 0x02,
+	0x4E, 0x03, 0x4C, 0x05, 0x59, 0x07, 0x75, 0x09, 0x35, 0x0D, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x25, 0x0E, 0x45, 0x0C, 0x47, 0x0A, 0x59, 0x07, 0x5C, 0x04, 0x5E, 0x02, 0x0F, 0x22, 0x02, 0x0F, 0x12,
+	0x03, 0x0F, 0x31, 0x02, 0x4E, 0x03, 0x4C, 0x05, 0x59, 0x07, 0x75, 0x09, 0x35, 0x0D, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x25, 0x0E, 0x45, 0x0C, 0x47, 0x0A, 0x23, 0x54, 0x07, 0x24, 0x65, 0x04, 0x12,
+	0x12, 0x58, 0x02, 0x32, 0x2C, 0x02, 0x14, 0x0F, 0x01, 0x0F, 0x13, 0x02, 0x0F, 0x31, 0x02, 0x4E, 0x03, 0x4C, 0x05, 0x68, 0x07, 0x65, 0x0A, 0x35, 0x0D, 0x0F, 0x06, 0x00, 0x00, 0x15, 0x0F, 0x35,
+	0x0D, 0x46, 0x0B, 0x48, 0x09, 0x33, 0x54, 0x06, 0x12, 0x13, 0x65, 0x03, 0x12, 0x13, 0x48, 0x02, 0x12, 0x13, 0x1B, 0x02, 0x33, 0x0F, 0x0F, 0x06, 0x00, 0x00, 0x00, 0xF2, 0x04, 0xF2, 0x10, 0x03,
+	0x29, 0x35, 0x02, 0x19, 0x27, 0x02, 0x28, 0x27, 0x02, 0x00, 0x18, 0x28, 0x02, 0x27, 0x28, 0x02, 0x00, 0x17, 0x29, 0x02, 0x26, 0x29, 0x02, 0x35, 0x29, 0x02, 0x16, 0x2A, 0x02, 0x0F, 0x11, 0x04,
+	0x0F, 0x06, 0x00, 0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x2A, 0x35, 0x01, 0x1A, 0x27, 0x01, 0x29, 0x27, 0x01, 0x00, 0x19, 0x28, 0x01, 0x28, 0x28, 0x01, 0x00, 0x18, 0x29, 0x01, 0x13, 0x23, 0x29,
+	0x01, 0x23, 0x31, 0x29, 0x01, 0x24, 0x12, 0x38, 0x01, 0x22, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x2A, 0x35, 0x01, 0x1A, 0x27,
+	0x01, 0x29, 0x27, 0x01, 0x00, 0x19, 0x28, 0x01, 0x28, 0x28, 0x01, 0x00, 0x18, 0x29, 0x01, 0x27, 0x29, 0x01, 0x63, 0x29, 0x01, 0x12, 0x13, 0x3A, 0x01, 0x12, 0x13, 0x0E, 0x00, 0x33, 0x0F, 0x0F,
+	0x06, 0x00, 0x24, 0x0F, 0x00, 0x24, 0x1C, 0x02, 0x24, 0x2B, 0x02, 0x00, 0x00, 0x24, 0x2A, 0x03, 0x24, 0x39, 0x03, 0x24, 0x29, 0x04, 0x24, 0x37, 0x05, 0x24, 0x36, 0x06, 0x24, 0x44, 0x07, 0x24,
+	0x51, 0x09, 0x64, 0x0B, 0x34, 0x0E, 0x0F, 0x06, 0x00, 0x24, 0x0F, 0x00, 0x24, 0x1C, 0x02, 0x24, 0x2B, 0x02, 0x00, 0x00, 0x24, 0x2A, 0x03, 0x24, 0x39, 0x03, 0x24, 0x29, 0x04, 0x24, 0x28, 0x05,
+	0x24, 0x27, 0x06, 0x24, 0x35, 0x07, 0x11, 0x22, 0x52, 0x08, 0x21, 0x71, 0x0A, 0x53, 0x0D, 0x11, 0x0F, 0x04, 0x40, 0x0F, 0x02, 0x0F, 0x06, 0x00, 0x24, 0x0F, 0x00, 0x24, 0x1C, 0x02, 0x24, 0x2B,
+	0x02, 0x00, 0x24, 0x3A, 0x02, 0x24, 0x2A, 0x03, 0x24, 0x29, 0x04, 0x24, 0x38, 0x04, 0x24, 0x37, 0x05, 0x24, 0x36, 0x06, 0x24, 0x44, 0x07, 0x84, 0x09, 0x73, 0x0B, 0x12, 0x12, 0x0F, 0x00, 0x00,
+	0x1D, 0x07, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x36, 0x0C, 0x26, 0x0D, 0x00, 0x27, 0x0C, 0x28, 0x0B, 0x39, 0x09, 0x3A, 0x08, 0x3B, 0x07, 0x3C, 0x06, 0x3D, 0x05, 0x3E,
+	0x04, 0x3F, 0x03, 0x0F, 0x11, 0x04, 0x1D, 0x07, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x36, 0x0C, 0x26, 0x0D, 0x00, 0x27, 0x0C, 0x28, 0x0B, 0x39, 0x09, 0x15, 0x34, 0x08,
+	0x25, 0x34, 0x07, 0x36, 0x33, 0x06, 0x14, 0x12, 0x35, 0x05, 0x24, 0x38, 0x04, 0x25, 0x38, 0x03, 0x16, 0x19, 0x04, 0x1D, 0x07, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x39, 0x09, 0x28, 0x0B, 0x27,
+	0x0C, 0x26, 0x0D, 0x00, 0x27, 0x0C, 0x28, 0x0B, 0x29, 0x0A, 0x3A, 0x08, 0x35, 0x33, 0x07, 0x14, 0x13, 0x33, 0x06, 0x14, 0x13, 0x34, 0x05, 0x14, 0x13, 0x35, 0x04, 0x35, 0x37, 0x03, 0x0F, 0x11,
+	0x04, 0x0F, 0x06, 0x26, 0x17, 0x05, 0x26, 0x36, 0x04, 0x26, 0x34, 0x06, 0x26, 0x42, 0x07, 0x26, 0x13, 0x09, 0x26, 0x2A, 0x01, 0x00, 0x00, 0xF2, 0x30, 0x01, 0xF2, 0x20, 0x02, 0x26, 0x0D, 0x00,
+	0x00, 0x26, 0x13, 0x09, 0x26, 0x42, 0x07, 0x26, 0x34, 0x06, 0x26, 0x36, 0x04, 0x1F, 0x05, 0x26, 0x17, 0x05, 0x26, 0x36, 0x04, 0x26, 0x34, 0x06, 0x26, 0x42, 0x07, 0x26, 0x13, 0x09, 0x26, 0x2A,
+	0x01, 0x00, 0x00, 0xF2, 0x30, 0x01, 0xF2, 0x20, 0x02, 0x26, 0x0D, 0x00, 0x00, 0x12, 0x23, 0x13, 0x09, 0x22, 0x22, 0x42, 0x07, 0x14, 0x21, 0x34, 0x06, 0x21, 0x23, 0x36, 0x04, 0x32, 0x1A, 0x05,
+	0x13, 0x0F, 0x02, 0x26, 0x17, 0x05, 0x26, 0x36, 0x04, 0x26, 0x34, 0x06, 0x26, 0x42, 0x07, 0x26, 0x13, 0x09, 0x26, 0x2A, 0x01, 0x00, 0x00, 0xF3, 0x20, 0x01, 0xF3, 0x10, 0x02, 0x26, 0x0D, 0x00,
+	0x00, 0x26, 0x13, 0x09, 0x32, 0x21, 0x32, 0x08, 0x11, 0x33, 0x33, 0x07, 0x11, 0x33, 0x35, 0x05, 0x11, 0x33, 0x36, 0x04, 0x32, 0x1A, 0x05, 0x0F, 0x06, 0x25, 0x0E, 0x00, 0x00, 0x25, 0x24, 0x08,
+	0x25, 0x34, 0x07, 0x25, 0x35, 0x06, 0x25, 0x36, 0x05, 0x25, 0x27, 0x05, 0x25, 0x47, 0x03, 0x25, 0x26, 0x31, 0x02, 0x25, 0x25, 0x33, 0x01, 0x25, 0x24, 0x35, 0x25, 0x23, 0x17, 0x01, 0x25, 0x31,
+	0x0A, 0x55, 0x0B, 0x35, 0x0D, 0x16, 0x0E, 0x0F, 0x06, 0x00, 0x1F, 0x05, 0x19, 0x24, 0x05, 0x14, 0x23, 0x15, 0x05, 0x23, 0x14, 0x25, 0x04, 0x23, 0x24, 0x24, 0x04, 0x00, 0x14, 0x24, 0x15, 0x04,
+	0x14, 0x15, 0x15, 0x04, 0x24, 0x14, 0x25, 0x03, 0x24, 0x24, 0x24, 0x03, 0x24, 0x24, 0x15, 0x03, 0x15, 0x15, 0x25, 0x02, 0x25, 0x13, 0x26, 0x02, 0x25, 0x0E, 0x0F, 0x06, 0x0F, 0x22, 0x02, 0x00,
+	0x00, 0x0F, 0x31, 0x02, 0x6D, 0x02, 0x5A, 0x12, 0x03, 0x57, 0x15, 0x03, 0x63, 0x27, 0x03, 0x33, 0x2A, 0x03, 0x0F, 0x21, 0x03, 0x00, 0x00, 0x1B, 0x24, 0x03, 0x3B, 0x12, 0x04, 0x4D, 0x04, 0x4E,
+	0x03, 0x0F, 0x41, 0x01, 0x0F, 0x23, 0x01, 0x0F, 0x06, 0x0F, 0x13, 0x02, 0x0F, 0x23, 0x01, 0x17, 0x29, 0x02, 0x26, 0x29, 0x02, 0x27, 0x27, 0x03, 0x28, 0x25, 0x04, 0x28, 0x24, 0x05, 0x29, 0x22,
+	0x06, 0x4A, 0x07, 0x3A, 0x08, 0x59, 0x07, 0x37, 0x32, 0x06, 0x54, 0x34, 0x05, 0x33, 0x38, 0x04, 0x13, 0x3B, 0x03, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x2A, 0x09, 0x24, 0x24, 0x09, 0x00, 0x00, 0x00,
+	0x00, 0xE4, 0x03, 0x00, 0x24, 0x24, 0x34, 0x02, 0x24, 0x24, 0x25, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x25, 0x02, 0x2A, 0x09, 0x0F, 0x06, 0x00, 0x2B, 0x08, 0x1B, 0x09, 0x00, 0x16, 0x23,
+	0x09, 0x66, 0x09, 0x78, 0x06, 0x1A, 0x61, 0x03, 0x1A, 0x55, 0x29, 0x28, 0x29, 0x13, 0x06, 0x19, 0x23, 0x06, 0x19, 0x22, 0x07, 0x49, 0x08, 0x38, 0x0A, 0x19, 0x0B, 0x28, 0x0B, 0x18, 0x0C, 0x00,
+	0x27, 0x0C, 0x22, 0x23, 0x0C, 0x72, 0x0C, 0x75, 0x09, 0x17, 0x71, 0x05, 0x26, 0x74, 0x02, 0x26, 0x48, 0x01, 0x26, 0x1B, 0x01, 0x16, 0x14, 0x09, 0x16, 0x33, 0x08, 0x25, 0x32, 0x09, 0x25, 0x31,
+	0x0A, 0x45, 0x0C, 0x35, 0x0D, 0x15, 0x0F, 0x0F, 0x06, 0x00, 0x0F, 0x22, 0x02, 0x00, 0x28, 0x27, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x02, 0x78, 0x22, 0x02, 0x0F, 0x22, 0x02,
+	0x00, 0x00, 0x0F, 0x06, 0x0F, 0x21, 0x03, 0x00, 0x25, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x83, 0x03, 0xA5, 0x21, 0x03, 0x45, 0x27, 0x03, 0x0F, 0x21, 0x03,
+	0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x27, 0x29, 0x01, 0x27, 0x23, 0x24, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x24, 0x24, 0x25, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x10, 0x01, 0x00, 0x0F, 0x06, 0x00, 0x28, 0x0B, 0x00, 0x23, 0x23, 0x0B, 0x23, 0x23, 0x18, 0x02, 0x23, 0x23, 0x28, 0x01, 0x00,
+	0x23, 0x23, 0x27, 0x02, 0x00, 0x23, 0x23, 0x26, 0x03, 0x23, 0x23, 0x35, 0x03, 0x23, 0x23, 0x34, 0x04, 0x23, 0x23, 0x33, 0x05, 0x23, 0x23, 0x31, 0x07, 0x23, 0x53, 0x08, 0x28, 0x0B, 0x0F, 0x06,
+	0x00, 0x00, 0x00, 0xA3, 0x08, 0x00, 0x0F, 0x06, 0x0F, 0x13, 0x02, 0x0F, 0x23, 0x01, 0x0F, 0x22, 0x02, 0x00, 0x0F, 0x21, 0x03, 0x3E, 0x04, 0xD3, 0x05, 0xA3, 0x08, 0x0F, 0x06, 0x0F, 0x12, 0x03,
+	0x0F, 0x31, 0x02, 0x3F, 0x03, 0x5C, 0x04, 0xC3, 0x06, 0x93, 0x09, 0x0F, 0x06, 0x00, 0x00, 0xF3, 0x10, 0x02, 0x00, 0x0F, 0x21, 0x03, 0x00, 0x2F, 0x04, 0x2E, 0x05, 0x2D, 0x06, 0x2C, 0x07, 0x2B,
+	0x08, 0x0F, 0x06, 0x00, 0x00, 0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x0F, 0x12, 0x03, 0x0F, 0x21, 0x03, 0x00, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x1F, 0x05, 0x2E, 0x05, 0x2D, 0x06, 0x00, 0x2C, 0x07,
+	0x2B, 0x08, 0x2A, 0x09, 0x0F, 0x06, 0x00, 0xF4, 0x02, 0x00, 0x24, 0x2A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x02, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x68, 0x07,
+	0x00, 0x28, 0x0B, 0x28, 0x1A, 0x28, 0x29, 0x00, 0x28, 0x19, 0x01, 0x28, 0x28, 0x01, 0x28, 0x27, 0x02, 0x28, 0x26, 0x03, 0x28, 0x34, 0x04, 0x88, 0x05, 0x68, 0x07, 0x19, 0x0B, 0x0F, 0x06, 0x00,
+	0x84, 0x09, 0x00, 0x24, 0x0F, 0x00, 0x24, 0x1C, 0x02, 0x24, 0x2C, 0x01, 0x24, 0x2B, 0x02, 0x00, 0x24, 0x2A, 0x03, 0x24, 0x39, 0x03, 0x24, 0x38, 0x04, 0x24, 0x37, 0x05, 0x24, 0x45, 0x06, 0x24,
+	0x61, 0x08, 0x74, 0x0A, 0x15, 0x0F, 0x0F, 0x06, 0x26, 0x26, 0x05, 0x00, 0x00, 0x00, 0xA6, 0x05, 0x00, 0x26, 0x26, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x20, 0x01, 0x00, 0x26, 0x26, 0x05, 0x00,
+	0x00, 0x00, 0x2E, 0x05, 0x0F, 0x21, 0x03, 0x00, 0x24, 0x2A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xA2, 0x03, 0x00, 0x24, 0x2A, 0x03, 0x00, 0x24, 0x23, 0x25, 0x03, 0x24, 0x32, 0x25, 0x03,
+	0x24, 0x31, 0x26, 0x03, 0x54, 0x27, 0x03, 0x34, 0x29, 0x03, 0x24, 0x2A, 0x03, 0x0F, 0x06, 0x00, 0x24, 0x0F, 0x24, 0x23, 0x0A, 0x24, 0x23, 0x17, 0x02, 0x24, 0x23, 0x27, 0x01, 0x24, 0x23, 0x17,
+	0x02, 0x24, 0x23, 0x26, 0x02, 0x00, 0x24, 0x23, 0x25, 0x03, 0x24, 0x23, 0x24, 0x04, 0x24, 0x23, 0x33, 0x04, 0x24, 0x23, 0x32, 0x05, 0x24, 0x53, 0x07, 0x24, 0x61, 0x08, 0x74, 0x0A, 0x25, 0x0E,
+	0x0F, 0x06, 0x00, 0x0F, 0x13, 0x02, 0x24, 0x2C, 0x01, 0x25, 0x2B, 0x01, 0x35, 0x29, 0x02, 0x36, 0x28, 0x02, 0x37, 0x27, 0x02, 0x18, 0x27, 0x03, 0x0F, 0x21, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x3D,
+	0x05, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x38, 0x0A, 0x37, 0x0B, 0x0F, 0x06, 0x76, 0x08, 0x00, 0x26, 0x0D, 0x00, 0x26, 0x1B, 0x01, 0x00, 0x26, 0x2A, 0x01, 0x62, 0x2A, 0x01, 0x62, 0x29, 0x02,
+	0x26, 0x29, 0x02, 0x26, 0x28, 0x03, 0x26, 0x27, 0x04, 0x26, 0x35, 0x05, 0x22, 0x22, 0x43, 0x06, 0x23, 0x71, 0x08, 0x11, 0x12, 0x41, 0x0B, 0x31, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00,
+	0x00, 0x29, 0x27, 0x01, 0x29, 0x36, 0x01, 0x29, 0x35, 0x02, 0x29, 0x34, 0x03, 0x29, 0x51, 0x04, 0x96, 0x06, 0x66, 0x09, 0x29, 0x27, 0x01, 0x00, 0x00, 0x29, 0x36, 0x01, 0xA9, 0x02, 0x79, 0x05,
+	0x0F, 0x06, 0x1D, 0x07, 0x3C, 0x06, 0x3B, 0x07, 0x39, 0x09, 0x56, 0x18, 0x01, 0x26, 0x21, 0x37, 0x29, 0x27, 0x01, 0x29, 0x35, 0x02, 0x29, 0x43, 0x03, 0x79, 0x05, 0x59, 0x07, 0x29, 0x0A, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0x06, 0x85, 0x08, 0x00, 0x25, 0x0E, 0x00, 0x25, 0x1C, 0x01, 0x25, 0x2C, 0x25, 0x2B, 0x01, 0x00, 0x25, 0x2A, 0x02, 0x25, 0x39, 0x02, 0x25, 0x38, 0x03, 0x25, 0x37, 0x04,
+	0x12, 0x22, 0x45, 0x05, 0x52, 0x61, 0x07, 0x13, 0x71, 0x09, 0x21, 0x13, 0x0E, 0x22, 0x0F, 0x02, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x26, 0x26, 0x05, 0x00, 0x00, 0x00, 0xA6, 0x05, 0x00, 0x26, 0x26,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x20, 0x01, 0x00, 0x26, 0x26, 0x05, 0x12, 0x23, 0x26, 0x05, 0x23, 0x21, 0x26, 0x05, 0x11, 0x24, 0x26, 0x05, 0x41, 0x29, 0x05, 0x0F, 0x22, 0x02, 0x00, 0x25,
+	0x2A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xA2, 0x02, 0x00, 0x25, 0x2A, 0x02, 0x00, 0x25, 0x23, 0x25, 0x02, 0x25, 0x32, 0x25, 0x02, 0x22, 0x21, 0x31, 0x26, 0x02, 0x63, 0x28, 0x02, 0x11,
+	0x33, 0x29, 0x02, 0x31, 0x21, 0x2A, 0x02, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x00, 0x24, 0x0F, 0x24, 0x24, 0x09, 0x24, 0x24, 0x17, 0x01, 0x24, 0x24, 0x27, 0x24, 0x24, 0x17, 0x01, 0x24, 0x24, 0x26,
+	0x01, 0x00, 0x24, 0x24, 0x25, 0x02, 0x24, 0x24, 0x24, 0x03, 0x24, 0x24, 0x33, 0x03, 0x24, 0x24, 0x32, 0x04, 0x24, 0x54, 0x06, 0x21, 0x21, 0x62, 0x07, 0x92, 0x0A, 0x10, 0x33, 0x0E, 0x30, 0x0F,
+	0x03, 0x12, 0x0F, 0x03, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0A, 0x49, 0x08, 0x2A, 0x09, 0x1A, 0x0A, 0x0F, 0x06, 0x2A, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x27, 0x0C, 0x28, 0x0B, 0x29, 0x0A, 0x2A, 0x09, 0x2B, 0x08, 0x3C, 0x06, 0x3D, 0x05, 0x3E, 0x04,
+	0x1F, 0x05, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x37, 0x0B, 0x38, 0x0A, 0x39, 0x09, 0x3A, 0x08, 0x15, 0x35, 0x07, 0x25, 0x35, 0x06, 0x27, 0x35, 0x04, 0x14, 0x1A, 0x05, 0x35, 0x0D,
+	0x16, 0x0E, 0x0F, 0x06, 0x00, 0x00, 0x23, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x30, 0x00,
+};
+
+#elif USE_CYRILLIC_CHARACTERS
+
+extern const uint8_t glcd19x21_packed[] =
+{
+	19,			// character width in pixels
+	21,			// row height in pixels
+	2,			// space columns between characters before kerning
+	3,			// font format: sparse packed
+	0x20, 0x00,	// lowest character code (2 bytes, little endian)
+	0x91, 0x04,	// highest character code (2 bytes, little endian)
+
+	// Number of ranges, then the first code, last code and first glyph of each range (2 bytes each, little endian)
+	0x02, 0x00,
+	0x20, 0x00, 0x7E, 0x01, 0x00, 0x00,
+	0x00, 0x04, 0x91, 0x04, 0x5F, 0x01,
+
+	// Number of edge columns (2 bytes, little endian), then the edge columns
+	0xBA, 0x00,
+	0x00, 0x00, 0x00, 0xF8, 0x9F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3E, 0x00, 0x0C, 0x00, 0x18, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x09,
+	0x00, 0x80, 0x07, 0x00, 0x18, 0x00, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x60, 0x00, 0x01, 0x40, 0x80, 0x01, 0xC0, 0x00, 0x01,
+	0x60, 0x60, 0x00, 0x60, 0x78, 0x00, 0x80, 0x63, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x1F, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0xE0, 0x78, 0x00,
+	0xE0, 0x43, 0x00, 0xC0, 0x1F, 0x00, 0xC0, 0x80, 0x01, 0xC0, 0x80, 0x09, 0xC0, 0x80, 0x07, 0x00, 0x07, 0x00, 0x30, 0x60, 0x00, 0x80, 0x10, 0x00,
+	0x60, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFF, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x78, 0x00, 0x08, 0x00, 0x01, 0x08, 0x04, 0x00, 0x60, 0x7C, 0x00,
+	0xF8, 0x7F, 0x00, 0x00, 0x60, 0x00, 0xF8, 0x0F, 0x00, 0x78, 0x00, 0x00, 0x08, 0x80, 0x01, 0xFC, 0xFF, 0x1F, 0x04, 0x00, 0x10, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF1, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x7F, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x3F, 0x00,
+	0x00, 0x4E, 0x00, 0x40, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x7F, 0x04, 0xC0, 0xFF, 0x03, 0x00, 0xFF, 0x01, 0xCC, 0xFF, 0x01, 0xCC, 0xFF, 0x0F,
+	0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x80, 0xC3, 0x00, 0x80, 0xF1, 0x00, 0x40, 0x00, 0x01, 0xC0, 0x7F, 0x00, 0x00, 0x08, 0x00,
+	0xFC, 0xFF, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x60, 0x00, 0x18, 0x00, 0x03, 0xC0, 0xFC, 0x0F, 0x00, 0x06, 0x00, 0xC0, 0x38, 0x00,
+	0x00, 0x82, 0x01, 0x00, 0x40, 0x00, 0x00, 0x0E, 0x00, 0xFC, 0xE3, 0x1F, 0x10, 0x86, 0x01, 0x00, 0x0F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x1C, 0x00,
+	0x80, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01, 0xF0, 0x08, 0x00, 0x10, 0x0C, 0x00, 0x70, 0x07, 0x00, 0xF0, 0x01, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x18, 0x10, 0x08, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFA, 0xFF, 0x01, 0x03, 0x00, 0x00, 0x60, 0x30, 0x00,
+	0x80, 0x1F, 0x01, 0x88, 0x1F, 0x00, 0x80, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF9, 0x00, 0xD0, 0xFF, 0x01, 0x00, 0x1C, 0x01, 0x40, 0x1C, 0x00,
+	0x00, 0xF2, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1F, 0x00, 0x00, 0xC3, 0x00, 0x20, 0xC3, 0x00, 0x08, 0xC3, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x01,
+	0x10, 0x00, 0x11, 0x00, 0x7E, 0x04, 0x80, 0xFF, 0x03, 0xF0, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x30, 0x00, 0x00, 0x98, 0xFF, 0x1F, 0xF6, 0xFF, 0x01,
+	0x80, 0xFF, 0x01, 0xF0, 0x1F, 0x00, 0x98, 0xFF, 0x01, 0x98, 0xFF, 0x0F, 0xF4, 0x1F, 0x00, 0x30, 0x00, 0x10, 0xF8, 0xFF, 0x15, 0xF8, 0xFF, 0x0D,
+	0xB0, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xFE, 0x0F, 0x08, 0x7E, 0x00, 0x80, 0x00, 0x01, 0x88, 0x01, 0x00, 0x80, 0xFF, 0x15, 0x80, 0x01, 0x00,
+	0x88, 0xFF, 0x01, 0x40, 0x70, 0x00, 0x00, 0xC7, 0x00, 0x00, 0xF3, 0x00, 0x80, 0x00, 0x1D, 0x80, 0x08, 0x00, 0x80, 0x08, 0x01, 0x80, 0xFF, 0x00,
+	0x80, 0xFF, 0x11, 0x10, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x01, 0x01, 0x88, 0x01, 0x01, 0x00, 0xFE, 0x00, 0x80, 0x60, 0x00, 0xC0, 0x41, 0x00,
+	0xF0, 0x7F, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x71, 0x00, 0xC0, 0x01, 0x00, 0x18, 0x7E, 0x00, 0x00, 0xF7, 0x00,
+	0x80, 0xFF, 0x1F, 0x00, 0x42, 0x00, 0x80, 0x01, 0x10, 0x80, 0x0F, 0x00, 0x00, 0xFF, 0x0F, 0x88, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x88, 0x00, 0x01,
+	0x98, 0x01, 0x00, 0x1F, 0x00, 0x00,
+
+	// Width, leading edge and trailing edge of each glyph
+	0x07, 0x00, 0x00, 0x02, 0x01, 0x01, 0x05, 0x02, 0x02, 0x0C, 0x03, 0x04, 0x0C, 0x05, 0x06, 0x11, 0x07, 0x08, 0x0D, 0x09, 0x0A, 0x02, 0x02, 0x02, 0x05, 0x0B, 0x0C, 0x06, 0x0C, 0x0B,
+	0x06, 0x0D, 0x0D, 0x0A, 0x0E, 0x0E, 0x02, 0x0F, 0x10, 0x05, 0x11, 0x11, 0x02, 0x12, 0x12, 0x06, 0x12, 0x13, 0x0A, 0x14, 0x14, 0x09, 0x15, 0x0A, 0x0A, 0x16, 0x17, 0x0A, 0x18, 0x19,
+	0x0B, 0x03, 0x03, 0x0A, 0x1A, 0x1B, 0x0A, 0x1C, 0x1B, 0x0A, 0x1D, 0x1E, 0x0A, 0x1F, 0x1F, 0x0A, 0x20, 0x21, 0x02, 0x22, 0x22, 0x02, 0x23, 0x24, 0x0A, 0x25, 0x26, 0x0A, 0x27, 0x27,
+	0x0A, 0x26, 0x25, 0x0A, 0x28, 0x29, 0x11, 0x2A, 0x21, 0x0D, 0x0A, 0x0A, 0x0B, 0x2B, 0x2C, 0x0D, 0x1C, 0x18, 0x0C, 0x2B, 0x1C, 0x0B, 0x2B, 0x2D, 0x0A, 0x2B, 0x2E, 0x0D, 0x1C, 0x2F,
+	0x0A, 0x2B, 0x2B, 0x02, 0x2B, 0x2B, 0x09, 0x05, 0x30, 0x0B, 0x2B, 0x0A, 0x09, 0x2B, 0x0A, 0x0D, 0x2B, 0x2B, 0x0A, 0x2B, 0x2B, 0x0E, 0x1C, 0x1C, 0x0B, 0x2B, 0x29, 0x0E, 0x1C, 0x1C,
+	0x0C, 0x2B, 0x0A, 0x0C, 0x31, 0x2C, 0x0C, 0x1D, 0x1D, 0x0C, 0x32, 0x32, 0x0D, 0x1D, 0x1D, 0x13, 0x33, 0x33, 0x0C, 0x2D, 0x2D, 0x0C, 0x1E, 0x1E, 0x0B, 0x34, 0x2D, 0x04, 0x35, 0x36,
+	0x06, 0x13, 0x12, 0x04, 0x36, 0x35, 0x08, 0x37, 0x37, 0x0C, 0x38, 0x38, 0x04, 0x39, 0x3A, 0x0B, 0x3B, 0x0A, 0x09, 0x3C, 0x3D, 0x09, 0x0B, 0x3E, 0x09, 0x3D, 0x3C, 0x0A, 0x3F, 0x40,
+	0x06, 0x41, 0x42, 0x09, 0x43, 0x44, 0x09, 0x3C, 0x45, 0x02, 0x46, 0x46, 0x03, 0x38, 0x47, 0x09, 0x3C, 0x0A, 0x02, 0x3C, 0x3C, 0x0E, 0x48, 0x45, 0x09, 0x48, 0x45, 0x0A, 0x3D, 0x3D,
+	0x09, 0x49, 0x3D, 0x09, 0x3D, 0x49, 0x06, 0x48, 0x4A, 0x09, 0x4B, 0x4C, 0x06, 0x41, 0x4D, 0x09, 0x4E, 0x48, 0x0B, 0x41, 0x41, 0x0F, 0x4A, 0x4A, 0x08, 0x22, 0x22, 0x0B, 0x41, 0x41,
+	0x07, 0x16, 0x17, 0x07, 0x4F, 0x36, 0x02, 0x35, 0x35, 0x07, 0x36, 0x4F, 0x0A, 0x0E, 0x0E, 0x05, 0x50, 0x50, 0x02, 0x00, 0x00, 0x13, 0x51, 0x51, 0x0A, 0x28, 0x28, 0x13, 0x51, 0x51,
+	0x0A, 0x52, 0x52, 0x0A, 0x53, 0x53, 0x0A, 0x54, 0x54, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x55, 0x55,
+	0x09, 0x56, 0x57, 0x0B, 0x58, 0x59, 0x0A, 0x37, 0x5A, 0x0C, 0x1D, 0x1D, 0x02, 0x5B, 0x5B, 0x0A, 0x0A, 0x5C, 0x06, 0x13, 0x13, 0x0F, 0x5D, 0x5D, 0x07, 0x5E, 0x37, 0x0A, 0x5F, 0x60,
+	0x0A, 0x0E, 0x61, 0x05, 0x11, 0x11, 0x0F, 0x5D, 0x5D, 0x0C, 0x62, 0x62, 0x06, 0x28, 0x28, 0x0A, 0x63, 0x63, 0x06, 0x4F, 0x64, 0x05, 0x65, 0x66, 0x04, 0x3A, 0x39, 0x0A, 0x49, 0x0A,
+	0x09, 0x67, 0x1D, 0x02, 0x56, 0x56, 0x03, 0x68, 0x69, 0x06, 0x6A, 0x4F, 0x08, 0x29, 0x29, 0x0A, 0x60, 0x5F, 0x10, 0x6A, 0x59, 0x10, 0x6A, 0x0A, 0x10, 0x65, 0x59, 0x0A, 0x12, 0x6B,
+	0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x13, 0x12, 0x2D, 0x0D, 0x1C, 0x18, 0x0B, 0x2B, 0x2D, 0x0B, 0x2B, 0x2D,
+	0x0B, 0x2B, 0x2D, 0x0B, 0x2B, 0x2D, 0x03, 0x6C, 0x6D, 0x03, 0x6D, 0x6C, 0x05, 0x62, 0x62, 0x07, 0x6E, 0x6E, 0x0E, 0x0E, 0x1C, 0x0A, 0x2B, 0x2B, 0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C,
+	0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C, 0x08, 0x6F, 0x6F, 0x0E, 0x70, 0x71, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x1E, 0x1E,
+	0x0B, 0x2B, 0x72, 0x0B, 0x48, 0x73, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x11, 0x74, 0x40, 0x09, 0x0B, 0x3E,
+	0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x04, 0x39, 0x75, 0x04, 0x75, 0x39, 0x07, 0x3A, 0x3A, 0x06, 0x13, 0x13, 0x0A, 0x61, 0x3D, 0x09, 0x48, 0x45,
+	0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x0E, 0x0E, 0x0A, 0x76, 0x77, 0x09, 0x4E, 0x48, 0x09, 0x4E, 0x48, 0x09, 0x4E, 0x48,
+	0x09, 0x4E, 0x48, 0x0B, 0x41, 0x41, 0x0A, 0x35, 0x3D, 0x0B, 0x41, 0x41, 0x0D, 0x0A, 0x0A, 0x0A, 0x78, 0x0A, 0x0D, 0x0A, 0x0A, 0x0A, 0x78, 0x0A, 0x0D, 0x0A, 0x79, 0x0A, 0x78, 0x79,
+	0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7B, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7C, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7B, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7D, 0x0D, 0x00, 0x1C, 0x0D, 0x61, 0x7E,
+	0x0D, 0x37, 0x1C, 0x0B, 0x61, 0x0D, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x80, 0x0A, 0x61, 0x40,
+	0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82,
+	0x0C, 0x83, 0x83, 0x09, 0x2B, 0x45, 0x0D, 0x41, 0x41, 0x09, 0x3A, 0x45, 0x06, 0x84, 0x84, 0x06, 0x85, 0x85, 0x05, 0x39, 0x39, 0x05, 0x0D, 0x0D, 0x06, 0x6E, 0x6E, 0x06, 0x1E, 0x1E,
+	0x05, 0x00, 0x38, 0x04, 0x86, 0x38, 0x04, 0x00, 0x87, 0x04, 0x00, 0x88, 0x0D, 0x00, 0x89, 0x07, 0x8A, 0x8B, 0x09, 0x05, 0x8C, 0x05, 0x8D, 0x0D, 0x0C, 0x00, 0x7F, 0x09, 0x2B, 0x0A,
+	0x0A, 0x88, 0x0A, 0x0A, 0x00, 0x0A, 0x04, 0x6D, 0x6C, 0x0A, 0x00, 0x0A, 0x03, 0x8E, 0x8F, 0x0A, 0x00, 0x0A, 0x06, 0x2B, 0x7E, 0x0A, 0x00, 0x0A, 0x06, 0x2B, 0x56, 0x0A, 0x11, 0x0A,
+	0x04, 0x11, 0x56, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0A, 0x90, 0x45, 0x0D, 0x00, 0x91, 0x0A, 0x88, 0x92,
+	0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x61, 0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x61, 0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x93, 0x12, 0x91, 0x7F, 0x11, 0x61, 0x40, 0x0D, 0x00, 0x94, 0x06, 0x88, 0x95,
+	0x0D, 0x00, 0x94, 0x06, 0x96, 0x97, 0x0D, 0x00, 0x94, 0x07, 0x98, 0x1D, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B,
+	0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x3A, 0x3A, 0x05, 0x04, 0x9C, 0x0C, 0x3A, 0x3A, 0x07, 0x04, 0x7E, 0x0C, 0x3A, 0x3A, 0x05, 0x9D, 0x9E, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88,
+	0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x0A, 0x9F, 0x1D, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0xA0,
+	0x13, 0x3A, 0x3A, 0x0D, 0x97, 0x97, 0x0B, 0x85, 0x85, 0x09, 0x04, 0x04, 0x0B, 0x85, 0x85, 0x0B, 0xA1, 0x7F, 0x08, 0xA2, 0xA3, 0x0B, 0xA1, 0x7F, 0x08, 0xA2, 0xA3, 0x0B, 0xA1, 0x7F,
+	0x08, 0xA2, 0xA4, 0x05, 0x83, 0x1D, 0x0C, 0x00, 0x7F, 0x0F, 0x3A, 0xA5, 0x0A, 0x00, 0x3A, 0x0D, 0x00, 0xA6, 0x0C, 0xA7, 0x99, 0x04, 0x00, 0x83, 0x06, 0x84, 0x84, 0x09, 0x31, 0xA8,
+	0x13, 0x0A, 0x2C, 0x12, 0x00, 0x2C, 0x0E, 0x3A, 0xA9, 0x0B, 0x00, 0x7F, 0x0D, 0x00, 0x83, 0x0C, 0x7F, 0x3A, 0x0D, 0x00, 0x83, 0x0D, 0x0A, 0x0A, 0x0B, 0x00, 0xAA, 0x0C, 0x00, 0xAA,
+	0x0A, 0x00, 0x3A, 0x0E, 0xAB, 0xAB, 0x0C, 0x00, 0x7F, 0x12, 0x7F, 0x7F, 0x0A, 0x00, 0xAC, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0B, 0x00, 0x7F, 0x0B, 0x0A, 0x83, 0x0E, 0x00, 0x83,
+	0x0C, 0x00, 0x83, 0x0E, 0x00, 0x1C, 0x0C, 0x00, 0x83, 0x0C, 0x00, 0xAD, 0x0D, 0x00, 0xA6, 0x0B, 0x3A, 0x3A, 0x0C, 0x7F, 0x3A, 0x0D, 0x7A, 0x7A, 0x0D, 0x7F, 0x7F, 0x0E, 0x00, 0xAB,
+	0x0C, 0x00, 0x83, 0x10, 0x00, 0x83, 0x12, 0x00, 0xAB, 0x0E, 0x3A, 0x2C, 0x10, 0x00, 0x83, 0x0C, 0x00, 0x2C, 0x0D, 0x00, 0x1C, 0x12, 0x00, 0x1C, 0x0D, 0x0A, 0x83, 0x0A, 0x9B, 0x0A,
+	0x0A, 0x3F, 0xAE, 0x09, 0x88, 0xAF, 0x07, 0x88, 0x04, 0x0B, 0xAB, 0xAB, 0x0A, 0x61, 0x40, 0x0E, 0x94, 0x94, 0x08, 0x7B, 0xAF, 0x09, 0x88, 0x88, 0x09, 0x88, 0x8A, 0x08, 0x88, 0x94,
+	0x09, 0x0A, 0x88, 0x0C, 0x88, 0x88, 0x09, 0x88, 0x88, 0x0A, 0x61, 0x61, 0x08, 0x88, 0x88, 0x0A, 0xB0, 0x61, 0x09, 0x61, 0xB1, 0x08, 0x04, 0x04, 0x09, 0xB2, 0x97, 0x0F, 0x61, 0x61,
+	0x09, 0x94, 0x94, 0x0B, 0x88, 0xAB, 0x09, 0xB3, 0x88, 0x0D, 0x88, 0x88, 0x0F, 0x88, 0xAB, 0x0B, 0x04, 0x73, 0x0D, 0x88, 0x88, 0x0A, 0x88, 0x73, 0x09, 0xB1, 0x61, 0x0D, 0x88, 0x61,
+	0x09, 0x0A, 0x88, 0x0D, 0x00, 0x83, 0x0A, 0x61, 0x40, 0x09, 0x3A, 0xB4, 0x07, 0x88, 0xB5, 0x09, 0x61, 0xB1, 0x09, 0x9A, 0xB6, 0x03, 0x8A, 0x8A, 0x06, 0x85, 0x85, 0x03, 0x38, 0x8B,
+	0x10, 0x0A, 0x73, 0x0E, 0x88, 0x73, 0x09, 0x3A, 0x45, 0x08, 0x88, 0xB7, 0x0D, 0x00, 0x83, 0x09, 0xB2, 0xB8, 0x09, 0x88, 0x88, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83,
+	0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83,
+	0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83,
+	0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83,
+	0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x01, 0x85, 0x85, 0x01, 0x85, 0x85, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83,
+	0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x0D, 0x00, 0x83, 0x09, 0x00, 0xB9, 0x08, 0x88, 0x02,
+
+	// Glyph offsets (2 bytes each, little endian)
+	0x00, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x15, 0x00, 0x33, 0x00, 0x58, 0x00, 0x88, 0x00, 0xB2, 0x00, 0xB5, 0x00, 0xC1, 0x00, 0xCF, 0x00, 0xDC, 0x00, 0xE9, 0x00, 0xEE, 0x00, 0xF4, 0x00, 0xF7, 0x00,
+	0x04, 0x01, 0x18, 0x01, 0x2A, 0x01, 0x4E, 0x01, 0x69, 0x01, 0x83, 0x01, 0x9D, 0x01, 0xB8, 0x01, 0xD1, 0x01, 0xEE, 0x01, 0x0A, 0x02, 0x0E, 0x02, 0x15, 0x02, 0x2E, 0x02, 0x3A, 0x02, 0x53, 0x02,
+	0x6F, 0x02, 0xAF, 0x02, 0xD0, 0x02, 0xE8, 0x02, 0x07, 0x03, 0x1E, 0x03, 0x2F, 0x03, 0x3C, 0x03, 0x61, 0x03, 0x6E, 0x03, 0x71, 0x03, 0x85, 0x03, 0xA0, 0x03, 0xAC, 0x03, 0xC8, 0x03, 0xDC, 0x03,
+	0xFC, 0x03, 0x0E, 0x04, 0x33, 0x04, 0x4F, 0x04, 0x72, 0x04, 0x83, 0x04, 0x99, 0x04, 0xB5, 0x04, 0xDC, 0x04, 0xFE, 0x04, 0x17, 0x05, 0x3E, 0x05, 0x45, 0x05, 0x52, 0x05, 0x59, 0x05, 0x68, 0x05,
+	0x75, 0x05, 0x7F, 0x05, 0x9B, 0x05, 0xAD, 0x05, 0xBE, 0x05, 0xD0, 0x05, 0xE9, 0x05, 0xF4, 0x05, 0x0B, 0x06, 0x1A, 0x06, 0x1E, 0x06, 0x25, 0x06, 0x3A, 0x06, 0x3D, 0x06, 0x55, 0x06, 0x64, 0x06,
+	0x78, 0x06, 0x89, 0x06, 0x9A, 0x06, 0xA3, 0x06, 0xBD, 0x06, 0xC7, 0x06, 0xD7, 0x06, 0xED, 0x06, 0x0B, 0x07, 0x20, 0x07, 0x37, 0x07, 0x4E, 0x07, 0x5D, 0x07, 0x60, 0x07, 0x6F, 0x07, 0x7E, 0x07,
+	0x87, 0x07, 0x8A, 0x07, 0xA8, 0x07, 0xBE, 0x07, 0xDC, 0x07, 0xF2, 0x07, 0x0E, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08,
+	0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08,
+	0x2A, 0x08, 0x2C, 0x08, 0x30, 0x08, 0x49, 0x08, 0x67, 0x08, 0x7B, 0x08, 0xA2, 0x08, 0xA5, 0x08, 0xCE, 0x08, 0xD9, 0x08, 0x09, 0x09, 0x1B, 0x09, 0x35, 0x09, 0xEE, 0x00, 0x41, 0x09, 0x71, 0x09,
+	0x7F, 0x09, 0x8D, 0x09, 0x9D, 0x09, 0xB1, 0x09, 0xC2, 0x09, 0xCE, 0x09, 0xE0, 0x09, 0xF3, 0x09, 0xF6, 0x09, 0xFE, 0x09, 0x0A, 0x0A, 0x1A, 0x0A, 0x34, 0x0A, 0x5D, 0x0A, 0x8E, 0x0A, 0xBC, 0x0A,
+	0xDA, 0x0A, 0xFE, 0x0A, 0x22, 0x0B, 0x48, 0x0B, 0x70, 0x0B, 0x95, 0x0B, 0xB9, 0x0B, 0xDE, 0x0B, 0x04, 0x0C, 0x20, 0x0C, 0x3C, 0x0C, 0x64, 0x0C, 0x80, 0x0C, 0x89, 0x0C, 0x92, 0x0C, 0xA1, 0x0C,
+	0xAE, 0x0C, 0xCB, 0x0C, 0xE6, 0x0C, 0x0C, 0x0D, 0x32, 0x0D, 0x5D, 0x0D, 0x87, 0x0D, 0xAD, 0x0D, 0xC2, 0x0D, 0xF0, 0x0D, 0x0A, 0x0E, 0x24, 0x0E, 0x41, 0x0E, 0x5C, 0x0E, 0x79, 0x0E, 0x8B, 0x0E,
+	0xAD, 0x0E, 0xD3, 0x0E, 0xF9, 0x0E, 0x22, 0x0F, 0x47, 0x0F, 0x6A, 0x0F, 0x8D, 0x0F, 0xBD, 0x0F, 0xD5, 0x0F, 0xF7, 0x0F, 0x1D, 0x10, 0x46, 0x10, 0x69, 0x10, 0x75, 0x10, 0x81, 0x10, 0x96, 0x10,
+	0xA1, 0x10, 0xC1, 0x10, 0xDA, 0x10, 0xF8, 0x10, 0x16, 0x11, 0x37, 0x11, 0x55, 0x11, 0x71, 0x11, 0x80, 0x11, 0xA0, 0x11, 0xB5, 0x11, 0xCA, 0x11, 0xE3, 0x11, 0xF8, 0x11, 0x13, 0x12, 0x28, 0x12,
+	0x43, 0x12, 0x69, 0x12, 0x86, 0x12, 0xAC, 0x12, 0xCD, 0x12, 0xEE, 0x12, 0x07, 0x13, 0x2A, 0x13, 0x45, 0x13, 0x6C, 0x13, 0x87, 0x13, 0xA8, 0x13, 0xBF, 0x13, 0xE6, 0x13, 0x01, 0x14, 0x25, 0x14,
+	0x40, 0x14, 0x5A, 0x14, 0x74, 0x14, 0x8E, 0x14, 0xAB, 0x14, 0xCD, 0x14, 0xEA, 0x14, 0x04, 0x15, 0x22, 0x15, 0x3A, 0x15, 0x59, 0x15, 0x83, 0x15, 0xA5, 0x15, 0xD5, 0x15, 0xF3, 0x15, 0x1F, 0x16,
+	0x39, 0x16, 0x63, 0x16, 0x7D, 0x16, 0xA7, 0x16, 0xC5, 0x16, 0xDF, 0x16, 0xF5, 0x16, 0x08, 0x17, 0x1B, 0x17, 0x2D, 0x17, 0x3B, 0x17, 0x46, 0x17, 0x4F, 0x17, 0x5E, 0x17, 0x6C, 0x17, 0x75, 0x17,
+	0x7E, 0x17, 0x85, 0x17, 0x8B, 0x17, 0xA5, 0x17, 0xB4, 0x17, 0xCF, 0x17, 0xDB, 0x17, 0xFA, 0x17, 0x11, 0x18, 0x28, 0x18, 0x3C, 0x18, 0x47, 0x18, 0x5D, 0x18, 0x65, 0x18, 0x7A, 0x18, 0x86, 0x18,
+	0x98, 0x18, 0xA2, 0x18, 0xB7, 0x18, 0xBE, 0x18, 0xD8, 0x18, 0xEC, 0x18, 0x04, 0x19, 0x17, 0x19, 0x33, 0x19, 0x49, 0x19, 0x5B, 0x19, 0x76, 0x19, 0x86, 0x19, 0xA4, 0x19, 0xBC, 0x19, 0xE0, 0x19,
+	0xF8, 0x19, 0x25, 0x1A, 0x46, 0x1A, 0x67, 0x1A, 0x8F, 0x1A, 0xB3, 0x1A, 0xC1, 0x1A, 0xE3, 0x1A, 0xF0, 0x1A, 0x17, 0x1B, 0x2B, 0x1B, 0x57, 0x1B, 0x76, 0x1B, 0xA1, 0x1B, 0xC6, 0x1B, 0xEF, 0x1B,
+	0x0E, 0x1C, 0x39, 0x1C, 0x5E, 0x1C, 0x71, 0x1C, 0x7D, 0x1C, 0x9B, 0x1C, 0xAA, 0x1C, 0xBF, 0x1C, 0xCB, 0x1C, 0xE7, 0x1C, 0xFE, 0x1C, 0x17, 0x1D, 0x29, 0x1D, 0x42, 0x1D, 0x57, 0x1D, 0x72, 0x1D,
+	0x8B, 0x1D, 0xAB, 0x1D, 0xC7, 0x1D, 0xE1, 0x1D, 0xF2, 0x1D, 0x20, 0x1E, 0x41, 0x1E, 0x5B, 0x1E, 0x74, 0x1E, 0x8D, 0x1E, 0xB7, 0x1E, 0xD4, 0x1E, 0xFC, 0x1E, 0x18, 0x1F, 0x44, 0x1F, 0x64, 0x1F,
+	0x6E, 0x1F, 0x8C, 0x1F, 0xAD, 0x1F, 0xC9, 0x1F, 0xEA, 0x1F, 0x0B, 0x20, 0x11, 0x20, 0x1C, 0x20, 0x30, 0x20, 0x53, 0x20, 0x6F, 0x20, 0x85, 0x20, 0xA1, 0x20, 0xB3, 0x20, 0xD8, 0x20, 0xED, 0x20,
+	0x0B, 0x21, 0x21, 0x21, 0x3B, 0x21, 0x49, 0x21, 0x60, 0x21, 0x73, 0x21, 0x9C, 0x21, 0xB7, 0x21, 0xCE, 0x21, 0xEC, 0x21, 0x03, 0x22, 0x17, 0x22, 0x2F, 0x22, 0x3F, 0x22, 0x5C, 0x22, 0x6D, 0x22,
+	0x81, 0x22, 0x9D, 0x22, 0xAE, 0x22, 0xCC, 0x22, 0xE7, 0x22, 0x0B, 0x23, 0x1F, 0x23, 0x31, 0x23, 0x49, 0x23, 0x64, 0x23, 0x7C, 0x23, 0x96, 0x23, 0xAA, 0x23, 0xCB, 0x23, 0xEE, 0x23, 0x0C, 0x24,
+	0x28, 0x24, 0x46, 0x24, 0x58, 0x24, 0x62, 0x24, 0x77, 0x24, 0x91, 0x24, 0xB2, 0x24, 0xCC, 0x24, 0xDC, 0x24, 0xF5, 0x24, 0x07, 0x25, 0x17, 0x25, 0x2E, 0x25, 0x3B, 0x25, 0x50, 0x25, 0x5C, 0x25,
+	0x6F, 0x25, 0x85, 0x25, 0x90, 0x25, 0xA2, 0x25, 0xC3, 0x25, 0xDB, 0x25, 0xEC, 0x25, 0xFA, 0x25, 0x0F, 0x26, 0x27, 0x26, 0x3A, 0x26, 0x51, 0x26, 0x63, 0x26, 0x7B, 0x26, 0x95, 0x26, 0xA1, 0x20,
+	0xA9, 0x26, 0xCD, 0x26, 0xDF, 0x26, 0xF0, 0x26, 0x08, 0x27, 0x23, 0x27, 0x29, 0x27, 0x35, 0x27, 0x3C, 0x27, 0x58, 0x27, 0x70, 0x27, 0x83, 0x27, 0xA1, 0x20, 0x99, 0x27, 0xB2, 0x27, 0xA1, 0x20,
+	0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20,
+	0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20,
+	0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC3, 0x27, 0xC3, 0x27, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC5, 0x27,
+	0xD4, 0x27,
+
+	// Glyphs
+	0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x22, 0x04, 0x00, 0x53, 0x0D, 0x00, 0x0F, 0x06, 0x33, 0x0F, 0x53, 0x0D, 0x1C, 0x08, 0x17, 0x14, 0x08, 0x17, 0x54, 0x04, 0x67, 0x08, 0x53,
+	0x14, 0x08, 0x17, 0x14, 0x08, 0x00, 0x17, 0x54, 0x04, 0x67, 0x08, 0x53, 0x14, 0x08, 0x17, 0x14, 0x08, 0x17, 0x0D, 0x1D, 0x07, 0x35, 0x35, 0x05, 0x54, 0x25, 0x05, 0x23, 0x23, 0x25, 0x04, 0x13,
+	0x15, 0x16, 0x04, 0xF1, 0x30, 0x02, 0x00, 0x13, 0x25, 0x15, 0x04, 0x23, 0x15, 0x15, 0x04, 0x24, 0x24, 0x13, 0x05, 0x15, 0x55, 0x05, 0x2C, 0x07, 0x64, 0x0B, 0x23, 0x24, 0x0A, 0x13, 0x16, 0x0A,
+	0x13, 0x16, 0x15, 0x04, 0x23, 0x24, 0x24, 0x04, 0x64, 0x33, 0x05, 0x2C, 0x07, 0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x26, 0x0D, 0x34, 0x63, 0x05, 0x23, 0x24, 0x24, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x19, 0x16, 0x04, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x5B, 0x05, 0x3A, 0x21, 0x05, 0x25, 0x22, 0x24, 0x04, 0x64, 0x16, 0x04, 0x23, 0x33, 0x15, 0x04, 0x13, 0x14, 0x31, 0x13, 0x04, 0x13, 0x14, 0x32,
+	0x21, 0x04, 0x23, 0x12, 0x35, 0x05, 0x44, 0x35, 0x05, 0x5C, 0x04, 0x3A, 0x13, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x53, 0x0D, 0x00, 0x59, 0x07, 0xB6, 0x04, 0x44, 0x47, 0x02, 0x23, 0x2D, 0x01, 0x22,
+	0x2F, 0x0F, 0x06, 0x22, 0x2F, 0x23, 0x2D, 0x01, 0x44, 0x47, 0x02, 0xB6, 0x04, 0x59, 0x07, 0x15, 0x0F, 0x16, 0x21, 0x0B, 0x53, 0x0D, 0x00, 0x16, 0x21, 0x0B, 0x15, 0x0F, 0x19, 0x0B, 0x00, 0x00,
+	0x00, 0x95, 0x07, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x2F, 0x12, 0x01, 0x4F, 0x02, 0x2B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x2F, 0x04, 0x5C, 0x04, 0x68, 0x07, 0x65, 0x0A, 0x52,
+	0x0E, 0x22, 0x0F, 0x02, 0x86, 0x07, 0xC4, 0x05, 0x14, 0x1A, 0x05, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x14, 0x1A, 0x05, 0xC4, 0x05, 0x86, 0x07, 0x25, 0x19, 0x04, 0x24, 0x1A, 0x04, 0x14, 0x1B,
+	0x04, 0xE3, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x16, 0x28, 0x04, 0x34, 0x37, 0x04, 0x14, 0x28, 0x11, 0x04, 0x13, 0x28, 0x12, 0x04, 0x13, 0x27, 0x13, 0x04, 0x13, 0x17, 0x14, 0x04,
+	0x13, 0x26, 0x14, 0x04, 0x23, 0x33, 0x15, 0x04, 0x64, 0x16, 0x04, 0x26, 0x18, 0x04, 0x25, 0x26, 0x06, 0x34, 0x36, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x23, 0x13,
+	0x11, 0x24, 0x04, 0x54, 0x61, 0x05, 0x25, 0x44, 0x06, 0x1C, 0x08, 0x3A, 0x08, 0x49, 0x08, 0x28, 0x12, 0x08, 0x27, 0x13, 0x08, 0x35, 0x14, 0x08, 0x34, 0x15, 0x08, 0x23, 0x17, 0x08, 0xE3, 0x04,
+	0x1C, 0x08, 0x00, 0x37, 0x23, 0x06, 0x73, 0x33, 0x05, 0x13, 0x15, 0x25, 0x04, 0x13, 0x14, 0x17, 0x04, 0x00, 0x00, 0x00, 0x13, 0x24, 0x25, 0x04, 0x13, 0x75, 0x05, 0x5A, 0x06, 0x67, 0x08, 0xA5,
+	0x06, 0x24, 0x13, 0x24, 0x05, 0x23, 0x13, 0x26, 0x04, 0x13, 0x14, 0x17, 0x04, 0x00, 0x00, 0x23, 0x23, 0x25, 0x04, 0x24, 0x73, 0x05, 0x5A, 0x06, 0x13, 0x0F, 0x02, 0x00, 0x00, 0x13, 0x49, 0x04,
+	0x13, 0x76, 0x04, 0x13, 0x44, 0x09, 0x13, 0x42, 0x0B, 0x13, 0x31, 0x0D, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0x35, 0x43, 0x06, 0x54, 0x61, 0x05, 0x23, 0x13, 0x11, 0x24, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x00, 0x00, 0x00, 0x23, 0x13, 0x11, 0x24, 0x04, 0x54, 0x61, 0x05, 0x35, 0x43, 0x06, 0x55, 0x14, 0x06, 0x74, 0x23, 0x05, 0x23, 0x25, 0x23, 0x04, 0x13, 0x17, 0x14, 0x04, 0x00, 0x00, 0x13, 0x17,
+	0x23, 0x04, 0x24, 0x14, 0x23, 0x05, 0xB4, 0x06, 0x76, 0x08, 0x26, 0x27, 0x04, 0x00, 0x26, 0x27, 0x12, 0x01, 0x26, 0x47, 0x02, 0x38, 0x0A, 0x18, 0x11, 0x0A, 0x27, 0x21, 0x09, 0x00, 0x26, 0x23,
+	0x08, 0x00, 0x16, 0x15, 0x08, 0x25, 0x25, 0x07, 0x15, 0x17, 0x07, 0x24, 0x27, 0x06, 0x17, 0x14, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x27, 0x06, 0x15, 0x17, 0x07,
+	0x25, 0x25, 0x07, 0x16, 0x15, 0x08, 0x26, 0x23, 0x08, 0x00, 0x27, 0x21, 0x09, 0x00, 0x18, 0x11, 0x0A, 0x38, 0x0A, 0x25, 0x0E, 0x34, 0x0E, 0x14, 0x0F, 0x01, 0x13, 0x0F, 0x02, 0x13, 0x27, 0x22,
+	0x04, 0x13, 0x36, 0x22, 0x04, 0x13, 0x25, 0x0A, 0x23, 0x14, 0x0B, 0x64, 0x0B, 0x45, 0x0C, 0x88, 0x05, 0x36, 0x36, 0x03, 0x25, 0x1A, 0x03, 0x14, 0x26, 0x15, 0x02, 0x23, 0x73, 0x23, 0x01, 0x13,
+	0x33, 0x24, 0x13, 0x01, 0x12, 0x23, 0x17, 0x13, 0x01, 0x12, 0x13, 0x18, 0x13, 0x01, 0x00, 0x12, 0x13, 0x17, 0x14, 0x01, 0x12, 0x14, 0x24, 0x15, 0x01, 0x12, 0x85, 0x12, 0x02, 0x22, 0x52, 0x14,
+	0x12, 0x02, 0x13, 0x12, 0x18, 0x21, 0x02, 0x23, 0x29, 0x05, 0x34, 0x35, 0x06, 0x76, 0x08, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x43, 0x14, 0x09, 0x23, 0x16,
+	0x09, 0x43, 0x14, 0x09, 0x55, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x16, 0x04, 0x54,
+	0x11, 0x14, 0x05, 0x44, 0x62, 0x05, 0x4B, 0x06, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x29, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x24, 0x19,
+	0x05, 0x34, 0x36, 0x05, 0x25, 0x26, 0x06, 0xE3, 0x04, 0x00, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x29, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04,
+	0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x08, 0xA5, 0x06,
+	0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13, 0x16, 0x15, 0x04, 0x00, 0x23, 0x15, 0x15, 0x04, 0x24, 0x14, 0x14, 0x05, 0x34, 0x13, 0x23, 0x05, 0x25, 0x53,
+	0x06, 0xE3, 0x04, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x00, 0xE3, 0x04, 0x00, 0x1D, 0x07, 0x3D, 0x05, 0x3E, 0x04, 0x0F, 0x11, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13, 0x2B,
+	0x04, 0xD3, 0x05, 0xC3, 0x06, 0xE3, 0x04, 0x00, 0x29, 0x0A, 0x28, 0x0B, 0x47, 0x0A, 0x26, 0x32, 0x08, 0x25, 0x34, 0x07, 0x24, 0x36, 0x06, 0x23, 0x38, 0x05, 0x13, 0x3A, 0x04, 0x0F, 0x11, 0x04,
+	0xE3, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x23, 0x0F, 0x01, 0x44, 0x0D, 0x56, 0x0A, 0x49, 0x08, 0x5B, 0x05, 0x2F, 0x04, 0x4C, 0x05, 0x59, 0x07, 0x47,
+	0x0A, 0x44, 0x0D, 0x23, 0x0F, 0x01, 0xE3, 0x04, 0xE3, 0x04, 0x33, 0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x38, 0x0A, 0x49, 0x08, 0x3B, 0x07, 0x3D, 0x05, 0x3E, 0x04, 0xE3, 0x04, 0x67, 0x08, 0xA5, 0x06,
+	0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x00, 0x13,
+	0x16, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x0A, 0x64, 0x0B, 0x45, 0x0C, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13,
+	0x4C, 0x01, 0x13, 0x1C, 0x21, 0x01, 0x23, 0x2A, 0x22, 0x14, 0x1A, 0x14, 0x34, 0x36, 0x14, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x00, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x00, 0x13, 0x26, 0x09, 0x13,
+	0x36, 0x08, 0x23, 0x24, 0x31, 0x06, 0x64, 0x43, 0x04, 0x64, 0x25, 0x04, 0x0F, 0x11, 0x04, 0x2D, 0x06, 0x54, 0x34, 0x05, 0x54, 0x16, 0x05, 0x23, 0x23, 0x25, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00,
+	0x13, 0x25, 0x15, 0x04, 0x00, 0x23, 0x15, 0x15, 0x04, 0x24, 0x24, 0x13, 0x05, 0x34, 0x63, 0x05, 0x4B, 0x06, 0x13, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x0F, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x2F, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x13, 0x0F, 0x02, 0x43, 0x0E, 0x54, 0x0C,
+	0x57, 0x09, 0x59, 0x07, 0x5C, 0x04, 0x2F, 0x04, 0x5C, 0x04, 0x59, 0x07, 0x57, 0x09, 0x54, 0x0C, 0x43, 0x0E, 0x13, 0x0F, 0x02, 0x43, 0x0E, 0x64, 0x0B, 0x67, 0x08, 0x6A, 0x05, 0x3E, 0x04, 0x4D,
+	0x04, 0x5A, 0x06, 0x66, 0x09, 0x63, 0x0C, 0x23, 0x0F, 0x01, 0x63, 0x0C, 0x66, 0x09, 0x5A, 0x06, 0x4D, 0x04, 0x3E, 0x04, 0x6B, 0x04, 0x77, 0x07, 0x64, 0x0B, 0x43, 0x0E, 0x13, 0x1C, 0x04, 0x23,
+	0x39, 0x04, 0x24, 0x37, 0x05, 0x35, 0x24, 0x07, 0x36, 0x31, 0x08, 0x48, 0x09, 0x38, 0x0A, 0x36, 0x31, 0x08, 0x35, 0x33, 0x07, 0x34, 0x36, 0x05, 0x23, 0x39, 0x04, 0x13, 0x1C, 0x04, 0x23, 0x0F,
+	0x01, 0x33, 0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x89, 0x04, 0x00, 0x37, 0x0B, 0x36, 0x0C, 0x34, 0x0E, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0x13, 0x2B, 0x04, 0x13, 0x3A, 0x04, 0x13, 0x38, 0x11,
+	0x04, 0x13, 0x37, 0x12, 0x04, 0x13, 0x26, 0x14, 0x04, 0x13, 0x34, 0x15, 0x04, 0x13, 0x33, 0x16, 0x04, 0x13, 0x22, 0x18, 0x04, 0x43, 0x19, 0x04, 0x33, 0x1A, 0x04, 0x13, 0x1C, 0x04, 0xF2, 0x40,
+	0x12, 0x0F, 0x12, 0x00, 0x00, 0x22, 0x0F, 0x02, 0x52, 0x0E, 0x65, 0x0A, 0x68, 0x07, 0x5C, 0x04, 0x2F, 0x04, 0x12, 0x0F, 0x12, 0x00, 0x00, 0xF2, 0x40, 0x1A, 0x0A, 0x47, 0x0A, 0x54, 0x0C, 0x33,
+	0x0F, 0x00, 0x54, 0x0C, 0x47, 0x0A, 0x1A, 0x0A, 0x0F, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0F, 0x03, 0x00, 0x22, 0x0F, 0x02, 0x14, 0x0F, 0x01, 0x18,
+	0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x00, 0x16, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0xF2, 0x04, 0x00, 0x27, 0x25,
+	0x05, 0x16, 0x19, 0x04, 0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x59, 0x07, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x00, 0x27, 0x25, 0x05, 0x00, 0x78, 0x06,
+	0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x27, 0x25, 0x05, 0xF2, 0x04, 0x00, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x16, 0x14, 0x14, 0x04, 0x00, 0x00, 0x00, 0x26,
+	0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x16, 0x0E, 0x00, 0xE3, 0x04, 0xF2, 0x04, 0x12, 0x13, 0x0E, 0x00, 0x78, 0x13, 0x02, 0x97, 0x22, 0x01, 0x26, 0x27, 0x22, 0x16, 0x19, 0x13,
+	0x00, 0x16, 0x18, 0x14, 0x27, 0x15, 0x24, 0xE6, 0x01, 0xC6, 0x03, 0xF2, 0x04, 0x00, 0x27, 0x0C, 0x16, 0x0E, 0x00, 0x00, 0x26, 0x0D, 0xA7, 0x04, 0x98, 0x04, 0x22, 0xB2, 0x04, 0x00, 0x0F, 0x15,
+	0x22, 0xF2, 0x22, 0xE2, 0x01, 0xF2, 0x04, 0x00, 0x2B, 0x08, 0x2A, 0x09, 0x59, 0x07, 0x37, 0x32, 0x06, 0x36, 0x34, 0x05, 0x16, 0x28, 0x04, 0x0F, 0x11, 0x04, 0xF2, 0x04, 0x00, 0xB6, 0x04, 0x00,
+	0x17, 0x0D, 0x16, 0x0E, 0x00, 0x00, 0xB6, 0x04, 0xA7, 0x04, 0x17, 0x0D, 0x16, 0x0E, 0x00, 0x26, 0x0D, 0xB6, 0x04, 0x98, 0x04, 0xB6, 0x04, 0x00, 0x27, 0x0C, 0x16, 0x0E, 0x00, 0x00, 0x26, 0x0D,
+	0xB6, 0x04, 0x98, 0x04, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0xF6, 0x00, 0x27, 0x25, 0x05, 0x16, 0x19, 0x04,
+	0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x27, 0x25, 0x05, 0xF6, 0x00, 0xB6, 0x04, 0x00, 0x28, 0x0B, 0x26,
+	0x0D, 0x00, 0x00, 0x37, 0x24, 0x05, 0x47, 0x14, 0x05, 0x16, 0x23, 0x14, 0x04, 0x00, 0x00, 0x16, 0x14, 0x14, 0x04, 0x26, 0x23, 0x13, 0x04, 0x27, 0x52, 0x05, 0x27, 0x43, 0x05, 0x16, 0x0E, 0x00,
+	0xD4, 0x04, 0x00, 0x16, 0x19, 0x04, 0x00, 0x96, 0x06, 0xA6, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x2E, 0x05, 0xB6, 0x04, 0x00, 0x16, 0x0E, 0x46, 0x0B, 0x57, 0x09, 0x5A, 0x06, 0x4D,
+	0x04, 0x2F, 0x04, 0x5C, 0x04, 0x5A, 0x06, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0x26, 0x0D, 0x66, 0x09, 0x69, 0x06, 0x4D, 0x04, 0x3E, 0x04, 0x6A, 0x05, 0x66, 0x09, 0x26, 0x0D, 0x66, 0x09, 0x6A,
+	0x05, 0x3E, 0x04, 0x4D, 0x04, 0x69, 0x06, 0x56, 0x0A, 0x26, 0x0D, 0x26, 0x27, 0x04, 0x36, 0x35, 0x04, 0x38, 0x31, 0x06, 0x49, 0x08, 0x00, 0x38, 0x31, 0x06, 0x36, 0x35, 0x04, 0x26, 0x27, 0x04,
+	0x16, 0x0E, 0x36, 0x1B, 0x57, 0x18, 0x4A, 0x25, 0x4C, 0x31, 0x01, 0x4F, 0x02, 0x4D, 0x04, 0x4A, 0x07, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0x16, 0x28, 0x04, 0x16, 0x46, 0x04, 0x16, 0x44, 0x11,
+	0x04, 0x16, 0x42, 0x13, 0x04, 0x56, 0x15, 0x04, 0x46, 0x16, 0x04, 0x26, 0x18, 0x04, 0x1B, 0x09, 0x00, 0x29, 0x21, 0x07, 0x83, 0x81, 0x01, 0x22, 0x2F, 0x12, 0x0F, 0x12, 0x00, 0xF2, 0x40, 0x00,
+	0x12, 0x0F, 0x12, 0x00, 0x22, 0x2F, 0x83, 0x81, 0x01, 0x29, 0x21, 0x07, 0x1B, 0x09, 0x00, 0x19, 0x0B, 0x18, 0x0C, 0x00, 0x00, 0x19, 0x0B, 0x00, 0x1A, 0x0A, 0x00, 0x00, 0x19, 0x0B, 0xE2, 0x05,
+	0x12, 0x1C, 0x05, 0x00, 0x00, 0xE2, 0x05, 0x0F, 0x06, 0x00, 0x2A, 0x09, 0x49, 0x08, 0x68, 0x07, 0x87, 0x06, 0x36, 0x21, 0x31, 0x05, 0x16, 0x23, 0x13, 0x05, 0x2A, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x0E, 0x24, 0x0F, 0x33, 0x0F, 0x32, 0x0F, 0x01, 0xF1, 0x40, 0x01, 0x00, 0x32, 0x0F, 0x01, 0x33, 0x0F, 0x34, 0x0E, 0x25, 0x0E, 0x2A, 0x09,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x23, 0x13, 0x05, 0x36, 0x21, 0x31, 0x05, 0x87, 0x06, 0x68, 0x07, 0x49, 0x08, 0x2A, 0x09, 0x2E, 0x05, 0x2F, 0x04,
+	0x3F, 0x03, 0x0F, 0x31, 0x02, 0xF1, 0x40, 0x01, 0x00, 0x0F, 0x31, 0x02, 0x3F, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x26, 0x25, 0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x23, 0x2B, 0x03, 0xF2, 0x20,
+	0x02, 0x00, 0x23, 0x2B, 0x03, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x26, 0x25, 0x06, 0x23, 0x2B, 0x03, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x26, 0x25, 0x06, 0x81, 0x83, 0x01, 0x00, 0x26, 0x25,
+	0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x23, 0x2B, 0x03, 0x0F, 0x06, 0x26, 0xA2, 0x01, 0x00, 0x29, 0x0A, 0x86, 0x07, 0x26, 0x24, 0x07, 0x15, 0x27, 0x06, 0x15, 0x18, 0x06, 0x33, 0x38, 0x04,
+	0x15, 0x18, 0x06, 0x25, 0x26, 0x06, 0x26, 0x33, 0x07, 0x19, 0x25, 0x04, 0x19, 0x43, 0x04, 0xB4, 0x11, 0x04, 0x33, 0x13, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x23, 0x14, 0x16, 0x04,
+	0x24, 0x29, 0x04, 0x2E, 0x05, 0x1E, 0x06, 0x1A, 0x0A, 0x96, 0x06, 0x27, 0x23, 0x07, 0x16, 0x17, 0x06, 0x00, 0x00, 0x00, 0x27, 0x23, 0x07, 0x96, 0x06, 0x39, 0x09, 0x13, 0x0F, 0x02, 0x23, 0x15,
+	0x12, 0x07, 0x34, 0x13, 0x12, 0x07, 0x45, 0x11, 0x12, 0x07, 0x47, 0x12, 0x07, 0x89, 0x04, 0x00, 0x47, 0x12, 0x07, 0x35, 0x12, 0x12, 0x07, 0x34, 0x13, 0x12, 0x07, 0x23, 0x15, 0x12, 0x07, 0x13,
+	0x0F, 0x02, 0x82, 0x83, 0x00, 0x0F, 0x11, 0x04, 0x43, 0x41, 0x24, 0x03, 0x52, 0x11, 0x22, 0x24, 0x02, 0x12, 0x23, 0x14, 0x15, 0x02, 0x12, 0x14, 0x14, 0x15, 0x02, 0x00, 0x12, 0x24, 0x23, 0x14,
+	0x02, 0x22, 0x23, 0x23, 0x23, 0x02, 0x23, 0x53, 0x41, 0x03, 0x14, 0x24, 0x24, 0x04, 0x22, 0x0F, 0x02, 0x00, 0x0F, 0x06, 0x00, 0x22, 0x0F, 0x02, 0x00, 0x48, 0x09, 0x26, 0x24, 0x07, 0x15, 0x18,
+	0x06, 0x14, 0x1A, 0x05, 0x14, 0x62, 0x12, 0x05, 0x13, 0x22, 0x24, 0x12, 0x04, 0x13, 0x12, 0x16, 0x12, 0x04, 0x00, 0x00, 0x13, 0x22, 0x24, 0x12, 0x04, 0x14, 0x12, 0x14, 0x12, 0x05, 0x14, 0x1A,
+	0x05, 0x15, 0x18, 0x06, 0x26, 0x24, 0x07, 0x48, 0x09, 0x37, 0x0B, 0x23, 0x51, 0x0A, 0x13, 0x12, 0x13, 0x0A, 0x00, 0x23, 0x11, 0x12, 0x0B, 0x74, 0x0A, 0x1A, 0x0A, 0x3A, 0x08, 0x59, 0x07, 0x28,
+	0x23, 0x06, 0x27, 0x25, 0x05, 0x17, 0x17, 0x05, 0x3A, 0x08, 0x59, 0x07, 0x28, 0x23, 0x06, 0x27, 0x25, 0x05, 0x17, 0x17, 0x05, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x06,
+	0x00, 0x48, 0x09, 0x26, 0x24, 0x07, 0x15, 0x18, 0x06, 0x14, 0x1A, 0x05, 0x00, 0x13, 0x82, 0x12, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x00, 0x13, 0x12, 0x33, 0x13, 0x04, 0x13, 0x52, 0x21, 0x12,
+	0x04, 0x14, 0x13, 0x14, 0x11, 0x05, 0x14, 0x1A, 0x05, 0x15, 0x18, 0x06, 0x26, 0x24, 0x07, 0x48, 0x09, 0x11, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+	0x0E, 0x23, 0x22, 0x0C, 0x13, 0x14, 0x0C, 0x00, 0x23, 0x22, 0x0C, 0x25, 0x0E, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x95, 0x12, 0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x24,
+	0x24, 0x09, 0x13, 0x15, 0x11, 0x09, 0x13, 0x14, 0x12, 0x09, 0x13, 0x23, 0x12, 0x09, 0x44, 0x13, 0x09, 0x14, 0x25, 0x09, 0x13, 0x17, 0x09, 0x13, 0x13, 0x13, 0x09, 0x13, 0x22, 0x13, 0x09, 0x34,
+	0x31, 0x0A, 0x14, 0x0F, 0x01, 0x13, 0x0F, 0x02, 0x22, 0x0F, 0x02, 0x12, 0x0F, 0x03, 0xF6, 0x00, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x2F, 0x04, 0x96, 0x06, 0xB6, 0x04, 0x0F, 0x11, 0x04, 0x00,
+	0x54, 0x0C, 0x73, 0x0B, 0x00, 0xF3, 0x20, 0x01, 0x00, 0x13, 0x0F, 0x02, 0x00, 0xF3, 0x20, 0x01, 0x13, 0x0F, 0x02, 0x29, 0x0A, 0x00, 0x0F, 0x22, 0x02, 0x0F, 0x13, 0x11, 0x0F, 0x24, 0x14, 0x16,
+	0x09, 0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x09, 0x00, 0x00, 0x45, 0x0C, 0x64, 0x0B, 0x23, 0x24, 0x0A, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x64, 0x0B, 0x45, 0x0C, 0x17, 0x17, 0x05, 0x27, 0x25, 0x05,
+	0x28, 0x23, 0x06, 0x59, 0x07, 0x3A, 0x08, 0x17, 0x17, 0x05, 0x27, 0x25, 0x05, 0x28, 0x23, 0x06, 0x59, 0x07, 0x3A, 0x08, 0x14, 0x16, 0x09, 0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x14, 0x04, 0x1B,
+	0x32, 0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x24, 0x06, 0x35, 0x34, 0x06, 0x24, 0x24, 0x12, 0x06, 0x23, 0x24, 0x13, 0x06, 0x98, 0x04, 0x00, 0x1E, 0x06, 0x14, 0x16, 0x09,
+	0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x14, 0x04, 0x1B, 0x32, 0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x17, 0x04, 0x35, 0x21, 0x24, 0x04, 0x24, 0x12, 0x15, 0x11, 0x04, 0x23,
+	0x13, 0x14, 0x12, 0x04, 0x18, 0x23, 0x12, 0x04, 0x49, 0x13, 0x04, 0x0F, 0x11, 0x04, 0x14, 0x25, 0x09, 0x13, 0x17, 0x09, 0x13, 0x13, 0x13, 0x09, 0x13, 0x22, 0x13, 0x14, 0x04, 0x34, 0x31, 0x33,
+	0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x24, 0x06, 0x35, 0x34, 0x06, 0x24, 0x24, 0x12, 0x06, 0x23, 0x24, 0x13, 0x06, 0x98, 0x04, 0x00, 0x1E, 0x06, 0x2F, 0x04, 0x5E, 0x02,
+	0x2D, 0x13, 0x02, 0x2C, 0x15, 0x01, 0x2B, 0x16, 0x01, 0x26, 0x32, 0x16, 0x01, 0x26, 0x12, 0x18, 0x01, 0x0F, 0x23, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x21, 0x03, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B,
+	0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x10, 0x42, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x11, 0x41, 0x14, 0x09, 0x55, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11,
+	0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x43, 0x14, 0x09, 0x11, 0x21, 0x16, 0x09, 0x10, 0x42, 0x14, 0x09, 0x10, 0x54, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F,
+	0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x11, 0x53, 0x11, 0x09, 0x20, 0x41, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x20, 0x41, 0x14, 0x09, 0x11, 0x53, 0x11, 0x09, 0x48,
+	0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x20, 0x46, 0x09, 0x10, 0x54, 0x11, 0x09, 0x10, 0x42, 0x14, 0x09, 0x20, 0x21, 0x16, 0x09, 0x11, 0x41,
+	0x14, 0x09, 0x11, 0x53, 0x11, 0x09, 0x20, 0x46, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x20, 0x46, 0x09, 0x20, 0x53, 0x11, 0x09, 0x43, 0x14,
+	0x09, 0x23, 0x16, 0x09, 0x43, 0x14, 0x09, 0x20, 0x53, 0x11, 0x09, 0x20, 0x46, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11,
+	0x09, 0x61, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x10, 0x42, 0x14, 0x09, 0x31, 0x51, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x3D, 0x05, 0x3B, 0x07, 0x39,
+	0x09, 0x37, 0x11, 0x09, 0x35, 0x13, 0x09, 0x33, 0x15, 0x09, 0x13, 0x17, 0x09, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0x67, 0x08,
+	0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x29, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x13, 0x3C, 0x02, 0x13, 0x1C, 0x11, 0x11, 0x13, 0x1C, 0x22, 0x23, 0x2A, 0x04, 0x24, 0x19, 0x05, 0x34, 0x36,
+	0x05, 0x25, 0x26, 0x06, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x10, 0x12, 0x15, 0x16, 0x04, 0x00, 0x11, 0x11, 0x15, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x13, 0x1C, 0x04,
+	0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x11, 0x11, 0x15, 0x16, 0x04, 0x10, 0x12, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x13,
+	0x15, 0x16, 0x04, 0x11, 0x11, 0x15, 0x16, 0x04, 0x20, 0x11, 0x15, 0x16, 0x04, 0x10, 0x12, 0x15, 0x16, 0x04, 0x20, 0x11, 0x15, 0x16, 0x04, 0x11, 0x11, 0x15, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x20, 0x11, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x20, 0x11, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x13, 0x1C, 0x04,
+	0x10, 0x0F, 0x05, 0x10, 0xE2, 0x04, 0x11, 0xE1, 0x04, 0x11, 0xE1, 0x04, 0x10, 0xE2, 0x04, 0x10, 0x0F, 0x05, 0x11, 0x0F, 0x04, 0x20, 0xE1, 0x04, 0x10, 0xE2, 0x04, 0x20, 0x0F, 0x04, 0x11, 0x0F,
+	0x04, 0x20, 0x0F, 0x04, 0x00, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x20, 0x0F, 0x04, 0x00, 0x19, 0x0B, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0x23, 0x2A,
+	0x04, 0x14, 0x29, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x33, 0x0F, 0x20, 0x32, 0x0E, 0x10, 0x35, 0x0C, 0x10, 0x37, 0x0A, 0x20, 0x47, 0x08, 0x11, 0x39, 0x07, 0x11, 0x3B,
+	0x05, 0x20, 0x3C, 0x04, 0xE3, 0x04, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x11, 0x11, 0x1C, 0x04, 0x23,
+	0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x11, 0x11, 0x1C, 0x04,
+	0x10, 0x12, 0x1C, 0x04, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x11,
+	0x11, 0x1C, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x11, 0x21, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5,
+	0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x20, 0x21, 0x2A, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x20, 0x11, 0x1C, 0x04, 0x11, 0x11, 0x1C, 0x04, 0x11, 0x21, 0x2A, 0x04, 0x20, 0x12, 0x1A, 0x05,
+	0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x20, 0x21, 0x2A, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x20, 0x21,
+	0x2A, 0x04, 0x20, 0x12, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x25, 0x25, 0x07, 0x26, 0x23, 0x08, 0x27, 0x21, 0x09, 0x38, 0x0A, 0x00, 0x27, 0x21, 0x09, 0x26, 0x23, 0x08, 0x25,
+	0x25, 0x07, 0x67, 0x13, 0x04, 0xC5, 0x04, 0x34, 0x36, 0x05, 0x14, 0x38, 0x05, 0x23, 0x27, 0x21, 0x04, 0x13, 0x27, 0x13, 0x04, 0x13, 0x35, 0x14, 0x04, 0x13, 0x34, 0x15, 0x04, 0x13, 0x23, 0x17,
+	0x04, 0x23, 0x21, 0x27, 0x04, 0x34, 0x18, 0x05, 0x34, 0x36, 0x05, 0xC3, 0x06, 0x13, 0x63, 0x08, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x10, 0x1F, 0x04, 0x00, 0x11,
+	0x1E, 0x04, 0x2F, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x11, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x00, 0x2F, 0x04, 0x3D, 0x05,
+	0xC3, 0x06, 0x93, 0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x11, 0x1E, 0x04, 0x20, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x20, 0x1E, 0x04, 0x11, 0x2D, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93,
+	0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x20, 0x2D, 0x04, 0x20, 0x1E, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x20, 0x2D, 0x04, 0x20, 0x3B, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x23, 0x0F, 0x01, 0x33,
+	0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x11, 0x87, 0x04, 0x10, 0x88, 0x04, 0x10, 0x36, 0x0B, 0x36, 0x0C, 0x34, 0x0E, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x15, 0x17, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x25, 0x24, 0x08, 0x76, 0x08, 0x47, 0x0A, 0xB6, 0x04, 0xE3, 0x04, 0x23, 0x0F, 0x01, 0x12, 0x0F, 0x03, 0x12, 0x2C, 0x04, 0x12, 0x1D, 0x04, 0x12, 0x44, 0x15, 0x04, 0x22,
+	0x22, 0x31, 0x14, 0x04, 0x43, 0x23, 0x14, 0x04, 0x24, 0x65, 0x04, 0x4C, 0x05, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x12, 0x23, 0x22, 0x14, 0x04, 0x12, 0x13, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13,
+	0x15, 0x04, 0x14, 0x11, 0x13, 0x15, 0x04, 0x16, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15,
+	0x04, 0x14, 0x11, 0x13, 0x15, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x14, 0x05, 0x12, 0x93, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x14,
+	0x21, 0x22, 0x14, 0x04, 0x23, 0x11, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x15, 0x04, 0x12, 0x13, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x14, 0x05, 0x23, 0x91, 0x06, 0x14, 0xA2, 0x04, 0x0F, 0x11,
+	0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x23, 0x21, 0x22, 0x14, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x00, 0x23, 0x11, 0x13, 0x15, 0x04, 0x14, 0x11, 0x13, 0x14, 0x05, 0x14, 0x91, 0x06,
+	0x13, 0xA3, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x22, 0x22, 0x22, 0x14, 0x04, 0x22, 0x12, 0x13, 0x15, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x22, 0x12, 0x13, 0x14,
+	0x05, 0x22, 0x92, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x31, 0x12, 0x13, 0x15, 0x04, 0x10, 0x13, 0x11, 0x13, 0x15, 0x04, 0x00,
+	0x31, 0x12, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x52, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x16, 0x13, 0x24, 0x04,
+	0x16, 0x13, 0x23, 0x05, 0x87, 0x06, 0x97, 0x05, 0x27, 0x12, 0x22, 0x05, 0x16, 0x14, 0x14, 0x04, 0x00, 0x00, 0x00, 0x26, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x59, 0x07, 0x97,
+	0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x16, 0x39, 0x02, 0x16, 0x19, 0x11, 0x11, 0x16, 0x19, 0x22, 0x27, 0x25, 0x05, 0x00, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x12, 0x13, 0x14,
+	0x14, 0x04, 0x00, 0x22, 0x12, 0x14, 0x14, 0x04, 0x14, 0x11, 0x14, 0x14, 0x04, 0x26, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x16,
+	0x14, 0x14, 0x04, 0x14, 0x11, 0x14, 0x14, 0x04, 0x13, 0x12, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x12, 0x23, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97,
+	0x05, 0x14, 0x21, 0x13, 0x13, 0x05, 0x23, 0x11, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x12, 0x13, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x23, 0x21, 0x13, 0x23, 0x04, 0x14,
+	0x52, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97, 0x05, 0x22, 0x22, 0x13, 0x13, 0x05, 0x22, 0x12, 0x14, 0x14, 0x04, 0x16, 0x14, 0x14, 0x04, 0x00, 0x22, 0x12, 0x14, 0x14, 0x04, 0x22, 0x22,
+	0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x12, 0x0F, 0x03, 0x22, 0x0F, 0x02, 0x13, 0xB2, 0x04, 0x14, 0xB1, 0x04, 0x14, 0xB1, 0x04, 0x13, 0xB2, 0x04, 0x22, 0x0F, 0x02, 0x12, 0x0F,
+	0x03, 0x14, 0x0F, 0x01, 0x23, 0x0F, 0x01, 0x22, 0xB2, 0x04, 0x12, 0xB3, 0x04, 0x22, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x22, 0x0F, 0x02, 0x00, 0xB6, 0x04, 0x00, 0x22, 0x0F, 0x02,
+	0x00, 0x69, 0x06, 0x88, 0x05, 0x12, 0x12, 0x21, 0x26, 0x04, 0x12, 0x11, 0x12, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x00, 0x33, 0x11, 0x18, 0x04, 0x22, 0x41, 0x26, 0x04, 0x12, 0xA3, 0x05, 0x78,
+	0x06, 0xB6, 0x04, 0x23, 0xB1, 0x04, 0x13, 0x23, 0x0C, 0x13, 0x12, 0x0E, 0x23, 0x11, 0x0E, 0x14, 0x11, 0x0E, 0x14, 0x21, 0x0D, 0x13, 0xB2, 0x04, 0x98, 0x04, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27,
+	0x04, 0x12, 0x13, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x13, 0x12, 0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16,
+	0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x13, 0x12, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x12, 0x23, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x14, 0x21, 0x27, 0x04, 0x23, 0x11,
+	0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x12, 0x13, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x23, 0x21, 0x27, 0x04, 0x14, 0x92, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x23, 0x21, 0x27, 0x04, 0x13,
+	0x12, 0x19, 0x04, 0x00, 0x23, 0x11, 0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x14, 0x21, 0x27, 0x04, 0x13, 0x93, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x22, 0x22, 0x27, 0x04, 0x22, 0x12, 0x19,
+	0x04, 0x16, 0x19, 0x04, 0x00, 0x22, 0x12, 0x19, 0x04, 0x22, 0x22, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x25, 0x12, 0x22, 0x07, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00,
+	0x3A, 0x13, 0x04, 0xA7, 0x04, 0x27, 0x25, 0x05, 0x16, 0x35, 0x11, 0x04, 0x16, 0x24, 0x13, 0x04, 0x16, 0x23, 0x14, 0x04, 0x16, 0x31, 0x15, 0x04, 0x27, 0x25, 0x05, 0xA6, 0x05, 0x16, 0x33, 0x08,
+	0x96, 0x06, 0xA6, 0x05, 0x12, 0x2C, 0x04, 0x22, 0x1C, 0x04, 0x13, 0x1C, 0x04, 0x14, 0x1B, 0x04, 0x2E, 0x05, 0xB6, 0x04, 0x00, 0x96, 0x06, 0xA6, 0x05, 0x2F, 0x04, 0x14, 0x1B, 0x04, 0x13, 0x1C,
+	0x04, 0x22, 0x1C, 0x04, 0x12, 0x2B, 0x05, 0xB6, 0x04, 0x00, 0x96, 0x06, 0x14, 0xA1, 0x05, 0x23, 0x2A, 0x04, 0x22, 0x1C, 0x04, 0x12, 0x1D, 0x04, 0x22, 0x1C, 0x04, 0x23, 0x29, 0x05, 0x14, 0xB1,
+	0x04, 0xB6, 0x04, 0x96, 0x06, 0x22, 0xA2, 0x05, 0x22, 0x2B, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x22, 0x1C, 0x04, 0x22, 0x2A, 0x05, 0xB6, 0x04, 0x00, 0x16, 0x0E, 0x36, 0x1B, 0x57, 0x18, 0x4A, 0x25,
+	0x14, 0x47, 0x31, 0x01, 0x13, 0x4B, 0x02, 0x22, 0x49, 0x04, 0x12, 0x47, 0x07, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0xF2, 0x40, 0x00, 0x18, 0x25, 0x05, 0x17, 0x17, 0x05, 0x16, 0x19, 0x04, 0x00,
+	0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x16, 0x0E, 0x36, 0x1B, 0x22, 0x53, 0x18, 0x22, 0x46, 0x25, 0x4C, 0x31, 0x01, 0x4F, 0x02, 0x22, 0x49, 0x04, 0x22, 0x46, 0x07, 0x57, 0x09, 0x46,
+	0x0B, 0x16, 0x0E, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x12, 0x53, 0x11, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x11, 0x17, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x53, 0x11, 0x08,
+	0x49, 0x08, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x15, 0x22, 0x31, 0x21, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00, 0x15, 0x21, 0x12, 0x22, 0x05, 0x98,
+	0x04, 0x89, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x20, 0x54, 0x11, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x11, 0x17, 0x08, 0x12, 0x41, 0x14, 0x08, 0x20,
+	0x54, 0x11, 0x08, 0x49, 0x08, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x28, 0x31, 0x21, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00,
+	0x15, 0x21, 0x12, 0x22, 0x05, 0x23, 0x93, 0x04, 0x89, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x56, 0x11, 0x08, 0x44, 0x14, 0x08, 0x14, 0x17, 0x08, 0x44,
+	0x14, 0x08, 0x56, 0x11, 0x08, 0x49, 0x08, 0x4B, 0x42, 0x5D, 0x12, 0x0F, 0x11, 0x13, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x28, 0x31, 0x21, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x00, 0x27, 0x12, 0x22,
+	0x05, 0xD8, 0x99, 0x12, 0x0F, 0x11, 0x13, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x12, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x00,
+	0x10, 0x14, 0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x15, 0x11, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x13, 0x23,
+	0x26, 0x04, 0x28, 0x24, 0x05, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x00, 0x21, 0x11,
+	0x1B, 0x04, 0x12, 0x12, 0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x14, 0x12, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x00, 0x24,
+	0x21, 0x26, 0x04, 0x15, 0x22, 0x24, 0x05, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x15,
+	0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x24, 0x11, 0x18, 0x04, 0x00, 0x17, 0x18, 0x04, 0x27, 0x26, 0x04, 0x28, 0x24, 0x05, 0x0F,
+	0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x10, 0x13, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x14, 0x19, 0x05,
+	0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x13, 0x23, 0x26, 0x04, 0x23, 0x12, 0x18, 0x04, 0x24, 0x11, 0x18, 0x04, 0x00, 0x23, 0x22, 0x26, 0x04, 0x13, 0x24, 0x24,
+	0x05, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x1B, 0x04, 0x10, 0x13, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x14, 0x19, 0x05, 0x25, 0x27,
+	0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0x18, 0x16, 0x05, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x23, 0x11, 0x0E, 0x33, 0x0F,
+	0x1A, 0x0A, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x14, 0x1B, 0x04, 0x00, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05,
+	0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x15, 0x12, 0x16, 0x05, 0xE3, 0x04, 0x00, 0x15, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x12, 0x11, 0x15,
+	0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x12, 0x23, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00,
+	0x15, 0x21, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x12, 0x11, 0x15, 0x15, 0x04, 0x00, 0x00,
+	0x20, 0x12, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x23, 0x22, 0x12, 0x23, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00, 0x23,
+	0x22, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00,
+	0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x12, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x00, 0x27, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39,
+	0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x55, 0x14, 0x15, 0x25, 0x12, 0x14, 0x1B, 0x13, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05,
+	0x27, 0x12, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x17, 0x13, 0x54, 0x17, 0x13, 0x24, 0x12, 0x27, 0x12, 0x23, 0x13, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15,
+	0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04,
+	0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x13, 0x23, 0x12, 0x23, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x00, 0x23, 0x22, 0x12, 0x23, 0x04, 0x13, 0x44,
+	0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x20, 0x12, 0x15,
+	0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x12, 0x21, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x15, 0x21, 0x26,
+	0x22, 0x14, 0x12, 0x18, 0x13, 0x23, 0x12, 0x18, 0x13, 0x00, 0x24, 0x22, 0x24, 0x23, 0x15, 0xD1, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x20,
+	0x12, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x12, 0x11, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F,
+	0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x23, 0x22, 0x26, 0x22, 0x15, 0x11, 0x18, 0x13, 0x00, 0x00, 0x23, 0x23, 0x24, 0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25,
+	0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x21, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62,
+	0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x27, 0x26, 0x22, 0x24, 0x11, 0x18, 0x13, 0x00, 0x17, 0x18, 0x13, 0x28, 0x24, 0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67,
+	0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x14, 0x1B, 0x11, 0x11, 0x14, 0x15, 0x15, 0x21, 0x01, 0x14, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12,
+	0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x27, 0x26, 0x22, 0x33, 0x11, 0x18, 0x13, 0x12, 0x21, 0x11, 0x18, 0x13, 0x17, 0x18, 0x13, 0x28, 0x24,
+	0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x19, 0x0B, 0x12, 0x16, 0x0B, 0x21, 0x16, 0x0B, 0x20, 0x17, 0x0B, 0x00, 0x21, 0x16, 0x0B, 0x12, 0x16, 0x0B, 0xD4, 0x04, 0x00, 0x0F,
+	0x06, 0xE3, 0x04, 0x11, 0xE1, 0x04, 0x20, 0x16, 0x0C, 0x10, 0x16, 0x0D, 0x00, 0x20, 0x15, 0x0D, 0x11, 0xA5, 0x04, 0x98, 0x04, 0x16, 0x0E, 0xD4, 0x04, 0x00, 0x16, 0x13, 0x0A, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x16, 0x0E, 0x14, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x14, 0x12, 0x0D, 0x17, 0x0D, 0x00, 0xA7, 0x04, 0x98, 0x04, 0x21, 0x0F, 0x03, 0x11, 0x0F,
+	0x04, 0x11, 0xD2, 0x04, 0x12, 0xD1, 0x04, 0x12, 0x0F, 0x03, 0x21, 0x0F, 0x03, 0x0F, 0x06, 0x24, 0x0F, 0x14, 0xA2, 0x04, 0x24, 0xA1, 0x04, 0x15, 0x0F, 0x24, 0x0F, 0x12, 0x0F, 0x03, 0x00, 0x12,
+	0xD1, 0x04, 0x00, 0x12, 0x0F, 0x03, 0x15, 0x0F, 0x00, 0x15, 0xA1, 0x04, 0x00, 0x15, 0x0F, 0x0F, 0x06, 0x20, 0x0F, 0x04, 0x12, 0xD1, 0x04, 0x00, 0x12, 0x0F, 0x03, 0x20, 0x0F, 0x04, 0x0F, 0x06,
+	0x23, 0x0F, 0x01, 0x15, 0xA1, 0x04, 0x00, 0x15, 0x0F, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0xF4, 0x20, 0xE4, 0x12, 0x0F, 0x15, 0x0F, 0x06, 0x23, 0xE2, 0x23, 0xB2, 0x12, 0x0F, 0x15, 0x0F, 0x06,
+	0x00, 0x21, 0xD1, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1D, 0x07, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x14, 0x2A,
+	0x04, 0xC4, 0x05, 0x94, 0x08, 0x0F, 0x06, 0x23, 0xA2, 0x04, 0x00, 0x0F, 0x06, 0x0F, 0x15, 0x23, 0xE2, 0x23, 0xD2, 0x01, 0x1D, 0x07, 0x3D, 0x05, 0x2F, 0x04, 0x12, 0x1D, 0x04, 0x21, 0x11, 0x1B,
+	0x04, 0x20, 0x12, 0x1B, 0x04, 0x20, 0x12, 0x2A, 0x04, 0x21, 0xC1, 0x05, 0x12, 0x91, 0x08, 0x24, 0x1E, 0x23, 0xE2, 0x23, 0xD2, 0x01, 0x14, 0x0F, 0x01, 0x15, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04,
+	0x2A, 0x09, 0x29, 0x0A, 0x38, 0x0A, 0x27, 0x21, 0x16, 0x11, 0x26, 0x23, 0x25, 0x01, 0x25, 0x35, 0x06, 0x24, 0x37, 0x05, 0x14, 0x39, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x2B,
+	0x08, 0x3A, 0x15, 0x11, 0x29, 0x31, 0x23, 0x01, 0x37, 0x33, 0x05, 0x17, 0x27, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x2B, 0x08, 0x3A, 0x08, 0x59, 0x07, 0x28, 0x23, 0x06, 0x27,
+	0x25, 0x05, 0x17, 0x27, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x12, 0x1D, 0x04, 0x20, 0x1E, 0x04, 0x00, 0x10, 0x1F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x0F, 0x06, 0x11, 0xE1,
+	0x04, 0x10, 0xE2, 0x04, 0x10, 0x0F, 0x05, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x0F, 0x11, 0x11, 0x11, 0x0F, 0x11, 0x21, 0x01, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x0F, 0x06, 0xE3,
+	0x11, 0x11, 0xE3, 0x21, 0x01, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x24, 0x11, 0x18, 0x04, 0x34, 0x19, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x0F,
+	0x06, 0x23, 0x11, 0x0E, 0x33, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x29, 0x15, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x29,
+	0x0A, 0x00, 0x2B, 0x08, 0x1B, 0x09, 0xD4, 0x04, 0x29, 0x15, 0x04, 0x19, 0x16, 0x04, 0x28, 0x16, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x2B, 0x08, 0xE3, 0x04, 0x00, 0x29, 0x0A, 0x0F, 0x06,
+	0xD4, 0x04, 0x00, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x12, 0x36, 0x09, 0x20, 0x39, 0x07, 0x20, 0x3A, 0x06, 0x10, 0x3D, 0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17,
+	0x0D, 0x15, 0x11, 0x0D, 0x23, 0x12, 0x0D, 0x13, 0xA3, 0x04, 0x98, 0x04, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x39, 0x16, 0x11, 0x3B, 0x24, 0x01, 0x3C, 0x06, 0x3E,
+	0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x1A, 0x11, 0x17, 0x2A, 0x01, 0x17, 0x0D, 0xA7, 0x04, 0x98, 0x04, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x34, 0x0E, 0x10, 0x35,
+	0x0C, 0x20, 0x35, 0x0B, 0x21, 0x36, 0x09, 0x21, 0x38, 0x07, 0x20, 0x3A, 0x06, 0x10, 0x3D, 0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x13, 0xA3, 0x04, 0x23, 0x13, 0x0C, 0x24, 0x11, 0x0D,
+	0x00, 0x23, 0x12, 0x0D, 0x13, 0xA3, 0x04, 0x98, 0x04, 0x24, 0x11, 0x0D, 0x44, 0x0D, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x98, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04,
+	0x26, 0x0D, 0x15, 0x0F, 0x00, 0x14, 0x1A, 0x05, 0x14, 0x2A, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x34, 0x28, 0x04, 0xB5, 0x05, 0x77, 0x07, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x0D, 0x00,
+	0x17, 0x1C, 0x00, 0xE7, 0xB9, 0x01, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05,
+	0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x00, 0x15, 0x21, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0x77, 0x07,
+	0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x20, 0x12, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08,
+	0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x23, 0x22, 0x26, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x00, 0x23, 0x22, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27,
+	0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x13, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x20, 0x13, 0x19, 0x05, 0x10, 0x24, 0x27, 0x05,
+	0x10, 0x95, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x24, 0x11, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x13, 0x11, 0x11, 0x18, 0x04, 0x24, 0x21, 0x26, 0x04,
+	0x23, 0x83, 0x05, 0x13, 0x65, 0x06, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0x27, 0x26, 0x04, 0x88, 0x05, 0x00, 0x27, 0x12, 0x23, 0x04, 0x17,
+	0x13, 0x14, 0x04, 0x00, 0x00, 0x27, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x12, 0x11, 0x15, 0x0A, 0x20, 0x12, 0x15,
+	0x0A, 0x20, 0x12, 0x35, 0x08, 0x10, 0x13, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x15, 0x12, 0x0C, 0x23, 0x22, 0x0C, 0x13, 0x23,
+	0x0C, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x14, 0x15, 0x17, 0x11, 0x14, 0x15, 0x27, 0x01, 0x14, 0x35, 0x08, 0x14, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04,
+	0x17, 0x18, 0x04, 0x0F, 0x06, 0xA7, 0x11, 0x11, 0xA7, 0x21, 0x01, 0x18, 0x0C, 0x27, 0x0C, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x10, 0x13, 0x15, 0x0A, 0x20, 0x12, 0x15, 0x0A,
+	0x21, 0x11, 0x15, 0x0A, 0x00, 0x20, 0x12, 0x35, 0x08, 0x10, 0x13, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0x13, 0xA3, 0x04, 0x23, 0xA2, 0x04, 0x24,
+	0x12, 0x0C, 0x24, 0x21, 0x0C, 0x23, 0x22, 0x0C, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x14, 0x14, 0x16, 0x04, 0x14, 0x24, 0x15, 0x04, 0x12, 0x11,
+	0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x24, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x57, 0x23, 0x04, 0x17,
+	0x13, 0x14, 0x04, 0x00, 0x15, 0x11, 0x23, 0x13, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x13, 0x23, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25,
+	0x04, 0x12, 0x11, 0x14, 0x16, 0x04, 0x21, 0x11, 0x24, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x00, 0x21, 0x11, 0x15, 0x15, 0x04, 0x12, 0x21, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35,
+	0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x15, 0x51, 0x23, 0x04, 0x14, 0x12, 0x13, 0x14, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x24, 0x11, 0x23, 0x13, 0x04, 0x15, 0x21,
+	0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x14, 0x14, 0x16, 0x04, 0x14, 0x24, 0x15, 0x13, 0x14, 0x15, 0x35, 0x11, 0x14, 0x15, 0x15,
+	0x31, 0x14, 0x15, 0x15, 0x04, 0x24, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x57, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x17, 0x13, 0x14, 0x13, 0x17,
+	0x23, 0x33, 0x11, 0x17, 0x23, 0x13, 0x31, 0x27, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x10, 0x13, 0x14, 0x16, 0x04, 0x20, 0x12,
+	0x24, 0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x23, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x13, 0x53,
+	0x23, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x24, 0x11, 0x23, 0x13, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x13, 0x23, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x14, 0x0F,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x13, 0xF4, 0x11, 0x14, 0x3D, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x17, 0x0D, 0x97, 0x05, 0xC5, 0x13, 0x17, 0x38, 0x11, 0x17, 0x18, 0x31, 0x14, 0x0F, 0x01,
+	0x00, 0x00, 0x10, 0x13, 0x0F, 0x01, 0x20, 0x12, 0x0F, 0x01, 0x21, 0xD1, 0x04, 0x00, 0x20, 0x12, 0x0F, 0x01, 0x10, 0x13, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x17, 0x0D, 0x97, 0x05, 0xC5,
+	0x04, 0x17, 0x18, 0x04, 0x00, 0x23, 0x11, 0x0E, 0x33, 0x0F, 0x14, 0x0F, 0x01, 0x00, 0x14, 0x15, 0x0A, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x14, 0x0F, 0x01, 0x00, 0x17,
+	0x13, 0x09, 0x97, 0x05, 0xC5, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x21, 0x2C, 0x04, 0x11, 0x1E, 0x04, 0x00, 0x12, 0x1D, 0x04, 0x12, 0x2C, 0x04,
+	0x21, 0x2B, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x24, 0x1A, 0x04, 0x14, 0x1B, 0x04, 0x24, 0x1A, 0x04, 0x15, 0x19, 0x05, 0x24, 0xA1, 0x04, 0xA7, 0x04, 0x0F, 0x06,
+	0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x12, 0x2C, 0x04, 0x12, 0x1D, 0x04, 0x00, 0x00, 0x12, 0x2C, 0x04, 0x2E, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0x15, 0xA1, 0x04, 0x15, 0x1A,
+	0x04, 0x00, 0x00, 0x15, 0x19, 0x05, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x20, 0x2D, 0x04, 0x12, 0x1D, 0x04, 0x00, 0x00, 0x20, 0x2D, 0x04, 0x2E, 0x05, 0xB4, 0x06,
+	0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x23, 0x1B, 0x04, 0x15, 0x1A, 0x04, 0x00, 0x15, 0x19, 0x05, 0x23, 0xA2, 0x04, 0xA7, 0x04, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x2F,
+	0x04, 0x40, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x21, 0x2C, 0x04, 0x2E, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x42, 0x1A, 0x04, 0x12, 0x12,
+	0x1A, 0x04, 0x12, 0x12, 0x19, 0x05, 0x23, 0xA2, 0x04, 0xA7, 0x04, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x12, 0x2B, 0x05, 0x21, 0x2C, 0x04, 0x20, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x12, 0x1D, 0x04,
+	0x20, 0x2D, 0x04, 0x10, 0x2D, 0x05, 0x10, 0xB3, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x15, 0x1A, 0x04, 0x24, 0x1A, 0x04, 0x23, 0x1B, 0x04, 0x13, 0x11, 0x19, 0x05, 0x24, 0xA1,
+	0x04, 0x23, 0xA2, 0x04, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x51, 0x0F, 0x21, 0x12, 0x2F, 0x13, 0x2E, 0x05, 0xB4, 0x06, 0x94,
+	0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x1F, 0x41, 0xB7, 0x12, 0xA7, 0x13, 0x14, 0x0F, 0x01, 0x44, 0x0D, 0x66, 0x09, 0x69, 0x06, 0x5C, 0x04, 0x2F, 0x04, 0x5B,
+	0x05, 0x12, 0x55, 0x08, 0x21, 0x52, 0x0B, 0x20, 0x22, 0x0F, 0x20, 0x62, 0x0B, 0x21, 0x55, 0x08, 0x12, 0x58, 0x05, 0x2F, 0x04, 0x5C, 0x04, 0x69, 0x06, 0x66, 0x09, 0x44, 0x0D, 0x14, 0x0F, 0x01,
+	0x27, 0x0C, 0x67, 0x08, 0x6B, 0x04, 0x0F, 0x11, 0x04, 0x15, 0x56, 0x04, 0x14, 0x62, 0x08, 0x23, 0x12, 0x0D, 0x23, 0x62, 0x08, 0x24, 0x56, 0x04, 0x15, 0x29, 0x04, 0x5B, 0x05, 0x67, 0x08, 0x27,
+	0x0C, 0x0F, 0x06, 0x24, 0x0F, 0x34, 0x0E, 0x12, 0x33, 0x0C, 0x21, 0x35, 0x0A, 0x20, 0x87, 0x04, 0x00, 0x21, 0x35, 0x0A, 0x12, 0x33, 0x0C, 0x34, 0x0E, 0x24, 0x0F, 0x17, 0x0D, 0x47, 0x19, 0x15,
+	0x53, 0x25, 0x14, 0x47, 0x22, 0x01, 0x23, 0x4A, 0x02, 0x23, 0x57, 0x04, 0x24, 0x53, 0x07, 0x15, 0x41, 0x0A, 0x17, 0x0D, 0x0F, 0x06, 0x24, 0x0F, 0x34, 0x0E, 0x21, 0x33, 0x0C, 0x21, 0x35, 0x0A,
+	0x89, 0x04, 0x00, 0x21, 0x35, 0x0A, 0x21, 0x33, 0x0C, 0x34, 0x0E, 0x24, 0x0F, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04, 0x14, 0x37, 0x11, 0x04, 0x14, 0x26, 0x13, 0x04, 0x12, 0x11, 0x25,
+	0x14, 0x04, 0x20, 0x12, 0x33, 0x15, 0x04, 0x20, 0x12, 0x22, 0x17, 0x04, 0x10, 0x13, 0x21, 0x18, 0x04, 0x34, 0x19, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27, 0x04, 0x17, 0x45, 0x04, 0x17,
+	0x34, 0x11, 0x04, 0x15, 0x11, 0x32, 0x13, 0x04, 0x23, 0x12, 0x31, 0x14, 0x04, 0x13, 0x33, 0x16, 0x04, 0x27, 0x17, 0x04, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04, 0x14, 0x37, 0x11, 0x04,
+	0x14, 0x26, 0x13, 0x04, 0x21, 0x11, 0x25, 0x14, 0x04, 0x21, 0x11, 0x33, 0x15, 0x04, 0x14, 0x22, 0x17, 0x04, 0x14, 0x21, 0x18, 0x04, 0x34, 0x19, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27,
+	0x04, 0x17, 0x45, 0x04, 0x23, 0x12, 0x34, 0x11, 0x04, 0x23, 0x12, 0x32, 0x13, 0x04, 0x17, 0x31, 0x14, 0x04, 0x37, 0x16, 0x04, 0x27, 0x17, 0x04, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04,
+	0x10, 0x13, 0x37, 0x11, 0x04, 0x20, 0x12, 0x26, 0x13, 0x04, 0x21, 0x11, 0x25, 0x14, 0x04, 0x21, 0x11, 0x33, 0x15, 0x04, 0x20, 0x12, 0x22, 0x17, 0x04, 0x10, 0x13, 0x21, 0x18, 0x04, 0x34, 0x19,
+	0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27, 0x04, 0x13, 0x13, 0x45, 0x04, 0x23, 0x12, 0x34, 0x11, 0x04, 0x24, 0x11, 0x32, 0x13, 0x04, 0x24, 0x11, 0x31, 0x14, 0x04, 0x23, 0x32, 0x16, 0x04,
+	0x13, 0x23, 0x17, 0x04, 0x0F, 0x06, 0xD4, 0x04, 0xE3, 0x04, 0x13, 0x0F, 0x02, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x21,
+	0x11, 0x15, 0x15, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x00, 0x14, 0x13, 0x16, 0x05, 0x14,
+	0x13, 0x17, 0x04, 0x18, 0x17, 0x04, 0x28, 0x16, 0x04, 0x98, 0x04, 0x79, 0x05, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x0F, 0x01, 0x12, 0x11, 0x0F, 0x01, 0x21, 0x11, 0x0F, 0x01, 0x20, 0x12,
+	0x0F, 0x01, 0x10, 0x13, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x67, 0x08, 0x96, 0x06, 0x35, 0x12, 0x32, 0x05, 0x24, 0x14, 0x24, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x14, 0x1B,
+	0x04, 0x15, 0x19, 0x05, 0x35, 0x26, 0x05, 0x17, 0x25, 0x06, 0x0F, 0x06, 0x36, 0x15, 0x06, 0x55, 0x33, 0x05, 0x24, 0x13, 0x25, 0x04, 0x14, 0x24, 0x15, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00,
+	0x00, 0x24, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x21, 0x0F, 0x03, 0x00, 0xD4, 0x04, 0x00, 0x21, 0x0F, 0x03, 0x00, 0x2D, 0x06, 0x3D, 0x05,
+	0x2F, 0x04, 0x0F, 0x11, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x14, 0x2A, 0x04, 0xC4, 0x05, 0xB4, 0x06, 0x0F, 0x06, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x4C, 0x05, 0xA5, 0x06, 0x64, 0x0B, 0x14, 0x0F, 0x01,
+	0x00, 0x00, 0xD4, 0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x4B, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xD4,
+	0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x4B, 0x06, 0x0F, 0x06, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x98, 0x04, 0x89, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1A, 0x0A, 0x12, 0x17, 0x0A, 0x21, 0x45, 0x09, 0x20, 0x25, 0x32, 0x07, 0x10, 0x34, 0x44, 0x05, 0x24, 0x38, 0x04, 0x14, 0x1B,
+	0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x0F, 0x06, 0x14, 0x1B, 0x04, 0x34, 0x19, 0x04, 0x20, 0x43, 0x17, 0x04, 0x30,
+	0x34, 0x25, 0x04, 0x12, 0x36, 0x22, 0x05, 0x12, 0x57, 0x06, 0x12, 0x37, 0x08, 0x30, 0x35, 0x0A, 0x20, 0x34, 0x0C, 0x34, 0x0E, 0x14, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x11,
+	0x04, 0x00, 0x00, 0x0F, 0x51, 0x00, 0x0F, 0x11, 0x04, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x4B, 0x06, 0x58, 0x08, 0x55, 0x12, 0x08, 0x34, 0x15, 0x08, 0x00, 0x55,
+	0x12, 0x08, 0x58, 0x08, 0x5A, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x14, 0x25, 0x23, 0x04, 0x14, 0x56, 0x05, 0x3C,
+	0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x24, 0x23, 0x15, 0x04, 0x55, 0x11, 0x23, 0x04, 0x45, 0x52, 0x05, 0x3C, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04,
+	0x00, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x51, 0x00, 0x3E, 0x04, 0x98, 0x04, 0x84, 0x14, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x51, 0x00,
+	0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x14, 0x1B, 0x04, 0x24, 0x38, 0x04, 0x35, 0x35, 0x05, 0x27, 0x32,
+	0x07, 0x48, 0x09, 0x1A, 0x0A, 0x00, 0xD4, 0x04, 0x00, 0x1A, 0x0A, 0x00, 0x39, 0x09, 0x58, 0x08, 0x36, 0x33, 0x06, 0x25, 0x36, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x00, 0x26,
+	0x25, 0x06, 0x25, 0x27, 0x05, 0x24, 0x1A, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x24, 0x33, 0x23, 0x04, 0x55, 0x51, 0x05, 0x36, 0x33, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x3E, 0x04, 0x3C,
+	0x06, 0x3B, 0x07, 0x39, 0x09, 0x37, 0x0B, 0x36, 0x0C, 0x34, 0x0E, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x20, 0x3C, 0x04, 0x30, 0x39, 0x06, 0x12, 0x38, 0x07, 0x12, 0x36, 0x09,
+	0x12, 0x34, 0x0B, 0x30, 0x33, 0x0C, 0x20, 0x32, 0x0E, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1A, 0x0A, 0x00, 0x48, 0x09, 0x27, 0x32, 0x07, 0x35, 0x44, 0x05, 0x24, 0x38, 0x04,
+	0x14, 0x1B, 0x04, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x4C, 0x05, 0xA5, 0x06, 0x64, 0x0B, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x45, 0x0C, 0x57,
+	0x09, 0x5A, 0x06, 0x4D, 0x04, 0x00, 0x5A, 0x06, 0x48, 0x09, 0x45, 0x0C, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F,
+	0x06, 0x00, 0x67, 0x08, 0x96, 0x06, 0x25, 0x36, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x00, 0xD4,
+	0x04, 0x00, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x24, 0x23, 0x0A, 0x55, 0x0B, 0x36,
+	0x0C, 0x0F, 0x06, 0x00, 0x67, 0x08, 0x96, 0x06, 0x25, 0x36, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x15, 0x19, 0x05, 0x35, 0x26, 0x05, 0x17, 0x25, 0x06, 0x0F, 0x06, 0x14,
+	0x0F, 0x01, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x14, 0x1B, 0x04, 0x34, 0x19, 0x04, 0x45, 0x17, 0x04, 0x37, 0x25, 0x04, 0x39, 0x22, 0x05, 0x5A,
+	0x06, 0x3A, 0x08, 0x38, 0x0A, 0x36, 0x0C, 0x34, 0x0E, 0x14, 0x0F, 0x01, 0x0F, 0x06, 0x58, 0x08, 0x77, 0x07, 0x26, 0x25, 0x06, 0x16, 0x17, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x16, 0x17, 0x06, 0x00,
+	0x26, 0x25, 0x06, 0x77, 0x07, 0x58, 0x08, 0x0F, 0x06, 0x14, 0x1B, 0x04, 0x24, 0x29, 0x04, 0x25, 0x36, 0x05, 0x26, 0x34, 0x06, 0x37, 0x21, 0x08, 0x48, 0x09, 0x39, 0x09, 0x37, 0x21, 0x08, 0x26,
+	0x34, 0x06, 0x25, 0x36, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x51, 0x00, 0x0F,
+	0x06, 0x00, 0x74, 0x0A, 0x84, 0x09, 0x2A, 0x09, 0x1B, 0x09, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00,
+	0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04,
+	0x00, 0x0F, 0x51, 0x00, 0x0F, 0x06, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x4B, 0x06, 0x0F, 0x06, 0x00, 0xD4,
+	0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x4B, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x19, 0x16, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x4B, 0x06, 0x0F, 0x06, 0x00, 0x17, 0x25, 0x06, 0x35, 0x35, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x24,
+	0x14, 0x24, 0x04, 0x35, 0x12, 0x32, 0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1A, 0x0A, 0x00, 0x58, 0x08, 0x96, 0x06, 0x25, 0x36, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B,
+	0x04, 0x00, 0x00, 0x00, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x0F, 0x11, 0x04, 0x36, 0x26, 0x04, 0x55, 0x33, 0x05, 0x24, 0x23, 0x31, 0x06, 0x14, 0x35, 0x08,
+	0x14, 0x25, 0x09, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0x28, 0x42, 0x05, 0x28, 0x52, 0x04, 0x27, 0x22, 0x13, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x27, 0x12, 0x13,
+	0x05, 0xA7, 0x04, 0x98, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x68, 0x07, 0x36, 0x61, 0x05, 0x15, 0x22, 0x25, 0x04, 0x24, 0x12, 0x17, 0x04, 0x14, 0x22, 0x17, 0x04, 0x00, 0x23, 0x13, 0x26, 0x04,
+	0x23, 0x83, 0x05, 0x23, 0x64, 0x06, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x17, 0x13, 0x14, 0x04, 0x00, 0x00, 0x00, 0x47, 0x51, 0x04, 0x38, 0x41, 0x05, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x17, 0x0D, 0x00,
+	0x00, 0x00, 0x0F, 0x51, 0x6F, 0x5C, 0x04, 0x77, 0x12, 0x04, 0x37, 0x16, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0xA7, 0x04, 0xE7, 0x0F, 0x51, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x12, 0x23,
+	0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x00, 0x27, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x17, 0x18, 0x04, 0x27, 0x35, 0x04, 0x28, 0x23, 0x06, 0x59, 0x07, 0x2A, 0x09, 0x1B, 0x09,
+	0xA7, 0x04, 0x00, 0x1B, 0x09, 0x2A, 0x09, 0x59, 0x07, 0x28, 0x23, 0x06, 0x27, 0x35, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0x28, 0x24, 0x05, 0x37, 0x34, 0x04, 0x27, 0x12, 0x23, 0x04, 0x17, 0x13,
+	0x14, 0x04, 0x17, 0x32, 0x13, 0x04, 0x47, 0x51, 0x04, 0x38, 0x41, 0x05, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x2E, 0x05, 0x2C, 0x07, 0x2A, 0x09, 0x28, 0x0B, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04,
+	0x23, 0xA2, 0x04, 0x33, 0x28, 0x05, 0x15, 0x26, 0x07, 0x15, 0x24, 0x09, 0x15, 0x22, 0x0B, 0x33, 0xA1, 0x04, 0x23, 0xA2, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B, 0x09, 0x3A, 0x08, 0x29, 0x31,
+	0x06, 0x27, 0x35, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x5B, 0x05, 0x77, 0x07, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x37, 0x0B, 0x49, 0x08,
+	0x4C, 0x05, 0x0F, 0x11, 0x04, 0x4C, 0x05, 0x49, 0x08, 0x37, 0x0B, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B, 0x09, 0x00, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x69, 0x06, 0x88,
+	0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0x27, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xE7, 0x00,
+	0x18, 0x16, 0x05, 0x17, 0x18, 0x04, 0x00, 0x00, 0x27, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x27, 0x26, 0x04, 0x28,
+	0x24, 0x05, 0x19, 0x14, 0x06, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x17, 0x0D, 0x00, 0x00, 0x27, 0x1B, 0x47, 0x19, 0x4A, 0x25, 0x8C, 0x01, 0x4F, 0x02, 0x4C, 0x05, 0x4A, 0x07, 0x47, 0x0A,
+	0x27, 0x0C, 0x0F, 0x06, 0x69, 0x06, 0x98, 0x04, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x18, 0x16, 0x05, 0xF3, 0x30, 0x00, 0x18, 0x16, 0x05, 0x17, 0x18, 0x04, 0x00, 0x27, 0x26, 0x04, 0x88,
+	0x05, 0x69, 0x06, 0x17, 0x18, 0x04, 0x27, 0x26, 0x04, 0x38, 0x32, 0x05, 0x4A, 0x07, 0x2B, 0x08, 0x4A, 0x07, 0x38, 0x32, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00,
+	0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x04, 0xE7, 0x0F, 0x51, 0x0F, 0x06, 0x57, 0x09, 0x67, 0x08, 0x1C, 0x08, 0x00, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x0F,
+	0x11, 0x04, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00,
+	0x00, 0xA7, 0x04, 0x00, 0x0F, 0x51, 0x00, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x1B, 0x14, 0x04, 0x00, 0x00, 0x1B, 0x23, 0x04, 0x5B, 0x05, 0x4C, 0x05, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B,
+	0x14, 0x04, 0x00, 0x00, 0x1B, 0x23, 0x04, 0x5B, 0x05, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B, 0x14, 0x04, 0x00, 0x00, 0x00, 0x2B, 0x22, 0x04, 0x5B,
+	0x05, 0x4C, 0x05, 0x0F, 0x06, 0x19, 0x14, 0x06, 0x28, 0x24, 0x05, 0x27, 0x26, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x27, 0x12, 0x23, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0xA7, 0x04, 0x00,
+	0x1B, 0x09, 0x00, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x27, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x11, 0x04, 0x48, 0x23, 0x04, 0x67, 0x21, 0x05, 0x17, 0x34,
+	0x06, 0x17, 0x14, 0x08, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x24, 0x21, 0x12, 0x23, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x17, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13,
+	0x14, 0x04, 0x24, 0x21, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x14, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x14, 0x12, 0x0D, 0x00, 0x17, 0x1C, 0xE7, 0xC8, 0x01, 0x0F,
+	0x06, 0xA7, 0x04, 0x00, 0x15, 0x11, 0x0D, 0x14, 0x12, 0x0D, 0x23, 0x12, 0x0D, 0x13, 0x13, 0x0D, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x12, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x27,
+	0x26, 0x04, 0x28, 0x24, 0x05, 0x19, 0x14, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x57, 0x22, 0x05, 0x17, 0x22, 0x23, 0x04, 0x17, 0x23, 0x13, 0x04, 0x00, 0x27, 0x22, 0x13, 0x04, 0x28, 0x52, 0x04,
+	0x28, 0x33, 0x05, 0x0F, 0x06, 0x23, 0xA2, 0x04, 0x00, 0x0F, 0x06, 0x24, 0x0F, 0x24, 0xA1, 0x04, 0xA7, 0x04, 0x24, 0x0F, 0x00, 0x0F, 0x15, 0x23, 0xE2, 0x23, 0xD2, 0x01, 0x0F, 0x11, 0x04, 0x2F,
+	0x04, 0x5B, 0x05, 0x97, 0x05, 0x57, 0x09, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x00, 0x1B, 0x14, 0x04, 0x00, 0x00, 0x00, 0x6B, 0x04, 0x4C, 0x05, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B, 0x09, 0x00,
+	0x00, 0xA7, 0x04, 0x00, 0x1B, 0x14, 0x04, 0x00, 0x00, 0x1B, 0x23, 0x04, 0x5B, 0x05, 0x4C, 0x05, 0x14, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x14, 0x12, 0x0D, 0x00, 0x17, 0x0D, 0xA7,
+	0x04, 0x98, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x1B, 0x09, 0x15, 0x34, 0x08, 0x14, 0x24, 0x31, 0x06, 0x23, 0x22, 0x35, 0x04, 0x13, 0x13, 0x18, 0x04, 0x27, 0x1B, 0x47, 0x19, 0x23, 0x45, 0x25,
+	0x33, 0x86, 0x01, 0x15, 0x49, 0x02, 0x15, 0x46, 0x05, 0x15, 0x44, 0x07, 0x33, 0x41, 0x0A, 0x23, 0x22, 0x0C, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x0F, 0x51, 0x00, 0x0F, 0x11, 0x04,
+	0xA7, 0x04, 0x00, 0x24, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x50, 0x0F, 0x01, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x17, 0x0D, 0x00, 0x00, 0x53, 0x0D, 0x00,
+};
+
+#elif USE_JAPANESE_CHARACTERS
+
+extern const uint8_t glcd19x21_packed[] =
+{
+	19,			// character width in pixels
+	21,			// row height in pixels
+	2,			// space columns between characters before kerning
+	3,			// font format: sparse packed
+	0x20, 0x00,	// lowest character code (2 bytes, little endian)
+	0xFE, 0x30,	// highest character code (2 bytes, little endian)
+
+	// Number of ranges, then the first code, last code and first glyph of each range (2 bytes each, little endian)
+	0x02, 0x00,
+	0x20, 0x00, 0x7E, 0x01, 0x00, 0x00,
+	0x3F, 0x30, 0xFE, 0x30, 0x5F, 0x01,
+
+	// Number of edge columns (2 bytes, little endian), then the edge columns
+	0xDC, 0x00,
+	0x00, 0x00, 0x00, 0xF8, 0x9F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3E, 0x00, 0x0C, 0x00, 0x18, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x09,
+	0x00, 0x80, 0x07, 0x00, 0x18, 0x00, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x60, 0x00, 0x01, 0x40, 0x80, 0x01, 0xC0, 0x00, 0x01,
+	0x60, 0x60, 0x00, 0x60, 0x78, 0x00, 0x80, 0x63, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x1F, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0xE0, 0x78, 0x00,
+	0xE0, 0x43, 0x00, 0xC0, 0x1F, 0x00, 0xC0, 0x80, 0x01, 0xC0, 0x80, 0x09, 0xC0, 0x80, 0x07, 0x00, 0x07, 0x00, 0x30, 0x60, 0x00, 0x80, 0x10, 0x00,
+	0x60, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFF, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x78, 0x00, 0x08, 0x00, 0x01, 0x08, 0x04, 0x00, 0x60, 0x7C, 0x00,
+	0xF8, 0x7F, 0x00, 0x00, 0x60, 0x00, 0xF8, 0x0F, 0x00, 0x78, 0x00, 0x00, 0x08, 0x80, 0x01, 0xFC, 0xFF, 0x1F, 0x04, 0x00, 0x10, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF1, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x7F, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x3F, 0x00,
+	0x00, 0x4E, 0x00, 0x40, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x7F, 0x04, 0xC0, 0xFF, 0x03, 0x00, 0xFF, 0x01, 0xCC, 0xFF, 0x01, 0xCC, 0xFF, 0x0F,
+	0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x80, 0xC3, 0x00, 0x80, 0xF1, 0x00, 0x40, 0x00, 0x01, 0xC0, 0x7F, 0x00, 0x00, 0x08, 0x00,
+	0xFC, 0xFF, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x60, 0x00, 0x18, 0x00, 0x03, 0xC0, 0xFC, 0x0F, 0x00, 0x06, 0x00, 0xC0, 0x38, 0x00,
+	0x00, 0x82, 0x01, 0x00, 0x40, 0x00, 0x00, 0x0E, 0x00, 0xFC, 0xE3, 0x1F, 0x10, 0x86, 0x01, 0x00, 0x0F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x1C, 0x00,
+	0x80, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01, 0xF0, 0x08, 0x00, 0x10, 0x0C, 0x00, 0x70, 0x07, 0x00, 0xF0, 0x01, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x18, 0x10, 0x08, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFA, 0xFF, 0x01, 0x03, 0x00, 0x00, 0x60, 0x30, 0x00,
+	0x80, 0x1F, 0x01, 0x88, 0x1F, 0x00, 0x80, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF9, 0x00, 0xD0, 0xFF, 0x01, 0x00, 0x1C, 0x01, 0x40, 0x1C, 0x00,
+	0x00, 0xF2, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1F, 0x00, 0x00, 0xC3, 0x00, 0x20, 0xC3, 0x00, 0x08, 0xC3, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x01,
+	0x10, 0x00, 0x11, 0x00, 0x7E, 0x04, 0x80, 0xFF, 0x03, 0xF0, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x30, 0x00, 0x00, 0x98, 0xFF, 0x1F, 0xF6, 0xFF, 0x01,
+	0x80, 0xFF, 0x01, 0xF0, 0x1F, 0x00, 0x98, 0xFF, 0x01, 0x98, 0xFF, 0x0F, 0xF4, 0x1F, 0x00, 0x30, 0x00, 0x10, 0xF8, 0xFF, 0x15, 0xF8, 0xFF, 0x0D,
+	0xB0, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xFE, 0x0F, 0x08, 0x7E, 0x00, 0x80, 0x00, 0x01, 0x88, 0x01, 0x00, 0x80, 0xFF, 0x15, 0x80, 0x01, 0x00,
+	0x88, 0xFF, 0x01, 0x40, 0x70, 0x00, 0x00, 0xC7, 0x00, 0x00, 0xF3, 0x00, 0x80, 0x00, 0x1D, 0x80, 0x08, 0x00, 0x80, 0x08, 0x01, 0x80, 0xFF, 0x00,
+	0x80, 0xFF, 0x11, 0x10, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x01, 0x01, 0x88, 0x01, 0x01, 0xFE, 0xFF, 0x1F, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x03,
+	0x00, 0xC0, 0x01, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x04, 0xC0, 0x80, 0x03, 0x80, 0x01, 0x08, 0x1C, 0x18, 0x00, 0x00, 0x01, 0x00,
+	0xC6, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1E, 0x00, 0xC0, 0x80, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x01,
+	0x00, 0x80, 0x00, 0x40, 0x00, 0x03, 0x00, 0xFE, 0x03, 0x1C, 0x00, 0x01, 0x1C, 0x20, 0x00, 0x18, 0x20, 0x00, 0xE0, 0x00, 0x02, 0x00, 0x00, 0x02,
+	0x80, 0x00, 0x02, 0x18, 0x02, 0x06, 0x60, 0x70, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0E, 0x00, 0x12, 0x00,
+	0x00, 0x03, 0x06, 0x80, 0x61, 0x00, 0x98, 0x01, 0x00, 0xE0, 0xFF, 0x07, 0xC0, 0x01, 0x06, 0x20, 0x00, 0x01, 0x70, 0x00, 0x00, 0x0F, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x1C, 0x80, 0x00, 0x80, 0xFF, 0x1F, 0xF0, 0xFF, 0x0F, 0xF8, 0x1F, 0x00, 0xF0, 0xFF, 0x07, 0xC0, 0xC0, 0x00, 0x30, 0x00, 0x03,
+	0x00, 0xFE, 0x00, 0xE0, 0x1F, 0x00, 0x1E, 0xC0, 0x00, 0xF8, 0xFF, 0x1F,
+
+	// Width, leading edge and trailing edge of each glyph
+	0x07, 0x00, 0x00, 0x02, 0x01, 0x01, 0x05, 0x02, 0x02, 0x0C, 0x03, 0x04, 0x0C, 0x05, 0x06, 0x11, 0x07, 0x08, 0x0D, 0x09, 0x0A, 0x02, 0x02, 0x02, 0x05, 0x0B, 0x0C, 0x06, 0x0C, 0x0B,
+	0x06, 0x0D, 0x0D, 0x0A, 0x0E, 0x0E, 0x02, 0x0F, 0x10, 0x05, 0x11, 0x11, 0x02, 0x12, 0x12, 0x06, 0x12, 0x13, 0x0A, 0x14, 0x14, 0x09, 0x15, 0x0A, 0x0A, 0x16, 0x17, 0x0A, 0x18, 0x19,
+	0x0B, 0x03, 0x03, 0x0A, 0x1A, 0x1B, 0x0A, 0x1C, 0x1B, 0x0A, 0x1D, 0x1E, 0x0A, 0x1F, 0x1F, 0x0A, 0x20, 0x21, 0x02, 0x22, 0x22, 0x02, 0x23, 0x24, 0x0A, 0x25, 0x26, 0x0A, 0x27, 0x27,
+	0x0A, 0x26, 0x25, 0x0A, 0x28, 0x29, 0x11, 0x2A, 0x21, 0x0D, 0x0A, 0x0A, 0x0B, 0x2B, 0x2C, 0x0D, 0x1C, 0x18, 0x0C, 0x2B, 0x1C, 0x0B, 0x2B, 0x2D, 0x0A, 0x2B, 0x2E, 0x0D, 0x1C, 0x2F,
+	0x0A, 0x2B, 0x2B, 0x02, 0x2B, 0x2B, 0x09, 0x05, 0x30, 0x0B, 0x2B, 0x0A, 0x09, 0x2B, 0x0A, 0x0D, 0x2B, 0x2B, 0x0A, 0x2B, 0x2B, 0x0E, 0x1C, 0x1C, 0x0B, 0x2B, 0x29, 0x0E, 0x1C, 0x1C,
+	0x0C, 0x2B, 0x0A, 0x0C, 0x31, 0x2C, 0x0C, 0x1D, 0x1D, 0x0C, 0x32, 0x32, 0x0D, 0x1D, 0x1D, 0x13, 0x33, 0x33, 0x0C, 0x2D, 0x2D, 0x0C, 0x1E, 0x1E, 0x0B, 0x34, 0x2D, 0x04, 0x35, 0x36,
+	0x06, 0x13, 0x12, 0x04, 0x36, 0x35, 0x08, 0x37, 0x37, 0x0C, 0x38, 0x38, 0x04, 0x39, 0x3A, 0x0B, 0x3B, 0x0A, 0x09, 0x3C, 0x3D, 0x09, 0x0B, 0x3E, 0x09, 0x3D, 0x3C, 0x0A, 0x3F, 0x40,
+	0x06, 0x41, 0x42, 0x09, 0x43, 0x44, 0x09, 0x3C, 0x45, 0x02, 0x46, 0x46, 0x03, 0x38, 0x47, 0x09, 0x3C, 0x0A, 0x02, 0x3C, 0x3C, 0x0E, 0x48, 0x45, 0x09, 0x48, 0x45, 0x0A, 0x3D, 0x3D,
+	0x09, 0x49, 0x3D, 0x09, 0x3D, 0x49, 0x06, 0x48, 0x4A, 0x09, 0x4B, 0x4C, 0x06, 0x41, 0x4D, 0x09, 0x4E, 0x48, 0x0B, 0x41, 0x41, 0x0F, 0x4A, 0x4A, 0x08, 0x22, 0x22, 0x0B, 0x41, 0x41,
+	0x07, 0x16, 0x17, 0x07, 0x4F, 0x36, 0x02, 0x35, 0x35, 0x07, 0x36, 0x4F, 0x0A, 0x0E, 0x0E, 0x05, 0x50, 0x50, 0x02, 0x00, 0x00, 0x13, 0x51, 0x51, 0x0A, 0x28, 0x28, 0x13, 0x51, 0x51,
+	0x0A, 0x52, 0x52, 0x0A, 0x53, 0x53, 0x0A, 0x54, 0x54, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x55, 0x55,
+	0x09, 0x56, 0x57, 0x0B, 0x58, 0x59, 0x0A, 0x37, 0x5A, 0x0C, 0x1D, 0x1D, 0x02, 0x5B, 0x5B, 0x0A, 0x0A, 0x5C, 0x06, 0x13, 0x13, 0x0F, 0x5D, 0x5D, 0x07, 0x5E, 0x37, 0x0A, 0x5F, 0x60,
+	0x0A, 0x0E, 0x61, 0x05, 0x11, 0x11, 0x0F, 0x5D, 0x5D, 0x0C, 0x62, 0x62, 0x06, 0x28, 0x28, 0x0A, 0x63, 0x63, 0x06, 0x4F, 0x64, 0x05, 0x65, 0x66, 0x04, 0x3A, 0x39, 0x0A, 0x49, 0x0A,
+	0x09, 0x67, 0x1D, 0x02, 0x56, 0x56, 0x03, 0x68, 0x69, 0x06, 0x6A, 0x4F, 0x08, 0x29, 0x29, 0x0A, 0x60, 0x5F, 0x10, 0x6A, 0x59, 0x10, 0x6A, 0x0A, 0x10, 0x65, 0x59, 0x0A, 0x12, 0x6B,
+	0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x13, 0x12, 0x2D, 0x0D, 0x1C, 0x18, 0x0B, 0x2B, 0x2D, 0x0B, 0x2B, 0x2D,
+	0x0B, 0x2B, 0x2D, 0x0B, 0x2B, 0x2D, 0x03, 0x6C, 0x6D, 0x03, 0x6D, 0x6C, 0x05, 0x62, 0x62, 0x07, 0x6E, 0x6E, 0x0E, 0x0E, 0x1C, 0x0A, 0x2B, 0x2B, 0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C,
+	0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C, 0x08, 0x6F, 0x6F, 0x0E, 0x70, 0x71, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x1E, 0x1E,
+	0x0B, 0x2B, 0x72, 0x0B, 0x48, 0x73, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x11, 0x74, 0x40, 0x09, 0x0B, 0x3E,
+	0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x04, 0x39, 0x75, 0x04, 0x75, 0x39, 0x07, 0x3A, 0x3A, 0x06, 0x13, 0x13, 0x0A, 0x61, 0x3D, 0x09, 0x48, 0x45,
+	0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x0E, 0x0E, 0x0A, 0x76, 0x77, 0x09, 0x4E, 0x48, 0x09, 0x4E, 0x48, 0x09, 0x4E, 0x48,
+	0x09, 0x4E, 0x48, 0x0B, 0x41, 0x41, 0x0A, 0x35, 0x3D, 0x0B, 0x41, 0x41, 0x0D, 0x0A, 0x0A, 0x0A, 0x78, 0x0A, 0x0D, 0x0A, 0x0A, 0x0A, 0x78, 0x0A, 0x0D, 0x0A, 0x79, 0x0A, 0x78, 0x79,
+	0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7B, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7C, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7B, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7D, 0x0D, 0x00, 0x1C, 0x0D, 0x61, 0x7E,
+	0x0D, 0x37, 0x1C, 0x0B, 0x61, 0x0D, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x80, 0x0A, 0x61, 0x40,
+	0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82,
+	0x0C, 0x83, 0x83, 0x09, 0x2B, 0x45, 0x0D, 0x41, 0x41, 0x09, 0x3A, 0x45, 0x06, 0x84, 0x84, 0x06, 0x85, 0x85, 0x05, 0x39, 0x39, 0x05, 0x0D, 0x0D, 0x06, 0x6E, 0x6E, 0x06, 0x1E, 0x1E,
+	0x05, 0x00, 0x38, 0x04, 0x86, 0x38, 0x04, 0x00, 0x87, 0x04, 0x00, 0x88, 0x0D, 0x00, 0x89, 0x07, 0x8A, 0x8B, 0x09, 0x05, 0x8C, 0x05, 0x8D, 0x0D, 0x0C, 0x00, 0x7F, 0x09, 0x2B, 0x0A,
+	0x0A, 0x88, 0x0A, 0x0A, 0x00, 0x0A, 0x04, 0x6D, 0x6C, 0x0A, 0x00, 0x0A, 0x03, 0x8E, 0x8F, 0x0A, 0x00, 0x0A, 0x06, 0x2B, 0x7E, 0x0A, 0x00, 0x0A, 0x06, 0x2B, 0x56, 0x0A, 0x11, 0x0A,
+	0x04, 0x11, 0x56, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0A, 0x90, 0x45, 0x0D, 0x00, 0x91, 0x0A, 0x88, 0x92,
+	0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x61, 0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x61, 0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x93, 0x12, 0x91, 0x7F, 0x11, 0x61, 0x40, 0x0D, 0x00, 0x94, 0x06, 0x88, 0x95,
+	0x0D, 0x00, 0x94, 0x06, 0x96, 0x97, 0x0D, 0x00, 0x94, 0x07, 0x98, 0x1D, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B,
+	0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x3A, 0x3A, 0x05, 0x04, 0x9C, 0x0C, 0x3A, 0x3A, 0x07, 0x04, 0x7E, 0x0C, 0x3A, 0x3A, 0x05, 0x9D, 0x9E, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88,
+	0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x0A, 0x9F, 0x1D, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0xA0,
+	0x13, 0x3A, 0x3A, 0x0D, 0x97, 0x97, 0x0B, 0x85, 0x85, 0x09, 0x04, 0x04, 0x0B, 0x85, 0x85, 0x0B, 0xA1, 0x7F, 0x08, 0xA2, 0xA3, 0x0B, 0xA1, 0x7F, 0x08, 0xA2, 0xA3, 0x0B, 0xA1, 0x7F,
+	0x08, 0xA2, 0xA4, 0x12, 0xA5, 0xA5, 0x11, 0x00, 0xA6, 0x12, 0xA7, 0x73, 0x11, 0x00, 0xA8, 0x13, 0x00, 0x31, 0x0F, 0x00, 0x73, 0x10, 0x00, 0xA9, 0x11, 0x00, 0xAA, 0x12, 0xAB, 0xAA,
+	0x11, 0x00, 0x37, 0x13, 0xAC, 0x04, 0x13, 0xAD, 0x11, 0x13, 0xAD, 0xAE, 0x12, 0x00, 0x0E, 0x13, 0x56, 0x1E, 0x0E, 0x00, 0xAB, 0x11, 0x00, 0xAF, 0x12, 0x88, 0x97, 0x13, 0x88, 0xB0,
+	0x10, 0x00, 0x68, 0x13, 0x00, 0x1E, 0x12, 0x00, 0x41, 0x13, 0x00, 0xB1, 0x12, 0x00, 0x52, 0x12, 0x00, 0x52, 0x12, 0x28, 0x28, 0x13, 0x28, 0x1D, 0x13, 0xB2, 0x97, 0x13, 0x56, 0x1E,
+	0x11, 0x4F, 0x56, 0x13, 0x4F, 0x04, 0x13, 0x4A, 0xAA, 0x13, 0x4A, 0x3A, 0x11, 0x28, 0xA6, 0x13, 0x4A, 0x1E, 0x11, 0x00, 0x2C, 0x12, 0xAF, 0xB3, 0x13, 0xAF, 0x1D, 0x12, 0x41, 0x85,
+	0x13, 0x41, 0x37, 0x11, 0x00, 0x68, 0x13, 0x00, 0x13, 0x13, 0xB4, 0xB2, 0x12, 0xB5, 0xB6, 0x13, 0xB7, 0xB6, 0x13, 0xB8, 0x0A, 0x12, 0x1B, 0x0B, 0x13, 0xB5, 0xB9, 0x13, 0xB5, 0x54,
+	0x13, 0xBA, 0xBB, 0x13, 0x85, 0x03, 0x13, 0x28, 0xBC, 0x13, 0x28, 0xBD, 0x13, 0x68, 0x6B, 0x13, 0x6B, 0x41, 0x13, 0x6B, 0xBE, 0x13, 0x05, 0xBF, 0x13, 0x05, 0xC0, 0x13, 0x05, 0xBF,
+	0x13, 0xB5, 0x6B, 0x13, 0xBA, 0xB1, 0x13, 0xBA, 0x13, 0x11, 0x00, 0xC1, 0x13, 0xA6, 0x31, 0x13, 0xC2, 0xAF, 0x12, 0xC3, 0x1B, 0x11, 0x4F, 0xB7, 0x11, 0x03, 0xA9, 0x12, 0x51, 0x25,
+	0x11, 0x00, 0x1B, 0x12, 0x00, 0xB3, 0x10, 0x00, 0xAA, 0x11, 0xC4, 0x68, 0x11, 0x00, 0x73, 0x10, 0x00, 0x91, 0x11, 0x05, 0x73, 0x13, 0xB8, 0x6B, 0x11, 0x05, 0x73, 0x11, 0x00, 0x2C,
+	0x13, 0xB8, 0xA9, 0x12, 0xA7, 0x09, 0x12, 0xC5, 0xAA, 0x12, 0x03, 0xB2, 0x13, 0xC6, 0xA6, 0x13, 0xAF, 0x41, 0x12, 0x00, 0x06, 0x12, 0x00, 0x51, 0x12, 0xA5, 0xA5, 0x12, 0xA5, 0xA5,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x1E, 0x3A, 0x04, 0x42, 0x7E, 0x0F, 0x00, 0x52, 0x10, 0x00, 0x0D, 0x12, 0xAA, 0x41, 0x0E, 0x00, 0xC7, 0x11, 0x00, 0x97, 0x12, 0x85, 0x85,
+	0x10, 0x00, 0x04, 0x12, 0x03, 0x3A, 0x10, 0x00, 0x5D, 0x11, 0x00, 0x29, 0x10, 0x00, 0xC8, 0x12, 0x6B, 0x6B, 0x11, 0x00, 0x56, 0x12, 0x17, 0x4A, 0x11, 0xBF, 0x21, 0x13, 0xAB, 0x13,
+	0x12, 0xC9, 0x51, 0x13, 0xC9, 0x1D, 0x11, 0x4F, 0x28, 0x13, 0x4F, 0x1D, 0x13, 0x4F, 0x4A, 0x13, 0x03, 0xCA, 0x11, 0x00, 0xCB, 0x12, 0x68, 0x13, 0x12, 0x97, 0x97, 0x13, 0x97, 0x1E,
+	0x12, 0xB2, 0x0E, 0x13, 0x0E, 0x0D, 0x12, 0xAB, 0xAB, 0x13, 0xC5, 0x3A, 0x11, 0x56, 0xCC, 0x13, 0x56, 0x1E, 0x11, 0x00, 0x85, 0x12, 0x0D, 0x84, 0x11, 0x4F, 0x28, 0x13, 0x4F, 0x1D,
+	0x12, 0x56, 0x56, 0x13, 0x51, 0x04, 0x11, 0x00, 0xB2, 0x12, 0x0D, 0x85, 0x13, 0x28, 0x1D, 0x12, 0x56, 0x56, 0x13, 0x56, 0xB1, 0x11, 0x00, 0x03, 0x11, 0x00, 0x28, 0x12, 0x97, 0x97,
+	0x12, 0x6B, 0x6B, 0x11, 0x00, 0xCD, 0x13, 0x59, 0x59, 0x10, 0x00, 0x1E, 0x12, 0xAB, 0x68, 0x13, 0xBF, 0x3A, 0x13, 0xAB, 0x7E, 0x12, 0x00, 0x0A, 0x13, 0x00, 0x3A, 0x13, 0x00, 0x7E,
+	0x11, 0x00, 0xCE, 0x13, 0x00, 0xCF, 0x13, 0x00, 0xD0, 0x13, 0x05, 0x0A, 0x13, 0x05, 0x4D, 0x13, 0x05, 0x0A, 0x13, 0xB4, 0xB8, 0x13, 0xB4, 0x1D, 0x13, 0xB4, 0xD1, 0x12, 0x28, 0x41,
+	0x10, 0x00, 0x28, 0x13, 0x68, 0xAA, 0x11, 0xAB, 0x0A, 0x12, 0x51, 0x51, 0x11, 0x00, 0x0E, 0x12, 0xB2, 0x0D, 0x11, 0x00, 0x68, 0x13, 0x6B, 0x6B, 0x0F, 0x00, 0xD2, 0x11, 0x00, 0xD3,
+	0x11, 0x00, 0xB2, 0x0F, 0x00, 0xD4, 0x13, 0xBF, 0x11, 0x12, 0x00, 0x51, 0x11, 0x00, 0xD5, 0x11, 0x00, 0x0E, 0x12, 0x00, 0x0D, 0x13, 0xD6, 0x52, 0x12, 0x6B, 0xD7, 0x11, 0x00, 0x28,
+	0x12, 0x00, 0x5E, 0x13, 0x21, 0x1E, 0x10, 0x00, 0xD8, 0x11, 0x05, 0x56, 0x13, 0xD9, 0x1D, 0x13, 0xD6, 0xDA, 0x13, 0x68, 0x1D, 0x13, 0x00, 0x39, 0x0B, 0x00, 0x37, 0x12, 0x51, 0x51,
+	0x0F, 0x00, 0xB8, 0x10, 0x00, 0x41, 0x10, 0x00, 0xDB,
+
+	// Glyph offsets (2 bytes each, little endian)
+	0x00, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x15, 0x00, 0x33, 0x00, 0x58, 0x00, 0x88, 0x00, 0xB2, 0x00, 0xB5, 0x00, 0xC1, 0x00, 0xCF, 0x00, 0xDC, 0x00, 0xE9, 0x00, 0xEE, 0x00, 0xF4, 0x00, 0xF7, 0x00,
+	0x04, 0x01, 0x18, 0x01, 0x2A, 0x01, 0x4E, 0x01, 0x69, 0x01, 0x83, 0x01, 0x9D, 0x01, 0xB8, 0x01, 0xD1, 0x01, 0xEE, 0x01, 0x0A, 0x02, 0x0E, 0x02, 0x15, 0x02, 0x2E, 0x02, 0x3A, 0x02, 0x53, 0x02,
+	0x6F, 0x02, 0xAF, 0x02, 0xD0, 0x02, 0xE8, 0x02, 0x07, 0x03, 0x1E, 0x03, 0x2F, 0x03, 0x3C, 0x03, 0x61, 0x03, 0x6E, 0x03, 0x71, 0x03, 0x85, 0x03, 0xA0, 0x03, 0xAC, 0x03, 0xC8, 0x03, 0xDC, 0x03,
+	0xFC, 0x03, 0x0E, 0x04, 0x33, 0x04, 0x4F, 0x04, 0x72, 0x04, 0x83, 0x04, 0x99, 0x04, 0xB5, 0x04, 0xDC, 0x04, 0xFE, 0x04, 0x17, 0x05, 0x3E, 0x05, 0x45, 0x05, 0x52, 0x05, 0x59, 0x05, 0x68, 0x05,
+	0x75, 0x05, 0x7F, 0x05, 0x9B, 0x05, 0xAD, 0x05, 0xBE, 0x05, 0xD0, 0x05, 0xE9, 0x05, 0xF4, 0x05, 0x0B, 0x06, 0x1A, 0x06, 0x1E, 0x06, 0x25, 0x06, 0x3A, 0x06, 0x3D, 0x06, 0x55, 0x06, 0x64, 0x06,
+	0x78, 0x06, 0x89, 0x06, 0x9A, 0x06, 0xA3, 0x06, 0xBD, 0x06, 0xC7, 0x06, 0xD7, 0x06, 0xED, 0x06, 0x0B, 0x07, 0x20, 0x07, 0x37, 0x07, 0x4E, 0x07, 0x5D, 0x07, 0x60, 0x07, 0x6F, 0x07, 0x7E, 0x07,
+	0x87, 0x07, 0x8A, 0x07, 0xA8, 0x07, 0xBE, 0x07, 0xDC, 0x07, 0xF2, 0x07, 0x0E, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08,
+	0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08,
+	0x2A, 0x08, 0x2C, 0x08, 0x30, 0x08, 0x49, 0x08, 0x67, 0x08, 0x7B, 0x08, 0xA2, 0x08, 0xA5, 0x08, 0xCE, 0x08, 0xD9, 0x08, 0x09, 0x09, 0x1B, 0x09, 0x35, 0x09, 0xEE, 0x00, 0x41, 0x09, 0x71, 0x09,
+	0x7F, 0x09, 0x8D, 0x09, 0x9D, 0x09, 0xB1, 0x09, 0xC2, 0x09, 0xCE, 0x09, 0xE0, 0x09, 0xF3, 0x09, 0xF6, 0x09, 0xFE, 0x09, 0x0A, 0x0A, 0x1A, 0x0A, 0x34, 0x0A, 0x5D, 0x0A, 0x8E, 0x0A, 0xBC, 0x0A,
+	0xDA, 0x0A, 0xFE, 0x0A, 0x22, 0x0B, 0x48, 0x0B, 0x70, 0x0B, 0x95, 0x0B, 0xB9, 0x0B, 0xDE, 0x0B, 0x04, 0x0C, 0x20, 0x0C, 0x3C, 0x0C, 0x64, 0x0C, 0x80, 0x0C, 0x89, 0x0C, 0x92, 0x0C, 0xA1, 0x0C,
+	0xAE, 0x0C, 0xCB, 0x0C, 0xE6, 0x0C, 0x0C, 0x0D, 0x32, 0x0D, 0x5D, 0x0D, 0x87, 0x0D, 0xAD, 0x0D, 0xC2, 0x0D, 0xF0, 0x0D, 0x0A, 0x0E, 0x24, 0x0E, 0x41, 0x0E, 0x5C, 0x0E, 0x79, 0x0E, 0x8B, 0x0E,
+	0xAD, 0x0E, 0xD3, 0x0E, 0xF9, 0x0E, 0x22, 0x0F, 0x47, 0x0F, 0x6A, 0x0F, 0x8D, 0x0F, 0xBD, 0x0F, 0xD5, 0x0F, 0xF7, 0x0F, 0x1D, 0x10, 0x46, 0x10, 0x69, 0x10, 0x75, 0x10, 0x81, 0x10, 0x96, 0x10,
+	0xA1, 0x10, 0xC1, 0x10, 0xDA, 0x10, 0xF8, 0x10, 0x16, 0x11, 0x37, 0x11, 0x55, 0x11, 0x71, 0x11, 0x80, 0x11, 0xA0, 0x11, 0xB5, 0x11, 0xCA, 0x11, 0xE3, 0x11, 0xF8, 0x11, 0x13, 0x12, 0x28, 0x12,
+	0x43, 0x12, 0x69, 0x12, 0x86, 0x12, 0xAC, 0x12, 0xCD, 0x12, 0xEE, 0x12, 0x07, 0x13, 0x2A, 0x13, 0x45, 0x13, 0x6C, 0x13, 0x87, 0x13, 0xA8, 0x13, 0xBF, 0x13, 0xE6, 0x13, 0x01, 0x14, 0x25, 0x14,
+	0x40, 0x14, 0x5A, 0x14, 0x74, 0x14, 0x8E, 0x14, 0xAB, 0x14, 0xCD, 0x14, 0xEA, 0x14, 0x04, 0x15, 0x22, 0x15, 0x3A, 0x15, 0x59, 0x15, 0x83, 0x15, 0xA5, 0x15, 0xD5, 0x15, 0xF3, 0x15, 0x1F, 0x16,
+	0x39, 0x16, 0x63, 0x16, 0x7D, 0x16, 0xA7, 0x16, 0xC5, 0x16, 0xDF, 0x16, 0xF5, 0x16, 0x08, 0x17, 0x1B, 0x17, 0x2D, 0x17, 0x3B, 0x17, 0x46, 0x17, 0x4F, 0x17, 0x5E, 0x17, 0x6C, 0x17, 0x75, 0x17,
+	0x7E, 0x17, 0x85, 0x17, 0x8B, 0x17, 0xA5, 0x17, 0xB4, 0x17, 0xCF, 0x17, 0xDB, 0x17, 0xFA, 0x17, 0x11, 0x18, 0x28, 0x18, 0x3C, 0x18, 0x47, 0x18, 0x5D, 0x18, 0x65, 0x18, 0x7A, 0x18, 0x86, 0x18,
+	0x98, 0x18, 0xA2, 0x18, 0xB7, 0x18, 0xBE, 0x18, 0xD8, 0x18, 0xEC, 0x18, 0x04, 0x19, 0x17, 0x19, 0x33, 0x19, 0x49, 0x19, 0x5B, 0x19, 0x76, 0x19, 0x86, 0x19, 0xA4, 0x19, 0xBC, 0x19, 0xE0, 0x19,
+	0xF8, 0x19, 0x25, 0x1A, 0x46, 0x1A, 0x67, 0x1A, 0x8F, 0x1A, 0xB3, 0x1A, 0xC1, 0x1A, 0xE3, 0x1A, 0xF0, 0x1A, 0x17, 0x1B, 0x2B, 0x1B, 0x57, 0x1B, 0x76, 0x1B, 0xA1, 0x1B, 0xC6, 0x1B, 0xEF, 0x1B,
+	0x0E, 0x1C, 0x39, 0x1C, 0x5E, 0x1C, 0x71, 0x1C, 0x7D, 0x1C, 0x9B, 0x1C, 0xAA, 0x1C, 0xBF, 0x1C, 0xCB, 0x1C, 0xE7, 0x1C, 0xFE, 0x1C, 0x17, 0x1D, 0x29, 0x1D, 0x42, 0x1D, 0x57, 0x1D, 0x72, 0x1D,
+	0x8B, 0x1D, 0xAB, 0x1D, 0xC7, 0x1D, 0xE1, 0x1D, 0xF2, 0x1D, 0x20, 0x1E, 0x41, 0x1E, 0x5B, 0x1E, 0x74, 0x1E, 0x8D, 0x1E, 0xB7, 0x1E, 0xD4, 0x1E, 0xFC, 0x1E, 0x18, 0x1F, 0x44, 0x1F, 0x64, 0x1F,
+	0xA3, 0x1F, 0xD8, 0x1F, 0x15, 0x20, 0x35, 0x20, 0x5B, 0x20, 0x83, 0x20, 0xB1, 0x20, 0xE4, 0x20, 0x1E, 0x21, 0x50, 0x21, 0x8A, 0x21, 0xBB, 0x21, 0xEF, 0x21, 0x2B, 0x22, 0x6E, 0x22, 0x91, 0x22,
+	0xBC, 0x22, 0xE3, 0x22, 0x11, 0x23, 0x2A, 0x23, 0x4D, 0x23, 0x7F, 0x23, 0xB7, 0x23, 0xDA, 0x23, 0x01, 0x24, 0x2C, 0x24, 0x60, 0x24, 0x87, 0x24, 0xB8, 0x24, 0xEF, 0x24, 0x2E, 0x25, 0x5A, 0x25,
+	0x92, 0x25, 0xC0, 0x25, 0xF7, 0x25, 0x1A, 0x26, 0x41, 0x26, 0x70, 0x26, 0x96, 0x26, 0xC8, 0x26, 0xF5, 0x26, 0x29, 0x27, 0x5F, 0x27, 0x82, 0x27, 0xBA, 0x27, 0xED, 0x27, 0x1E, 0x28, 0x51, 0x28,
+	0x86, 0x28, 0xBD, 0x28, 0xF0, 0x28, 0x22, 0x29, 0x56, 0x29, 0x8C, 0x29, 0xC3, 0x29, 0xFE, 0x29, 0x25, 0x2A, 0x53, 0x2A, 0x81, 0x2A, 0xB4, 0x2A, 0xE7, 0x2A, 0x1B, 0x2B, 0x4B, 0x2B, 0x81, 0x2B,
+	0xB5, 0x2B, 0xE9, 0x2B, 0x15, 0x2C, 0x3E, 0x2C, 0x6C, 0x2C, 0x96, 0x2C, 0xC5, 0x2C, 0xE9, 0x2C, 0x13, 0x2D, 0x44, 0x2D, 0x69, 0x2D, 0xA6, 0x2D, 0xD4, 0x2D, 0x0B, 0x2E, 0x34, 0x2E, 0x65, 0x2E,
+	0xA1, 0x2E, 0xE9, 0x2E, 0x2A, 0x2F, 0x56, 0x2F, 0x8E, 0x2F, 0xB9, 0x2F, 0x64, 0x1F, 0x64, 0x1F, 0x2A, 0x08, 0x2A, 0x08, 0xD8, 0x2F, 0xE6, 0x2F, 0xED, 0x2F, 0x0B, 0x30, 0x30, 0x30, 0x62, 0x30,
+	0x73, 0x30, 0x9D, 0x30, 0xCB, 0x30, 0xE4, 0x30, 0x06, 0x31, 0x2B, 0x31, 0x53, 0x31, 0x6B, 0x31, 0x86, 0x31, 0xA9, 0x31, 0xD6, 0x31, 0xFE, 0x31, 0x2E, 0x32, 0x59, 0x32, 0x8A, 0x32, 0xB8, 0x32,
+	0xF0, 0x32, 0x18, 0x33, 0x49, 0x33, 0x60, 0x33, 0x82, 0x33, 0xA2, 0x33, 0xCC, 0x33, 0xF9, 0x33, 0x2F, 0x34, 0x63, 0x34, 0x9A, 0x34, 0xC6, 0x34, 0xFB, 0x34, 0x1F, 0x35, 0x4E, 0x35, 0x82, 0x35,
+	0xBE, 0x35, 0xEE, 0x35, 0x25, 0x36, 0x4A, 0x36, 0x73, 0x36, 0xA2, 0x36, 0xCD, 0x36, 0x01, 0x37, 0x1B, 0x37, 0x3D, 0x37, 0x5E, 0x37, 0x77, 0x37, 0xAB, 0x37, 0xDC, 0x37, 0xFE, 0x37, 0x22, 0x38,
+	0x4D, 0x38, 0x7A, 0x38, 0xA4, 0x38, 0xD6, 0x38, 0x03, 0x39, 0x2A, 0x39, 0x59, 0x39, 0x84, 0x39, 0xAA, 0x39, 0xD7, 0x39, 0x05, 0x3A, 0x33, 0x3A, 0x67, 0x3A, 0x9B, 0x3A, 0xCB, 0x3A, 0xFE, 0x3A,
+	0x2B, 0x3B, 0x5A, 0x3B, 0x7A, 0x3B, 0x9F, 0x3B, 0xCB, 0x3B, 0xE6, 0x3B, 0x06, 0x3C, 0x1B, 0x3C, 0x32, 0x3C, 0x62, 0x3C, 0x7F, 0x3C, 0xA5, 0x3C, 0xC8, 0x3C, 0xDE, 0x3C, 0x01, 0x3D, 0x2A, 0x3D,
+	0x48, 0x3D, 0x71, 0x3D, 0xA4, 0x3D, 0xCF, 0x3D, 0x01, 0x3E, 0x24, 0x3E, 0x47, 0x3E, 0x77, 0x3E, 0x9F, 0x3E, 0xCE, 0x3E, 0x08, 0x3F, 0x18, 0x3F, 0x2C, 0x3F, 0x46, 0x3F, 0x66, 0x3F,
+
+	// Glyphs
+	0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x22, 0x04, 0x00, 0x53, 0x0D, 0x00, 0x0F, 0x06, 0x33, 0x0F, 0x53, 0x0D, 0x1C, 0x08, 0x17, 0x14, 0x08, 0x17, 0x54, 0x04, 0x67, 0x08, 0x53,
+	0x14, 0x08, 0x17, 0x14, 0x08, 0x00, 0x17, 0x54, 0x04, 0x67, 0x08, 0x53, 0x14, 0x08, 0x17, 0x14, 0x08, 0x17, 0x0D, 0x1D, 0x07, 0x35, 0x35, 0x05, 0x54, 0x25, 0x05, 0x23, 0x23, 0x25, 0x04, 0x13,
+	0x15, 0x16, 0x04, 0xF1, 0x30, 0x02, 0x00, 0x13, 0x25, 0x15, 0x04, 0x23, 0x15, 0x15, 0x04, 0x24, 0x24, 0x13, 0x05, 0x15, 0x55, 0x05, 0x2C, 0x07, 0x64, 0x0B, 0x23, 0x24, 0x0A, 0x13, 0x16, 0x0A,
+	0x13, 0x16, 0x15, 0x04, 0x23, 0x24, 0x24, 0x04, 0x64, 0x33, 0x05, 0x2C, 0x07, 0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x26, 0x0D, 0x34, 0x63, 0x05, 0x23, 0x24, 0x24, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x19, 0x16, 0x04, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x5B, 0x05, 0x3A, 0x21, 0x05, 0x25, 0x22, 0x24, 0x04, 0x64, 0x16, 0x04, 0x23, 0x33, 0x15, 0x04, 0x13, 0x14, 0x31, 0x13, 0x04, 0x13, 0x14, 0x32,
+	0x21, 0x04, 0x23, 0x12, 0x35, 0x05, 0x44, 0x35, 0x05, 0x5C, 0x04, 0x3A, 0x13, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x53, 0x0D, 0x00, 0x59, 0x07, 0xB6, 0x04, 0x44, 0x47, 0x02, 0x23, 0x2D, 0x01, 0x22,
+	0x2F, 0x0F, 0x06, 0x22, 0x2F, 0x23, 0x2D, 0x01, 0x44, 0x47, 0x02, 0xB6, 0x04, 0x59, 0x07, 0x15, 0x0F, 0x16, 0x21, 0x0B, 0x53, 0x0D, 0x00, 0x16, 0x21, 0x0B, 0x15, 0x0F, 0x19, 0x0B, 0x00, 0x00,
+	0x00, 0x95, 0x07, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x2F, 0x12, 0x01, 0x4F, 0x02, 0x2B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x2F, 0x04, 0x5C, 0x04, 0x68, 0x07, 0x65, 0x0A, 0x52,
+	0x0E, 0x22, 0x0F, 0x02, 0x86, 0x07, 0xC4, 0x05, 0x14, 0x1A, 0x05, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x14, 0x1A, 0x05, 0xC4, 0x05, 0x86, 0x07, 0x25, 0x19, 0x04, 0x24, 0x1A, 0x04, 0x14, 0x1B,
+	0x04, 0xE3, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x16, 0x28, 0x04, 0x34, 0x37, 0x04, 0x14, 0x28, 0x11, 0x04, 0x13, 0x28, 0x12, 0x04, 0x13, 0x27, 0x13, 0x04, 0x13, 0x17, 0x14, 0x04,
+	0x13, 0x26, 0x14, 0x04, 0x23, 0x33, 0x15, 0x04, 0x64, 0x16, 0x04, 0x26, 0x18, 0x04, 0x25, 0x26, 0x06, 0x34, 0x36, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x23, 0x13,
+	0x11, 0x24, 0x04, 0x54, 0x61, 0x05, 0x25, 0x44, 0x06, 0x1C, 0x08, 0x3A, 0x08, 0x49, 0x08, 0x28, 0x12, 0x08, 0x27, 0x13, 0x08, 0x35, 0x14, 0x08, 0x34, 0x15, 0x08, 0x23, 0x17, 0x08, 0xE3, 0x04,
+	0x1C, 0x08, 0x00, 0x37, 0x23, 0x06, 0x73, 0x33, 0x05, 0x13, 0x15, 0x25, 0x04, 0x13, 0x14, 0x17, 0x04, 0x00, 0x00, 0x00, 0x13, 0x24, 0x25, 0x04, 0x13, 0x75, 0x05, 0x5A, 0x06, 0x67, 0x08, 0xA5,
+	0x06, 0x24, 0x13, 0x24, 0x05, 0x23, 0x13, 0x26, 0x04, 0x13, 0x14, 0x17, 0x04, 0x00, 0x00, 0x23, 0x23, 0x25, 0x04, 0x24, 0x73, 0x05, 0x5A, 0x06, 0x13, 0x0F, 0x02, 0x00, 0x00, 0x13, 0x49, 0x04,
+	0x13, 0x76, 0x04, 0x13, 0x44, 0x09, 0x13, 0x42, 0x0B, 0x13, 0x31, 0x0D, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0x35, 0x43, 0x06, 0x54, 0x61, 0x05, 0x23, 0x13, 0x11, 0x24, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x00, 0x00, 0x00, 0x23, 0x13, 0x11, 0x24, 0x04, 0x54, 0x61, 0x05, 0x35, 0x43, 0x06, 0x55, 0x14, 0x06, 0x74, 0x23, 0x05, 0x23, 0x25, 0x23, 0x04, 0x13, 0x17, 0x14, 0x04, 0x00, 0x00, 0x13, 0x17,
+	0x23, 0x04, 0x24, 0x14, 0x23, 0x05, 0xB4, 0x06, 0x76, 0x08, 0x26, 0x27, 0x04, 0x00, 0x26, 0x27, 0x12, 0x01, 0x26, 0x47, 0x02, 0x38, 0x0A, 0x18, 0x11, 0x0A, 0x27, 0x21, 0x09, 0x00, 0x26, 0x23,
+	0x08, 0x00, 0x16, 0x15, 0x08, 0x25, 0x25, 0x07, 0x15, 0x17, 0x07, 0x24, 0x27, 0x06, 0x17, 0x14, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x27, 0x06, 0x15, 0x17, 0x07,
+	0x25, 0x25, 0x07, 0x16, 0x15, 0x08, 0x26, 0x23, 0x08, 0x00, 0x27, 0x21, 0x09, 0x00, 0x18, 0x11, 0x0A, 0x38, 0x0A, 0x25, 0x0E, 0x34, 0x0E, 0x14, 0x0F, 0x01, 0x13, 0x0F, 0x02, 0x13, 0x27, 0x22,
+	0x04, 0x13, 0x36, 0x22, 0x04, 0x13, 0x25, 0x0A, 0x23, 0x14, 0x0B, 0x64, 0x0B, 0x45, 0x0C, 0x88, 0x05, 0x36, 0x36, 0x03, 0x25, 0x1A, 0x03, 0x14, 0x26, 0x15, 0x02, 0x23, 0x73, 0x23, 0x01, 0x13,
+	0x33, 0x24, 0x13, 0x01, 0x12, 0x23, 0x17, 0x13, 0x01, 0x12, 0x13, 0x18, 0x13, 0x01, 0x00, 0x12, 0x13, 0x17, 0x14, 0x01, 0x12, 0x14, 0x24, 0x15, 0x01, 0x12, 0x85, 0x12, 0x02, 0x22, 0x52, 0x14,
+	0x12, 0x02, 0x13, 0x12, 0x18, 0x21, 0x02, 0x23, 0x29, 0x05, 0x34, 0x35, 0x06, 0x76, 0x08, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x43, 0x14, 0x09, 0x23, 0x16,
+	0x09, 0x43, 0x14, 0x09, 0x55, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x16, 0x04, 0x54,
+	0x11, 0x14, 0x05, 0x44, 0x62, 0x05, 0x4B, 0x06, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x29, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x24, 0x19,
+	0x05, 0x34, 0x36, 0x05, 0x25, 0x26, 0x06, 0xE3, 0x04, 0x00, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x29, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04,
+	0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x08, 0xA5, 0x06,
+	0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13, 0x16, 0x15, 0x04, 0x00, 0x23, 0x15, 0x15, 0x04, 0x24, 0x14, 0x14, 0x05, 0x34, 0x13, 0x23, 0x05, 0x25, 0x53,
+	0x06, 0xE3, 0x04, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x00, 0xE3, 0x04, 0x00, 0x1D, 0x07, 0x3D, 0x05, 0x3E, 0x04, 0x0F, 0x11, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13, 0x2B,
+	0x04, 0xD3, 0x05, 0xC3, 0x06, 0xE3, 0x04, 0x00, 0x29, 0x0A, 0x28, 0x0B, 0x47, 0x0A, 0x26, 0x32, 0x08, 0x25, 0x34, 0x07, 0x24, 0x36, 0x06, 0x23, 0x38, 0x05, 0x13, 0x3A, 0x04, 0x0F, 0x11, 0x04,
+	0xE3, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x23, 0x0F, 0x01, 0x44, 0x0D, 0x56, 0x0A, 0x49, 0x08, 0x5B, 0x05, 0x2F, 0x04, 0x4C, 0x05, 0x59, 0x07, 0x47,
+	0x0A, 0x44, 0x0D, 0x23, 0x0F, 0x01, 0xE3, 0x04, 0xE3, 0x04, 0x33, 0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x38, 0x0A, 0x49, 0x08, 0x3B, 0x07, 0x3D, 0x05, 0x3E, 0x04, 0xE3, 0x04, 0x67, 0x08, 0xA5, 0x06,
+	0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x00, 0x13,
+	0x16, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x0A, 0x64, 0x0B, 0x45, 0x0C, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13,
+	0x4C, 0x01, 0x13, 0x1C, 0x21, 0x01, 0x23, 0x2A, 0x22, 0x14, 0x1A, 0x14, 0x34, 0x36, 0x14, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x00, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x00, 0x13, 0x26, 0x09, 0x13,
+	0x36, 0x08, 0x23, 0x24, 0x31, 0x06, 0x64, 0x43, 0x04, 0x64, 0x25, 0x04, 0x0F, 0x11, 0x04, 0x2D, 0x06, 0x54, 0x34, 0x05, 0x54, 0x16, 0x05, 0x23, 0x23, 0x25, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00,
+	0x13, 0x25, 0x15, 0x04, 0x00, 0x23, 0x15, 0x15, 0x04, 0x24, 0x24, 0x13, 0x05, 0x34, 0x63, 0x05, 0x4B, 0x06, 0x13, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x0F, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x2F, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x13, 0x0F, 0x02, 0x43, 0x0E, 0x54, 0x0C,
+	0x57, 0x09, 0x59, 0x07, 0x5C, 0x04, 0x2F, 0x04, 0x5C, 0x04, 0x59, 0x07, 0x57, 0x09, 0x54, 0x0C, 0x43, 0x0E, 0x13, 0x0F, 0x02, 0x43, 0x0E, 0x64, 0x0B, 0x67, 0x08, 0x6A, 0x05, 0x3E, 0x04, 0x4D,
+	0x04, 0x5A, 0x06, 0x66, 0x09, 0x63, 0x0C, 0x23, 0x0F, 0x01, 0x63, 0x0C, 0x66, 0x09, 0x5A, 0x06, 0x4D, 0x04, 0x3E, 0x04, 0x6B, 0x04, 0x77, 0x07, 0x64, 0x0B, 0x43, 0x0E, 0x13, 0x1C, 0x04, 0x23,
+	0x39, 0x04, 0x24, 0x37, 0x05, 0x35, 0x24, 0x07, 0x36, 0x31, 0x08, 0x48, 0x09, 0x38, 0x0A, 0x36, 0x31, 0x08, 0x35, 0x33, 0x07, 0x34, 0x36, 0x05, 0x23, 0x39, 0x04, 0x13, 0x1C, 0x04, 0x23, 0x0F,
+	0x01, 0x33, 0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x89, 0x04, 0x00, 0x37, 0x0B, 0x36, 0x0C, 0x34, 0x0E, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0x13, 0x2B, 0x04, 0x13, 0x3A, 0x04, 0x13, 0x38, 0x11,
+	0x04, 0x13, 0x37, 0x12, 0x04, 0x13, 0x26, 0x14, 0x04, 0x13, 0x34, 0x15, 0x04, 0x13, 0x33, 0x16, 0x04, 0x13, 0x22, 0x18, 0x04, 0x43, 0x19, 0x04, 0x33, 0x1A, 0x04, 0x13, 0x1C, 0x04, 0xF2, 0x40,
+	0x12, 0x0F, 0x12, 0x00, 0x00, 0x22, 0x0F, 0x02, 0x52, 0x0E, 0x65, 0x0A, 0x68, 0x07, 0x5C, 0x04, 0x2F, 0x04, 0x12, 0x0F, 0x12, 0x00, 0x00, 0xF2, 0x40, 0x1A, 0x0A, 0x47, 0x0A, 0x54, 0x0C, 0x33,
+	0x0F, 0x00, 0x54, 0x0C, 0x47, 0x0A, 0x1A, 0x0A, 0x0F, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0F, 0x03, 0x00, 0x22, 0x0F, 0x02, 0x14, 0x0F, 0x01, 0x18,
+	0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x00, 0x16, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0xF2, 0x04, 0x00, 0x27, 0x25,
+	0x05, 0x16, 0x19, 0x04, 0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x59, 0x07, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x00, 0x27, 0x25, 0x05, 0x00, 0x78, 0x06,
+	0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x27, 0x25, 0x05, 0xF2, 0x04, 0x00, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x16, 0x14, 0x14, 0x04, 0x00, 0x00, 0x00, 0x26,
+	0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x16, 0x0E, 0x00, 0xE3, 0x04, 0xF2, 0x04, 0x12, 0x13, 0x0E, 0x00, 0x78, 0x13, 0x02, 0x97, 0x22, 0x01, 0x26, 0x27, 0x22, 0x16, 0x19, 0x13,
+	0x00, 0x16, 0x18, 0x14, 0x27, 0x15, 0x24, 0xE6, 0x01, 0xC6, 0x03, 0xF2, 0x04, 0x00, 0x27, 0x0C, 0x16, 0x0E, 0x00, 0x00, 0x26, 0x0D, 0xA7, 0x04, 0x98, 0x04, 0x22, 0xB2, 0x04, 0x00, 0x0F, 0x15,
+	0x22, 0xF2, 0x22, 0xE2, 0x01, 0xF2, 0x04, 0x00, 0x2B, 0x08, 0x2A, 0x09, 0x59, 0x07, 0x37, 0x32, 0x06, 0x36, 0x34, 0x05, 0x16, 0x28, 0x04, 0x0F, 0x11, 0x04, 0xF2, 0x04, 0x00, 0xB6, 0x04, 0x00,
+	0x17, 0x0D, 0x16, 0x0E, 0x00, 0x00, 0xB6, 0x04, 0xA7, 0x04, 0x17, 0x0D, 0x16, 0x0E, 0x00, 0x26, 0x0D, 0xB6, 0x04, 0x98, 0x04, 0xB6, 0x04, 0x00, 0x27, 0x0C, 0x16, 0x0E, 0x00, 0x00, 0x26, 0x0D,
+	0xB6, 0x04, 0x98, 0x04, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0xF6, 0x00, 0x27, 0x25, 0x05, 0x16, 0x19, 0x04,
+	0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x27, 0x25, 0x05, 0xF6, 0x00, 0xB6, 0x04, 0x00, 0x28, 0x0B, 0x26,
+	0x0D, 0x00, 0x00, 0x37, 0x24, 0x05, 0x47, 0x14, 0x05, 0x16, 0x23, 0x14, 0x04, 0x00, 0x00, 0x16, 0x14, 0x14, 0x04, 0x26, 0x23, 0x13, 0x04, 0x27, 0x52, 0x05, 0x27, 0x43, 0x05, 0x16, 0x0E, 0x00,
+	0xD4, 0x04, 0x00, 0x16, 0x19, 0x04, 0x00, 0x96, 0x06, 0xA6, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x2E, 0x05, 0xB6, 0x04, 0x00, 0x16, 0x0E, 0x46, 0x0B, 0x57, 0x09, 0x5A, 0x06, 0x4D,
+	0x04, 0x2F, 0x04, 0x5C, 0x04, 0x5A, 0x06, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0x26, 0x0D, 0x66, 0x09, 0x69, 0x06, 0x4D, 0x04, 0x3E, 0x04, 0x6A, 0x05, 0x66, 0x09, 0x26, 0x0D, 0x66, 0x09, 0x6A,
+	0x05, 0x3E, 0x04, 0x4D, 0x04, 0x69, 0x06, 0x56, 0x0A, 0x26, 0x0D, 0x26, 0x27, 0x04, 0x36, 0x35, 0x04, 0x38, 0x31, 0x06, 0x49, 0x08, 0x00, 0x38, 0x31, 0x06, 0x36, 0x35, 0x04, 0x26, 0x27, 0x04,
+	0x16, 0x0E, 0x36, 0x1B, 0x57, 0x18, 0x4A, 0x25, 0x4C, 0x31, 0x01, 0x4F, 0x02, 0x4D, 0x04, 0x4A, 0x07, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0x16, 0x28, 0x04, 0x16, 0x46, 0x04, 0x16, 0x44, 0x11,
+	0x04, 0x16, 0x42, 0x13, 0x04, 0x56, 0x15, 0x04, 0x46, 0x16, 0x04, 0x26, 0x18, 0x04, 0x1B, 0x09, 0x00, 0x29, 0x21, 0x07, 0x83, 0x81, 0x01, 0x22, 0x2F, 0x12, 0x0F, 0x12, 0x00, 0xF2, 0x40, 0x00,
+	0x12, 0x0F, 0x12, 0x00, 0x22, 0x2F, 0x83, 0x81, 0x01, 0x29, 0x21, 0x07, 0x1B, 0x09, 0x00, 0x19, 0x0B, 0x18, 0x0C, 0x00, 0x00, 0x19, 0x0B, 0x00, 0x1A, 0x0A, 0x00, 0x00, 0x19, 0x0B, 0xE2, 0x05,
+	0x12, 0x1C, 0x05, 0x00, 0x00, 0xE2, 0x05, 0x0F, 0x06, 0x00, 0x2A, 0x09, 0x49, 0x08, 0x68, 0x07, 0x87, 0x06, 0x36, 0x21, 0x31, 0x05, 0x16, 0x23, 0x13, 0x05, 0x2A, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x0E, 0x24, 0x0F, 0x33, 0x0F, 0x32, 0x0F, 0x01, 0xF1, 0x40, 0x01, 0x00, 0x32, 0x0F, 0x01, 0x33, 0x0F, 0x34, 0x0E, 0x25, 0x0E, 0x2A, 0x09,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x23, 0x13, 0x05, 0x36, 0x21, 0x31, 0x05, 0x87, 0x06, 0x68, 0x07, 0x49, 0x08, 0x2A, 0x09, 0x2E, 0x05, 0x2F, 0x04,
+	0x3F, 0x03, 0x0F, 0x31, 0x02, 0xF1, 0x40, 0x01, 0x00, 0x0F, 0x31, 0x02, 0x3F, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x26, 0x25, 0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x23, 0x2B, 0x03, 0xF2, 0x20,
+	0x02, 0x00, 0x23, 0x2B, 0x03, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x26, 0x25, 0x06, 0x23, 0x2B, 0x03, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x26, 0x25, 0x06, 0x81, 0x83, 0x01, 0x00, 0x26, 0x25,
+	0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x23, 0x2B, 0x03, 0x0F, 0x06, 0x26, 0xA2, 0x01, 0x00, 0x29, 0x0A, 0x86, 0x07, 0x26, 0x24, 0x07, 0x15, 0x27, 0x06, 0x15, 0x18, 0x06, 0x33, 0x38, 0x04,
+	0x15, 0x18, 0x06, 0x25, 0x26, 0x06, 0x26, 0x33, 0x07, 0x19, 0x25, 0x04, 0x19, 0x43, 0x04, 0xB4, 0x11, 0x04, 0x33, 0x13, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x23, 0x14, 0x16, 0x04,
+	0x24, 0x29, 0x04, 0x2E, 0x05, 0x1E, 0x06, 0x1A, 0x0A, 0x96, 0x06, 0x27, 0x23, 0x07, 0x16, 0x17, 0x06, 0x00, 0x00, 0x00, 0x27, 0x23, 0x07, 0x96, 0x06, 0x39, 0x09, 0x13, 0x0F, 0x02, 0x23, 0x15,
+	0x12, 0x07, 0x34, 0x13, 0x12, 0x07, 0x45, 0x11, 0x12, 0x07, 0x47, 0x12, 0x07, 0x89, 0x04, 0x00, 0x47, 0x12, 0x07, 0x35, 0x12, 0x12, 0x07, 0x34, 0x13, 0x12, 0x07, 0x23, 0x15, 0x12, 0x07, 0x13,
+	0x0F, 0x02, 0x82, 0x83, 0x00, 0x0F, 0x11, 0x04, 0x43, 0x41, 0x24, 0x03, 0x52, 0x11, 0x22, 0x24, 0x02, 0x12, 0x23, 0x14, 0x15, 0x02, 0x12, 0x14, 0x14, 0x15, 0x02, 0x00, 0x12, 0x24, 0x23, 0x14,
+	0x02, 0x22, 0x23, 0x23, 0x23, 0x02, 0x23, 0x53, 0x41, 0x03, 0x14, 0x24, 0x24, 0x04, 0x22, 0x0F, 0x02, 0x00, 0x0F, 0x06, 0x00, 0x22, 0x0F, 0x02, 0x00, 0x48, 0x09, 0x26, 0x24, 0x07, 0x15, 0x18,
+	0x06, 0x14, 0x1A, 0x05, 0x14, 0x62, 0x12, 0x05, 0x13, 0x22, 0x24, 0x12, 0x04, 0x13, 0x12, 0x16, 0x12, 0x04, 0x00, 0x00, 0x13, 0x22, 0x24, 0x12, 0x04, 0x14, 0x12, 0x14, 0x12, 0x05, 0x14, 0x1A,
+	0x05, 0x15, 0x18, 0x06, 0x26, 0x24, 0x07, 0x48, 0x09, 0x37, 0x0B, 0x23, 0x51, 0x0A, 0x13, 0x12, 0x13, 0x0A, 0x00, 0x23, 0x11, 0x12, 0x0B, 0x74, 0x0A, 0x1A, 0x0A, 0x3A, 0x08, 0x59, 0x07, 0x28,
+	0x23, 0x06, 0x27, 0x25, 0x05, 0x17, 0x17, 0x05, 0x3A, 0x08, 0x59, 0x07, 0x28, 0x23, 0x06, 0x27, 0x25, 0x05, 0x17, 0x17, 0x05, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x06,
+	0x00, 0x48, 0x09, 0x26, 0x24, 0x07, 0x15, 0x18, 0x06, 0x14, 0x1A, 0x05, 0x00, 0x13, 0x82, 0x12, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x00, 0x13, 0x12, 0x33, 0x13, 0x04, 0x13, 0x52, 0x21, 0x12,
+	0x04, 0x14, 0x13, 0x14, 0x11, 0x05, 0x14, 0x1A, 0x05, 0x15, 0x18, 0x06, 0x26, 0x24, 0x07, 0x48, 0x09, 0x11, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+	0x0E, 0x23, 0x22, 0x0C, 0x13, 0x14, 0x0C, 0x00, 0x23, 0x22, 0x0C, 0x25, 0x0E, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x95, 0x12, 0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x24,
+	0x24, 0x09, 0x13, 0x15, 0x11, 0x09, 0x13, 0x14, 0x12, 0x09, 0x13, 0x23, 0x12, 0x09, 0x44, 0x13, 0x09, 0x14, 0x25, 0x09, 0x13, 0x17, 0x09, 0x13, 0x13, 0x13, 0x09, 0x13, 0x22, 0x13, 0x09, 0x34,
+	0x31, 0x0A, 0x14, 0x0F, 0x01, 0x13, 0x0F, 0x02, 0x22, 0x0F, 0x02, 0x12, 0x0F, 0x03, 0xF6, 0x00, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x2F, 0x04, 0x96, 0x06, 0xB6, 0x04, 0x0F, 0x11, 0x04, 0x00,
+	0x54, 0x0C, 0x73, 0x0B, 0x00, 0xF3, 0x20, 0x01, 0x00, 0x13, 0x0F, 0x02, 0x00, 0xF3, 0x20, 0x01, 0x13, 0x0F, 0x02, 0x29, 0x0A, 0x00, 0x0F, 0x22, 0x02, 0x0F, 0x13, 0x11, 0x0F, 0x24, 0x14, 0x16,
+	0x09, 0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x09, 0x00, 0x00, 0x45, 0x0C, 0x64, 0x0B, 0x23, 0x24, 0x0A, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x64, 0x0B, 0x45, 0x0C, 0x17, 0x17, 0x05, 0x27, 0x25, 0x05,
+	0x28, 0x23, 0x06, 0x59, 0x07, 0x3A, 0x08, 0x17, 0x17, 0x05, 0x27, 0x25, 0x05, 0x28, 0x23, 0x06, 0x59, 0x07, 0x3A, 0x08, 0x14, 0x16, 0x09, 0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x14, 0x04, 0x1B,
+	0x32, 0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x24, 0x06, 0x35, 0x34, 0x06, 0x24, 0x24, 0x12, 0x06, 0x23, 0x24, 0x13, 0x06, 0x98, 0x04, 0x00, 0x1E, 0x06, 0x14, 0x16, 0x09,
+	0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x14, 0x04, 0x1B, 0x32, 0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x17, 0x04, 0x35, 0x21, 0x24, 0x04, 0x24, 0x12, 0x15, 0x11, 0x04, 0x23,
+	0x13, 0x14, 0x12, 0x04, 0x18, 0x23, 0x12, 0x04, 0x49, 0x13, 0x04, 0x0F, 0x11, 0x04, 0x14, 0x25, 0x09, 0x13, 0x17, 0x09, 0x13, 0x13, 0x13, 0x09, 0x13, 0x22, 0x13, 0x14, 0x04, 0x34, 0x31, 0x33,
+	0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x24, 0x06, 0x35, 0x34, 0x06, 0x24, 0x24, 0x12, 0x06, 0x23, 0x24, 0x13, 0x06, 0x98, 0x04, 0x00, 0x1E, 0x06, 0x2F, 0x04, 0x5E, 0x02,
+	0x2D, 0x13, 0x02, 0x2C, 0x15, 0x01, 0x2B, 0x16, 0x01, 0x26, 0x32, 0x16, 0x01, 0x26, 0x12, 0x18, 0x01, 0x0F, 0x23, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x21, 0x03, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B,
+	0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x10, 0x42, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x11, 0x41, 0x14, 0x09, 0x55, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11,
+	0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x43, 0x14, 0x09, 0x11, 0x21, 0x16, 0x09, 0x10, 0x42, 0x14, 0x09, 0x10, 0x54, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F,
+	0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x11, 0x53, 0x11, 0x09, 0x20, 0x41, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x20, 0x41, 0x14, 0x09, 0x11, 0x53, 0x11, 0x09, 0x48,
+	0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x20, 0x46, 0x09, 0x10, 0x54, 0x11, 0x09, 0x10, 0x42, 0x14, 0x09, 0x20, 0x21, 0x16, 0x09, 0x11, 0x41,
+	0x14, 0x09, 0x11, 0x53, 0x11, 0x09, 0x20, 0x46, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x20, 0x46, 0x09, 0x20, 0x53, 0x11, 0x09, 0x43, 0x14,
+	0x09, 0x23, 0x16, 0x09, 0x43, 0x14, 0x09, 0x20, 0x53, 0x11, 0x09, 0x20, 0x46, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11,
+	0x09, 0x61, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x10, 0x42, 0x14, 0x09, 0x31, 0x51, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x3D, 0x05, 0x3B, 0x07, 0x39,
+	0x09, 0x37, 0x11, 0x09, 0x35, 0x13, 0x09, 0x33, 0x15, 0x09, 0x13, 0x17, 0x09, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0x67, 0x08,
+	0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x29, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x13, 0x3C, 0x02, 0x13, 0x1C, 0x11, 0x11, 0x13, 0x1C, 0x22, 0x23, 0x2A, 0x04, 0x24, 0x19, 0x05, 0x34, 0x36,
+	0x05, 0x25, 0x26, 0x06, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x10, 0x12, 0x15, 0x16, 0x04, 0x00, 0x11, 0x11, 0x15, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x13, 0x1C, 0x04,
+	0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x11, 0x11, 0x15, 0x16, 0x04, 0x10, 0x12, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x13,
+	0x15, 0x16, 0x04, 0x11, 0x11, 0x15, 0x16, 0x04, 0x20, 0x11, 0x15, 0x16, 0x04, 0x10, 0x12, 0x15, 0x16, 0x04, 0x20, 0x11, 0x15, 0x16, 0x04, 0x11, 0x11, 0x15, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x20, 0x11, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x20, 0x11, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x13, 0x1C, 0x04,
+	0x10, 0x0F, 0x05, 0x10, 0xE2, 0x04, 0x11, 0xE1, 0x04, 0x11, 0xE1, 0x04, 0x10, 0xE2, 0x04, 0x10, 0x0F, 0x05, 0x11, 0x0F, 0x04, 0x20, 0xE1, 0x04, 0x10, 0xE2, 0x04, 0x20, 0x0F, 0x04, 0x11, 0x0F,
+	0x04, 0x20, 0x0F, 0x04, 0x00, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x20, 0x0F, 0x04, 0x00, 0x19, 0x0B, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0x23, 0x2A,
+	0x04, 0x14, 0x29, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x33, 0x0F, 0x20, 0x32, 0x0E, 0x10, 0x35, 0x0C, 0x10, 0x37, 0x0A, 0x20, 0x47, 0x08, 0x11, 0x39, 0x07, 0x11, 0x3B,
+	0x05, 0x20, 0x3C, 0x04, 0xE3, 0x04, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x11, 0x11, 0x1C, 0x04, 0x23,
+	0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x11, 0x11, 0x1C, 0x04,
+	0x10, 0x12, 0x1C, 0x04, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x11,
+	0x11, 0x1C, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x11, 0x21, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5,
+	0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x20, 0x21, 0x2A, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x20, 0x11, 0x1C, 0x04, 0x11, 0x11, 0x1C, 0x04, 0x11, 0x21, 0x2A, 0x04, 0x20, 0x12, 0x1A, 0x05,
+	0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x20, 0x21, 0x2A, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x20, 0x21,
+	0x2A, 0x04, 0x20, 0x12, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x25, 0x25, 0x07, 0x26, 0x23, 0x08, 0x27, 0x21, 0x09, 0x38, 0x0A, 0x00, 0x27, 0x21, 0x09, 0x26, 0x23, 0x08, 0x25,
+	0x25, 0x07, 0x67, 0x13, 0x04, 0xC5, 0x04, 0x34, 0x36, 0x05, 0x14, 0x38, 0x05, 0x23, 0x27, 0x21, 0x04, 0x13, 0x27, 0x13, 0x04, 0x13, 0x35, 0x14, 0x04, 0x13, 0x34, 0x15, 0x04, 0x13, 0x23, 0x17,
+	0x04, 0x23, 0x21, 0x27, 0x04, 0x34, 0x18, 0x05, 0x34, 0x36, 0x05, 0xC3, 0x06, 0x13, 0x63, 0x08, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x10, 0x1F, 0x04, 0x00, 0x11,
+	0x1E, 0x04, 0x2F, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x11, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x00, 0x2F, 0x04, 0x3D, 0x05,
+	0xC3, 0x06, 0x93, 0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x11, 0x1E, 0x04, 0x20, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x20, 0x1E, 0x04, 0x11, 0x2D, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93,
+	0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x20, 0x2D, 0x04, 0x20, 0x1E, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x20, 0x2D, 0x04, 0x20, 0x3B, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x23, 0x0F, 0x01, 0x33,
+	0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x11, 0x87, 0x04, 0x10, 0x88, 0x04, 0x10, 0x36, 0x0B, 0x36, 0x0C, 0x34, 0x0E, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x15, 0x17, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x25, 0x24, 0x08, 0x76, 0x08, 0x47, 0x0A, 0xB6, 0x04, 0xE3, 0x04, 0x23, 0x0F, 0x01, 0x12, 0x0F, 0x03, 0x12, 0x2C, 0x04, 0x12, 0x1D, 0x04, 0x12, 0x44, 0x15, 0x04, 0x22,
+	0x22, 0x31, 0x14, 0x04, 0x43, 0x23, 0x14, 0x04, 0x24, 0x65, 0x04, 0x4C, 0x05, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x12, 0x23, 0x22, 0x14, 0x04, 0x12, 0x13, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13,
+	0x15, 0x04, 0x14, 0x11, 0x13, 0x15, 0x04, 0x16, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15,
+	0x04, 0x14, 0x11, 0x13, 0x15, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x14, 0x05, 0x12, 0x93, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x14,
+	0x21, 0x22, 0x14, 0x04, 0x23, 0x11, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x15, 0x04, 0x12, 0x13, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x14, 0x05, 0x23, 0x91, 0x06, 0x14, 0xA2, 0x04, 0x0F, 0x11,
+	0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x23, 0x21, 0x22, 0x14, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x00, 0x23, 0x11, 0x13, 0x15, 0x04, 0x14, 0x11, 0x13, 0x14, 0x05, 0x14, 0x91, 0x06,
+	0x13, 0xA3, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x22, 0x22, 0x22, 0x14, 0x04, 0x22, 0x12, 0x13, 0x15, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x22, 0x12, 0x13, 0x14,
+	0x05, 0x22, 0x92, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x31, 0x12, 0x13, 0x15, 0x04, 0x10, 0x13, 0x11, 0x13, 0x15, 0x04, 0x00,
+	0x31, 0x12, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x52, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x16, 0x13, 0x24, 0x04,
+	0x16, 0x13, 0x23, 0x05, 0x87, 0x06, 0x97, 0x05, 0x27, 0x12, 0x22, 0x05, 0x16, 0x14, 0x14, 0x04, 0x00, 0x00, 0x00, 0x26, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x59, 0x07, 0x97,
+	0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x16, 0x39, 0x02, 0x16, 0x19, 0x11, 0x11, 0x16, 0x19, 0x22, 0x27, 0x25, 0x05, 0x00, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x12, 0x13, 0x14,
+	0x14, 0x04, 0x00, 0x22, 0x12, 0x14, 0x14, 0x04, 0x14, 0x11, 0x14, 0x14, 0x04, 0x26, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x16,
+	0x14, 0x14, 0x04, 0x14, 0x11, 0x14, 0x14, 0x04, 0x13, 0x12, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x12, 0x23, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97,
+	0x05, 0x14, 0x21, 0x13, 0x13, 0x05, 0x23, 0x11, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x12, 0x13, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x23, 0x21, 0x13, 0x23, 0x04, 0x14,
+	0x52, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97, 0x05, 0x22, 0x22, 0x13, 0x13, 0x05, 0x22, 0x12, 0x14, 0x14, 0x04, 0x16, 0x14, 0x14, 0x04, 0x00, 0x22, 0x12, 0x14, 0x14, 0x04, 0x22, 0x22,
+	0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x12, 0x0F, 0x03, 0x22, 0x0F, 0x02, 0x13, 0xB2, 0x04, 0x14, 0xB1, 0x04, 0x14, 0xB1, 0x04, 0x13, 0xB2, 0x04, 0x22, 0x0F, 0x02, 0x12, 0x0F,
+	0x03, 0x14, 0x0F, 0x01, 0x23, 0x0F, 0x01, 0x22, 0xB2, 0x04, 0x12, 0xB3, 0x04, 0x22, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x22, 0x0F, 0x02, 0x00, 0xB6, 0x04, 0x00, 0x22, 0x0F, 0x02,
+	0x00, 0x69, 0x06, 0x88, 0x05, 0x12, 0x12, 0x21, 0x26, 0x04, 0x12, 0x11, 0x12, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x00, 0x33, 0x11, 0x18, 0x04, 0x22, 0x41, 0x26, 0x04, 0x12, 0xA3, 0x05, 0x78,
+	0x06, 0xB6, 0x04, 0x23, 0xB1, 0x04, 0x13, 0x23, 0x0C, 0x13, 0x12, 0x0E, 0x23, 0x11, 0x0E, 0x14, 0x11, 0x0E, 0x14, 0x21, 0x0D, 0x13, 0xB2, 0x04, 0x98, 0x04, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27,
+	0x04, 0x12, 0x13, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x13, 0x12, 0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16,
+	0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x13, 0x12, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x12, 0x23, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x14, 0x21, 0x27, 0x04, 0x23, 0x11,
+	0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x12, 0x13, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x23, 0x21, 0x27, 0x04, 0x14, 0x92, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x23, 0x21, 0x27, 0x04, 0x13,
+	0x12, 0x19, 0x04, 0x00, 0x23, 0x11, 0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x14, 0x21, 0x27, 0x04, 0x13, 0x93, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x22, 0x22, 0x27, 0x04, 0x22, 0x12, 0x19,
+	0x04, 0x16, 0x19, 0x04, 0x00, 0x22, 0x12, 0x19, 0x04, 0x22, 0x22, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x25, 0x12, 0x22, 0x07, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00,
+	0x3A, 0x13, 0x04, 0xA7, 0x04, 0x27, 0x25, 0x05, 0x16, 0x35, 0x11, 0x04, 0x16, 0x24, 0x13, 0x04, 0x16, 0x23, 0x14, 0x04, 0x16, 0x31, 0x15, 0x04, 0x27, 0x25, 0x05, 0xA6, 0x05, 0x16, 0x33, 0x08,
+	0x96, 0x06, 0xA6, 0x05, 0x12, 0x2C, 0x04, 0x22, 0x1C, 0x04, 0x13, 0x1C, 0x04, 0x14, 0x1B, 0x04, 0x2E, 0x05, 0xB6, 0x04, 0x00, 0x96, 0x06, 0xA6, 0x05, 0x2F, 0x04, 0x14, 0x1B, 0x04, 0x13, 0x1C,
+	0x04, 0x22, 0x1C, 0x04, 0x12, 0x2B, 0x05, 0xB6, 0x04, 0x00, 0x96, 0x06, 0x14, 0xA1, 0x05, 0x23, 0x2A, 0x04, 0x22, 0x1C, 0x04, 0x12, 0x1D, 0x04, 0x22, 0x1C, 0x04, 0x23, 0x29, 0x05, 0x14, 0xB1,
+	0x04, 0xB6, 0x04, 0x96, 0x06, 0x22, 0xA2, 0x05, 0x22, 0x2B, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x22, 0x1C, 0x04, 0x22, 0x2A, 0x05, 0xB6, 0x04, 0x00, 0x16, 0x0E, 0x36, 0x1B, 0x57, 0x18, 0x4A, 0x25,
+	0x14, 0x47, 0x31, 0x01, 0x13, 0x4B, 0x02, 0x22, 0x49, 0x04, 0x12, 0x47, 0x07, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0xF2, 0x40, 0x00, 0x18, 0x25, 0x05, 0x17, 0x17, 0x05, 0x16, 0x19, 0x04, 0x00,
+	0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x16, 0x0E, 0x36, 0x1B, 0x22, 0x53, 0x18, 0x22, 0x46, 0x25, 0x4C, 0x31, 0x01, 0x4F, 0x02, 0x22, 0x49, 0x04, 0x22, 0x46, 0x07, 0x57, 0x09, 0x46,
+	0x0B, 0x16, 0x0E, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x12, 0x53, 0x11, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x11, 0x17, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x53, 0x11, 0x08,
+	0x49, 0x08, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x15, 0x22, 0x31, 0x21, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00, 0x15, 0x21, 0x12, 0x22, 0x05, 0x98,
+	0x04, 0x89, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x20, 0x54, 0x11, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x11, 0x17, 0x08, 0x12, 0x41, 0x14, 0x08, 0x20,
+	0x54, 0x11, 0x08, 0x49, 0x08, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x28, 0x31, 0x21, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00,
+	0x15, 0x21, 0x12, 0x22, 0x05, 0x23, 0x93, 0x04, 0x89, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x56, 0x11, 0x08, 0x44, 0x14, 0x08, 0x14, 0x17, 0x08, 0x44,
+	0x14, 0x08, 0x56, 0x11, 0x08, 0x49, 0x08, 0x4B, 0x42, 0x5D, 0x12, 0x0F, 0x11, 0x13, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x28, 0x31, 0x21, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x00, 0x27, 0x12, 0x22,
+	0x05, 0xD8, 0x99, 0x12, 0x0F, 0x11, 0x13, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x12, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x00,
+	0x10, 0x14, 0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x15, 0x11, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x13, 0x23,
+	0x26, 0x04, 0x28, 0x24, 0x05, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x00, 0x21, 0x11,
+	0x1B, 0x04, 0x12, 0x12, 0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x14, 0x12, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x00, 0x24,
+	0x21, 0x26, 0x04, 0x15, 0x22, 0x24, 0x05, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x15,
+	0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x24, 0x11, 0x18, 0x04, 0x00, 0x17, 0x18, 0x04, 0x27, 0x26, 0x04, 0x28, 0x24, 0x05, 0x0F,
+	0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x10, 0x13, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x14, 0x19, 0x05,
+	0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x13, 0x23, 0x26, 0x04, 0x23, 0x12, 0x18, 0x04, 0x24, 0x11, 0x18, 0x04, 0x00, 0x23, 0x22, 0x26, 0x04, 0x13, 0x24, 0x24,
+	0x05, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x1B, 0x04, 0x10, 0x13, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x14, 0x19, 0x05, 0x25, 0x27,
+	0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0x18, 0x16, 0x05, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x23, 0x11, 0x0E, 0x33, 0x0F,
+	0x1A, 0x0A, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x14, 0x1B, 0x04, 0x00, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05,
+	0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x15, 0x12, 0x16, 0x05, 0xE3, 0x04, 0x00, 0x15, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x12, 0x11, 0x15,
+	0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x12, 0x23, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00,
+	0x15, 0x21, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x12, 0x11, 0x15, 0x15, 0x04, 0x00, 0x00,
+	0x20, 0x12, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x23, 0x22, 0x12, 0x23, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00, 0x23,
+	0x22, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00,
+	0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x12, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x00, 0x27, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39,
+	0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x55, 0x14, 0x15, 0x25, 0x12, 0x14, 0x1B, 0x13, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05,
+	0x27, 0x12, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x17, 0x13, 0x54, 0x17, 0x13, 0x24, 0x12, 0x27, 0x12, 0x23, 0x13, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15,
+	0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04,
+	0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x13, 0x23, 0x12, 0x23, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x00, 0x23, 0x22, 0x12, 0x23, 0x04, 0x13, 0x44,
+	0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x20, 0x12, 0x15,
+	0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x12, 0x21, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x15, 0x21, 0x26,
+	0x22, 0x14, 0x12, 0x18, 0x13, 0x23, 0x12, 0x18, 0x13, 0x00, 0x24, 0x22, 0x24, 0x23, 0x15, 0xD1, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x20,
+	0x12, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x12, 0x11, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F,
+	0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x23, 0x22, 0x26, 0x22, 0x15, 0x11, 0x18, 0x13, 0x00, 0x00, 0x23, 0x23, 0x24, 0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25,
+	0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x21, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62,
+	0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x27, 0x26, 0x22, 0x24, 0x11, 0x18, 0x13, 0x00, 0x17, 0x18, 0x13, 0x28, 0x24, 0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67,
+	0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x14, 0x1B, 0x11, 0x11, 0x14, 0x15, 0x15, 0x21, 0x01, 0x14, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12,
+	0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x27, 0x26, 0x22, 0x33, 0x11, 0x18, 0x13, 0x12, 0x21, 0x11, 0x18, 0x13, 0x17, 0x18, 0x13, 0x28, 0x24,
+	0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x19, 0x0B, 0x12, 0x16, 0x0B, 0x21, 0x16, 0x0B, 0x20, 0x17, 0x0B, 0x00, 0x21, 0x16, 0x0B, 0x12, 0x16, 0x0B, 0xD4, 0x04, 0x00, 0x0F,
+	0x06, 0xE3, 0x04, 0x11, 0xE1, 0x04, 0x20, 0x16, 0x0C, 0x10, 0x16, 0x0D, 0x00, 0x20, 0x15, 0x0D, 0x11, 0xA5, 0x04, 0x98, 0x04, 0x16, 0x0E, 0xD4, 0x04, 0x00, 0x16, 0x13, 0x0A, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x16, 0x0E, 0x14, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x14, 0x12, 0x0D, 0x17, 0x0D, 0x00, 0xA7, 0x04, 0x98, 0x04, 0x21, 0x0F, 0x03, 0x11, 0x0F,
+	0x04, 0x11, 0xD2, 0x04, 0x12, 0xD1, 0x04, 0x12, 0x0F, 0x03, 0x21, 0x0F, 0x03, 0x0F, 0x06, 0x24, 0x0F, 0x14, 0xA2, 0x04, 0x24, 0xA1, 0x04, 0x15, 0x0F, 0x24, 0x0F, 0x12, 0x0F, 0x03, 0x00, 0x12,
+	0xD1, 0x04, 0x00, 0x12, 0x0F, 0x03, 0x15, 0x0F, 0x00, 0x15, 0xA1, 0x04, 0x00, 0x15, 0x0F, 0x0F, 0x06, 0x20, 0x0F, 0x04, 0x12, 0xD1, 0x04, 0x00, 0x12, 0x0F, 0x03, 0x20, 0x0F, 0x04, 0x0F, 0x06,
+	0x23, 0x0F, 0x01, 0x15, 0xA1, 0x04, 0x00, 0x15, 0x0F, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0xF4, 0x20, 0xE4, 0x12, 0x0F, 0x15, 0x0F, 0x06, 0x23, 0xE2, 0x23, 0xB2, 0x12, 0x0F, 0x15, 0x0F, 0x06,
+	0x00, 0x21, 0xD1, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1D, 0x07, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x14, 0x2A,
+	0x04, 0xC4, 0x05, 0x94, 0x08, 0x0F, 0x06, 0x23, 0xA2, 0x04, 0x00, 0x0F, 0x06, 0x0F, 0x15, 0x23, 0xE2, 0x23, 0xD2, 0x01, 0x1D, 0x07, 0x3D, 0x05, 0x2F, 0x04, 0x12, 0x1D, 0x04, 0x21, 0x11, 0x1B,
+	0x04, 0x20, 0x12, 0x1B, 0x04, 0x20, 0x12, 0x2A, 0x04, 0x21, 0xC1, 0x05, 0x12, 0x91, 0x08, 0x24, 0x1E, 0x23, 0xE2, 0x23, 0xD2, 0x01, 0x14, 0x0F, 0x01, 0x15, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04,
+	0x2A, 0x09, 0x29, 0x0A, 0x38, 0x0A, 0x27, 0x21, 0x16, 0x11, 0x26, 0x23, 0x25, 0x01, 0x25, 0x35, 0x06, 0x24, 0x37, 0x05, 0x14, 0x39, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x2B,
+	0x08, 0x3A, 0x15, 0x11, 0x29, 0x31, 0x23, 0x01, 0x37, 0x33, 0x05, 0x17, 0x27, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x2B, 0x08, 0x3A, 0x08, 0x59, 0x07, 0x28, 0x23, 0x06, 0x27,
+	0x25, 0x05, 0x17, 0x27, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x12, 0x1D, 0x04, 0x20, 0x1E, 0x04, 0x00, 0x10, 0x1F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x0F, 0x06, 0x11, 0xE1,
+	0x04, 0x10, 0xE2, 0x04, 0x10, 0x0F, 0x05, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x0F, 0x11, 0x11, 0x11, 0x0F, 0x11, 0x21, 0x01, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x0F, 0x06, 0xE3,
+	0x11, 0x11, 0xE3, 0x21, 0x01, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x24, 0x11, 0x18, 0x04, 0x34, 0x19, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x0F,
+	0x06, 0x23, 0x11, 0x0E, 0x33, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x29, 0x15, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x29,
+	0x0A, 0x00, 0x2B, 0x08, 0x1B, 0x09, 0xD4, 0x04, 0x29, 0x15, 0x04, 0x19, 0x16, 0x04, 0x28, 0x16, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x2B, 0x08, 0xE3, 0x04, 0x00, 0x29, 0x0A, 0x0F, 0x06,
+	0xD4, 0x04, 0x00, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x12, 0x36, 0x09, 0x20, 0x39, 0x07, 0x20, 0x3A, 0x06, 0x10, 0x3D, 0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17,
+	0x0D, 0x15, 0x11, 0x0D, 0x23, 0x12, 0x0D, 0x13, 0xA3, 0x04, 0x98, 0x04, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x39, 0x16, 0x11, 0x3B, 0x24, 0x01, 0x3C, 0x06, 0x3E,
+	0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x1A, 0x11, 0x17, 0x2A, 0x01, 0x17, 0x0D, 0xA7, 0x04, 0x98, 0x04, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x34, 0x0E, 0x10, 0x35,
+	0x0C, 0x20, 0x35, 0x0B, 0x21, 0x36, 0x09, 0x21, 0x38, 0x07, 0x20, 0x3A, 0x06, 0x10, 0x3D, 0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x13, 0xA3, 0x04, 0x23, 0x13, 0x0C, 0x24, 0x11, 0x0D,
+	0x00, 0x23, 0x12, 0x0D, 0x13, 0xA3, 0x04, 0x98, 0x04, 0x24, 0x11, 0x0D, 0x44, 0x0D, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x98, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04,
+	0x26, 0x0D, 0x15, 0x0F, 0x00, 0x14, 0x1A, 0x05, 0x14, 0x2A, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x34, 0x28, 0x04, 0xB5, 0x05, 0x77, 0x07, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x0D, 0x00,
+	0x17, 0x1C, 0x00, 0xE7, 0xB9, 0x01, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05,
+	0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x00, 0x15, 0x21, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0x77, 0x07,
+	0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x20, 0x12, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08,
+	0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x23, 0x22, 0x26, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x00, 0x23, 0x22, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27,
+	0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x13, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x20, 0x13, 0x19, 0x05, 0x10, 0x24, 0x27, 0x05,
+	0x10, 0x95, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x24, 0x11, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x13, 0x11, 0x11, 0x18, 0x04, 0x24, 0x21, 0x26, 0x04,
+	0x23, 0x83, 0x05, 0x13, 0x65, 0x06, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0x27, 0x26, 0x04, 0x88, 0x05, 0x00, 0x27, 0x12, 0x23, 0x04, 0x17,
+	0x13, 0x14, 0x04, 0x00, 0x00, 0x27, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x12, 0x11, 0x15, 0x0A, 0x20, 0x12, 0x15,
+	0x0A, 0x20, 0x12, 0x35, 0x08, 0x10, 0x13, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x15, 0x12, 0x0C, 0x23, 0x22, 0x0C, 0x13, 0x23,
+	0x0C, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x14, 0x15, 0x17, 0x11, 0x14, 0x15, 0x27, 0x01, 0x14, 0x35, 0x08, 0x14, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04,
+	0x17, 0x18, 0x04, 0x0F, 0x06, 0xA7, 0x11, 0x11, 0xA7, 0x21, 0x01, 0x18, 0x0C, 0x27, 0x0C, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x10, 0x13, 0x15, 0x0A, 0x20, 0x12, 0x15, 0x0A,
+	0x21, 0x11, 0x15, 0x0A, 0x00, 0x20, 0x12, 0x35, 0x08, 0x10, 0x13, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0x13, 0xA3, 0x04, 0x23, 0xA2, 0x04, 0x24,
+	0x12, 0x0C, 0x24, 0x21, 0x0C, 0x23, 0x22, 0x0C, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x14, 0x14, 0x16, 0x04, 0x14, 0x24, 0x15, 0x04, 0x12, 0x11,
+	0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x24, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x57, 0x23, 0x04, 0x17,
+	0x13, 0x14, 0x04, 0x00, 0x15, 0x11, 0x23, 0x13, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x13, 0x23, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25,
+	0x04, 0x12, 0x11, 0x14, 0x16, 0x04, 0x21, 0x11, 0x24, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x00, 0x21, 0x11, 0x15, 0x15, 0x04, 0x12, 0x21, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35,
+	0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x15, 0x51, 0x23, 0x04, 0x14, 0x12, 0x13, 0x14, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x24, 0x11, 0x23, 0x13, 0x04, 0x15, 0x21,
+	0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x14, 0x14, 0x16, 0x04, 0x14, 0x24, 0x15, 0x13, 0x14, 0x15, 0x35, 0x11, 0x14, 0x15, 0x15,
+	0x31, 0x14, 0x15, 0x15, 0x04, 0x24, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x57, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x17, 0x13, 0x14, 0x13, 0x17,
+	0x23, 0x33, 0x11, 0x17, 0x23, 0x13, 0x31, 0x27, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x10, 0x13, 0x14, 0x16, 0x04, 0x20, 0x12,
+	0x24, 0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x23, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x13, 0x53,
+	0x23, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x24, 0x11, 0x23, 0x13, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x13, 0x23, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x14, 0x0F,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x13, 0xF4, 0x11, 0x14, 0x3D, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x17, 0x0D, 0x97, 0x05, 0xC5, 0x13, 0x17, 0x38, 0x11, 0x17, 0x18, 0x31, 0x14, 0x0F, 0x01,
+	0x00, 0x00, 0x10, 0x13, 0x0F, 0x01, 0x20, 0x12, 0x0F, 0x01, 0x21, 0xD1, 0x04, 0x00, 0x20, 0x12, 0x0F, 0x01, 0x10, 0x13, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x17, 0x0D, 0x97, 0x05, 0xC5,
+	0x04, 0x17, 0x18, 0x04, 0x00, 0x23, 0x11, 0x0E, 0x33, 0x0F, 0x14, 0x0F, 0x01, 0x00, 0x14, 0x15, 0x0A, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x14, 0x0F, 0x01, 0x00, 0x17,
+	0x13, 0x09, 0x97, 0x05, 0xC5, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x21, 0x2C, 0x04, 0x11, 0x1E, 0x04, 0x00, 0x12, 0x1D, 0x04, 0x12, 0x2C, 0x04,
+	0x21, 0x2B, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x24, 0x1A, 0x04, 0x14, 0x1B, 0x04, 0x24, 0x1A, 0x04, 0x15, 0x19, 0x05, 0x24, 0xA1, 0x04, 0xA7, 0x04, 0x0F, 0x06,
+	0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x12, 0x2C, 0x04, 0x12, 0x1D, 0x04, 0x00, 0x00, 0x12, 0x2C, 0x04, 0x2E, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0x15, 0xA1, 0x04, 0x15, 0x1A,
+	0x04, 0x00, 0x00, 0x15, 0x19, 0x05, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x20, 0x2D, 0x04, 0x12, 0x1D, 0x04, 0x00, 0x00, 0x20, 0x2D, 0x04, 0x2E, 0x05, 0xB4, 0x06,
+	0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x23, 0x1B, 0x04, 0x15, 0x1A, 0x04, 0x00, 0x15, 0x19, 0x05, 0x23, 0xA2, 0x04, 0xA7, 0x04, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x2F,
+	0x04, 0x40, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x21, 0x2C, 0x04, 0x2E, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x42, 0x1A, 0x04, 0x12, 0x12,
+	0x1A, 0x04, 0x12, 0x12, 0x19, 0x05, 0x23, 0xA2, 0x04, 0xA7, 0x04, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x12, 0x2B, 0x05, 0x21, 0x2C, 0x04, 0x20, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x12, 0x1D, 0x04,
+	0x20, 0x2D, 0x04, 0x10, 0x2D, 0x05, 0x10, 0xB3, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x15, 0x1A, 0x04, 0x24, 0x1A, 0x04, 0x23, 0x1B, 0x04, 0x13, 0x11, 0x19, 0x05, 0x24, 0xA1,
+	0x04, 0x23, 0xA2, 0x04, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x51, 0x0F, 0x21, 0x12, 0x2F, 0x13, 0x2E, 0x05, 0xB4, 0x06, 0x94,
+	0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x1F, 0x41, 0xB7, 0x12, 0xA7, 0x13, 0x14, 0x0F, 0x01, 0x44, 0x0D, 0x66, 0x09, 0x69, 0x06, 0x5C, 0x04, 0x2F, 0x04, 0x5B,
+	0x05, 0x12, 0x55, 0x08, 0x21, 0x52, 0x0B, 0x20, 0x22, 0x0F, 0x20, 0x62, 0x0B, 0x21, 0x55, 0x08, 0x12, 0x58, 0x05, 0x2F, 0x04, 0x5C, 0x04, 0x69, 0x06, 0x66, 0x09, 0x44, 0x0D, 0x14, 0x0F, 0x01,
+	0x27, 0x0C, 0x67, 0x08, 0x6B, 0x04, 0x0F, 0x11, 0x04, 0x15, 0x56, 0x04, 0x14, 0x62, 0x08, 0x23, 0x12, 0x0D, 0x23, 0x62, 0x08, 0x24, 0x56, 0x04, 0x15, 0x29, 0x04, 0x5B, 0x05, 0x67, 0x08, 0x27,
+	0x0C, 0x0F, 0x06, 0x24, 0x0F, 0x34, 0x0E, 0x12, 0x33, 0x0C, 0x21, 0x35, 0x0A, 0x20, 0x87, 0x04, 0x00, 0x21, 0x35, 0x0A, 0x12, 0x33, 0x0C, 0x34, 0x0E, 0x24, 0x0F, 0x17, 0x0D, 0x47, 0x19, 0x15,
+	0x53, 0x25, 0x14, 0x47, 0x22, 0x01, 0x23, 0x4A, 0x02, 0x23, 0x57, 0x04, 0x24, 0x53, 0x07, 0x15, 0x41, 0x0A, 0x17, 0x0D, 0x0F, 0x06, 0x24, 0x0F, 0x34, 0x0E, 0x21, 0x33, 0x0C, 0x21, 0x35, 0x0A,
+	0x89, 0x04, 0x00, 0x21, 0x35, 0x0A, 0x21, 0x33, 0x0C, 0x34, 0x0E, 0x24, 0x0F, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04, 0x14, 0x37, 0x11, 0x04, 0x14, 0x26, 0x13, 0x04, 0x12, 0x11, 0x25,
+	0x14, 0x04, 0x20, 0x12, 0x33, 0x15, 0x04, 0x20, 0x12, 0x22, 0x17, 0x04, 0x10, 0x13, 0x21, 0x18, 0x04, 0x34, 0x19, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27, 0x04, 0x17, 0x45, 0x04, 0x17,
+	0x34, 0x11, 0x04, 0x15, 0x11, 0x32, 0x13, 0x04, 0x23, 0x12, 0x31, 0x14, 0x04, 0x13, 0x33, 0x16, 0x04, 0x27, 0x17, 0x04, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04, 0x14, 0x37, 0x11, 0x04,
+	0x14, 0x26, 0x13, 0x04, 0x21, 0x11, 0x25, 0x14, 0x04, 0x21, 0x11, 0x33, 0x15, 0x04, 0x14, 0x22, 0x17, 0x04, 0x14, 0x21, 0x18, 0x04, 0x34, 0x19, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27,
+	0x04, 0x17, 0x45, 0x04, 0x23, 0x12, 0x34, 0x11, 0x04, 0x23, 0x12, 0x32, 0x13, 0x04, 0x17, 0x31, 0x14, 0x04, 0x37, 0x16, 0x04, 0x27, 0x17, 0x04, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04,
+	0x10, 0x13, 0x37, 0x11, 0x04, 0x20, 0x12, 0x26, 0x13, 0x04, 0x21, 0x11, 0x25, 0x14, 0x04, 0x21, 0x11, 0x33, 0x15, 0x04, 0x20, 0x12, 0x22, 0x17, 0x04, 0x10, 0x13, 0x21, 0x18, 0x04, 0x34, 0x19,
+	0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27, 0x04, 0x13, 0x13, 0x45, 0x04, 0x23, 0x12, 0x34, 0x11, 0x04, 0x24, 0x11, 0x32, 0x13, 0x04, 0x24, 0x11, 0x31, 0x14, 0x04, 0x23, 0x32, 0x16, 0x04,
+	0x13, 0x23, 0x17, 0x04, 0x0F, 0x06, 0xF1, 0x50, 0x21, 0x0F, 0x21, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x22, 0x2A, 0x12, 0x11, 0x14, 0x18, 0x14, 0x11, 0x15, 0x16, 0x15, 0x11, 0x16, 0x14, 0x16, 0x11,
+	0x17, 0x12, 0x17, 0x11, 0x28, 0x18, 0x11, 0x17, 0x12, 0x17, 0x11, 0x16, 0x14, 0x16, 0x11, 0x15, 0x16, 0x15, 0x11, 0x14, 0x18, 0x14, 0x11, 0x22, 0x2A, 0x12, 0x11, 0x11, 0x1E, 0x11, 0x21, 0x0F,
+	0x21, 0xF1, 0x50, 0x0F, 0x06, 0x00, 0x3F, 0x03, 0x27, 0x55, 0x02, 0x27, 0x24, 0x22, 0x02, 0x27, 0x23, 0x23, 0x02, 0x27, 0x13, 0x14, 0x03, 0xC6, 0x03, 0xE5, 0x02, 0x35, 0x13, 0x43, 0x02, 0x26,
+	0x22, 0x22, 0x05, 0x26, 0x52, 0x23, 0x01, 0x26, 0x41, 0x25, 0x01, 0x25, 0x12, 0x21, 0x24, 0x02, 0x25, 0x24, 0x23, 0x03, 0x6C, 0x03, 0x3D, 0x05, 0x0F, 0x06, 0x4E, 0x03, 0x25, 0x66, 0x02, 0x25,
+	0x34, 0x23, 0x02, 0x25, 0x24, 0x24, 0x02, 0x25, 0x23, 0x15, 0x03, 0xB4, 0x21, 0x03, 0xF2, 0x20, 0x02, 0x42, 0x23, 0x44, 0x02, 0x24, 0x22, 0x24, 0x05, 0x24, 0x22, 0x32, 0x13, 0x02, 0x24, 0x52,
+	0x25, 0x01, 0x14, 0x42, 0x27, 0x01, 0x23, 0x32, 0x27, 0x02, 0x23, 0x24, 0x26, 0x02, 0x2A, 0x33, 0x03, 0x7A, 0x04, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x00, 0x87, 0x06, 0xB7, 0x03, 0x4F, 0x02, 0x0F,
+	0x23, 0x01, 0x00, 0x0F, 0x22, 0x02, 0x4E, 0x03, 0x0F, 0x06, 0x00, 0x18, 0x0C, 0x38, 0x0A, 0x59, 0x07, 0x6B, 0x04, 0x3E, 0x04, 0x0F, 0x06, 0x00, 0x94, 0x08, 0xC4, 0x05, 0x5D, 0x03, 0x0F, 0x31,
+	0x02, 0x0F, 0x22, 0x02, 0x00, 0x0F, 0x21, 0x03, 0x4D, 0x04, 0x1E, 0x06, 0x0F, 0x06, 0x00, 0x15, 0x0F, 0x25, 0x0E, 0x45, 0x0C, 0x67, 0x08, 0x79, 0x05, 0x2D, 0x06, 0x0F, 0x06, 0x00, 0x00, 0x1A,
+	0x0A, 0x2A, 0x09, 0x16, 0x23, 0x09, 0x25, 0x23, 0x17, 0x01, 0x25, 0x22, 0x27, 0x01, 0x16, 0x22, 0x27, 0x01, 0x26, 0x21, 0x17, 0x02, 0x26, 0x21, 0x26, 0x02, 0x00, 0x26, 0x22, 0x33, 0x03, 0x7A,
+	0x04, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x18, 0x0C, 0x38, 0x0A, 0x28, 0x0B, 0x22, 0x24, 0x18, 0x02, 0x22, 0x24, 0x28, 0x01, 0x22, 0x23, 0x29, 0x01, 0x13, 0x23, 0x19, 0x02, 0x23, 0x22, 0x28, 0x02,
+	0x00, 0x23, 0x22, 0x27, 0x03, 0x23, 0x32, 0x35, 0x03, 0x23, 0x33, 0x33, 0x04, 0x79, 0x05, 0x4A, 0x07, 0x0F, 0x06, 0x00, 0x00, 0x0F, 0x13, 0x02, 0x2A, 0x35, 0x01, 0x2A, 0x34, 0x02, 0x25, 0x23,
+	0x24, 0x03, 0x25, 0x23, 0x23, 0x04, 0x25, 0x23, 0x22, 0x05, 0x16, 0x13, 0x32, 0x05, 0x26, 0x12, 0x11, 0x31, 0x04, 0x26, 0x32, 0x33, 0x02, 0x26, 0x31, 0x26, 0x01, 0x16, 0x13, 0x27, 0x01, 0x0F,
+	0x23, 0x01, 0x00, 0x00, 0x0F, 0x06, 0x0F, 0x13, 0x02, 0x18, 0x38, 0x01, 0x28, 0x36, 0x02, 0x28, 0x35, 0x03, 0x22, 0x24, 0x34, 0x04, 0x22, 0x24, 0x33, 0x05, 0x22, 0x14, 0x24, 0x06, 0x22, 0x14,
+	0x33, 0x06, 0x13, 0x14, 0x12, 0x21, 0x06, 0x23, 0x13, 0x21, 0x42, 0x03, 0x23, 0x33, 0x35, 0x02, 0x23, 0x32, 0x28, 0x01, 0x23, 0x13, 0x29, 0x01, 0x0F, 0x23, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x06,
+	0x00, 0x29, 0x25, 0x03, 0x29, 0x44, 0x02, 0x29, 0x14, 0x22, 0x01, 0x29, 0x13, 0x23, 0x01, 0xE6, 0x01, 0xD6, 0x02, 0x29, 0x12, 0x07, 0x19, 0x22, 0x07, 0x28, 0x22, 0x24, 0x01, 0x2C, 0x24, 0x01,
+	0x18, 0x23, 0x23, 0x02, 0x18, 0x24, 0x22, 0x02, 0x28, 0x53, 0x03, 0x29, 0x33, 0x04, 0x1A, 0x0A, 0x0F, 0x06, 0x26, 0x37, 0x03, 0x26, 0x56, 0x02, 0x26, 0x25, 0x22, 0x02, 0x26, 0x15, 0x24, 0x01,
+	0x26, 0x24, 0x24, 0x01, 0xF2, 0x30, 0x01, 0xF2, 0x20, 0x02, 0x26, 0x23, 0x08, 0x25, 0x23, 0x09, 0x25, 0x23, 0x26, 0x01, 0x00, 0x2A, 0x26, 0x01, 0x24, 0x34, 0x24, 0x02, 0x25, 0x24, 0x33, 0x02,
+	0x25, 0x74, 0x03, 0x26, 0x45, 0x04, 0x27, 0x0C, 0x17, 0x0D, 0x27, 0x1A, 0x01, 0x27, 0x38, 0x01, 0x27, 0x46, 0x02, 0x27, 0x44, 0x04, 0x27, 0x51, 0x06, 0x84, 0x09, 0x62, 0x2A, 0x01, 0x12, 0x23,
+	0x2A, 0x01, 0x26, 0x2A, 0x01, 0x26, 0x39, 0x01, 0x36, 0x46, 0x02, 0xB7, 0x03, 0x78, 0x06, 0x0F, 0x06, 0x25, 0x0E, 0x45, 0x0C, 0x47, 0x0A, 0x49, 0x08, 0x2B, 0x08, 0x27, 0x1A, 0x01, 0x27, 0x38,
+	0x01, 0x27, 0x46, 0x02, 0x27, 0x44, 0x04, 0x27, 0x51, 0x06, 0x84, 0x09, 0x72, 0x29, 0x01, 0x13, 0x23, 0x29, 0x01, 0x27, 0x29, 0x01, 0x00, 0x37, 0x36, 0x02, 0xA8, 0x03, 0x69, 0x06, 0x0F, 0x06,
+	0x12, 0x22, 0x0E, 0x22, 0x41, 0x0C, 0x14, 0x42, 0x0A, 0x21, 0x56, 0x07, 0x32, 0x26, 0x08, 0x0F, 0x06, 0x00, 0x29, 0x0A, 0x25, 0x22, 0x43, 0x03, 0x25, 0x22, 0x62, 0x02, 0x25, 0x22, 0x12, 0x23,
+	0x02, 0x25, 0x22, 0x27, 0x01, 0x00, 0x00, 0x12, 0x22, 0x22, 0x27, 0x01, 0x52, 0x22, 0x27, 0x01, 0x74, 0x22, 0x23, 0x01, 0x25, 0x31, 0x13, 0x23, 0x01, 0x34, 0x42, 0x11, 0x23, 0x01, 0x24, 0x13,
+	0x32, 0x23, 0x01, 0x24, 0x13, 0x23, 0x06, 0x28, 0x0B, 0x19, 0x0B, 0x0F, 0x06, 0x29, 0x0A, 0x25, 0x22, 0x43, 0x03, 0x25, 0x22, 0x62, 0x02, 0x25, 0x22, 0x12, 0x23, 0x02, 0x25, 0x22, 0x27, 0x01,
+	0x00, 0x00, 0x12, 0x22, 0x22, 0x27, 0x01, 0x52, 0x22, 0x27, 0x01, 0x74, 0x22, 0x23, 0x01, 0x25, 0x41, 0x21, 0x23, 0x01, 0x25, 0x62, 0x23, 0x01, 0x24, 0x13, 0x32, 0x23, 0x01, 0x12, 0x21, 0x13,
+	0x33, 0x05, 0x23, 0x23, 0x0B, 0x11, 0x22, 0x0F, 0x31, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x00, 0x2A, 0x09, 0x49, 0x08, 0x28, 0x31, 0x07, 0x27, 0x33, 0x06, 0x26, 0x25, 0x06, 0x25,
+	0x27, 0x05, 0x34, 0x28, 0x04, 0x24, 0x2A, 0x03, 0x32, 0x3B, 0x02, 0x13, 0x3D, 0x01, 0x0F, 0x13, 0x02, 0x0F, 0x06, 0x00, 0x00, 0x2A, 0x09, 0x49, 0x08, 0x28, 0x31, 0x07, 0x27, 0x33, 0x06, 0x26,
+	0x25, 0x06, 0x25, 0x27, 0x05, 0x34, 0x28, 0x04, 0x24, 0x2A, 0x03, 0x32, 0x12, 0x38, 0x02, 0x13, 0x33, 0x37, 0x01, 0x19, 0x18, 0x02, 0x26, 0x0D, 0x27, 0x0C, 0x18, 0x0C, 0x0F, 0x06, 0xA7, 0x04,
+	0xF3, 0x10, 0x02, 0x33, 0x49, 0x02, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x27, 0x0C, 0x00, 0x27, 0x1A, 0x01, 0x27, 0x29, 0x01, 0x27, 0x38, 0x01, 0x27, 0x46, 0x02, 0xF2, 0x10, 0x03, 0xD2, 0x06, 0x27,
+	0x0C, 0x00, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0xF3, 0x10, 0x02, 0x33, 0x49, 0x02, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x27, 0x0C, 0x00, 0x27, 0x1A, 0x01, 0x27, 0x29, 0x01, 0x27, 0x38, 0x01, 0x27, 0x46,
+	0x02, 0xF2, 0x04, 0xD2, 0x06, 0x27, 0x0C, 0x22, 0x23, 0x0C, 0x10, 0x13, 0x22, 0x0C, 0x21, 0x33, 0x0C, 0x0F, 0x06, 0x00, 0x4D, 0x04, 0x5D, 0x03, 0x24, 0x2B, 0x02, 0x00, 0x24, 0x2C, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x22, 0x02, 0x0F, 0x06, 0x00, 0x5D, 0x03, 0x00, 0x25, 0x2A, 0x02, 0x00, 0x25, 0x2B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x21,
+	0x2B, 0x01, 0x32, 0x2C, 0x02, 0x24, 0x0F, 0x22, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x26, 0x0D, 0x26, 0x36, 0x04, 0x26, 0x64, 0x03, 0x26, 0x15, 0x23, 0x02, 0x26, 0x29, 0x02, 0x26,
+	0x2A, 0x01, 0x00, 0x00, 0x22, 0x22, 0x2A, 0x01, 0x62, 0x24, 0x24, 0x01, 0x55, 0x22, 0x24, 0x01, 0x56, 0x21, 0x24, 0x01, 0x25, 0x43, 0x24, 0x01, 0x25, 0x25, 0x07, 0x25, 0x0E, 0x16, 0x0E, 0x0F,
+	0x06, 0x00, 0x26, 0x0D, 0x26, 0x36, 0x04, 0x26, 0x64, 0x03, 0x26, 0x15, 0x23, 0x02, 0x26, 0x29, 0x02, 0x26, 0x2A, 0x01, 0x00, 0x00, 0x22, 0x22, 0x2A, 0x01, 0x62, 0x24, 0x24, 0x01, 0x55, 0x22,
+	0x24, 0x01, 0x56, 0x21, 0x24, 0x01, 0x25, 0x43, 0x24, 0x01, 0x12, 0x22, 0x25, 0x07, 0x43, 0x0E, 0x11, 0x12, 0x11, 0x0E, 0x31, 0x0F, 0x02, 0x0F, 0x06, 0x00, 0x00, 0x00, 0xF2, 0x04, 0xF2, 0x20,
+	0x02, 0x0F, 0x22, 0x02, 0x0F, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x32, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x31, 0x02, 0x3F, 0x03, 0x3E, 0x04, 0x2E, 0x05, 0x0F, 0x06, 0x00, 0x00, 0x00, 0xF2,
+	0x04, 0xF2, 0x20, 0x02, 0x0F, 0x22, 0x02, 0x0F, 0x23, 0x01, 0x00, 0x00, 0x00, 0x14, 0x2D, 0x01, 0x34, 0x3A, 0x01, 0x26, 0x29, 0x02, 0x23, 0x3B, 0x02, 0x24, 0x39, 0x03, 0x25, 0x37, 0x04, 0x2E,
+	0x05, 0x0F, 0x06, 0x25, 0x0E, 0x00, 0x00, 0x00, 0x25, 0x43, 0x15, 0x01, 0x25, 0x62, 0x24, 0x25, 0x31, 0x32, 0x22, 0x01, 0x25, 0x21, 0x24, 0x22, 0x01, 0x25, 0x21, 0x24, 0x21, 0x02, 0x92, 0x52,
+	0x03, 0xF2, 0x04, 0x25, 0x44, 0x06, 0x25, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x25, 0x0E, 0x00, 0x00, 0x00, 0x25, 0x43, 0x15, 0x01, 0x25, 0x62, 0x24, 0x25, 0x31, 0x32, 0x22, 0x01, 0x25,
+	0x21, 0x24, 0x12, 0x02, 0x25, 0x21, 0x33, 0x21, 0x02, 0xF2, 0x10, 0x03, 0x72, 0x42, 0x06, 0x25, 0x0E, 0x00, 0x12, 0x22, 0x0E, 0x43, 0x0E, 0x21, 0x31, 0x0E, 0x22, 0x21, 0x0E, 0x13, 0x0F, 0x02,
+	0x28, 0x0B, 0x00, 0x00, 0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x28, 0x37, 0x01, 0x28, 0x28, 0x01, 0x00, 0x18, 0x29, 0x01, 0x27, 0x24, 0x23, 0x01, 0x00, 0x00, 0xC3, 0x23, 0x01, 0xB3, 0x24, 0x01,
+	0x27, 0x29, 0x01, 0x00, 0x27, 0x0C, 0x00, 0x29, 0x0A, 0x38, 0x0A, 0x28, 0x0B, 0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x28, 0x37, 0x01, 0x28, 0x28, 0x01, 0x18, 0x29, 0x01, 0x27, 0x24, 0x23, 0x01,
+	0x00, 0x00, 0xC3, 0x23, 0x01, 0xB3, 0x24, 0x01, 0x27, 0x29, 0x01, 0x22, 0x23, 0x29, 0x01, 0x24, 0x21, 0x0C, 0x12, 0x24, 0x0C, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x1B, 0x09, 0x2A, 0x09, 0x00, 0x23,
+	0x25, 0x09, 0x23, 0x34, 0x09, 0x23, 0x34, 0x32, 0x04, 0x23, 0xA3, 0x03, 0x23, 0x22, 0x11, 0x11, 0x33, 0x02, 0x23, 0x12, 0x22, 0x25, 0x02, 0x23, 0x11, 0x32, 0x26, 0x01, 0x43, 0x22, 0x27, 0x01,
+	0x33, 0x23, 0x27, 0x01, 0x32, 0x24, 0x27, 0x01, 0x14, 0x24, 0x17, 0x02, 0x29, 0x0A, 0x00, 0x0F, 0x06, 0x1B, 0x09, 0x2A, 0x09, 0x00, 0x23, 0x25, 0x09, 0x23, 0x34, 0x09, 0x23, 0x34, 0x32, 0x04,
+	0x23, 0xA3, 0x03, 0x23, 0x22, 0x11, 0x11, 0x33, 0x02, 0x23, 0x12, 0x22, 0x25, 0x02, 0x23, 0x11, 0x32, 0x26, 0x01, 0x43, 0x22, 0x27, 0x01, 0x33, 0x23, 0x27, 0x01, 0x32, 0x24, 0x27, 0x01, 0x14,
+	0x11, 0x22, 0x17, 0x02, 0x17, 0x21, 0x0A, 0x15, 0x23, 0x0A, 0x26, 0x0D, 0x17, 0x0D, 0x0F, 0x06, 0x26, 0x0D, 0x26, 0x2A, 0x01, 0x26, 0x57, 0x01, 0x26, 0x64, 0x03, 0x86, 0x07, 0x92, 0x0A, 0x32,
+	0x21, 0x0D, 0x16, 0x0E, 0x25, 0x47, 0x03, 0x25, 0x21, 0x54, 0x02, 0x25, 0x21, 0x27, 0x02, 0x28, 0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x23, 0x01, 0x26, 0x0D, 0x26, 0x2A, 0x01, 0x26,
+	0x57, 0x01, 0x26, 0x64, 0x03, 0x26, 0x61, 0x06, 0xA2, 0x09, 0x32, 0x21, 0x0D, 0x16, 0x0E, 0x25, 0x47, 0x03, 0x25, 0x22, 0x53, 0x02, 0x25, 0x22, 0x26, 0x02, 0x29, 0x27, 0x01, 0x00, 0x00, 0x23,
+	0x24, 0x27, 0x01, 0x34, 0x22, 0x27, 0x01, 0x22, 0x12, 0x22, 0x27, 0x01, 0x33, 0x2C, 0x01, 0x14, 0x0F, 0x01, 0x0F, 0x06, 0x25, 0x0E, 0x00, 0x25, 0x26, 0x06, 0x25, 0x53, 0x06, 0x95, 0x13, 0x03,
+	0x62, 0x14, 0x25, 0x01, 0x12, 0x22, 0x24, 0x25, 0x01, 0x25, 0x14, 0x26, 0x01, 0x25, 0x23, 0x26, 0x01, 0x00, 0x00, 0x24, 0x24, 0x25, 0x02, 0x00, 0x24, 0x25, 0x33, 0x02, 0x7B, 0x03, 0x3D, 0x05,
+	0x26, 0x0D, 0x00, 0x26, 0x25, 0x06, 0x26, 0x52, 0x06, 0x86, 0x13, 0x03, 0x63, 0x13, 0x25, 0x01, 0x13, 0x22, 0x23, 0x25, 0x01, 0x26, 0x13, 0x26, 0x01, 0x26, 0x22, 0x26, 0x01, 0x00, 0x00, 0x25,
+	0x23, 0x25, 0x02, 0x00, 0x25, 0x24, 0x23, 0x03, 0x22, 0x77, 0x03, 0x33, 0x37, 0x05, 0x12, 0x12, 0x0F, 0x31, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x1B, 0x09, 0x2A, 0x09, 0x00, 0x1A,
+	0x0A, 0x29, 0x17, 0x02, 0x29, 0x27, 0x01, 0x00, 0x28, 0x28, 0x01, 0x28, 0x27, 0x02, 0x00, 0x00, 0x38, 0x25, 0x03, 0x39, 0x33, 0x03, 0x7A, 0x04, 0x4B, 0x06, 0x18, 0x0C, 0x28, 0x0B, 0x18, 0x0C,
+	0x27, 0x0C, 0x00, 0x26, 0x0D, 0x26, 0x29, 0x02, 0x00, 0x25, 0x2A, 0x02, 0x25, 0x1A, 0x03, 0x25, 0x29, 0x03, 0x00, 0x00, 0x25, 0x28, 0x04, 0x26, 0x36, 0x04, 0x36, 0x34, 0x05, 0x87, 0x06, 0x49,
+	0x08, 0x18, 0x0C, 0x28, 0x0B, 0x18, 0x0C, 0x27, 0x0C, 0x00, 0x26, 0x0D, 0x26, 0x29, 0x02, 0x00, 0x16, 0x2A, 0x02, 0x25, 0x1A, 0x03, 0x25, 0x29, 0x03, 0x00, 0x00, 0x25, 0x28, 0x04, 0x12, 0x23,
+	0x36, 0x04, 0x23, 0x31, 0x34, 0x05, 0x11, 0x12, 0x82, 0x06, 0x21, 0x46, 0x08, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x16, 0x0E, 0x25, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x25, 0x44, 0x06, 0x25, 0x82, 0x04,
+	0x15, 0x22, 0x35, 0x03, 0x15, 0x21, 0x27, 0x03, 0x35, 0x29, 0x02, 0x34, 0x2A, 0x02, 0x24, 0x2C, 0x01, 0x00, 0x00, 0x24, 0x0F, 0x00, 0x0F, 0x06, 0x16, 0x0E, 0x25, 0x0E, 0x00, 0x00, 0x00, 0x00,
+	0x25, 0x44, 0x06, 0x25, 0x82, 0x04, 0x15, 0x22, 0x35, 0x03, 0x15, 0x21, 0x27, 0x03, 0x35, 0x29, 0x02, 0x34, 0x2A, 0x02, 0x24, 0x2C, 0x01, 0x24, 0x22, 0x28, 0x01, 0x24, 0x33, 0x26, 0x01, 0x24,
+	0x12, 0x12, 0x09, 0x24, 0x22, 0x0B, 0x1A, 0x0A, 0x0F, 0x06, 0x00, 0x00, 0x4D, 0x04, 0x23, 0x67, 0x03, 0x43, 0x34, 0x23, 0x02, 0x45, 0x21, 0x25, 0x02, 0x47, 0x27, 0x01, 0x29, 0x27, 0x01, 0x28,
+	0x28, 0x01, 0x00, 0x27, 0x29, 0x01, 0x17, 0x2A, 0x01, 0x26, 0x2A, 0x01, 0x16, 0x2B, 0x01, 0x25, 0x3A, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x06, 0x00, 0x00, 0x4D, 0x04, 0x23, 0x67, 0x03, 0x43, 0x34,
+	0x23, 0x02, 0x45, 0x21, 0x25, 0x02, 0x47, 0x27, 0x01, 0x29, 0x27, 0x01, 0x28, 0x28, 0x01, 0x00, 0x27, 0x29, 0x01, 0x17, 0x2A, 0x01, 0x26, 0x2A, 0x01, 0x25, 0x2B, 0x01, 0x13, 0x12, 0x3A, 0x01,
+	0x24, 0x2B, 0x02, 0x21, 0x12, 0x0F, 0x22, 0x0F, 0x02, 0x0F, 0x06, 0x26, 0x17, 0x05, 0x26, 0x26, 0x05, 0x26, 0x34, 0x06, 0x26, 0x42, 0x07, 0x66, 0x09, 0x55, 0x26, 0x03, 0x62, 0x47, 0x02, 0x32,
+	0x11, 0x27, 0x22, 0x01, 0x25, 0x27, 0x22, 0x01, 0x00, 0x2E, 0x22, 0x01, 0xA9, 0x02, 0x16, 0x92, 0x03, 0x35, 0x27, 0x04, 0x26, 0x18, 0x04, 0x27, 0x27, 0x03, 0x27, 0x18, 0x03, 0x28, 0x0B, 0x0F,
+	0x06, 0xA8, 0x03, 0xF3, 0x20, 0x01, 0x53, 0x57, 0x01, 0x2D, 0x06, 0x0F, 0x06, 0x00, 0x4D, 0x04, 0x25, 0x56, 0x03, 0x25, 0x29, 0x03, 0x25, 0x2A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0x31, 0x02, 0x4D, 0x04, 0x7B, 0x03, 0x34, 0x23, 0x25, 0x02, 0x46, 0x27, 0x02, 0x48, 0x34, 0x02, 0x27, 0x32, 0x31, 0x03, 0x26, 0x45, 0x04, 0x26, 0x43, 0x06, 0x25, 0x51, 0x08, 0x82, 0x35, 0x03,
+	0x52, 0x57, 0x02, 0x25, 0x26, 0x23, 0x01, 0x00, 0x35, 0x25, 0x23, 0x01, 0x26, 0x16, 0x22, 0x02, 0x36, 0x55, 0x02, 0x98, 0x04, 0x99, 0x03, 0x0F, 0x31, 0x02, 0x1F, 0x05, 0x26, 0x36, 0x04, 0x26,
+	0x15, 0x07, 0x26, 0x23, 0x08, 0x26, 0xA2, 0x01, 0xF2, 0x30, 0x01, 0x82, 0x0B, 0x16, 0x21, 0x0B, 0x27, 0x0C, 0x17, 0x27, 0x04, 0x26, 0x46, 0x03, 0x16, 0x26, 0x22, 0x02, 0x25, 0x26, 0x22, 0x02,
+	0x00, 0x00, 0x36, 0x15, 0x21, 0x03, 0xA7, 0x04, 0x79, 0x05, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x5A, 0x06, 0x98, 0x04, 0x37, 0x35, 0x03, 0x36, 0x27, 0x03, 0x35, 0x28, 0x03, 0x25, 0x28, 0x04, 0x34,
+	0x36, 0x05, 0x24, 0x63, 0x06, 0x84, 0x16, 0x02, 0x34, 0x2B, 0x01, 0x24, 0x1C, 0x02, 0x15, 0x2B, 0x02, 0x25, 0x2A, 0x02, 0x26, 0x28, 0x03, 0x36, 0x35, 0x04, 0x88, 0x05, 0x59, 0x07, 0x0F, 0x06,
+	0xA8, 0x03, 0xF3, 0x20, 0x01, 0x53, 0x57, 0x01, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x3F, 0x03, 0x27, 0x55, 0x02, 0x27, 0x25, 0x31, 0x01, 0x27, 0x24, 0x23, 0x01, 0x00, 0x27, 0x24, 0x32, 0x01, 0xF3,
+	0x10, 0x02, 0xF3, 0x03, 0x13, 0x22, 0x26, 0x05, 0x26, 0x27, 0x04, 0x26, 0x28, 0x03, 0x16, 0x29, 0x03, 0x0F, 0x06, 0xA8, 0x03, 0xF3, 0x20, 0x01, 0x43, 0x67, 0x01, 0x2C, 0x07, 0x0F, 0x06, 0x3F,
+	0x03, 0x27, 0x55, 0x02, 0x27, 0x25, 0x31, 0x01, 0x27, 0x24, 0x23, 0x01, 0x00, 0x00, 0xC3, 0x32, 0x01, 0xF3, 0x10, 0x02, 0x27, 0x63, 0x03, 0x22, 0x23, 0x25, 0x05, 0x24, 0x21, 0x26, 0x04, 0x12,
+	0x14, 0x28, 0x03, 0x23, 0x2B, 0x03, 0x0F, 0x06, 0x99, 0x03, 0xF3, 0x20, 0x01, 0x43, 0x67, 0x01, 0x2C, 0x07, 0x0F, 0x06, 0x3F, 0x03, 0x27, 0x55, 0x02, 0x27, 0x25, 0x31, 0x01, 0x27, 0x24, 0x23,
+	0x01, 0x00, 0x00, 0xC3, 0x32, 0x01, 0xF3, 0x10, 0x02, 0x27, 0x63, 0x03, 0x32, 0x22, 0x25, 0x05, 0x11, 0x13, 0x21, 0x26, 0x04, 0x11, 0x13, 0x21, 0x27, 0x03, 0x32, 0x1B, 0x04, 0x0F, 0x06, 0x24,
+	0x0F, 0x24, 0x65, 0x04, 0x24, 0x93, 0x03, 0x24, 0x32, 0x35, 0x02, 0x14, 0x31, 0x38, 0x01, 0x43, 0x2B, 0x01, 0x33, 0x2C, 0x01, 0x23, 0x2D, 0x01, 0x0F, 0x23, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x31,
+	0x02, 0x23, 0x3A, 0x03, 0xE3, 0x04, 0xA4, 0x07, 0x37, 0x0B, 0x39, 0x09, 0x4A, 0x07, 0x1C, 0x08, 0x0F, 0x06, 0x25, 0x0E, 0x25, 0x65, 0x03, 0x25, 0x93, 0x02, 0x25, 0x32, 0x35, 0x01, 0x15, 0x31,
+	0x38, 0x44, 0x2B, 0x34, 0x2C, 0x24, 0x2D, 0x0F, 0x24, 0x0F, 0x23, 0x01, 0x0F, 0x32, 0x01, 0x24, 0x3A, 0x02, 0xE4, 0x03, 0xA5, 0x06, 0x13, 0x34, 0x0A, 0x33, 0x34, 0x08, 0x12, 0x48, 0x06, 0x32,
+	0x18, 0x07, 0x0F, 0x06, 0x25, 0x0E, 0x25, 0x65, 0x03, 0x25, 0x93, 0x02, 0x25, 0x32, 0x35, 0x01, 0x15, 0x31, 0x38, 0x35, 0x2B, 0x34, 0x2C, 0x24, 0x2D, 0x0F, 0x24, 0x0F, 0x23, 0x01, 0x0F, 0x32,
+	0x01, 0x14, 0x4A, 0x02, 0xE4, 0x03, 0xA5, 0x06, 0x23, 0x33, 0x0A, 0x12, 0x12, 0x34, 0x08, 0x12, 0x12, 0x45, 0x06, 0x23, 0x18, 0x07, 0x0F, 0x22, 0x02, 0x0F, 0x21, 0x03, 0x2F, 0x04, 0x3E, 0x04,
+	0x2E, 0x05, 0x2D, 0x12, 0x03, 0x0F, 0x23, 0x01, 0x13, 0x25, 0x27, 0x01, 0x23, 0x25, 0x26, 0x01, 0x14, 0x26, 0x25, 0x01, 0x24, 0x11, 0x34, 0x32, 0x01, 0x35, 0x65, 0x02, 0x25, 0x38, 0x03, 0x0F,
+	0x06, 0x1B, 0x09, 0x2B, 0x08, 0x3C, 0x06, 0x4E, 0x03, 0x0F, 0x21, 0x03, 0x0F, 0x21, 0x03, 0x2F, 0x04, 0x00, 0x2E, 0x05, 0x2D, 0x12, 0x03, 0x0F, 0x23, 0x01, 0x13, 0x25, 0x27, 0x01, 0x23, 0x25,
+	0x26, 0x01, 0x14, 0x26, 0x25, 0x01, 0x24, 0x11, 0x34, 0x32, 0x01, 0x35, 0x65, 0x02, 0x25, 0x38, 0x03, 0x0F, 0x06, 0x1B, 0x09, 0x25, 0x24, 0x08, 0x26, 0x34, 0x06, 0x14, 0x49, 0x03, 0x25, 0x29,
+	0x03, 0x16, 0x0E, 0x0F, 0x21, 0x03, 0x2F, 0x04, 0x00, 0x2E, 0x05, 0x2D, 0x12, 0x03, 0x0F, 0x23, 0x01, 0x23, 0x24, 0x27, 0x01, 0x23, 0x25, 0x26, 0x01, 0x24, 0x25, 0x25, 0x01, 0x24, 0x21, 0x33,
+	0x32, 0x01, 0x35, 0x65, 0x02, 0x26, 0x37, 0x03, 0x0F, 0x06, 0x1C, 0x08, 0x35, 0x33, 0x07, 0x14, 0x13, 0x33, 0x06, 0x14, 0x13, 0x35, 0x04, 0x14, 0x13, 0x36, 0x03, 0x35, 0x19, 0x03, 0x1D, 0x07,
+	0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x36, 0x0C, 0x26, 0x0D, 0x00, 0x37, 0x0B, 0x38, 0x0A, 0x39, 0x09, 0x3A, 0x08, 0x2C, 0x07, 0x2D, 0x06, 0x2E, 0x05, 0x2F, 0x04, 0x0F,
+	0x31, 0x02, 0x0F, 0x12, 0x03, 0x1D, 0x07, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x36, 0x0C, 0x26, 0x0D, 0x36, 0x0C, 0x37, 0x0B, 0x38, 0x0A, 0x39, 0x09, 0x15, 0x34, 0x08,
+	0x25, 0x25, 0x07, 0x36, 0x24, 0x06, 0x14, 0x13, 0x25, 0x05, 0x24, 0x29, 0x04, 0x35, 0x38, 0x02, 0x17, 0x19, 0x03, 0x1D, 0x07, 0x2D, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x39, 0x09, 0x28, 0x0B, 0x27,
+	0x0C, 0x26, 0x0D, 0x00, 0x27, 0x0C, 0x38, 0x0A, 0x39, 0x09, 0x3A, 0x08, 0x35, 0x33, 0x07, 0x14, 0x13, 0x24, 0x06, 0x14, 0x13, 0x25, 0x05, 0x14, 0x13, 0x26, 0x04, 0x35, 0x38, 0x02, 0x0F, 0x12,
+	0x03, 0x0F, 0x06, 0xA8, 0x03, 0xF3, 0x20, 0x01, 0x53, 0x57, 0x01, 0x3C, 0x06, 0x0F, 0x06, 0x00, 0x3F, 0x03, 0x24, 0x23, 0x53, 0x02, 0x24, 0x23, 0x22, 0x23, 0x01, 0x00, 0x00, 0xB4, 0x23, 0x01,
+	0xF4, 0x02, 0x24, 0x23, 0x43, 0x03, 0x14, 0x24, 0x14, 0x05, 0x14, 0x24, 0x24, 0x04, 0x29, 0x25, 0x03, 0x0F, 0x21, 0x03, 0x0F, 0x06, 0x99, 0x03, 0xF3, 0x20, 0x01, 0x43, 0x58, 0x01, 0x2D, 0x06,
+	0x0F, 0x06, 0x0F, 0x21, 0x03, 0x24, 0x23, 0x44, 0x02, 0x24, 0x23, 0x23, 0x22, 0x01, 0x00, 0x00, 0x00, 0xF4, 0x02, 0x00, 0x24, 0x23, 0x24, 0x04, 0x24, 0x23, 0x15, 0x04, 0x42, 0x23, 0x25, 0x03,
+	0x24, 0x23, 0x16, 0x03, 0x31, 0x0F, 0x02, 0x0F, 0x06, 0x99, 0x03, 0xF3, 0x20, 0x01, 0x43, 0x58, 0x01, 0x2D, 0x06, 0x0F, 0x06, 0x0F, 0x21, 0x03, 0x24, 0x23, 0x44, 0x02, 0x24, 0x23, 0x23, 0x22,
+	0x01, 0x00, 0x00, 0x00, 0xF4, 0x02, 0x00, 0x24, 0x23, 0x24, 0x04, 0x42, 0x23, 0x15, 0x04, 0x11, 0x12, 0x24, 0x25, 0x03, 0x11, 0x12, 0x1C, 0x03, 0x22, 0x0F, 0x02, 0x0F, 0x06, 0x00, 0x00, 0x25,
+	0x22, 0x34, 0x03, 0x25, 0x22, 0x53, 0x02, 0x25, 0x22, 0x23, 0x22, 0x01, 0x25, 0x22, 0x22, 0x23, 0x01, 0x00, 0x00, 0xF2, 0x20, 0x02, 0xF2, 0x10, 0x03, 0x24, 0x23, 0x23, 0x05, 0x00, 0x24, 0x23,
+	0x24, 0x04, 0x00, 0x14, 0x24, 0x25, 0x03, 0x23, 0x14, 0x27, 0x02, 0x3D, 0x05, 0x5C, 0x04, 0x2B, 0x23, 0x03, 0x2A, 0x24, 0x03, 0x23, 0x15, 0x34, 0x03, 0x23, 0x15, 0x33, 0x04, 0x23, 0x55, 0x06,
+	0x23, 0x44, 0x08, 0x23, 0x42, 0x0A, 0x63, 0x11, 0x17, 0x02, 0x33, 0x14, 0x27, 0x01, 0x13, 0x26, 0x25, 0x02, 0x2A, 0x34, 0x02, 0x1B, 0x33, 0x03, 0x5B, 0x05, 0x68, 0x07, 0x00, 0x3C, 0x06, 0x2D,
+	0x06, 0x0F, 0x06, 0x25, 0x35, 0x06, 0x25, 0x63, 0x05, 0x25, 0x32, 0x23, 0x04, 0x25, 0x22, 0x44, 0x02, 0xF2, 0x20, 0x02, 0xD2, 0x23, 0x01, 0x25, 0x2B, 0x01, 0x00, 0x15, 0x2C, 0x01, 0x24, 0x2C,
+	0x01, 0x0F, 0x23, 0x01, 0x00, 0x15, 0x2C, 0x01, 0x24, 0x2B, 0x02, 0x25, 0x57, 0x02, 0x26, 0x46, 0x03, 0x37, 0x0B, 0x18, 0x0C, 0x0F, 0x06, 0x5C, 0x04, 0x7B, 0x03, 0x13, 0x35, 0x34, 0x02, 0x73,
+	0x27, 0x02, 0x65, 0x26, 0x02, 0x17, 0x41, 0x23, 0x03, 0x26, 0x54, 0x04, 0x25, 0x45, 0x05, 0x25, 0x43, 0x21, 0x04, 0x75, 0x27, 0x62, 0x1B, 0x01, 0x22, 0x21, 0x2B, 0x01, 0x26, 0x2A, 0x01, 0x36,
+	0x28, 0x02, 0x37, 0x35, 0x03, 0x98, 0x04, 0x5A, 0x06, 0x1B, 0x09, 0x25, 0x23, 0x09, 0x25, 0x14, 0x09, 0x16, 0x24, 0x08, 0x26, 0x23, 0x08, 0x26, 0x81, 0x04, 0xF2, 0x20, 0x02, 0x82, 0x21, 0x24,
+	0x02, 0x26, 0x23, 0x25, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x23, 0x01, 0x1A, 0x26, 0x02, 0x3A, 0x33, 0x02, 0x7B, 0x03, 0x4D, 0x04, 0x0F, 0x06, 0x1C, 0x08, 0x2C, 0x07, 0x17, 0x14, 0x08, 0x37, 0x21,
+	0x08, 0x48, 0x09, 0x5A, 0x06, 0x1A, 0x52, 0x03, 0x25, 0x22, 0x55, 0x26, 0x21, 0x12, 0x25, 0x37, 0x24, 0x05, 0x28, 0x24, 0x05, 0x00, 0x00, 0x38, 0x32, 0x05, 0x69, 0x06, 0x4A, 0x07, 0x2A, 0x09,
+	0x29, 0x0A, 0x14, 0x24, 0x0A, 0x43, 0x12, 0x0B, 0x55, 0x0B, 0x48, 0x09, 0x27, 0x51, 0x06, 0x12, 0x24, 0x63, 0x03, 0x22, 0x22, 0x57, 0x01, 0x23, 0x21, 0x2A, 0x01, 0x14, 0x11, 0x34, 0x07, 0x25,
+	0x25, 0x07, 0x00, 0x00, 0x00, 0x26, 0x23, 0x08, 0x76, 0x08, 0x38, 0x0A, 0x0F, 0x06, 0x00, 0x00, 0x88, 0x05, 0xB7, 0x03, 0x17, 0x33, 0x07, 0x2A, 0x09, 0x19, 0x33, 0x13, 0x01, 0x28, 0x25, 0x31,
+	0x16, 0x11, 0x37, 0x02, 0xC6, 0x03, 0x87, 0x21, 0x03, 0x18, 0x27, 0x03, 0x18, 0x36, 0x03, 0x29, 0x33, 0x04, 0x79, 0x05, 0x5A, 0x06, 0x0F, 0x06, 0x00, 0x96, 0x06, 0xD4, 0x04, 0x14, 0x35, 0x13,
+	0x04, 0x29, 0x0A, 0x27, 0x23, 0x07, 0x26, 0x25, 0x14, 0x01, 0x26, 0x26, 0x31, 0x01, 0x12, 0x22, 0x57, 0x02, 0xF2, 0x04, 0xA4, 0x21, 0x04, 0x25, 0x28, 0x04, 0x00, 0x26, 0x26, 0x05, 0x36, 0x34,
+	0x05, 0x87, 0x06, 0x49, 0x08, 0x0F, 0x06, 0x00, 0x00, 0x0F, 0x31, 0x02, 0x5F, 0x01, 0x3E, 0x31, 0x2E, 0x23, 0x00, 0xA6, 0x23, 0xE6, 0x01, 0x29, 0x44, 0x02, 0x29, 0x24, 0x04, 0x29, 0x15, 0x04,
+	0x29, 0x25, 0x03, 0x29, 0x26, 0x02, 0x0F, 0x23, 0x01, 0x0F, 0x06, 0x3F, 0x03, 0x5E, 0x02, 0x2E, 0x31, 0x01, 0x2D, 0x23, 0x01, 0x00, 0x00, 0x00, 0xD2, 0x32, 0x01, 0xF2, 0x20, 0x02, 0x36, 0x45,
+	0x03, 0x36, 0x25, 0x05, 0x26, 0x17, 0x05, 0x26, 0x27, 0x04, 0x26, 0x18, 0x04, 0x26, 0x28, 0x03, 0x0F, 0x22, 0x02, 0x0F, 0x06, 0x00, 0x00, 0x15, 0x72, 0x06, 0x86, 0x07, 0x13, 0x27, 0x15, 0x02,
+	0x22, 0x27, 0x25, 0x01, 0x22, 0x26, 0x26, 0x01, 0x22, 0x16, 0x27, 0x01, 0x13, 0x25, 0x27, 0x01, 0x23, 0x24, 0x27, 0x01, 0x00, 0x23, 0x24, 0x26, 0x02, 0x23, 0x34, 0x25, 0x02, 0x2A, 0x33, 0x03,
+	0x7B, 0x03, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x00, 0x86, 0x07, 0xC2, 0x07, 0x22, 0x33, 0x0B, 0x26, 0x2A, 0x01, 0x25, 0x2B, 0x01, 0x24, 0x1C, 0x02, 0x23, 0x2C, 0x02, 0x00, 0x23, 0x2B, 0x03, 0x33,
+	0x39, 0x03, 0x44, 0x45, 0x04, 0xB5, 0x05, 0x77, 0x07, 0x0F, 0x06, 0x1D, 0x07, 0x2D, 0x06, 0x2C, 0x07, 0x23, 0x26, 0x08, 0x23, 0x35, 0x23, 0x03, 0x23, 0x34, 0x43, 0x02, 0x23, 0x43, 0x22, 0x22,
+	0x01, 0x23, 0x13, 0x11, 0x23, 0x22, 0x01, 0x23, 0x42, 0x23, 0x22, 0x01, 0x23, 0x21, 0x21, 0x24, 0x21, 0x01, 0x43, 0x22, 0x54, 0x01, 0x33, 0x23, 0x36, 0x01, 0x23, 0x25, 0x25, 0x02, 0x14, 0x35,
+	0x33, 0x02, 0x7B, 0x03, 0x4C, 0x05, 0x1F, 0x05, 0x26, 0x36, 0x04, 0x26, 0x15, 0x07, 0x26, 0x23, 0x08, 0x16, 0xA3, 0x01, 0xF2, 0x30, 0x01, 0x92, 0x0A, 0x16, 0x21, 0x0B, 0x18, 0x0C, 0x17, 0x0D,
+	0x26, 0x0D, 0x25, 0x0E, 0x00, 0x25, 0x56, 0x03, 0xE5, 0x02, 0x47, 0x26, 0x02, 0x0F, 0x22, 0x02, 0x00, 0x0F, 0x21, 0x03, 0x0F, 0x06, 0x1D, 0x07, 0x2D, 0x06, 0x2C, 0x07, 0x23, 0x26, 0x08, 0x23,
+	0x35, 0x15, 0x02, 0x23, 0x34, 0x26, 0x01, 0x00, 0x23, 0x13, 0x11, 0x27, 0x01, 0x23, 0x12, 0x21, 0x27, 0x01, 0x23, 0x21, 0x21, 0x27, 0x01, 0x43, 0x22, 0x17, 0x02, 0x33, 0x23, 0x26, 0x02, 0x23,
+	0x25, 0x25, 0x02, 0x14, 0x35, 0x23, 0x03, 0x7B, 0x03, 0x4C, 0x05, 0x0F, 0x06, 0x00, 0x28, 0x26, 0x03, 0x28, 0x24, 0x05, 0x28, 0x13, 0x07, 0x28, 0x82, 0x01, 0xF5, 0x01, 0x75, 0x09, 0x18, 0x11,
+	0x0A, 0x29, 0x0A, 0x19, 0x18, 0x02, 0x28, 0x27, 0x02, 0x00, 0x28, 0x26, 0x03, 0x29, 0x34, 0x03, 0x7A, 0x04, 0x4B, 0x06, 0x1F, 0x05, 0x26, 0x36, 0x04, 0x26, 0x25, 0x06, 0x26, 0x23, 0x08, 0x25,
+	0xA3, 0x01, 0xF2, 0x30, 0x01, 0x92, 0x0A, 0x16, 0x12, 0x0B, 0x18, 0x0C, 0x27, 0x0C, 0x17, 0x19, 0x03, 0x26, 0x29, 0x02, 0x00, 0x26, 0x19, 0x03, 0x26, 0x28, 0x03, 0x27, 0x26, 0x04, 0x37, 0x34,
+	0x04, 0x88, 0x05, 0x4A, 0x07, 0x0F, 0x06, 0x4E, 0x03, 0x7C, 0x02, 0x3B, 0x23, 0x02, 0x23, 0x25, 0x25, 0x02, 0x23, 0x24, 0x25, 0x03, 0x23, 0x14, 0x34, 0x04, 0x23, 0x23, 0x41, 0x06, 0x23, 0x53,
+	0x23, 0x03, 0x23, 0x51, 0x44, 0x02, 0x63, 0x25, 0x22, 0x01, 0x23, 0x22, 0x25, 0x22, 0x01, 0x27, 0x25, 0x22, 0x01, 0x27, 0x26, 0x21, 0x01, 0x28, 0x27, 0x02, 0x29, 0x35, 0x02, 0x8A, 0x03, 0x5B,
+	0x05, 0x0F, 0x14, 0x01, 0x19, 0x28, 0x01, 0x29, 0x26, 0x02, 0x28, 0x26, 0x03, 0x23, 0x13, 0x26, 0x04, 0x23, 0x22, 0x21, 0x32, 0x04, 0x23, 0x12, 0x72, 0x04, 0x23, 0x21, 0x11, 0x32, 0x21, 0x03,
+	0x23, 0x11, 0x12, 0x22, 0x23, 0x02, 0x43, 0x12, 0x22, 0x24, 0x01, 0x43, 0x52, 0x33, 0x01, 0x23, 0x11, 0x43, 0x22, 0x03, 0x23, 0x11, 0x25, 0x21, 0x04, 0x13, 0x22, 0x23, 0x22, 0x04, 0x57, 0x23,
+	0x04, 0x38, 0x25, 0x03, 0x0F, 0x42, 0x0F, 0x23, 0x01, 0x0F, 0x06, 0x1C, 0x08, 0x25, 0x34, 0x07, 0x25, 0x33, 0x08, 0x25, 0x22, 0x0A, 0x25, 0x31, 0x34, 0x03, 0x35, 0x11, 0x54, 0x02, 0x52, 0x21,
+	0x23, 0x32, 0x01, 0x22, 0x21, 0x21, 0x22, 0x24, 0x01, 0x25, 0x31, 0x11, 0x25, 0x01, 0x25, 0x72, 0x22, 0x01, 0x25, 0x63, 0x22, 0x01, 0x25, 0x23, 0x26, 0x01, 0x15, 0x14, 0x27, 0x01, 0x24, 0x23,
+	0x27, 0x01, 0x38, 0x27, 0x01, 0x28, 0x28, 0x01, 0x28, 0x0B, 0x0F, 0x06, 0x0F, 0x32, 0x01, 0x5F, 0x01, 0x4D, 0x04, 0x4B, 0x06, 0x59, 0x07, 0x67, 0x08, 0x45, 0x21, 0x09, 0x43, 0x23, 0x09, 0x23,
+	0x25, 0x09, 0x13, 0x96, 0x02, 0x7C, 0x02, 0x0F, 0x23, 0x01, 0x00, 0x00, 0x0F, 0x32, 0x01, 0x0F, 0x31, 0x02, 0x4E, 0x03, 0x3D, 0x05, 0x0F, 0x06, 0x18, 0x0C, 0x38, 0x0A, 0x28, 0x0B, 0x22, 0x24,
+	0x18, 0x02, 0x22, 0x24, 0x28, 0x01, 0x22, 0x23, 0x29, 0x01, 0x13, 0x23, 0x19, 0x02, 0x23, 0x22, 0x28, 0x02, 0x00, 0x23, 0x22, 0x27, 0x03, 0x23, 0x32, 0x35, 0x03, 0x23, 0x33, 0x33, 0x04, 0x14,
+	0x74, 0x05, 0x34, 0x43, 0x07, 0x26, 0x0D, 0x23, 0x0F, 0x01, 0x34, 0x0E, 0x16, 0x0E, 0x0F, 0x06, 0x00, 0x1A, 0x0A, 0x2A, 0x35, 0x01, 0x29, 0x35, 0x02, 0x29, 0x42, 0x04, 0x69, 0x06, 0x66, 0x26,
+	0x01, 0x26, 0x21, 0x27, 0x01, 0x29, 0x27, 0x01, 0x29, 0x36, 0x01, 0x8A, 0x03, 0x5B, 0x05, 0x17, 0x0D, 0x27, 0x0C, 0x38, 0x0A, 0x5A, 0x06, 0x2C, 0x07, 0x0F, 0x06, 0x00, 0x00, 0x8A, 0x03, 0xE7,
+	0x27, 0x57, 0x1F, 0x05, 0x0F, 0x06, 0x2A, 0x09, 0x00, 0x2A, 0x18, 0x2A, 0x27, 0x2A, 0x35, 0x01, 0xD6, 0x02, 0xB6, 0x04, 0x2A, 0x09, 0x00, 0x00, 0x23, 0x0F, 0x01, 0x15, 0x0F, 0x11, 0x0F, 0x04,
+	0x22, 0x0F, 0x02, 0x14, 0x0F, 0x01, 0x12, 0x13, 0x0E, 0x00, 0x00, 0x33, 0x0F, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0D, 0x26, 0x18, 0x04, 0x27, 0x27, 0x03, 0x38, 0x15, 0x04, 0x39,
+	0x23, 0x04, 0x3A, 0x22, 0x04, 0x5B, 0x05, 0x4C, 0x05, 0x2E, 0x05, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0E, 0x26, 0x18, 0x04, 0x27, 0x27, 0x03, 0x28, 0x16, 0x04, 0x29, 0x24, 0x04, 0x14,
+	0x35, 0x22, 0x04, 0x34, 0x54, 0x05, 0x26, 0x44, 0x05, 0x23, 0x38, 0x05, 0x34, 0x0E, 0x15, 0x0F, 0x0F, 0x06, 0x0F, 0x23, 0x01, 0x0F, 0x32, 0x01, 0x4F, 0x02, 0x3E, 0x04, 0x4C, 0x13, 0x01, 0x4A,
+	0x24, 0x01, 0x58, 0x26, 0x46, 0x21, 0x26, 0x44, 0x22, 0x27, 0x51, 0x24, 0x27, 0x21, 0x12, 0x24, 0x26, 0x01, 0x25, 0x33, 0x33, 0x02, 0x25, 0x74, 0x03, 0x25, 0x45, 0x05, 0x16, 0x0E, 0x26, 0x0D,
+	0x16, 0x0E, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x19, 0x12, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x27, 0x0C, 0x27, 0x1A, 0x01, 0x27, 0x2A, 0x27, 0x29, 0x01,
+	0x27, 0x28, 0x02, 0x27, 0x46, 0x02, 0x27, 0x71, 0x04, 0x27, 0x51, 0x06, 0x27, 0x0C, 0x27, 0x13, 0x08, 0x27, 0x23, 0x07, 0x27, 0x31, 0x08, 0x57, 0x09, 0x37, 0x0B, 0x27, 0x0C, 0x0F, 0x06, 0x24,
+	0x0F, 0x24, 0x1C, 0x02, 0x24, 0x2C, 0x01, 0x00, 0x24, 0x2B, 0x02, 0x24, 0x3A, 0x02, 0x24, 0x48, 0x03, 0x24, 0x82, 0x05, 0x24, 0x52, 0x08, 0x24, 0x0F, 0x24, 0x14, 0x0A, 0x24, 0x24, 0x09, 0x24,
+	0x23, 0x0A, 0x24, 0x22, 0x0B, 0x54, 0x0C, 0x44, 0x0D, 0x24, 0x0F, 0x0F, 0x06, 0x00, 0x2D, 0x06, 0x00, 0x00, 0x2C, 0x07, 0x00, 0x2B, 0x08, 0x00, 0xBA, 0x00, 0x29, 0x0A, 0x28, 0x0B, 0x27, 0x0C,
+	0x36, 0x0C, 0x17, 0x0D, 0x0F, 0x06, 0x1C, 0x08, 0x2B, 0x08, 0x00, 0x00, 0x2A, 0x09, 0x00, 0x29, 0x0A, 0x00, 0x28, 0x0B, 0xC8, 0x01, 0xD7, 0x01, 0x36, 0x0C, 0x26, 0x0D, 0x25, 0x0E, 0x24, 0x0F,
+	0x23, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x00, 0x68, 0x07, 0x00, 0x28, 0x0B, 0x28, 0x19, 0x01, 0x28, 0x28, 0x01, 0x46, 0x28, 0x01, 0x46, 0x27, 0x02, 0x28, 0x27, 0x02, 0x28, 0x26,
+	0x03, 0x28, 0x25, 0x04, 0x28, 0x33, 0x05, 0x78, 0x06, 0x48, 0x09, 0x0F, 0x06, 0x00, 0x75, 0x09, 0x00, 0x25, 0x0E, 0x00, 0x25, 0x2B, 0x01, 0x25, 0x2A, 0x02, 0x61, 0x2A, 0x02, 0x61, 0x29, 0x03,
+	0x25, 0x29, 0x03, 0x25, 0x28, 0x04, 0x25, 0x27, 0x05, 0x25, 0x35, 0x06, 0x25, 0x43, 0x07, 0x75, 0x09, 0x45, 0x0C, 0x0F, 0x06, 0x00, 0x0F, 0x22, 0x02, 0x28, 0x27, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0xB8, 0x02, 0x00, 0x28, 0x27, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x03, 0x00, 0x25, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x03, 0x00, 0x25, 0x29, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0x21, 0x03, 0x0F, 0x06, 0x00, 0x00, 0x29, 0x26, 0x02, 0x29, 0x25, 0x03, 0x29, 0x15, 0x04, 0x29, 0x24, 0x04, 0x29, 0x23, 0x05, 0x29, 0x22, 0x24, 0x29, 0x21, 0x25, 0x49,
+	0x26, 0xF6, 0xE6, 0x01, 0x29, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x26, 0x18, 0x04, 0x26, 0x27, 0x04, 0x26, 0x26, 0x05, 0x00, 0x26, 0x25, 0x06, 0x26, 0x24, 0x07, 0x26, 0x23, 0x25, 0x01, 0x26,
+	0x22, 0x26, 0x01, 0x26, 0x21, 0x27, 0x01, 0x46, 0x28, 0x01, 0xF2, 0x30, 0x01, 0xF2, 0x20, 0x02, 0x26, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x0F, 0x12, 0x03, 0x26, 0x29, 0x02, 0x26, 0x38,
+	0x02, 0x26, 0x37, 0x03, 0x26, 0x36, 0x04, 0x26, 0x44, 0x05, 0x26, 0x51, 0x07, 0xA2, 0x09, 0x72, 0x0C, 0x26, 0x29, 0x02, 0x00, 0x00, 0x00, 0x26, 0x47, 0x02, 0xB6, 0x04, 0x76, 0x08, 0x0F, 0x13,
+	0x02, 0x26, 0x2A, 0x01, 0x26, 0x39, 0x01, 0x26, 0x38, 0x02, 0x26, 0x37, 0x03, 0x26, 0x45, 0x04, 0x26, 0x61, 0x06, 0xB2, 0x08, 0x72, 0x0C, 0x26, 0x2A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x12, 0x23,
+	0x57, 0x01, 0x23, 0xC1, 0x03, 0x14, 0x81, 0x07, 0x21, 0x0F, 0x03, 0x22, 0x0F, 0x02, 0x0F, 0x06, 0x27, 0x24, 0x06, 0x00, 0x17, 0x25, 0x06, 0x17, 0x15, 0x07, 0x26, 0x15, 0x07, 0x26, 0x24, 0x07,
+	0x62, 0x24, 0x07, 0x92, 0x21, 0x07, 0xA6, 0x05, 0x16, 0x85, 0x01, 0x25, 0x15, 0x34, 0x01, 0x25, 0x24, 0x08, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x2A, 0x09, 0x0F, 0x06, 0x27, 0x24, 0x06, 0x00, 0x00,
+	0x00, 0x17, 0x15, 0x07, 0x00, 0x53, 0x24, 0x07, 0xB3, 0x07, 0xB6, 0x04, 0x26, 0x84, 0x01, 0x26, 0x14, 0x25, 0x01, 0x16, 0x15, 0x08, 0x16, 0x24, 0x08, 0x12, 0x22, 0x24, 0x08, 0x43, 0x24, 0x08,
+	0x11, 0x12, 0x26, 0x08, 0x31, 0x18, 0x08, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x1B, 0x09, 0x2A, 0x09, 0x29, 0x17, 0x02, 0x28, 0x28, 0x01, 0x37, 0x28, 0x01, 0x35, 0x29, 0x02, 0x43, 0x2A, 0x02, 0x52,
+	0x29, 0x03, 0x12, 0x22, 0x38, 0x03, 0x25, 0x37, 0x04, 0x25, 0x36, 0x05, 0x25, 0x35, 0x06, 0x25, 0x33, 0x08, 0x75, 0x09, 0x55, 0x0B, 0x25, 0x0E, 0x1B, 0x09, 0x2A, 0x09, 0x29, 0x17, 0x02, 0x38,
+	0x27, 0x01, 0x37, 0x28, 0x01, 0x36, 0x28, 0x02, 0x34, 0x2A, 0x02, 0x52, 0x29, 0x03, 0x22, 0x21, 0x38, 0x03, 0x25, 0x37, 0x04, 0x25, 0x27, 0x05, 0x25, 0x35, 0x06, 0x25, 0x34, 0x07, 0x25, 0x41,
+	0x09, 0x21, 0x62, 0x0A, 0x62, 0x0D, 0x11, 0x12, 0x0F, 0x01, 0x21, 0x0F, 0x03, 0x13, 0x0F, 0x02, 0x1B, 0x09, 0x2A, 0x09, 0x39, 0x09, 0x38, 0x0A, 0x46, 0x0B, 0x53, 0x1A, 0x02, 0x62, 0x2A, 0x01,
+	0x12, 0x23, 0x29, 0x02, 0x26, 0x37, 0x03, 0x26, 0x36, 0x04, 0x26, 0x53, 0x05, 0x86, 0x07, 0x56, 0x0A, 0x26, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x08, 0x2B, 0x08, 0x3A, 0x08, 0x39, 0x09,
+	0x47, 0x0A, 0x54, 0x1A, 0x01, 0x63, 0x2A, 0x13, 0x23, 0x29, 0x01, 0x27, 0x37, 0x02, 0x27, 0x36, 0x03, 0x27, 0x53, 0x04, 0x87, 0x06, 0x57, 0x09, 0x27, 0x0C, 0x13, 0x23, 0x0C, 0x23, 0x22, 0x0C,
+	0x24, 0x21, 0x0C, 0x12, 0x24, 0x0C, 0x23, 0x22, 0x0C, 0x0F, 0x06, 0x00, 0x0F, 0x21, 0x03, 0x25, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x02, 0x00,
+	0x0F, 0x06, 0x0F, 0x22, 0x02, 0x25, 0x2A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x2A, 0x02, 0xF2, 0x30, 0x01, 0x13, 0xF1, 0x01, 0x21, 0x0F, 0x03, 0x22,
+	0x0F, 0x02, 0x0F, 0x06, 0x27, 0x0C, 0x00, 0x00, 0x00, 0xB3, 0x07, 0x00, 0x27, 0x1A, 0x01, 0x27, 0x29, 0x01, 0x00, 0x27, 0x37, 0x02, 0x27, 0x45, 0x03, 0xE3, 0x04, 0xB3, 0x07, 0x27, 0x0C, 0x00,
+	0x00, 0x00, 0x27, 0x0C, 0x00, 0x00, 0x00, 0xB3, 0x07, 0x00, 0x27, 0x1A, 0x01, 0x27, 0x29, 0x01, 0x00, 0x27, 0x28, 0x02, 0x27, 0x37, 0x02, 0x27, 0x45, 0x03, 0xE3, 0x04, 0xB3, 0x07, 0x27, 0x0C,
+	0x13, 0x23, 0x0C, 0x24, 0x21, 0x0C, 0x12, 0x24, 0x0C, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x28, 0x0B, 0x28, 0x18, 0x02, 0x29, 0x27, 0x01, 0x14, 0x24, 0x27, 0x01, 0x23, 0x25, 0x25, 0x02, 0x24, 0x14,
+	0x26, 0x02, 0x25, 0x29, 0x03, 0x00, 0x16, 0x38, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x2D, 0x06, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x48, 0x09, 0x19, 0x0B, 0x0F, 0x06, 0x19, 0x0B, 0x38, 0x17, 0x02,
+	0x29, 0x27, 0x01, 0x14, 0x25, 0x26, 0x01, 0x24, 0x24, 0x25, 0x02, 0x24, 0x15, 0x25, 0x02, 0x25, 0x2A, 0x02, 0x26, 0x28, 0x03, 0x16, 0x29, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x3D, 0x05, 0x14, 0x28,
+	0x06, 0x34, 0x25, 0x07, 0x26, 0x23, 0x08, 0x23, 0x34, 0x09, 0x34, 0x31, 0x0A, 0x15, 0x0F, 0x0F, 0x06, 0x0F, 0x13, 0x02, 0x0F, 0x22, 0x02, 0x24, 0x2B, 0x02, 0x24, 0x2A, 0x03, 0x00, 0x24, 0x29,
+	0x04, 0x24, 0x28, 0x05, 0x24, 0x27, 0x06, 0x24, 0x26, 0x07, 0x24, 0x25, 0x08, 0x24, 0x53, 0x07, 0x24, 0x32, 0x22, 0x06, 0x54, 0x25, 0x05, 0x44, 0x27, 0x04, 0x24, 0x2A, 0x03, 0x0F, 0x32, 0x01,
+	0x0F, 0x13, 0x02, 0x0F, 0x06, 0x0F, 0x14, 0x01, 0x0F, 0x33, 0x25, 0x2B, 0x01, 0x25, 0x2A, 0x02, 0x00, 0x25, 0x29, 0x03, 0x25, 0x28, 0x04, 0x25, 0x27, 0x05, 0x25, 0x26, 0x06, 0x25, 0x34, 0x07,
+	0x25, 0x63, 0x05, 0x25, 0x31, 0x33, 0x04, 0x55, 0x35, 0x03, 0x22, 0x31, 0x38, 0x02, 0x33, 0x3B, 0x01, 0x12, 0x12, 0x3C, 0x31, 0x0F, 0x02, 0x14, 0x0F, 0x01, 0x29, 0x0A, 0x00, 0x00, 0x19, 0x0B,
+	0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x28, 0x37, 0x01, 0x28, 0x28, 0x01, 0x18, 0x29, 0x01, 0x00, 0x27, 0x14, 0x24, 0x01, 0x27, 0x23, 0x24, 0x01, 0x27, 0x22, 0x25, 0x01, 0x17, 0x31, 0x26, 0x01,
+	0x46, 0x28, 0x01, 0x36, 0x28, 0x02, 0x29, 0x0A, 0x00, 0x00, 0x19, 0x0B, 0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x28, 0x37, 0x01, 0x28, 0x28, 0x01, 0x18, 0x29, 0x01, 0x00, 0x27, 0x14, 0x24, 0x01,
+	0x27, 0x23, 0x24, 0x01, 0x27, 0x22, 0x25, 0x01, 0x12, 0x14, 0x31, 0x26, 0x01, 0x73, 0x28, 0x01, 0x11, 0x12, 0x31, 0x28, 0x02, 0x31, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x15, 0x0F,
+	0x44, 0x0D, 0x36, 0x0C, 0x47, 0x17, 0x02, 0x29, 0x27, 0x01, 0x0F, 0x22, 0x02, 0x00, 0x0F, 0x21, 0x03, 0x2F, 0x04, 0x3D, 0x05, 0x3C, 0x06, 0x4A, 0x07, 0x57, 0x09, 0x64, 0x0B, 0x24, 0x0F, 0x0F,
+	0x06, 0x15, 0x0F, 0x44, 0x0D, 0x36, 0x0C, 0x47, 0x17, 0x02, 0x29, 0x27, 0x01, 0x0F, 0x32, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x21, 0x03, 0x3F, 0x03, 0x3E, 0x04, 0x3D, 0x05, 0x3B, 0x07, 0x12, 0x46,
+	0x08, 0x22, 0x61, 0x0A, 0x13, 0x31, 0x0D, 0x11, 0x12, 0x0F, 0x01, 0x21, 0x0F, 0x03, 0x0F, 0x06, 0x1B, 0x09, 0x3A, 0x08, 0x39, 0x17, 0x01, 0x38, 0x37, 0x37, 0x28, 0x01, 0x36, 0x19, 0x02, 0x34,
+	0x23, 0x25, 0x02, 0x52, 0x24, 0x23, 0x03, 0x22, 0x21, 0x24, 0x32, 0x03, 0x25, 0x55, 0x04, 0x25, 0x36, 0x05, 0x25, 0x35, 0x06, 0x25, 0x33, 0x21, 0x05, 0x25, 0x41, 0x23, 0x04, 0x55, 0x15, 0x05,
+	0x25, 0x0E, 0x1B, 0x09, 0x3A, 0x08, 0x2A, 0x17, 0x01, 0x38, 0x28, 0x37, 0x28, 0x01, 0x36, 0x29, 0x01, 0x44, 0x22, 0x25, 0x02, 0x52, 0x23, 0x34, 0x02, 0x22, 0x21, 0x24, 0x23, 0x03, 0x25, 0x25,
+	0x21, 0x04, 0x25, 0x45, 0x05, 0x25, 0x35, 0x06, 0x25, 0x54, 0x05, 0x25, 0x32, 0x32, 0x04, 0x12, 0x62, 0x14, 0x05, 0x63, 0x0C, 0x11, 0x22, 0x0F, 0x31, 0x0F, 0x02, 0x13, 0x0F, 0x02, 0x0F, 0x06,
+	0x29, 0x0A, 0x14, 0x24, 0x0A, 0x24, 0x23, 0x0A, 0x24, 0x23, 0x17, 0x02, 0x24, 0x23, 0x27, 0x01, 0x24, 0x23, 0x26, 0x02, 0x24, 0x23, 0x25, 0x03, 0x24, 0x23, 0x33, 0x04, 0xC4, 0x05, 0xA4, 0x07,
+	0x24, 0x23, 0x0A, 0x14, 0x24, 0x0A, 0x23, 0x24, 0x0A, 0x00, 0x00, 0x29, 0x0A, 0x00, 0x2A, 0x09, 0x14, 0x25, 0x09, 0x24, 0x24, 0x09, 0x24, 0x24, 0x17, 0x01, 0x24, 0x24, 0x27, 0x24, 0x24, 0x26,
+	0x01, 0x24, 0x24, 0x25, 0x02, 0x24, 0x24, 0x33, 0x03, 0xD4, 0x04, 0xB4, 0x06, 0x24, 0x24, 0x09, 0x14, 0x25, 0x09, 0x23, 0x25, 0x09, 0x00, 0x23, 0x21, 0x22, 0x09, 0x27, 0x21, 0x09, 0x15, 0x24,
+	0x09, 0x26, 0x0D, 0x17, 0x0D, 0x0F, 0x06, 0x00, 0x00, 0x19, 0x0B, 0x48, 0x11, 0x07, 0x3A, 0x16, 0x01, 0x0F, 0x24, 0x00, 0x27, 0x29, 0x01, 0x57, 0x26, 0x01, 0x2A, 0x25, 0x02, 0x0F, 0x21, 0x03,
+	0x2F, 0x04, 0x3D, 0x05, 0x5A, 0x06, 0x58, 0x08, 0x28, 0x0B, 0x0F, 0x06, 0x15, 0x0F, 0x44, 0x0D, 0x46, 0x0B, 0x28, 0x17, 0x03, 0x0F, 0x22, 0x02, 0x00, 0x23, 0x2B, 0x03, 0x43, 0x29, 0x03, 0x45,
+	0x26, 0x04, 0x18, 0x25, 0x05, 0x3D, 0x05, 0x3C, 0x06, 0x3B, 0x07, 0x39, 0x09, 0x56, 0x0A, 0x54, 0x0C, 0x24, 0x0F, 0x0F, 0x06, 0x25, 0x0E, 0x45, 0x0C, 0x47, 0x0A, 0x29, 0x17, 0x02, 0x0F, 0x23,
+	0x01, 0x00, 0x24, 0x2B, 0x02, 0x54, 0x28, 0x02, 0x37, 0x26, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x2D, 0x06, 0x3B, 0x07, 0x22, 0x45, 0x08, 0x23, 0x51, 0x0A, 0x11, 0x24, 0x0D, 0x31, 0x0F, 0x02, 0x13,
+	0x0F, 0x02, 0x0F, 0x06, 0x29, 0x0A, 0x00, 0x23, 0x24, 0x0A, 0x23, 0x24, 0x18, 0x01, 0x23, 0x24, 0x37, 0x23, 0x24, 0x27, 0x01, 0x23, 0x24, 0x26, 0x02, 0x23, 0x24, 0x43, 0x03, 0x23, 0x84, 0x04,
+	0x23, 0x54, 0x07, 0x23, 0x24, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x29, 0x0A, 0x00, 0x0F, 0x06, 0x29, 0x0A, 0x00, 0x24, 0x23, 0x0A, 0x24, 0x23, 0x18, 0x01, 0x24, 0x23, 0x37, 0x24, 0x23, 0x27, 0x01,
+	0x24, 0x23, 0x26, 0x02, 0x24, 0x23, 0x43, 0x03, 0x24, 0x83, 0x04, 0x24, 0x53, 0x07, 0x24, 0x23, 0x0A, 0x00, 0x00, 0x00, 0x22, 0x25, 0x0A, 0x33, 0x23, 0x0A, 0x12, 0x12, 0x23, 0x0A, 0x31, 0x0F,
+	0x02, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x20, 0x01, 0x00, 0x29, 0x0A, 0x00, 0x1A, 0x0A, 0x2A, 0x09, 0x00, 0x2B, 0x08, 0x00, 0x3B, 0x07, 0x1C, 0x08, 0x0F, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0xF3, 0x20, 0x01, 0x00, 0x29, 0x0A, 0x00, 0x2A, 0x09, 0x00, 0x14, 0x25, 0x09, 0x24, 0x25, 0x08, 0x35, 0x23, 0x08, 0x13, 0x13, 0x24, 0x07, 0x24, 0x16, 0x08, 0x25, 0x0E, 0x0F, 0x06, 0x27,
+	0x0C, 0x00, 0x27, 0x19, 0x02, 0x00, 0x27, 0x28, 0x02, 0x27, 0x27, 0x03, 0x27, 0x36, 0x03, 0x27, 0x43, 0x05, 0xD2, 0x06, 0xB2, 0x08, 0x27, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06,
+	0x0F, 0x21, 0x03, 0x00, 0x25, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x03, 0x00, 0x0F, 0x06, 0x00, 0x0F, 0x13, 0x02, 0x24, 0x2C, 0x01,
+	0x24, 0x14, 0x26, 0x02, 0x24, 0x23, 0x26, 0x02, 0x00, 0x24, 0x24, 0x24, 0x03, 0x24, 0x25, 0x22, 0x04, 0x24, 0x25, 0x21, 0x05, 0x24, 0x46, 0x05, 0x24, 0x36, 0x06, 0x24, 0x54, 0x06, 0x24, 0x42,
+	0x22, 0x05, 0x64, 0x25, 0x04, 0x44, 0x37, 0x03, 0x15, 0x1A, 0x04, 0x0F, 0x06, 0x1E, 0x06, 0x25, 0x27, 0x05, 0x25, 0x17, 0x06, 0x25, 0x26, 0x06, 0x00, 0x25, 0x25, 0x07, 0x00, 0x25, 0x24, 0x08,
+	0x52, 0x94, 0x01, 0x52, 0xA3, 0x01, 0x25, 0x32, 0x09, 0x25, 0x22, 0x0A, 0x55, 0x12, 0x08, 0x45, 0x23, 0x07, 0x35, 0x25, 0x06, 0x16, 0x26, 0x06, 0x2E, 0x05, 0x1E, 0x06, 0x0F, 0x06, 0x00, 0x0F,
+	0x12, 0x03, 0x0F, 0x22, 0x02, 0x0F, 0x21, 0x03, 0x00, 0x2F, 0x04, 0x3E, 0x04, 0x3D, 0x05, 0x3C, 0x06, 0x3B, 0x07, 0x49, 0x08, 0x38, 0x0A, 0x55, 0x0B, 0x43, 0x0E, 0x23, 0x0F, 0x01, 0x0F, 0x13,
+	0x02, 0x0F, 0x31, 0x02, 0x4E, 0x03, 0x4C, 0x05, 0x59, 0x07, 0x75, 0x09, 0x35, 0x0D, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x25, 0x0E, 0x45, 0x0C, 0x47, 0x0A, 0x59, 0x07, 0x5C, 0x04, 0x5E, 0x02, 0x0F,
+	0x22, 0x02, 0x0F, 0x12, 0x03, 0x0F, 0x31, 0x02, 0x4E, 0x03, 0x4C, 0x05, 0x59, 0x07, 0x75, 0x09, 0x35, 0x0D, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x25, 0x0E, 0x45, 0x0C, 0x47, 0x0A, 0x23, 0x54, 0x07,
+	0x24, 0x65, 0x04, 0x12, 0x12, 0x58, 0x02, 0x32, 0x2C, 0x02, 0x14, 0x0F, 0x01, 0x0F, 0x13, 0x02, 0x0F, 0x31, 0x02, 0x4E, 0x03, 0x4C, 0x05, 0x68, 0x07, 0x65, 0x0A, 0x35, 0x0D, 0x0F, 0x06, 0x00,
+	0x00, 0x15, 0x0F, 0x35, 0x0D, 0x46, 0x0B, 0x48, 0x09, 0x33, 0x54, 0x06, 0x12, 0x13, 0x65, 0x03, 0x12, 0x13, 0x48, 0x02, 0x12, 0x13, 0x1B, 0x02, 0x33, 0x0F, 0x0F, 0x06, 0x00, 0x00, 0x00, 0xF2,
+	0x04, 0xF2, 0x10, 0x03, 0x29, 0x35, 0x02, 0x19, 0x27, 0x02, 0x28, 0x27, 0x02, 0x00, 0x18, 0x28, 0x02, 0x27, 0x28, 0x02, 0x00, 0x17, 0x29, 0x02, 0x26, 0x29, 0x02, 0x35, 0x29, 0x02, 0x16, 0x2A,
+	0x02, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x00, 0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x2A, 0x35, 0x01, 0x1A, 0x27, 0x01, 0x29, 0x27, 0x01, 0x00, 0x19, 0x28, 0x01, 0x28, 0x28, 0x01, 0x00, 0x18, 0x29,
+	0x01, 0x13, 0x23, 0x29, 0x01, 0x23, 0x31, 0x29, 0x01, 0x24, 0x12, 0x38, 0x01, 0x22, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x2A,
+	0x35, 0x01, 0x1A, 0x27, 0x01, 0x29, 0x27, 0x01, 0x00, 0x19, 0x28, 0x01, 0x28, 0x28, 0x01, 0x00, 0x18, 0x29, 0x01, 0x27, 0x29, 0x01, 0x63, 0x29, 0x01, 0x12, 0x13, 0x3A, 0x01, 0x12, 0x13, 0x0E,
+	0x00, 0x33, 0x0F, 0x0F, 0x06, 0x00, 0x24, 0x0F, 0x00, 0x24, 0x1C, 0x02, 0x24, 0x2B, 0x02, 0x00, 0x00, 0x24, 0x2A, 0x03, 0x24, 0x39, 0x03, 0x24, 0x29, 0x04, 0x24, 0x37, 0x05, 0x24, 0x36, 0x06,
+	0x24, 0x44, 0x07, 0x24, 0x51, 0x09, 0x64, 0x0B, 0x34, 0x0E, 0x0F, 0x06, 0x00, 0x24, 0x0F, 0x00, 0x24, 0x1C, 0x02, 0x24, 0x2B, 0x02, 0x00, 0x00, 0x24, 0x2A, 0x03, 0x24, 0x39, 0x03, 0x24, 0x29,
+	0x04, 0x24, 0x28, 0x05, 0x24, 0x27, 0x06, 0x24, 0x35, 0x07, 0x11, 0x22, 0x52, 0x08, 0x21, 0x71, 0x0A, 0x53, 0x0D, 0x11, 0x0F, 0x04, 0x40, 0x0F, 0x02, 0x0F, 0x06, 0x00, 0x24, 0x0F, 0x00, 0x24,
+	0x1C, 0x02, 0x24, 0x2B, 0x02, 0x00, 0x24, 0x3A, 0x02, 0x24, 0x2A, 0x03, 0x24, 0x29, 0x04, 0x24, 0x38, 0x04, 0x24, 0x37, 0x05, 0x24, 0x36, 0x06, 0x24, 0x44, 0x07, 0x84, 0x09, 0x73, 0x0B, 0x12,
+	0x12, 0x0F, 0x00, 0x00, 0x1D, 0x07, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x36, 0x0C, 0x26, 0x0D, 0x00, 0x27, 0x0C, 0x28, 0x0B, 0x39, 0x09, 0x3A, 0x08, 0x3B, 0x07, 0x3C,
+	0x06, 0x3D, 0x05, 0x3E, 0x04, 0x3F, 0x03, 0x0F, 0x11, 0x04, 0x1D, 0x07, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x36, 0x0C, 0x26, 0x0D, 0x00, 0x27, 0x0C, 0x28, 0x0B, 0x39,
+	0x09, 0x15, 0x34, 0x08, 0x25, 0x34, 0x07, 0x36, 0x33, 0x06, 0x14, 0x12, 0x35, 0x05, 0x24, 0x38, 0x04, 0x25, 0x38, 0x03, 0x16, 0x19, 0x04, 0x1D, 0x07, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x39,
+	0x09, 0x28, 0x0B, 0x27, 0x0C, 0x26, 0x0D, 0x00, 0x27, 0x0C, 0x28, 0x0B, 0x29, 0x0A, 0x3A, 0x08, 0x35, 0x33, 0x07, 0x14, 0x13, 0x33, 0x06, 0x14, 0x13, 0x34, 0x05, 0x14, 0x13, 0x35, 0x04, 0x35,
+	0x37, 0x03, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x26, 0x17, 0x05, 0x26, 0x36, 0x04, 0x26, 0x34, 0x06, 0x26, 0x42, 0x07, 0x26, 0x13, 0x09, 0x26, 0x2A, 0x01, 0x00, 0x00, 0xF2, 0x30, 0x01, 0xF2, 0x20,
+	0x02, 0x26, 0x0D, 0x00, 0x00, 0x26, 0x13, 0x09, 0x26, 0x42, 0x07, 0x26, 0x34, 0x06, 0x26, 0x36, 0x04, 0x1F, 0x05, 0x26, 0x17, 0x05, 0x26, 0x36, 0x04, 0x26, 0x34, 0x06, 0x26, 0x42, 0x07, 0x26,
+	0x13, 0x09, 0x26, 0x2A, 0x01, 0x00, 0x00, 0xF2, 0x30, 0x01, 0xF2, 0x20, 0x02, 0x26, 0x0D, 0x00, 0x00, 0x12, 0x23, 0x13, 0x09, 0x22, 0x22, 0x42, 0x07, 0x14, 0x21, 0x34, 0x06, 0x21, 0x23, 0x36,
+	0x04, 0x32, 0x1A, 0x05, 0x13, 0x0F, 0x02, 0x26, 0x17, 0x05, 0x26, 0x36, 0x04, 0x26, 0x34, 0x06, 0x26, 0x42, 0x07, 0x26, 0x13, 0x09, 0x26, 0x2A, 0x01, 0x00, 0x00, 0xF3, 0x20, 0x01, 0xF3, 0x10,
+	0x02, 0x26, 0x0D, 0x00, 0x00, 0x26, 0x13, 0x09, 0x32, 0x21, 0x32, 0x08, 0x11, 0x33, 0x33, 0x07, 0x11, 0x33, 0x35, 0x05, 0x11, 0x33, 0x36, 0x04, 0x32, 0x1A, 0x05, 0x0F, 0x06, 0x25, 0x0E, 0x00,
+	0x00, 0x25, 0x24, 0x08, 0x25, 0x34, 0x07, 0x25, 0x35, 0x06, 0x25, 0x36, 0x05, 0x25, 0x27, 0x05, 0x25, 0x47, 0x03, 0x25, 0x26, 0x31, 0x02, 0x25, 0x25, 0x33, 0x01, 0x25, 0x24, 0x35, 0x25, 0x23,
+	0x17, 0x01, 0x25, 0x31, 0x0A, 0x55, 0x0B, 0x35, 0x0D, 0x16, 0x0E, 0x0F, 0x06, 0x00, 0x1F, 0x05, 0x19, 0x24, 0x05, 0x14, 0x23, 0x15, 0x05, 0x23, 0x14, 0x25, 0x04, 0x23, 0x24, 0x24, 0x04, 0x00,
+	0x14, 0x24, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04, 0x24, 0x14, 0x25, 0x03, 0x24, 0x24, 0x24, 0x03, 0x24, 0x24, 0x15, 0x03, 0x15, 0x15, 0x25, 0x02, 0x25, 0x13, 0x26, 0x02, 0x25, 0x0E, 0x0F, 0x06,
+	0x0F, 0x22, 0x02, 0x00, 0x00, 0x0F, 0x31, 0x02, 0x6D, 0x02, 0x5A, 0x12, 0x03, 0x57, 0x15, 0x03, 0x63, 0x27, 0x03, 0x33, 0x2A, 0x03, 0x0F, 0x21, 0x03, 0x00, 0x00, 0x1B, 0x24, 0x03, 0x3B, 0x12,
+	0x04, 0x4D, 0x04, 0x4E, 0x03, 0x0F, 0x41, 0x01, 0x0F, 0x23, 0x01, 0x0F, 0x06, 0x0F, 0x13, 0x02, 0x0F, 0x23, 0x01, 0x17, 0x29, 0x02, 0x26, 0x29, 0x02, 0x27, 0x27, 0x03, 0x28, 0x25, 0x04, 0x28,
+	0x24, 0x05, 0x29, 0x22, 0x06, 0x4A, 0x07, 0x3A, 0x08, 0x59, 0x07, 0x37, 0x32, 0x06, 0x54, 0x34, 0x05, 0x33, 0x38, 0x04, 0x13, 0x3B, 0x03, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x2A, 0x09, 0x24, 0x24,
+	0x09, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x03, 0x00, 0x24, 0x24, 0x34, 0x02, 0x24, 0x24, 0x25, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x25, 0x02, 0x2A, 0x09, 0x0F, 0x06, 0x00, 0x2B, 0x08, 0x1B,
+	0x09, 0x00, 0x16, 0x23, 0x09, 0x66, 0x09, 0x78, 0x06, 0x1A, 0x61, 0x03, 0x1A, 0x55, 0x29, 0x28, 0x29, 0x13, 0x06, 0x19, 0x23, 0x06, 0x19, 0x22, 0x07, 0x49, 0x08, 0x38, 0x0A, 0x19, 0x0B, 0x28,
+	0x0B, 0x18, 0x0C, 0x00, 0x27, 0x0C, 0x22, 0x23, 0x0C, 0x72, 0x0C, 0x75, 0x09, 0x17, 0x71, 0x05, 0x26, 0x74, 0x02, 0x26, 0x48, 0x01, 0x26, 0x1B, 0x01, 0x16, 0x14, 0x09, 0x16, 0x33, 0x08, 0x25,
+	0x32, 0x09, 0x25, 0x31, 0x0A, 0x45, 0x0C, 0x35, 0x0D, 0x15, 0x0F, 0x0F, 0x06, 0x00, 0x0F, 0x22, 0x02, 0x00, 0x28, 0x27, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x02, 0x78, 0x22,
+	0x02, 0x0F, 0x22, 0x02, 0x00, 0x00, 0x0F, 0x06, 0x0F, 0x21, 0x03, 0x00, 0x25, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x83, 0x03, 0xA5, 0x21, 0x03, 0x45, 0x27,
+	0x03, 0x0F, 0x21, 0x03, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x27, 0x29, 0x01, 0x27, 0x23, 0x24, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x24,
+	0x24, 0x25, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x10, 0x01, 0x00, 0x0F, 0x06, 0x00, 0x28, 0x0B, 0x00, 0x23, 0x23, 0x0B, 0x23, 0x23, 0x18, 0x02, 0x23,
+	0x23, 0x28, 0x01, 0x00, 0x23, 0x23, 0x27, 0x02, 0x00, 0x23, 0x23, 0x26, 0x03, 0x23, 0x23, 0x35, 0x03, 0x23, 0x23, 0x34, 0x04, 0x23, 0x23, 0x33, 0x05, 0x23, 0x23, 0x31, 0x07, 0x23, 0x53, 0x08,
+	0x28, 0x0B, 0x0F, 0x06, 0x00, 0x00, 0x00, 0xA3, 0x08, 0x00, 0x0F, 0x06, 0x0F, 0x13, 0x02, 0x0F, 0x23, 0x01, 0x0F, 0x22, 0x02, 0x00, 0x0F, 0x21, 0x03, 0x3E, 0x04, 0xD3, 0x05, 0xA3, 0x08, 0x0F,
+	0x06, 0x0F, 0x12, 0x03, 0x0F, 0x31, 0x02, 0x3F, 0x03, 0x5C, 0x04, 0xC3, 0x06, 0x93, 0x09, 0x0F, 0x06, 0x00, 0x00, 0xF3, 0x10, 0x02, 0x00, 0x0F, 0x21, 0x03, 0x00, 0x2F, 0x04, 0x2E, 0x05, 0x2D,
+	0x06, 0x2C, 0x07, 0x2B, 0x08, 0x0F, 0x06, 0x00, 0x00, 0x00, 0xF3, 0x03, 0xF3, 0x10, 0x02, 0x0F, 0x12, 0x03, 0x0F, 0x21, 0x03, 0x00, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x1F, 0x05, 0x2E, 0x05, 0x2D,
+	0x06, 0x00, 0x2C, 0x07, 0x2B, 0x08, 0x2A, 0x09, 0x0F, 0x06, 0x00, 0xF4, 0x02, 0x00, 0x24, 0x2A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x02, 0x00, 0x0F, 0x06,
+	0x00, 0x00, 0x68, 0x07, 0x00, 0x28, 0x0B, 0x28, 0x1A, 0x28, 0x29, 0x00, 0x28, 0x19, 0x01, 0x28, 0x28, 0x01, 0x28, 0x27, 0x02, 0x28, 0x26, 0x03, 0x28, 0x34, 0x04, 0x88, 0x05, 0x68, 0x07, 0x19,
+	0x0B, 0x0F, 0x06, 0x00, 0x84, 0x09, 0x00, 0x24, 0x0F, 0x00, 0x24, 0x1C, 0x02, 0x24, 0x2C, 0x01, 0x24, 0x2B, 0x02, 0x00, 0x24, 0x2A, 0x03, 0x24, 0x39, 0x03, 0x24, 0x38, 0x04, 0x24, 0x37, 0x05,
+	0x24, 0x45, 0x06, 0x24, 0x61, 0x08, 0x74, 0x0A, 0x15, 0x0F, 0x0F, 0x06, 0x26, 0x26, 0x05, 0x00, 0x00, 0x00, 0xA6, 0x05, 0x00, 0x26, 0x26, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x20, 0x01, 0x00,
+	0x26, 0x26, 0x05, 0x00, 0x00, 0x00, 0x2E, 0x05, 0x0F, 0x21, 0x03, 0x00, 0x24, 0x2A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xA2, 0x03, 0x00, 0x24, 0x2A, 0x03, 0x00, 0x24, 0x23, 0x25, 0x03,
+	0x24, 0x32, 0x25, 0x03, 0x24, 0x31, 0x26, 0x03, 0x54, 0x27, 0x03, 0x34, 0x29, 0x03, 0x24, 0x2A, 0x03, 0x0F, 0x06, 0x00, 0x24, 0x0F, 0x24, 0x23, 0x0A, 0x24, 0x23, 0x17, 0x02, 0x24, 0x23, 0x27,
+	0x01, 0x24, 0x23, 0x17, 0x02, 0x24, 0x23, 0x26, 0x02, 0x00, 0x24, 0x23, 0x25, 0x03, 0x24, 0x23, 0x24, 0x04, 0x24, 0x23, 0x33, 0x04, 0x24, 0x23, 0x32, 0x05, 0x24, 0x53, 0x07, 0x24, 0x61, 0x08,
+	0x74, 0x0A, 0x25, 0x0E, 0x0F, 0x06, 0x00, 0x0F, 0x13, 0x02, 0x24, 0x2C, 0x01, 0x25, 0x2B, 0x01, 0x35, 0x29, 0x02, 0x36, 0x28, 0x02, 0x37, 0x27, 0x02, 0x18, 0x27, 0x03, 0x0F, 0x21, 0x03, 0x2F,
+	0x04, 0x2E, 0x05, 0x3D, 0x05, 0x3C, 0x06, 0x3B, 0x07, 0x3A, 0x08, 0x38, 0x0A, 0x37, 0x0B, 0x0F, 0x06, 0x76, 0x08, 0x00, 0x26, 0x0D, 0x00, 0x26, 0x1B, 0x01, 0x00, 0x26, 0x2A, 0x01, 0x62, 0x2A,
+	0x01, 0x62, 0x29, 0x02, 0x26, 0x29, 0x02, 0x26, 0x28, 0x03, 0x26, 0x27, 0x04, 0x26, 0x35, 0x05, 0x22, 0x22, 0x43, 0x06, 0x23, 0x71, 0x08, 0x11, 0x12, 0x41, 0x0B, 0x31, 0x0F, 0x02, 0x23, 0x0F,
+	0x01, 0x0F, 0x06, 0x00, 0x00, 0x29, 0x27, 0x01, 0x29, 0x36, 0x01, 0x29, 0x35, 0x02, 0x29, 0x34, 0x03, 0x29, 0x51, 0x04, 0x96, 0x06, 0x66, 0x09, 0x29, 0x27, 0x01, 0x00, 0x00, 0x29, 0x36, 0x01,
+	0xA9, 0x02, 0x79, 0x05, 0x0F, 0x06, 0x1D, 0x07, 0x3C, 0x06, 0x3B, 0x07, 0x39, 0x09, 0x56, 0x18, 0x01, 0x26, 0x21, 0x37, 0x29, 0x27, 0x01, 0x29, 0x35, 0x02, 0x29, 0x43, 0x03, 0x79, 0x05, 0x59,
+	0x07, 0x29, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x85, 0x08, 0x00, 0x25, 0x0E, 0x00, 0x25, 0x1C, 0x01, 0x25, 0x2C, 0x25, 0x2B, 0x01, 0x00, 0x25, 0x2A, 0x02, 0x25, 0x39, 0x02, 0x25, 0x38,
+	0x03, 0x25, 0x37, 0x04, 0x12, 0x22, 0x45, 0x05, 0x52, 0x61, 0x07, 0x13, 0x71, 0x09, 0x21, 0x13, 0x0E, 0x22, 0x0F, 0x02, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x26, 0x26, 0x05, 0x00, 0x00, 0x00, 0xA6,
+	0x05, 0x00, 0x26, 0x26, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x20, 0x01, 0x00, 0x26, 0x26, 0x05, 0x12, 0x23, 0x26, 0x05, 0x23, 0x21, 0x26, 0x05, 0x11, 0x24, 0x26, 0x05, 0x41, 0x29, 0x05, 0x0F,
+	0x22, 0x02, 0x00, 0x25, 0x2A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xA2, 0x02, 0x00, 0x25, 0x2A, 0x02, 0x00, 0x25, 0x23, 0x25, 0x02, 0x25, 0x32, 0x25, 0x02, 0x22, 0x21, 0x31, 0x26, 0x02,
+	0x63, 0x28, 0x02, 0x11, 0x33, 0x29, 0x02, 0x31, 0x21, 0x2A, 0x02, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x00, 0x24, 0x0F, 0x24, 0x24, 0x09, 0x24, 0x24, 0x17, 0x01, 0x24, 0x24, 0x27, 0x24, 0x24, 0x17,
+	0x01, 0x24, 0x24, 0x26, 0x01, 0x00, 0x24, 0x24, 0x25, 0x02, 0x24, 0x24, 0x24, 0x03, 0x24, 0x24, 0x33, 0x03, 0x24, 0x24, 0x32, 0x04, 0x24, 0x54, 0x06, 0x21, 0x21, 0x62, 0x07, 0x92, 0x0A, 0x10,
+	0x33, 0x0E, 0x30, 0x0F, 0x03, 0x12, 0x0F, 0x03, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0A, 0x49, 0x08, 0x2A, 0x09, 0x1A, 0x0A, 0x0F, 0x06, 0x2A, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x27, 0x0C, 0x28, 0x0B, 0x29, 0x0A, 0x2A, 0x09, 0x2B, 0x08, 0x3C, 0x06,
+	0x3D, 0x05, 0x3E, 0x04, 0x1F, 0x05, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x37, 0x0B, 0x38, 0x0A, 0x39, 0x09, 0x3A, 0x08, 0x15, 0x35, 0x07, 0x25, 0x35, 0x06, 0x27, 0x35, 0x04, 0x14,
+	0x1A, 0x05, 0x35, 0x0D, 0x16, 0x0E, 0x0F, 0x06, 0x00, 0x00, 0x23, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x30, 0x00,
+};
+
+#else
+
+extern const uint8_t glcd19x21_packed[] =
+{
+	19,			// character width in pixels
+	21,			// row height in pixels
+	2,			// space columns between characters before kerning
+	3,			// font format: sparse packed
+	0x20, 0x00,	// lowest character code (2 bytes, little endian)
+	0x7E, 0x01,	// highest character code (2 bytes, little endian)
+
+	// Number of ranges, then the first code, last code and first glyph of each range (2 bytes each, little endian)
+	0x01, 0x00,
+	0x20, 0x00, 0x7E, 0x01, 0x00, 0x00,
+
+	// Number of edge columns (2 bytes, little endian), then the edge columns
+	0xA5, 0x00,
+	0x00, 0x00, 0x00, 0xF8, 0x9F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3E, 0x00, 0x0C, 0x00, 0x18, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x09,
+	0x00, 0x80, 0x07, 0x00, 0x18, 0x00, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x60, 0x00, 0x01, 0x40, 0x80, 0x01, 0xC0, 0x00, 0x01,
+	0x60, 0x60, 0x00, 0x60, 0x78, 0x00, 0x80, 0x63, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x1F, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0xE0, 0x78, 0x00,
+	0xE0, 0x43, 0x00, 0xC0, 0x1F, 0x00, 0xC0, 0x80, 0x01, 0xC0, 0x80, 0x09, 0xC0, 0x80, 0x07, 0x00, 0x07, 0x00, 0x30, 0x60, 0x00, 0x80, 0x10, 0x00,
+	0x60, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFF, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x78, 0x00, 0x08, 0x00, 0x01, 0x08, 0x04, 0x00, 0x60, 0x7C, 0x00,
+	0xF8, 0x7F, 0x00, 0x00, 0x60, 0x00, 0xF8, 0x0F, 0x00, 0x78, 0x00, 0x00, 0x08, 0x80, 0x01, 0xFC, 0xFF, 0x1F, 0x04, 0x00, 0x10, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF1, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x7F, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x3F, 0x00,
+	0x00, 0x4E, 0x00, 0x40, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x7F, 0x04, 0xC0, 0xFF, 0x03, 0x00, 0xFF, 0x01, 0xCC, 0xFF, 0x01, 0xCC, 0xFF, 0x0F,
+	0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x80, 0xC3, 0x00, 0x80, 0xF1, 0x00, 0x40, 0x00, 0x01, 0xC0, 0x7F, 0x00, 0x00, 0x08, 0x00,
+	0xFC, 0xFF, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x60, 0x00, 0x18, 0x00, 0x03, 0xC0, 0xFC, 0x0F, 0x00, 0x06, 0x00, 0xC0, 0x38, 0x00,
+	0x00, 0x82, 0x01, 0x00, 0x40, 0x00, 0x00, 0x0E, 0x00, 0xFC, 0xE3, 0x1F, 0x10, 0x86, 0x01, 0x00, 0x0F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x1C, 0x00,
+	0x80, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01, 0xF0, 0x08, 0x00, 0x10, 0x0C, 0x00, 0x70, 0x07, 0x00, 0xF0, 0x01, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x18, 0x10, 0x08, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFA, 0xFF, 0x01, 0x03, 0x00, 0x00, 0x60, 0x30, 0x00,
+	0x80, 0x1F, 0x01, 0x88, 0x1F, 0x00, 0x80, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF9, 0x00, 0xD0, 0xFF, 0x01, 0x00, 0x1C, 0x01, 0x40, 0x1C, 0x00,
+	0x00, 0xF2, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1F, 0x00, 0x00, 0xC3, 0x00, 0x20, 0xC3, 0x00, 0x08, 0xC3, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x01,
+	0x10, 0x00, 0x11, 0x00, 0x7E, 0x04, 0x80, 0xFF, 0x03, 0xF0, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x30, 0x00, 0x00, 0x98, 0xFF, 0x1F, 0xF6, 0xFF, 0x01,
+	0x80, 0xFF, 0x01, 0xF0, 0x1F, 0x00, 0x98, 0xFF, 0x01, 0x98, 0xFF, 0x0F, 0xF4, 0x1F, 0x00, 0x30, 0x00, 0x10, 0xF8, 0xFF, 0x15, 0xF8, 0xFF, 0x0D,
+	0xB0, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xFE, 0x0F, 0x08, 0x7E, 0x00, 0x80, 0x00, 0x01, 0x88, 0x01, 0x00, 0x80, 0xFF, 0x15, 0x80, 0x01, 0x00,
+	0x88, 0xFF, 0x01, 0x40, 0x70, 0x00, 0x00, 0xC7, 0x00, 0x00, 0xF3, 0x00, 0x80, 0x00, 0x1D, 0x80, 0x08, 0x00, 0x80, 0x08, 0x01, 0x80, 0xFF, 0x00,
+	0x80, 0xFF, 0x11, 0x10, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x01, 0x01, 0x88, 0x01, 0x01,
+
+	// Width, leading edge and trailing edge of each glyph
+	0x07, 0x00, 0x00, 0x02, 0x01, 0x01, 0x05, 0x02, 0x02, 0x0C, 0x03, 0x04, 0x0C, 0x05, 0x06, 0x11, 0x07, 0x08, 0x0D, 0x09, 0x0A, 0x02, 0x02, 0x02, 0x05, 0x0B, 0x0C, 0x06, 0x0C, 0x0B,
+	0x06, 0x0D, 0x0D, 0x0A, 0x0E, 0x0E, 0x02, 0x0F, 0x10, 0x05, 0x11, 0x11, 0x02, 0x12, 0x12, 0x06, 0x12, 0x13, 0x0A, 0x14, 0x14, 0x09, 0x15, 0x0A, 0x0A, 0x16, 0x17, 0x0A, 0x18, 0x19,
+	0x0B, 0x03, 0x03, 0x0A, 0x1A, 0x1B, 0x0A, 0x1C, 0x1B, 0x0A, 0x1D, 0x1E, 0x0A, 0x1F, 0x1F, 0x0A, 0x20, 0x21, 0x02, 0x22, 0x22, 0x02, 0x23, 0x24, 0x0A, 0x25, 0x26, 0x0A, 0x27, 0x27,
+	0x0A, 0x26, 0x25, 0x0A, 0x28, 0x29, 0x11, 0x2A, 0x21, 0x0D, 0x0A, 0x0A, 0x0B, 0x2B, 0x2C, 0x0D, 0x1C, 0x18, 0x0C, 0x2B, 0x1C, 0x0B, 0x2B, 0x2D, 0x0A, 0x2B, 0x2E, 0x0D, 0x1C, 0x2F,
+	0x0A, 0x2B, 0x2B, 0x02, 0x2B, 0x2B, 0x09, 0x05, 0x30, 0x0B, 0x2B, 0x0A, 0x09, 0x2B, 0x0A, 0x0D, 0x2B, 0x2B, 0x0A, 0x2B, 0x2B, 0x0E, 0x1C, 0x1C, 0x0B, 0x2B, 0x29, 0x0E, 0x1C, 0x1C,
+	0x0C, 0x2B, 0x0A, 0x0C, 0x31, 0x2C, 0x0C, 0x1D, 0x1D, 0x0C, 0x32, 0x32, 0x0D, 0x1D, 0x1D, 0x13, 0x33, 0x33, 0x0C, 0x2D, 0x2D, 0x0C, 0x1E, 0x1E, 0x0B, 0x34, 0x2D, 0x04, 0x35, 0x36,
+	0x06, 0x13, 0x12, 0x04, 0x36, 0x35, 0x08, 0x37, 0x37, 0x0C, 0x38, 0x38, 0x04, 0x39, 0x3A, 0x0B, 0x3B, 0x0A, 0x09, 0x3C, 0x3D, 0x09, 0x0B, 0x3E, 0x09, 0x3D, 0x3C, 0x0A, 0x3F, 0x40,
+	0x06, 0x41, 0x42, 0x09, 0x43, 0x44, 0x09, 0x3C, 0x45, 0x02, 0x46, 0x46, 0x03, 0x38, 0x47, 0x09, 0x3C, 0x0A, 0x02, 0x3C, 0x3C, 0x0E, 0x48, 0x45, 0x09, 0x48, 0x45, 0x0A, 0x3D, 0x3D,
+	0x09, 0x49, 0x3D, 0x09, 0x3D, 0x49, 0x06, 0x48, 0x4A, 0x09, 0x4B, 0x4C, 0x06, 0x41, 0x4D, 0x09, 0x4E, 0x48, 0x0B, 0x41, 0x41, 0x0F, 0x4A, 0x4A, 0x08, 0x22, 0x22, 0x0B, 0x41, 0x41,
+	0x07, 0x16, 0x17, 0x07, 0x4F, 0x36, 0x02, 0x35, 0x35, 0x07, 0x36, 0x4F, 0x0A, 0x0E, 0x0E, 0x05, 0x50, 0x50, 0x02, 0x00, 0x00, 0x13, 0x51, 0x51, 0x0A, 0x28, 0x28, 0x13, 0x51, 0x51,
+	0x0A, 0x52, 0x52, 0x0A, 0x53, 0x53, 0x0A, 0x54, 0x54, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x55, 0x55,
+	0x09, 0x56, 0x57, 0x0B, 0x58, 0x59, 0x0A, 0x37, 0x5A, 0x0C, 0x1D, 0x1D, 0x02, 0x5B, 0x5B, 0x0A, 0x0A, 0x5C, 0x06, 0x13, 0x13, 0x0F, 0x5D, 0x5D, 0x07, 0x5E, 0x37, 0x0A, 0x5F, 0x60,
+	0x0A, 0x0E, 0x61, 0x05, 0x11, 0x11, 0x0F, 0x5D, 0x5D, 0x0C, 0x62, 0x62, 0x06, 0x28, 0x28, 0x0A, 0x63, 0x63, 0x06, 0x4F, 0x64, 0x05, 0x65, 0x66, 0x04, 0x3A, 0x39, 0x0A, 0x49, 0x0A,
+	0x09, 0x67, 0x1D, 0x02, 0x56, 0x56, 0x03, 0x68, 0x69, 0x06, 0x6A, 0x4F, 0x08, 0x29, 0x29, 0x0A, 0x60, 0x5F, 0x10, 0x6A, 0x59, 0x10, 0x6A, 0x0A, 0x10, 0x65, 0x59, 0x0A, 0x12, 0x6B,
+	0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x0D, 0x0A, 0x0A, 0x13, 0x12, 0x2D, 0x0D, 0x1C, 0x18, 0x0B, 0x2B, 0x2D, 0x0B, 0x2B, 0x2D,
+	0x0B, 0x2B, 0x2D, 0x0B, 0x2B, 0x2D, 0x03, 0x6C, 0x6D, 0x03, 0x6D, 0x6C, 0x05, 0x62, 0x62, 0x07, 0x6E, 0x6E, 0x0E, 0x0E, 0x1C, 0x0A, 0x2B, 0x2B, 0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C,
+	0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C, 0x0E, 0x1C, 0x1C, 0x08, 0x6F, 0x6F, 0x0E, 0x70, 0x71, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x32, 0x32, 0x0C, 0x1E, 0x1E,
+	0x0B, 0x2B, 0x72, 0x0B, 0x48, 0x73, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x0B, 0x3B, 0x0A, 0x11, 0x74, 0x40, 0x09, 0x0B, 0x3E,
+	0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x0A, 0x3F, 0x40, 0x04, 0x39, 0x75, 0x04, 0x75, 0x39, 0x07, 0x3A, 0x3A, 0x06, 0x13, 0x13, 0x0A, 0x61, 0x3D, 0x09, 0x48, 0x45,
+	0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x3D, 0x3D, 0x0A, 0x0E, 0x0E, 0x0A, 0x76, 0x77, 0x09, 0x4E, 0x48, 0x09, 0x4E, 0x48, 0x09, 0x4E, 0x48,
+	0x09, 0x4E, 0x48, 0x0B, 0x41, 0x41, 0x0A, 0x35, 0x3D, 0x0B, 0x41, 0x41, 0x0D, 0x0A, 0x0A, 0x0A, 0x78, 0x0A, 0x0D, 0x0A, 0x0A, 0x0A, 0x78, 0x0A, 0x0D, 0x0A, 0x79, 0x0A, 0x78, 0x79,
+	0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7B, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7C, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7B, 0x0D, 0x7A, 0x53, 0x09, 0x61, 0x7D, 0x0D, 0x00, 0x1C, 0x0D, 0x61, 0x7E,
+	0x0D, 0x37, 0x1C, 0x0B, 0x61, 0x0D, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0C, 0x00, 0x80, 0x0A, 0x61, 0x40,
+	0x0C, 0x00, 0x7F, 0x0A, 0x61, 0x40, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82, 0x0E, 0x1C, 0x1B, 0x0A, 0x81, 0x82,
+	0x0C, 0x83, 0x83, 0x09, 0x2B, 0x45, 0x0D, 0x41, 0x41, 0x09, 0x3A, 0x45, 0x06, 0x84, 0x84, 0x06, 0x85, 0x85, 0x05, 0x39, 0x39, 0x05, 0x0D, 0x0D, 0x06, 0x6E, 0x6E, 0x06, 0x1E, 0x1E,
+	0x05, 0x00, 0x38, 0x04, 0x86, 0x38, 0x04, 0x00, 0x87, 0x04, 0x00, 0x88, 0x0D, 0x00, 0x89, 0x07, 0x8A, 0x8B, 0x09, 0x05, 0x8C, 0x05, 0x8D, 0x0D, 0x0C, 0x00, 0x7F, 0x09, 0x2B, 0x0A,
+	0x0A, 0x88, 0x0A, 0x0A, 0x00, 0x0A, 0x04, 0x6D, 0x6C, 0x0A, 0x00, 0x0A, 0x03, 0x8E, 0x8F, 0x0A, 0x00, 0x0A, 0x06, 0x2B, 0x7E, 0x0A, 0x00, 0x0A, 0x06, 0x2B, 0x56, 0x0A, 0x11, 0x0A,
+	0x04, 0x11, 0x56, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0C, 0x83, 0x83, 0x09, 0x88, 0x45, 0x0A, 0x90, 0x45, 0x0D, 0x00, 0x91, 0x0A, 0x88, 0x92,
+	0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x61, 0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x61, 0x0E, 0x91, 0x1C, 0x0A, 0x61, 0x93, 0x12, 0x91, 0x7F, 0x11, 0x61, 0x40, 0x0D, 0x00, 0x94, 0x06, 0x88, 0x95,
+	0x0D, 0x00, 0x94, 0x06, 0x96, 0x97, 0x0D, 0x00, 0x94, 0x07, 0x98, 0x1D, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B,
+	0x0C, 0x59, 0x99, 0x09, 0x9A, 0x9B, 0x0C, 0x3A, 0x3A, 0x05, 0x04, 0x9C, 0x0C, 0x3A, 0x3A, 0x07, 0x04, 0x7E, 0x0C, 0x3A, 0x3A, 0x05, 0x9D, 0x9E, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88,
+	0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0x88, 0x0C, 0x89, 0x89, 0x0A, 0x9F, 0x1D, 0x0C, 0x89, 0x89, 0x09, 0x9F, 0xA0,
+	0x13, 0x3A, 0x3A, 0x0D, 0x97, 0x97, 0x0B, 0x85, 0x85, 0x09, 0x04, 0x04, 0x0B, 0x85, 0x85, 0x0B, 0xA1, 0x7F, 0x08, 0xA2, 0xA3, 0x0B, 0xA1, 0x7F, 0x08, 0xA2, 0xA3, 0x0B, 0xA1, 0x7F,
+	0x08, 0xA2, 0xA4,
+
+	// Glyph offsets (2 bytes each, little endian)
+	0x00, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x15, 0x00, 0x33, 0x00, 0x58, 0x00, 0x88, 0x00, 0xB2, 0x00, 0xB5, 0x00, 0xC1, 0x00, 0xCF, 0x00, 0xDC, 0x00, 0xE9, 0x00, 0xEE, 0x00, 0xF4, 0x00, 0xF7, 0x00,
+	0x04, 0x01, 0x18, 0x01, 0x2A, 0x01, 0x4E, 0x01, 0x69, 0x01, 0x83, 0x01, 0x9D, 0x01, 0xB8, 0x01, 0xD1, 0x01, 0xEE, 0x01, 0x0A, 0x02, 0x0E, 0x02, 0x15, 0x02, 0x2E, 0x02, 0x3A, 0x02, 0x53, 0x02,
+	0x6F, 0x02, 0xAF, 0x02, 0xD0, 0x02, 0xE8, 0x02, 0x07, 0x03, 0x1E, 0x03, 0x2F, 0x03, 0x3C, 0x03, 0x61, 0x03, 0x6E, 0x03, 0x71, 0x03, 0x85, 0x03, 0xA0, 0x03, 0xAC, 0x03, 0xC8, 0x03, 0xDC, 0x03,
+	0xFC, 0x03, 0x0E, 0x04, 0x33, 0x04, 0x4F, 0x04, 0x72, 0x04, 0x83, 0x04, 0x99, 0x04, 0xB5, 0x04, 0xDC, 0x04, 0xFE, 0x04, 0x17, 0x05, 0x3E, 0x05, 0x45, 0x05, 0x52, 0x05, 0x59, 0x05, 0x68, 0x05,
+	0x75, 0x05, 0x7F, 0x05, 0x9B, 0x05, 0xAD, 0x05, 0xBE, 0x05, 0xD0, 0x05, 0xE9, 0x05, 0xF4, 0x05, 0x0B, 0x06, 0x1A, 0x06, 0x1E, 0x06, 0x25, 0x06, 0x3A, 0x06, 0x3D, 0x06, 0x55, 0x06, 0x64, 0x06,
+	0x78, 0x06, 0x89, 0x06, 0x9A, 0x06, 0xA3, 0x06, 0xBD, 0x06, 0xC7, 0x06, 0xD7, 0x06, 0xED, 0x06, 0x0B, 0x07, 0x20, 0x07, 0x37, 0x07, 0x4E, 0x07, 0x5D, 0x07, 0x60, 0x07, 0x6F, 0x07, 0x7E, 0x07,
+	0x87, 0x07, 0x8A, 0x07, 0xA8, 0x07, 0xBE, 0x07, 0xDC, 0x07, 0xF2, 0x07, 0x0E, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08,
+	0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08,
+	0x2A, 0x08, 0x2C, 0x08, 0x30, 0x08, 0x49, 0x08, 0x67, 0x08, 0x7B, 0x08, 0xA2, 0x08, 0xA5, 0x08, 0xCE, 0x08, 0xD9, 0x08, 0x09, 0x09, 0x1B, 0x09, 0x35, 0x09, 0xEE, 0x00, 0x41, 0x09, 0x71, 0x09,
+	0x7F, 0x09, 0x8D, 0x09, 0x9D, 0x09, 0xB1, 0x09, 0xC2, 0x09, 0xCE, 0x09, 0xE0, 0x09, 0xF3, 0x09, 0xF6, 0x09, 0xFE, 0x09, 0x0A, 0x0A, 0x1A, 0x0A, 0x34, 0x0A, 0x5D, 0x0A, 0x8E, 0x0A, 0xBC, 0x0A,
+	0xDA, 0x0A, 0xFE, 0x0A, 0x22, 0x0B, 0x48, 0x0B, 0x70, 0x0B, 0x95, 0x0B, 0xB9, 0x0B, 0xDE, 0x0B, 0x04, 0x0C, 0x20, 0x0C, 0x3C, 0x0C, 0x64, 0x0C, 0x80, 0x0C, 0x89, 0x0C, 0x92, 0x0C, 0xA1, 0x0C,
+	0xAE, 0x0C, 0xCB, 0x0C, 0xE6, 0x0C, 0x0C, 0x0D, 0x32, 0x0D, 0x5D, 0x0D, 0x87, 0x0D, 0xAD, 0x0D, 0xC2, 0x0D, 0xF0, 0x0D, 0x0A, 0x0E, 0x24, 0x0E, 0x41, 0x0E, 0x5C, 0x0E, 0x79, 0x0E, 0x8B, 0x0E,
+	0xAD, 0x0E, 0xD3, 0x0E, 0xF9, 0x0E, 0x22, 0x0F, 0x47, 0x0F, 0x6A, 0x0F, 0x8D, 0x0F, 0xBD, 0x0F, 0xD5, 0x0F, 0xF7, 0x0F, 0x1D, 0x10, 0x46, 0x10, 0x69, 0x10, 0x75, 0x10, 0x81, 0x10, 0x96, 0x10,
+	0xA1, 0x10, 0xC1, 0x10, 0xDA, 0x10, 0xF8, 0x10, 0x16, 0x11, 0x37, 0x11, 0x55, 0x11, 0x71, 0x11, 0x80, 0x11, 0xA0, 0x11, 0xB5, 0x11, 0xCA, 0x11, 0xE3, 0x11, 0xF8, 0x11, 0x13, 0x12, 0x28, 0x12,
+	0x43, 0x12, 0x69, 0x12, 0x86, 0x12, 0xAC, 0x12, 0xCD, 0x12, 0xEE, 0x12, 0x07, 0x13, 0x2A, 0x13, 0x45, 0x13, 0x6C, 0x13, 0x87, 0x13, 0xA8, 0x13, 0xBF, 0x13, 0xE6, 0x13, 0x01, 0x14, 0x25, 0x14,
+	0x40, 0x14, 0x5A, 0x14, 0x74, 0x14, 0x8E, 0x14, 0xAB, 0x14, 0xCD, 0x14, 0xEA, 0x14, 0x04, 0x15, 0x22, 0x15, 0x3A, 0x15, 0x59, 0x15, 0x83, 0x15, 0xA5, 0x15, 0xD5, 0x15, 0xF3, 0x15, 0x1F, 0x16,
+	0x39, 0x16, 0x63, 0x16, 0x7D, 0x16, 0xA7, 0x16, 0xC5, 0x16, 0xDF, 0x16, 0xF5, 0x16, 0x08, 0x17, 0x1B, 0x17, 0x2D, 0x17, 0x3B, 0x17, 0x46, 0x17, 0x4F, 0x17, 0x5E, 0x17, 0x6C, 0x17, 0x75, 0x17,
+	0x7E, 0x17, 0x85, 0x17, 0x8B, 0x17, 0xA5, 0x17, 0xB4, 0x17, 0xCF, 0x17, 0xDB, 0x17, 0xFA, 0x17, 0x11, 0x18, 0x28, 0x18, 0x3C, 0x18, 0x47, 0x18, 0x5D, 0x18, 0x65, 0x18, 0x7A, 0x18, 0x86, 0x18,
+	0x98, 0x18, 0xA2, 0x18, 0xB7, 0x18, 0xBE, 0x18, 0xD8, 0x18, 0xEC, 0x18, 0x04, 0x19, 0x17, 0x19, 0x33, 0x19, 0x49, 0x19, 0x5B, 0x19, 0x76, 0x19, 0x86, 0x19, 0xA4, 0x19, 0xBC, 0x19, 0xE0, 0x19,
+	0xF8, 0x19, 0x25, 0x1A, 0x46, 0x1A, 0x67, 0x1A, 0x8F, 0x1A, 0xB3, 0x1A, 0xC1, 0x1A, 0xE3, 0x1A, 0xF0, 0x1A, 0x17, 0x1B, 0x2B, 0x1B, 0x57, 0x1B, 0x76, 0x1B, 0xA1, 0x1B, 0xC6, 0x1B, 0xEF, 0x1B,
+	0x0E, 0x1C, 0x39, 0x1C, 0x5E, 0x1C, 0x71, 0x1C, 0x7D, 0x1C, 0x9B, 0x1C, 0xAA, 0x1C, 0xBF, 0x1C, 0xCB, 0x1C, 0xE7, 0x1C, 0xFE, 0x1C, 0x17, 0x1D, 0x29, 0x1D, 0x42, 0x1D, 0x57, 0x1D, 0x72, 0x1D,
+	0x8B, 0x1D, 0xAB, 0x1D, 0xC7, 0x1D, 0xE1, 0x1D, 0xF2, 0x1D, 0x20, 0x1E, 0x41, 0x1E, 0x5B, 0x1E, 0x74, 0x1E, 0x8D, 0x1E, 0xB7, 0x1E, 0xD4, 0x1E, 0xFC, 0x1E, 0x18, 0x1F, 0x44, 0x1F,
+
+	// Glyphs
+	0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x22, 0x04, 0x00, 0x53, 0x0D, 0x00, 0x0F, 0x06, 0x33, 0x0F, 0x53, 0x0D, 0x1C, 0x08, 0x17, 0x14, 0x08, 0x17, 0x54, 0x04, 0x67, 0x08, 0x53,
+	0x14, 0x08, 0x17, 0x14, 0x08, 0x00, 0x17, 0x54, 0x04, 0x67, 0x08, 0x53, 0x14, 0x08, 0x17, 0x14, 0x08, 0x17, 0x0D, 0x1D, 0x07, 0x35, 0x35, 0x05, 0x54, 0x25, 0x05, 0x23, 0x23, 0x25, 0x04, 0x13,
+	0x15, 0x16, 0x04, 0xF1, 0x30, 0x02, 0x00, 0x13, 0x25, 0x15, 0x04, 0x23, 0x15, 0x15, 0x04, 0x24, 0x24, 0x13, 0x05, 0x15, 0x55, 0x05, 0x2C, 0x07, 0x64, 0x0B, 0x23, 0x24, 0x0A, 0x13, 0x16, 0x0A,
+	0x13, 0x16, 0x15, 0x04, 0x23, 0x24, 0x24, 0x04, 0x64, 0x33, 0x05, 0x2C, 0x07, 0x3A, 0x08, 0x29, 0x0A, 0x37, 0x0B, 0x26, 0x0D, 0x34, 0x63, 0x05, 0x23, 0x24, 0x24, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x19, 0x16, 0x04, 0x29, 0x24, 0x04, 0x6A, 0x05, 0x5B, 0x05, 0x3A, 0x21, 0x05, 0x25, 0x22, 0x24, 0x04, 0x64, 0x16, 0x04, 0x23, 0x33, 0x15, 0x04, 0x13, 0x14, 0x31, 0x13, 0x04, 0x13, 0x14, 0x32,
+	0x21, 0x04, 0x23, 0x12, 0x35, 0x05, 0x44, 0x35, 0x05, 0x5C, 0x04, 0x3A, 0x13, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x53, 0x0D, 0x00, 0x59, 0x07, 0xB6, 0x04, 0x44, 0x47, 0x02, 0x23, 0x2D, 0x01, 0x22,
+	0x2F, 0x0F, 0x06, 0x22, 0x2F, 0x23, 0x2D, 0x01, 0x44, 0x47, 0x02, 0xB6, 0x04, 0x59, 0x07, 0x15, 0x0F, 0x16, 0x21, 0x0B, 0x53, 0x0D, 0x00, 0x16, 0x21, 0x0B, 0x15, 0x0F, 0x19, 0x0B, 0x00, 0x00,
+	0x00, 0x95, 0x07, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x2F, 0x12, 0x01, 0x4F, 0x02, 0x2B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x2F, 0x04, 0x5C, 0x04, 0x68, 0x07, 0x65, 0x0A, 0x52,
+	0x0E, 0x22, 0x0F, 0x02, 0x86, 0x07, 0xC4, 0x05, 0x14, 0x1A, 0x05, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x14, 0x1A, 0x05, 0xC4, 0x05, 0x86, 0x07, 0x25, 0x19, 0x04, 0x24, 0x1A, 0x04, 0x14, 0x1B,
+	0x04, 0xE3, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x16, 0x28, 0x04, 0x34, 0x37, 0x04, 0x14, 0x28, 0x11, 0x04, 0x13, 0x28, 0x12, 0x04, 0x13, 0x27, 0x13, 0x04, 0x13, 0x17, 0x14, 0x04,
+	0x13, 0x26, 0x14, 0x04, 0x23, 0x33, 0x15, 0x04, 0x64, 0x16, 0x04, 0x26, 0x18, 0x04, 0x25, 0x26, 0x06, 0x34, 0x36, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x23, 0x13,
+	0x11, 0x24, 0x04, 0x54, 0x61, 0x05, 0x25, 0x44, 0x06, 0x1C, 0x08, 0x3A, 0x08, 0x49, 0x08, 0x28, 0x12, 0x08, 0x27, 0x13, 0x08, 0x35, 0x14, 0x08, 0x34, 0x15, 0x08, 0x23, 0x17, 0x08, 0xE3, 0x04,
+	0x1C, 0x08, 0x00, 0x37, 0x23, 0x06, 0x73, 0x33, 0x05, 0x13, 0x15, 0x25, 0x04, 0x13, 0x14, 0x17, 0x04, 0x00, 0x00, 0x00, 0x13, 0x24, 0x25, 0x04, 0x13, 0x75, 0x05, 0x5A, 0x06, 0x67, 0x08, 0xA5,
+	0x06, 0x24, 0x13, 0x24, 0x05, 0x23, 0x13, 0x26, 0x04, 0x13, 0x14, 0x17, 0x04, 0x00, 0x00, 0x23, 0x23, 0x25, 0x04, 0x24, 0x73, 0x05, 0x5A, 0x06, 0x13, 0x0F, 0x02, 0x00, 0x00, 0x13, 0x49, 0x04,
+	0x13, 0x76, 0x04, 0x13, 0x44, 0x09, 0x13, 0x42, 0x0B, 0x13, 0x31, 0x0D, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0x35, 0x43, 0x06, 0x54, 0x61, 0x05, 0x23, 0x13, 0x11, 0x24, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x00, 0x00, 0x00, 0x23, 0x13, 0x11, 0x24, 0x04, 0x54, 0x61, 0x05, 0x35, 0x43, 0x06, 0x55, 0x14, 0x06, 0x74, 0x23, 0x05, 0x23, 0x25, 0x23, 0x04, 0x13, 0x17, 0x14, 0x04, 0x00, 0x00, 0x13, 0x17,
+	0x23, 0x04, 0x24, 0x14, 0x23, 0x05, 0xB4, 0x06, 0x76, 0x08, 0x26, 0x27, 0x04, 0x00, 0x26, 0x27, 0x12, 0x01, 0x26, 0x47, 0x02, 0x38, 0x0A, 0x18, 0x11, 0x0A, 0x27, 0x21, 0x09, 0x00, 0x26, 0x23,
+	0x08, 0x00, 0x16, 0x15, 0x08, 0x25, 0x25, 0x07, 0x15, 0x17, 0x07, 0x24, 0x27, 0x06, 0x17, 0x14, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x27, 0x06, 0x15, 0x17, 0x07,
+	0x25, 0x25, 0x07, 0x16, 0x15, 0x08, 0x26, 0x23, 0x08, 0x00, 0x27, 0x21, 0x09, 0x00, 0x18, 0x11, 0x0A, 0x38, 0x0A, 0x25, 0x0E, 0x34, 0x0E, 0x14, 0x0F, 0x01, 0x13, 0x0F, 0x02, 0x13, 0x27, 0x22,
+	0x04, 0x13, 0x36, 0x22, 0x04, 0x13, 0x25, 0x0A, 0x23, 0x14, 0x0B, 0x64, 0x0B, 0x45, 0x0C, 0x88, 0x05, 0x36, 0x36, 0x03, 0x25, 0x1A, 0x03, 0x14, 0x26, 0x15, 0x02, 0x23, 0x73, 0x23, 0x01, 0x13,
+	0x33, 0x24, 0x13, 0x01, 0x12, 0x23, 0x17, 0x13, 0x01, 0x12, 0x13, 0x18, 0x13, 0x01, 0x00, 0x12, 0x13, 0x17, 0x14, 0x01, 0x12, 0x14, 0x24, 0x15, 0x01, 0x12, 0x85, 0x12, 0x02, 0x22, 0x52, 0x14,
+	0x12, 0x02, 0x13, 0x12, 0x18, 0x21, 0x02, 0x23, 0x29, 0x05, 0x34, 0x35, 0x06, 0x76, 0x08, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x43, 0x14, 0x09, 0x23, 0x16,
+	0x09, 0x43, 0x14, 0x09, 0x55, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x16, 0x04, 0x54,
+	0x11, 0x14, 0x05, 0x44, 0x62, 0x05, 0x4B, 0x06, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x29, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x24, 0x19,
+	0x05, 0x34, 0x36, 0x05, 0x25, 0x26, 0x06, 0xE3, 0x04, 0x00, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x29, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04,
+	0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x08, 0xA5, 0x06,
+	0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13, 0x16, 0x15, 0x04, 0x00, 0x23, 0x15, 0x15, 0x04, 0x24, 0x14, 0x14, 0x05, 0x34, 0x13, 0x23, 0x05, 0x25, 0x53,
+	0x06, 0xE3, 0x04, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x00, 0xE3, 0x04, 0x00, 0x1D, 0x07, 0x3D, 0x05, 0x3E, 0x04, 0x0F, 0x11, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13, 0x2B,
+	0x04, 0xD3, 0x05, 0xC3, 0x06, 0xE3, 0x04, 0x00, 0x29, 0x0A, 0x28, 0x0B, 0x47, 0x0A, 0x26, 0x32, 0x08, 0x25, 0x34, 0x07, 0x24, 0x36, 0x06, 0x23, 0x38, 0x05, 0x13, 0x3A, 0x04, 0x0F, 0x11, 0x04,
+	0xE3, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x23, 0x0F, 0x01, 0x44, 0x0D, 0x56, 0x0A, 0x49, 0x08, 0x5B, 0x05, 0x2F, 0x04, 0x4C, 0x05, 0x59, 0x07, 0x47,
+	0x0A, 0x44, 0x0D, 0x23, 0x0F, 0x01, 0xE3, 0x04, 0xE3, 0x04, 0x33, 0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x38, 0x0A, 0x49, 0x08, 0x3B, 0x07, 0x3D, 0x05, 0x3E, 0x04, 0xE3, 0x04, 0x67, 0x08, 0xA5, 0x06,
+	0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x00, 0x13,
+	0x16, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x24, 0x0A, 0x64, 0x0B, 0x45, 0x0C, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x13,
+	0x4C, 0x01, 0x13, 0x1C, 0x21, 0x01, 0x23, 0x2A, 0x22, 0x14, 0x1A, 0x14, 0x34, 0x36, 0x14, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x00, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x00, 0x13, 0x26, 0x09, 0x13,
+	0x36, 0x08, 0x23, 0x24, 0x31, 0x06, 0x64, 0x43, 0x04, 0x64, 0x25, 0x04, 0x0F, 0x11, 0x04, 0x2D, 0x06, 0x54, 0x34, 0x05, 0x54, 0x16, 0x05, 0x23, 0x23, 0x25, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00,
+	0x13, 0x25, 0x15, 0x04, 0x00, 0x23, 0x15, 0x15, 0x04, 0x24, 0x24, 0x13, 0x05, 0x34, 0x63, 0x05, 0x4B, 0x06, 0x13, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x0F, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x2F, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x13, 0x0F, 0x02, 0x43, 0x0E, 0x54, 0x0C,
+	0x57, 0x09, 0x59, 0x07, 0x5C, 0x04, 0x2F, 0x04, 0x5C, 0x04, 0x59, 0x07, 0x57, 0x09, 0x54, 0x0C, 0x43, 0x0E, 0x13, 0x0F, 0x02, 0x43, 0x0E, 0x64, 0x0B, 0x67, 0x08, 0x6A, 0x05, 0x3E, 0x04, 0x4D,
+	0x04, 0x5A, 0x06, 0x66, 0x09, 0x63, 0x0C, 0x23, 0x0F, 0x01, 0x63, 0x0C, 0x66, 0x09, 0x5A, 0x06, 0x4D, 0x04, 0x3E, 0x04, 0x6B, 0x04, 0x77, 0x07, 0x64, 0x0B, 0x43, 0x0E, 0x13, 0x1C, 0x04, 0x23,
+	0x39, 0x04, 0x24, 0x37, 0x05, 0x35, 0x24, 0x07, 0x36, 0x31, 0x08, 0x48, 0x09, 0x38, 0x0A, 0x36, 0x31, 0x08, 0x35, 0x33, 0x07, 0x34, 0x36, 0x05, 0x23, 0x39, 0x04, 0x13, 0x1C, 0x04, 0x23, 0x0F,
+	0x01, 0x33, 0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x89, 0x04, 0x00, 0x37, 0x0B, 0x36, 0x0C, 0x34, 0x0E, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0x13, 0x2B, 0x04, 0x13, 0x3A, 0x04, 0x13, 0x38, 0x11,
+	0x04, 0x13, 0x37, 0x12, 0x04, 0x13, 0x26, 0x14, 0x04, 0x13, 0x34, 0x15, 0x04, 0x13, 0x33, 0x16, 0x04, 0x13, 0x22, 0x18, 0x04, 0x43, 0x19, 0x04, 0x33, 0x1A, 0x04, 0x13, 0x1C, 0x04, 0xF2, 0x40,
+	0x12, 0x0F, 0x12, 0x00, 0x00, 0x22, 0x0F, 0x02, 0x52, 0x0E, 0x65, 0x0A, 0x68, 0x07, 0x5C, 0x04, 0x2F, 0x04, 0x12, 0x0F, 0x12, 0x00, 0x00, 0xF2, 0x40, 0x1A, 0x0A, 0x47, 0x0A, 0x54, 0x0C, 0x33,
+	0x0F, 0x00, 0x54, 0x0C, 0x47, 0x0A, 0x1A, 0x0A, 0x0F, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0F, 0x03, 0x00, 0x22, 0x0F, 0x02, 0x14, 0x0F, 0x01, 0x18,
+	0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x00, 0x16, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0xF2, 0x04, 0x00, 0x27, 0x25,
+	0x05, 0x16, 0x19, 0x04, 0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x59, 0x07, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x00, 0x27, 0x25, 0x05, 0x00, 0x78, 0x06,
+	0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x27, 0x25, 0x05, 0xF2, 0x04, 0x00, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x16, 0x14, 0x14, 0x04, 0x00, 0x00, 0x00, 0x26,
+	0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x16, 0x0E, 0x00, 0xE3, 0x04, 0xF2, 0x04, 0x12, 0x13, 0x0E, 0x00, 0x78, 0x13, 0x02, 0x97, 0x22, 0x01, 0x26, 0x27, 0x22, 0x16, 0x19, 0x13,
+	0x00, 0x16, 0x18, 0x14, 0x27, 0x15, 0x24, 0xE6, 0x01, 0xC6, 0x03, 0xF2, 0x04, 0x00, 0x27, 0x0C, 0x16, 0x0E, 0x00, 0x00, 0x26, 0x0D, 0xA7, 0x04, 0x98, 0x04, 0x22, 0xB2, 0x04, 0x00, 0x0F, 0x15,
+	0x22, 0xF2, 0x22, 0xE2, 0x01, 0xF2, 0x04, 0x00, 0x2B, 0x08, 0x2A, 0x09, 0x59, 0x07, 0x37, 0x32, 0x06, 0x36, 0x34, 0x05, 0x16, 0x28, 0x04, 0x0F, 0x11, 0x04, 0xF2, 0x04, 0x00, 0xB6, 0x04, 0x00,
+	0x17, 0x0D, 0x16, 0x0E, 0x00, 0x00, 0xB6, 0x04, 0xA7, 0x04, 0x17, 0x0D, 0x16, 0x0E, 0x00, 0x26, 0x0D, 0xB6, 0x04, 0x98, 0x04, 0xB6, 0x04, 0x00, 0x27, 0x0C, 0x16, 0x0E, 0x00, 0x00, 0x26, 0x0D,
+	0xB6, 0x04, 0x98, 0x04, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0xF6, 0x00, 0x27, 0x25, 0x05, 0x16, 0x19, 0x04,
+	0x00, 0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x00, 0x00, 0x27, 0x25, 0x05, 0xF6, 0x00, 0xB6, 0x04, 0x00, 0x28, 0x0B, 0x26,
+	0x0D, 0x00, 0x00, 0x37, 0x24, 0x05, 0x47, 0x14, 0x05, 0x16, 0x23, 0x14, 0x04, 0x00, 0x00, 0x16, 0x14, 0x14, 0x04, 0x26, 0x23, 0x13, 0x04, 0x27, 0x52, 0x05, 0x27, 0x43, 0x05, 0x16, 0x0E, 0x00,
+	0xD4, 0x04, 0x00, 0x16, 0x19, 0x04, 0x00, 0x96, 0x06, 0xA6, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x2E, 0x05, 0xB6, 0x04, 0x00, 0x16, 0x0E, 0x46, 0x0B, 0x57, 0x09, 0x5A, 0x06, 0x4D,
+	0x04, 0x2F, 0x04, 0x5C, 0x04, 0x5A, 0x06, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0x26, 0x0D, 0x66, 0x09, 0x69, 0x06, 0x4D, 0x04, 0x3E, 0x04, 0x6A, 0x05, 0x66, 0x09, 0x26, 0x0D, 0x66, 0x09, 0x6A,
+	0x05, 0x3E, 0x04, 0x4D, 0x04, 0x69, 0x06, 0x56, 0x0A, 0x26, 0x0D, 0x26, 0x27, 0x04, 0x36, 0x35, 0x04, 0x38, 0x31, 0x06, 0x49, 0x08, 0x00, 0x38, 0x31, 0x06, 0x36, 0x35, 0x04, 0x26, 0x27, 0x04,
+	0x16, 0x0E, 0x36, 0x1B, 0x57, 0x18, 0x4A, 0x25, 0x4C, 0x31, 0x01, 0x4F, 0x02, 0x4D, 0x04, 0x4A, 0x07, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0x16, 0x28, 0x04, 0x16, 0x46, 0x04, 0x16, 0x44, 0x11,
+	0x04, 0x16, 0x42, 0x13, 0x04, 0x56, 0x15, 0x04, 0x46, 0x16, 0x04, 0x26, 0x18, 0x04, 0x1B, 0x09, 0x00, 0x29, 0x21, 0x07, 0x83, 0x81, 0x01, 0x22, 0x2F, 0x12, 0x0F, 0x12, 0x00, 0xF2, 0x40, 0x00,
+	0x12, 0x0F, 0x12, 0x00, 0x22, 0x2F, 0x83, 0x81, 0x01, 0x29, 0x21, 0x07, 0x1B, 0x09, 0x00, 0x19, 0x0B, 0x18, 0x0C, 0x00, 0x00, 0x19, 0x0B, 0x00, 0x1A, 0x0A, 0x00, 0x00, 0x19, 0x0B, 0xE2, 0x05,
+	0x12, 0x1C, 0x05, 0x00, 0x00, 0xE2, 0x05, 0x0F, 0x06, 0x00, 0x2A, 0x09, 0x49, 0x08, 0x68, 0x07, 0x87, 0x06, 0x36, 0x21, 0x31, 0x05, 0x16, 0x23, 0x13, 0x05, 0x2A, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x0E, 0x24, 0x0F, 0x33, 0x0F, 0x32, 0x0F, 0x01, 0xF1, 0x40, 0x01, 0x00, 0x32, 0x0F, 0x01, 0x33, 0x0F, 0x34, 0x0E, 0x25, 0x0E, 0x2A, 0x09,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x23, 0x13, 0x05, 0x36, 0x21, 0x31, 0x05, 0x87, 0x06, 0x68, 0x07, 0x49, 0x08, 0x2A, 0x09, 0x2E, 0x05, 0x2F, 0x04,
+	0x3F, 0x03, 0x0F, 0x31, 0x02, 0xF1, 0x40, 0x01, 0x00, 0x0F, 0x31, 0x02, 0x3F, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x26, 0x25, 0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x23, 0x2B, 0x03, 0xF2, 0x20,
+	0x02, 0x00, 0x23, 0x2B, 0x03, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x26, 0x25, 0x06, 0x23, 0x2B, 0x03, 0x24, 0x29, 0x04, 0x25, 0x27, 0x05, 0x26, 0x25, 0x06, 0x81, 0x83, 0x01, 0x00, 0x26, 0x25,
+	0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x23, 0x2B, 0x03, 0x0F, 0x06, 0x26, 0xA2, 0x01, 0x00, 0x29, 0x0A, 0x86, 0x07, 0x26, 0x24, 0x07, 0x15, 0x27, 0x06, 0x15, 0x18, 0x06, 0x33, 0x38, 0x04,
+	0x15, 0x18, 0x06, 0x25, 0x26, 0x06, 0x26, 0x33, 0x07, 0x19, 0x25, 0x04, 0x19, 0x43, 0x04, 0xB4, 0x11, 0x04, 0x33, 0x13, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x23, 0x14, 0x16, 0x04,
+	0x24, 0x29, 0x04, 0x2E, 0x05, 0x1E, 0x06, 0x1A, 0x0A, 0x96, 0x06, 0x27, 0x23, 0x07, 0x16, 0x17, 0x06, 0x00, 0x00, 0x00, 0x27, 0x23, 0x07, 0x96, 0x06, 0x39, 0x09, 0x13, 0x0F, 0x02, 0x23, 0x15,
+	0x12, 0x07, 0x34, 0x13, 0x12, 0x07, 0x45, 0x11, 0x12, 0x07, 0x47, 0x12, 0x07, 0x89, 0x04, 0x00, 0x47, 0x12, 0x07, 0x35, 0x12, 0x12, 0x07, 0x34, 0x13, 0x12, 0x07, 0x23, 0x15, 0x12, 0x07, 0x13,
+	0x0F, 0x02, 0x82, 0x83, 0x00, 0x0F, 0x11, 0x04, 0x43, 0x41, 0x24, 0x03, 0x52, 0x11, 0x22, 0x24, 0x02, 0x12, 0x23, 0x14, 0x15, 0x02, 0x12, 0x14, 0x14, 0x15, 0x02, 0x00, 0x12, 0x24, 0x23, 0x14,
+	0x02, 0x22, 0x23, 0x23, 0x23, 0x02, 0x23, 0x53, 0x41, 0x03, 0x14, 0x24, 0x24, 0x04, 0x22, 0x0F, 0x02, 0x00, 0x0F, 0x06, 0x00, 0x22, 0x0F, 0x02, 0x00, 0x48, 0x09, 0x26, 0x24, 0x07, 0x15, 0x18,
+	0x06, 0x14, 0x1A, 0x05, 0x14, 0x62, 0x12, 0x05, 0x13, 0x22, 0x24, 0x12, 0x04, 0x13, 0x12, 0x16, 0x12, 0x04, 0x00, 0x00, 0x13, 0x22, 0x24, 0x12, 0x04, 0x14, 0x12, 0x14, 0x12, 0x05, 0x14, 0x1A,
+	0x05, 0x15, 0x18, 0x06, 0x26, 0x24, 0x07, 0x48, 0x09, 0x37, 0x0B, 0x23, 0x51, 0x0A, 0x13, 0x12, 0x13, 0x0A, 0x00, 0x23, 0x11, 0x12, 0x0B, 0x74, 0x0A, 0x1A, 0x0A, 0x3A, 0x08, 0x59, 0x07, 0x28,
+	0x23, 0x06, 0x27, 0x25, 0x05, 0x17, 0x17, 0x05, 0x3A, 0x08, 0x59, 0x07, 0x28, 0x23, 0x06, 0x27, 0x25, 0x05, 0x17, 0x17, 0x05, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x06,
+	0x00, 0x48, 0x09, 0x26, 0x24, 0x07, 0x15, 0x18, 0x06, 0x14, 0x1A, 0x05, 0x00, 0x13, 0x82, 0x12, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x00, 0x13, 0x12, 0x33, 0x13, 0x04, 0x13, 0x52, 0x21, 0x12,
+	0x04, 0x14, 0x13, 0x14, 0x11, 0x05, 0x14, 0x1A, 0x05, 0x15, 0x18, 0x06, 0x26, 0x24, 0x07, 0x48, 0x09, 0x11, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+	0x0E, 0x23, 0x22, 0x0C, 0x13, 0x14, 0x0C, 0x00, 0x23, 0x22, 0x0C, 0x25, 0x0E, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x95, 0x12, 0x04, 0x00, 0x19, 0x16, 0x04, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x24,
+	0x24, 0x09, 0x13, 0x15, 0x11, 0x09, 0x13, 0x14, 0x12, 0x09, 0x13, 0x23, 0x12, 0x09, 0x44, 0x13, 0x09, 0x14, 0x25, 0x09, 0x13, 0x17, 0x09, 0x13, 0x13, 0x13, 0x09, 0x13, 0x22, 0x13, 0x09, 0x34,
+	0x31, 0x0A, 0x14, 0x0F, 0x01, 0x13, 0x0F, 0x02, 0x22, 0x0F, 0x02, 0x12, 0x0F, 0x03, 0xF6, 0x00, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x2F, 0x04, 0x96, 0x06, 0xB6, 0x04, 0x0F, 0x11, 0x04, 0x00,
+	0x54, 0x0C, 0x73, 0x0B, 0x00, 0xF3, 0x20, 0x01, 0x00, 0x13, 0x0F, 0x02, 0x00, 0xF3, 0x20, 0x01, 0x13, 0x0F, 0x02, 0x29, 0x0A, 0x00, 0x0F, 0x22, 0x02, 0x0F, 0x13, 0x11, 0x0F, 0x24, 0x14, 0x16,
+	0x09, 0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x09, 0x00, 0x00, 0x45, 0x0C, 0x64, 0x0B, 0x23, 0x24, 0x0A, 0x13, 0x16, 0x0A, 0x00, 0x00, 0x64, 0x0B, 0x45, 0x0C, 0x17, 0x17, 0x05, 0x27, 0x25, 0x05,
+	0x28, 0x23, 0x06, 0x59, 0x07, 0x3A, 0x08, 0x17, 0x17, 0x05, 0x27, 0x25, 0x05, 0x28, 0x23, 0x06, 0x59, 0x07, 0x3A, 0x08, 0x14, 0x16, 0x09, 0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x14, 0x04, 0x1B,
+	0x32, 0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x24, 0x06, 0x35, 0x34, 0x06, 0x24, 0x24, 0x12, 0x06, 0x23, 0x24, 0x13, 0x06, 0x98, 0x04, 0x00, 0x1E, 0x06, 0x14, 0x16, 0x09,
+	0x23, 0x16, 0x09, 0x93, 0x09, 0x1B, 0x14, 0x04, 0x1B, 0x32, 0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x17, 0x04, 0x35, 0x21, 0x24, 0x04, 0x24, 0x12, 0x15, 0x11, 0x04, 0x23,
+	0x13, 0x14, 0x12, 0x04, 0x18, 0x23, 0x12, 0x04, 0x49, 0x13, 0x04, 0x0F, 0x11, 0x04, 0x14, 0x25, 0x09, 0x13, 0x17, 0x09, 0x13, 0x13, 0x13, 0x09, 0x13, 0x22, 0x13, 0x14, 0x04, 0x34, 0x31, 0x33,
+	0x04, 0x2D, 0x06, 0x3B, 0x07, 0x2A, 0x09, 0x38, 0x0A, 0x27, 0x24, 0x06, 0x35, 0x34, 0x06, 0x24, 0x24, 0x12, 0x06, 0x23, 0x24, 0x13, 0x06, 0x98, 0x04, 0x00, 0x1E, 0x06, 0x2F, 0x04, 0x5E, 0x02,
+	0x2D, 0x13, 0x02, 0x2C, 0x15, 0x01, 0x2B, 0x16, 0x01, 0x26, 0x32, 0x16, 0x01, 0x26, 0x12, 0x18, 0x01, 0x0F, 0x23, 0x01, 0x0F, 0x22, 0x02, 0x0F, 0x21, 0x03, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B,
+	0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x10, 0x42, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x11, 0x41, 0x14, 0x09, 0x55, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11,
+	0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11, 0x09, 0x43, 0x14, 0x09, 0x11, 0x21, 0x16, 0x09, 0x10, 0x42, 0x14, 0x09, 0x10, 0x54, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F,
+	0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x11, 0x53, 0x11, 0x09, 0x20, 0x41, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x20, 0x41, 0x14, 0x09, 0x11, 0x53, 0x11, 0x09, 0x48,
+	0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x20, 0x46, 0x09, 0x10, 0x54, 0x11, 0x09, 0x10, 0x42, 0x14, 0x09, 0x20, 0x21, 0x16, 0x09, 0x11, 0x41,
+	0x14, 0x09, 0x11, 0x53, 0x11, 0x09, 0x20, 0x46, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x20, 0x46, 0x09, 0x20, 0x53, 0x11, 0x09, 0x43, 0x14,
+	0x09, 0x23, 0x16, 0x09, 0x43, 0x14, 0x09, 0x20, 0x53, 0x11, 0x09, 0x20, 0x46, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x4D, 0x04, 0x5B, 0x05, 0x48, 0x09, 0x55, 0x11,
+	0x09, 0x61, 0x14, 0x09, 0x10, 0x22, 0x16, 0x09, 0x10, 0x42, 0x14, 0x09, 0x31, 0x51, 0x11, 0x09, 0x48, 0x09, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x2F, 0x04, 0x3D, 0x05, 0x3B, 0x07, 0x39,
+	0x09, 0x37, 0x11, 0x09, 0x35, 0x13, 0x09, 0x33, 0x15, 0x09, 0x13, 0x17, 0x09, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0x67, 0x08,
+	0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x29, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x13, 0x3C, 0x02, 0x13, 0x1C, 0x11, 0x11, 0x13, 0x1C, 0x22, 0x23, 0x2A, 0x04, 0x24, 0x19, 0x05, 0x34, 0x36,
+	0x05, 0x25, 0x26, 0x06, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x10, 0x12, 0x15, 0x16, 0x04, 0x00, 0x11, 0x11, 0x15, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x13, 0x1C, 0x04,
+	0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x11, 0x11, 0x15, 0x16, 0x04, 0x10, 0x12, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x13,
+	0x15, 0x16, 0x04, 0x11, 0x11, 0x15, 0x16, 0x04, 0x20, 0x11, 0x15, 0x16, 0x04, 0x10, 0x12, 0x15, 0x16, 0x04, 0x20, 0x11, 0x15, 0x16, 0x04, 0x11, 0x11, 0x15, 0x16, 0x04, 0x13, 0x15, 0x16, 0x04,
+	0x00, 0x13, 0x1C, 0x04, 0xE3, 0x04, 0x00, 0x20, 0x11, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x20, 0x11, 0x15, 0x16, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x13, 0x1C, 0x04,
+	0x10, 0x0F, 0x05, 0x10, 0xE2, 0x04, 0x11, 0xE1, 0x04, 0x11, 0xE1, 0x04, 0x10, 0xE2, 0x04, 0x10, 0x0F, 0x05, 0x11, 0x0F, 0x04, 0x20, 0xE1, 0x04, 0x10, 0xE2, 0x04, 0x20, 0x0F, 0x04, 0x11, 0x0F,
+	0x04, 0x20, 0x0F, 0x04, 0x00, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x20, 0x0F, 0x04, 0x00, 0x19, 0x0B, 0x00, 0xE3, 0x04, 0x00, 0x13, 0x15, 0x16, 0x04, 0x00, 0x00, 0x00, 0x13, 0x1C, 0x04, 0x23, 0x2A,
+	0x04, 0x14, 0x29, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0xE3, 0x04, 0x33, 0x0F, 0x20, 0x32, 0x0E, 0x10, 0x35, 0x0C, 0x10, 0x37, 0x0A, 0x20, 0x47, 0x08, 0x11, 0x39, 0x07, 0x11, 0x3B,
+	0x05, 0x20, 0x3C, 0x04, 0xE3, 0x04, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x11, 0x11, 0x1C, 0x04, 0x23,
+	0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x13, 0x1C, 0x04, 0x11, 0x11, 0x1C, 0x04,
+	0x10, 0x12, 0x1C, 0x04, 0x00, 0x23, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x23, 0x2A, 0x04, 0x11,
+	0x11, 0x1C, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x11, 0x21, 0x2A, 0x04, 0x14, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5,
+	0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x20, 0x21, 0x2A, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x20, 0x11, 0x1C, 0x04, 0x11, 0x11, 0x1C, 0x04, 0x11, 0x21, 0x2A, 0x04, 0x20, 0x12, 0x1A, 0x05,
+	0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x67, 0x08, 0xA5, 0x06, 0x34, 0x36, 0x05, 0x14, 0x1A, 0x05, 0x20, 0x21, 0x2A, 0x04, 0x20, 0x11, 0x1C, 0x04, 0x13, 0x1C, 0x04, 0x00, 0x00, 0x20, 0x21,
+	0x2A, 0x04, 0x20, 0x12, 0x1A, 0x05, 0x34, 0x36, 0x05, 0xA5, 0x06, 0x67, 0x08, 0x25, 0x25, 0x07, 0x26, 0x23, 0x08, 0x27, 0x21, 0x09, 0x38, 0x0A, 0x00, 0x27, 0x21, 0x09, 0x26, 0x23, 0x08, 0x25,
+	0x25, 0x07, 0x67, 0x13, 0x04, 0xC5, 0x04, 0x34, 0x36, 0x05, 0x14, 0x38, 0x05, 0x23, 0x27, 0x21, 0x04, 0x13, 0x27, 0x13, 0x04, 0x13, 0x35, 0x14, 0x04, 0x13, 0x34, 0x15, 0x04, 0x13, 0x23, 0x17,
+	0x04, 0x23, 0x21, 0x27, 0x04, 0x34, 0x18, 0x05, 0x34, 0x36, 0x05, 0xC3, 0x06, 0x13, 0x63, 0x08, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x10, 0x1F, 0x04, 0x00, 0x11,
+	0x1E, 0x04, 0x2F, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x11, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x00, 0x2F, 0x04, 0x3D, 0x05,
+	0xC3, 0x06, 0x93, 0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x2F, 0x04, 0x11, 0x1E, 0x04, 0x20, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x20, 0x1E, 0x04, 0x11, 0x2D, 0x04, 0x3D, 0x05, 0xC3, 0x06, 0x93,
+	0x09, 0x93, 0x09, 0xC3, 0x06, 0x3D, 0x05, 0x20, 0x2D, 0x04, 0x20, 0x1E, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x20, 0x2D, 0x04, 0x20, 0x3B, 0x05, 0xC3, 0x06, 0x93, 0x09, 0x23, 0x0F, 0x01, 0x33,
+	0x0F, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x11, 0x87, 0x04, 0x10, 0x88, 0x04, 0x10, 0x36, 0x0B, 0x36, 0x0C, 0x34, 0x0E, 0x33, 0x0F, 0x23, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x15, 0x17, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x25, 0x24, 0x08, 0x76, 0x08, 0x47, 0x0A, 0xB6, 0x04, 0xE3, 0x04, 0x23, 0x0F, 0x01, 0x12, 0x0F, 0x03, 0x12, 0x2C, 0x04, 0x12, 0x1D, 0x04, 0x12, 0x44, 0x15, 0x04, 0x22,
+	0x22, 0x31, 0x14, 0x04, 0x43, 0x23, 0x14, 0x04, 0x24, 0x65, 0x04, 0x4C, 0x05, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x12, 0x23, 0x22, 0x14, 0x04, 0x12, 0x13, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13,
+	0x15, 0x04, 0x14, 0x11, 0x13, 0x15, 0x04, 0x16, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15,
+	0x04, 0x14, 0x11, 0x13, 0x15, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x14, 0x05, 0x12, 0x93, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x14,
+	0x21, 0x22, 0x14, 0x04, 0x23, 0x11, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x15, 0x04, 0x12, 0x13, 0x13, 0x15, 0x04, 0x22, 0x12, 0x13, 0x14, 0x05, 0x23, 0x91, 0x06, 0x14, 0xA2, 0x04, 0x0F, 0x11,
+	0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x23, 0x21, 0x22, 0x14, 0x04, 0x13, 0x12, 0x13, 0x15, 0x04, 0x00, 0x23, 0x11, 0x13, 0x15, 0x04, 0x14, 0x11, 0x13, 0x14, 0x05, 0x14, 0x91, 0x06,
+	0x13, 0xA3, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x22, 0x22, 0x22, 0x14, 0x04, 0x22, 0x12, 0x13, 0x15, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x22, 0x12, 0x13, 0x14,
+	0x05, 0x22, 0x92, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x43, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x31, 0x12, 0x13, 0x15, 0x04, 0x10, 0x13, 0x11, 0x13, 0x15, 0x04, 0x00,
+	0x31, 0x12, 0x13, 0x14, 0x05, 0x96, 0x06, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x18, 0x52, 0x05, 0x27, 0x62, 0x04, 0x26, 0x22, 0x14, 0x04, 0x16, 0x13, 0x15, 0x04, 0x00, 0x16, 0x13, 0x24, 0x04,
+	0x16, 0x13, 0x23, 0x05, 0x87, 0x06, 0x97, 0x05, 0x27, 0x12, 0x22, 0x05, 0x16, 0x14, 0x14, 0x04, 0x00, 0x00, 0x00, 0x26, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x59, 0x07, 0x97,
+	0x05, 0x26, 0x27, 0x04, 0x16, 0x19, 0x04, 0x16, 0x39, 0x02, 0x16, 0x19, 0x11, 0x11, 0x16, 0x19, 0x22, 0x27, 0x25, 0x05, 0x00, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x12, 0x13, 0x14,
+	0x14, 0x04, 0x00, 0x22, 0x12, 0x14, 0x14, 0x04, 0x14, 0x11, 0x14, 0x14, 0x04, 0x26, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97, 0x05, 0x26, 0x13, 0x13, 0x05, 0x16,
+	0x14, 0x14, 0x04, 0x14, 0x11, 0x14, 0x14, 0x04, 0x13, 0x12, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x12, 0x23, 0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97,
+	0x05, 0x14, 0x21, 0x13, 0x13, 0x05, 0x23, 0x11, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x12, 0x13, 0x14, 0x14, 0x04, 0x22, 0x12, 0x14, 0x14, 0x04, 0x23, 0x21, 0x13, 0x23, 0x04, 0x14,
+	0x52, 0x22, 0x05, 0x39, 0x12, 0x06, 0x68, 0x07, 0x97, 0x05, 0x22, 0x22, 0x13, 0x13, 0x05, 0x22, 0x12, 0x14, 0x14, 0x04, 0x16, 0x14, 0x14, 0x04, 0x00, 0x22, 0x12, 0x14, 0x14, 0x04, 0x22, 0x22,
+	0x13, 0x23, 0x04, 0x57, 0x22, 0x05, 0x39, 0x12, 0x06, 0x12, 0x0F, 0x03, 0x22, 0x0F, 0x02, 0x13, 0xB2, 0x04, 0x14, 0xB1, 0x04, 0x14, 0xB1, 0x04, 0x13, 0xB2, 0x04, 0x22, 0x0F, 0x02, 0x12, 0x0F,
+	0x03, 0x14, 0x0F, 0x01, 0x23, 0x0F, 0x01, 0x22, 0xB2, 0x04, 0x12, 0xB3, 0x04, 0x22, 0x0F, 0x02, 0x23, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x22, 0x0F, 0x02, 0x00, 0xB6, 0x04, 0x00, 0x22, 0x0F, 0x02,
+	0x00, 0x69, 0x06, 0x88, 0x05, 0x12, 0x12, 0x21, 0x26, 0x04, 0x12, 0x11, 0x12, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x00, 0x33, 0x11, 0x18, 0x04, 0x22, 0x41, 0x26, 0x04, 0x12, 0xA3, 0x05, 0x78,
+	0x06, 0xB6, 0x04, 0x23, 0xB1, 0x04, 0x13, 0x23, 0x0C, 0x13, 0x12, 0x0E, 0x23, 0x11, 0x0E, 0x14, 0x11, 0x0E, 0x14, 0x21, 0x0D, 0x13, 0xB2, 0x04, 0x98, 0x04, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27,
+	0x04, 0x12, 0x13, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x13, 0x12, 0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x26, 0x27, 0x04, 0x16,
+	0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x13, 0x12, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x12, 0x23, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x14, 0x21, 0x27, 0x04, 0x23, 0x11,
+	0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x12, 0x13, 0x19, 0x04, 0x22, 0x12, 0x19, 0x04, 0x23, 0x21, 0x27, 0x04, 0x14, 0x92, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x23, 0x21, 0x27, 0x04, 0x13,
+	0x12, 0x19, 0x04, 0x00, 0x23, 0x11, 0x19, 0x04, 0x14, 0x11, 0x19, 0x04, 0x14, 0x21, 0x27, 0x04, 0x13, 0x93, 0x05, 0x78, 0x06, 0x78, 0x06, 0x97, 0x05, 0x22, 0x22, 0x27, 0x04, 0x22, 0x12, 0x19,
+	0x04, 0x16, 0x19, 0x04, 0x00, 0x22, 0x12, 0x19, 0x04, 0x22, 0x22, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x19, 0x0B, 0x00, 0x00, 0x00, 0x25, 0x12, 0x22, 0x07, 0x00, 0x19, 0x0B, 0x00, 0x00, 0x00,
+	0x3A, 0x13, 0x04, 0xA7, 0x04, 0x27, 0x25, 0x05, 0x16, 0x35, 0x11, 0x04, 0x16, 0x24, 0x13, 0x04, 0x16, 0x23, 0x14, 0x04, 0x16, 0x31, 0x15, 0x04, 0x27, 0x25, 0x05, 0xA6, 0x05, 0x16, 0x33, 0x08,
+	0x96, 0x06, 0xA6, 0x05, 0x12, 0x2C, 0x04, 0x22, 0x1C, 0x04, 0x13, 0x1C, 0x04, 0x14, 0x1B, 0x04, 0x2E, 0x05, 0xB6, 0x04, 0x00, 0x96, 0x06, 0xA6, 0x05, 0x2F, 0x04, 0x14, 0x1B, 0x04, 0x13, 0x1C,
+	0x04, 0x22, 0x1C, 0x04, 0x12, 0x2B, 0x05, 0xB6, 0x04, 0x00, 0x96, 0x06, 0x14, 0xA1, 0x05, 0x23, 0x2A, 0x04, 0x22, 0x1C, 0x04, 0x12, 0x1D, 0x04, 0x22, 0x1C, 0x04, 0x23, 0x29, 0x05, 0x14, 0xB1,
+	0x04, 0xB6, 0x04, 0x96, 0x06, 0x22, 0xA2, 0x05, 0x22, 0x2B, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x22, 0x1C, 0x04, 0x22, 0x2A, 0x05, 0xB6, 0x04, 0x00, 0x16, 0x0E, 0x36, 0x1B, 0x57, 0x18, 0x4A, 0x25,
+	0x14, 0x47, 0x31, 0x01, 0x13, 0x4B, 0x02, 0x22, 0x49, 0x04, 0x12, 0x47, 0x07, 0x57, 0x09, 0x46, 0x0B, 0x16, 0x0E, 0xF2, 0x40, 0x00, 0x18, 0x25, 0x05, 0x17, 0x17, 0x05, 0x16, 0x19, 0x04, 0x00,
+	0x00, 0x26, 0x27, 0x04, 0x97, 0x05, 0x78, 0x06, 0x16, 0x0E, 0x36, 0x1B, 0x22, 0x53, 0x18, 0x22, 0x46, 0x25, 0x4C, 0x31, 0x01, 0x4F, 0x02, 0x22, 0x49, 0x04, 0x22, 0x46, 0x07, 0x57, 0x09, 0x46,
+	0x0B, 0x16, 0x0E, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x12, 0x53, 0x11, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x11, 0x17, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x53, 0x11, 0x08,
+	0x49, 0x08, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x15, 0x22, 0x31, 0x21, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00, 0x15, 0x21, 0x12, 0x22, 0x05, 0x98,
+	0x04, 0x89, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x20, 0x54, 0x11, 0x08, 0x12, 0x41, 0x14, 0x08, 0x12, 0x11, 0x17, 0x08, 0x12, 0x41, 0x14, 0x08, 0x20,
+	0x54, 0x11, 0x08, 0x49, 0x08, 0x4B, 0x06, 0x4D, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x28, 0x31, 0x21, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00,
+	0x15, 0x21, 0x12, 0x22, 0x05, 0x23, 0x93, 0x04, 0x89, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x11, 0x04, 0x3E, 0x04, 0x4B, 0x06, 0x49, 0x08, 0x56, 0x11, 0x08, 0x44, 0x14, 0x08, 0x14, 0x17, 0x08, 0x44,
+	0x14, 0x08, 0x56, 0x11, 0x08, 0x49, 0x08, 0x4B, 0x42, 0x5D, 0x12, 0x0F, 0x11, 0x13, 0x0F, 0x06, 0x19, 0x42, 0x05, 0x28, 0x31, 0x21, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x00, 0x27, 0x12, 0x22,
+	0x05, 0xD8, 0x99, 0x12, 0x0F, 0x11, 0x13, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x12, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x00,
+	0x10, 0x14, 0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x15, 0x11, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x13, 0x23,
+	0x26, 0x04, 0x28, 0x24, 0x05, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x00, 0x21, 0x11,
+	0x1B, 0x04, 0x12, 0x12, 0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x14, 0x12, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x00, 0x24,
+	0x21, 0x26, 0x04, 0x15, 0x22, 0x24, 0x05, 0x0F, 0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x15,
+	0x19, 0x05, 0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x24, 0x11, 0x18, 0x04, 0x00, 0x17, 0x18, 0x04, 0x27, 0x26, 0x04, 0x28, 0x24, 0x05, 0x0F,
+	0x06, 0x58, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x10, 0x13, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x14, 0x19, 0x05,
+	0x35, 0x26, 0x05, 0x26, 0x25, 0x06, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x13, 0x23, 0x26, 0x04, 0x23, 0x12, 0x18, 0x04, 0x24, 0x11, 0x18, 0x04, 0x00, 0x23, 0x22, 0x26, 0x04, 0x13, 0x24, 0x24,
+	0x05, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x1B, 0x04, 0x10, 0x13, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x14, 0x19, 0x05, 0x25, 0x27,
+	0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0x18, 0x16, 0x05, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x23, 0x11, 0x0E, 0x33, 0x0F,
+	0x1A, 0x0A, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x14, 0x1B, 0x04, 0x00, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05,
+	0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x15, 0x12, 0x16, 0x05, 0xE3, 0x04, 0x00, 0x15, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x12, 0x11, 0x15,
+	0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x12, 0x23, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00,
+	0x15, 0x21, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x12, 0x11, 0x15, 0x15, 0x04, 0x00, 0x00,
+	0x20, 0x12, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x23, 0x22, 0x12, 0x23, 0x04, 0x15, 0x11, 0x13, 0x14, 0x04, 0x00, 0x00, 0x23,
+	0x22, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x14, 0x15, 0x15, 0x04, 0x00,
+	0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x12, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x00, 0x27, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39,
+	0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x55, 0x14, 0x15, 0x25, 0x12, 0x14, 0x1B, 0x13, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05,
+	0x27, 0x12, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x17, 0x13, 0x54, 0x17, 0x13, 0x24, 0x12, 0x27, 0x12, 0x23, 0x13, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15,
+	0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04,
+	0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x13, 0x23, 0x12, 0x23, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x00, 0x23, 0x22, 0x12, 0x23, 0x04, 0x13, 0x44,
+	0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x20, 0x12, 0x15,
+	0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x12, 0x21, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x15, 0x21, 0x26,
+	0x22, 0x14, 0x12, 0x18, 0x13, 0x23, 0x12, 0x18, 0x13, 0x00, 0x24, 0x22, 0x24, 0x23, 0x15, 0xD1, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x20,
+	0x12, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x12, 0x11, 0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F,
+	0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x23, 0x22, 0x26, 0x22, 0x15, 0x11, 0x18, 0x13, 0x00, 0x00, 0x23, 0x23, 0x24, 0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67, 0x08, 0x96, 0x06, 0x25,
+	0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x21, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x14, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12, 0x14, 0x05, 0x26, 0x62,
+	0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x27, 0x26, 0x22, 0x24, 0x11, 0x18, 0x13, 0x00, 0x17, 0x18, 0x13, 0x28, 0x24, 0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0x67,
+	0x08, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x14, 0x1B, 0x04, 0x00, 0x14, 0x1B, 0x11, 0x11, 0x14, 0x15, 0x15, 0x21, 0x01, 0x14, 0x15, 0x15, 0x04, 0x24, 0x14, 0x24, 0x04, 0x35, 0x12,
+	0x14, 0x05, 0x26, 0x62, 0x05, 0x5A, 0x06, 0x0F, 0x06, 0x69, 0x13, 0x02, 0x88, 0x22, 0x01, 0x27, 0x26, 0x22, 0x33, 0x11, 0x18, 0x13, 0x12, 0x21, 0x11, 0x18, 0x13, 0x17, 0x18, 0x13, 0x28, 0x24,
+	0x23, 0xD7, 0x01, 0xB7, 0x03, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x19, 0x0B, 0x12, 0x16, 0x0B, 0x21, 0x16, 0x0B, 0x20, 0x17, 0x0B, 0x00, 0x21, 0x16, 0x0B, 0x12, 0x16, 0x0B, 0xD4, 0x04, 0x00, 0x0F,
+	0x06, 0xE3, 0x04, 0x11, 0xE1, 0x04, 0x20, 0x16, 0x0C, 0x10, 0x16, 0x0D, 0x00, 0x20, 0x15, 0x0D, 0x11, 0xA5, 0x04, 0x98, 0x04, 0x16, 0x0E, 0xD4, 0x04, 0x00, 0x16, 0x13, 0x0A, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x16, 0x0E, 0x14, 0x0F, 0x01, 0xE3, 0x04, 0x00, 0x14, 0x13, 0x0C, 0x14, 0x12, 0x0D, 0x17, 0x0D, 0x00, 0xA7, 0x04, 0x98, 0x04, 0x21, 0x0F, 0x03, 0x11, 0x0F,
+	0x04, 0x11, 0xD2, 0x04, 0x12, 0xD1, 0x04, 0x12, 0x0F, 0x03, 0x21, 0x0F, 0x03, 0x0F, 0x06, 0x24, 0x0F, 0x14, 0xA2, 0x04, 0x24, 0xA1, 0x04, 0x15, 0x0F, 0x24, 0x0F, 0x12, 0x0F, 0x03, 0x00, 0x12,
+	0xD1, 0x04, 0x00, 0x12, 0x0F, 0x03, 0x15, 0x0F, 0x00, 0x15, 0xA1, 0x04, 0x00, 0x15, 0x0F, 0x0F, 0x06, 0x20, 0x0F, 0x04, 0x12, 0xD1, 0x04, 0x00, 0x12, 0x0F, 0x03, 0x20, 0x0F, 0x04, 0x0F, 0x06,
+	0x23, 0x0F, 0x01, 0x15, 0xA1, 0x04, 0x00, 0x15, 0x0F, 0x23, 0x0F, 0x01, 0x0F, 0x06, 0x00, 0xF4, 0x20, 0xE4, 0x12, 0x0F, 0x15, 0x0F, 0x06, 0x23, 0xE2, 0x23, 0xB2, 0x12, 0x0F, 0x15, 0x0F, 0x06,
+	0x00, 0x21, 0xD1, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x00, 0x1D, 0x07, 0x3D, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x14, 0x2A,
+	0x04, 0xC4, 0x05, 0x94, 0x08, 0x0F, 0x06, 0x23, 0xA2, 0x04, 0x00, 0x0F, 0x06, 0x0F, 0x15, 0x23, 0xE2, 0x23, 0xD2, 0x01, 0x1D, 0x07, 0x3D, 0x05, 0x2F, 0x04, 0x12, 0x1D, 0x04, 0x21, 0x11, 0x1B,
+	0x04, 0x20, 0x12, 0x1B, 0x04, 0x20, 0x12, 0x2A, 0x04, 0x21, 0xC1, 0x05, 0x12, 0x91, 0x08, 0x24, 0x1E, 0x23, 0xE2, 0x23, 0xD2, 0x01, 0x14, 0x0F, 0x01, 0x15, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04,
+	0x2A, 0x09, 0x29, 0x0A, 0x38, 0x0A, 0x27, 0x21, 0x16, 0x11, 0x26, 0x23, 0x25, 0x01, 0x25, 0x35, 0x06, 0x24, 0x37, 0x05, 0x14, 0x39, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x2B,
+	0x08, 0x3A, 0x15, 0x11, 0x29, 0x31, 0x23, 0x01, 0x37, 0x33, 0x05, 0x17, 0x27, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x2B, 0x08, 0x3A, 0x08, 0x59, 0x07, 0x28, 0x23, 0x06, 0x27,
+	0x25, 0x05, 0x17, 0x27, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x12, 0x1D, 0x04, 0x20, 0x1E, 0x04, 0x00, 0x10, 0x1F, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x0F, 0x06, 0x11, 0xE1,
+	0x04, 0x10, 0xE2, 0x04, 0x10, 0x0F, 0x05, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x0F, 0x11, 0x11, 0x11, 0x0F, 0x11, 0x21, 0x01, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x0F, 0x06, 0xE3,
+	0x11, 0x11, 0xE3, 0x21, 0x01, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x24, 0x11, 0x18, 0x04, 0x34, 0x19, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x0F,
+	0x06, 0x23, 0x11, 0x0E, 0x33, 0x0F, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x29, 0x15, 0x04, 0x00, 0x0F, 0x11, 0x04, 0x00, 0x0F, 0x06, 0xE3, 0x04, 0x00, 0x0F, 0x06, 0x29,
+	0x0A, 0x00, 0x2B, 0x08, 0x1B, 0x09, 0xD4, 0x04, 0x29, 0x15, 0x04, 0x19, 0x16, 0x04, 0x28, 0x16, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x00, 0x2B, 0x08, 0xE3, 0x04, 0x00, 0x29, 0x0A, 0x0F, 0x06,
+	0xD4, 0x04, 0x00, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x12, 0x36, 0x09, 0x20, 0x39, 0x07, 0x20, 0x3A, 0x06, 0x10, 0x3D, 0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17,
+	0x0D, 0x15, 0x11, 0x0D, 0x23, 0x12, 0x0D, 0x13, 0xA3, 0x04, 0x98, 0x04, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x34, 0x0E, 0x36, 0x0C, 0x37, 0x0B, 0x39, 0x16, 0x11, 0x3B, 0x24, 0x01, 0x3C, 0x06, 0x3E,
+	0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x1A, 0x11, 0x17, 0x2A, 0x01, 0x17, 0x0D, 0xA7, 0x04, 0x98, 0x04, 0x0F, 0x06, 0xD4, 0x04, 0x00, 0x34, 0x0E, 0x10, 0x35,
+	0x0C, 0x20, 0x35, 0x0B, 0x21, 0x36, 0x09, 0x21, 0x38, 0x07, 0x20, 0x3A, 0x06, 0x10, 0x3D, 0x04, 0xD4, 0x04, 0x00, 0x0F, 0x06, 0xA7, 0x04, 0x13, 0xA3, 0x04, 0x23, 0x13, 0x0C, 0x24, 0x11, 0x0D,
+	0x00, 0x23, 0x12, 0x0D, 0x13, 0xA3, 0x04, 0x98, 0x04, 0x24, 0x11, 0x0D, 0x44, 0x0D, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x0D, 0x00, 0x00, 0xA7, 0x04, 0x98, 0x04, 0x0F, 0x06, 0x00, 0xD4, 0x04,
+	0x26, 0x0D, 0x15, 0x0F, 0x00, 0x14, 0x1A, 0x05, 0x14, 0x2A, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x34, 0x28, 0x04, 0xB5, 0x05, 0x77, 0x07, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x18, 0x0C, 0x17, 0x0D, 0x00,
+	0x17, 0x1C, 0x00, 0xE7, 0xB9, 0x01, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05,
+	0x96, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x00, 0x15, 0x21, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0x77, 0x07,
+	0x96, 0x06, 0x25, 0x27, 0x05, 0x15, 0x19, 0x05, 0x20, 0x12, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x00, 0x00, 0x20, 0x12, 0x1B, 0x04, 0x15, 0x19, 0x05, 0x25, 0x27, 0x05, 0x96, 0x06, 0x67, 0x08,
+	0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x23, 0x22, 0x26, 0x04, 0x15, 0x11, 0x18, 0x04, 0x00, 0x00, 0x23, 0x22, 0x26, 0x04, 0x88, 0x05, 0x69, 0x06, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27,
+	0x05, 0x15, 0x19, 0x05, 0x12, 0x11, 0x1B, 0x04, 0x21, 0x11, 0x1B, 0x04, 0x20, 0x12, 0x1B, 0x04, 0x10, 0x13, 0x1B, 0x04, 0x12, 0x11, 0x1B, 0x04, 0x20, 0x13, 0x19, 0x05, 0x10, 0x24, 0x27, 0x05,
+	0x10, 0x95, 0x06, 0x67, 0x08, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x15, 0x21, 0x26, 0x04, 0x24, 0x11, 0x18, 0x04, 0x23, 0x12, 0x18, 0x04, 0x13, 0x11, 0x11, 0x18, 0x04, 0x24, 0x21, 0x26, 0x04,
+	0x23, 0x83, 0x05, 0x13, 0x65, 0x06, 0x0F, 0x06, 0x77, 0x07, 0x96, 0x06, 0x25, 0x27, 0x05, 0x24, 0x29, 0x04, 0x14, 0x1B, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x15, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x69, 0x06, 0x88, 0x05, 0x27, 0x26, 0x04, 0x17, 0x18, 0x04, 0x00, 0x00, 0x27, 0x26, 0x04, 0x88, 0x05, 0x00, 0x27, 0x12, 0x23, 0x04, 0x17,
+	0x13, 0x14, 0x04, 0x00, 0x00, 0x27, 0x12, 0x23, 0x04, 0x48, 0x22, 0x05, 0x39, 0x12, 0x06, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x12, 0x11, 0x15, 0x0A, 0x20, 0x12, 0x15,
+	0x0A, 0x20, 0x12, 0x35, 0x08, 0x10, 0x13, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0xA7, 0x04, 0x00, 0x15, 0x12, 0x0C, 0x23, 0x22, 0x0C, 0x13, 0x23,
+	0x0C, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x14, 0x15, 0x17, 0x11, 0x14, 0x15, 0x27, 0x01, 0x14, 0x35, 0x08, 0x14, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04,
+	0x17, 0x18, 0x04, 0x0F, 0x06, 0xA7, 0x11, 0x11, 0xA7, 0x21, 0x01, 0x18, 0x0C, 0x27, 0x0C, 0x00, 0x0F, 0x06, 0x00, 0xD4, 0x04, 0x14, 0x15, 0x0A, 0x10, 0x13, 0x15, 0x0A, 0x20, 0x12, 0x15, 0x0A,
+	0x21, 0x11, 0x15, 0x0A, 0x00, 0x20, 0x12, 0x35, 0x08, 0x10, 0x13, 0x45, 0x07, 0x24, 0x13, 0x33, 0x05, 0x55, 0x34, 0x04, 0x17, 0x18, 0x04, 0x0F, 0x06, 0x13, 0xA3, 0x04, 0x23, 0xA2, 0x04, 0x24,
+	0x12, 0x0C, 0x24, 0x21, 0x0C, 0x23, 0x22, 0x0C, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x14, 0x14, 0x16, 0x04, 0x14, 0x24, 0x15, 0x04, 0x12, 0x11,
+	0x15, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x13, 0x15, 0x15, 0x04, 0x24, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x57, 0x23, 0x04, 0x17,
+	0x13, 0x14, 0x04, 0x00, 0x15, 0x11, 0x23, 0x13, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x13, 0x23, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25,
+	0x04, 0x12, 0x11, 0x14, 0x16, 0x04, 0x21, 0x11, 0x24, 0x15, 0x04, 0x20, 0x12, 0x15, 0x15, 0x04, 0x00, 0x21, 0x11, 0x15, 0x15, 0x04, 0x12, 0x21, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35,
+	0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x15, 0x51, 0x23, 0x04, 0x14, 0x12, 0x13, 0x14, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x24, 0x11, 0x23, 0x13, 0x04, 0x15, 0x21,
+	0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x14, 0x14, 0x16, 0x04, 0x14, 0x24, 0x15, 0x13, 0x14, 0x15, 0x35, 0x11, 0x14, 0x15, 0x15,
+	0x31, 0x14, 0x15, 0x15, 0x04, 0x24, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x57, 0x23, 0x04, 0x17, 0x13, 0x14, 0x04, 0x17, 0x13, 0x14, 0x13, 0x17,
+	0x23, 0x33, 0x11, 0x17, 0x23, 0x13, 0x31, 0x27, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x0F, 0x06, 0x1E, 0x06, 0x45, 0x34, 0x05, 0x15, 0x22, 0x25, 0x04, 0x10, 0x13, 0x14, 0x16, 0x04, 0x20, 0x12,
+	0x24, 0x15, 0x04, 0x21, 0x11, 0x15, 0x15, 0x04, 0x00, 0x20, 0x12, 0x15, 0x15, 0x04, 0x10, 0x23, 0x24, 0x23, 0x04, 0x25, 0x54, 0x05, 0x16, 0x35, 0x06, 0x0F, 0x06, 0x38, 0x23, 0x05, 0x13, 0x53,
+	0x23, 0x04, 0x23, 0x12, 0x13, 0x14, 0x04, 0x24, 0x11, 0x13, 0x14, 0x04, 0x24, 0x11, 0x23, 0x13, 0x04, 0x23, 0x12, 0x23, 0x13, 0x04, 0x13, 0x23, 0x23, 0x21, 0x04, 0x28, 0x42, 0x05, 0x14, 0x0F,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x13, 0xF4, 0x11, 0x14, 0x3D, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x17, 0x0D, 0x97, 0x05, 0xC5, 0x13, 0x17, 0x38, 0x11, 0x17, 0x18, 0x31, 0x14, 0x0F, 0x01,
+	0x00, 0x00, 0x10, 0x13, 0x0F, 0x01, 0x20, 0x12, 0x0F, 0x01, 0x21, 0xD1, 0x04, 0x00, 0x20, 0x12, 0x0F, 0x01, 0x10, 0x13, 0x0F, 0x01, 0x14, 0x0F, 0x01, 0x00, 0x00, 0x17, 0x0D, 0x97, 0x05, 0xC5,
+	0x04, 0x17, 0x18, 0x04, 0x00, 0x23, 0x11, 0x0E, 0x33, 0x0F, 0x14, 0x0F, 0x01, 0x00, 0x14, 0x15, 0x0A, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x14, 0x15, 0x0A, 0x00, 0x00, 0x14, 0x0F, 0x01, 0x00, 0x17,
+	0x13, 0x09, 0x97, 0x05, 0xC5, 0x04, 0x17, 0x13, 0x14, 0x04, 0x00, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x21, 0x2C, 0x04, 0x11, 0x1E, 0x04, 0x00, 0x12, 0x1D, 0x04, 0x12, 0x2C, 0x04,
+	0x21, 0x2B, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x24, 0x1A, 0x04, 0x14, 0x1B, 0x04, 0x24, 0x1A, 0x04, 0x15, 0x19, 0x05, 0x24, 0xA1, 0x04, 0xA7, 0x04, 0x0F, 0x06,
+	0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x12, 0x2C, 0x04, 0x12, 0x1D, 0x04, 0x00, 0x00, 0x12, 0x2C, 0x04, 0x2E, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0x15, 0xA1, 0x04, 0x15, 0x1A,
+	0x04, 0x00, 0x00, 0x15, 0x19, 0x05, 0xA7, 0x04, 0x00, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x20, 0x2D, 0x04, 0x12, 0x1D, 0x04, 0x00, 0x00, 0x20, 0x2D, 0x04, 0x2E, 0x05, 0xB4, 0x06,
+	0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x23, 0x1B, 0x04, 0x15, 0x1A, 0x04, 0x00, 0x15, 0x19, 0x05, 0x23, 0xA2, 0x04, 0xA7, 0x04, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x2F,
+	0x04, 0x40, 0x1C, 0x04, 0x10, 0x12, 0x1C, 0x04, 0x00, 0x21, 0x2C, 0x04, 0x2E, 0x05, 0xB4, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x42, 0x1A, 0x04, 0x12, 0x12,
+	0x1A, 0x04, 0x12, 0x12, 0x19, 0x05, 0x23, 0xA2, 0x04, 0xA7, 0x04, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x12, 0x2B, 0x05, 0x21, 0x2C, 0x04, 0x20, 0x1E, 0x04, 0x10, 0x1F, 0x04, 0x12, 0x1D, 0x04,
+	0x20, 0x2D, 0x04, 0x10, 0x2D, 0x05, 0x10, 0xB3, 0x06, 0x94, 0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x15, 0x1A, 0x04, 0x24, 0x1A, 0x04, 0x23, 0x1B, 0x04, 0x13, 0x11, 0x19, 0x05, 0x24, 0xA1,
+	0x04, 0x23, 0xA2, 0x04, 0x13, 0x0F, 0x02, 0x0F, 0x06, 0x94, 0x08, 0xB4, 0x06, 0x2E, 0x05, 0x2F, 0x04, 0x0F, 0x11, 0x04, 0x0F, 0x51, 0x0F, 0x21, 0x12, 0x2F, 0x13, 0x2E, 0x05, 0xB4, 0x06, 0x94,
+	0x08, 0x0F, 0x06, 0x97, 0x05, 0xA7, 0x04, 0x0F, 0x11, 0x04, 0x00, 0x00, 0x1F, 0x41, 0xB7, 0x12, 0xA7, 0x13, 0x14, 0x0F, 0x01, 0x44, 0x0D, 0x66, 0x09, 0x69, 0x06, 0x5C, 0x04, 0x2F, 0x04, 0x5B,
+	0x05, 0x12, 0x55, 0x08, 0x21, 0x52, 0x0B, 0x20, 0x22, 0x0F, 0x20, 0x62, 0x0B, 0x21, 0x55, 0x08, 0x12, 0x58, 0x05, 0x2F, 0x04, 0x5C, 0x04, 0x69, 0x06, 0x66, 0x09, 0x44, 0x0D, 0x14, 0x0F, 0x01,
+	0x27, 0x0C, 0x67, 0x08, 0x6B, 0x04, 0x0F, 0x11, 0x04, 0x15, 0x56, 0x04, 0x14, 0x62, 0x08, 0x23, 0x12, 0x0D, 0x23, 0x62, 0x08, 0x24, 0x56, 0x04, 0x15, 0x29, 0x04, 0x5B, 0x05, 0x67, 0x08, 0x27,
+	0x0C, 0x0F, 0x06, 0x24, 0x0F, 0x34, 0x0E, 0x12, 0x33, 0x0C, 0x21, 0x35, 0x0A, 0x20, 0x87, 0x04, 0x00, 0x21, 0x35, 0x0A, 0x12, 0x33, 0x0C, 0x34, 0x0E, 0x24, 0x0F, 0x17, 0x0D, 0x47, 0x19, 0x15,
+	0x53, 0x25, 0x14, 0x47, 0x22, 0x01, 0x23, 0x4A, 0x02, 0x23, 0x57, 0x04, 0x24, 0x53, 0x07, 0x15, 0x41, 0x0A, 0x17, 0x0D, 0x0F, 0x06, 0x24, 0x0F, 0x34, 0x0E, 0x21, 0x33, 0x0C, 0x21, 0x35, 0x0A,
+	0x89, 0x04, 0x00, 0x21, 0x35, 0x0A, 0x21, 0x33, 0x0C, 0x34, 0x0E, 0x24, 0x0F, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04, 0x14, 0x37, 0x11, 0x04, 0x14, 0x26, 0x13, 0x04, 0x12, 0x11, 0x25,
+	0x14, 0x04, 0x20, 0x12, 0x33, 0x15, 0x04, 0x20, 0x12, 0x22, 0x17, 0x04, 0x10, 0x13, 0x21, 0x18, 0x04, 0x34, 0x19, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27, 0x04, 0x17, 0x45, 0x04, 0x17,
+	0x34, 0x11, 0x04, 0x15, 0x11, 0x32, 0x13, 0x04, 0x23, 0x12, 0x31, 0x14, 0x04, 0x13, 0x33, 0x16, 0x04, 0x27, 0x17, 0x04, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04, 0x14, 0x37, 0x11, 0x04,
+	0x14, 0x26, 0x13, 0x04, 0x21, 0x11, 0x25, 0x14, 0x04, 0x21, 0x11, 0x33, 0x15, 0x04, 0x14, 0x22, 0x17, 0x04, 0x14, 0x21, 0x18, 0x04, 0x34, 0x19, 0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27,
+	0x04, 0x17, 0x45, 0x04, 0x23, 0x12, 0x34, 0x11, 0x04, 0x23, 0x12, 0x32, 0x13, 0x04, 0x17, 0x31, 0x14, 0x04, 0x37, 0x16, 0x04, 0x27, 0x17, 0x04, 0x0F, 0x06, 0x14, 0x2A, 0x04, 0x14, 0x39, 0x04,
+	0x10, 0x13, 0x37, 0x11, 0x04, 0x20, 0x12, 0x26, 0x13, 0x04, 0x21, 0x11, 0x25, 0x14, 0x04, 0x21, 0x11, 0x33, 0x15, 0x04, 0x20, 0x12, 0x22, 0x17, 0x04, 0x10, 0x13, 0x21, 0x18, 0x04, 0x34, 0x19,
+	0x04, 0x14, 0x1B, 0x04, 0x0F, 0x06, 0x17, 0x27, 0x04, 0x13, 0x13, 0x45, 0x04, 0x23, 0x12, 0x34, 0x11, 0x04, 0x24, 0x11, 0x32, 0x13, 0x04, 0x24, 0x11, 0x31, 0x14, 0x04, 0x23, 0x32, 0x16, 0x04,
+	0x13, 0x23, 0x17, 0x04,
+};
+
+#endif
+
+// End
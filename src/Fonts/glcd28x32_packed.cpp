@@ -0,0 +1,3119 @@
+/*
+ * glcd28x32_packed.cpp
+ *
+ * Generated from glcd28x32.cpp by Tools/fontpack/fontpack.py - do not edit.
+ *
+ * Latin + Cyrillic + Japanese:   77865 bytes as column bitmaps,  32746 bytes packed (58% saved)
+ * Latin + Cyrillic:              56169 bytes as column bitmaps,  19062 bytes packed (67% saved)
+ * Latin + Japanese:              61480 bytes as column bitmaps,  28624 bytes packed (54% saved)
+ * Latin:                         39784 bytes as column bitmaps,  14936 bytes packed (63% saved)
+ */
+
+#include <asf.h>
+
+#include "Configuration.hpp"
+
+#if USE_CYRILLIC_CHARACTERS && USE_JAPANESE_CHARACTERS
+
+extern const uint8_t glcd28x32_packed[] =
+{
+	28,			// character width in pixels
+	32,			// row height in pixels
+	3,			// space columns between characters before kerning
+	3,			// font format: sparse packed
+	0x20, 0x00,	// lowest character code (2 bytes, little endian)
+	0xFF, 0x30,	// highest character code (2 bytes, little endian)
+
+	// Number of ranges, then the first code, last code and first glyph of each range (2 bytes each, little endian)
+	0x03, 0x00,
+	0x20, 0x00, 0x7F, 0x01, 0x00, 0x00,
+	0x01, 0x04, 0x91, 0x04, 0x60, 0x01,
+	0x40, 0x30, 0xFF, 0x30, 0xF1, 0x01,
+
+	// Number of edge columns (2 bytes, little endian), then the edge columns
+	0xFD, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x8F, 0x03, 0xC0, 0x7F, 0x80, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xE0, 0xFF, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0x00, 0x80, 0x33, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x03, 0x60, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x00,
+	0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x1C, 0x80, 0x33,
+	0x00, 0x1C, 0x80, 0x3F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0xC0, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0xFF, 0x1F, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+	0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x07, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0xF0, 0xFF, 0x03, 0x60, 0xFC, 0xFF, 0x03,
+	0x60, 0xFC, 0xFF, 0x1F, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x40, 0xC0, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0xFC, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x01,
+	0x00, 0x00, 0x03, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x1C, 0xFE, 0x7F, 0x00, 0x1C, 0xFF, 0x7F, 0x00, 0x18, 0x38, 0x00,
+	0x00, 0x80, 0x01, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xEC, 0x37, 0x00, 0xE0, 0xFF, 0xE0, 0xFF, 0x00, 0x83, 0x03, 0x03, 0x80, 0xC1, 0xE7, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x01, 0x03, 0x00, 0x80, 0x0F, 0x02, 0x00,
+	0x80, 0x81, 0x01, 0x00, 0x80, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x0F, 0x02,
+	0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x00, 0x20, 0xC0, 0x01, 0x00,
+	0x00, 0xF0, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC2,
+	0x00, 0x00, 0x00, 0xC3, 0x00, 0x06, 0x70, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0xC7, 0x00, 0x00, 0xE0, 0x07, 0x00,
+	0x00, 0x06, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0xC0, 0xFF, 0xFF, 0xC3, 0x60, 0xFC, 0xFF, 0xC3, 0xCC, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x00, 0x60, 0xFC, 0xFF, 0x3F, 0xCC, 0xFF, 0x7F, 0x00, 0x80, 0x01, 0x00, 0xC0, 0x00, 0x04, 0x00, 0x02,
+	0xE4, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x9B, 0xE0, 0xFF, 0xFF, 0x7B, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xC0, 0x11, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x3F,
+	0x00, 0xF0, 0xFF, 0x00, 0x30, 0xF0, 0xFF, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x9B, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x38, 0xFC, 0x01, 0x00, 0x20, 0x78, 0x00, 0x00, 0x0C, 0x03, 0x00,
+	0x00, 0x0C, 0x03, 0x03, 0xC0, 0xFF, 0x7F, 0x00, 0x30, 0xFC, 0xFF, 0x03, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0x00,
+	0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0C, 0x7C, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x04, 0x40, 0x00,
+	0x00, 0x3C, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x60, 0xF8, 0x00, 0x00, 0xE0, 0xF8, 0x00, 0x00, 0x80, 0xC7, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x60, 0xC0, 0x00, 0x00, 0xE0, 0xF0, 0x00,
+	0x00, 0xF8, 0xFF, 0x03, 0x00, 0xC0, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x7F, 0x20, 0x18, 0x00, 0x00, 0x00, 0xE0, 0xC1, 0x00, 0x00, 0x60, 0xF0, 0x00, 0xC0, 0xF8, 0xFF, 0x03,
+	0xC0, 0xF8, 0xFF, 0x7F, 0x00, 0xE0, 0xFF, 0x03, 0xC0, 0x02, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF0, 0x01,
+	0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x30, 0x00, 0x10, 0x00, 0x70, 0x00, 0x00, 0x40, 0x00, 0x00, 0x18, 0x00, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0xC0, 0x07, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x01, 0x00, 0x00,
+	0x00, 0x0C, 0x00, 0x02, 0x00, 0x1E, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xC0, 0x0F, 0x00,
+	0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x30, 0x00, 0x00, 0x40, 0x08, 0x00,
+	0x00, 0xF8, 0x1F, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x18, 0x80, 0x01, 0xE0, 0x01, 0x80, 0x00, 0x00, 0xF0, 0xFF, 0x1F,
+	0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x0C, 0x60, 0x00, 0x40, 0x00, 0x00, 0x06, 0x00, 0x80, 0x07, 0x00, 0xC0, 0xFF, 0xFF, 0x3F,
+
+	// Width, leading edge and trailing edge of each glyph
+	0x0B, 0x00, 0x00, 0x03, 0x01, 0x02, 0x08, 0x03, 0x03, 0x10, 0x04, 0x05, 0x10, 0x06, 0x07, 0x18, 0x08, 0x09, 0x12, 0x0A, 0x0B, 0x02, 0x03, 0x03, 0x07, 0x0C, 0x0D, 0x07, 0x0D, 0x0C,
+	0x0B, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x02, 0x10, 0x11, 0x08, 0x12, 0x12, 0x02, 0x13, 0x13, 0x08, 0x0B, 0x14, 0x0E, 0x15, 0x15, 0x0D, 0x0B, 0x0B, 0x0E, 0x0B, 0x0B, 0x0E, 0x06, 0x16,
+	0x0E, 0x17, 0x04, 0x0E, 0x06, 0x18, 0x0D, 0x19, 0x1A, 0x0E, 0x1B, 0x1B, 0x0E, 0x16, 0x16, 0x0E, 0x1C, 0x1D, 0x02, 0x1E, 0x1E, 0x02, 0x1F, 0x20, 0x0F, 0x21, 0x22, 0x0F, 0x23, 0x23,
+	0x0F, 0x22, 0x21, 0x0E, 0x24, 0x25, 0x19, 0x26, 0x0F, 0x13, 0x27, 0x27, 0x0F, 0x28, 0x09, 0x13, 0x0F, 0x06, 0x12, 0x28, 0x29, 0x10, 0x28, 0x0B, 0x0F, 0x28, 0x1B, 0x14, 0x0F, 0x2A,
+	0x11, 0x28, 0x28, 0x03, 0x28, 0x28, 0x0D, 0x07, 0x2B, 0x10, 0x28, 0x27, 0x0D, 0x28, 0x0B, 0x13, 0x28, 0x28, 0x11, 0x28, 0x28, 0x15, 0x29, 0x2C, 0x0F, 0x28, 0x2D, 0x15, 0x29, 0x2C,
+	0x11, 0x28, 0x2E, 0x11, 0x06, 0x16, 0x11, 0x1B, 0x1B, 0x11, 0x2F, 0x2F, 0x13, 0x30, 0x30, 0x1C, 0x31, 0x31, 0x11, 0x27, 0x27, 0x11, 0x30, 0x30, 0x10, 0x13, 0x0B, 0x06, 0x32, 0x0D,
+	0x08, 0x14, 0x0B, 0x06, 0x0D, 0x32, 0x0E, 0x33, 0x33, 0x10, 0x34, 0x34, 0x06, 0x35, 0x36, 0x0F, 0x37, 0x0B, 0x0D, 0x38, 0x39, 0x0D, 0x39, 0x3A, 0x0D, 0x39, 0x38, 0x0E, 0x39, 0x3B,
+	0x08, 0x24, 0x3C, 0x0D, 0x39, 0x3D, 0x0C, 0x38, 0x3E, 0x03, 0x3F, 0x3F, 0x05, 0x34, 0x40, 0x0C, 0x38, 0x27, 0x03, 0x38, 0x38, 0x15, 0x41, 0x3E, 0x0C, 0x41, 0x3E, 0x0E, 0x39, 0x39,
+	0x0D, 0x42, 0x39, 0x0D, 0x39, 0x42, 0x08, 0x41, 0x24, 0x0D, 0x43, 0x44, 0x08, 0x24, 0x45, 0x0C, 0x46, 0x41, 0x0D, 0x0E, 0x0E, 0x15, 0x24, 0x24, 0x0B, 0x45, 0x45, 0x0D, 0x0E, 0x0E,
+	0x0C, 0x0B, 0x0B, 0x09, 0x12, 0x0D, 0x02, 0x32, 0x32, 0x09, 0x0D, 0x12, 0x0F, 0x21, 0x2C, 0x05, 0x47, 0x47, 0x03, 0x00, 0x00, 0x1A, 0x48, 0x48, 0x0C, 0x49, 0x49, 0x1A, 0x48, 0x48,
+	0x0C, 0x4A, 0x4A, 0x0E, 0x4B, 0x4B, 0x0E, 0x4C, 0x4C, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x4D, 0x4E,
+	0x0C, 0x15, 0x4F, 0x0E, 0x50, 0x51, 0x0C, 0x52, 0x52, 0x10, 0x30, 0x30, 0x02, 0x53, 0x53, 0x0C, 0x54, 0x55, 0x08, 0x49, 0x49, 0x15, 0x0F, 0x0F, 0x0B, 0x56, 0x57, 0x0E, 0x58, 0x59,
+	0x0F, 0x0F, 0x5A, 0x08, 0x12, 0x12, 0x15, 0x0F, 0x0F, 0x10, 0x5B, 0x5B, 0x08, 0x5C, 0x5C, 0x0E, 0x5D, 0x5D, 0x08, 0x5E, 0x5F, 0x08, 0x60, 0x61, 0x06, 0x36, 0x35, 0x0E, 0x42, 0x0B,
+	0x0E, 0x25, 0x30, 0x02, 0x3B, 0x3B, 0x05, 0x34, 0x62, 0x08, 0x63, 0x64, 0x0B, 0x65, 0x65, 0x0E, 0x59, 0x58, 0x16, 0x63, 0x66, 0x16, 0x63, 0x67, 0x15, 0x60, 0x66, 0x0E, 0x68, 0x69,
+	0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x1B, 0x0B, 0x0B, 0x13, 0x0F, 0x06, 0x10, 0x28, 0x0B, 0x10, 0x28, 0x0B,
+	0x10, 0x28, 0x0B, 0x10, 0x28, 0x0B, 0x06, 0x6A, 0x6B, 0x06, 0x6C, 0x6A, 0x08, 0x6D, 0x6B, 0x07, 0x6D, 0x6D, 0x14, 0x0F, 0x29, 0x11, 0x28, 0x28, 0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C,
+	0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C, 0x0D, 0x6E, 0x6E, 0x15, 0x29, 0x6F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x30, 0x30,
+	0x0F, 0x28, 0x70, 0x0F, 0x71, 0x72, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x18, 0x73, 0x3B, 0x0D, 0x39, 0x3A,
+	0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x06, 0x74, 0x75, 0x06, 0x75, 0x74, 0x0A, 0x75, 0x75, 0x08, 0x1B, 0x1B, 0x0E, 0x26, 0x76, 0x0C, 0x41, 0x3E,
+	0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x0F, 0x0F, 0x10, 0x27, 0x0E, 0x0C, 0x46, 0x41, 0x0C, 0x46, 0x41, 0x0C, 0x46, 0x41,
+	0x0C, 0x46, 0x41, 0x0D, 0x0E, 0x0E, 0x0D, 0x32, 0x39, 0x0D, 0x0E, 0x0E, 0x13, 0x27, 0x27, 0x0F, 0x73, 0x0B, 0x13, 0x27, 0x27, 0x0F, 0x73, 0x0B, 0x13, 0x27, 0x77, 0x0F, 0x73, 0x78,
+	0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x11, 0x28, 0x19, 0x10, 0x7A, 0x7C,
+	0x13, 0x0F, 0x19, 0x0E, 0x7A, 0x38, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x78, 0x0D, 0x7D, 0x7E,
+	0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81,
+	0x11, 0x28, 0x28, 0x0D, 0x38, 0x3E, 0x14, 0x82, 0x82, 0x0F, 0x49, 0x3E, 0x08, 0x6D, 0x6D, 0x08, 0x1B, 0x1B, 0x06, 0x83, 0x83, 0x06, 0x1B, 0x1B, 0x08, 0x84, 0x85, 0x08, 0x86, 0x87,
+	0x05, 0x62, 0x88, 0x05, 0x62, 0x89, 0x03, 0x8A, 0x8A, 0x03, 0x41, 0x41, 0x10, 0x28, 0x8B, 0x09, 0x3F, 0x8C, 0x0D, 0x06, 0x8D, 0x07, 0x8E, 0x49, 0x11, 0x28, 0x27, 0x0D, 0x38, 0x8F,
+	0x0D, 0x41, 0x8F, 0x0D, 0x28, 0x0B, 0x04, 0x90, 0x84, 0x0D, 0x28, 0x0B, 0x03, 0x91, 0x92, 0x0D, 0x28, 0x0B, 0x06, 0x38, 0x93, 0x0D, 0x28, 0x0B, 0x07, 0x38, 0x0F, 0x0F, 0x3B, 0x0B,
+	0x05, 0x94, 0x38, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x10, 0x95, 0x3E, 0x10, 0x28, 0x96, 0x0D, 0x41, 0x97,
+	0x13, 0x70, 0x19, 0x0D, 0x7A, 0x98, 0x13, 0x70, 0x19, 0x0D, 0x7A, 0x98, 0x13, 0x70, 0x19, 0x0D, 0x7A, 0x99, 0x1B, 0x70, 0x0B, 0x18, 0x7A, 0x7E, 0x12, 0x28, 0x27, 0x07, 0x41, 0x9A,
+	0x12, 0x28, 0x27, 0x06, 0x9B, 0x24, 0x12, 0x28, 0x27, 0x08, 0x74, 0x9A, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D,
+	0x10, 0x06, 0x9C, 0x0E, 0x66, 0x9E, 0x10, 0x1B, 0x1B, 0x08, 0x24, 0x45, 0x10, 0x1B, 0x1B, 0x0A, 0x24, 0x93, 0x10, 0x1B, 0x1B, 0x08, 0x9F, 0xA0, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41,
+	0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0xA2, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41,
+	0x1A, 0x1B, 0xA3, 0x14, 0x24, 0xA4, 0x12, 0x30, 0x1B, 0x0D, 0x0E, 0xA5, 0x12, 0x30, 0x1B, 0x10, 0x13, 0x0B, 0x0D, 0x13, 0x0B, 0x10, 0x13, 0x0B, 0x0D, 0x13, 0x0B, 0x10, 0x13, 0x0B,
+	0x0D, 0x13, 0x0B, 0x04, 0xA6, 0x14, 0x12, 0x00, 0x0B, 0x15, 0x49, 0xA7, 0x0E, 0x00, 0x49, 0x13, 0xA8, 0x6E, 0x11, 0xA9, 0xAA, 0x05, 0x00, 0xA6, 0x08, 0x5B, 0x5B, 0x0B, 0xA9, 0xAB,
+	0x1C, 0x0B, 0x0A, 0x1A, 0x00, 0x0A, 0x15, 0x49, 0xAC, 0x10, 0x00, 0xAD, 0x12, 0x00, 0xA6, 0x12, 0x75, 0x75, 0x11, 0x00, 0xA6, 0x12, 0x27, 0x27, 0x0F, 0x00, 0x0A, 0x11, 0x00, 0x0A,
+	0x0E, 0x00, 0x49, 0x12, 0xAE, 0xAE, 0x12, 0x00, 0x0B, 0x19, 0xAD, 0xAD, 0x0F, 0xAF, 0xB0, 0x11, 0x00, 0xA6, 0x11, 0x00, 0xA6, 0x10, 0x00, 0xAD, 0x0F, 0x0B, 0xA6, 0x14, 0x00, 0xA6,
+	0x11, 0x00, 0xA6, 0x14, 0xA8, 0xA8, 0x11, 0x00, 0xA6, 0x11, 0x00, 0xB1, 0x13, 0xA8, 0x6E, 0x0F, 0x49, 0x49, 0x12, 0x75, 0x75, 0x13, 0x7F, 0x7F, 0x11, 0xAD, 0xAD, 0x13, 0x00, 0xAE,
+	0x10, 0x00, 0xA6, 0x17, 0x00, 0xA6, 0x19, 0x00, 0xAE, 0x14, 0x49, 0x0A, 0x16, 0x00, 0xA6, 0x10, 0x00, 0x0A, 0x12, 0x6E, 0xA8, 0x1A, 0x00, 0xA8, 0x11, 0x27, 0xA6, 0x0E, 0xB2, 0x0B,
+	0x0F, 0x00, 0x26, 0x0C, 0x00, 0xB3, 0x0A, 0x00, 0x05, 0x0F, 0xAE, 0xAE, 0x0D, 0x76, 0xB4, 0x12, 0xB5, 0xB5, 0x0B, 0xB6, 0xB7, 0x0E, 0x00, 0xB8, 0x0E, 0x00, 0xB8, 0x0C, 0x00, 0xB5,
+	0x0E, 0x0B, 0xB8, 0x11, 0x00, 0xB8, 0x0D, 0x00, 0xB8, 0x0D, 0x76, 0x76, 0x0D, 0x00, 0xB8, 0x0E, 0x00, 0x7A, 0x0D, 0x76, 0xB9, 0x0C, 0x05, 0x05, 0x0E, 0x05, 0x05, 0x16, 0x76, 0x76,
+	0x0D, 0xB5, 0xB5, 0x10, 0x00, 0xAE, 0x0D, 0x00, 0xB8, 0x14, 0x00, 0xB8, 0x16, 0x00, 0xAE, 0x0F, 0x05, 0x73, 0x12, 0x00, 0xB8, 0x0D, 0x00, 0x73, 0x0C, 0xB6, 0x76, 0x13, 0x00, 0x76,
+	0x0D, 0x27, 0xB8, 0x12, 0x00, 0xA6, 0x0D, 0x76, 0xB4, 0x0E, 0xBA, 0xBB, 0x0A, 0x00, 0xBC, 0x0E, 0x76, 0x43, 0x0C, 0xBD, 0xBE, 0x04, 0x00, 0xBF, 0x08, 0x1B, 0x1B, 0x04, 0x34, 0xC0,
+	0x16, 0x0B, 0x73, 0x14, 0x00, 0x73, 0x0E, 0xBA, 0xC1, 0x0C, 0x00, 0xB5, 0x12, 0x00, 0xA6, 0x0E, 0x05, 0x05, 0x0D, 0x00, 0xB8, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6,
+	0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6,
+	0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6,
+	0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6,
+	0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x01, 0xC2, 0xC2, 0x01, 0xC3, 0xC3, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6,
+	0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x0D, 0x00, 0xC4, 0x0B, 0x00, 0xC5, 0x19, 0x00, 0xC6, 0x18, 0x00, 0xC7, 0x19, 0x00, 0xC8,
+	0x18, 0x00, 0xC9, 0x19, 0x00, 0x73, 0x15, 0x00, 0x0A, 0x16, 0x00, 0xCA, 0x17, 0x00, 0xCB, 0x19, 0x00, 0xCB, 0x19, 0x00, 0x33, 0x1A, 0x00, 0x1C, 0x1A, 0xCC, 0x3B, 0x1B, 0xCC, 0x75,
+	0x18, 0x00, 0xCD, 0x1A, 0x00, 0x30, 0x14, 0x00, 0xCE, 0x17, 0x00, 0xCF, 0x1A, 0x00, 0x1C, 0x1B, 0x00, 0x75, 0x17, 0x00, 0xD0, 0x1B, 0x00, 0x1B, 0x18, 0x00, 0xD1, 0x1B, 0x00, 0x30,
+	0x19, 0x00, 0x66, 0x19, 0x00, 0x66, 0x1A, 0x00, 0x82, 0x1A, 0xD2, 0x75, 0x1A, 0xD3, 0xD4, 0x1B, 0xD3, 0x49, 0x18, 0x00, 0x0F, 0x19, 0x12, 0xD5, 0x1A, 0x00, 0x69, 0x1B, 0x05, 0xD6,
+	0x17, 0x00, 0x73, 0x1B, 0x00, 0x1B, 0x18, 0x00, 0x09, 0x19, 0xD7, 0xD8, 0x1B, 0xD9, 0x36, 0x18, 0x00, 0x49, 0x1A, 0x00, 0x33, 0x17, 0x00, 0xD0, 0x1B, 0x00, 0x36, 0x1A, 0xDA, 0xD4,
+	0x19, 0x00, 0xDB, 0x1B, 0xDC, 0x69, 0x1B, 0xDD, 0xDE, 0x19, 0x00, 0x39, 0x1B, 0x00, 0x27, 0x1B, 0x00, 0x1B, 0x1B, 0x00, 0x1B, 0x1A, 0x00, 0x94, 0x1C, 0x00, 0x36, 0x1B, 0x00, 0xDF,
+	0x1B, 0xDB, 0x27, 0x1A, 0xDB, 0xE0, 0x1B, 0xDB, 0xE1, 0x1B, 0xE2, 0xDE, 0x1A, 0xE2, 0xDE, 0x1A, 0xE2, 0x0B, 0x1A, 0x00, 0x27, 0x1B, 0x00, 0x49, 0x1C, 0x00, 0xE3, 0x18, 0x00, 0x69,
+	0x1A, 0xE4, 0x06, 0x1A, 0x00, 0xD9, 0x19, 0x00, 0x26, 0x18, 0x00, 0x73, 0x17, 0x00, 0xE5, 0x19, 0x21, 0xE6, 0x18, 0x00, 0x09, 0x19, 0x00, 0xE7, 0x16, 0x00, 0xD0, 0x18, 0x00, 0x27,
+	0x17, 0x00, 0x73, 0x16, 0x00, 0xE8, 0x18, 0x00, 0x73, 0x1B, 0xDD, 0xE9, 0x17, 0x00, 0x73, 0x18, 0x00, 0x0A, 0x1A, 0xDD, 0xCA, 0x19, 0x00, 0xC8, 0x19, 0xEA, 0xEB, 0x18, 0x00, 0xEC,
+	0x1A, 0xED, 0xA9, 0x1A, 0x00, 0x0E, 0x19, 0x00, 0x07, 0x18, 0x00, 0x2C, 0x19, 0x00, 0xC6, 0x19, 0x00, 0xC6, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0xDF, 0x36, 0x06, 0x93, 0x93,
+	0x15, 0x00, 0xEE, 0x16, 0x00, 0x24, 0x18, 0xED, 0x0E, 0x14, 0x00, 0xEF, 0x18, 0x00, 0xD9, 0x1A, 0x00, 0x36, 0x16, 0x00, 0xD5, 0x18, 0x00, 0x30, 0x17, 0x00, 0xCF, 0x18, 0x00, 0x65,
+	0x17, 0x00, 0xD0, 0x19, 0x69, 0x69, 0x18, 0x00, 0x0F, 0x19, 0x00, 0x05, 0x17, 0x00, 0xF0, 0x1A, 0x00, 0x49, 0x19, 0x00, 0x3B, 0x1A, 0xF1, 0x30, 0x18, 0x00, 0x0E, 0x1B, 0x64, 0x75,
+	0x1A, 0x64, 0x05, 0x1A, 0x64, 0x75, 0x17, 0x00, 0xF2, 0x1A, 0x00, 0x14, 0x1A, 0xD4, 0xD4, 0x1A, 0xD4, 0x49, 0x19, 0x00, 0xD3, 0x1B, 0x00, 0xD6, 0x19, 0x00, 0xF3, 0x1A, 0xF3, 0x30,
+	0x18, 0x2C, 0x65, 0x1B, 0x21, 0x75, 0x18, 0x00, 0x49, 0x1A, 0x00, 0x30, 0x18, 0x64, 0x0E, 0x1B, 0x64, 0x30, 0x19, 0x00, 0x0F, 0x1A, 0x0F, 0xD5, 0x17, 0x00, 0xD4, 0x19, 0x00, 0x36,
+	0x1B, 0x00, 0x30, 0x19, 0x00, 0xD3, 0x1B, 0x00, 0x1B, 0x17, 0x00, 0x17, 0x18, 0x00, 0xD6, 0x19, 0x00, 0xD4, 0x19, 0x00, 0x0B, 0x17, 0x00, 0xF4, 0x1A, 0x00, 0x06, 0x16, 0x00, 0x75,
+	0x1A, 0xF3, 0xF3, 0x1B, 0xF3, 0x75, 0x1B, 0xED, 0x31, 0x18, 0x00, 0xDB, 0x1A, 0x00, 0x75, 0x1A, 0x00, 0x31, 0x18, 0x00, 0xD6, 0x1B, 0x00, 0x30, 0x1B, 0x00, 0xDF, 0x1B, 0xE2, 0xDE,
+	0x1A, 0x07, 0x27, 0x1A, 0x04, 0x0B, 0x1A, 0x00, 0xDD, 0x1A, 0xF5, 0x49, 0x1A, 0xF5, 0xF6, 0x1A, 0x00, 0xD6, 0x17, 0x00, 0x82, 0x1A, 0x69, 0xD0, 0x18, 0x00, 0xDE, 0x19, 0x00, 0x48,
+	0x18, 0x00, 0xCF, 0x1A, 0x56, 0x82, 0x18, 0x00, 0xD0, 0x1A, 0x0B, 0x0B, 0x15, 0x00, 0xF7, 0x17, 0x00, 0xF2, 0x18, 0x00, 0x56, 0x15, 0x00, 0xF8, 0x1B, 0xF3, 0xE2, 0x19, 0x00, 0x48,
+	0x18, 0x00, 0xF2, 0x17, 0x00, 0xEC, 0x18, 0x00, 0x82, 0x19, 0x00, 0xF9, 0x1A, 0x00, 0x69, 0x19, 0x00, 0x36, 0x1A, 0x00, 0x56, 0x1B, 0x00, 0x75, 0x16, 0x00, 0x5A, 0x18, 0x00, 0x0F,
+	0x1A, 0x00, 0x75, 0x1B, 0x00, 0x75, 0x1A, 0x00, 0xFA, 0x1A, 0x00, 0x30, 0x11, 0x00, 0xFB, 0x19, 0x00, 0x48, 0x15, 0x00, 0xDD, 0x17, 0x00, 0xD5, 0x16, 0x00, 0xFC,
+
+	// Glyph offsets (2 bytes each, little endian)
+	0x00, 0x00, 0x0D, 0x00, 0x14, 0x00, 0x24, 0x00, 0x56, 0x00, 0x85, 0x00, 0xC9, 0x00, 0x07, 0x01, 0x0B, 0x01, 0x20, 0x01, 0x35, 0x01, 0x5A, 0x01, 0x6C, 0x01, 0x73, 0x01, 0x7D, 0x01, 0x81, 0x01,
+	0x97, 0x01, 0xB8, 0x01, 0xD3, 0x01, 0x04, 0x02, 0x2C, 0x02, 0x50, 0x02, 0x79, 0x02, 0xA1, 0x02, 0xC7, 0x02, 0xF0, 0x02, 0x1A, 0x03, 0x1E, 0x03, 0x25, 0x03, 0x49, 0x03, 0x5A, 0x03, 0x7E, 0x03,
+	0xAC, 0x03, 0x0A, 0x04, 0x3F, 0x04, 0x60, 0x04, 0x8F, 0x04, 0xB3, 0x04, 0xCD, 0x04, 0xE2, 0x04, 0x1B, 0x05, 0x31, 0x05, 0x36, 0x05, 0x5A, 0x05, 0x85, 0x05, 0x96, 0x05, 0xC3, 0x05, 0xEB, 0x05,
+	0x1B, 0x06, 0x35, 0x06, 0x76, 0x06, 0x9A, 0x06, 0xD1, 0x06, 0xE8, 0x06, 0x11, 0x07, 0x44, 0x07, 0x8E, 0x07, 0xBE, 0x07, 0xEC, 0x07, 0x25, 0x08, 0x2E, 0x08, 0x44, 0x08, 0x4D, 0x08, 0x75, 0x08,
+	0x86, 0x08, 0x98, 0x08, 0xC4, 0x08, 0xE2, 0x08, 0x00, 0x09, 0x1E, 0x09, 0x44, 0x09, 0x55, 0x09, 0x79, 0x09, 0x8F, 0x09, 0x95, 0x09, 0xA3, 0x09, 0xC3, 0x09, 0xC8, 0x09, 0xF8, 0x09, 0x11, 0x0A,
+	0x2F, 0x0A, 0x4C, 0x0A, 0x69, 0x0A, 0x7A, 0x0A, 0xA2, 0x0A, 0xB1, 0x0A, 0xC8, 0x0A, 0xEB, 0x0A, 0x22, 0x0B, 0x41, 0x0B, 0x65, 0x0B, 0x8E, 0x0B, 0xA3, 0x0B, 0xA6, 0x0B, 0xBB, 0x0B, 0xD4, 0x0B,
+	0xE0, 0x0B, 0xE5, 0x0B, 0x0F, 0x0C, 0x31, 0x0C, 0x5B, 0x0C, 0x7D, 0x0C, 0xAD, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C,
+	0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C,
+	0xD7, 0x0C, 0xDA, 0x0C, 0xE1, 0x0C, 0x00, 0x0D, 0x27, 0x0D, 0x45, 0x0D, 0x7C, 0x0D, 0x7F, 0x0D, 0xB3, 0x0D, 0xC1, 0x0D, 0x06, 0x0E, 0x2A, 0x0E, 0x54, 0x0E, 0x73, 0x01, 0x65, 0x0E, 0xA8, 0x0E,
+	0xBA, 0x0E, 0xCF, 0x0E, 0xE3, 0x0E, 0xFF, 0x0E, 0x17, 0x0F, 0x27, 0x0F, 0x45, 0x0F, 0x61, 0x0F, 0x65, 0x0F, 0x70, 0x0F, 0x81, 0x0F, 0x9F, 0x0F, 0xC9, 0x0F, 0x0B, 0x10, 0x56, 0x10, 0x9B, 0x10,
+	0xC9, 0x10, 0x04, 0x11, 0x3F, 0x11, 0x7D, 0x11, 0xBC, 0x11, 0xF5, 0x11, 0x30, 0x12, 0x69, 0x12, 0xA2, 0x12, 0xCF, 0x12, 0xFC, 0x12, 0x39, 0x13, 0x61, 0x13, 0x74, 0x13, 0x84, 0x13, 0x9C, 0x13,
+	0xA9, 0x13, 0xD3, 0x13, 0x03, 0x14, 0x44, 0x14, 0x81, 0x14, 0xC5, 0x14, 0x02, 0x15, 0x3B, 0x15, 0x5F, 0x15, 0xA6, 0x15, 0xDA, 0x15, 0x0E, 0x16, 0x48, 0x16, 0x79, 0x16, 0xAD, 0x16, 0xC6, 0x16,
+	0xF8, 0x16, 0x2D, 0x17, 0x62, 0x17, 0x9B, 0x17, 0xCF, 0x17, 0xFF, 0x17, 0x39, 0x18, 0x7A, 0x18, 0x9D, 0x18, 0xD2, 0x18, 0x07, 0x19, 0x3C, 0x19, 0x69, 0x19, 0x7E, 0x19, 0x93, 0x19, 0xB1, 0x19,
+	0xC1, 0x19, 0xF0, 0x19, 0x15, 0x1A, 0x3F, 0x1A, 0x69, 0x1A, 0x94, 0x1A, 0xBE, 0x1A, 0xE2, 0x1A, 0xF5, 0x1A, 0x27, 0x1B, 0x4A, 0x1B, 0x6C, 0x1B, 0x92, 0x1B, 0xAF, 0x1B, 0xD5, 0x1B, 0xF2, 0x1B,
+	0x19, 0x1C, 0x56, 0x1C, 0x89, 0x1C, 0xC7, 0x1C, 0xFF, 0x1C, 0x35, 0x1D, 0x62, 0x1D, 0xA0, 0x1D, 0xC7, 0x1D, 0x08, 0x1E, 0x32, 0x1E, 0x65, 0x1E, 0x83, 0x1E, 0xC4, 0x1E, 0xEE, 0x1E, 0x2B, 0x1F,
+	0x4F, 0x1F, 0x77, 0x1F, 0x99, 0x1F, 0xB7, 0x1F, 0xDF, 0x1F, 0x12, 0x20, 0x3F, 0x20, 0x5D, 0x20, 0x84, 0x20, 0xA7, 0x20, 0xD3, 0x20, 0x0E, 0x21, 0x43, 0x21, 0x8B, 0x21, 0xBF, 0x21, 0x03, 0x22,
+	0x34, 0x22, 0x6F, 0x22, 0x9A, 0x22, 0xD8, 0x22, 0x07, 0x23, 0x3B, 0x23, 0x64, 0x23, 0x83, 0x23, 0xA7, 0x23, 0xBD, 0x23, 0xD3, 0x23, 0xE0, 0x23, 0xED, 0x23, 0x02, 0x24, 0x17, 0x24, 0x23, 0x24,
+	0x31, 0x24, 0x37, 0x24, 0x3C, 0x24, 0x67, 0x24, 0x7C, 0x24, 0xAD, 0x24, 0xC4, 0x24, 0xF3, 0x24, 0x16, 0x25, 0x37, 0x25, 0x57, 0x25, 0x66, 0x25, 0x81, 0x25, 0x8C, 0x25, 0xA6, 0x25, 0xB5, 0x25,
+	0xCA, 0x25, 0xD6, 0x25, 0xF3, 0x25, 0xFE, 0x25, 0x2B, 0x26, 0x52, 0x26, 0x7C, 0x26, 0x9C, 0x26, 0xCC, 0x26, 0xF8, 0x26, 0x1D, 0x27, 0x46, 0x27, 0x63, 0x27, 0x91, 0x27, 0xB2, 0x27, 0xED, 0x27,
+	0x12, 0x28, 0x54, 0x28, 0x7E, 0x28, 0xAE, 0x28, 0xE9, 0x28, 0x1E, 0x29, 0x33, 0x29, 0x62, 0x29, 0x74, 0x29, 0xB0, 0x29, 0xCF, 0x29, 0x0F, 0x2A, 0x43, 0x2A, 0x86, 0x2A, 0xBD, 0x2A, 0xF9, 0x2A,
+	0x27, 0x2B, 0x6A, 0x2B, 0xA4, 0x2B, 0xC0, 0x2B, 0xD8, 0x2B, 0x07, 0x2C, 0x1E, 0x2C, 0x38, 0x2C, 0x49, 0x2C, 0x7C, 0x2C, 0xA3, 0x2C, 0xCE, 0x2C, 0xED, 0x2C, 0x1F, 0x2D, 0x43, 0x2D, 0x74, 0x2D,
+	0x97, 0x2D, 0xCF, 0x2D, 0xF6, 0x2D, 0x25, 0x2E, 0x46, 0x2E, 0x93, 0x2E, 0xCE, 0x2E, 0x08, 0x2F, 0x30, 0x2F, 0x65, 0x2F, 0xA5, 0x2F, 0xD8, 0x2F, 0x15, 0x30, 0x45, 0x30, 0x88, 0x30, 0xBE, 0x30,
+	0xCA, 0x30, 0xF3, 0x30, 0x27, 0x31, 0x4C, 0x31, 0x7E, 0x31, 0xB3, 0x31, 0xBC, 0x31, 0xCE, 0x31, 0xE9, 0x31, 0x1E, 0x32, 0x4A, 0x32, 0x70, 0x32, 0x9C, 0x32, 0xB7, 0x32, 0xF3, 0x32, 0x0F, 0x33,
+	0x3F, 0x33, 0x5F, 0x33, 0x85, 0x33, 0x99, 0x33, 0xBD, 0x33, 0xD8, 0x33, 0x17, 0x34, 0x41, 0x34, 0x6C, 0x34, 0x9E, 0x34, 0xC4, 0x34, 0xE1, 0x34, 0x11, 0x35, 0x29, 0x35, 0x53, 0x35, 0x6C, 0x35,
+	0x8B, 0x35, 0xB8, 0x35, 0xCF, 0x35, 0x03, 0x36, 0x2E, 0x36, 0x5F, 0x36, 0x7B, 0x36, 0x97, 0x36, 0xBA, 0x36, 0xE0, 0x36, 0x03, 0x37, 0x2C, 0x37, 0x4B, 0x37, 0x79, 0x37, 0xAE, 0x37, 0xD5, 0x37,
+	0xF9, 0x37, 0x24, 0x38, 0x3D, 0x38, 0x4C, 0x38, 0x69, 0x38, 0x8D, 0x38, 0xBE, 0x38, 0xDD, 0x38, 0xFE, 0x38, 0x26, 0x39, 0x44, 0x39, 0x5D, 0x39, 0x84, 0x39, 0x97, 0x39, 0xB4, 0x39, 0xC7, 0x39,
+	0xE4, 0x39, 0x03, 0x3A, 0x14, 0x3A, 0x3A, 0x3A, 0x69, 0x3A, 0x8E, 0x3A, 0xA5, 0x3A, 0xBF, 0x3A, 0xDC, 0x3A, 0xFC, 0x3A, 0x18, 0x3B, 0x3A, 0x3B, 0x54, 0x3B, 0x75, 0x3B, 0x9B, 0x3B, 0x9C, 0x32,
+	0xB8, 0x3B, 0xE3, 0x3B, 0x07, 0x3C, 0x23, 0x3C, 0x46, 0x3C, 0x6B, 0x3C, 0x73, 0x3C, 0x84, 0x3C, 0x8E, 0x3C, 0xBB, 0x3C, 0xDF, 0x3C, 0x00, 0x3D, 0x9C, 0x32, 0x23, 0x3D, 0x4D, 0x3D, 0x9C, 0x32,
+	0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32,
+	0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32,
+	0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x63, 0x3D, 0x67, 0x3D, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x6A, 0x3D,
+	0x7F, 0x3D, 0x91, 0x3D, 0x05, 0x3E, 0x57, 0x3E, 0xB3, 0x3E, 0xE9, 0x3E, 0x26, 0x3F, 0x60, 0x3F, 0xA6, 0x3F, 0xEF, 0x3F, 0x41, 0x40, 0x8C, 0x40, 0xE2, 0x40, 0x28, 0x41, 0x77, 0x41, 0xCC, 0x41,
+	0x2E, 0x42, 0x64, 0x42, 0xA6, 0x42, 0xE3, 0x42, 0x2F, 0x43, 0x5A, 0x43, 0x97, 0x43, 0xD9, 0x43, 0x29, 0x44, 0x61, 0x44, 0x9C, 0x44, 0xDB, 0x44, 0x2E, 0x45, 0x68, 0x45, 0xAD, 0x45, 0xF3, 0x45,
+	0x49, 0x46, 0x88, 0x46, 0xDA, 0x46, 0x1F, 0x47, 0x72, 0x47, 0xA5, 0x47, 0xDE, 0x47, 0x21, 0x48, 0x60, 0x48, 0xAC, 0x48, 0xE9, 0x48, 0x37, 0x49, 0x85, 0x49, 0xBA, 0x49, 0x0D, 0x4A, 0x5C, 0x4A,
+	0xA4, 0x4A, 0xEC, 0x4A, 0x38, 0x4B, 0x88, 0x4B, 0xD4, 0x4B, 0x2B, 0x4C, 0x84, 0x4C, 0xD9, 0x4C, 0x2C, 0x4D, 0x86, 0x4D, 0xD3, 0x4D, 0x1D, 0x4E, 0x6A, 0x4E, 0xB4, 0x4E, 0x05, 0x4F, 0x5C, 0x4F,
+	0xA0, 0x4F, 0xF9, 0x4F, 0x40, 0x50, 0x8E, 0x50, 0xCF, 0x50, 0x0C, 0x51, 0x52, 0x51, 0x93, 0x51, 0xD9, 0x51, 0x0D, 0x52, 0x4B, 0x52, 0x8C, 0x52, 0xC8, 0x52, 0x24, 0x53, 0x70, 0x53, 0xC0, 0x53,
+	0xFF, 0x53, 0x48, 0x54, 0xA2, 0x54, 0x08, 0x55, 0x61, 0x55, 0xA9, 0x55, 0xFF, 0x55, 0x42, 0x56, 0x91, 0x3D, 0x91, 0x3D, 0xD7, 0x0C, 0xD7, 0x0C, 0x7E, 0x56, 0x93, 0x56, 0xA6, 0x56, 0xD6, 0x56,
+	0x0E, 0x57, 0x60, 0x57, 0x78, 0x57, 0xB5, 0x57, 0x06, 0x58, 0x3E, 0x58, 0x7B, 0x58, 0xB1, 0x58, 0xEA, 0x58, 0x0C, 0x59, 0x31, 0x59, 0x69, 0x59, 0xAA, 0x59, 0xE2, 0x59, 0x27, 0x5A, 0x67, 0x5A,
+	0xB6, 0x5A, 0xFC, 0x5A, 0x51, 0x5B, 0x8D, 0x5B, 0xDB, 0x5B, 0xF8, 0x5B, 0x27, 0x5C, 0x5B, 0x5C, 0xA1, 0x5C, 0xEA, 0x5C, 0x3C, 0x5D, 0x84, 0x5D, 0xD5, 0x5D, 0x14, 0x5E, 0x5F, 0x5E, 0x9F, 0x5E,
+	0xEB, 0x5E, 0x3C, 0x5F, 0x97, 0x5F, 0xD3, 0x5F, 0x1B, 0x60, 0x59, 0x60, 0x9E, 0x60, 0xEE, 0x60, 0x2C, 0x61, 0x7E, 0x61, 0xAA, 0x61, 0xDD, 0x61, 0x0F, 0x62, 0x30, 0x62, 0x7B, 0x62, 0xC5, 0x62,
+	0xFD, 0x62, 0x3E, 0x63, 0x87, 0x63, 0xD1, 0x63, 0x07, 0x64, 0x4A, 0x64, 0x8D, 0x64, 0xCB, 0x64, 0x14, 0x65, 0x5C, 0x65, 0xA8, 0x65, 0xF2, 0x65, 0x3F, 0x66, 0x7F, 0x66, 0xC7, 0x66, 0x10, 0x67,
+	0x5B, 0x67, 0xA5, 0x67, 0xEE, 0x67, 0x2F, 0x68, 0x5D, 0x68, 0x9B, 0x68, 0xE7, 0x68, 0x0E, 0x69, 0x3A, 0x69, 0x58, 0x69, 0x78, 0x69, 0xC0, 0x69, 0xED, 0x69, 0x33, 0x6A, 0x6B, 0x6A, 0x8B, 0x6A,
+	0xC1, 0x6A, 0xF9, 0x6A, 0x1F, 0x6B, 0x5D, 0x6B, 0xA9, 0x6B, 0xF1, 0x6B, 0x38, 0x6C, 0x64, 0x6C, 0x99, 0x6C, 0xE0, 0x6C, 0x18, 0x6D, 0x59, 0x6D, 0xB0, 0x6D, 0xC6, 0x6D, 0xE3, 0x6D, 0x11, 0x6E,
+	0x47, 0x6E,
+
+	// Glyphs
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x33, 0x06, 0x00, 0x96, 0x38, 0x06, 0x66, 0x0F, 0x05, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x56, 0x0F, 0x06,
+	0x66, 0x0F, 0x05, 0x00, 0x0F, 0x24, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x26, 0x32, 0x06, 0x2B, 0x75, 0x07, 0xAB, 0x0B, 0x88, 0x23, 0x0B, 0x46, 0x21, 0x26, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x26, 0x14,
+	0x06, 0x2B, 0x76, 0x06, 0x2B, 0x83, 0x08, 0xBA, 0x0B, 0x76, 0x26, 0x0B, 0x36, 0x22, 0x26, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x0F, 0x04, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x68, 0x56, 0x07, 0x87,
+	0x37, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x00, 0xF4, 0x90, 0x04, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x36, 0x36, 0x35, 0x06, 0x37, 0x36, 0x24, 0x07, 0x38, 0x95, 0x07, 0x29,
+	0x76, 0x08, 0x0F, 0x15, 0x0B, 0x69, 0x0F, 0x02, 0xA7, 0x0F, 0x36, 0x36, 0x0E, 0x26, 0x28, 0x0E, 0x00, 0x26, 0x28, 0x26, 0x06, 0x36, 0x36, 0x35, 0x06, 0xA7, 0x44, 0x07, 0x78, 0x35, 0x09, 0x0F,
+	0x33, 0x0B, 0x0F, 0x32, 0x0C, 0x3F, 0x0E, 0x3E, 0x0F, 0x3C, 0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x39, 0x84, 0x08, 0x38, 0xA4, 0x07, 0x36, 0x35, 0x36, 0x06, 0x26, 0x26, 0x28, 0x06, 0x2E, 0x28, 0x06,
+	0x00, 0x3E, 0x36, 0x06, 0xAF, 0x07, 0x0F, 0x62, 0x09, 0x0F, 0x53, 0x09, 0x0F, 0x72, 0x08, 0x0F, 0x41, 0x41, 0x07, 0x3F, 0x35, 0x06, 0x68, 0x21, 0x27, 0x06, 0xA7, 0x27, 0x06, 0x36, 0x54, 0x26,
+	0x06, 0x26, 0x65, 0x25, 0x06, 0x26, 0x25, 0x42, 0x23, 0x06, 0x26, 0x34, 0x34, 0x21, 0x07, 0x36, 0x23, 0x56, 0x07, 0x67, 0x38, 0x08, 0x48, 0x67, 0x07, 0x0F, 0x52, 0x31, 0x06, 0x5F, 0x24, 0x06,
+	0x2F, 0x27, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x66, 0x0F, 0x05, 0x00, 0xBD, 0x08, 0xFA, 0x20, 0x05, 0x89, 0x83, 0x04, 0x57, 0x5D, 0x02, 0x46, 0x0F, 0x42, 0x01, 0x35, 0x0F, 0x36, 0x25, 0x0F, 0x28,
+	0x25, 0x0F, 0x28, 0x35, 0x0F, 0x36, 0x46, 0x0F, 0x42, 0x01, 0x57, 0x5D, 0x02, 0x89, 0x83, 0x04, 0xFA, 0x20, 0x05, 0xBD, 0x08, 0x1A, 0x0F, 0x06, 0x29, 0x0F, 0x06, 0x29, 0x13, 0x0F, 0x02, 0x1A,
+	0x32, 0x0F, 0x01, 0x4A, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0x4A, 0x0F, 0x03, 0x1A, 0x32, 0x0F, 0x01, 0x29, 0x13, 0x0F, 0x02, 0x29, 0x0F, 0x06, 0x1A, 0x0F, 0x06, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE9, 0x09, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x38, 0x22, 0x02, 0x0F, 0x78, 0x02, 0x0F, 0x22, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x38, 0x06,
+	0x00, 0x0F, 0x29, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x82, 0x07, 0x9D, 0x0A, 0x8A, 0x0E, 0x86, 0x0F, 0x03, 0x65, 0x0F, 0x06, 0x25, 0x0F, 0x0A, 0x8C, 0x0C, 0xE9, 0x09, 0xF8, 0x10, 0x08, 0x37, 0x3C,
+	0x07, 0x36, 0x3E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x36, 0x3E, 0x06, 0x37, 0x4B, 0x07, 0xF8, 0x10, 0x08, 0xE9, 0x09, 0x8C, 0x0C, 0x0F, 0x29, 0x06, 0x29, 0x2D, 0x06, 0x38, 0x2D,
+	0x06, 0x37, 0x2E, 0x06, 0x27, 0x2F, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x29, 0x4B, 0x06, 0x47, 0x5A, 0x06, 0x37, 0x6A, 0x06, 0x36,
+	0x3A, 0x22, 0x06, 0x26, 0x3A, 0x23, 0x06, 0x26, 0x39, 0x24, 0x06, 0x26, 0x29, 0x25, 0x06, 0x26, 0x28, 0x26, 0x06, 0x36, 0x36, 0x26, 0x06, 0x37, 0x43, 0x27, 0x06, 0x97, 0x28, 0x06, 0x68, 0x2A,
+	0x06, 0x0F, 0x29, 0x06, 0x0F, 0x16, 0x0A, 0x38, 0x49, 0x08, 0x47, 0x59, 0x07, 0x37, 0x2D, 0x07, 0x36, 0x3E, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36, 0x45, 0x35, 0x06, 0x47, 0x31,
+	0x31, 0x24, 0x07, 0x87, 0x82, 0x07, 0x68, 0x73, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x0F, 0x51, 0x0B, 0x3F, 0x21, 0x0B, 0x3E, 0x22, 0x0B, 0x4C, 0x23, 0x0B, 0x3B, 0x25, 0x0B, 0x49, 0x26,
+	0x0B, 0x38, 0x28, 0x0B, 0x46, 0x29, 0x0B, 0xF6, 0x50, 0x06, 0x00, 0x0F, 0x24, 0x0B, 0x00, 0x00, 0x0F, 0x16, 0x0A, 0xA6, 0x35, 0x08, 0xA6, 0x45, 0x07, 0x66, 0x22, 0x27, 0x07, 0x26, 0x26, 0x37,
+	0x06, 0x26, 0x25, 0x29, 0x06, 0x00, 0x00, 0x00, 0x26, 0x35, 0x37, 0x06, 0x26, 0x36, 0x35, 0x07, 0x26, 0xB6, 0x07, 0x26, 0x97, 0x08, 0x0F, 0x52, 0x0A, 0xCA, 0x0A, 0xF8, 0x10, 0x08, 0x57, 0x23,
+	0x44, 0x07, 0x27, 0x25, 0x27, 0x07, 0x36, 0x24, 0x29, 0x06, 0x26, 0x25, 0x29, 0x06, 0x00, 0x00, 0x36, 0x34, 0x37, 0x06, 0x37, 0x34, 0x35, 0x07, 0x37, 0xB4, 0x07, 0x28, 0x95, 0x08, 0x0F, 0x42,
+	0x0B, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x26, 0x4E, 0x06, 0x26, 0x8A, 0x06, 0x26, 0xA8, 0x06, 0x26, 0x66, 0x0C, 0x26, 0x54, 0x0F, 0x26, 0x52, 0x0F, 0x02, 0x26, 0x41, 0x0F, 0x04, 0x56, 0x0F,
+	0x06, 0x46, 0x0F, 0x07, 0x26, 0x0F, 0x09, 0x0F, 0x34, 0x0A, 0x68, 0x73, 0x08, 0x87, 0x82, 0x07, 0x37, 0x53, 0x25, 0x07, 0x36, 0x45, 0x35, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36,
+	0x45, 0x26, 0x06, 0x37, 0x53, 0x25, 0x07, 0x87, 0x82, 0x07, 0x68, 0x73, 0x08, 0x0F, 0x34, 0x0A, 0x3B, 0x0F, 0x03, 0x98, 0x25, 0x08, 0xB7, 0x34, 0x07, 0x37, 0x35, 0x34, 0x07, 0x36, 0x37, 0x34,
+	0x06, 0x26, 0x29, 0x25, 0x06, 0x00, 0x00, 0x26, 0x29, 0x34, 0x06, 0x36, 0x27, 0x25, 0x07, 0x47, 0x24, 0x44, 0x07, 0xF8, 0x10, 0x08, 0xD9, 0x0A, 0x5D, 0x0E, 0x3A, 0x3A, 0x06, 0x00, 0x3A, 0x3A,
+	0x22, 0x02, 0x3A, 0x7A, 0x02, 0x3F, 0x0E, 0x00, 0x2E, 0x21, 0x0D, 0x00, 0x3D, 0x31, 0x0C, 0x2D, 0x23, 0x0C, 0x3C, 0x33, 0x0B, 0x2C, 0x25, 0x0B, 0x00, 0x2B, 0x27, 0x0A, 0x00, 0x3A, 0x37, 0x09,
+	0x2A, 0x29, 0x09, 0x39, 0x39, 0x08, 0x29, 0x2B, 0x08, 0x2C, 0x25, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x2B, 0x08, 0x39, 0x39, 0x08,
+	0x2A, 0x29, 0x09, 0x3A, 0x28, 0x09, 0x2B, 0x27, 0x0A, 0x00, 0x2C, 0x25, 0x0B, 0x00, 0x3C, 0x33, 0x0B, 0x2D, 0x23, 0x0C, 0x3D, 0x31, 0x0C, 0x2E, 0x21, 0x0D, 0x00, 0x3F, 0x0E, 0x00, 0x2A, 0x0F,
+	0x05, 0x48, 0x0F, 0x05, 0x57, 0x0F, 0x05, 0x37, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x26, 0x1B, 0x33, 0x06, 0x26, 0x39, 0x33, 0x06, 0x26, 0x48, 0x33, 0x06, 0x26, 0x37, 0x0E, 0x26, 0x27, 0x0F, 0x27,
+	0x25, 0x0F, 0x01, 0x97, 0x0F, 0x01, 0x78, 0x0F, 0x02, 0x49, 0x0F, 0x04, 0x0F, 0x61, 0x0A, 0xCD, 0x07, 0x5B, 0x55, 0x06, 0x3A, 0x3B, 0x05, 0x39, 0x3D, 0x04, 0x28, 0x0F, 0x31, 0x03, 0x27, 0x86,
+	0x24, 0x03, 0x36, 0xB4, 0x23, 0x03, 0x26, 0x44, 0x36, 0x23, 0x02, 0x26, 0x33, 0x29, 0x23, 0x02, 0x25, 0x33, 0x2A, 0x23, 0x02, 0x25, 0x23, 0x2B, 0x23, 0x02, 0x25, 0x23, 0x2A, 0x24, 0x02, 0x00,
+	0x25, 0x23, 0x38, 0x25, 0x02, 0x25, 0x24, 0x65, 0x33, 0x02, 0x25, 0xD5, 0x22, 0x03, 0x35, 0xA2, 0x32, 0x22, 0x03, 0x26, 0x52, 0x28, 0x31, 0x03, 0x36, 0x11, 0x2C, 0x21, 0x04, 0x37, 0x2C, 0x08,
+	0x38, 0x3A, 0x08, 0x59, 0x63, 0x09, 0xAB, 0x0B, 0x2F, 0x0F, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C,
+	0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x77, 0x24, 0x0C, 0x6A, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x26, 0x26, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x34, 0x28, 0x06, 0x37, 0x52, 0x36, 0x06, 0x77, 0x31, 0x34, 0x07, 0x58, 0x93, 0x07, 0x0F, 0x62, 0x09,
+	0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x47, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3E, 0x06,
+	0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x39, 0x38, 0x09, 0x0F, 0x16, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3E,
+	0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x4E, 0x0E, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+	0x0F, 0x09, 0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x28, 0x26,
+	0x06, 0x00, 0x36, 0x27, 0x26, 0x06, 0x27, 0x27, 0x35, 0x06, 0x37, 0x26, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x48, 0x84, 0x08, 0x1A, 0x85, 0x08, 0x0F, 0x71, 0x09, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x15, 0x0B, 0x0F, 0x35, 0x09, 0x0F, 0x55, 0x07, 0x0F,
+	0x37, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x2F, 0x07, 0xF6, 0x40, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x10, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F,
+	0x21, 0x0E, 0x3E, 0x0F, 0x3D, 0x0F, 0x01, 0x5C, 0x0F, 0x3B, 0x41, 0x0D, 0x3A, 0x43, 0x0C, 0x39, 0x45, 0x0B, 0x38, 0x38, 0x0A, 0x37, 0x4A, 0x08, 0x36, 0x4C, 0x07, 0x26, 0x4E, 0x06, 0x16, 0x0F,
+	0x31, 0x06, 0x0F, 0x1A, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x66, 0x0F, 0x05, 0x68, 0x0F,
+	0x03, 0x6B, 0x0F, 0x6E, 0x0C, 0x0F, 0x71, 0x09, 0x0F, 0x74, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x62, 0x09, 0x6E, 0x0C, 0x6B, 0x0F, 0x68, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x49, 0x0F, 0x04, 0x4B, 0x0F, 0x02, 0x5C, 0x0F, 0x4E, 0x0E, 0x5F, 0x0C, 0x0F, 0x42, 0x0B, 0x0F, 0x44, 0x09,
+	0x0F, 0x55, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06,
+	0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x0E, 0x37, 0x34, 0x0F, 0xA7, 0x0F, 0x78, 0x0F, 0x02, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x4A,
+	0x07, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x0F, 0x41, 0x04, 0x26, 0x0F, 0x51, 0x03, 0x26, 0x0F, 0x61, 0x02, 0x26, 0x0F, 0x21, 0x32, 0x01,
+	0x27, 0x2E, 0x24, 0x01, 0x37, 0x3C, 0x24, 0x01, 0x38, 0x3A, 0x25, 0x01, 0x58, 0x56, 0x25, 0x01, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x26, 0x48, 0x0C, 0x26, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x54, 0x06, 0x88, 0x37, 0x06, 0x4A, 0x2A, 0x06, 0x0F, 0x16, 0x0A, 0x49, 0x28, 0x09,
+	0x68, 0x46, 0x08, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x26, 0x36, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x37, 0x26, 0x06,
+	0x36, 0x36, 0x25, 0x07, 0x47, 0x35, 0x33, 0x07, 0x38, 0x95, 0x07, 0x29, 0x76, 0x08, 0x0F, 0x34, 0x0A, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26,
+	0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0x38, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0x16, 0x0F, 0x0A, 0x36, 0x0F, 0x08, 0x66, 0x0F, 0x05, 0x77, 0x0F, 0x03, 0x7A, 0x0F, 0x6D,
+	0x0D, 0x7F, 0x0A, 0x0F, 0x73, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x73, 0x07, 0x7F, 0x0A, 0x6D, 0x0D, 0x7A, 0x0F, 0x77, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0x36, 0x0F,
+	0x08, 0x16, 0x0F, 0x0A, 0x46, 0x0F, 0x07, 0x76, 0x0F, 0x04, 0x88, 0x0F, 0x01, 0x8B, 0x0D, 0x8E, 0x0A, 0x0F, 0x82, 0x07, 0x0F, 0x65, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x81, 0x08,
+	0x8D, 0x0B, 0x8A, 0x0E, 0x87, 0x0F, 0x02, 0x56, 0x0F, 0x06, 0x00, 0x77, 0x0F, 0x03, 0x8A, 0x0E, 0x8D, 0x0B, 0x0F, 0x81, 0x08, 0x0F, 0x74, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x82,
+	0x07, 0x8E, 0x0A, 0x8B, 0x0D, 0x88, 0x0F, 0x01, 0x76, 0x0F, 0x04, 0x46, 0x0F, 0x07, 0x0F, 0x1A, 0x06, 0x26, 0x3F, 0x06, 0x36, 0x4D, 0x06, 0x56, 0x4A, 0x07, 0x48, 0x47, 0x09, 0x49, 0x45, 0x0A,
+	0x4B, 0x41, 0x0C, 0x7C, 0x0D, 0x3E, 0x0F, 0x7C, 0x0D, 0x4B, 0x41, 0x0C, 0x4A, 0x53, 0x0A, 0x48, 0x47, 0x09, 0x47, 0x59, 0x07, 0x36, 0x4D, 0x06, 0x26, 0x3F, 0x06, 0x0F, 0x1A, 0x06, 0x16, 0x0F,
+	0x0A, 0x36, 0x0F, 0x08, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x59, 0x0F, 0x03, 0x4B, 0x0F, 0x02, 0x5C, 0x0F, 0xCE, 0x06, 0xBF, 0x06, 0xCE, 0x06, 0x5C, 0x0F, 0x4B, 0x0F, 0x02, 0x59, 0x0F, 0x03,
+	0x57, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x16, 0x0F, 0x0A, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x3C, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23,
+	0x06, 0x26, 0x38, 0x25, 0x06, 0x26, 0x46, 0x26, 0x06, 0x26, 0x45, 0x27, 0x06, 0x26, 0x44, 0x28, 0x06, 0x26, 0x42, 0x2A, 0x06, 0x26, 0x41, 0x2B, 0x06, 0x66, 0x2C, 0x06, 0x46, 0x2E, 0x06, 0x36,
+	0x2F, 0x06, 0x0F, 0x29, 0x06, 0xF5, 0xC0, 0x00, 0x00, 0x25, 0x0F, 0x28, 0x00, 0x00, 0x25, 0x0F, 0x0A, 0x65, 0x0F, 0x06, 0x86, 0x0F, 0x03, 0x8A, 0x0E, 0x9D, 0x0A, 0x0F, 0x82, 0x07, 0x0F, 0x56,
+	0x06, 0x0F, 0x29, 0x06, 0x25, 0x0F, 0x28, 0x00, 0x00, 0xF5, 0xC0, 0x00, 0x00, 0x1F, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x4C, 0x0F, 0x01, 0x4A, 0x0F, 0x03, 0x48, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x26,
+	0x0F, 0x09, 0x00, 0x46, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x4A, 0x0F, 0x03, 0x4C, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x1F, 0x0F, 0x01, 0x0F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0F, 0x0B, 0x25, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x27, 0x0F, 0x08, 0x18, 0x0F, 0x08, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93,
+	0x06, 0x3B, 0x23, 0x34, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x24, 0x08, 0xDB, 0x08, 0xFB, 0x06, 0xDD, 0x06,
+	0x0F, 0x29, 0x06, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C, 0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08,
+	0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4B, 0x37, 0x07, 0x3C, 0x36, 0x08, 0x2D, 0x26, 0x09,
+	0x6F, 0x0B, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x1B, 0x1C, 0x07, 0x2B, 0x2A, 0x07, 0x4D, 0x42, 0x09, 0xF5, 0x60, 0x06, 0x00, 0x6F, 0x0B,
+	0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23,
+	0x08, 0x0F, 0x31, 0x0D, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0xF6, 0x50, 0x06, 0xF5, 0x60, 0x06, 0x25, 0x23, 0x0F, 0x05, 0x00, 0x00, 0x6F, 0x0B, 0xCC, 0x24, 0x02, 0xEB, 0x33, 0x01, 0x4A, 0x48, 0x32,
+	0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C, 0x24, 0x00, 0x00, 0x2B, 0x2A, 0x25, 0x3B, 0x28, 0x35, 0x4D, 0x42, 0x53, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x40, 0x03, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x2B, 0x0F,
+	0x04, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x5A, 0x0F, 0x02, 0xFB, 0x06, 0xEC, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x2F, 0x00, 0x25, 0xF3, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x25,
+	0xF3, 0x40, 0x03, 0xF5, 0x60, 0x06, 0x00, 0x0F, 0x23, 0x0C, 0x0F, 0x31, 0x0D, 0x4F, 0x0D, 0x7E, 0x0B, 0x3D, 0x42, 0x0A, 0x3C, 0x54, 0x08, 0x4A, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x1A, 0x2D, 0x06,
+	0x0F, 0x1A, 0x06, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x1C, 0x0F, 0x04, 0x1B, 0x0F, 0x05, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB,
+	0x06, 0xDD, 0x06, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x2B, 0x0F,
+	0x04, 0x1B, 0x0F, 0x05, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x5A, 0x0F, 0x02, 0xFB, 0x06, 0xEC, 0x06, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06,
+	0x00, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0xFA, 0x70, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C, 0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00,
+	0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08, 0x6F, 0x0B, 0x6F, 0x0B, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x1B, 0x2B, 0x07,
+	0x2B, 0x2A, 0x07, 0x4D, 0x42, 0x09, 0xFA, 0x70, 0x00, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x3B, 0x0F, 0x03, 0x3A, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x1E, 0x27, 0x08, 0x5C, 0x35, 0x07,
+	0x7B, 0x25, 0x07, 0x3A, 0x32, 0x35, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x34, 0x33, 0x06, 0x3B, 0x74, 0x07, 0x2C, 0x74, 0x07, 0x1D,
+	0x36, 0x09, 0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x08, 0xF7, 0x40, 0x06, 0x00, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x28,
+	0x07, 0x00, 0xDA, 0x09, 0xFA, 0x10, 0x06, 0x00, 0x1A, 0x0F, 0x06, 0x5A, 0x0F, 0x02, 0x8A, 0x0E, 0x8D, 0x0B, 0x0F, 0x91, 0x07, 0x0F, 0x65, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x81,
+	0x08, 0x8D, 0x0B, 0x8A, 0x0E, 0x5A, 0x0F, 0x02, 0x1A, 0x0F, 0x06, 0x2A, 0x0F, 0x05, 0x6A, 0x0F, 0x01, 0x9A, 0x0D, 0x9E, 0x09, 0x0F, 0x83, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x82,
+	0x07, 0x8D, 0x0B, 0x7A, 0x0F, 0x2A, 0x0F, 0x05, 0x7A, 0x0F, 0x8D, 0x0B, 0x0F, 0x82, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x83, 0x06, 0x9E, 0x09, 0x9A, 0x0D, 0x6A, 0x0F, 0x01, 0x2A,
+	0x0F, 0x05, 0x2A, 0x2C, 0x06, 0x3A, 0x49, 0x06, 0x5A, 0x55, 0x07, 0x5C, 0x42, 0x09, 0x7E, 0x0B, 0x0F, 0x31, 0x0D, 0x7E, 0x0B, 0x5C, 0x42, 0x09, 0x5A, 0x55, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C,
+	0x06, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x8C, 0x39, 0x0F, 0x71, 0x35, 0x01, 0x0F, 0xC4, 0x01, 0x0F, 0x68, 0x03, 0x0F, 0x75, 0x05, 0x0F, 0x81, 0x08, 0x8D, 0x0B, 0x8A, 0x0E, 0x4A,
+	0x0F, 0x03, 0x1A, 0x0F, 0x06, 0x0F, 0x29, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47, 0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x2A, 0x54, 0x23, 0x06, 0x2A, 0x43, 0x25, 0x06, 0x2A, 0x51,
+	0x26, 0x06, 0x6A, 0x28, 0x06, 0x5A, 0x29, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x22, 0x0D, 0x00, 0x0F, 0x41, 0x0C, 0x6F, 0x0B, 0xB6, 0xC2, 0x01, 0xB5, 0xC4, 0x35, 0x0F, 0x36, 0x25,
+	0x0F, 0x28, 0x00, 0xF5, 0xC0, 0x00, 0x25, 0x0F, 0x28, 0x00, 0x00, 0x35, 0x0F, 0x36, 0xC5, 0xC3, 0xB6, 0xD1, 0x01, 0x6F, 0x0B, 0x0F, 0x32, 0x0C, 0x0F, 0x22, 0x0D, 0x3F, 0x0E, 0x2F, 0x0F, 0x2E,
+	0x0F, 0x01, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0x2F, 0x0F, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0x3E, 0x0F, 0xF7, 0x30, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x00, 0x00, 0xF7, 0x30, 0x07,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x4F, 0x0D, 0x6E, 0x0C, 0x8D, 0x0B, 0x3C, 0x21, 0x31, 0x0A, 0x3B, 0x22, 0x32, 0x09, 0x1B, 0x24, 0x14, 0x09, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x0F, 0x08, 0x26, 0x0F, 0x09, 0x35, 0x0F, 0x09, 0x34, 0x0F, 0x0A, 0x33, 0x0F, 0x0B, 0xF2, 0xC0,
+	0x03, 0x00, 0x33, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x27, 0x0F, 0x08, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x24, 0x14, 0x09, 0x3B, 0x22, 0x32, 0x09, 0x3C, 0x21, 0x31, 0x0A, 0x8D, 0x0B, 0x6E, 0x0C, 0x4F, 0x0D, 0x0F, 0x21, 0x0E, 0x0F, 0x28, 0x07, 0x0F, 0x29,
+	0x06, 0x0F, 0x39, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x3B, 0x03, 0xF2, 0xD0, 0x02, 0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x0F, 0x29, 0x06, 0x0F, 0x28, 0x07, 0x18, 0x1E, 0x08,
+	0x27, 0x2E, 0x07, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x23, 0x05, 0x24, 0x0F, 0x25, 0x04, 0x23, 0x0F, 0x27, 0x03, 0xF2, 0xD0, 0x02, 0x00, 0x23, 0x0F, 0x27, 0x03, 0x24, 0x0F, 0x25, 0x04, 0x25,
+	0x0F, 0x23, 0x05, 0x26, 0x0F, 0x21, 0x06, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x17, 0x0F, 0x11, 0x07, 0x27, 0x2E, 0x07, 0x28, 0x2C, 0x08, 0x29, 0x2A, 0x09, 0x2A, 0x28, 0x0A, 0x2B, 0x26, 0x0B,
+	0xC2, 0xC4, 0x02, 0x00, 0x2B, 0x26, 0x0B, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x28, 0x2C, 0x08, 0x27, 0x2E, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x0F, 0x0F, 0x02, 0x3A, 0xE4, 0x01, 0x3A, 0xF3, 0x01,
+	0x00, 0x8C, 0x0C, 0xCA, 0x0A, 0xE9, 0x09, 0x29, 0x39, 0x09, 0x28, 0x2C, 0x08, 0x00, 0x46, 0x4C, 0x06, 0x28, 0x2C, 0x08, 0x38, 0x3A, 0x08, 0x39, 0x38, 0x09, 0x49, 0x46, 0x09, 0x2B, 0x36, 0x0A,
+	0x2F, 0x27, 0x06, 0x2F, 0x36, 0x06, 0xFA, 0x10, 0x06, 0xF8, 0x21, 0x06, 0xF7, 0x22, 0x06, 0x36, 0x26, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36, 0x26, 0x27, 0x06, 0x37, 0x3D,
+	0x06, 0x28, 0x4B, 0x07, 0x0F, 0x36, 0x08, 0x2A, 0x61, 0x21, 0x0A, 0xCA, 0x0A, 0x3B, 0x34, 0x0B, 0x2B, 0x26, 0x0B, 0x2A, 0x28, 0x0A, 0x00, 0x00, 0x00, 0x2B, 0x26, 0x0B, 0x3B, 0x34, 0x0B, 0xCA,
+	0x0A, 0x2A, 0x61, 0x21, 0x0A, 0x16, 0x0F, 0x0A, 0x36, 0x27, 0x22, 0x0A, 0x46, 0x26, 0x22, 0x0A, 0x57, 0x24, 0x22, 0x0A, 0x59, 0x22, 0x22, 0x0A, 0x4B, 0x21, 0x22, 0x0A, 0x5D, 0x22, 0x0A, 0xCE,
+	0x06, 0x00, 0x5D, 0x22, 0x0A, 0x4B, 0x21, 0x22, 0x0A, 0x59, 0x22, 0x22, 0x0A, 0x57, 0x24, 0x22, 0x0A, 0x46, 0x26, 0x22, 0x0A, 0x36, 0x27, 0x22, 0x0A, 0x16, 0x0F, 0x0A, 0xB5, 0xB5, 0x00, 0x28,
+	0x35, 0x26, 0x06, 0x56, 0x53, 0x35, 0x05, 0x66, 0x21, 0x32, 0x25, 0x05, 0x35, 0x42, 0x24, 0x26, 0x04, 0x25, 0x34, 0x24, 0x26, 0x04, 0x25, 0x24, 0x26, 0x25, 0x04, 0x25, 0x25, 0x25, 0x25, 0x04,
+	0x00, 0x25, 0x25, 0x35, 0x24, 0x04, 0x26, 0x34, 0x43, 0x23, 0x05, 0x36, 0x64, 0x71, 0x05, 0x27, 0x55, 0x52, 0x06, 0x27, 0x0F, 0x08, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x27, 0x0F, 0x08,
+	0x00, 0x2F, 0x0F, 0x8C, 0x0C, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x18, 0x1E, 0x08, 0x27, 0x54, 0x25, 0x07, 0x17, 0x84, 0x14, 0x07, 0x26, 0x23, 0x26, 0x23, 0x06, 0x16, 0x23, 0x28, 0x13, 0x06,
+	0x16, 0x13, 0x1A, 0x13, 0x06, 0x00, 0x00, 0x16, 0x23, 0x28, 0x13, 0x06, 0x26, 0x23, 0x26, 0x23, 0x06, 0x17, 0x14, 0x16, 0x14, 0x07, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x29, 0x2A, 0x09, 0x2A,
+	0x28, 0x0A, 0x8C, 0x0C, 0x2F, 0x0F, 0x2D, 0x0F, 0x02, 0x27, 0x52, 0x0F, 0x01, 0x27, 0x71, 0x0F, 0x26, 0x22, 0x14, 0x0F, 0x16, 0x13, 0x15, 0x0F, 0x00, 0x16, 0x13, 0x14, 0x0F, 0x01, 0x36, 0x11,
+	0x22, 0x0F, 0x02, 0xA7, 0x0F, 0x89, 0x0F, 0x0F, 0x11, 0x0F, 0x0F, 0x13, 0x0D, 0x0F, 0x32, 0x0C, 0x0F, 0x51, 0x0B, 0x3F, 0x32, 0x09, 0x3D, 0x35, 0x08, 0x2D, 0x27, 0x08, 0x1D, 0x19, 0x08, 0x0F,
+	0x32, 0x0C, 0x0F, 0x51, 0x0B, 0x3F, 0x31, 0x0A, 0x3E, 0x33, 0x09, 0x3D, 0x35, 0x08, 0x2D, 0x27, 0x08, 0x1D, 0x19, 0x08, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0x09, 0x00, 0x2F, 0x0F, 0x8C, 0x0C, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x18, 0x1E, 0x08, 0x27, 0x2E, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x26, 0xC2, 0x22, 0x06, 0x16, 0x13, 0x15,
+	0x18, 0x06, 0x00, 0x00, 0x16, 0x13, 0x35, 0x16, 0x06, 0x16, 0x23, 0x63, 0x14, 0x06, 0x26, 0x53, 0x33, 0x22, 0x06, 0x17, 0x34, 0x16, 0x12, 0x07, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x29, 0x2A,
+	0x09, 0x2A, 0x28, 0x0A, 0x8C, 0x0C, 0x2F, 0x0F, 0x23, 0x0F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0F, 0x05, 0x27, 0x22, 0x0F,
+	0x04, 0x26, 0x24, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x27, 0x22, 0x0F, 0x04, 0x48, 0x0F, 0x05, 0x2E, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x22, 0x06, 0x00, 0x2E, 0x28, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x27, 0x0E, 0x27, 0x36, 0x0E, 0x26, 0x26, 0x11, 0x0E, 0x16, 0x26, 0x12, 0x0E, 0x16, 0x25, 0x13, 0x0E, 0x16, 0x34, 0x13, 0x0E, 0x76, 0x14, 0x0E, 0x57, 0x15, 0x0E, 0x27,
+	0x26, 0x0F, 0x27, 0x36, 0x0E, 0x16, 0x1A, 0x0E, 0x16, 0x14, 0x15, 0x0E, 0x00, 0x16, 0x23, 0x15, 0x0E, 0x56, 0x61, 0x0E, 0x37, 0x52, 0x0F, 0x18, 0x0F, 0x08, 0x27, 0x0F, 0x08, 0x26, 0x0F, 0x09,
+	0x25, 0x0F, 0x0A, 0x00, 0x15, 0x0F, 0x0B, 0xFA, 0x70, 0x00, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x28, 0x07, 0x0F, 0x27, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x0F,
+	0x38, 0x06, 0x0F, 0x29, 0x06, 0x49, 0x0F, 0x04, 0x87, 0x0F, 0x02, 0x00, 0xA6, 0x0F, 0x01, 0x00, 0xF6, 0x90, 0x02, 0x00, 0x16, 0x0F, 0x0A, 0x00, 0x00, 0xF6, 0x90, 0x02, 0x00, 0x16, 0x0F, 0x0A,
+	0x00, 0x0F, 0x31, 0x0D, 0x00, 0x0F, 0x2F, 0x0F, 0x2B, 0x22, 0x00, 0x0F, 0x5C, 0x0F, 0x3D, 0x01, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0x00, 0x0F, 0x12, 0x0E, 0x00,
+	0x00, 0x3A, 0x0F, 0x04, 0x78, 0x0F, 0x02, 0x97, 0x0F, 0x01, 0x26, 0x27, 0x0F, 0x16, 0x19, 0x0F, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x47, 0x41, 0x0F, 0x01, 0x78, 0x0F, 0x02, 0x3A, 0x0F, 0x04, 0x1D,
+	0x19, 0x08, 0x2D, 0x27, 0x08, 0x3D, 0x35, 0x08, 0x3E, 0x33, 0x09, 0x3F, 0x31, 0x0A, 0x0F, 0x51, 0x0B, 0x0F, 0x32, 0x0C, 0x1D, 0x19, 0x08, 0x2D, 0x27, 0x08, 0x3D, 0x35, 0x08, 0x3F, 0x22, 0x0A,
+	0x0F, 0x51, 0x0B, 0x0F, 0x32, 0x0C, 0x0F, 0x13, 0x0D, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0xC6, 0x17, 0x06, 0x0F, 0x12, 0x26, 0x06, 0x0F, 0x12, 0x44, 0x06, 0x0F,
+	0x12, 0x33, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x16, 0x09, 0x3B, 0x36, 0x09, 0x3A, 0x26, 0x11, 0x09, 0x38, 0x36, 0x12, 0x09, 0x46, 0x36, 0x13, 0x09,
+	0x26, 0x27, 0x15, 0x09, 0xCE, 0x06, 0x00, 0x0F, 0x17, 0x09, 0x00, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0xC6, 0x17, 0x06, 0x0F, 0x12, 0x26, 0x06, 0x0F, 0x12, 0x44,
+	0x06, 0x0F, 0x12, 0x33, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x0F, 0x01, 0x3B, 0x0F, 0x03, 0x3A, 0x13, 0x27, 0x06, 0x38, 0x24, 0x36, 0x06, 0x46, 0x24,
+	0x26, 0x11, 0x06, 0x26, 0x16, 0x26, 0x12, 0x06, 0x1E, 0x25, 0x13, 0x06, 0x1E, 0x34, 0x13, 0x06, 0x7E, 0x14, 0x06, 0x5F, 0x15, 0x06, 0x27, 0x26, 0x0F, 0x27, 0x36, 0x0E, 0x16, 0x1A, 0x0E, 0x16,
+	0x14, 0x15, 0x17, 0x06, 0x16, 0x14, 0x15, 0x26, 0x06, 0x16, 0x23, 0x15, 0x44, 0x06, 0x56, 0x61, 0x33, 0x08, 0x37, 0x52, 0x32, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x16,
+	0x09, 0x3B, 0x36, 0x09, 0x3A, 0x26, 0x11, 0x09, 0x38, 0x36, 0x12, 0x09, 0x46, 0x36, 0x13, 0x09, 0x26, 0x27, 0x15, 0x09, 0xCE, 0x06, 0x00, 0x0F, 0x17, 0x09, 0x00, 0x0F, 0x67, 0x04, 0x0F, 0x86,
+	0x03, 0x0F, 0x45, 0x51, 0x02, 0x0F, 0x34, 0x26, 0x02, 0x0F, 0x33, 0x28, 0x01, 0x0F, 0x32, 0x29, 0x01, 0x3A, 0x42, 0x2A, 0x01, 0x00, 0x3A, 0x22, 0x2C, 0x01, 0x0F, 0x3D, 0x01, 0x0F, 0x3C, 0x02,
+	0x0F, 0x5A, 0x02, 0x0F, 0x4A, 0x03, 0x0F, 0x2A, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x11, 0x75, 0x24, 0x0C,
+	0x11, 0x54, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x13, 0x73, 0x24, 0x0C, 0x13, 0x66, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47,
+	0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C, 0x13, 0x52, 0x27, 0x0C, 0x13, 0x22,
+	0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x11, 0x68, 0x22, 0x0C, 0x11, 0x8A, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F,
+	0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x13, 0x88, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x30, 0x53, 0x27, 0x0C, 0x20, 0x24, 0x2A, 0x0C,
+	0x20, 0x54, 0x27, 0x0C, 0x30, 0x74, 0x24, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x13, 0x88, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06,
+	0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x31, 0x88, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x20, 0x75, 0x24, 0x0C, 0x20, 0x54, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53,
+	0x27, 0x0C, 0x22, 0x73, 0x24, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x31, 0x88, 0x0C, 0x30, 0x6C, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F,
+	0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x22, 0x73, 0x24, 0x0C, 0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x22, 0x73, 0x24,
+	0x0C, 0x22, 0x66, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72,
+	0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x52, 0x63, 0x22, 0x0C, 0x31, 0x91, 0x24, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0xC2, 0x24, 0x0C, 0x33, 0x64, 0x22, 0x0C,
+	0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x64, 0x07, 0x0F, 0x62, 0x09, 0x6F, 0x0B, 0x7D, 0x0C,
+	0x6B, 0x21, 0x0C, 0x69, 0x23, 0x0C, 0x57, 0x26, 0x0C, 0x46, 0x28, 0x0C, 0x26, 0x2A, 0x0C, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x47, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F,
+	0x21, 0x24, 0x26, 0x0F, 0x41, 0x22, 0x00, 0x26, 0x0F, 0x21, 0x51, 0x26, 0x0F, 0x21, 0x32, 0x01, 0x36, 0x3E, 0x06, 0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x39, 0x38, 0x09, 0x0F,
+	0x16, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x11, 0x24, 0x27, 0x27, 0x06, 0x00, 0x21, 0x23, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06,
+	0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x13, 0x22, 0x27, 0x27, 0x06, 0x00,
+	0x22, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x11, 0x24, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x26, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x00, 0x30,
+	0x23, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27,
+	0x27, 0x06, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29,
+	0x06, 0x11, 0x0F, 0x0F, 0x00, 0x21, 0xF3, 0x50, 0x06, 0x22, 0xF2, 0x50, 0x06, 0x13, 0xF2, 0x50, 0x06, 0x13, 0x0F, 0x0D, 0x13, 0xF2, 0x50, 0x06, 0x00, 0x22, 0xF2, 0x50, 0x06, 0x21, 0x0F, 0x0E,
+	0x11, 0x0F, 0x0F, 0x00, 0x22, 0x0F, 0x0D, 0x21, 0x0F, 0x0E, 0x30, 0xF3, 0x50, 0x06, 0x20, 0xF4, 0x50, 0x06, 0x00, 0x30, 0x0F, 0x0E, 0x22, 0x0F, 0x0D, 0x13, 0x0F, 0x0D, 0x22, 0x0F, 0x0D, 0x00,
+	0xF6, 0x50, 0x06, 0x00, 0x00, 0x22, 0x0F, 0x0D, 0x00, 0x2F, 0x0F, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x36, 0x3E,
+	0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x4E, 0x0E, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x31, 0x44, 0x0F, 0x05, 0x30,
+	0x46, 0x0F, 0x04, 0x20, 0x49, 0x0F, 0x02, 0x20, 0x5A, 0x0F, 0x21, 0x4B, 0x0E, 0x21, 0x5C, 0x0C, 0x22, 0x4D, 0x0B, 0x22, 0x4F, 0x09, 0x31, 0x0F, 0x51, 0x07, 0x30, 0x0F, 0x44, 0x06, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x11, 0x24, 0x3F, 0x06, 0x11, 0x24, 0x0F, 0x21, 0x06, 0x21, 0x23,
+	0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09,
+	0xAB, 0x0B, 0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x22,
+	0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x11, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E,
+	0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F,
+	0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x13, 0x23, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9,
+	0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x31, 0x23, 0x2E, 0x07, 0x30, 0x23, 0x3F, 0x06, 0x20, 0x24, 0x0F, 0x21,
+	0x06, 0x00, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x31, 0x23, 0x2E, 0x07, 0x30, 0x34, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B,
+	0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21,
+	0x06, 0x00, 0x00, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0x1B, 0x19, 0x0A, 0x3A, 0x37,
+	0x09, 0x3B, 0x35, 0x0A, 0x3C, 0x33, 0x0B, 0x3D, 0x31, 0x0C, 0x5E, 0x0D, 0x3F, 0x0E, 0x5E, 0x0D, 0x3D, 0x31, 0x0C, 0x3C, 0x33, 0x0B, 0x3B, 0x35, 0x0A, 0x3A, 0x37, 0x09, 0x1B, 0x19, 0x0A, 0x4E,
+	0x0E, 0xAB, 0x14, 0x06, 0xE9, 0x21, 0x06, 0x58, 0x76, 0x06, 0x38, 0x3A, 0x08, 0x37, 0x5A, 0x07, 0x27, 0x3A, 0x21, 0x07, 0x26, 0x3A, 0x32, 0x06, 0x26, 0x39, 0x24, 0x06, 0x26, 0x38, 0x25, 0x06,
+	0x26, 0x46, 0x26, 0x06, 0x26, 0x35, 0x28, 0x06, 0x26, 0x34, 0x29, 0x06, 0x36, 0x32, 0x2A, 0x06, 0x27, 0x31, 0x2A, 0x07, 0x57, 0x3A, 0x07, 0x38, 0x3A, 0x08, 0x76, 0x56, 0x08, 0x35, 0xE1, 0x09,
+	0x25, 0xA4, 0x0B, 0x15, 0x38, 0x0F, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x00, 0x21, 0x0F, 0x26, 0x06,
+	0x22, 0x0F, 0x25, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x13, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6,
+	0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x11, 0x0F, 0x36, 0x06,
+	0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x13, 0x0F, 0x24, 0x07, 0x22, 0x0F, 0x34,
+	0x06, 0x21, 0x0F, 0x26, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x10, 0x0F, 0x28, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x13, 0x0F, 0x24, 0x07, 0x0F, 0x46, 0x07,
+	0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x22, 0x0F, 0x34, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x0F, 0x29,
+	0x06, 0x00, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0x16, 0x0F, 0x0A, 0x36, 0x0F, 0x08, 0x46,
+	0x0F, 0x07, 0x57, 0x0F, 0x05, 0x59, 0x0F, 0x03, 0x4B, 0x0F, 0x02, 0x13, 0x58, 0x0F, 0x13, 0xCA, 0x06, 0x22, 0xBB, 0x06, 0x21, 0xCB, 0x06, 0x11, 0x5A, 0x0F, 0x11, 0x49, 0x0F, 0x02, 0x59, 0x0F,
+	0x03, 0x57, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x16, 0x0F, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x2A, 0x28, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x36, 0x0A, 0x3B,
+	0x34, 0x0B, 0x9B, 0x0C, 0x7C, 0x0D, 0xF9, 0x20, 0x06, 0xF7, 0x40, 0x06, 0xF6, 0x50, 0x06, 0x26, 0x0F, 0x09, 0x25, 0x0F, 0x0A, 0x00, 0x25, 0x0F, 0x31, 0x06, 0x25, 0x36, 0x28, 0x06, 0x25, 0x65,
+	0x26, 0x06, 0x35, 0x33, 0x31, 0x26, 0x06, 0x76, 0x33, 0x25, 0x06, 0x66, 0x35, 0x24, 0x06, 0x38, 0x77, 0x07, 0x0F, 0x73, 0x07, 0x0F, 0x35, 0x09, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93,
+	0x06, 0x3B, 0x23, 0x34, 0x06, 0x14, 0x25, 0x34, 0x25, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06, 0x34, 0x23, 0x24, 0x26, 0x06, 0x25, 0x23, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x17, 0x32,
+	0x23, 0x24, 0x08, 0xDB, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x17, 0x22,
+	0x24, 0x26, 0x06, 0x26, 0x22, 0x24, 0x26, 0x06, 0x25, 0x23, 0x24, 0x16, 0x07, 0x24, 0x24, 0x24, 0x25, 0x07, 0x24, 0x34, 0x23, 0x24, 0x08, 0x14, 0xD6, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29,
+	0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x17, 0x33, 0x93, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x25, 0x23, 0x34, 0x25, 0x06, 0x34, 0x23, 0x24, 0x26, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06,
+	0x24, 0x24, 0x24, 0x16, 0x07, 0x34, 0x23, 0x24, 0x25, 0x07, 0x35, 0x32, 0x23, 0x24, 0x08, 0x26, 0xD3, 0x08, 0x17, 0xF3, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74,
+	0x07, 0x3B, 0x93, 0x06, 0x35, 0x33, 0x23, 0x34, 0x06, 0x24, 0x24, 0x34, 0x25, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06, 0x00, 0x25, 0x23, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x26, 0x32,
+	0x23, 0x24, 0x08, 0x35, 0xD3, 0x08, 0x34, 0xF4, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x26, 0x22, 0x34,
+	0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x26, 0x32, 0x23, 0x24, 0x08, 0x26, 0xD3, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F,
+	0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x52, 0x23, 0x34, 0x25, 0x06, 0x31, 0x31, 0x22, 0x24, 0x26, 0x06, 0x21, 0x23, 0x22, 0x24, 0x26, 0x06, 0x21, 0x23, 0x22,
+	0x24, 0x16, 0x07, 0x21, 0x23, 0x22, 0x24, 0x25, 0x07, 0x52, 0x33, 0x23, 0x24, 0x08, 0x33, 0xD5, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B,
+	0x93, 0x06, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x00, 0x00, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x24, 0x08, 0xCB, 0x09, 0x00, 0xEB, 0x07, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24,
+	0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08,
+	0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x24, 0x2A, 0x4C, 0x22, 0x00, 0x2A, 0x2C, 0x51, 0x3A, 0x3A, 0x32, 0x01, 0x4B, 0x37, 0x07, 0x3C, 0x36, 0x08, 0x2D, 0x26, 0x09, 0x6F, 0x0B, 0xAD,
+	0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x14, 0x35, 0x24, 0x34, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06,
+	0x17, 0x32, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06,
+	0x17, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x24, 0x34, 0x24, 0x25, 0x06, 0x14, 0x36, 0x23, 0x24, 0x07, 0x7C, 0x33,
+	0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0x17, 0xC4, 0x08, 0x26, 0x33, 0x23, 0x33, 0x07, 0x25, 0x33, 0x24, 0x34, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x25,
+	0x25, 0x06, 0x00, 0x34, 0x23, 0x25, 0x25, 0x06, 0x35, 0x32, 0x24, 0x25, 0x06, 0x26, 0x33, 0x23, 0x24, 0x07, 0x17, 0x74, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09,
+	0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x26, 0x33, 0x23, 0x24, 0x07, 0x26,
+	0x74, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x14, 0x0F, 0x0C, 0x24, 0x0F, 0x0B, 0x34, 0xF3, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x26, 0xF2, 0x10, 0x06, 0x17, 0x0F, 0x09, 0x17, 0x0F,
+	0x09, 0x26, 0xF2, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06, 0x24, 0x0F, 0x0B, 0x14, 0x0F, 0x0C, 0x17, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x25, 0x0F, 0x0A, 0x34, 0xF3, 0x10, 0x06,
+	0x24, 0xF4, 0x10, 0x06, 0x00, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x17, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x26, 0x0F, 0x09,
+	0x00, 0x0F, 0x61, 0x0A, 0xAE, 0x08, 0xCD, 0x07, 0x15, 0x22, 0x33, 0x36, 0x07, 0x15, 0x12, 0x33, 0x38, 0x06, 0x25, 0x11, 0x23, 0x2A, 0x06, 0x36, 0x23, 0x2A, 0x06, 0x00, 0x46, 0x22, 0x2A, 0x06,
+	0x16, 0x31, 0x21, 0x39, 0x06, 0x16, 0x62, 0x28, 0x07, 0x25, 0xF3, 0x07, 0xCC, 0x08, 0x7F, 0x0A, 0xFA, 0x10, 0x06, 0x00, 0x35, 0xD5, 0x06, 0x24, 0x25, 0x0F, 0x04, 0x24, 0x15, 0x0F, 0x05, 0x24,
+	0x24, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x26, 0x22, 0x0F, 0x05, 0x00, 0x35, 0x52, 0x0F, 0x02, 0x34, 0xF4, 0x06, 0xEC, 0x06, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x14, 0x35,
+	0x3A, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x17, 0x32, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F,
+	0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x17, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x24, 0x34, 0x3A, 0x06, 0x14,
+	0x36, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0x17, 0xE3, 0x07, 0x26, 0x33, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06,
+	0x00, 0x34, 0x23, 0x2C, 0x06, 0x35, 0x32, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0x17, 0xE3, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x35, 0x33, 0x38, 0x07, 0x24, 0x34,
+	0x3A, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x00, 0x25, 0x23, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x35, 0x33, 0x38, 0x07, 0x34, 0xE4, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B,
+	0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x26, 0x32, 0x3A, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0x26, 0xE3, 0x07, 0xBC, 0x09,
+	0x6F, 0x0B, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x22, 0x32, 0x0A, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1A, 0x06, 0x6F, 0x23, 0x06, 0xEC, 0x06, 0xEB, 0x07, 0x3B,
+	0x47, 0x07, 0x3A, 0x36, 0x31, 0x06, 0x2A, 0x36, 0x23, 0x06, 0x2A, 0x35, 0x24, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x33, 0x26, 0x06, 0x3A, 0x31, 0x36, 0x06, 0x4B, 0x37, 0x07, 0xEB, 0x07, 0xEA,
+	0x08, 0x2A, 0x82, 0x0A, 0x1A, 0x0F, 0x06, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x14, 0x0F, 0x24, 0x06, 0x24, 0x0F, 0x23, 0x06, 0x34, 0x0F, 0x22, 0x06, 0x25, 0x0F, 0x22, 0x06, 0x26, 0x2F,
+	0x07, 0x17, 0x2F, 0x07, 0xDA, 0x09, 0xFA, 0x10, 0x06, 0x00, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x17, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x22, 0x06,
+	0x24, 0x0F, 0x22, 0x07, 0x00, 0x14, 0xD5, 0x09, 0xFA, 0x10, 0x06, 0x00, 0xEA, 0x08, 0x17, 0xF2, 0x07, 0x26, 0x5D, 0x06, 0x25, 0x0F, 0x22, 0x06, 0x34, 0x0F, 0x22, 0x06, 0x24, 0x0F, 0x23, 0x06,
+	0x00, 0x34, 0x0F, 0x21, 0x07, 0x35, 0x2F, 0x07, 0x26, 0xD2, 0x09, 0x17, 0xF2, 0x10, 0x06, 0xFA, 0x10, 0x06, 0xEA, 0x08, 0xFA, 0x07, 0x26, 0x5D, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06,
+	0x00, 0x00, 0x0F, 0x28, 0x07, 0x26, 0x2F, 0x07, 0x26, 0xD2, 0x09, 0xFA, 0x10, 0x06, 0x00, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x8C, 0x39, 0x17, 0x78, 0x35, 0x01, 0x26, 0xCB, 0x01,
+	0x25, 0x0F, 0x61, 0x03, 0x24, 0x7E, 0x05, 0x24, 0x8A, 0x08, 0x14, 0x88, 0x0B, 0x8A, 0x0E, 0x4A, 0x0F, 0x03, 0x1A, 0x0F, 0x06, 0xF5, 0xC0, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C,
+	0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08, 0x6F, 0x0B, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x26, 0x84, 0x39, 0x26, 0x78, 0x35,
+	0x01, 0x0F, 0xC4, 0x01, 0x0F, 0x68, 0x03, 0x0F, 0x75, 0x05, 0x0F, 0x81, 0x08, 0x26, 0x85, 0x0B, 0x26, 0x82, 0x0E, 0x4A, 0x0F, 0x03, 0x1A, 0x0F, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F,
+	0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x8C, 0x0C, 0x21, 0x67, 0x22, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x74, 0x24,
+	0x0C, 0x21, 0x67, 0x22, 0x0C, 0x21, 0x89, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x26,
+	0x33, 0x32, 0x34, 0x06, 0x26, 0x32, 0x33, 0x25, 0x06, 0x26, 0x22, 0x24, 0x26, 0x06, 0x00, 0x26, 0x22, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x26, 0x32, 0x23, 0x33, 0x08, 0x26, 0xE3,
+	0x07, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x20, 0x8A, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x31, 0x73,
+	0x24, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x22, 0x22, 0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x31, 0x73, 0x24, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x20, 0x8A, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65,
+	0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x24, 0x35, 0x32, 0x34, 0x06, 0x34, 0x33, 0x33, 0x25, 0x06, 0x35, 0x22, 0x24, 0x26, 0x06, 0x26,
+	0x22, 0x24, 0x26, 0x06, 0x26, 0x22, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x35, 0x32, 0x23, 0x33, 0x08, 0x34, 0xE4, 0x07, 0x24, 0xF5, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F,
+	0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C, 0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x77, 0x24,
+	0x0C, 0x6A, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x37, 0x01, 0x0F, 0x72, 0x62, 0x0F, 0x75, 0x23, 0x0F, 0x47, 0x24, 0x0F, 0x1A, 0x24, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x32,
+	0x34, 0x06, 0x3A, 0x33, 0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x33, 0x08, 0xEB, 0x33, 0x01, 0xFB, 0x60, 0xED, 0x23, 0x0F, 0x29,
+	0x24, 0x00, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x36, 0x3E, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06,
+	0x22, 0x22, 0x0F, 0x21, 0x06, 0x12, 0x23, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x11, 0x34, 0x2E, 0x07, 0x11, 0x25, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x29, 0x39, 0x09,
+	0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x17, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x3B, 0x06, 0x24, 0x34, 0x3A, 0x06,
+	0x14, 0x46, 0x46, 0x07, 0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x13, 0x32, 0x3E, 0x06, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23,
+	0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x22, 0x32, 0x2E, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x47,
+	0x3B, 0x07, 0x48, 0x48, 0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0x17, 0xE3, 0x07, 0x26, 0x33, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x34,
+	0x23, 0x2C, 0x06, 0x25, 0x23, 0x3B, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x17, 0x43, 0x46, 0x07, 0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C,
+	0x07, 0x36, 0x3E, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x36, 0x2E, 0x07, 0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48,
+	0x48, 0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x00, 0x00, 0x2A, 0x3B, 0x06, 0x3A, 0x3A, 0x06, 0x4B, 0x46, 0x07,
+	0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x10, 0x35, 0x3E, 0x06, 0x20, 0x24, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x31,
+	0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x34, 0x2E, 0x07, 0x10, 0x26, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48,
+	0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0x14, 0xE6, 0x07, 0x24, 0x35, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x25,
+	0x23, 0x3B, 0x06, 0x24, 0x34, 0x3A, 0x06, 0x14, 0x46, 0x46, 0x07, 0x3C, 0x36, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x10, 0x25, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21,
+	0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x33, 0x3E, 0x06, 0x20, 0x25, 0x2E, 0x07, 0x10, 0x36, 0x3C,
+	0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x2B, 0x2A, 0x07,
+	0x2C, 0x37, 0x08, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x25, 0x12, 0x0F, 0x07, 0x2F, 0x0F, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x26, 0x0F, 0x21, 0x06, 0x36, 0x3E, 0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06,
+	0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x27, 0x21, 0x2C, 0x06, 0x00, 0x27, 0x22, 0x2A, 0x07, 0x27, 0x23, 0x37, 0x08, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27,
+	0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x26, 0x43, 0x22,
+	0x33, 0x07, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x20, 0x24, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x00, 0x31, 0x22, 0x27, 0x27, 0x06, 0x30,
+	0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x24, 0x45, 0x22, 0x33, 0x07, 0x34, 0x33, 0x24,
+	0x34, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x35, 0x32, 0x24, 0x34, 0x06, 0x34, 0x34, 0x23, 0x34, 0x06, 0x24, 0x85, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD,
+	0x09, 0xDB, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x24, 0x34, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x8B, 0x33,
+	0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x27, 0x27, 0x32, 0x01, 0x26, 0x27, 0x87, 0x26, 0x27, 0x37, 0x23,
+	0x26, 0x27, 0x27, 0x24, 0x0F, 0x29, 0x24, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x32, 0x01, 0x2A, 0x25, 0x85, 0x2A, 0x25, 0x35,
+	0x23, 0x2A, 0x25, 0x25, 0x24, 0x3A, 0x24, 0x34, 0x24, 0x3B, 0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x10, 0x25, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27,
+	0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06,
+	0x10, 0x25, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x14, 0x46, 0x22, 0x33, 0x07, 0x24, 0x34, 0x24, 0x34, 0x06, 0x25, 0x23,
+	0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x25, 0x33, 0x24, 0x34, 0x06, 0x24, 0x35, 0x23, 0x34, 0x06, 0x14, 0x86, 0x33, 0x07,
+	0x7C, 0x23, 0x08, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30,
+	0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x28, 0x26, 0x06, 0x21, 0x23, 0x28, 0x26, 0x06, 0x22, 0x22, 0x28, 0x26, 0x06, 0x13, 0x32, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25,
+	0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x17, 0x42, 0x48, 0x32, 0x01, 0x26, 0x32, 0x3A, 0x33, 0x25, 0x23, 0x2C, 0x24,
+	0x34, 0x23, 0x2C, 0x24, 0x24, 0x24, 0x2C, 0x24, 0x34, 0x14, 0x1C, 0x25, 0x25, 0x24, 0x2A, 0x34, 0x26, 0x34, 0x36, 0x34, 0x01, 0x17, 0xF2, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D,
+	0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x20, 0x25, 0x2E, 0x07, 0x30, 0x23, 0x3F, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06,
+	0x00, 0x22, 0x22, 0x28, 0x26, 0x06, 0x31, 0x22, 0x28, 0x26, 0x06, 0x30, 0x23, 0x28, 0x26, 0x06, 0x20, 0x34, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08,
+	0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x24, 0x44, 0x48, 0x32, 0x01, 0x34, 0x33, 0x3A, 0x33, 0x35, 0x22, 0x2C, 0x24, 0x26, 0x22, 0x2C, 0x24, 0x00, 0x26, 0x13, 0x1C,
+	0x25, 0x35, 0x23, 0x2A, 0x34, 0x34, 0x35, 0x36, 0x34, 0x01, 0x24, 0xF4, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07,
+	0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x22, 0x22, 0x28, 0x26, 0x06, 0x26, 0x28, 0x26, 0x06, 0x00, 0x36, 0x27, 0x35,
+	0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x4A, 0x48, 0x32, 0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C,
+	0x24, 0x26, 0x22, 0x2C, 0x24, 0x00, 0x26, 0x13, 0x1C, 0x25, 0x2B, 0x2A, 0x34, 0x3C, 0x36, 0x34, 0x01, 0xFA, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09,
+	0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x21, 0x12, 0x26, 0x0F, 0x21, 0x51, 0x26, 0x28, 0x26, 0x41,
+	0x01, 0x26, 0x28, 0x26, 0x06, 0x00, 0x36, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01,
+	0x4A, 0x48, 0x32, 0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C, 0x24, 0x44, 0x22, 0x2C, 0x24, 0x53, 0x22, 0x2C, 0x24, 0x13, 0x22, 0x13, 0x1C, 0x25, 0x2B, 0x2A, 0x34, 0x3C, 0x36, 0x34, 0x01, 0xFA, 0x60,
+	0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x2E, 0x0F, 0x01, 0x13, 0x2A, 0x0F, 0x01, 0x22, 0x2A, 0x0F, 0x01, 0x21, 0x2B, 0x0F, 0x01, 0x30, 0x2B, 0x0F, 0x01, 0x20,
+	0x2C, 0x0F, 0x01, 0x30, 0x2B, 0x0F, 0x01, 0x21, 0x2B, 0x0F, 0x01, 0x22, 0x2A, 0x0F, 0x01, 0x13, 0x2A, 0x0F, 0x01, 0x2E, 0x0F, 0x01, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x12,
+	0xF2, 0x60, 0x06, 0x21, 0x29, 0x0F, 0x03, 0x20, 0x29, 0x0F, 0x04, 0x20, 0x28, 0x0F, 0x05, 0x10, 0x29, 0x0F, 0x05, 0x20, 0x28, 0x0F, 0x05, 0x00, 0x21, 0x37, 0x0F, 0x04, 0x12, 0xF7, 0x10, 0x06,
+	0xFB, 0x06, 0xEC, 0x06, 0x29, 0x0F, 0x06, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x29, 0x23, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x29, 0x0F, 0x06, 0x27, 0x0F, 0x08, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x27, 0x23, 0x0F, 0x03, 0x27, 0x22, 0x0F, 0x04, 0x27, 0x21, 0x0F, 0x05, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x3A, 0x0F, 0x04,
+	0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0x22, 0x0F, 0x0D, 0x30, 0x0F, 0x0E, 0x20, 0x0F, 0x0F, 0x20, 0xF4, 0x50, 0x06, 0x21, 0xF3, 0x50, 0x06, 0x00, 0x22, 0x0F, 0x0D, 0x00, 0x26, 0x0F, 0x09,
+	0x34, 0x0F, 0x0A, 0x24, 0x0F, 0x0B, 0x24, 0xF4, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x21, 0x0F, 0x0E, 0x00, 0x21, 0xF3, 0x50, 0x06, 0x00, 0x00, 0x21, 0x0F, 0x0E,
+	0x26, 0x0F, 0x09, 0x00, 0x26, 0xF2, 0x10, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x09, 0x20, 0x0F, 0x0F, 0x30, 0x0F, 0x0E, 0x31, 0x0F, 0x0D, 0x22, 0xF2, 0x50, 0x06, 0x00, 0x00, 0x31, 0x0F, 0x0D, 0x30,
+	0x0F, 0x0E, 0x24, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0xF2, 0x10, 0x06, 0x00, 0x00, 0x35, 0x0F, 0x09, 0x34, 0x0F, 0x0A, 0x0F, 0x3D, 0x01, 0x0F, 0x6B, 0xF6, 0x60, 0x23, 0xF6,
+	0x50, 0x24, 0x00, 0x0F, 0x3D, 0x01, 0x0F, 0x6B, 0x25, 0xF3, 0x20, 0x23, 0x25, 0xF3, 0x10, 0x24, 0x00, 0x22, 0xF2, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x0F, 0x0F, 0x02, 0x0F, 0x16, 0x0A, 0x0F, 0x36, 0x08, 0x0F, 0x55, 0x07, 0x0F, 0x37, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x3F, 0x06, 0x26, 0x3E,
+	0x07, 0xF6, 0x40, 0x07, 0xF6, 0x30, 0x08, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x2F, 0x00, 0x00, 0x25, 0xF3, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x25, 0xF3, 0x50, 0x02, 0x0F, 0x16, 0x0A, 0x0F,
+	0x36, 0x08, 0x0F, 0x55, 0x07, 0x0F, 0x37, 0x07, 0x0F, 0x38, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x3F, 0x06, 0x20, 0x24, 0x3E,
+	0x07, 0x30, 0xF3, 0x40, 0x07, 0x21, 0xF3, 0x30, 0x08, 0x22, 0xF2, 0x20, 0x09, 0x27, 0x0F, 0x26, 0x26, 0x0F, 0x27, 0x35, 0xF2, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x35, 0xF2, 0x50, 0x02, 0x26, 0x0F,
+	0x09, 0x27, 0x0F, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x2F, 0x0F, 0x2E, 0x0F, 0x01, 0x4D, 0x0F, 0x7C, 0x28, 0x12, 0x3B, 0x42, 0x57, 0x3A, 0x44, 0x46, 0x01, 0x39, 0x46, 0x0A,
+	0x38, 0x39, 0x09, 0x37, 0x4B, 0x07, 0x36, 0x4D, 0x06, 0x26, 0x3F, 0x06, 0x16, 0x0F, 0x22, 0x06, 0x0F, 0x1A, 0x06, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x32, 0x0C, 0x0F, 0x31, 0x0D, 0x5F, 0x27,
+	0x12, 0x7E, 0x56, 0x3D, 0x42, 0x45, 0x01, 0x3C, 0x45, 0x08, 0x3B, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C, 0x06, 0x1A, 0x1E, 0x06, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x32, 0x0C, 0x0F, 0x31,
+	0x0D, 0x4F, 0x0D, 0x7E, 0x0B, 0x3D, 0x42, 0x0A, 0x3C, 0x45, 0x08, 0x3B, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C, 0x06, 0x1A, 0x1E, 0x06, 0xF6, 0x50, 0x06, 0x13, 0xF2, 0x50, 0x06, 0x22, 0xF2,
+	0x50, 0x06, 0x12, 0x0F, 0x26, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xF2, 0x60, 0x06, 0x21, 0xF2, 0x60, 0x06, 0x11,
+	0xF3, 0x60, 0x06, 0x20, 0x0F, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x29, 0x21, 0x12, 0x0F, 0x29, 0x51, 0x0F, 0x29, 0x41, 0x01, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0xF5, 0x60, 0x21, 0x12, 0xF5, 0x60, 0x51, 0xF5, 0x60, 0x41, 0x01, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x26, 0x12, 0x2D, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E,
+	0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x25, 0x12, 0x0F, 0x07, 0x55, 0x0F, 0x07, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00,
+	0x2F, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x2F, 0x0F, 0x00, 0x0F, 0x31, 0x0D, 0x0F, 0x21, 0x0E, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x2E, 0x28, 0x06, 0x2D, 0x29, 0x06, 0x00, 0x2C, 0x2A, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x23, 0x0C, 0x0F, 0x22, 0x0D, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x49, 0x0F, 0x04, 0x4B, 0x0F, 0x02, 0x13, 0x58, 0x0F, 0x22, 0x4A, 0x0E, 0x12, 0x5C, 0x0C, 0x21, 0x5E, 0x0A, 0x11, 0x0F, 0x42, 0x09, 0x11,
+	0x0F, 0x53, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x17, 0x22, 0x0F, 0x05, 0x26, 0x22, 0x0F, 0x05, 0x25, 0x23,
+	0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x24, 0x34, 0x0F, 0x04, 0x14, 0xF5, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x49, 0x0F, 0x04,
+	0x4B, 0x0F, 0x02, 0x5C, 0x2A, 0x12, 0x4E, 0x59, 0x5F, 0x47, 0x01, 0x0F, 0x52, 0x0A, 0x0F, 0x44, 0x09, 0x0F, 0x55, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00,
+	0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x2F, 0x12, 0x2A, 0x5F, 0x2A, 0x4F, 0x01, 0x2A, 0x0F, 0x05, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x46, 0x0F, 0x07, 0x10, 0x56, 0x0F, 0x05, 0x20, 0x47, 0x0F, 0x04, 0x21, 0x48, 0x0F, 0x02, 0x31, 0x58, 0x0F, 0x22, 0x4A, 0x0E, 0x31, 0x5B, 0x0C, 0x21, 0x5E, 0x0A, 0x20, 0x0F, 0x42, 0x09,
+	0x10, 0x0F, 0x54, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x14, 0xF5, 0x10, 0x06, 0x24, 0x26, 0x0F, 0x03, 0x25, 0x24, 0x0F, 0x04, 0x35, 0x22, 0x0F, 0x05,
+	0x26, 0x22, 0x0F, 0x05, 0x35, 0x22, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x34, 0x0F, 0x04, 0x14, 0xF5, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0x36, 0x13, 0x0F, 0x04, 0x76, 0x0F, 0x04, 0x66,
+	0x0F, 0x05, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06,
+	0x00, 0x00, 0x29, 0x0F, 0x06, 0x28, 0x0F, 0x07, 0x27, 0x0F, 0x08, 0x00, 0x26, 0x2F, 0x07, 0x26, 0x3E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x36, 0x2F, 0x06, 0x37, 0x4C, 0x06,
+	0xF7, 0x30, 0x07, 0xF8, 0x10, 0x08, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x2A, 0x0F, 0x23, 0x3A, 0x0F, 0x22, 0xFA, 0x70, 0xFB, 0x60,
+	0xFC, 0x30, 0x02, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D, 0x07, 0x21, 0x33, 0x3E, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x33, 0x2E, 0x07, 0x27, 0x2E, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x26, 0x33, 0x47, 0x07, 0x26, 0x32, 0x3A, 0x06, 0x26,
+	0x22, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x26, 0x32, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0xEB, 0x07, 0xCC, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D,
+	0x07, 0x20, 0x34, 0x3E, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x30, 0x33, 0x2E, 0x07, 0x20,
+	0x25, 0x2E, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x24, 0x35, 0x47, 0x07, 0x34, 0x33, 0x3A, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x26,
+	0x22, 0x2C, 0x06, 0x00, 0x00, 0x35, 0x32, 0x3A, 0x06, 0x34, 0x34, 0x38, 0x07, 0x24, 0xE5, 0x07, 0xCC, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D,
+	0x07, 0x13, 0x32, 0x3E, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x10, 0x12, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06,
+	0x21, 0x33, 0x2E, 0x07, 0x20, 0x25, 0x2E, 0x07, 0x20, 0x45, 0x4A, 0x07, 0x10, 0x57, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x17, 0x33, 0x47, 0x07, 0x26, 0x32,
+	0x3A, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x00, 0x14, 0x12, 0x22, 0x2C, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x25, 0x34, 0x38, 0x07, 0x24, 0xE5, 0x07, 0x24, 0xC6, 0x08, 0x7C, 0x0D,
+	0xCA, 0x0A, 0xE9, 0x09, 0x48, 0x57, 0x08, 0x37, 0x4B, 0x07, 0x27, 0x3D, 0x07, 0x27, 0x3E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4B, 0x46, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00,
+	0x3A, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0xCC, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x34, 0x06, 0x3B,
+	0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x13, 0x22, 0x28, 0x0E, 0x22, 0x22, 0x28, 0x0E, 0x12, 0x23, 0x28, 0x0E, 0x21,
+	0x23, 0x28, 0x0E, 0x11, 0x24, 0x48, 0x0C, 0x11, 0x24, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F, 0x1A, 0x06, 0xFA, 0x10,
+	0x06, 0x00, 0x17, 0xF2, 0x10, 0x06, 0x26, 0x24, 0x0F, 0x03, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x26, 0x28,
+	0x29, 0x12, 0x26, 0x28, 0x59, 0x26, 0x28, 0x49, 0x01, 0x26, 0x48, 0x0C, 0x26, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F,
+	0x1A, 0x06, 0xFA, 0x10, 0x21, 0x12, 0xFA, 0x10, 0x51, 0xFA, 0x10, 0x41, 0x01, 0x2C, 0x0F, 0x03, 0x2A, 0x0F, 0x05, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x10, 0x25, 0x28, 0x0E,
+	0x20, 0x24, 0x28, 0x0E, 0x21, 0x23, 0x28, 0x0E, 0x31, 0x22, 0x28, 0x0E, 0x22, 0x22, 0x28, 0x0E, 0x31, 0x22, 0x28, 0x0E, 0x21, 0x23, 0x48, 0x0C, 0x20, 0x24, 0x58, 0x0B, 0x10, 0x35, 0x86, 0x09,
+	0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F, 0x1A, 0x06, 0x14, 0x0F, 0x0C, 0x24, 0xF4, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x35, 0xF2, 0x10, 0x06, 0x26,
+	0x24, 0x0F, 0x03, 0x35, 0x22, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36,
+	0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x13, 0x22, 0x36, 0x27, 0x06, 0x22, 0x22, 0x36, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x20, 0x24, 0x37, 0x26, 0x06,
+	0x10, 0x35, 0x36, 0x35, 0x06, 0x37, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x7B, 0x35, 0x06, 0x3A, 0x32, 0x35, 0x06, 0x2A,
+	0x24, 0x26, 0x06, 0x17, 0x22, 0x34, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x35, 0x24, 0x06, 0x24, 0x34, 0x34, 0x33, 0x06, 0x14, 0x36, 0x74, 0x07,
+	0x3B, 0x74, 0x07, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x13, 0x32, 0x34, 0x37, 0x06, 0x22, 0x22, 0x26, 0x28, 0x06, 0x21, 0x23, 0x36,
+	0x27, 0x06, 0x30, 0x23, 0x36, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x21, 0x23, 0x37, 0x26, 0x06, 0x22, 0x32, 0x36, 0x35, 0x06, 0x13, 0x33, 0x36, 0x33, 0x07,
+	0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x17, 0x73, 0x35, 0x06, 0x26, 0x32, 0x32, 0x35, 0x06, 0x25, 0x23, 0x24, 0x26, 0x06, 0x34, 0x23, 0x34,
+	0x25, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x25, 0x23, 0x35, 0x24, 0x06, 0x26, 0x32, 0x34, 0x33, 0x06, 0x17, 0x33, 0x74, 0x07, 0x3B, 0x74, 0x07, 0x0F, 0x16, 0x0A,
+	0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x26, 0x36, 0x27, 0x24, 0x26, 0x36, 0x27, 0x11, 0x22, 0x26, 0x27,
+	0x47, 0x22, 0x26, 0x27, 0x27, 0x51, 0x26, 0x37, 0x26, 0x32, 0x01, 0x36, 0x36, 0x35, 0x06, 0x37, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B,
+	0x35, 0x07, 0x7B, 0x35, 0x06, 0x3A, 0x32, 0x35, 0x06, 0x2A, 0x24, 0x26, 0x24, 0x2A, 0x34, 0x25, 0x11, 0x22, 0x2A, 0x25, 0x45, 0x22, 0x2A, 0x25, 0x25, 0x51, 0x2A, 0x35, 0x24, 0x32, 0x01, 0x3A,
+	0x34, 0x33, 0x06, 0x3B, 0x74, 0x07, 0x00, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x10, 0x35, 0x34, 0x37, 0x06, 0x20, 0x24, 0x26, 0x28,
+	0x06, 0x21, 0x23, 0x36, 0x27, 0x06, 0x31, 0x22, 0x36, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x37, 0x26, 0x06, 0x20, 0x34, 0x36, 0x35, 0x06, 0x10,
+	0x36, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x14, 0x76, 0x35, 0x06, 0x24, 0x34, 0x32, 0x35, 0x06, 0x25, 0x23, 0x24, 0x26,
+	0x06, 0x35, 0x22, 0x34, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x35, 0x24, 0x06, 0x24, 0x34, 0x34, 0x33, 0x06, 0x14, 0x36, 0x74, 0x07, 0x3B, 0x74,
+	0x07, 0x1D, 0x45, 0x09, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x21, 0x12, 0xF6, 0x50, 0x51, 0xF6, 0x50, 0x41, 0x01, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x10, 0x07, 0xF7, 0x40, 0x06, 0xF7, 0x40, 0x21, 0x12, 0x2A, 0x2C, 0x51, 0x2A, 0x2C, 0x41, 0x01, 0x2A, 0x2C, 0x06, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x10, 0x25,
+	0x0F, 0x09, 0x20, 0x24, 0x0F, 0x09, 0x21, 0x23, 0x0F, 0x09, 0x31, 0xF2, 0x50, 0x06, 0x22, 0xF2, 0x50, 0x06, 0x31, 0xF2, 0x50, 0x06, 0x21, 0x23, 0x0F, 0x09, 0x20, 0x24, 0x0F, 0x09, 0x10, 0x25,
+	0x0F, 0x09, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x10, 0x07, 0xF7, 0x40, 0x06, 0x00, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x25, 0x12, 0x0F, 0x07, 0x55, 0x0F, 0x07, 0x26, 0x0F,
+	0x09, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x2A, 0x24, 0x0E, 0x00, 0xF9, 0x10, 0x07, 0xF7,
+	0x40, 0x06, 0x00, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x22, 0x0F, 0x24, 0x07, 0x30, 0x0F, 0x35, 0x06, 0x20, 0x0F, 0x27, 0x06,
+	0x00, 0x21, 0x0F, 0x26, 0x06, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x31, 0x0F, 0x24, 0x07, 0x20, 0x0F, 0x44, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07,
+	0x26, 0xF2, 0x10, 0x06, 0x34, 0x0F, 0x31, 0x06, 0x24, 0x0F, 0x23, 0x06, 0x00, 0x25, 0x0F, 0x22, 0x06, 0x00, 0x26, 0x2F, 0x07, 0x26, 0x2E, 0x08, 0x35, 0xF2, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06,
+	0xFA, 0x10, 0x06, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x21, 0x0F, 0x35, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x00, 0x00, 0x00, 0x00, 0x21, 0x0F, 0x35,
+	0x06, 0x21, 0x0F, 0x25, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x26,
+	0x2F, 0x07, 0x26, 0x2E, 0x08, 0x26, 0xF2, 0x10, 0x06, 0xFA, 0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x20, 0x0F, 0x26, 0x07, 0x30, 0x0F, 0x35, 0x06,
+	0x31, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x00, 0x00, 0x31, 0x0F, 0x25, 0x06, 0x30, 0x0F, 0x35, 0x06, 0x20, 0x0F, 0x26, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA,
+	0x08, 0xFA, 0x07, 0x24, 0xF4, 0x10, 0x06, 0x34, 0x0F, 0x31, 0x06, 0x35, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x35, 0x2F, 0x07, 0x34, 0x2F, 0x08, 0x24, 0xF4, 0x10, 0x06, 0xFA,
+	0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x31, 0x0F, 0x34, 0x06, 0x50, 0x0F, 0x24, 0x06, 0x10, 0x23, 0x0F, 0x23, 0x06, 0x00, 0x00,
+	0x50, 0x0F, 0x24, 0x06, 0x31, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x33, 0x0F, 0x32, 0x06, 0x52,
+	0x0F, 0x22, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x52, 0x0F, 0x21, 0x07, 0x33, 0x0F, 0x21, 0x08, 0xFA, 0x10, 0x06, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F,
+	0x46, 0x07, 0x13, 0x0F, 0x24, 0x07, 0x22, 0x0F, 0x34, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x00, 0x10, 0x12, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x21, 0x0F, 0x35, 0x06,
+	0x20, 0x0F, 0x26, 0x07, 0x20, 0x0F, 0x44, 0x07, 0x10, 0xF5, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x17, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x22,
+	0x06, 0x24, 0x0F, 0x23, 0x06, 0x00, 0x14, 0x12, 0x2F, 0x07, 0x26, 0x2E, 0x08, 0x25, 0xF3, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46,
+	0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x29, 0x32, 0x01, 0x0F, 0x89, 0x0F, 0x39, 0x23, 0x0F, 0x29, 0x24, 0x0F, 0x38, 0x24, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6,
+	0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x32, 0x01, 0x0F, 0x28, 0x61, 0x0F, 0x27, 0x12, 0x23, 0xFA,
+	0x10, 0x24, 0x00, 0xFA, 0x10, 0x06, 0x26, 0x0F, 0x09, 0x56, 0x0F, 0x06, 0x96, 0x0F, 0x02, 0xA8, 0x0E, 0xAC, 0x0A, 0x0F, 0x91, 0x07, 0x0F, 0x74, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x13,
+	0x8C, 0x08, 0x22, 0x98, 0x0B, 0x21, 0x86, 0x0F, 0x30, 0x73, 0x0F, 0x04, 0x20, 0x34, 0x0F, 0x08, 0x30, 0x73, 0x0F, 0x04, 0x21, 0x86, 0x0F, 0x22, 0x98, 0x0B, 0x13, 0x8C, 0x08, 0x0F, 0x74, 0x06,
+	0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x0F, 0x91, 0x07, 0x9C, 0x0B, 0xA8, 0x0E, 0x96, 0x0F, 0x02, 0x56, 0x0F, 0x06, 0x2A, 0x0F, 0x05, 0x6A, 0x0F, 0x01, 0xAA, 0x0C, 0xAE, 0x08, 0x0F, 0x74, 0x06,
+	0x0F, 0x29, 0x06, 0x17, 0x6C, 0x06, 0x26, 0x88, 0x08, 0x25, 0x85, 0x0C, 0x34, 0x63, 0x0F, 0x01, 0x24, 0x24, 0x0F, 0x05, 0x34, 0x63, 0x0F, 0x01, 0x25, 0x85, 0x0C, 0x26, 0x88, 0x08, 0x17, 0x6C,
+	0x06, 0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x9F, 0x08, 0xAA, 0x0C, 0x6A, 0x0F, 0x01, 0x16, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x46, 0x0F, 0x07, 0x47, 0x0F, 0x06, 0x58, 0x0F, 0x04, 0x13, 0x46, 0x0F,
+	0x03, 0x22, 0x57, 0x0F, 0x01, 0x21, 0x4A, 0x0F, 0x30, 0xCB, 0x06, 0x20, 0xBD, 0x06, 0x30, 0xCB, 0x06, 0x21, 0x4A, 0x0F, 0x22, 0x57, 0x0F, 0x01, 0x13, 0x46, 0x0F, 0x03, 0x58, 0x0F, 0x04, 0x47,
+	0x0F, 0x06, 0x46, 0x0F, 0x07, 0x26, 0x0F, 0x09, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x17, 0x84, 0x2A, 0x26, 0x77, 0x37, 0x25, 0x7B, 0x42, 0x01, 0x34, 0x8F, 0x02, 0x24, 0x0F, 0x61,
+	0x04, 0x34, 0x6C, 0x07, 0x25, 0x69, 0x0A, 0x26, 0x75, 0x0C, 0x17, 0x72, 0x0F, 0x4A, 0x0F, 0x03, 0x16, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x46, 0x0F, 0x07, 0x47, 0x0F, 0x06, 0x58, 0x0F, 0x04, 0x4A,
+	0x0F, 0x03, 0x31, 0x57, 0x0F, 0x01, 0x31, 0x49, 0x0F, 0xCE, 0x06, 0xBF, 0x06, 0xCE, 0x06, 0x4D, 0x0F, 0x31, 0x57, 0x0F, 0x01, 0x31, 0x46, 0x0F, 0x03, 0x58, 0x0F, 0x04, 0x47, 0x0F, 0x06, 0x46,
+	0x0F, 0x07, 0x26, 0x0F, 0x09, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x4B, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23, 0x06, 0x13, 0x22, 0x47, 0x25, 0x06, 0x22,
+	0x22, 0x46, 0x26, 0x06, 0x12, 0x23, 0x45, 0x27, 0x06, 0x21, 0x23, 0x43, 0x29, 0x06, 0x11, 0x24, 0x42, 0x2A, 0x06, 0x11, 0x24, 0x41, 0x2B, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E, 0x06, 0x26, 0x0F,
+	0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47, 0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x17, 0x22, 0x45, 0x23, 0x06, 0x26, 0x22, 0x43, 0x25, 0x06,
+	0x25, 0x23, 0x42, 0x26, 0x06, 0x24, 0x24, 0x41, 0x27, 0x06, 0x24, 0x54, 0x29, 0x06, 0x14, 0x45, 0x2A, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D,
+	0x06, 0x26, 0x4B, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23, 0x06, 0x26, 0x47, 0x25, 0x06, 0x22, 0x22, 0x46, 0x26, 0x06, 0x22, 0x22, 0x45, 0x27, 0x06, 0x22, 0x22, 0x43, 0x29, 0x06,
+	0x26, 0x42, 0x2A, 0x06, 0x26, 0x41, 0x2B, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47,
+	0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x26, 0x22, 0x45, 0x23, 0x06, 0x26, 0x22, 0x43, 0x25, 0x06, 0x26, 0x22, 0x42, 0x26, 0x06, 0x2A, 0x41, 0x27, 0x06, 0x5A, 0x29, 0x06, 0x4A, 0x2A, 0x06, 0x3A,
+	0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x4B, 0x21, 0x06, 0x10, 0x25, 0x4A, 0x22, 0x06, 0x20, 0x24, 0x49, 0x23, 0x06, 0x21, 0x23, 0x47, 0x25,
+	0x06, 0x31, 0x22, 0x46, 0x26, 0x06, 0x22, 0x22, 0x45, 0x27, 0x06, 0x31, 0x22, 0x43, 0x29, 0x06, 0x21, 0x23, 0x42, 0x2A, 0x06, 0x20, 0x24, 0x41, 0x2B, 0x06, 0x10, 0x55, 0x2D, 0x06, 0x46, 0x2E,
+	0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x14, 0x25, 0x59, 0x06, 0x24, 0x24, 0x47, 0x21, 0x06, 0x25, 0x23, 0x46, 0x22, 0x06, 0x35, 0x22, 0x45, 0x23,
+	0x06, 0x26, 0x22, 0x43, 0x25, 0x06, 0x35, 0x22, 0x42, 0x26, 0x06, 0x25, 0x23, 0x41, 0x27, 0x06, 0x24, 0x54, 0x29, 0x06, 0x14, 0x45, 0x2A, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0xF7, 0x40,
+	0x06, 0xF6, 0x50, 0x06, 0xF5, 0x60, 0x06, 0x25, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x26, 0x27, 0x06, 0x00, 0x23, 0x22, 0x26, 0x27, 0x06, 0x00, 0x27, 0x26, 0x27,
+	0x06, 0x00, 0x00, 0x23, 0x22, 0x26, 0x27, 0x06, 0x00, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00,
+	0x27, 0x25, 0x0F, 0x01, 0x27, 0x15, 0x0F, 0x02, 0x27, 0x24, 0x0F, 0x02, 0x27, 0x24, 0x19, 0x07, 0x27, 0x24, 0x28, 0x07, 0x27, 0x24, 0x38, 0x06, 0x27, 0x24, 0x29, 0x06, 0x2D, 0x29, 0x06, 0x00,
+	0x2E, 0x37, 0x06, 0xBE, 0x07, 0x9F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x14, 0x22, 0x0F, 0x08, 0x23, 0x22, 0x0F, 0x08, 0x13, 0x23, 0x0F, 0x08, 0x22,
+	0x23, 0x0F, 0x08, 0x12, 0x24, 0x0F, 0x08, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x0F, 0x0F, 0x02, 0x7D, 0x0C, 0xBB, 0x0A, 0x3A, 0x22, 0x42, 0x09, 0x29, 0x24, 0x34, 0x08, 0x28, 0x25, 0x35, 0x07, 0x28,
+	0x25, 0x26, 0x07, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x3D, 0x06, 0x28, 0x2D, 0x07, 0x48, 0x3A, 0x07, 0x49, 0x47, 0x08, 0x3A, 0x37, 0x09, 0x1B, 0x19, 0x0A, 0x0F, 0x0F,
+	0x02, 0x0F, 0x26, 0x09, 0x4A, 0x37, 0x08, 0x69, 0x37, 0x07, 0x28, 0x33, 0x27, 0x07, 0x28, 0x24, 0x37, 0x06, 0x27, 0x35, 0x27, 0x06, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x27, 0x36, 0x26, 0x06,
+	0x27, 0x27, 0x26, 0x06, 0x00, 0x28, 0x26, 0x25, 0x07, 0x38, 0x26, 0x33, 0x07, 0x39, 0x75, 0x08, 0x2A, 0x56, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x23,
+	0x0F, 0x0C, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x23, 0x0F, 0x0C, 0x00, 0x0F, 0x26, 0x09, 0x0F, 0x46, 0x07, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x27, 0x2F, 0x06, 0x00, 0x00,
+	0x27, 0x2E, 0x07, 0xF7, 0x20, 0x08, 0xF7, 0x10, 0x09, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x55, 0x07, 0xAD, 0x09, 0xD7, 0x0C, 0x67, 0x0F, 0x04, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x35, 0x06, 0x0F, 0x31, 0x33, 0x07, 0x0F, 0x72, 0x08, 0x0F, 0x53, 0x09, 0x0F, 0x0F,
+	0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x35, 0x06,
+	0x0F, 0x31, 0x33, 0x07, 0x0F, 0x72, 0x08, 0x0F, 0x53, 0x09, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x25, 0x0F, 0x01, 0x27, 0x24, 0x0F, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0F, 0x02, 0x2E, 0x0F, 0x01, 0xCE, 0x06, 0x0F, 0xA1, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x14, 0x39, 0x0F, 0x23,
+	0x68, 0x0D, 0x13, 0x38, 0x41, 0x0C, 0x22, 0x37, 0x44, 0x0A, 0x12, 0x46, 0x46, 0x09, 0x12, 0x35, 0x59, 0x07, 0x37, 0x4C, 0x06, 0x27, 0x3E, 0x06, 0x17, 0x0F, 0x12, 0x06, 0x0F, 0x0F, 0x02, 0x00,
+	0x00, 0xF7, 0x40, 0x06, 0x17, 0x0F, 0x12, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x0F, 0x0F, 0x02, 0x17, 0x0F, 0x09, 0x37, 0x3D, 0x06,
+	0x47, 0x2D, 0x06, 0x58, 0x2B, 0x06, 0x21, 0x57, 0x29, 0x06, 0x31, 0x48, 0x37, 0x06, 0x32, 0x58, 0x34, 0x07, 0x23, 0x4A, 0x41, 0x08, 0x23, 0x6C, 0x09, 0x23, 0x4C, 0x0B, 0x23, 0x4A, 0x0D, 0x32,
+	0x48, 0x0F, 0x31, 0x57, 0x0F, 0x01, 0x21, 0x56, 0x0F, 0x03, 0x57, 0x0F, 0x05, 0x37, 0x0F, 0x07, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x53, 0x09, 0x5F, 0x0C, 0x7D, 0x0C, 0x5A,
+	0x23, 0x0C, 0x58, 0x25, 0x0C, 0x37, 0x28, 0x0C, 0x00, 0x58, 0x25, 0x0C, 0x5A, 0x23, 0x0C, 0x7D, 0x0C, 0x5F, 0x0C, 0x0F, 0x53, 0x09, 0x0F, 0x55, 0x07, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F,
+	0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x36, 0x35, 0x06, 0x27, 0x37, 0x33, 0x07, 0x0F, 0x72, 0x08, 0x0F, 0x53, 0x09, 0x0F,
+	0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x34, 0x27, 0x06, 0x28, 0x14, 0x21, 0x25, 0x07, 0x78, 0x22, 0x33, 0x07, 0x59,
+	0x73, 0x08, 0x0F, 0x53, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x38, 0x06, 0x0F,
+	0x56, 0x06, 0x0F, 0x92, 0x06, 0xCA, 0x22, 0x06, 0xA7, 0x27, 0x06, 0x37, 0x2E, 0x06, 0x27, 0x2F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x0F, 0x02,
+	0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x17, 0x0F, 0x12, 0x06, 0x27, 0x3E, 0x06, 0x37,
+	0x4C, 0x06, 0x48, 0x58, 0x07, 0x49, 0x55, 0x09, 0x3B, 0x43, 0x0B, 0x8C, 0x0C, 0x5D, 0x0E, 0x2E, 0x0F, 0x01, 0x2F, 0x0F, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x0F, 0x00, 0x3E, 0x0F, 0x00, 0x6D,
+	0x0D, 0x3C, 0x41, 0x0C, 0x4A, 0x44, 0x0A, 0x39, 0x47, 0x09, 0x38, 0x4A, 0x07, 0x37, 0x4C, 0x06, 0x27, 0x3E, 0x06, 0x17, 0x0F, 0x12, 0x06, 0x0F, 0x0F, 0x02, 0x1A, 0x1B, 0x09, 0x39, 0x39, 0x08,
+	0x48, 0x49, 0x07, 0x38, 0x2C, 0x07, 0x37, 0x3D, 0x06, 0x27, 0x2F, 0x06, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x37, 0x44, 0x25, 0x07, 0x28, 0x44, 0x34, 0x07, 0x78, 0x72, 0x08, 0x4A, 0x54,
+	0x09, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x47, 0x06, 0x0F, 0x46, 0x07, 0x0F, 0x44, 0x09, 0x0F, 0x43, 0x0A, 0x0F, 0x41, 0x0C, 0x5E, 0x0D, 0x4D, 0x0F, 0x5B, 0x0F, 0x01, 0x4A,
+	0x0F, 0x03, 0x48, 0x0F, 0x05, 0x47, 0x0F, 0x06, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x47, 0x06, 0x21, 0x0F, 0x43, 0x07, 0x31, 0x4F, 0x09, 0x32, 0x4D,
+	0x0A, 0x23, 0x4B, 0x0C, 0x23, 0x59, 0x0D, 0x23, 0x48, 0x0F, 0x23, 0x56, 0x0F, 0x01, 0x32, 0x45, 0x0F, 0x03, 0x31, 0x44, 0x0F, 0x05, 0x21, 0x44, 0x0F, 0x06, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F,
+	0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x3E, 0x0F, 0x6D, 0x0D, 0x3C, 0x41, 0x0C, 0x3B, 0x44, 0x0A, 0x49, 0x46, 0x09, 0x38, 0x59, 0x07, 0x37, 0x4C, 0x06, 0x27, 0x3E, 0x06,
+	0x17, 0x0F, 0x12, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x55, 0x07, 0xAD, 0x09, 0xD7, 0x0C, 0x67, 0x0F, 0x04, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06,
+	0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x57, 0x0F, 0x05, 0x69, 0x0F, 0x02, 0x6B, 0x0F, 0x6E, 0x0C, 0x0F, 0x61, 0x0A, 0x0F, 0x64, 0x07, 0x0F, 0x56, 0x06, 0x00, 0x0F, 0x64, 0x07,
+	0x0F, 0x61, 0x0A, 0x6E, 0x0C, 0x5C, 0x0F, 0x69, 0x0F, 0x02, 0x57, 0x0F, 0x05, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x7D, 0x0C, 0xBB, 0x0A, 0x3A, 0x37, 0x09, 0x29, 0x3A, 0x08, 0x28, 0x3C, 0x07, 0x28, 0x2D, 0x07, 0x27, 0x2F, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x2D, 0x07, 0x00, 0x29, 0x2B, 0x08, 0x3A, 0x37, 0x09, 0xBB, 0x0A, 0x7D, 0x0C, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x27, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+	0x25, 0x0F, 0x38, 0x33, 0x0F, 0x79, 0x0F, 0x01, 0x5A, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x7D, 0x0C, 0xBB, 0x0A, 0x3A, 0x46, 0x09, 0x29, 0x3A, 0x08, 0x28, 0x3C, 0x07, 0x28, 0x2D, 0x07, 0x27, 0x2F,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x3D, 0x06, 0x28, 0x2D, 0x07, 0x48, 0x3A, 0x07, 0x49, 0x47, 0x08, 0x3A, 0x37, 0x09, 0x1B, 0x19, 0x0A, 0x0F, 0x0F, 0x02, 0x27, 0x0F, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x17, 0x0F, 0x09, 0x37, 0x3D, 0x06, 0x47, 0x2D, 0x06, 0x58, 0x2B, 0x06, 0x5A, 0x29,
+	0x06, 0x4C, 0x37, 0x06, 0x5D, 0x34, 0x07, 0x4F, 0x41, 0x08, 0x0F, 0x62, 0x09, 0x0F, 0x42, 0x0B, 0x4F, 0x0D, 0x4D, 0x0F, 0x5B, 0x0F, 0x01, 0x59, 0x0F, 0x03, 0x57, 0x0F, 0x05, 0x37, 0x0F, 0x07,
+	0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x6D, 0x0D, 0x9B, 0x0C, 0x3A, 0x35, 0x0B, 0x2A, 0x28, 0x0A, 0x39, 0x38, 0x09, 0x29, 0x2A, 0x09, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x29, 0x2A, 0x09, 0x00,
+	0x00, 0x39, 0x38, 0x09, 0x2A, 0x28, 0x0A, 0x3A, 0x35, 0x0B, 0x9B, 0x0C, 0x6D, 0x0D, 0x0F, 0x0F, 0x02, 0x17, 0x0F, 0x12, 0x06, 0x27, 0x3E, 0x06, 0x37, 0x4C, 0x06, 0x48, 0x49, 0x07, 0x49, 0x46,
+	0x09, 0x4B, 0x43, 0x0A, 0x8C, 0x0C, 0x5E, 0x0D, 0x4E, 0x0E, 0x8C, 0x0C, 0x4B, 0x52, 0x0A, 0x49, 0x46, 0x09, 0x48, 0x58, 0x07, 0x37, 0x4C, 0x06, 0x27, 0x3E, 0x06, 0x17, 0x0F, 0x12, 0x06, 0x0F,
+	0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xA7,
+	0x0F, 0xC7, 0x0D, 0x0F, 0x22, 0x0D, 0x0F, 0x23, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x22, 0x0D, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F,
+	0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40,
+	0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x89, 0x00,
+	0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x35, 0x06, 0x0F, 0x31, 0x33, 0x07, 0x0F, 0x72, 0x08,
+	0x0F, 0x53, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x35, 0x06, 0x0F, 0x31, 0x33, 0x07, 0x0F, 0x72, 0x08, 0x0F,
+	0x53, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x35,
+	0x06, 0x0F, 0x31, 0x33, 0x07, 0x0F, 0x72, 0x08, 0x0F, 0x53, 0x09, 0x0F, 0x0F, 0x02, 0x1B, 0x19, 0x0A, 0x3A, 0x37, 0x09, 0x49, 0x38, 0x08, 0x38, 0x3B, 0x07, 0x28, 0x2D, 0x07, 0x37, 0x3D, 0x06,
+	0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x28, 0x25, 0x26, 0x07, 0x00, 0x29, 0x24, 0x34, 0x08, 0x49, 0x22, 0x52, 0x08, 0xBB, 0x0A, 0x7D, 0x0C, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06,
+	0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0C, 0xCA, 0x0A, 0x49, 0x47, 0x08, 0x38, 0x3B, 0x07, 0x28, 0x2D, 0x07, 0x37, 0x3D, 0x06, 0x27, 0x2F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x37, 0x3D,
+	0x06, 0x28, 0x2D, 0x07, 0x38, 0x3B, 0x07, 0x49, 0x47, 0x08, 0xBB, 0x0A, 0x7D, 0x0C, 0x0F, 0x0F, 0x02, 0x0F, 0x1A, 0x06, 0x5A, 0x29, 0x06, 0x79, 0x46, 0x06, 0x38, 0x33, 0x34, 0x08, 0x37, 0x25,
+	0x42, 0x09, 0x27, 0x57, 0x0B, 0x27, 0x47, 0x0C, 0x27, 0x27, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x2D, 0x54, 0x08, 0x3C, 0x73, 0x07, 0x2C, 0x24,
+	0x33, 0x06, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x00, 0x2B, 0x24, 0x24, 0x07, 0x3B, 0x23, 0x23, 0x08, 0xDC, 0x07, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xCB, 0x09, 0xF9,
+	0x08, 0x38, 0x33, 0x35, 0x07, 0x28, 0x23, 0x29, 0x06, 0x27, 0x23, 0x2A, 0x06, 0x00, 0x36, 0x23, 0x2A, 0x06, 0x26, 0x24, 0x2A, 0x06, 0x00, 0x26, 0x34, 0x38, 0x06, 0x26, 0xC5, 0x07, 0x26, 0xA6,
+	0x08, 0x0F, 0x61, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x42, 0x33, 0x06, 0x5C, 0x71, 0x07, 0x3D, 0x53, 0x08, 0x0F, 0x0F, 0x02,
+	0x00, 0xFB, 0x06, 0x00, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x47, 0x06, 0x0F, 0x74, 0x06, 0xDD, 0x06, 0xAB, 0x23, 0x06, 0x5B, 0x28, 0x06, 0x2B, 0x2B, 0x06,
+	0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x0F, 0x02, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x22, 0x33, 0x07, 0x3B, 0x23, 0x24, 0x07, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3B,
+	0x23, 0x25, 0x06, 0x3C, 0x22, 0x24, 0x07, 0x6D, 0x33, 0x07, 0x4F, 0x23, 0x08, 0x1B, 0x1D, 0x06, 0x2B, 0x3A, 0x06, 0x4B, 0x56, 0x06, 0x3D, 0x53, 0x08, 0x3E, 0x41, 0x0A, 0x5F, 0x0C, 0x0F, 0x31,
+	0x0D, 0x0F, 0x22, 0x0D, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x0D, 0x0F, 0x31, 0x0D, 0x5F, 0x0C, 0x3E, 0x41, 0x0A, 0x3D, 0x53, 0x08, 0x4B, 0x56, 0x06, 0x2B, 0x3A, 0x06, 0x1B, 0x1D, 0x06, 0x0F, 0x0F,
+	0x02, 0x2D, 0x27, 0x08, 0x3C, 0x37, 0x07, 0x3B, 0x39, 0x06, 0x2B, 0x2B, 0x06, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x3B, 0x42, 0x33, 0x06, 0x5C, 0x62, 0x07, 0x3D, 0x44, 0x08, 0x0F, 0x0F, 0x02,
+	0x00, 0xFB, 0x06, 0x00, 0x0F, 0x47, 0x06, 0x0F, 0x36, 0x08, 0x0F, 0x44, 0x09, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x0F, 0x01, 0x4B, 0x0F, 0x02, 0xFB, 0x06, 0x00, 0x0F, 0x0F,
+	0x02, 0x00, 0xFB, 0x06, 0x25, 0xF4, 0x06, 0x35, 0x4E, 0x06, 0x36, 0x3C, 0x08, 0x27, 0x4A, 0x09, 0x27, 0x48, 0x0B, 0x27, 0x37, 0x0D, 0x27, 0x45, 0x0E, 0x36, 0x34, 0x0F, 0x01, 0x35, 0x43, 0x0F,
+	0x02, 0x25, 0xF4, 0x06, 0xFB, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x0D, 0x0F, 0x31, 0x0D, 0x5F, 0x0C, 0x3E, 0x41, 0x0A, 0x3D, 0x44, 0x08, 0x4B, 0x56, 0x06, 0x2B, 0x3A,
+	0x06, 0x1B, 0x1D, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x47, 0x06, 0x0F, 0x73, 0x07, 0xCB, 0x09, 0x8B, 0x0D, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02,
+	0x00, 0xFB, 0x06, 0x00, 0x4B, 0x0F, 0x02, 0x6B, 0x0F, 0x6E, 0x0C, 0x0F, 0x62, 0x09, 0x0F, 0x65, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x62, 0x09, 0x6E, 0x0C, 0x5C, 0x0F, 0x4B, 0x0F,
+	0x02, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x37,
+	0x07, 0x3B, 0x39, 0x06, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x3B, 0x39, 0x06, 0x3C, 0x37, 0x07, 0xBD, 0x08, 0x7F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x2B, 0x0F, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x60, 0x00, 0x2D, 0x27, 0x08, 0x2C, 0x29, 0x07, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x3B, 0x39, 0x06, 0x3C, 0x37, 0x07,
+	0xBD, 0x08, 0x8E, 0x0A, 0x0F, 0x0F, 0x02, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x37, 0x07, 0x2C, 0x29, 0x07, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x3B, 0x39, 0x06, 0x3C, 0x37, 0x07, 0x3D, 0x35, 0x08,
+	0x2E, 0x25, 0x09, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x0F, 0x04, 0x4B, 0x2F, 0x7B, 0x2C, 0x6E, 0x2A, 0x0F, 0x71, 0x36,
+	0x0F, 0x64, 0x42, 0x01, 0x0F, 0x87, 0x02, 0x0F, 0x67, 0x04, 0x0F, 0x64, 0x07, 0x0F, 0x62, 0x09, 0x6E, 0x0C, 0x7B, 0x0E, 0x4B, 0x0F, 0x02, 0x2B, 0x0F, 0x04, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x37,
+	0x07, 0x3B, 0x39, 0x06, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x2C, 0x29, 0x07, 0x2D, 0x27, 0x08, 0xF6, 0xB0, 0x00, 0x2D, 0x27, 0x08, 0x2C, 0x29, 0x07, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x3B,
+	0x39, 0x06, 0x3C, 0x37, 0x07, 0xBD, 0x08, 0x7F, 0x0A, 0x1B, 0x1D, 0x06, 0x2B, 0x3A, 0x06, 0x4B, 0x47, 0x06, 0x4C, 0x35, 0x08, 0x4E, 0x41, 0x09, 0x6F, 0x0B, 0x0F, 0x32, 0x0C, 0x6F, 0x0B, 0x4E,
+	0x41, 0x09, 0x4C, 0x35, 0x08, 0x4B, 0x47, 0x06, 0x2B, 0x3A, 0x06, 0x1B, 0x1D, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+	0x06, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x8B, 0x0D, 0x9B, 0x0C, 0x0F, 0x33, 0x0B, 0x0F, 0x24, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0x14, 0x0C, 0x0F, 0x23, 0x0C, 0xFB, 0x06, 0x00, 0x0F,
+	0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00,
+	0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x89, 0x00, 0x2B, 0x0F, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x32, 0x33, 0x06, 0x0F, 0x73, 0x07, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F,
+	0x22, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x23, 0x23, 0x07, 0x0F, 0x73, 0x07, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06,
+	0x00, 0x0F, 0x22, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x32, 0x23, 0x07, 0x0F, 0x73, 0x07, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x2D, 0x27, 0x08, 0x3C, 0x37, 0x07, 0x2C, 0x29, 0x07,
+	0x2B, 0x2B, 0x06, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x3B, 0x23, 0x34, 0x06, 0x3C, 0x22, 0x33, 0x07, 0xBD, 0x08, 0x7F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x0D, 0x00,
+	0x00, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x37, 0x07, 0x3B, 0x39, 0x06, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x3B, 0x39, 0x06, 0x3C, 0x37, 0x07, 0xBD, 0x08, 0x7F, 0x0A, 0x0F, 0x1A, 0x06, 0x5D, 0x26,
+	0x06, 0x7C, 0x34, 0x06, 0x2C, 0x23, 0x42, 0x07, 0x2B, 0x55, 0x09, 0x2B, 0x45, 0x0A, 0x2B, 0x25, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x7F, 0x0A, 0xBD, 0x08, 0x3C,
+	0x22, 0x33, 0x07, 0x26, 0x33, 0x23, 0x24, 0x07, 0x26, 0x23, 0x24, 0x25, 0x06, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x26, 0x33, 0x23, 0x25, 0x06, 0x26, 0x34, 0x22, 0x24, 0x07, 0x6D, 0x33, 0x07,
+	0x4F, 0x23, 0x08, 0x28, 0x0F, 0x07, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x28, 0x23, 0x0F, 0x02, 0x28, 0x22, 0x0F, 0x03, 0x28, 0x21, 0x0F, 0x04, 0x00, 0x2B, 0x0F, 0x04, 0x2B, 0x0F, 0x22, 0x00, 0x3B,
+	0x0F, 0x21, 0xFC, 0x50, 0xFD, 0x30, 0x01, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x18, 0x22, 0x0F, 0x04, 0x27, 0x22, 0x0F, 0x04, 0x26, 0x23, 0x0F, 0x04, 0x25, 0x24, 0x0F, 0x04, 0x00, 0x15,
+	0x25, 0x0F, 0x04, 0x0F, 0x0F, 0x02, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x22, 0x42, 0x07, 0x2C, 0x23, 0x24, 0x07, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x00, 0x2B, 0x2B, 0x06, 0x00, 0x2C, 0x29, 0x07,
+	0x3C, 0x37, 0x07, 0x1E, 0x27, 0x08, 0x0F, 0x0F, 0x02, 0x4D, 0x25, 0x08, 0x6C, 0x34, 0x07, 0x3B, 0x22, 0x35, 0x06, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x2B, 0x34, 0x24, 0x06, 0x2B, 0x25, 0x24,
+	0x06, 0x2C, 0x34, 0x22, 0x07, 0x3C, 0x64, 0x07, 0x2D, 0x45, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x26, 0xF3, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x26, 0x0F, 0x09, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02,
+	0x26, 0x0F, 0x09, 0x00, 0x0F, 0x2F, 0x00, 0x26, 0xF3, 0x60, 0x26, 0xF3, 0x50, 0x01, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x47, 0x06, 0x0F, 0x73, 0x07, 0xDB, 0x08, 0x9B, 0x0C, 0x3B, 0x0F, 0x03, 0x2B,
+	0x0F, 0x04, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x32, 0x23, 0x07, 0x0F, 0x73, 0x07, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0xFB,
+	0x06, 0x00, 0x0F, 0x22, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x32, 0x33, 0x06, 0x0F, 0x73, 0x07, 0x0F, 0x54, 0x08, 0x28,
+	0x0F, 0x07, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x28, 0x23, 0x0F, 0x02, 0x28, 0x22, 0x0F, 0x03, 0x28, 0x21, 0x0F, 0x04, 0x00, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x3B, 0x0F, 0x03, 0xEC, 0x06, 0xDD, 0x06,
+	0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x0D, 0x18, 0x37, 0x0D, 0x27, 0x56, 0x0C, 0x26, 0x36, 0x41, 0x0A, 0x25, 0x36, 0x44, 0x08, 0x25, 0x44, 0x56, 0x06, 0x15, 0x25, 0x3A, 0x06,
+	0x1B, 0x1D, 0x06, 0x2B, 0x0F, 0x04, 0x4B, 0x2F, 0x7B, 0x2C, 0x26, 0x66, 0x2A, 0x36, 0x77, 0x36, 0x37, 0x69, 0x42, 0x01, 0x28, 0x8C, 0x02, 0x28, 0x6C, 0x04, 0x28, 0x69, 0x07, 0x28, 0x67, 0x09,
+	0x37, 0x64, 0x0C, 0x36, 0x72, 0x0E, 0x26, 0x43, 0x0F, 0x02, 0x2B, 0x0F, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x29, 0x06, 0x00,
+	0xFB, 0x06, 0x00, 0x26, 0x11, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x0F, 0x08, 0x00, 0x0F,
+	0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0F, 0x04, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF3, 0xD0, 0x01, 0x33, 0x0F, 0x28, 0x01, 0x13, 0x21, 0x0F, 0x16,
+	0x11, 0x01, 0x13, 0x32, 0x0F, 0x22, 0x12, 0x01, 0x13, 0x24, 0x1F, 0x14, 0x01, 0x13, 0x25, 0x1D, 0x15, 0x01, 0x13, 0x26, 0x1B, 0x16, 0x01, 0x13, 0x27, 0x19, 0x17, 0x01, 0x13, 0x29, 0x25, 0x18,
+	0x01, 0x13, 0x2A, 0x23, 0x19, 0x01, 0x13, 0x2B, 0x11, 0x1B, 0x01, 0x13, 0x3C, 0x1B, 0x01, 0x13, 0x2B, 0x11, 0x1B, 0x01, 0x13, 0x1A, 0x24, 0x19, 0x01, 0x13, 0x19, 0x26, 0x18, 0x01, 0x13, 0x27,
+	0x28, 0x17, 0x01, 0x13, 0x26, 0x1B, 0x16, 0x01, 0x13, 0x25, 0x1D, 0x15, 0x01, 0x13, 0x24, 0x1F, 0x14, 0x01, 0x13, 0x22, 0x0F, 0x23, 0x12, 0x01, 0x13, 0x21, 0x0F, 0x25, 0x11, 0x01, 0x33, 0x0F,
+	0x28, 0x01, 0xF3, 0xD0, 0x01, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x48, 0x05, 0x2C, 0x67, 0x05, 0x2C, 0x36, 0x23, 0x04, 0x2C, 0x35, 0x24, 0x04, 0x2C, 0x34, 0x25, 0x04, 0x2C, 0x24, 0x25,
+	0x05, 0xEA, 0x21, 0x05, 0xF9, 0x40, 0x04, 0x59, 0x23, 0x54, 0x04, 0x2C, 0x22, 0x34, 0x07, 0x2C, 0x22, 0x33, 0x08, 0x2C, 0x22, 0x32, 0x24, 0x03, 0x2C, 0x52, 0x26, 0x03, 0x3B, 0x51, 0x27, 0x03,
+	0x2B, 0x32, 0x38, 0x03, 0x2B, 0x12, 0x21, 0x27, 0x04, 0x2B, 0x24, 0x36, 0x04, 0x1C, 0x25, 0x34, 0x05, 0x0F, 0x83, 0x06, 0x0F, 0x55, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x47, 0x06, 0x29, 0x89,
+	0x04, 0x29, 0x47, 0x24, 0x04, 0x29, 0x36, 0x26, 0x04, 0x29, 0x35, 0x27, 0x04, 0x29, 0x25, 0x28, 0x04, 0x29, 0x24, 0x28, 0x05, 0x29, 0x84, 0x31, 0x05, 0x15, 0xF1, 0x50, 0x05, 0xB5, 0x57, 0x04,
+	0x29, 0x23, 0x66, 0x04, 0x29, 0x22, 0x55, 0x12, 0x04, 0x29, 0x22, 0x44, 0x09, 0x29, 0x22, 0x52, 0x16, 0x03, 0x29, 0x82, 0x36, 0x02, 0x29, 0x52, 0x29, 0x03, 0x28, 0x42, 0x2B, 0x03, 0x28, 0x42,
+	0x3A, 0x03, 0x28, 0x24, 0x2A, 0x04, 0x28, 0x34, 0x28, 0x05, 0x3F, 0x45, 0x05, 0x0F, 0x91, 0x07, 0x0F, 0x63, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x09, 0xEC, 0x06, 0x0F, 0x67,
+	0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x2C, 0x03, 0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x49, 0x04, 0x0F, 0x57, 0x05, 0x0F, 0x28, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2D, 0x0F, 0x02, 0x4D, 0x0F, 0x5E, 0x0D,
+	0x0F, 0x71, 0x09, 0x0F, 0x83, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xC8, 0x0C, 0xF8, 0x10, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x39, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x2B, 0x04, 0x00,
+	0x0F, 0x3A, 0x04, 0x0F, 0x48, 0x05, 0x0F, 0x65, 0x06, 0x0F, 0x36, 0x08, 0x0F, 0x17, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x1A, 0x0F, 0x06, 0x39, 0x0F, 0x05, 0x59, 0x0F, 0x03, 0x6B, 0x0F, 0x7D,
+	0x0C, 0x9F, 0x08, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x31, 0x0D, 0x00, 0x0F, 0x21, 0x0E, 0x2A, 0x24, 0x1A, 0x03, 0x2A, 0x24, 0x39, 0x02, 0x2A, 0x23, 0x2A,
+	0x03, 0x00, 0x2B, 0x22, 0x2A, 0x03, 0x2B, 0x22, 0x39, 0x03, 0x2B, 0x22, 0x29, 0x04, 0x2B, 0x22, 0x28, 0x05, 0x2B, 0x32, 0x36, 0x05, 0x2B, 0x33, 0x43, 0x06, 0x0F, 0x82, 0x07, 0x0F, 0x53, 0x09,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2E, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x00, 0x17, 0x25, 0x0F, 0x02, 0x26, 0x25, 0x1C, 0x04, 0x26, 0x25, 0x2C, 0x03, 0x26, 0x34, 0x2C, 0x03, 0x26, 0x24, 0x3C,
+	0x03, 0x26, 0x24, 0x2C, 0x04, 0x27, 0x23, 0x2C, 0x04, 0x27, 0x23, 0x3B, 0x04, 0x27, 0x23, 0x2B, 0x05, 0x27, 0x23, 0x3A, 0x05, 0x27, 0x33, 0x38, 0x06, 0x27, 0x24, 0x47, 0x06, 0x27, 0x34, 0x45,
+	0x07, 0x9E, 0x09, 0x0F, 0x51, 0x0B, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x0F, 0x21, 0x47, 0x03, 0x0F, 0x21, 0x36, 0x05, 0x1B, 0x24, 0x35, 0x06, 0x2A, 0x24,
+	0x34, 0x07, 0x2A, 0x24, 0x33, 0x08, 0x2A, 0x24, 0x32, 0x09, 0x2A, 0x14, 0x42, 0x09, 0x1B, 0x14, 0x42, 0x09, 0x2B, 0x13, 0x21, 0x42, 0x06, 0x2B, 0x33, 0x54, 0x04, 0x2B, 0x32, 0x38, 0x03, 0x2B,
+	0x22, 0x2A, 0x03, 0x0F, 0x11, 0x2A, 0x03, 0x0F, 0x2C, 0x03, 0x00, 0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x2D, 0x4A, 0x03, 0x2D, 0x49, 0x04, 0x2D,
+	0x48, 0x05, 0x15, 0x11, 0x25, 0x47, 0x06, 0x26, 0x25, 0x46, 0x07, 0x26, 0x25, 0x45, 0x08, 0x26, 0x25, 0x44, 0x09, 0x26, 0x15, 0x44, 0x0A, 0x26, 0x15, 0x53, 0x0A, 0x26, 0x15, 0x32, 0x31, 0x09,
+	0x27, 0x23, 0x31, 0x52, 0x07, 0x27, 0x53, 0x74, 0x04, 0x27, 0x43, 0x58, 0x03, 0x27, 0x33, 0x3B, 0x03, 0x27, 0x23, 0x2D, 0x03, 0x1D, 0x2D, 0x03, 0x0F, 0x2C, 0x03, 0x00, 0x00, 0x00, 0x0F, 0x3B,
+	0x03, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2E, 0x47, 0x05, 0x2E, 0x66, 0x04, 0x2E, 0x35, 0x22, 0x04, 0x2E, 0x25, 0x24, 0x03, 0x2E, 0x24, 0x25, 0x03, 0xFA, 0x40, 0x03, 0xFA, 0x30, 0x04, 0x2E,
+	0x23, 0x0B, 0x2E, 0x13, 0x0C, 0x2D, 0x23, 0x0C, 0x2D, 0x23, 0x27, 0x03, 0x00, 0x0F, 0x23, 0x27, 0x03, 0x0F, 0x23, 0x36, 0x03, 0x1D, 0x24, 0x26, 0x04, 0x2C, 0x25, 0x25, 0x04, 0x2D, 0x34, 0x23,
+	0x05, 0x2D, 0x75, 0x05, 0x2E, 0x45, 0x07, 0x3E, 0x0F, 0x1F, 0x0F, 0x01, 0x0F, 0x0F, 0x02, 0x00, 0x2A, 0x3B, 0x06, 0x2A, 0x69, 0x05, 0x2A, 0x38, 0x32, 0x04, 0x2A, 0x37, 0x34, 0x03, 0x2A, 0x27,
+	0x26, 0x03, 0x2A, 0x36, 0x26, 0x03, 0xAA, 0x27, 0x03, 0xF5, 0x90, 0x03, 0x75, 0xB5, 0x04, 0x2A, 0x25, 0x0D, 0x29, 0x26, 0x0D, 0x29, 0x25, 0x19, 0x04, 0x29, 0x25, 0x29, 0x03, 0x00, 0x1A, 0x25,
+	0x29, 0x03, 0x0F, 0x21, 0x29, 0x03, 0x0F, 0x21, 0x28, 0x04, 0x19, 0x36, 0x27, 0x04, 0x28, 0x27, 0x36, 0x04, 0x29, 0x36, 0x34, 0x05, 0x39, 0x86, 0x06, 0x2A, 0x58, 0x07, 0x2B, 0x0F, 0x04, 0x3B,
+	0x0F, 0x03, 0x0F, 0x0F, 0x02, 0x2C, 0x1E, 0x03, 0x2C, 0x3C, 0x03, 0x2C, 0x5A, 0x03, 0x2C, 0x68, 0x04, 0x1C, 0x67, 0x06, 0x2B, 0x73, 0x09, 0xAB, 0x0B, 0xC6, 0x18, 0x05, 0x95, 0x2D, 0x03, 0x55,
+	0x21, 0x2E, 0x03, 0x2B, 0x2E, 0x03, 0x00, 0x00, 0x2B, 0x3D, 0x03, 0x3B, 0x68, 0x04, 0xFC, 0x05, 0xAD, 0x09, 0x0F, 0x0F, 0x02, 0x19, 0x0F, 0x07, 0x38, 0x0F, 0x06, 0x49, 0x0F, 0x04, 0x5A, 0x0F,
+	0x02, 0x6C, 0x0E, 0x6E, 0x0C, 0x0F, 0x31, 0x0D, 0x0F, 0x0F, 0x02, 0x2C, 0x1E, 0x03, 0x2C, 0x3C, 0x03, 0x2C, 0x4B, 0x03, 0x2C, 0x59, 0x04, 0x2C, 0x66, 0x06, 0x2C, 0x63, 0x09, 0x9C, 0x0B, 0xB7,
+	0x18, 0x05, 0x86, 0x2D, 0x03, 0x46, 0x21, 0x2E, 0x03, 0x2B, 0x2E, 0x03, 0x00, 0x00, 0x2B, 0x3D, 0x03, 0x3B, 0x68, 0x04, 0xFC, 0x05, 0xAD, 0x09, 0x0F, 0x0F, 0x02, 0x1A, 0x0F, 0x06, 0x25, 0x32,
+	0x0F, 0x05, 0x45, 0x41, 0x0F, 0x03, 0x37, 0x51, 0x0F, 0x01, 0x14, 0x13, 0x64, 0x0D, 0x34, 0x68, 0x0B, 0x45, 0x38, 0x0C, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2E, 0x0F, 0x01,
+	0x28, 0x24, 0x55, 0x06, 0x28, 0x24, 0x74, 0x05, 0x28, 0x24, 0x14, 0x34, 0x04, 0x28, 0x24, 0x2A, 0x04, 0x28, 0x24, 0x3A, 0x03, 0x28, 0x24, 0x2B, 0x03, 0x00, 0x00, 0x15, 0x22, 0x24, 0x2B, 0x03,
+	0x55, 0x24, 0x2B, 0x03, 0x84, 0x22, 0x24, 0x25, 0x03, 0x88, 0x24, 0x25, 0x03, 0x28, 0x52, 0x23, 0x25, 0x03, 0x37, 0x54, 0x21, 0x25, 0x03, 0x27, 0x34, 0x51, 0x25, 0x03, 0x27, 0x24, 0x43, 0x34,
+	0x03, 0x27, 0x24, 0x25, 0x0A, 0x18, 0x24, 0x0F, 0x02, 0x3C, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x00, 0x2E, 0x0F, 0x01, 0x28, 0x24, 0x55, 0x06, 0x28, 0x24, 0x74, 0x05, 0x28, 0x24, 0x24, 0x33, 0x04,
+	0x28, 0x24, 0x2A, 0x04, 0x28, 0x24, 0x3A, 0x03, 0x28, 0x24, 0x2B, 0x03, 0x00, 0x00, 0x15, 0x22, 0x24, 0x2B, 0x03, 0x64, 0x24, 0x2B, 0x03, 0x94, 0x21, 0x24, 0x25, 0x03, 0x88, 0x24, 0x25, 0x03,
+	0x28, 0x52, 0x23, 0x25, 0x03, 0x37, 0x54, 0x21, 0x25, 0x03, 0x27, 0x34, 0x61, 0x24, 0x03, 0x27, 0x24, 0x44, 0x23, 0x04, 0x15, 0x21, 0x24, 0x25, 0x0A, 0x34, 0x26, 0x0F, 0x02, 0x36, 0x33, 0x0F,
+	0x02, 0x13, 0x13, 0x0F, 0x09, 0x33, 0x0F, 0x0B, 0x44, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x4F, 0x0D, 0x6E, 0x0C, 0x3D, 0x32, 0x0B, 0x3C,
+	0x34, 0x0A, 0x2C, 0x36, 0x09, 0x3B, 0x37, 0x08, 0x3A, 0x48, 0x07, 0x39, 0x3A, 0x07, 0x38, 0x3C, 0x06, 0x37, 0x3E, 0x05, 0x36, 0x0F, 0x31, 0x04, 0x45, 0x0F, 0x32, 0x03, 0x26, 0x0F, 0x43, 0x02,
+	0x16, 0x0F, 0x25, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x4F, 0x0D, 0x6E, 0x0C, 0x3D, 0x32, 0x0B, 0x3C, 0x34, 0x0A, 0x2C, 0x36, 0x09, 0x3B, 0x37, 0x08, 0x3A, 0x48, 0x07,
+	0x39, 0x3A, 0x07, 0x38, 0x3C, 0x06, 0x37, 0x3E, 0x05, 0x36, 0x0F, 0x31, 0x04, 0x45, 0x23, 0x3C, 0x03, 0x26, 0x44, 0x4A, 0x02, 0x16, 0x37, 0x2A, 0x03, 0x1B, 0x13, 0x0F, 0x01, 0x4A, 0x0F, 0x03,
+	0x3C, 0x0F, 0x02, 0x1E, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xCC, 0x08, 0xF6, 0x70, 0x04, 0x66, 0x5B, 0x04, 0x16, 0x5D, 0x07, 0x0F, 0x34, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2C, 0x0F,
+	0x03, 0x00, 0x2C, 0x1E, 0x03, 0x2C, 0x2D, 0x03, 0x2C, 0x3D, 0x02, 0x2C, 0x3C, 0x03, 0x2C, 0x4A, 0x04, 0x2C, 0x58, 0x05, 0xF6, 0x40, 0x07, 0xF6, 0x10, 0x0A, 0x2C, 0x0F, 0x03, 0x00, 0x00, 0x00,
+	0x3B, 0x0F, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0xCC, 0x08, 0xF6, 0x70, 0x04, 0x66, 0x5B, 0x04, 0x16, 0x5D, 0x07, 0x0F, 0x34, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x00, 0x2C, 0x1E,
+	0x03, 0x2C, 0x2D, 0x03, 0x2C, 0x4C, 0x02, 0x2C, 0x4B, 0x03, 0x2C, 0x4A, 0x04, 0x2C, 0x58, 0x05, 0xF6, 0x40, 0x07, 0xF6, 0x10, 0x0A, 0x2C, 0x0F, 0x03, 0x25, 0x25, 0x0F, 0x03, 0x45, 0x23, 0x0F,
+	0x03, 0x27, 0x23, 0x0F, 0x03, 0x24, 0x35, 0x0F, 0x03, 0x45, 0x0F, 0x08, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x74, 0x06, 0x0F, 0x84, 0x05, 0x28, 0x19, 0x35, 0x04, 0x28,
+	0x0F, 0x21, 0x04, 0x00, 0x28, 0x0F, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0F, 0x31, 0x03, 0x0F, 0x2B, 0x04, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00,
+	0x0F, 0x74, 0x06, 0x0F, 0x84, 0x05, 0x28, 0x19, 0x35, 0x04, 0x28, 0x0F, 0x21, 0x04, 0x00, 0x28, 0x0F, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x22, 0x0F,
+	0x31, 0x03, 0x34, 0x0F, 0x24, 0x04, 0x36, 0x0F, 0x22, 0x04, 0x13, 0x23, 0x0F, 0x08, 0x33, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2A, 0x0F, 0x05,
+	0x2A, 0x58, 0x07, 0x2A, 0x96, 0x05, 0x2A, 0x17, 0x35, 0x04, 0x2A, 0x2E, 0x04, 0x00, 0x2A, 0x2F, 0x03, 0x00, 0x00, 0x00, 0x25, 0x23, 0x2F, 0x03, 0x75, 0x26, 0x27, 0x03, 0x76, 0x25, 0x27, 0x03,
+	0x69, 0x23, 0x27, 0x03, 0x89, 0x21, 0x27, 0x03, 0x39, 0x62, 0x27, 0x03, 0x29, 0x55, 0x35, 0x03, 0x29, 0x46, 0x0B, 0x29, 0x18, 0x0C, 0x38, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2A, 0x0F,
+	0x05, 0x2A, 0x58, 0x07, 0x2A, 0x96, 0x05, 0x2A, 0x36, 0x34, 0x04, 0x2A, 0x2E, 0x04, 0x00, 0x2A, 0x2F, 0x03, 0x00, 0x00, 0x00, 0x25, 0x23, 0x2F, 0x03, 0x75, 0x26, 0x27, 0x03, 0x76, 0x25, 0x27,
+	0x03, 0x69, 0x23, 0x27, 0x03, 0x89, 0x21, 0x27, 0x03, 0x39, 0x62, 0x27, 0x03, 0x14, 0x24, 0x55, 0x35, 0x03, 0x24, 0x23, 0x46, 0x0B, 0x35, 0x21, 0x18, 0x0C, 0x56, 0x0F, 0x06, 0x23, 0x0F, 0x0C,
+	0x33, 0x0F, 0x0B, 0x25, 0x0F, 0x0A, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x60, 0x06, 0xF5, 0x70, 0x05, 0x25, 0x0F, 0x33, 0x04, 0x0F, 0x3B, 0x03, 0x0F, 0x2C,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x2B, 0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x2A, 0x05, 0x0F, 0x39, 0x05, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x36, 0x08, 0x0F, 0x17,
+	0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x60, 0x06, 0xF5, 0x70, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x3B, 0x03, 0x0F, 0x2C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0F, 0x23, 0x03,
+	0x38, 0x3F, 0x03, 0x49, 0x2D, 0x04, 0x2B, 0x3C, 0x04, 0x17, 0x0F, 0x22, 0x05, 0x46, 0x3E, 0x05, 0x48, 0x3B, 0x06, 0x29, 0x3B, 0x07, 0x0F, 0x36, 0x08, 0x0F, 0x17, 0x09, 0x0F, 0x0F, 0x02, 0x00,
+	0x29, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0x17, 0x04, 0x29, 0x83, 0x25, 0x03, 0x29, 0x23, 0x24, 0x34, 0x03, 0x29, 0x22, 0x35, 0x33, 0x03, 0x29, 0x22, 0x26, 0x32, 0x04, 0x29,
+	0x22, 0x26, 0x31, 0x05, 0x29, 0x22, 0x66, 0x05, 0xB5, 0x64, 0x06, 0xF5, 0x40, 0x08, 0x29, 0x65, 0x0A, 0x29, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x39, 0x0F,
+	0x05, 0x00, 0x29, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x29, 0x46, 0x17, 0x03, 0x29, 0x84, 0x25, 0x02, 0x29, 0x24, 0x24, 0x34, 0x02, 0x29, 0x23, 0x35, 0x33, 0x02, 0x29, 0x23, 0x26, 0x32, 0x03, 0x29,
+	0x23, 0x26, 0x22, 0x04, 0x29, 0x23, 0x66, 0x04, 0xC5, 0x64, 0x05, 0xF5, 0x60, 0x06, 0x29, 0x66, 0x09, 0x29, 0x0F, 0x06, 0x00, 0x25, 0x22, 0x0F, 0x06, 0x65, 0x0F, 0x06, 0x47, 0x0F, 0x06, 0x24,
+	0x23, 0x0F, 0x06, 0x34, 0x22, 0x0F, 0x06, 0x35, 0x21, 0x0F, 0x06, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x2E, 0x0F, 0x01, 0x00, 0x3D, 0x0F, 0x01, 0x2D, 0x0F, 0x02, 0x00, 0x00, 0xF7, 0x40, 0x06,
+	0xF7, 0x50, 0x05, 0x2D, 0x2A, 0x05, 0x2D, 0x2B, 0x04, 0x00, 0x00, 0x1D, 0x2C, 0x04, 0x2C, 0x26, 0x24, 0x04, 0x00, 0x00, 0x00, 0xF6, 0x10, 0x24, 0x04, 0xF6, 0x25, 0x04, 0x2C, 0x2C, 0x04, 0x2C,
+	0x3B, 0x04, 0x2C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x2E, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0xF7, 0x60, 0x04, 0x2D, 0x2B, 0x04, 0x2D, 0x3B, 0x03, 0x2D, 0x2C, 0x03, 0x00,
+	0x00, 0x2C, 0x26, 0x25, 0x03, 0x00, 0x00, 0x00, 0x2C, 0x35, 0x25, 0x03, 0xF6, 0x10, 0x25, 0x03, 0xF6, 0x26, 0x03, 0x2C, 0x2D, 0x03, 0x16, 0x25, 0x3C, 0x03, 0x36, 0x23, 0x0F, 0x03, 0x28, 0x22,
+	0x0F, 0x03, 0x15, 0x26, 0x0F, 0x03, 0x35, 0x24, 0x0F, 0x03, 0x27, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x22, 0x0D, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x36, 0x27, 0x0E, 0x00, 0x26, 0x37, 0x0E,
+	0x26, 0x46, 0x43, 0x07, 0x26, 0x55, 0x81, 0x05, 0x26, 0x34, 0x51, 0x34, 0x04, 0x26, 0x33, 0x32, 0x27, 0x04, 0x26, 0x32, 0x23, 0x28, 0x04, 0x26, 0x31, 0x33, 0x29, 0x03, 0x26, 0x21, 0x24, 0x2A,
+	0x03, 0x46, 0x25, 0x2A, 0x03, 0x00, 0x45, 0x26, 0x2A, 0x03, 0x26, 0x27, 0x2A, 0x03, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x0F, 0x22, 0x0D, 0x00, 0x0F, 0x31, 0x0D, 0x0F, 0x21, 0x0E,
+	0x36, 0x27, 0x0E, 0x00, 0x26, 0x37, 0x0E, 0x26, 0x46, 0x43, 0x07, 0x26, 0x55, 0x81, 0x05, 0x26, 0x34, 0x51, 0x34, 0x04, 0x26, 0x33, 0x32, 0x27, 0x04, 0x26, 0x32, 0x33, 0x27, 0x04, 0x26, 0x31,
+	0x33, 0x29, 0x03, 0x26, 0x21, 0x24, 0x2A, 0x03, 0x46, 0x25, 0x2A, 0x03, 0x00, 0x45, 0x26, 0x2A, 0x03, 0x26, 0x12, 0x24, 0x2A, 0x03, 0x49, 0x22, 0x0F, 0x3B, 0x21, 0x0F, 0x19, 0x13, 0x21, 0x0F,
+	0x38, 0x24, 0x0F, 0x3A, 0x0F, 0x04, 0x1B, 0x0F, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x2A, 0x0F, 0x05, 0x2A, 0x2E, 0x04, 0x2A, 0x4C, 0x04, 0x2A, 0x6A, 0x04, 0x2A, 0x77, 0x06, 0x2A, 0x74, 0x09, 0xAA,
+	0x0C, 0xC5, 0x0F, 0x85, 0x0F, 0x04, 0x45, 0x21, 0x0F, 0x05, 0x29, 0x0F, 0x06, 0x29, 0x5A, 0x06, 0x29, 0x6A, 0x05, 0x29, 0x23, 0x29, 0x05, 0x29, 0x23, 0x39, 0x04, 0x2E, 0x2A, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x2A, 0x05, 0x0F, 0x0F, 0x02, 0x2B, 0x0F, 0x04, 0x2B, 0x2E, 0x03, 0x2B, 0x4C, 0x03, 0x2B, 0x6A, 0x03, 0x2B, 0x77, 0x05, 0x2B, 0x83, 0x08, 0xAB, 0x0B, 0xB6,
+	0x0F, 0x86, 0x0F, 0x03, 0x46, 0x21, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x2A, 0x69, 0x05, 0x2A, 0x79, 0x04, 0x2A, 0x22, 0x2A, 0x04, 0x2A, 0x22, 0x3A, 0x03, 0x2E, 0x2B, 0x03, 0x00, 0x00, 0x00, 0x27,
+	0x25, 0x2B, 0x03, 0x47, 0x23, 0x2B, 0x03, 0x39, 0x22, 0x2B, 0x03, 0x16, 0x13, 0x23, 0x2B, 0x03, 0x36, 0x0F, 0x22, 0x04, 0x47, 0x0F, 0x06, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x0F,
+	0x06, 0x00, 0x29, 0x1A, 0x0A, 0x29, 0x38, 0x0A, 0x29, 0x84, 0x09, 0xC9, 0x0B, 0xC5, 0x21, 0x27, 0x03, 0x75, 0x26, 0x27, 0x03, 0x25, 0x22, 0x26, 0x28, 0x03, 0x29, 0x26, 0x28, 0x03, 0x29, 0x25,
+	0x29, 0x03, 0x00, 0x00, 0x00, 0x28, 0x26, 0x38, 0x03, 0x28, 0x26, 0x28, 0x04, 0x28, 0x36, 0x27, 0x04, 0x28, 0x27, 0x36, 0x04, 0x28, 0x37, 0x34, 0x05, 0x0F, 0x83, 0x06, 0x0F, 0x54, 0x08, 0x0F,
+	0x0F, 0x02, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x2A, 0x19, 0x0A, 0x2A, 0x37, 0x0A, 0x2A, 0x74, 0x09, 0xBA, 0x0B, 0xB6, 0x21, 0x27, 0x03, 0x76, 0x25, 0x27, 0x03, 0x26, 0x22, 0x25, 0x28, 0x03, 0x2A,
+	0x25, 0x28, 0x03, 0x2A, 0x24, 0x29, 0x03, 0x00, 0x00, 0x00, 0x29, 0x25, 0x38, 0x03, 0x29, 0x25, 0x28, 0x04, 0x29, 0x35, 0x27, 0x04, 0x29, 0x26, 0x36, 0x04, 0x15, 0x23, 0x36, 0x34, 0x05, 0x25,
+	0x8B, 0x06, 0x46, 0x59, 0x08, 0x14, 0x13, 0x0F, 0x08, 0x24, 0x0F, 0x0B, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x11, 0x0F, 0x0F, 0x31, 0x0D, 0x3F, 0x0E,
+	0x00, 0x2F, 0x0F, 0x00, 0x3E, 0x1A, 0x04, 0x2E, 0x2B, 0x03, 0x00, 0x00, 0x2D, 0x2C, 0x03, 0x2D, 0x2B, 0x04, 0x00, 0x00, 0x2D, 0x2A, 0x05, 0x3D, 0x38, 0x05, 0x2E, 0x37, 0x06, 0x4E, 0x44, 0x06,
+	0xAF, 0x07, 0x0F, 0x62, 0x09, 0x0F, 0x0F, 0x02, 0x1C, 0x0F, 0x04, 0x3C, 0x0F, 0x02, 0x00, 0x2C, 0x0F, 0x03, 0x3B, 0x0F, 0x03, 0x00, 0x2B, 0x0F, 0x04, 0x3A, 0x0F, 0x04, 0x2A, 0x2D, 0x05, 0x00,
+	0x00, 0x00, 0x29, 0x2D, 0x06, 0x00, 0x00, 0x00, 0x29, 0x3C, 0x06, 0x29, 0x2C, 0x07, 0x29, 0x3B, 0x07, 0x2A, 0x2A, 0x08, 0x3A, 0x38, 0x08, 0x3B, 0x45, 0x09, 0xAC, 0x0A, 0x5E, 0x0D, 0x0F, 0x0F,
+	0x02, 0x1D, 0x0F, 0x03, 0x3D, 0x0F, 0x01, 0x00, 0x2D, 0x0F, 0x02, 0x3C, 0x0F, 0x02, 0x00, 0x2C, 0x0F, 0x03, 0x00, 0x2B, 0x2D, 0x04, 0x00, 0x00, 0x00, 0x2A, 0x2D, 0x05, 0x00, 0x00, 0x00, 0x2A,
+	0x3C, 0x05, 0x2A, 0x2C, 0x06, 0x2A, 0x3B, 0x06, 0x16, 0x24, 0x2A, 0x07, 0x36, 0x32, 0x38, 0x07, 0x37, 0x32, 0x45, 0x08, 0x15, 0x13, 0xA3, 0x09, 0x44, 0x57, 0x0C, 0x36, 0x0F, 0x08, 0x18, 0x0F,
+	0x08, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x0F, 0x06, 0x00, 0x38, 0x0F, 0x06, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x28, 0x76, 0x09, 0x28, 0xB3, 0x08, 0x28, 0x42, 0x46, 0x06, 0x28, 0x31, 0x49,
+	0x05, 0x18, 0x31, 0x3B, 0x05, 0x38, 0x3E, 0x04, 0x47, 0x2F, 0x04, 0x37, 0x0F, 0x21, 0x04, 0x37, 0x0F, 0x22, 0x03, 0x27, 0x0F, 0x23, 0x03, 0x00, 0x27, 0x0F, 0x13, 0x04, 0x27, 0x0F, 0x08, 0x00,
+	0x0F, 0x0F, 0x02, 0x00, 0x29, 0x0F, 0x06, 0x00, 0x38, 0x0F, 0x06, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x28, 0x76, 0x09, 0x28, 0xB3, 0x08, 0x28, 0x42, 0x46, 0x06, 0x28, 0x31, 0x49, 0x05,
+	0x18, 0x31, 0x3B, 0x05, 0x38, 0x3E, 0x04, 0x47, 0x2F, 0x04, 0x37, 0x0F, 0x21, 0x04, 0x37, 0x0F, 0x22, 0x03, 0x27, 0x24, 0x2C, 0x03, 0x27, 0x44, 0x2A, 0x03, 0x27, 0x36, 0x19, 0x04, 0x27, 0x13,
+	0x13, 0x0F, 0x27, 0x42, 0x0F, 0x02, 0x3D, 0x0F, 0x01, 0x1F, 0x0F, 0x01, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x46, 0x07, 0x27, 0x8A, 0x05, 0x66, 0x36, 0x34, 0x04, 0x68, 0x33, 0x26,
+	0x04, 0x9A, 0x27, 0x04, 0x6C, 0x29, 0x03, 0x3E, 0x2A, 0x03, 0x00, 0x3D, 0x2B, 0x03, 0x2D, 0x2C, 0x03, 0x3C, 0x2C, 0x03, 0x2C, 0x2D, 0x03, 0x3B, 0x2D, 0x03, 0x2B, 0x2E, 0x03, 0x3A, 0x2E, 0x03,
+	0x39, 0x2F, 0x03, 0x2A, 0x3E, 0x03, 0x0F, 0x2B, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x46, 0x07, 0x36, 0x8A, 0x05, 0x66, 0x36, 0x34, 0x04, 0x68, 0x33, 0x26, 0x04, 0x9A, 0x27, 0x04,
+	0x6C, 0x29, 0x03, 0x3E, 0x2A, 0x03, 0x00, 0x3D, 0x2B, 0x03, 0x2D, 0x2C, 0x03, 0x3C, 0x2C, 0x03, 0x2C, 0x2D, 0x03, 0x3B, 0x2D, 0x03, 0x2B, 0x2E, 0x03, 0x3A, 0x2E, 0x03, 0x16, 0x32, 0x2F, 0x03,
+	0x26, 0x13, 0x3E, 0x03, 0x46, 0x0F, 0x21, 0x04, 0x28, 0x0F, 0x07, 0x15, 0x0F, 0x0B, 0x44, 0x0F, 0x09, 0x36, 0x0F, 0x08, 0x18, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x19, 0x1C, 0x09, 0x2A, 0x29, 0x09,
+	0x2A, 0x48, 0x08, 0x2A, 0x56, 0x09, 0x2A, 0x54, 0x0B, 0x2A, 0x52, 0x0D, 0x7A, 0x0F, 0x78, 0x48, 0x05, 0x75, 0x6A, 0x04, 0x75, 0x2A, 0x22, 0x04, 0x15, 0x23, 0x2A, 0x24, 0x03, 0x29, 0x2A, 0x24,
+	0x03, 0x00, 0x00, 0x18, 0x2C, 0x24, 0x03, 0x0F, 0x26, 0x33, 0x03, 0xEE, 0x04, 0x1A, 0xD3, 0x05, 0x29, 0x2B, 0x08, 0x2A, 0x2B, 0x07, 0x3A, 0x2A, 0x07, 0x2B, 0x2B, 0x06, 0x3B, 0x3A, 0x05, 0x3C,
+	0x1A, 0x06, 0x2C, 0x0F, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xED, 0x05, 0xF6, 0x80, 0x03, 0x86, 0x69, 0x03, 0x26, 0x1B, 0x41, 0x07, 0x0F, 0x25, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x65,
+	0x06, 0x29, 0x6A, 0x05, 0x29, 0x2E, 0x05, 0x29, 0x3E, 0x04, 0x29, 0x2F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3E, 0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x0F, 0x02, 0x0F, 0x65, 0x06,
+	0x0F, 0x93, 0x05, 0x38, 0x55, 0x34, 0x04, 0xA8, 0x28, 0x04, 0x7A, 0x29, 0x04, 0x6D, 0x36, 0x04, 0x2C, 0x61, 0x24, 0x05, 0x3B, 0x44, 0x22, 0x06, 0x2B, 0x76, 0x06, 0x2A, 0x49, 0x07, 0x2A, 0x56,
+	0x09, 0x2A, 0x64, 0x0A, 0x29, 0x71, 0x34, 0x06, 0xB5, 0x56, 0x05, 0x65, 0x2B, 0x31, 0x04, 0x29, 0x2A, 0x23, 0x04, 0x00, 0x00, 0x2A, 0x29, 0x23, 0x04, 0x3A, 0x28, 0x22, 0x05, 0x3B, 0x58, 0x05,
+	0x3C, 0x47, 0x06, 0xCD, 0x07, 0xBF, 0x06, 0x0F, 0x39, 0x05, 0x0F, 0x2A, 0x05, 0x0F, 0x18, 0x08, 0x0F, 0x37, 0x07, 0x3A, 0x48, 0x07, 0x2A, 0x47, 0x09, 0x2A, 0x46, 0x0A, 0x2A, 0x45, 0x0B, 0x2A,
+	0x43, 0x0D, 0xFA, 0x40, 0x03, 0xF5, 0x90, 0x03, 0x75, 0x31, 0x0F, 0x01, 0x15, 0x14, 0x22, 0x0F, 0x02, 0x2C, 0x0F, 0x03, 0x3B, 0x0F, 0x03, 0x2B, 0x49, 0x06, 0x2A, 0x69, 0x05, 0x2A, 0x29, 0x32,
+	0x04, 0x29, 0x29, 0x24, 0x04, 0x00, 0x00, 0x00, 0x2A, 0x38, 0x31, 0x05, 0x4A, 0x67, 0x05, 0xEB, 0x07, 0xBE, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x39, 0x05, 0x0F, 0x19, 0x07, 0x0F, 0x0F, 0x02, 0x00,
+	0x0F, 0x61, 0x0A, 0xBD, 0x08, 0x4C, 0x36, 0x07, 0x3B, 0x39, 0x06, 0x2A, 0x2C, 0x06, 0x39, 0x2C, 0x06, 0x29, 0x3C, 0x06, 0x28, 0x3C, 0x07, 0x28, 0x59, 0x08, 0x37, 0x76, 0x09, 0x27, 0xA2, 0x0B,
+	0xB7, 0x18, 0x05, 0x67, 0x2D, 0x04, 0x27, 0x0F, 0x22, 0x04, 0x27, 0x0F, 0x31, 0x04, 0x37, 0x2F, 0x05, 0x28, 0x2F, 0x05, 0x38, 0x3D, 0x05, 0x29, 0x3C, 0x06, 0x3A, 0x39, 0x07, 0x4B, 0x55, 0x07,
+	0xBC, 0x09, 0x6F, 0x0B, 0x0F, 0x0F, 0x02, 0x00, 0xDD, 0x06, 0xF6, 0x80, 0x03, 0x86, 0x69, 0x03, 0x26, 0x6C, 0x06, 0x0F, 0x44, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x48, 0x05, 0x2B, 0x78,
+	0x04, 0x2B, 0x28, 0x23, 0x04, 0x2B, 0x37, 0x24, 0x03, 0x2B, 0x27, 0x25, 0x03, 0x00, 0x00, 0x00, 0xF6, 0x10, 0x34, 0x03, 0xF6, 0x70, 0x04, 0x2B, 0x86, 0x05, 0x2B, 0x38, 0x08, 0x2B, 0x39, 0x07,
+	0x2B, 0x2A, 0x07, 0x3A, 0x3A, 0x06, 0x0F, 0x39, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xDD, 0x06, 0xF6, 0x80, 0x03, 0x76, 0x5B, 0x03, 0x16, 0x4E, 0x07, 0x0F, 0x25, 0x0A, 0x0F, 0x0F,
+	0x02, 0x00, 0x0F, 0x39, 0x05, 0x2B, 0x69, 0x04, 0x2B, 0x29, 0x22, 0x04, 0x2B, 0x28, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x28, 0x33, 0x03, 0xF6, 0x70, 0x04, 0xF6, 0x60, 0x05, 0x2B, 0x39,
+	0x07, 0x15, 0x25, 0x2A, 0x07, 0x35, 0x23, 0x3A, 0x06, 0x36, 0x22, 0x3B, 0x05, 0x14, 0x35, 0x2C, 0x05, 0x34, 0x0F, 0x13, 0x06, 0x26, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0xDD, 0x06, 0xF6, 0x80,
+	0x03, 0x76, 0x5B, 0x03, 0x26, 0x4D, 0x07, 0x0F, 0x25, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x39, 0x05, 0x2B, 0x69, 0x04, 0x2B, 0x29, 0x22, 0x04, 0x2B, 0x28, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x2B, 0x28, 0x33, 0x03, 0xF6, 0x70, 0x04, 0xF6, 0x60, 0x05, 0x2B, 0x39, 0x07, 0x26, 0x23, 0x2A, 0x07, 0x24, 0x12, 0x22, 0x2B, 0x06, 0x14, 0x14, 0x21, 0x3B, 0x05, 0x14, 0x14, 0x11, 0x2D, 0x05,
+	0x24, 0x12, 0x0F, 0x11, 0x06, 0x26, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x28, 0x0F, 0x07, 0x28, 0x78, 0x07, 0x28, 0xB5, 0x06, 0x28, 0x53, 0x46, 0x04, 0x18, 0x42, 0x2B, 0x04, 0x18, 0x31,
+	0x3D, 0x03, 0x57, 0x2F, 0x03, 0x37, 0x0F, 0x22, 0x03, 0x27, 0x0F, 0x23, 0x03, 0x00, 0x18, 0x0F, 0x23, 0x03, 0x0F, 0x3B, 0x03, 0x0F, 0x2B, 0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x48, 0x05, 0x37, 0x6A,
+	0x06, 0xF7, 0x20, 0x08, 0x16, 0xD1, 0x0B, 0x5B, 0x0F, 0x01, 0x5D, 0x0E, 0x4F, 0x0D, 0x0F, 0x51, 0x0B, 0x0F, 0x23, 0x0C, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x0F, 0x06, 0x29, 0x78, 0x06, 0x29, 0xB5,
+	0x05, 0x29, 0x53, 0x36, 0x04, 0x19, 0x42, 0x3A, 0x03, 0x19, 0x31, 0x3D, 0x02, 0x58, 0x2F, 0x02, 0x48, 0x0F, 0x21, 0x02, 0x38, 0x0F, 0x22, 0x02, 0x28, 0x0F, 0x23, 0x02, 0x00, 0x0F, 0x2D, 0x02,
+	0x0F, 0x2C, 0x03, 0x0F, 0x3B, 0x03, 0x0F, 0x3A, 0x04, 0x0F, 0x49, 0x04, 0x38, 0x6A, 0x05, 0xF8, 0x20, 0x07, 0x17, 0xD1, 0x0A, 0x16, 0x55, 0x0F, 0x36, 0x55, 0x0D, 0x37, 0x46, 0x0C, 0x15, 0x13,
+	0x57, 0x0A, 0x35, 0x2B, 0x0B, 0x36, 0x0F, 0x08, 0x18, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x0F, 0x06, 0x29, 0x78, 0x06, 0x29, 0xB5, 0x05, 0x29, 0x53, 0x36, 0x04, 0x19, 0x42, 0x3A, 0x03,
+	0x28, 0x31, 0x3D, 0x02, 0x58, 0x2F, 0x02, 0x48, 0x0F, 0x21, 0x02, 0x38, 0x0F, 0x22, 0x02, 0x37, 0x0F, 0x23, 0x02, 0x28, 0x0F, 0x23, 0x02, 0x0F, 0x2D, 0x02, 0x0F, 0x2C, 0x03, 0x0F, 0x3B, 0x03,
+	0x0F, 0x3A, 0x04, 0x0F, 0x49, 0x04, 0x37, 0x6B, 0x05, 0xF7, 0x30, 0x07, 0xE8, 0x0A, 0x45, 0x53, 0x0F, 0x24, 0x22, 0x54, 0x0D, 0x14, 0x14, 0x46, 0x0C, 0x14, 0x14, 0x48, 0x0A, 0x24, 0x22, 0x19,
+	0x0C, 0x45, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x27, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x26, 0x13, 0x05, 0x0F, 0x2C,
+	0x03, 0x17, 0x18, 0x2A, 0x03, 0x26, 0x37, 0x29, 0x03, 0x27, 0x46, 0x28, 0x03, 0x27, 0x47, 0x27, 0x03, 0x28, 0x12, 0x35, 0x26, 0x03, 0x68, 0x45, 0x33, 0x03, 0x49, 0x87, 0x04, 0x39, 0x5A, 0x05,
+	0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x13, 0x0D, 0x0F, 0x42, 0x0B, 0x0F, 0x43, 0x0A, 0x0F, 0x55, 0x07, 0x0F, 0x66, 0x05, 0x0F, 0x48, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x00,
+	0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x36, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x26, 0x13, 0x05, 0x0F, 0x2C, 0x03, 0x17, 0x18, 0x2A, 0x03, 0x26, 0x27, 0x2A, 0x03, 0x27, 0x46, 0x28, 0x03, 0x27,
+	0x47, 0x27, 0x03, 0x28, 0x12, 0x35, 0x26, 0x03, 0x68, 0x45, 0x33, 0x03, 0x49, 0x87, 0x04, 0x39, 0x5A, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x19, 0x18, 0x0D, 0x39, 0x45, 0x0B, 0x4A, 0x44, 0x0A, 0x18,
+	0x13, 0x57, 0x07, 0x28, 0x6B, 0x05, 0x48, 0x4B, 0x05, 0x2A, 0x1D, 0x06, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x27, 0x08, 0x0F, 0x35, 0x09, 0x0F,
+	0x26, 0x13, 0x05, 0x0F, 0x2C, 0x03, 0x26, 0x18, 0x2A, 0x03, 0x26, 0x37, 0x29, 0x03, 0x36, 0x46, 0x28, 0x03, 0x27, 0x38, 0x27, 0x03, 0x37, 0x12, 0x35, 0x26, 0x03, 0x68, 0x45, 0x33, 0x03, 0x58,
+	0x87, 0x04, 0x39, 0x5A, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x13, 0x0D, 0x49, 0x34, 0x0C, 0x27, 0x23, 0x44, 0x0A, 0x17, 0x15, 0x55, 0x08, 0x17, 0x15, 0x57, 0x06, 0x17, 0x15, 0x58, 0x05, 0x18,
+	0x23, 0x3A, 0x05, 0x49, 0x1D, 0x05, 0x0F, 0x0F, 0x02, 0x0F, 0x14, 0x0C, 0x0F, 0x33, 0x0B, 0x0F, 0x52, 0x0A, 0x0F, 0x41, 0x0C, 0x4F, 0x0D, 0x4E, 0x0E, 0x3D, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0x3B,
+	0x0F, 0x03, 0x3A, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x3A, 0x0F, 0x04, 0x3B, 0x0F, 0x03, 0x3C, 0x0F, 0x02, 0x4C, 0x0F, 0x01, 0x3E, 0x0F, 0x3F, 0x0E, 0x0F, 0x41, 0x0C, 0x0F, 0x42, 0x0B, 0x0F, 0x43,
+	0x0A, 0x0F, 0x44, 0x09, 0x0F, 0x45, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x47, 0x06, 0x0F, 0x48, 0x05, 0x0F, 0x19, 0x07, 0x0F, 0x14, 0x0C, 0x0F, 0x33, 0x0B, 0x0F, 0x52, 0x0A, 0x0F, 0x41, 0x0C, 0x4F,
+	0x0D, 0x4E, 0x0E, 0x3D, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x3A, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x3A, 0x0F, 0x04, 0x3B, 0x0F, 0x03, 0x3C, 0x0F, 0x02, 0x3D, 0x0F, 0x01, 0x3E, 0x0F,
+	0x3F, 0x0E, 0x19, 0x46, 0x0C, 0x38, 0x46, 0x0B, 0x49, 0x45, 0x0A, 0x2B, 0x46, 0x09, 0x17, 0x4C, 0x08, 0x37, 0x4B, 0x07, 0x48, 0x4A, 0x06, 0x1A, 0x4C, 0x05, 0x0F, 0x19, 0x07, 0x0F, 0x14, 0x0C,
+	0x0F, 0x24, 0x0B, 0x0F, 0x43, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x4D, 0x0F, 0x4C, 0x0F, 0x01, 0x3B, 0x0F, 0x03, 0x3A, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x3A, 0x0F, 0x04,
+	0x3B, 0x0F, 0x03, 0x4C, 0x0F, 0x01, 0x4D, 0x0F, 0x4E, 0x0E, 0x0F, 0x31, 0x0D, 0x39, 0x35, 0x0C, 0x18, 0x13, 0x35, 0x0B, 0x17, 0x15, 0x45, 0x09, 0x17, 0x15, 0x46, 0x08, 0x17, 0x15, 0x47, 0x07,
+	0x18, 0x13, 0x49, 0x06, 0x39, 0x4B, 0x05, 0x0F, 0x29, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xED, 0x05, 0xF5, 0x90, 0x03, 0x86, 0x5A, 0x03, 0x26, 0x5D, 0x06, 0x0F, 0x44, 0x09, 0x0F, 0x0F, 0x02, 0x00,
+	0x00, 0x0F, 0x48, 0x05, 0x27, 0x25, 0x66, 0x04, 0x27, 0x25, 0x26, 0x22, 0x04, 0x27, 0x25, 0x25, 0x24, 0x03, 0x00, 0x00, 0x00, 0x27, 0x25, 0x25, 0x33, 0x03, 0xF7, 0x60, 0x04, 0xF7, 0x50, 0x05,
+	0x27, 0x25, 0x26, 0x08, 0x27, 0x25, 0x36, 0x07, 0x17, 0x26, 0x37, 0x06, 0x00, 0x26, 0x26, 0x38, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xED, 0x05, 0xF6, 0x80, 0x03, 0x67, 0x6A, 0x03,
+	0x17, 0x6B, 0x07, 0x0F, 0x25, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x48, 0x05, 0x28, 0x24, 0x66, 0x04, 0x28, 0x24, 0x26, 0x22, 0x04, 0x28, 0x24, 0x25, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8,
+	0x33, 0x03, 0xF8, 0x50, 0x04, 0x28, 0x24, 0x56, 0x05, 0x28, 0x24, 0x26, 0x08, 0x16, 0x21, 0x24, 0x27, 0x07, 0x55, 0x24, 0x37, 0x06, 0x37, 0x24, 0x28, 0x06, 0x15, 0x0F, 0x24, 0x05, 0x44, 0x0F,
+	0x12, 0x06, 0x27, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0xED, 0x05, 0xF6, 0x80, 0x03, 0x76, 0x6A, 0x03, 0x16, 0x6C, 0x07, 0x0F, 0x25, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x48, 0x05, 0x28, 0x24,
+	0x66, 0x04, 0x28, 0x24, 0x26, 0x22, 0x04, 0x28, 0x24, 0x25, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x33, 0x03, 0xF8, 0x50, 0x04, 0x28, 0x24, 0x56, 0x05, 0x28, 0x24, 0x26, 0x08, 0x28, 0x24,
+	0x27, 0x07, 0x55, 0x24, 0x37, 0x06, 0x23, 0x22, 0x25, 0x38, 0x05, 0x13, 0x14, 0x25, 0x29, 0x05, 0x13, 0x14, 0x0F, 0x11, 0x06, 0x14, 0x12, 0x0F, 0x09, 0x44, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00,
+	0x00, 0x00, 0x38, 0x33, 0x46, 0x05, 0x29, 0x24, 0x65, 0x04, 0x29, 0x24, 0x25, 0x22, 0x04, 0x29, 0x24, 0x24, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x30, 0x23, 0x04, 0xF5, 0x80, 0x04,
+	0x29, 0x24, 0x55, 0x05, 0x29, 0x24, 0x25, 0x08, 0x29, 0x24, 0x16, 0x08, 0x29, 0x24, 0x26, 0x07, 0x00, 0x38, 0x33, 0x27, 0x06, 0x28, 0x24, 0x38, 0x05, 0x28, 0x24, 0x39, 0x04, 0x0F, 0x2A, 0x05,
+	0x0F, 0x0F, 0x02, 0x0F, 0x46, 0x07, 0x0F, 0x74, 0x06, 0x0F, 0x33, 0x33, 0x05, 0x0F, 0x32, 0x25, 0x05, 0x27, 0x28, 0x26, 0x05, 0x27, 0x27, 0x36, 0x05, 0x27, 0x27, 0x44, 0x06, 0x27, 0x27, 0x52,
+	0x07, 0x27, 0x77, 0x09, 0x27, 0x66, 0x0B, 0x27, 0x64, 0x0D, 0x27, 0x72, 0x0E, 0x77, 0x22, 0x1A, 0x03, 0x57, 0x24, 0x39, 0x02, 0x46, 0x26, 0x29, 0x03, 0x17, 0x38, 0x37, 0x03, 0x0F, 0x22, 0x36,
+	0x04, 0x0F, 0x22, 0x35, 0x05, 0x0F, 0x32, 0x42, 0x06, 0x0F, 0x73, 0x07, 0xAD, 0x09, 0x9D, 0x0A, 0x0F, 0x35, 0x09, 0x0F, 0x45, 0x08, 0x0F, 0x16, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x56, 0x0A,
+	0x29, 0x75, 0x09, 0x29, 0x34, 0x33, 0x08, 0x29, 0x23, 0x26, 0x08, 0x00, 0x29, 0x33, 0x64, 0x05, 0xF5, 0x80, 0x04, 0xF5, 0x10, 0x35, 0x03, 0x29, 0x0F, 0x21, 0x03, 0x00, 0x00, 0x28, 0x0F, 0x22,
+	0x03, 0x00, 0x00, 0x0F, 0x2C, 0x03, 0x00, 0x0F, 0x3B, 0x03, 0x28, 0x0F, 0x21, 0x04, 0x38, 0x3E, 0x04, 0x39, 0x78, 0x05, 0x3A, 0x67, 0x06, 0x3B, 0x0F, 0x03, 0x3C, 0x0F, 0x02, 0x1D, 0x0F, 0x03,
+	0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x64, 0x07, 0x0F, 0x92, 0x06, 0x4F, 0x35, 0x05, 0x38, 0x43, 0x27, 0x05, 0x97, 0x29, 0x05, 0x6A, 0x29, 0x05, 0x7C, 0x25, 0x06, 0x3B, 0x52, 0x32, 0x06, 0x2B, 0x75,
+	0x07, 0x2B, 0x47, 0x08, 0x2A, 0x76, 0x07, 0x2A, 0x54, 0x22, 0x07, 0x2A, 0x61, 0x14, 0x13, 0x04, 0x7A, 0x2A, 0x03, 0x86, 0x2D, 0x03, 0x66, 0x3E, 0x03, 0x15, 0x34, 0x2D, 0x04, 0x2B, 0x3C, 0x04,
+	0x3B, 0x2B, 0x05, 0x3C, 0x48, 0x05, 0x4D, 0x45, 0x06, 0xAE, 0x08, 0x0F, 0x61, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x21, 0x0E, 0x29, 0x25, 0x0E, 0x29, 0x16, 0x0E, 0x1A, 0x26, 0x0D, 0x2A, 0x25,
+	0x0D, 0x00, 0x2A, 0xC2, 0x06, 0xF5, 0x70, 0x05, 0xB5, 0x22, 0x35, 0x04, 0x15, 0x24, 0x26, 0x26, 0x04, 0x2A, 0x26, 0x27, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x2C, 0x03, 0x0F, 0x3B, 0x03, 0x0F,
+	0x11, 0x29, 0x04, 0x3F, 0x37, 0x04, 0x4F, 0x35, 0x05, 0x0F, 0x92, 0x06, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x13, 0x0D, 0x0F, 0x33, 0x0B, 0x0F, 0x23, 0x0C, 0x2C, 0x33, 0x0C, 0x4B,
+	0x22, 0x0D, 0x6D, 0x0D, 0x5F, 0x0C, 0x7F, 0x0A, 0x2F, 0x62, 0x07, 0x1A, 0x24, 0x74, 0x04, 0x39, 0x22, 0x68, 0x02, 0x3A, 0x21, 0x3B, 0x02, 0x2B, 0x21, 0x34, 0x09, 0x2D, 0x26, 0x09, 0x00, 0x00,
+	0x00, 0x2D, 0x35, 0x09, 0x2E, 0x24, 0x0A, 0x8E, 0x0A, 0x0F, 0x41, 0x0C, 0x0F, 0x0F, 0x02, 0x3F, 0x0E, 0x00, 0x17, 0x27, 0x0F, 0x27, 0x35, 0x0F, 0x47, 0x23, 0x0F, 0x01, 0x88, 0x0F, 0x01, 0x6A,
+	0x0F, 0x01, 0x6C, 0x0E, 0x2C, 0x61, 0x0B, 0x3B, 0x73, 0x08, 0x15, 0x25, 0x77, 0x05, 0x34, 0x24, 0x89, 0x02, 0x35, 0x22, 0x5D, 0x02, 0x36, 0x21, 0x26, 0x18, 0x03, 0x27, 0x21, 0x36, 0x0B, 0x38,
+	0x28, 0x0B, 0x29, 0x28, 0x0B, 0x00, 0x00, 0x00, 0x39, 0x36, 0x0B, 0x3A, 0x34, 0x0C, 0x8B, 0x0D, 0x6C, 0x0E, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xFB, 0x10, 0x05, 0x3B, 0x45,
+	0x22, 0x05, 0x0F, 0x32, 0x0C, 0x0F, 0x31, 0x0D, 0x3F, 0x33, 0x15, 0x02, 0x2F, 0x35, 0x14, 0x02, 0x2E, 0x37, 0x32, 0x01, 0x2E, 0x68, 0x02, 0x2A, 0x21, 0x58, 0x04, 0xFA, 0x20, 0x05, 0xCC, 0x21,
+	0x05, 0x2D, 0x2A, 0x05, 0x00, 0x3D, 0x28, 0x06, 0x2E, 0x28, 0x06, 0x3F, 0x34, 0x07, 0x9F, 0x08, 0x0F, 0x62, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xCB, 0x09, 0xF7, 0x30, 0x07, 0x47, 0x55, 0x31,
+	0x07, 0x3F, 0x0E, 0x3D, 0x0F, 0x01, 0x3C, 0x15, 0x0B, 0x2C, 0x44, 0x16, 0x03, 0x2B, 0x46, 0x15, 0x03, 0x2A, 0x29, 0x34, 0x02, 0x2A, 0x2A, 0x41, 0x03, 0x2A, 0x6A, 0x04, 0x65, 0x5A, 0x06, 0xF5,
+	0x50, 0x07, 0xD8, 0x22, 0x07, 0x29, 0x2C, 0x07, 0x00, 0x39, 0x2A, 0x08, 0x2A, 0x2A, 0x08, 0x3A, 0x38, 0x08, 0x3B, 0x45, 0x09, 0xAC, 0x0A, 0x6E, 0x0C, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0x49, 0x04, 0x0F, 0x68, 0x03, 0x0F, 0x28, 0x22, 0x03, 0x0F, 0x27, 0x24, 0x02, 0x00, 0x00, 0x00, 0xEA, 0x33, 0x02, 0xFA, 0x40, 0x03, 0x2E, 0x57, 0x04, 0x2E, 0x27, 0x07, 0x2E, 0x28, 0x06,
+	0x00, 0x2E, 0x29, 0x05, 0x2E, 0x39, 0x04, 0x2E, 0x3A, 0x03, 0x0F, 0x2B, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x48, 0x05, 0x0F, 0x76, 0x04, 0x0F, 0x26, 0x23, 0x04, 0x0F, 0x35, 0x33, 0x03,
+	0x0F, 0x25, 0x25, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x10, 0x24, 0x04, 0xF6, 0x70, 0x04, 0x2B, 0x68, 0x05, 0x2B, 0x28, 0x09, 0x2B, 0x29, 0x08, 0x00, 0x2B, 0x39, 0x07, 0x2B, 0x2A, 0x07, 0x2B,
+	0x3A, 0x06, 0x2B, 0x3B, 0x05, 0x2B, 0x3C, 0x04, 0x0F, 0x1A, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x43, 0x0A, 0xCA, 0x0A, 0x00, 0x2A, 0x26, 0x16, 0x05, 0x25, 0x2A, 0x28, 0x03, 0x35,
+	0x29, 0x28, 0x03, 0x26, 0x28, 0x29, 0x03, 0x00, 0x26, 0x27, 0x2A, 0x03, 0x36, 0x26, 0x2A, 0x03, 0x27, 0x26, 0x2A, 0x03, 0x00, 0x27, 0x26, 0x29, 0x04, 0x00, 0x37, 0x35, 0x37, 0x04, 0x17, 0x28,
+	0x27, 0x05, 0x0F, 0x31, 0x44, 0x05, 0x0F, 0x92, 0x06, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xCA, 0x0A, 0xF5, 0x20, 0x0A, 0x45, 0x43, 0x0F, 0x01, 0x3B, 0x1E, 0x03, 0x2A,
+	0x3F, 0x02, 0x29, 0x0F, 0x21, 0x03, 0x28, 0x0F, 0x22, 0x03, 0x00, 0x27, 0x0F, 0x32, 0x03, 0x27, 0x0F, 0x22, 0x04, 0x27, 0x0F, 0x31, 0x04, 0x27, 0x0F, 0x21, 0x05, 0x28, 0x4D, 0x05, 0x38, 0x4B,
+	0x06, 0x49, 0x57, 0x07, 0xDA, 0x09, 0x8D, 0x0B, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x15, 0x0B, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x27, 0x29, 0x0C, 0x27, 0x38, 0x0C, 0x27, 0x37, 0x44, 0x05,
+	0x27, 0x36, 0x64, 0x04, 0x27, 0x45, 0x33, 0x22, 0x04, 0x27, 0x45, 0x23, 0x33, 0x03, 0x27, 0x24, 0x11, 0x24, 0x24, 0x03, 0x27, 0x23, 0x21, 0x24, 0x24, 0x03, 0x27, 0x32, 0x21, 0x34, 0x23, 0x03,
+	0x27, 0x31, 0x22, 0x35, 0x22, 0x03, 0x57, 0x23, 0x66, 0x03, 0x47, 0x24, 0x57, 0x03, 0x37, 0x35, 0x28, 0x04, 0x36, 0x27, 0x28, 0x04, 0x27, 0x37, 0x26, 0x05, 0x0F, 0x32, 0x43, 0x05, 0x0F, 0x83,
+	0x06, 0x0F, 0x54, 0x08, 0x0F, 0x18, 0x08, 0x0F, 0x47, 0x06, 0x2B, 0x48, 0x07, 0x2B, 0x47, 0x08, 0x2B, 0x55, 0x09, 0x2B, 0x44, 0x0B, 0x1B, 0x44, 0x0C, 0xFB, 0x30, 0x03, 0xF5, 0x90, 0x03, 0x75,
+	0x31, 0x0F, 0x01, 0x15, 0x14, 0x32, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x29, 0x0F, 0x06, 0x00, 0x00, 0x39, 0x87, 0x05, 0xFA, 0x30, 0x04,
+	0x8B, 0x27, 0x04, 0x0F, 0x2B, 0x04, 0x00, 0x0F, 0x3A, 0x04, 0x0F, 0x2A, 0x05, 0x0F, 0x48, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x16, 0x0A, 0x0F, 0x35, 0x09, 0x0F, 0x34, 0x0A, 0x27, 0x39, 0x0B,
+	0x37, 0x37, 0x0C, 0x27, 0x38, 0x0C, 0x27, 0x37, 0x28, 0x03, 0x27, 0x36, 0x29, 0x03, 0x27, 0x45, 0x29, 0x03, 0x27, 0x44, 0x2A, 0x03, 0x27, 0x53, 0x2A, 0x03, 0x27, 0x23, 0x21, 0x2A, 0x03, 0x27,
+	0x22, 0x22, 0x2A, 0x03, 0x27, 0x21, 0x23, 0x39, 0x03, 0x47, 0x24, 0x29, 0x04, 0x00, 0x37, 0x35, 0x37, 0x04, 0x36, 0x27, 0x27, 0x05, 0x0F, 0x32, 0x43, 0x05, 0x0F, 0x83, 0x06, 0x0F, 0x54, 0x08,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2E, 0x38, 0x05, 0x2E, 0x36, 0x07, 0x2E, 0x25, 0x09, 0x2E, 0x24, 0x0A, 0x2E, 0xB2, 0x03, 0xF9, 0x50, 0x03, 0xA9, 0x0D, 0x19, 0x14, 0x12, 0x0E, 0x0F, 0x21,
+	0x0E, 0x2F, 0x0F, 0x2F, 0x1A, 0x04, 0x2E, 0x3A, 0x03, 0x2E, 0x2A, 0x04, 0x00, 0x2E, 0x39, 0x04, 0x2E, 0x29, 0x05, 0x2F, 0x37, 0x05, 0x3F, 0x44, 0x06, 0x0F, 0x91, 0x07, 0x0F, 0x53, 0x09, 0x0F,
+	0x18, 0x08, 0x0F, 0x47, 0x06, 0x2B, 0x48, 0x07, 0x2B, 0x47, 0x08, 0x2B, 0x55, 0x09, 0x1B, 0x45, 0x0B, 0x2A, 0x44, 0x0C, 0xFA, 0x40, 0x03, 0xF5, 0x90, 0x03, 0x75, 0x32, 0x0F, 0x15, 0x14, 0x23,
+	0x0F, 0x01, 0x2D, 0x0F, 0x02, 0x3C, 0x0F, 0x02, 0x2C, 0x0F, 0x03, 0x00, 0x2B, 0x2D, 0x04, 0x00, 0x2B, 0x3C, 0x04, 0x2B, 0x2C, 0x05, 0x00, 0x2B, 0x3B, 0x05, 0x3B, 0x39, 0x06, 0x3C, 0x37, 0x07,
+	0x3D, 0x45, 0x07, 0x9E, 0x09, 0x0F, 0x51, 0x0B, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x57, 0x05, 0x0F, 0x94, 0x04, 0x0F, 0x43, 0x24, 0x04, 0x36, 0x38, 0x26, 0x04, 0x36, 0x27, 0x37, 0x04, 0x26, 0x27,
+	0x37, 0x05, 0x26, 0x26, 0x46, 0x06, 0x26, 0x26, 0x53, 0x08, 0x26, 0x25, 0x61, 0x0A, 0x26, 0x75, 0x34, 0x05, 0x26, 0x72, 0x56, 0x04, 0x86, 0x38, 0x31, 0x03, 0x65, 0x21, 0x28, 0x23, 0x03, 0x26,
+	0x24, 0x28, 0x23, 0x03, 0x2C, 0x28, 0x23, 0x03, 0x2C, 0x38, 0x22, 0x03, 0x2D, 0x38, 0x21, 0x03, 0x2D, 0x49, 0x04, 0x3D, 0x39, 0x04, 0x3E, 0x38, 0x04, 0x3F, 0x36, 0x05, 0x0F, 0xA1, 0x06, 0x0F,
+	0x63, 0x08, 0x0F, 0x0F, 0x02, 0x0F, 0x1D, 0x03, 0x0F, 0x2C, 0x03, 0x1F, 0x4A, 0x02, 0x3E, 0x38, 0x04, 0x2E, 0x38, 0x05, 0x16, 0x26, 0x38, 0x06, 0x26, 0x34, 0x37, 0x07, 0x26, 0x24, 0x32, 0x42,
+	0x07, 0x26, 0x33, 0x92, 0x07, 0x26, 0x32, 0x22, 0x41, 0x31, 0x06, 0x26, 0x32, 0x12, 0x23, 0x33, 0x05, 0x26, 0x31, 0x13, 0x23, 0x44, 0x03, 0x66, 0x13, 0x32, 0x26, 0x03, 0x66, 0x63, 0x44, 0x03,
+	0x36, 0x21, 0x54, 0x33, 0x05, 0x36, 0x21, 0x27, 0x23, 0x06, 0x26, 0x32, 0x25, 0x23, 0x07, 0x35, 0x23, 0x25, 0x23, 0x07, 0x17, 0x33, 0x33, 0x23, 0x07, 0x7C, 0x34, 0x06, 0x4D, 0x37, 0x05, 0x0F,
+	0x4A, 0x03, 0x0F, 0x4B, 0x02, 0x0F, 0x2C, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x18, 0x0C, 0x29, 0x37, 0x0B, 0x29, 0x45, 0x0C, 0x29, 0x44, 0x0D, 0x29, 0x43, 0x0E, 0x29, 0x51, 0x46, 0x05, 0x59,
+	0x21, 0x74, 0x04, 0x66, 0x22, 0x34, 0x23, 0x04, 0x55, 0x24, 0x24, 0x34, 0x03, 0x25, 0x21, 0x24, 0x23, 0x26, 0x03, 0x28, 0x24, 0x32, 0x26, 0x03, 0x28, 0x34, 0x21, 0x27, 0x03, 0x28, 0x95, 0x23,
+	0x03, 0x28, 0x86, 0x23, 0x03, 0x28, 0x36, 0x28, 0x03, 0x37, 0x26, 0x29, 0x03, 0x27, 0x27, 0x29, 0x03, 0x27, 0x26, 0x2A, 0x03, 0x2F, 0x2A, 0x03, 0x3E, 0x39, 0x03, 0x2E, 0x1A, 0x05, 0x3D, 0x0F,
+	0x01, 0x0F, 0x0F, 0x02, 0x0F, 0x1C, 0x04, 0x0F, 0x4A, 0x03, 0x0F, 0x68, 0x03, 0x0F, 0x66, 0x05, 0x0F, 0x54, 0x08, 0x0F, 0x52, 0x0A, 0x6F, 0x0B, 0x6D, 0x0D, 0x5B, 0x21, 0x0D, 0x59, 0x22, 0x0E,
+	0x57, 0x24, 0x0E, 0x46, 0x26, 0x0E, 0x36, 0x37, 0x0D, 0x16, 0xAA, 0x05, 0x0F, 0xA3, 0x04, 0x0F, 0x3B, 0x03, 0x0F, 0x2C, 0x03, 0x00, 0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05,
+	0x0F, 0x47, 0x06, 0x0F, 0x55, 0x07, 0x0F, 0x26, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2E, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x00, 0x17, 0x25, 0x0F, 0x02, 0x26, 0x25, 0x1C, 0x04, 0x26, 0x25, 0x2C,
+	0x03, 0x26, 0x34, 0x2C, 0x03, 0x26, 0x24, 0x3C, 0x03, 0x26, 0x24, 0x2C, 0x04, 0x27, 0x23, 0x2C, 0x04, 0x27, 0x23, 0x3B, 0x04, 0x27, 0x23, 0x2B, 0x05, 0x27, 0x23, 0x3A, 0x05, 0x27, 0x33, 0x38,
+	0x06, 0x27, 0x24, 0x47, 0x06, 0x27, 0x34, 0x45, 0x07, 0x18, 0x95, 0x09, 0x38, 0x55, 0x0B, 0x3A, 0x0F, 0x04, 0x17, 0x13, 0x0F, 0x05, 0x37, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x1A, 0x0F, 0x06, 0x0F,
+	0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x19, 0x04, 0x3F, 0x47, 0x03, 0x2F, 0x56, 0x04, 0x2F, 0x64, 0x05, 0x2F, 0x52, 0x08, 0x8E, 0x0A, 0x9A, 0x28, 0x03, 0x4A, 0x21, 0x2A, 0x03, 0x2F, 0x2A,
+	0x03, 0x00, 0x2F, 0x39, 0x03, 0x3F, 0x46, 0x04, 0x0F, 0xB1, 0x05, 0x0F, 0x72, 0x08, 0x0F, 0x0F, 0x02, 0x2D, 0x0F, 0x02, 0x3D, 0x0F, 0x01, 0x4E, 0x0E, 0x0F, 0x41, 0x0C, 0x0F, 0x52, 0x0A, 0x0F,
+	0x15, 0x0B, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0xB1, 0x05, 0xFB, 0x40, 0x02, 0x5B, 0x59, 0x02, 0x1B, 0x5A, 0x05, 0x0F, 0x17, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x0F,
+	0x21, 0x1B, 0x02, 0x0F, 0x21, 0x2B, 0x01, 0x0F, 0x21, 0x2A, 0x02, 0x0F, 0x21, 0x39, 0x02, 0x0F, 0x21, 0x46, 0x04, 0xFB, 0x10, 0x05, 0xDB, 0x08, 0x2F, 0x0F, 0x00, 0x00, 0x3E, 0x0F, 0x45, 0x0F,
+	0x08, 0x47, 0x0F, 0x06, 0x29, 0x0F, 0x06, 0x24, 0x0F, 0x0B, 0x44, 0x0F, 0x09, 0x46, 0x0F, 0x07, 0x18, 0x0F, 0x08, 0x55, 0x0F, 0x07, 0x24, 0x23, 0x0F, 0x06, 0x14, 0x15, 0x0F, 0x06, 0x00, 0x24,
+	0x23, 0x0F, 0x06, 0x55, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0F, 0x06, 0x39, 0x0F, 0x05, 0x3A, 0x2A, 0x07, 0x3B, 0x39, 0x06, 0x3C, 0x28, 0x07,
+	0x3D, 0x36, 0x07, 0x4E, 0x24, 0x08, 0x4F, 0x32, 0x08, 0x0F, 0x41, 0x31, 0x08, 0x0F, 0x62, 0x09, 0x0F, 0x44, 0x09, 0x0F, 0x25, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
+	0x0F, 0x04, 0x2B, 0x0F, 0x04, 0x3B, 0x1B, 0x06, 0x3C, 0x39, 0x05, 0x3D, 0x28, 0x06, 0x3E, 0x36, 0x06, 0x4F, 0x34, 0x06, 0x19, 0x46, 0x23, 0x07, 0x38, 0x46, 0x31, 0x07, 0x3A, 0x65, 0x08, 0x2B,
+	0x47, 0x08, 0x27, 0x3C, 0x08, 0x47, 0x0F, 0x06, 0x39, 0x0F, 0x05, 0x2A, 0x0F, 0x05, 0x0F, 0x0F, 0x02, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x0F, 0x4A, 0x03, 0x0F, 0x58, 0x04, 0x0F, 0x47, 0x06,
+	0x0F, 0x55, 0x07, 0x0F, 0x44, 0x09, 0x0F, 0x52, 0x34, 0x03, 0x6F, 0x26, 0x03, 0x7D, 0x28, 0x02, 0x5B, 0x21, 0x29, 0x02, 0x59, 0x13, 0x2A, 0x02, 0x57, 0x24, 0x2A, 0x02, 0x83, 0x25, 0x39, 0x02,
+	0x44, 0x21, 0x25, 0x29, 0x03, 0x24, 0x23, 0x35, 0x37, 0x03, 0x29, 0x36, 0x44, 0x04, 0x39, 0x95, 0x06, 0x2A, 0x57, 0x08, 0x2A, 0x0F, 0x05, 0x3A, 0x0F, 0x04, 0x2B, 0x0F, 0x04, 0x1A, 0x0F, 0x06,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x14, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2C, 0x0F,
+	0x03, 0x00, 0x2C, 0x1E, 0x03, 0x2C, 0x3D, 0x02, 0x2C, 0x3C, 0x03, 0x00, 0x2C, 0x4A, 0x04, 0x2C, 0x48, 0x06, 0x2C, 0x92, 0x07, 0x2C, 0x62, 0x0A, 0x2C, 0x0F, 0x03, 0x2C, 0x15, 0x0C, 0x2C, 0x24,
+	0x0C, 0x2C, 0x43, 0x0B, 0x2C, 0x33, 0x0C, 0x2C, 0x41, 0x0D, 0x5C, 0x0F, 0x4C, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0x1D, 0x0F, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x27, 0x0F, 0x08, 0x27, 0x0F, 0x12,
+	0x05, 0x27, 0x0F, 0x22, 0x04, 0x27, 0x0F, 0x32, 0x03, 0x27, 0x0F, 0x31, 0x04, 0x27, 0x3F, 0x05, 0x27, 0x4E, 0x05, 0x27, 0x4D, 0x06, 0x27, 0x5A, 0x08, 0x27, 0xB3, 0x09, 0x27, 0x73, 0x0D, 0x27,
+	0x0F, 0x08, 0x00, 0x27, 0x16, 0x0F, 0x01, 0x27, 0x35, 0x0F, 0x27, 0x34, 0x0F, 0x01, 0x27, 0x33, 0x0F, 0x02, 0x27, 0x32, 0x0F, 0x03, 0x27, 0x31, 0x0F, 0x04, 0x57, 0x0F, 0x05, 0x47, 0x0F, 0x06,
+	0x27, 0x0F, 0x08, 0x18, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x25, 0x0A, 0x00, 0x0F, 0x34, 0x0A, 0x0F, 0x24, 0x0B, 0x00, 0x0F, 0x33, 0x0B, 0x0F, 0x23, 0x0C, 0x0F, 0x32, 0x0C, 0x0F,
+	0x22, 0x0D, 0x0F, 0x31, 0x0D, 0x0F, 0xE1, 0x02, 0xFF, 0x02, 0x3E, 0x0F, 0x3D, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0x4B, 0x0F, 0x02, 0x4A, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x1B, 0x0F, 0x05, 0x0F, 0x0F,
+	0x02, 0x00, 0x0F, 0x22, 0x0D, 0x0F, 0x32, 0x0C, 0x0F, 0x31, 0x0D, 0x00, 0x0F, 0x21, 0x0E, 0x3F, 0x0E, 0x00, 0x2F, 0x0F, 0x3E, 0x0F, 0x2E, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0xFC,
+	0x20, 0x03, 0xFB, 0x30, 0x03, 0x3A, 0x0F, 0x04, 0x39, 0x0F, 0x05, 0x00, 0x47, 0x0F, 0x06, 0x46, 0x0F, 0x07, 0x45, 0x0F, 0x08, 0x26, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x8E, 0x0A, 0x00, 0x2E, 0x0F, 0x01, 0x00, 0x2E, 0x1C, 0x03, 0x2E, 0x2C, 0x02, 0x2E, 0x3B, 0x02, 0x6A, 0x2B, 0x03, 0x6A, 0x3A, 0x03, 0x2E, 0x2A, 0x04, 0x2E, 0x39, 0x04, 0x2E, 0x38,
+	0x05, 0x2E, 0x37, 0x06, 0x2E, 0x45, 0x07, 0x2E, 0x71, 0x08, 0x8E, 0x0A, 0x5E, 0x0D, 0x1E, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x9A, 0x0D, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x2A, 0x1F,
+	0x04, 0x2A, 0x2F, 0x03, 0x2A, 0x3E, 0x03, 0x00, 0x75, 0x2E, 0x04, 0x75, 0x3D, 0x04, 0x2A, 0x3C, 0x05, 0x2A, 0x4B, 0x05, 0x2A, 0x4A, 0x06, 0x2A, 0x49, 0x07, 0x2A, 0x48, 0x08, 0x2A, 0x56, 0x09,
+	0x2A, 0x63, 0x0B, 0x9A, 0x0D, 0x7A, 0x0F, 0x3A, 0x0F, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x2B, 0x04, 0x00, 0x2D, 0x2B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x04, 0x00, 0x2D,
+	0x2B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x2B, 0x04, 0x0F, 0x0F, 0x02, 0x0F, 0x2A, 0x05, 0x00, 0x29, 0x2E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x30,
+	0x05, 0x00, 0x29, 0x2E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x2A, 0x05, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x1A, 0x06, 0x2F, 0x28, 0x05, 0x2F, 0x38, 0x04,
+	0x2F, 0x37, 0x05, 0x2F, 0x36, 0x06, 0x2F, 0x26, 0x07, 0x2F, 0x25, 0x08, 0x2F, 0x34, 0x08, 0x2F, 0x33, 0x25, 0x02, 0x2F, 0x32, 0x26, 0x02, 0x2F, 0x31, 0x27, 0x02, 0x5F, 0x28, 0x02, 0xFB, 0x40,
+	0x02, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x19, 0x07, 0x2B, 0x3A, 0x06, 0x2B, 0x2A, 0x07, 0x2B, 0x39, 0x07, 0x2B, 0x38, 0x08, 0x2B, 0x28, 0x09, 0x2B,
+	0x37, 0x09, 0x2B, 0x36, 0x0A, 0x2B, 0x35, 0x0B, 0x2B, 0x34, 0x27, 0x03, 0x2B, 0x33, 0x28, 0x03, 0x2B, 0x32, 0x29, 0x03, 0x2B, 0x31, 0x2A, 0x03, 0x5B, 0x2B, 0x03, 0xF6, 0x80, 0x03, 0xF6, 0x70,
+	0x04, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x2B, 0x1D, 0x05, 0x2B, 0x2D, 0x04, 0x2B, 0x3C, 0x04, 0x2B, 0x3B, 0x05, 0x2B, 0x3A, 0x06, 0x2B, 0x49, 0x06,
+	0x2B, 0x47, 0x08, 0x2B, 0x55, 0x09, 0x2B, 0x71, 0x0B, 0xD6, 0x0D, 0x86, 0x0F, 0x03, 0x2B, 0x1D, 0x05, 0x2B, 0x2D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x3C, 0x04, 0x2B, 0x77, 0x05, 0xFB, 0x06,
+	0xAB, 0x0B, 0x0F, 0x0F, 0x02, 0x00, 0x2B, 0x1E, 0x04, 0x2B, 0x2E, 0x03, 0x2B, 0x3D, 0x03, 0x2B, 0x3C, 0x04, 0x2B, 0x3B, 0x05, 0x2B, 0x4A, 0x05, 0x2B, 0x48, 0x07, 0x2B, 0x65, 0x08, 0x2B, 0x81,
+	0x0A, 0xD6, 0x0D, 0x86, 0x0F, 0x03, 0x2B, 0x1E, 0x04, 0x2B, 0x2E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x3D, 0x03, 0x26, 0x23, 0x88, 0x03, 0x45, 0xF2, 0x10, 0x05, 0x28, 0xA1, 0x0B, 0x34, 0x0F,
+	0x0A, 0x35, 0x0F, 0x09, 0x27, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x2C, 0x26, 0x0A, 0x3B, 0x26, 0x0A, 0x00, 0x3B, 0x35, 0x0A, 0x2B, 0x36, 0x0A, 0x2B, 0x26, 0x0B, 0x00, 0x00, 0x35, 0x32, 0x26,
+	0x0B, 0x85, 0x26, 0x0B, 0xF6, 0x0B, 0xEA, 0x08, 0x2A, 0xC5, 0x03, 0x2A, 0x26, 0x81, 0x03, 0x2A, 0x26, 0x36, 0x03, 0x39, 0x26, 0x0C, 0x29, 0x36, 0x0C, 0x29, 0x26, 0x0D, 0x00, 0x38, 0x26, 0x0D,
+	0x1A, 0x26, 0x0D, 0x0F, 0x31, 0x0D, 0x00, 0x0F, 0x0F, 0x02, 0x2C, 0x27, 0x09, 0x3C, 0x35, 0x09, 0x2C, 0x36, 0x09, 0x00, 0x2C, 0x26, 0x0A, 0x3B, 0x26, 0x0A, 0x00, 0x2B, 0x27, 0x0A, 0x36, 0x22,
+	0x36, 0x0A, 0x95, 0x35, 0x0A, 0xF6, 0x0B, 0xDB, 0x08, 0x3A, 0xD4, 0x02, 0x2A, 0x27, 0x81, 0x02, 0x2A, 0x36, 0x36, 0x02, 0x2A, 0x36, 0x0B, 0x2A, 0x26, 0x0C, 0x39, 0x26, 0x0C, 0x15, 0x33, 0x26,
+	0x0C, 0x44, 0x31, 0x26, 0x0C, 0x36, 0x12, 0x35, 0x0C, 0x13, 0x14, 0x38, 0x0C, 0x33, 0x2B, 0x0D, 0x44, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x11, 0x0F, 0x0F, 0x21, 0x0E,
+	0x3F, 0x0E, 0x3E, 0x1A, 0x04, 0x3D, 0x2B, 0x03, 0x3C, 0x3B, 0x03, 0x3B, 0x3C, 0x03, 0x49, 0x3C, 0x04, 0x48, 0x3D, 0x04, 0x56, 0x3D, 0x05, 0x65, 0x2D, 0x06, 0x25, 0x22, 0x3C, 0x06, 0x29, 0x3B,
+	0x07, 0x29, 0x3A, 0x08, 0x29, 0x39, 0x09, 0x29, 0x47, 0x0A, 0x29, 0x46, 0x0B, 0x29, 0x44, 0x0D, 0x29, 0x61, 0x0E, 0x79, 0x0F, 0x01, 0x59, 0x0F, 0x03, 0x1A, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x0F,
+	0x12, 0x0E, 0x0F, 0x22, 0x0D, 0x0F, 0x31, 0x0D, 0x3F, 0x1A, 0x03, 0x3E, 0x2B, 0x02, 0x3D, 0x3B, 0x02, 0x3C, 0x3C, 0x02, 0x3B, 0x3C, 0x03, 0x49, 0x3D, 0x03, 0x57, 0x3D, 0x04, 0x66, 0x3D, 0x04,
+	0x36, 0x21, 0x3C, 0x05, 0x16, 0x23, 0x3B, 0x06, 0x2A, 0x3A, 0x07, 0x2A, 0x49, 0x07, 0x2A, 0x47, 0x09, 0x2A, 0x46, 0x0A, 0x2A, 0x54, 0x0B, 0x2A, 0x52, 0x0D, 0x16, 0x83, 0x0E, 0x35, 0x52, 0x0F,
+	0x02, 0x67, 0x0F, 0x04, 0x14, 0x13, 0x0F, 0x08, 0x34, 0x0F, 0x0A, 0x45, 0x0F, 0x08, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x0F, 0x12, 0x0E, 0x00, 0x0F, 0x31, 0x0D, 0x3F, 0x0E, 0x4D, 0x0F, 0x4C,
+	0x0F, 0x01, 0x5A, 0x1C, 0x04, 0x15, 0x61, 0x1E, 0x04, 0x76, 0x3D, 0x03, 0x36, 0x22, 0x3D, 0x03, 0x2B, 0x3C, 0x04, 0x2B, 0x4A, 0x05, 0x2B, 0x49, 0x06, 0x2B, 0x57, 0x07, 0x2B, 0x73, 0x09, 0xAB,
+	0x0B, 0x6B, 0x0F, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x12, 0x0E, 0x00, 0x0F, 0x31, 0x0D, 0x3F, 0x0E, 0x4D, 0x0F, 0x4C, 0x0F, 0x01, 0x5A, 0x1C, 0x04, 0x85, 0x2E,
+	0x03, 0x76, 0x3D, 0x03, 0x36, 0x22, 0x4C, 0x03, 0x2B, 0x3C, 0x04, 0x2B, 0x4A, 0x05, 0x2B, 0x49, 0x06, 0x2B, 0x57, 0x07, 0x2B, 0x73, 0x09, 0xAB, 0x0B, 0x6B, 0x0F, 0x2B, 0x0F, 0x04, 0x00, 0x15,
+	0x25, 0x0F, 0x04, 0x35, 0x23, 0x0F, 0x04, 0x46, 0x21, 0x0F, 0x04, 0x14, 0x13, 0x22, 0x0F, 0x04, 0x34, 0x24, 0x0F, 0x04, 0x35, 0x23, 0x0F, 0x04, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00,
+	0x00, 0x28, 0x2E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x50, 0x04, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x29, 0x2E,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x24, 0x2E, 0x05, 0x34, 0x22, 0x2E, 0x05, 0xF5, 0x90, 0x03, 0x17, 0xF1, 0x50, 0x03, 0x23, 0x0F,
+	0x0C, 0x44, 0x0F, 0x09, 0x25, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x2C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0B, 0x00, 0x2C, 0x1D, 0x04, 0x2C, 0x2D, 0x03, 0x2C, 0x3D, 0x02, 0x2C, 0x3C,
+	0x03, 0x00, 0x2C, 0x3B, 0x04, 0x2C, 0x3A, 0x05, 0x2C, 0x58, 0x05, 0x2C, 0x56, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x0B, 0x2C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x2C, 0x0F,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0B, 0x00, 0x2C, 0x1D, 0x04, 0x2C, 0x2D, 0x03, 0x2C, 0x3D, 0x02, 0x2C, 0x3C, 0x03, 0x2C, 0x3B, 0x04, 0x2C, 0x4A, 0x04, 0x2C, 0x49, 0x05, 0x2C, 0x56,
+	0x07, 0xF6, 0x30, 0x08, 0xF6, 0x0B, 0x2C, 0x0F, 0x03, 0x16, 0x25, 0x0F, 0x03, 0x36, 0x23, 0x0F, 0x03, 0x28, 0x22, 0x0F, 0x03, 0x15, 0x26, 0x0F, 0x03, 0x35, 0x11, 0x22, 0x0F, 0x03, 0x27, 0x0F,
+	0x08, 0x0F, 0x0F, 0x02, 0x00, 0x1E, 0x0F, 0x02, 0x3C, 0x1B, 0x05, 0x3D, 0x3A, 0x03, 0x3E, 0x39, 0x03, 0x17, 0x36, 0x29, 0x04, 0x36, 0x36, 0x28, 0x04, 0x27, 0x27, 0x37, 0x04, 0x37, 0x16, 0x38,
+	0x04, 0x38, 0x3D, 0x05, 0x29, 0x3D, 0x05, 0x39, 0x3B, 0x06, 0x1A, 0x3C, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x36, 0x08, 0x00, 0x0F, 0x35, 0x09, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x0F, 0x32, 0x0C,
+	0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x4D, 0x0F, 0x2E, 0x0F, 0x01, 0x0F, 0x0F, 0x02, 0x00, 0x1E, 0x0F, 0x02, 0x3C, 0x1B, 0x05, 0x3D, 0x3A, 0x03, 0x2E, 0x3A, 0x03, 0x17, 0x36, 0x29, 0x04, 0x36, 0x36,
+	0x28, 0x04, 0x36, 0x27, 0x37, 0x04, 0x37, 0x16, 0x38, 0x04, 0x28, 0x3E, 0x05, 0x38, 0x3D, 0x05, 0x39, 0x2C, 0x06, 0x1A, 0x3C, 0x06, 0x0F, 0x37, 0x07, 0x00, 0x0F, 0x36, 0x08, 0x0F, 0x35, 0x09,
+	0x0F, 0x25, 0x0A, 0x17, 0x3B, 0x0A, 0x46, 0x38, 0x0B, 0x48, 0x35, 0x0C, 0x1A, 0x44, 0x0D, 0x25, 0x47, 0x0E, 0x45, 0x44, 0x0F, 0x37, 0x15, 0x0F, 0x01, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00,
+	0x0F, 0x1B, 0x05, 0x0F, 0x3B, 0x03, 0x0F, 0x3A, 0x04, 0x28, 0x3F, 0x04, 0x28, 0x3E, 0x05, 0x00, 0x28, 0x3D, 0x06, 0x28, 0x3C, 0x07, 0x28, 0x3B, 0x08, 0x28, 0x3A, 0x09, 0x28, 0x49, 0x09, 0x28,
+	0x48, 0x0A, 0x28, 0x47, 0x0B, 0x28, 0x56, 0x0B, 0x28, 0x84, 0x0A, 0x28, 0x43, 0x42, 0x09, 0x78, 0x45, 0x08, 0x68, 0x47, 0x07, 0x48, 0x4A, 0x06, 0x28, 0x4D, 0x05, 0x0F, 0x49, 0x04, 0x0F, 0x4A,
+	0x03, 0x0F, 0x1B, 0x05, 0x0F, 0x0F, 0x02, 0x0F, 0x1B, 0x05, 0x0F, 0x3B, 0x03, 0x28, 0x3F, 0x04, 0x00, 0x28, 0x3E, 0x05, 0x28, 0x2E, 0x06, 0x28, 0x3D, 0x06, 0x28, 0x3C, 0x07, 0x28, 0x3B, 0x08,
+	0x28, 0x3A, 0x09, 0x28, 0x39, 0x0A, 0x28, 0x48, 0x0A, 0x28, 0x47, 0x0B, 0x28, 0x56, 0x0B, 0x28, 0x84, 0x0A, 0x28, 0x52, 0x42, 0x09, 0x78, 0x45, 0x08, 0x68, 0x47, 0x07, 0x15, 0x42, 0x4A, 0x06,
+	0x64, 0x4D, 0x05, 0x36, 0x5F, 0x03, 0x14, 0x13, 0x0F, 0x31, 0x04, 0x33, 0x0F, 0x15, 0x05, 0x35, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x3E, 0x0F, 0x2E, 0x0F, 0x01, 0x00, 0x00, 0x3D,
+	0x0F, 0x01, 0x2D, 0x0F, 0x02, 0x00, 0xF5, 0x60, 0x06, 0xF5, 0x70, 0x05, 0x3C, 0x3A, 0x04, 0x2C, 0x2C, 0x04, 0x00, 0x00, 0x00, 0x3B, 0x2C, 0x04, 0x2B, 0x16, 0x26, 0x04, 0x2B, 0x44, 0x25, 0x04,
+	0x2B, 0x43, 0x26, 0x04, 0x2B, 0x42, 0x27, 0x04, 0x7A, 0x29, 0x04, 0x6A, 0x39, 0x04, 0x4A, 0x3B, 0x04, 0x3A, 0x0F, 0x04, 0x0F, 0x0F, 0x02, 0x3F, 0x0E, 0x2F, 0x0F, 0x00, 0x00, 0x3E, 0x0F, 0x00,
+	0x2E, 0x0F, 0x01, 0xF6, 0x60, 0x05, 0xF6, 0x70, 0x04, 0x3D, 0x3A, 0x03, 0x2D, 0x2C, 0x03, 0x00, 0x00, 0x00, 0x3C, 0x2C, 0x03, 0x2C, 0x16, 0x26, 0x03, 0x2C, 0x44, 0x25, 0x03, 0x2C, 0x43, 0x26,
+	0x03, 0x2C, 0x32, 0x28, 0x03, 0x25, 0x74, 0x29, 0x03, 0x45, 0x62, 0x39, 0x03, 0x37, 0x41, 0x3B, 0x03, 0x24, 0x12, 0x32, 0x0F, 0x03, 0x34, 0x0F, 0x0A, 0x36, 0x0F, 0x08, 0x17, 0x0F, 0x09, 0x0F,
+	0x0F, 0x02, 0x00, 0x00, 0x18, 0x0F, 0x08, 0x38, 0x0F, 0x06, 0x67, 0x0F, 0x04, 0x59, 0x0F, 0x03, 0x5B, 0x1B, 0x04, 0x4D, 0x29, 0x04, 0x2E, 0x3A, 0x03, 0x0F, 0x3A, 0x04, 0x00, 0x0F, 0x39, 0x05,
+	0x0F, 0x38, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x46, 0x07, 0x0F, 0x45, 0x08, 0x0F, 0x53, 0x09, 0x0F, 0x42, 0x0B, 0x6E, 0x0C, 0x7B, 0x0E, 0x97, 0x0F, 0x01, 0x67, 0x0F, 0x04, 0x27, 0x0F, 0x08, 0x0F,
+	0x0F, 0x02, 0x00, 0x18, 0x0F, 0x08, 0x38, 0x0F, 0x06, 0x58, 0x0F, 0x04, 0x5A, 0x0F, 0x02, 0x5B, 0x1B, 0x04, 0x4D, 0x29, 0x04, 0x1F, 0x3A, 0x03, 0x0F, 0x3A, 0x04, 0x00, 0x0F, 0x39, 0x05, 0x0F,
+	0x38, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x46, 0x07, 0x0F, 0x45, 0x08, 0x0F, 0x53, 0x09, 0x0F, 0x51, 0x0B, 0x14, 0x69, 0x0C, 0x24, 0x84, 0x0E, 0x35, 0x71, 0x0F, 0x01, 0x26, 0x31, 0x0F, 0x05, 0x13,
+	0x0F, 0x0D, 0x33, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x0F, 0x12, 0x0E, 0x0F, 0x31, 0x0D, 0x3F, 0x0E, 0x2F, 0x1B, 0x03, 0x3E, 0x3A, 0x02, 0x3D, 0x2B, 0x03, 0x4B,
+	0x3B, 0x03, 0x4A, 0x3C, 0x03, 0x49, 0x13, 0x38, 0x04, 0x47, 0x34, 0x37, 0x04, 0x65, 0x25, 0x36, 0x05, 0x35, 0x21, 0x35, 0x34, 0x06, 0x16, 0x22, 0x36, 0x42, 0x06, 0x29, 0x27, 0x32, 0x07, 0x29,
+	0x67, 0x08, 0x29, 0x48, 0x09, 0x29, 0x57, 0x09, 0x29, 0x75, 0x09, 0x29, 0x53, 0x32, 0x08, 0x29, 0x51, 0x35, 0x07, 0x79, 0x17, 0x08, 0x49, 0x0F, 0x04, 0x1A, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x0F,
+	0x12, 0x0E, 0x0F, 0x31, 0x0D, 0x3F, 0x0E, 0x2F, 0x1B, 0x03, 0x2E, 0x3B, 0x02, 0x4C, 0x2B, 0x03, 0x4B, 0x3B, 0x03, 0x4A, 0x2C, 0x04, 0x48, 0x14, 0x38, 0x04, 0x47, 0x34, 0x27, 0x05, 0x65, 0x35,
+	0x35, 0x05, 0x35, 0x21, 0x35, 0x34, 0x06, 0x15, 0x23, 0x36, 0x32, 0x07, 0x29, 0x77, 0x07, 0x29, 0x67, 0x08, 0x29, 0x48, 0x09, 0x29, 0x66, 0x09, 0x29, 0x85, 0x08, 0x29, 0x62, 0x42, 0x07, 0x15,
+	0x83, 0x25, 0x08, 0x44, 0x61, 0x17, 0x09, 0x66, 0x0F, 0x05, 0x14, 0x23, 0x0F, 0x07, 0x33, 0x0F, 0x0B, 0x35, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x2F, 0x0F, 0x00, 0x27, 0x26,
+	0x0F, 0x00, 0x27, 0x26, 0x1A, 0x04, 0x27, 0x26, 0x39, 0x03, 0x00, 0x27, 0x26, 0x38, 0x04, 0x27, 0x26, 0x37, 0x05, 0x27, 0x26, 0x45, 0x06, 0x27, 0x26, 0x53, 0x07, 0xF7, 0x10, 0x09, 0xE7, 0x0B,
+	0x27, 0x26, 0x0F, 0x26, 0x27, 0x0F, 0x00, 0x00, 0x00, 0x35, 0x27, 0x0F, 0x26, 0x27, 0x0F, 0x2F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x2F, 0x0F, 0x00, 0x28, 0x25, 0x0F, 0x00, 0x28, 0x25, 0x1A,
+	0x04, 0x28, 0x25, 0x39, 0x03, 0x00, 0x28, 0x25, 0x38, 0x04, 0x28, 0x25, 0x37, 0x05, 0x28, 0x25, 0x45, 0x06, 0x28, 0x25, 0x53, 0x07, 0xF8, 0x09, 0xC8, 0x0C, 0x28, 0x25, 0x0F, 0x27, 0x26, 0x0F,
+	0x00, 0x00, 0x00, 0x36, 0x11, 0x24, 0x0F, 0x27, 0x31, 0x22, 0x0F, 0x3B, 0x21, 0x0F, 0x19, 0x13, 0x21, 0x0F, 0x29, 0x24, 0x0F, 0x3A, 0x0F, 0x04, 0x1B, 0x0F, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x00,
+	0x00, 0x1D, 0x0F, 0x03, 0x4D, 0x0F, 0x8C, 0x0C, 0x0F, 0x41, 0x18, 0x03, 0x0F, 0x13, 0x19, 0x03, 0x0F, 0x3C, 0x02, 0x0F, 0x2C, 0x03, 0x3B, 0x3C, 0x03, 0x6B, 0x29, 0x04, 0x5D, 0x37, 0x04, 0x0F,
+	0x11, 0x37, 0x05, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x45, 0x08, 0x0F, 0x44, 0x09, 0x0F, 0x51, 0x0B, 0x8C, 0x0C, 0x5C, 0x0F, 0x2C, 0x0F, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0x28, 0x0F, 0x07,
+	0x48, 0x0F, 0x05, 0x78, 0x0F, 0x02, 0x6B, 0x0F, 0x3D, 0x0F, 0x01, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x00, 0x17, 0x0F, 0x32, 0x04, 0x46, 0x3F, 0x04, 0x67, 0x3B, 0x05, 0x59, 0x39, 0x06, 0x2C,
+	0x48, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x36, 0x08, 0x0F, 0x44, 0x09, 0x0F, 0x43, 0x0A, 0x0F, 0x51, 0x0B, 0x5E, 0x0D, 0x6B, 0x0F, 0x87, 0x0F, 0x02, 0x67, 0x0F, 0x04, 0x18, 0x0F, 0x08, 0x0F, 0x0F,
+	0x02, 0x00, 0x19, 0x0F, 0x07, 0x49, 0x0F, 0x04, 0x78, 0x0F, 0x02, 0x6B, 0x0F, 0x3E, 0x1A, 0x04, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x00, 0x27, 0x0F, 0x31, 0x04, 0x47, 0x3E, 0x04, 0x77, 0x3A,
+	0x05, 0x5A, 0x38, 0x06, 0x1D, 0x39, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x36, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x43, 0x0A, 0x14, 0x5B, 0x0B, 0x24, 0x58, 0x0D, 0x35, 0x73, 0x0E, 0x26, 0x71, 0x0F, 0x01,
+	0x13, 0x36, 0x0F, 0x04, 0x33, 0x13, 0x0F, 0x07, 0x34, 0x0F, 0x0A, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x2E, 0x0F, 0x01, 0x00, 0x00, 0x27, 0x25, 0x0F, 0x01, 0x27, 0x25, 0x1B, 0x04, 0x27,
+	0x25, 0x2B, 0x03, 0x27, 0x25, 0x3A, 0x03, 0x27, 0x25, 0x39, 0x04, 0x27, 0x25, 0x38, 0x05, 0x27, 0x25, 0x47, 0x05, 0x27, 0x25, 0x64, 0x06, 0x27, 0xA5, 0x08, 0x27, 0x75, 0x0B, 0x27, 0x25, 0x0F,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x2E, 0x0F, 0x01, 0x00, 0x00, 0x27, 0x25, 0x0F, 0x01, 0x27, 0x25, 0x1B, 0x04, 0x27, 0x25, 0x2B,
+	0x03, 0x27, 0x25, 0x3A, 0x03, 0x27, 0x25, 0x39, 0x04, 0x27, 0x25, 0x38, 0x05, 0x27, 0x25, 0x47, 0x05, 0x27, 0x25, 0x64, 0x06, 0x27, 0xA5, 0x08, 0x27, 0x75, 0x0B, 0x27, 0x25, 0x0F, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x15, 0x28, 0x0F, 0x01, 0x34, 0x27, 0x0F, 0x01, 0x36, 0x25, 0x0F, 0x01, 0x14, 0x22, 0x25, 0x0F, 0x01, 0x33, 0x28, 0x0F, 0x01, 0x34, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x0F, 0x0F,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x80, 0x03, 0x00, 0x2E, 0x0F, 0x01, 0x3E, 0x0F, 0x00, 0x2F, 0x0F, 0x3F, 0x0E, 0x0F, 0x21, 0x0E, 0x0F, 0x31, 0x0D, 0x00, 0x0F, 0x22,
+	0x0D, 0x0F, 0x32, 0x0C, 0x0F, 0x23, 0x0C, 0x0F, 0x33, 0x0B, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x90, 0x03, 0x00, 0x3D, 0x0F, 0x01, 0x2E, 0x0F, 0x01, 0x3E, 0x0F,
+	0x00, 0x2F, 0x0F, 0x3F, 0x0E, 0x17, 0x37, 0x0E, 0x46, 0x36, 0x0D, 0x48, 0x34, 0x0D, 0x29, 0x36, 0x0C, 0x25, 0x3A, 0x0C, 0x45, 0x39, 0x0B, 0x37, 0x0F, 0x07, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02,
+	0x00, 0x2C, 0x0F, 0x03, 0x00, 0x00, 0x2C, 0x1C, 0x05, 0x2C, 0x2C, 0x04, 0x2C, 0x4B, 0x03, 0x2C, 0x3B, 0x04, 0x2C, 0x3A, 0x05, 0x2C, 0x48, 0x06, 0x2C, 0x47, 0x07, 0x2C, 0x64, 0x08, 0xF5, 0x20,
+	0x0A, 0xE5, 0x0D, 0x2C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x29, 0x2D, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x1C, 0x04, 0x0F, 0x2C, 0x03, 0x28, 0x0F, 0x31, 0x03, 0x28,
+	0x15, 0x3A, 0x03, 0x28, 0x24, 0x39, 0x04, 0x28, 0x34, 0x38, 0x04, 0x28, 0x35, 0x36, 0x05, 0x28, 0x26, 0x45, 0x05, 0x28, 0x36, 0x43, 0x06, 0x28, 0x37, 0x32, 0x07, 0x28, 0x28, 0x31, 0x08, 0x28,
+	0x58, 0x09, 0x28, 0x39, 0x0A, 0x28, 0x67, 0x09, 0x28, 0x85, 0x09, 0x28, 0x53, 0x33, 0x08, 0x98, 0x35, 0x07, 0x68, 0x39, 0x06, 0x48, 0x4B, 0x05, 0x19, 0x1E, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x0F,
+	0x16, 0x0A, 0x0F, 0x26, 0x09, 0x29, 0x39, 0x09, 0x00, 0x29, 0x29, 0x0A, 0x29, 0x38, 0x0A, 0x00, 0x29, 0x28, 0x0B, 0x29, 0x37, 0x0B, 0x29, 0x27, 0x0C, 0x29, 0x36, 0x0C, 0x65, 0xD5, 0x03, 0x65,
+	0xE4, 0x03, 0x29, 0x24, 0x0F, 0x29, 0x33, 0x0F, 0x29, 0x32, 0x13, 0x0C, 0x29, 0x31, 0x23, 0x0C, 0x59, 0x24, 0x0C, 0x49, 0x35, 0x0B, 0x39, 0x37, 0x0A, 0x1A, 0x29, 0x0A, 0x0F, 0x35, 0x09, 0x0F,
+	0x36, 0x08, 0x0F, 0x16, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x1B, 0x05, 0x0F, 0x2A, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x00, 0x0F, 0x36,
+	0x08, 0x0F, 0x35, 0x09, 0x0F, 0x34, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x41, 0x0C, 0x5E, 0x0D, 0x5C, 0x0F, 0x78, 0x0F, 0x02, 0x76, 0x0F, 0x04, 0x56, 0x0F, 0x06, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02,
+	0x0F, 0x1B, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x58, 0x04, 0x0F, 0x56, 0x06, 0x0F, 0x64, 0x07, 0x0F, 0x71, 0x09, 0x8D, 0x0B, 0xA8, 0x0E, 0x69, 0x0F, 0x02, 0x29, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x19, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x59, 0x0F, 0x03, 0x6B, 0x0F, 0x6D, 0x0D, 0x7F, 0x0A, 0x0F, 0x82, 0x07, 0x0F, 0x85, 0x04, 0x0F, 0x58, 0x04, 0x0F, 0x1B, 0x05, 0x0F, 0x0F,
+	0x02, 0x0F, 0x1B, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x58, 0x04, 0x0F, 0x56, 0x06, 0x0F, 0x64, 0x07, 0x0F, 0x71, 0x09, 0x9C, 0x0B, 0xA8, 0x0E, 0x69, 0x0F, 0x02, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x0F, 0x06, 0x58, 0x0F, 0x04, 0x69, 0x0F, 0x02, 0x6B, 0x0F, 0x16, 0x76, 0x0C, 0x45, 0x77, 0x09, 0x37, 0x88, 0x06, 0x14, 0x13, 0x7C, 0x04, 0x34, 0x0F, 0x32, 0x05,
+	0x45, 0x0F, 0x12, 0x05, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x0F, 0x1C, 0x04, 0x0F, 0x2B, 0x04, 0x0F, 0x49, 0x04, 0x0F, 0x57, 0x05, 0x0F, 0x65, 0x06, 0x0F, 0x63, 0x08, 0x7F, 0x0A, 0x9A, 0x0D,
+	0x79, 0x0F, 0x01, 0x49, 0x0F, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0F, 0x07, 0x39, 0x0F, 0x05, 0x68, 0x0F, 0x03, 0x5B, 0x0F, 0x01, 0x6D, 0x0D, 0x46, 0x75, 0x0A, 0x25, 0x22,
+	0x87, 0x06, 0x15, 0x14, 0x89, 0x04, 0x15, 0x14, 0x5C, 0x04, 0x25, 0x22, 0x1F, 0x05, 0x46, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0xF6, 0x60, 0x05, 0x2F,
+	0x28, 0x05, 0x3E, 0x29, 0x04, 0x00, 0x2E, 0x2A, 0x04, 0x00, 0x3D, 0x2A, 0x04, 0x2D, 0x2B, 0x04, 0x00, 0x3C, 0x2B, 0x04, 0x2C, 0x2C, 0x04, 0x00, 0x3B, 0x2C, 0x04, 0x2B, 0x2D, 0x04, 0x3A, 0x2D,
+	0x04, 0x1B, 0x3D, 0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0xF6, 0x60, 0x05, 0x2F, 0x28, 0x05, 0x3E, 0x29, 0x04, 0x00, 0x2E, 0x2A, 0x04, 0x00, 0x3D,
+	0x2A, 0x04, 0x2D, 0x2B, 0x04, 0x00, 0x3C, 0x2B, 0x04, 0x2C, 0x2C, 0x04, 0x00, 0x3B, 0x2C, 0x04, 0x25, 0x24, 0x2D, 0x04, 0x45, 0x31, 0x2D, 0x04, 0x37, 0x12, 0x3C, 0x04, 0x24, 0x12, 0x0F, 0x31,
+	0x04, 0x34, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0xF6, 0x60, 0x05, 0x2F, 0x28, 0x05, 0x2F, 0x29, 0x04, 0x3E, 0x29, 0x04,
+	0x2E, 0x2A, 0x04, 0x00, 0x00, 0x3D, 0x2A, 0x04, 0x2D, 0x2B, 0x04, 0x00, 0x3C, 0x2B, 0x04, 0x2C, 0x2C, 0x04, 0x3B, 0x2C, 0x04, 0x00, 0x76, 0x2D, 0x04, 0x25, 0x22, 0x11, 0x3C, 0x04, 0x15, 0x14,
+	0x3E, 0x04, 0x15, 0x14, 0x0F, 0x06, 0x25, 0x22, 0x0F, 0x06, 0x46, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x00, 0x28, 0x0F, 0x11, 0x05, 0x28, 0x0F, 0x31, 0x03, 0x28,
+	0x0F, 0x21, 0x04, 0x28, 0x3F, 0x04, 0x00, 0x28, 0x3E, 0x05, 0x00, 0x28, 0x3D, 0x06, 0x28, 0x3C, 0x07, 0x28, 0x4B, 0x07, 0x28, 0x4A, 0x08, 0x28, 0x49, 0x09, 0x28, 0x57, 0x0A, 0x28, 0x55, 0x0C,
+	0x28, 0x72, 0x0D, 0x98, 0x0F, 0x68, 0x0F, 0x03, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x00, 0x28, 0x0F, 0x11, 0x05, 0x28, 0x0F, 0x31, 0x03, 0x28, 0x3F, 0x04,
+	0x00, 0x28, 0x2F, 0x05, 0x28, 0x3E, 0x05, 0x28, 0x3D, 0x06, 0x00, 0x28, 0x3C, 0x07, 0x28, 0x3B, 0x08, 0x28, 0x3A, 0x09, 0x28, 0x48, 0x0A, 0x28, 0x56, 0x0B, 0x14, 0x23, 0x64, 0x0C, 0x24, 0xA2,
+	0x0E, 0xB5, 0x0F, 0x01, 0x76, 0x0F, 0x04, 0x13, 0x14, 0x0F, 0x08, 0x33, 0x0F, 0x0B, 0x44, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x28, 0x0F, 0x11,
+	0x05, 0x28, 0x0F, 0x21, 0x04, 0x28, 0x0F, 0x31, 0x03, 0x28, 0x3F, 0x04, 0x00, 0x28, 0x3E, 0x05, 0x00, 0x28, 0x3D, 0x06, 0x00, 0x28, 0x3C, 0x07, 0x28, 0x3B, 0x08, 0x28, 0x3A, 0x09, 0x28, 0x48,
+	0x0A, 0x28, 0x56, 0x0B, 0x28, 0x64, 0x0C, 0xA8, 0x0E, 0xA5, 0x0F, 0x02, 0x24, 0x32, 0x0F, 0x06, 0x14, 0x14, 0x0F, 0x07, 0x00, 0x24, 0x22, 0x0F, 0x07, 0x45, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x0F,
+	0x14, 0x0C, 0x0F, 0x33, 0x0B, 0x0F, 0x52, 0x0A, 0x0F, 0x41, 0x0C, 0x4F, 0x0D, 0x3E, 0x0F, 0x4C, 0x0F, 0x01, 0x4B, 0x0F, 0x02, 0x4A, 0x0F, 0x03, 0x49, 0x0F, 0x04, 0x39, 0x0F, 0x05, 0x49, 0x0F,
+	0x04, 0x3A, 0x0F, 0x04, 0x4B, 0x0F, 0x02, 0x4C, 0x0F, 0x01, 0x4D, 0x0F, 0x4E, 0x0E, 0x4F, 0x0D, 0x0F, 0x41, 0x0C, 0x0F, 0x42, 0x0B, 0x0F, 0x43, 0x0A, 0x0F, 0x44, 0x09, 0x0F, 0x55, 0x07, 0x0F,
+	0x47, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x19, 0x07, 0x0F, 0x15, 0x0B, 0x0F, 0x34, 0x0A, 0x0F, 0x53, 0x09, 0x0F, 0x42, 0x0B, 0x0F, 0x41, 0x0C, 0x3F, 0x0E, 0x3E, 0x0F, 0x3D, 0x0F, 0x01, 0x3C, 0x0F,
+	0x02, 0x3B, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x3B, 0x0F, 0x03, 0x2C, 0x0F, 0x03, 0x4C, 0x0F, 0x01, 0x4D, 0x0F, 0x4E, 0x0E, 0x4F, 0x0D, 0x1A, 0x45, 0x0C, 0x39, 0x45, 0x0B, 0x3A, 0x45, 0x0A, 0x2C,
+	0x45, 0x09, 0x18, 0x14, 0x46, 0x08, 0x38, 0x5A, 0x06, 0x39, 0x4B, 0x05, 0x1B, 0x3C, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x0F, 0x02, 0x0F, 0x24, 0x0B, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x0F, 0x41,
+	0x0C, 0x4F, 0x0D, 0x4E, 0x0E, 0x3D, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x00, 0x3B, 0x0F, 0x03, 0x3C, 0x0F, 0x02, 0x3D, 0x0F, 0x01, 0x3E, 0x0F, 0x3F, 0x0E, 0x0F,
+	0x31, 0x0D, 0x39, 0x45, 0x0B, 0x18, 0x13, 0x45, 0x0A, 0x17, 0x15, 0x45, 0x09, 0x17, 0x15, 0x46, 0x08, 0x17, 0x15, 0x47, 0x07, 0x18, 0x13, 0x49, 0x06, 0x39, 0x4B, 0x05, 0x0F, 0x29, 0x06, 0x0F,
+	0x0F, 0x02, 0x00, 0x2A, 0x1B, 0x08, 0x2A, 0x49, 0x07, 0x2A, 0x48, 0x08, 0x2A, 0x56, 0x09, 0x2A, 0x45, 0x0B, 0x2A, 0x44, 0x0C, 0x2A, 0x24, 0x0E, 0x2A, 0x2F, 0x03, 0x00, 0x00, 0x00, 0xF5, 0x90,
+	0x03, 0xF5, 0x80, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x2A, 0x15, 0x0E, 0x2A, 0x34, 0x0D, 0x2A, 0x45, 0x0B, 0x2A, 0x56, 0x09, 0x2A, 0x48, 0x08, 0x2A, 0x49, 0x07, 0x0F, 0x18, 0x08, 0x0F,
+	0x0F, 0x02, 0x2B, 0x2A, 0x07, 0x2B, 0x39, 0x07, 0x2B, 0x38, 0x08, 0x2B, 0x46, 0x09, 0x2B, 0x45, 0x0A, 0x2B, 0x43, 0x0C, 0x2B, 0x24, 0x0D, 0x2B, 0x2E, 0x03, 0x00, 0x00, 0x00, 0xF6, 0x80, 0x03,
+	0xF6, 0x70, 0x04, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x2B, 0x14, 0x0E, 0x16, 0x24, 0x43, 0x0C, 0x45, 0x22, 0x44, 0x0B, 0x37, 0x21, 0x46, 0x09, 0x15, 0x13, 0x21, 0x57, 0x07, 0x25, 0x24, 0x39,
+	0x07, 0x36, 0x1E, 0x08, 0x27, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x2B, 0x2A, 0x07, 0x2B, 0x39, 0x07, 0x2B, 0x38, 0x08, 0x2B, 0x46, 0x09, 0x2B, 0x45, 0x0A, 0x2B, 0x43, 0x0C, 0x2B, 0x24, 0x0D, 0x2B,
+	0x2E, 0x03, 0x00, 0x00, 0x00, 0xF6, 0x80, 0x03, 0xF6, 0x70, 0x04, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x24, 0x0D, 0x45, 0x22, 0x43, 0x0C, 0x24, 0x22, 0x21, 0x35, 0x0B, 0x14, 0x14,
+	0x21, 0x46, 0x09, 0x14, 0x14, 0x21, 0x57, 0x07, 0x24, 0x22, 0x21, 0x39, 0x07, 0x45, 0x1E, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x28, 0x26, 0x0E, 0x28, 0x36, 0x0D,
+	0x00, 0x28, 0x37, 0x0C, 0x28, 0x38, 0x0B, 0x28, 0x39, 0x0A, 0x28, 0x3A, 0x09, 0x28, 0x4A, 0x08, 0x28, 0x69, 0x07, 0x28, 0x38, 0x32, 0x06, 0x28, 0x37, 0x34, 0x05, 0x28, 0x36, 0x46, 0x03, 0x28,
+	0x35, 0x28, 0x04, 0x28, 0x34, 0x1A, 0x04, 0x28, 0x42, 0x0F, 0x01, 0x28, 0x41, 0x0F, 0x02, 0x68, 0x0F, 0x03, 0x58, 0x0F, 0x04, 0x38, 0x0F, 0x06, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00,
+	0x00, 0x0F, 0x28, 0x07, 0x0F, 0x37, 0x07, 0x2E, 0x27, 0x07, 0x17, 0x26, 0x27, 0x07, 0x26, 0x26, 0x27, 0x07, 0x36, 0x35, 0x36, 0x06, 0x36, 0x26, 0x36, 0x06, 0x27, 0x26, 0x27, 0x06, 0x00, 0x27,
+	0x36, 0x36, 0x05, 0x37, 0x35, 0x36, 0x05, 0x37, 0x26, 0x27, 0x05, 0x28, 0x26, 0x27, 0x05, 0x28, 0x36, 0x36, 0x04, 0x38, 0x35, 0x36, 0x04, 0x38, 0x26, 0x27, 0x04, 0x29, 0x36, 0x36, 0x03, 0x39,
+	0x1F, 0x04, 0x29, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x0F, 0x2A, 0x05, 0x00, 0x00, 0x00, 0x0F, 0x39, 0x05, 0x0F, 0x66, 0x05, 0x0F, 0x93, 0x05, 0x8F, 0x12, 0x06, 0x8C, 0x24, 0x06, 0x89, 0x27, 0x06,
+	0x86, 0x2A, 0x06, 0x56, 0x2D, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x0F, 0x12, 0x26, 0x06, 0x0F, 0x22, 0x25, 0x06, 0x0F, 0x51, 0x32, 0x06, 0x0F, 0x43, 0x21, 0x07, 0x0F,
+	0x64, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x58, 0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x2B, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x00, 0x1C, 0x3C, 0x04, 0x3A, 0x2C, 0x05, 0x3B,
+	0x3A, 0x05, 0x3B, 0x39, 0x06, 0x3C, 0x37, 0x07, 0x3D, 0x45, 0x07, 0x3E, 0x43, 0x08, 0x3E, 0x42, 0x09, 0x7F, 0x0A, 0x0F, 0x51, 0x0B, 0x5F, 0x0C, 0x8D, 0x0B, 0x5C, 0x41, 0x0A, 0x69, 0x44, 0x09,
+	0x76, 0x47, 0x08, 0x56, 0x4A, 0x07, 0x17, 0x4E, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x19, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x28, 0x26, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xF8, 0x30, 0x06, 0xF8, 0x40, 0x05, 0x28, 0x26, 0x37, 0x04, 0x28, 0x26, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x28, 0x04, 0x0F, 0x21, 0x0E, 0x0F, 0x0F, 0x02,
+	0x00, 0x00, 0x0F, 0x21, 0x0E, 0x0F, 0x31, 0x0D, 0x0F, 0x21, 0x0E, 0x00, 0x1A, 0x25, 0x0E, 0x4A, 0x22, 0x0E, 0x8A, 0x0E, 0x8D, 0x0B, 0x9F, 0x08, 0x2F, 0x83, 0x04, 0x2F, 0x76, 0x02, 0x2F, 0x49,
+	0x02, 0x2E, 0x0F, 0x01, 0x2E, 0x24, 0x0A, 0x2E, 0x33, 0x0A, 0x2E, 0x32, 0x0B, 0x2E, 0x31, 0x0C, 0x2D, 0x31, 0x0D, 0x5D, 0x0E, 0x3D, 0x0F, 0x01, 0x1E, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x2D, 0x0F,
+	0x02, 0x00, 0x00, 0x3C, 0x0F, 0x02, 0x2C, 0x0F, 0x03, 0x15, 0x26, 0x0F, 0x03, 0x45, 0x23, 0x0F, 0x03, 0x95, 0x0F, 0x03, 0x97, 0x0F, 0x01, 0x9B, 0x0C, 0x2B, 0x91, 0x09, 0x2B, 0x95, 0x05, 0x2B,
+	0x88, 0x03, 0x2B, 0x4C, 0x03, 0x3A, 0x1F, 0x03, 0x2A, 0x16, 0x0D, 0x2A, 0x25, 0x0D, 0x2A, 0x44, 0x0C, 0x2A, 0x43, 0x0D, 0x39, 0x32, 0x0F, 0x29, 0x32, 0x0F, 0x01, 0x69, 0x0F, 0x02, 0x59, 0x0F,
+	0x03, 0x39, 0x0F, 0x05, 0x29, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x2B, 0x04, 0x00, 0x00, 0x2E, 0x2A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x48, 0x04,
+	0x2E, 0xB1, 0x04, 0xEE, 0x04, 0x7E, 0x25, 0x04, 0x0F, 0x2B, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x29, 0x2D, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x69, 0x06, 0x29, 0xC3, 0x06, 0xF9, 0x20, 0x06, 0x99, 0x26, 0x06, 0x29, 0x2D, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x2C, 0x2C, 0x04, 0x2C, 0x25, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x20, 0x03, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x28, 0x2F,
+	0x05, 0x28, 0x26, 0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x50, 0x04, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2D, 0x0F, 0x02,
+	0x00, 0x00, 0x27, 0x24, 0x0F, 0x02, 0x00, 0x27, 0x24, 0x2B, 0x04, 0x27, 0x24, 0x3B, 0x03, 0x27, 0x24, 0x2B, 0x04, 0x27, 0x24, 0x3A, 0x04, 0x27, 0x24, 0x2A, 0x05, 0x27, 0x24, 0x39, 0x05, 0x00,
+	0x27, 0x24, 0x38, 0x06, 0x27, 0x24, 0x37, 0x07, 0x27, 0x24, 0x46, 0x07, 0x27, 0x24, 0x45, 0x08, 0x27, 0x24, 0x44, 0x09, 0x27, 0x24, 0x51, 0x0B, 0x27, 0x74, 0x0C, 0x5D, 0x0E, 0x2D, 0x0F, 0x02,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x0C, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x00, 0x0F, 0x2B, 0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x0F,
+	0x38, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x64, 0x07, 0xF6, 0x20, 0x09, 0xE6, 0x0C, 0x0F, 0x0F, 0x02, 0x0F, 0x1B, 0x05, 0x0F, 0x2A, 0x05, 0x0F, 0x49, 0x04, 0x0F, 0x48, 0x05, 0x0F, 0x46, 0x07, 0x0F,
+	0x63, 0x08, 0xF6, 0x10, 0x0A, 0xC6, 0x0E, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x60, 0x05, 0xF6, 0x70, 0x04, 0x0F, 0x39, 0x05, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x37,
+	0x07, 0x0F, 0x27, 0x08, 0x0F, 0x36, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x34, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x14, 0x0C, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x60, 0x05, 0xF6, 0x70,
+	0x04, 0x0F, 0x2A, 0x05, 0x0F, 0x39, 0x05, 0x00, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x00, 0x0F, 0x37, 0x07, 0x00, 0x0F, 0x36, 0x08, 0x00, 0x0F, 0x35, 0x09, 0x0F, 0x34, 0x0A, 0x0F, 0x24, 0x0B,
+	0x0F, 0x33, 0x0B, 0x0F, 0x32, 0x0C, 0x4F, 0x0D, 0x0F, 0x21, 0x0E, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xF8, 0x50, 0x04, 0x00, 0x28, 0x2E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x50, 0x04, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x0B, 0x00, 0x2D, 0x0F, 0x02, 0x00, 0x2D, 0x2D, 0x02, 0x2D, 0x3D, 0x01, 0x2D,
+	0x2D, 0x02, 0x2D, 0x3C, 0x02, 0x2D, 0x2C, 0x03, 0x2D, 0x3B, 0x03, 0x2D, 0x3A, 0x04, 0x2D, 0x39, 0x05, 0x2D, 0x38, 0x06, 0x2D, 0x46, 0x07, 0x2D, 0x63, 0x08, 0x9D, 0x0A, 0x7D, 0x0C, 0x3D, 0x0F,
+	0x01, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xA8, 0x0E, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x28, 0x0F, 0x12, 0x04, 0x00, 0x28, 0x0F, 0x31, 0x03, 0x00, 0x28, 0x3F, 0x04, 0x00, 0x28, 0x3E, 0x05, 0x00, 0x28,
+	0x3D, 0x06, 0x28, 0x3C, 0x07, 0x28, 0x3B, 0x08, 0x28, 0x49, 0x09, 0x28, 0x57, 0x0A, 0x28, 0x83, 0x0B, 0xB8, 0x0D, 0x88, 0x0F, 0x01, 0x29, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x26, 0x09,
+	0x2A, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x09, 0x00, 0x2A, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x80, 0x03, 0x00, 0x2A, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0x0F, 0x02, 0x00, 0x0F, 0x2A, 0x05, 0x28, 0x2F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xF2, 0x05, 0x00, 0x28, 0x2F, 0x05, 0x00, 0x28, 0x16, 0x28, 0x05, 0x28, 0x25, 0x28,
+	0x05, 0x28, 0x44, 0x27, 0x05, 0x28, 0x33, 0x29, 0x05, 0x28, 0x41, 0x2A, 0x05, 0x68, 0x2B, 0x05, 0x48, 0x2D, 0x05, 0x38, 0x2E, 0x05, 0x18, 0x0F, 0x21, 0x05, 0x0F, 0x2A, 0x05, 0x0F, 0x0F, 0x02,
+	0x00, 0x00, 0x00, 0x27, 0x0F, 0x08, 0x27, 0x26, 0x0F, 0x00, 0x27, 0x26, 0x1A, 0x04, 0x27, 0x26, 0x2A, 0x03, 0x27, 0x26, 0x39, 0x03, 0x00, 0x27, 0x26, 0x29, 0x04, 0x27, 0x26, 0x38, 0x04, 0x27,
+	0x26, 0x28, 0x05, 0x27, 0x26, 0x37, 0x05, 0x27, 0x26, 0x36, 0x06, 0x27, 0x26, 0x35, 0x07, 0x27, 0x26, 0x34, 0x08, 0x27, 0x26, 0x43, 0x08, 0x27, 0x26, 0x41, 0x0A, 0x27, 0x66, 0x0B, 0x27, 0x83,
+	0x0C, 0xB7, 0x0E, 0x77, 0x0F, 0x03, 0x18, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x1B, 0x05, 0x18, 0x0F, 0x32, 0x03, 0x37, 0x0F, 0x31, 0x03, 0x38, 0x3F, 0x03, 0x48, 0x2E, 0x04, 0x39,
+	0x3D, 0x04, 0x3A, 0x3C, 0x04, 0x3B, 0x2B, 0x05, 0x3C, 0x39, 0x05, 0x1D, 0x2A, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x00, 0x0F, 0x36, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x44, 0x09, 0x0F, 0x43,
+	0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x41, 0x0C, 0x4F, 0x0D, 0x5D, 0x0E, 0x4C, 0x0F, 0x01, 0x2D, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x9A, 0x0D, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x2A, 0x1F,
+	0x04, 0x2A, 0x2F, 0x03, 0x2A, 0x3E, 0x03, 0x00, 0x75, 0x2E, 0x04, 0x75, 0x3D, 0x04, 0x2A, 0x3C, 0x05, 0x2A, 0x4B, 0x05, 0x2A, 0x4A, 0x06, 0x2A, 0x49, 0x07, 0x2A, 0x48, 0x08, 0x15, 0x24, 0x56,
+	0x09, 0x34, 0x23, 0x63, 0x0B, 0x36, 0x91, 0x0D, 0x27, 0x71, 0x0F, 0x24, 0x34, 0x0F, 0x04, 0x43, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2F, 0x2A,
+	0x03, 0x00, 0x2F, 0x39, 0x03, 0x2F, 0x38, 0x04, 0x2F, 0x46, 0x05, 0x2F, 0x45, 0x06, 0x2F, 0x61, 0x08, 0xBB, 0x0A, 0x7B, 0x0E, 0x2F, 0x2A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x66, 0x03,
+	0xDF, 0x04, 0x8F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x15, 0x0B, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x0F, 0x41, 0x0C, 0x4F, 0x0D, 0x5C, 0x2B, 0x02, 0x7A, 0x2B, 0x02, 0x2B, 0x22, 0x3A,
+	0x02, 0x2F, 0x39, 0x03, 0x2F, 0x38, 0x04, 0x2F, 0x46, 0x05, 0x2F, 0x63, 0x06, 0x9F, 0x08, 0x5F, 0x0C, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xA9, 0x0D, 0x00,
+	0x29, 0x0F, 0x06, 0x00, 0x29, 0x0F, 0x12, 0x03, 0x00, 0x29, 0x0F, 0x31, 0x02, 0x00, 0x29, 0x0F, 0x21, 0x03, 0x29, 0x3F, 0x03, 0x29, 0x3E, 0x04, 0x00, 0x29, 0x3D, 0x05, 0x29, 0x3C, 0x06, 0x29,
+	0x3B, 0x07, 0x29, 0x49, 0x08, 0x15, 0x23, 0x57, 0x09, 0x44, 0x21, 0x83, 0x0A, 0x26, 0xB1, 0x0C, 0x17, 0x81, 0x0F, 0x14, 0x25, 0x0F, 0x05, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x17, 0x0F, 0x09,
+	0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x26, 0x09, 0x2A, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x09, 0x00, 0x2A, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x80, 0x03, 0x00, 0x2A, 0x29,
+	0x09, 0x00, 0x25, 0x23, 0x29, 0x09, 0x36, 0x21, 0x29, 0x09, 0x18, 0x21, 0x29, 0x09, 0x24, 0x24, 0x29, 0x09, 0x35, 0x0F, 0x09, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x2A, 0x05, 0x29,
+	0x2E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xE2, 0x05, 0x00, 0x29, 0x2E, 0x05, 0x00, 0x29, 0x15, 0x28, 0x05, 0x29, 0x34, 0x27, 0x05, 0x00, 0x15, 0x23, 0x33, 0x28, 0x05,
+	0x44, 0x21, 0x41, 0x29, 0x05, 0x26, 0x61, 0x2A, 0x05, 0x17, 0x41, 0x2C, 0x05, 0x24, 0x33, 0x2D, 0x05, 0x44, 0x11, 0x2F, 0x05, 0x16, 0x0F, 0x23, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x28, 0x0F, 0x07,
+	0x28, 0x26, 0x0E, 0x00, 0x28, 0x26, 0x1A, 0x03, 0x28, 0x26, 0x2A, 0x02, 0x28, 0x26, 0x39, 0x02, 0x00, 0x28, 0x26, 0x29, 0x03, 0x28, 0x26, 0x38, 0x03, 0x28, 0x26, 0x28, 0x04, 0x28, 0x26, 0x37,
+	0x04, 0x28, 0x26, 0x36, 0x05, 0x28, 0x26, 0x35, 0x06, 0x28, 0x26, 0x44, 0x06, 0x28, 0x26, 0x43, 0x07, 0x28, 0x26, 0x42, 0x08, 0x14, 0x23, 0x66, 0x0A, 0x24, 0x22, 0x74, 0x0B, 0xF4, 0x0D, 0x16,
+	0x81, 0x0F, 0x01, 0x13, 0x34, 0x0F, 0x06, 0x33, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x0D, 0x6E,
+	0x0C, 0x00, 0x00, 0x00, 0x4F, 0x0D, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0F, 0x04, 0x3B, 0x0F, 0x03, 0x4B, 0x0F, 0x02, 0x4C, 0x0F, 0x01, 0x4D, 0x0F, 0x4E, 0x0E, 0x4F, 0x0D, 0x0F,
+	0x42, 0x0B, 0x0F, 0x43, 0x0A, 0x0F, 0x44, 0x09, 0x0F, 0x55, 0x07, 0x0F, 0x36, 0x08, 0x0F, 0x18, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0F, 0x04, 0x2C, 0x0F, 0x03,
+	0x4B, 0x0F, 0x02, 0x3D, 0x0F, 0x01, 0x3E, 0x0F, 0x4E, 0x0E, 0x4F, 0x0D, 0x0F, 0x41, 0x0C, 0x19, 0x38, 0x0B, 0x48, 0x47, 0x09, 0x3A, 0x47, 0x08, 0x1C, 0x48, 0x07, 0x27, 0x2D, 0x08, 0x47, 0x0F,
+	0x06, 0x39, 0x0F, 0x05, 0x1B, 0x0F, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+	0x90, 0x02, 0x00,
+};
+
+#elif USE_CYRILLIC_CHARACTERS
+
+extern const uint8_t glcd28x32_packed[] =
+{
+	28,			// character width in pixels
+	32,			// row height in pixels
+	3,			// space columns between characters before kerning
+	3,			// font format: sparse packed
+	0x20, 0x00,	// lowest character code (2 bytes, little endian)
+	0x91, 0x04,	// highest character code (2 bytes, little endian)
+
+	// Number of ranges, then the first code, last code and first glyph of each range (2 bytes each, little endian)
+	0x02, 0x00,
+	0x20, 0x00, 0x7F, 0x01, 0x00, 0x00,
+	0x01, 0x04, 0x91, 0x04, 0x60, 0x01,
+
+	// Number of edge columns (2 bytes, little endian), then the edge columns
+	0xC6, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x8F, 0x03, 0xC0, 0x7F, 0x80, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xE0, 0xFF, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0x00, 0x80, 0x33, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x03, 0x60, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x00,
+	0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x1C, 0x80, 0x33,
+	0x00, 0x1C, 0x80, 0x3F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0xC0, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0xFF, 0x1F, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+	0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x07, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0xF0, 0xFF, 0x03, 0x60, 0xFC, 0xFF, 0x03,
+	0x60, 0xFC, 0xFF, 0x1F, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x40, 0xC0, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0xFC, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x01,
+	0x00, 0x00, 0x03, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x1C, 0xFE, 0x7F, 0x00, 0x1C, 0xFF, 0x7F, 0x00, 0x18, 0x38, 0x00,
+	0x00, 0x80, 0x01, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xEC, 0x37, 0x00, 0xE0, 0xFF, 0xE0, 0xFF, 0x00, 0x83, 0x03, 0x03, 0x80, 0xC1, 0xE7, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x01, 0x03, 0x00, 0x80, 0x0F, 0x02, 0x00,
+	0x80, 0x81, 0x01, 0x00, 0x80, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x0F, 0x02,
+	0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x00, 0x20, 0xC0, 0x01, 0x00,
+	0x00, 0xF0, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC2,
+	0x00, 0x00, 0x00, 0xC3, 0x00, 0x06, 0x70, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0xC7, 0x00, 0x00, 0xE0, 0x07, 0x00,
+	0x00, 0x06, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0xC0, 0xFF, 0xFF, 0xC3, 0x60, 0xFC, 0xFF, 0xC3, 0xCC, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x00, 0x60, 0xFC, 0xFF, 0x3F, 0xCC, 0xFF, 0x7F, 0x00, 0x80, 0x01, 0x00, 0xC0, 0x00, 0x04, 0x00, 0x02,
+	0xE4, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x9B, 0xE0, 0xFF, 0xFF, 0x7B, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xC0, 0x11, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x3F,
+	0x00, 0xF0, 0xFF, 0x00, 0x30, 0xF0, 0xFF, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x9B, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x38, 0xFC, 0x01, 0x00, 0x20, 0x78, 0x00, 0x00, 0x0C, 0x03, 0x00,
+	0x00, 0x0C, 0x03, 0x03, 0xC0, 0xFF, 0x7F, 0x00, 0x30, 0xFC, 0xFF, 0x03, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0x00,
+	0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0C, 0x7C, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x04, 0x40, 0x00,
+	0x00, 0x3C, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x60, 0xF8, 0x00, 0x00, 0xE0, 0xF8, 0x00, 0x00, 0x80, 0xC7, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x60, 0xC0, 0x00, 0x00, 0xE0, 0xF0, 0x00,
+	0x00, 0xF8, 0xFF, 0x03, 0x00, 0xC0, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x7F, 0x20, 0x18, 0x00, 0x00, 0x00, 0xE0, 0xC1, 0x00, 0x00, 0x60, 0xF0, 0x00, 0xC0, 0xF8, 0xFF, 0x03,
+	0xC0, 0xF8, 0xFF, 0x7F, 0x00, 0xE0, 0xFF, 0x03, 0xC0, 0x02, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00,
+
+	// Width, leading edge and trailing edge of each glyph
+	0x0B, 0x00, 0x00, 0x03, 0x01, 0x02, 0x08, 0x03, 0x03, 0x10, 0x04, 0x05, 0x10, 0x06, 0x07, 0x18, 0x08, 0x09, 0x12, 0x0A, 0x0B, 0x02, 0x03, 0x03, 0x07, 0x0C, 0x0D, 0x07, 0x0D, 0x0C,
+	0x0B, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x02, 0x10, 0x11, 0x08, 0x12, 0x12, 0x02, 0x13, 0x13, 0x08, 0x0B, 0x14, 0x0E, 0x15, 0x15, 0x0D, 0x0B, 0x0B, 0x0E, 0x0B, 0x0B, 0x0E, 0x06, 0x16,
+	0x0E, 0x17, 0x04, 0x0E, 0x06, 0x18, 0x0D, 0x19, 0x1A, 0x0E, 0x1B, 0x1B, 0x0E, 0x16, 0x16, 0x0E, 0x1C, 0x1D, 0x02, 0x1E, 0x1E, 0x02, 0x1F, 0x20, 0x0F, 0x21, 0x22, 0x0F, 0x23, 0x23,
+	0x0F, 0x22, 0x21, 0x0E, 0x24, 0x25, 0x19, 0x26, 0x0F, 0x13, 0x27, 0x27, 0x0F, 0x28, 0x09, 0x13, 0x0F, 0x06, 0x12, 0x28, 0x29, 0x10, 0x28, 0x0B, 0x0F, 0x28, 0x1B, 0x14, 0x0F, 0x2A,
+	0x11, 0x28, 0x28, 0x03, 0x28, 0x28, 0x0D, 0x07, 0x2B, 0x10, 0x28, 0x27, 0x0D, 0x28, 0x0B, 0x13, 0x28, 0x28, 0x11, 0x28, 0x28, 0x15, 0x29, 0x2C, 0x0F, 0x28, 0x2D, 0x15, 0x29, 0x2C,
+	0x11, 0x28, 0x2E, 0x11, 0x06, 0x16, 0x11, 0x1B, 0x1B, 0x11, 0x2F, 0x2F, 0x13, 0x30, 0x30, 0x1C, 0x31, 0x31, 0x11, 0x27, 0x27, 0x11, 0x30, 0x30, 0x10, 0x13, 0x0B, 0x06, 0x32, 0x0D,
+	0x08, 0x14, 0x0B, 0x06, 0x0D, 0x32, 0x0E, 0x33, 0x33, 0x10, 0x34, 0x34, 0x06, 0x35, 0x36, 0x0F, 0x37, 0x0B, 0x0D, 0x38, 0x39, 0x0D, 0x39, 0x3A, 0x0D, 0x39, 0x38, 0x0E, 0x39, 0x3B,
+	0x08, 0x24, 0x3C, 0x0D, 0x39, 0x3D, 0x0C, 0x38, 0x3E, 0x03, 0x3F, 0x3F, 0x05, 0x34, 0x40, 0x0C, 0x38, 0x27, 0x03, 0x38, 0x38, 0x15, 0x41, 0x3E, 0x0C, 0x41, 0x3E, 0x0E, 0x39, 0x39,
+	0x0D, 0x42, 0x39, 0x0D, 0x39, 0x42, 0x08, 0x41, 0x24, 0x0D, 0x43, 0x44, 0x08, 0x24, 0x45, 0x0C, 0x46, 0x41, 0x0D, 0x0E, 0x0E, 0x15, 0x24, 0x24, 0x0B, 0x45, 0x45, 0x0D, 0x0E, 0x0E,
+	0x0C, 0x0B, 0x0B, 0x09, 0x12, 0x0D, 0x02, 0x32, 0x32, 0x09, 0x0D, 0x12, 0x0F, 0x21, 0x2C, 0x05, 0x47, 0x47, 0x03, 0x00, 0x00, 0x1A, 0x48, 0x48, 0x0C, 0x49, 0x49, 0x1A, 0x48, 0x48,
+	0x0C, 0x4A, 0x4A, 0x0E, 0x4B, 0x4B, 0x0E, 0x4C, 0x4C, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x4D, 0x4E,
+	0x0C, 0x15, 0x4F, 0x0E, 0x50, 0x51, 0x0C, 0x52, 0x52, 0x10, 0x30, 0x30, 0x02, 0x53, 0x53, 0x0C, 0x54, 0x55, 0x08, 0x49, 0x49, 0x15, 0x0F, 0x0F, 0x0B, 0x56, 0x57, 0x0E, 0x58, 0x59,
+	0x0F, 0x0F, 0x5A, 0x08, 0x12, 0x12, 0x15, 0x0F, 0x0F, 0x10, 0x5B, 0x5B, 0x08, 0x5C, 0x5C, 0x0E, 0x5D, 0x5D, 0x08, 0x5E, 0x5F, 0x08, 0x60, 0x61, 0x06, 0x36, 0x35, 0x0E, 0x42, 0x0B,
+	0x0E, 0x25, 0x30, 0x02, 0x3B, 0x3B, 0x05, 0x34, 0x62, 0x08, 0x63, 0x64, 0x0B, 0x65, 0x65, 0x0E, 0x59, 0x58, 0x16, 0x63, 0x66, 0x16, 0x63, 0x67, 0x15, 0x60, 0x66, 0x0E, 0x68, 0x69,
+	0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x1B, 0x0B, 0x0B, 0x13, 0x0F, 0x06, 0x10, 0x28, 0x0B, 0x10, 0x28, 0x0B,
+	0x10, 0x28, 0x0B, 0x10, 0x28, 0x0B, 0x06, 0x6A, 0x6B, 0x06, 0x6C, 0x6A, 0x08, 0x6D, 0x6B, 0x07, 0x6D, 0x6D, 0x14, 0x0F, 0x29, 0x11, 0x28, 0x28, 0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C,
+	0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C, 0x0D, 0x6E, 0x6E, 0x15, 0x29, 0x6F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x30, 0x30,
+	0x0F, 0x28, 0x70, 0x0F, 0x71, 0x72, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x18, 0x73, 0x3B, 0x0D, 0x39, 0x3A,
+	0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x06, 0x74, 0x75, 0x06, 0x75, 0x74, 0x0A, 0x75, 0x75, 0x08, 0x1B, 0x1B, 0x0E, 0x26, 0x76, 0x0C, 0x41, 0x3E,
+	0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x0F, 0x0F, 0x10, 0x27, 0x0E, 0x0C, 0x46, 0x41, 0x0C, 0x46, 0x41, 0x0C, 0x46, 0x41,
+	0x0C, 0x46, 0x41, 0x0D, 0x0E, 0x0E, 0x0D, 0x32, 0x39, 0x0D, 0x0E, 0x0E, 0x13, 0x27, 0x27, 0x0F, 0x73, 0x0B, 0x13, 0x27, 0x27, 0x0F, 0x73, 0x0B, 0x13, 0x27, 0x77, 0x0F, 0x73, 0x78,
+	0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x11, 0x28, 0x19, 0x10, 0x7A, 0x7C,
+	0x13, 0x0F, 0x19, 0x0E, 0x7A, 0x38, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x78, 0x0D, 0x7D, 0x7E,
+	0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81,
+	0x11, 0x28, 0x28, 0x0D, 0x38, 0x3E, 0x14, 0x82, 0x82, 0x0F, 0x49, 0x3E, 0x08, 0x6D, 0x6D, 0x08, 0x1B, 0x1B, 0x06, 0x83, 0x83, 0x06, 0x1B, 0x1B, 0x08, 0x84, 0x85, 0x08, 0x86, 0x87,
+	0x05, 0x62, 0x88, 0x05, 0x62, 0x89, 0x03, 0x8A, 0x8A, 0x03, 0x41, 0x41, 0x10, 0x28, 0x8B, 0x09, 0x3F, 0x8C, 0x0D, 0x06, 0x8D, 0x07, 0x8E, 0x49, 0x11, 0x28, 0x27, 0x0D, 0x38, 0x8F,
+	0x0D, 0x41, 0x8F, 0x0D, 0x28, 0x0B, 0x04, 0x90, 0x84, 0x0D, 0x28, 0x0B, 0x03, 0x91, 0x92, 0x0D, 0x28, 0x0B, 0x06, 0x38, 0x93, 0x0D, 0x28, 0x0B, 0x07, 0x38, 0x0F, 0x0F, 0x3B, 0x0B,
+	0x05, 0x94, 0x38, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x10, 0x95, 0x3E, 0x10, 0x28, 0x96, 0x0D, 0x41, 0x97,
+	0x13, 0x70, 0x19, 0x0D, 0x7A, 0x98, 0x13, 0x70, 0x19, 0x0D, 0x7A, 0x98, 0x13, 0x70, 0x19, 0x0D, 0x7A, 0x99, 0x1B, 0x70, 0x0B, 0x18, 0x7A, 0x7E, 0x12, 0x28, 0x27, 0x07, 0x41, 0x9A,
+	0x12, 0x28, 0x27, 0x06, 0x9B, 0x24, 0x12, 0x28, 0x27, 0x08, 0x74, 0x9A, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D,
+	0x10, 0x06, 0x9C, 0x0E, 0x66, 0x9E, 0x10, 0x1B, 0x1B, 0x08, 0x24, 0x45, 0x10, 0x1B, 0x1B, 0x0A, 0x24, 0x93, 0x10, 0x1B, 0x1B, 0x08, 0x9F, 0xA0, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41,
+	0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0xA2, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41,
+	0x1A, 0x1B, 0xA3, 0x14, 0x24, 0xA4, 0x12, 0x30, 0x1B, 0x0D, 0x0E, 0xA5, 0x12, 0x30, 0x1B, 0x10, 0x13, 0x0B, 0x0D, 0x13, 0x0B, 0x10, 0x13, 0x0B, 0x0D, 0x13, 0x0B, 0x10, 0x13, 0x0B,
+	0x0D, 0x13, 0x0B, 0x04, 0xA6, 0x14, 0x12, 0x00, 0x0B, 0x15, 0x49, 0xA7, 0x0E, 0x00, 0x49, 0x13, 0xA8, 0x6E, 0x11, 0xA9, 0xAA, 0x05, 0x00, 0xA6, 0x08, 0x5B, 0x5B, 0x0B, 0xA9, 0xAB,
+	0x1C, 0x0B, 0x0A, 0x1A, 0x00, 0x0A, 0x15, 0x49, 0xAC, 0x10, 0x00, 0xAD, 0x12, 0x00, 0xA6, 0x12, 0x75, 0x75, 0x11, 0x00, 0xA6, 0x12, 0x27, 0x27, 0x0F, 0x00, 0x0A, 0x11, 0x00, 0x0A,
+	0x0E, 0x00, 0x49, 0x12, 0xAE, 0xAE, 0x12, 0x00, 0x0B, 0x19, 0xAD, 0xAD, 0x0F, 0xAF, 0xB0, 0x11, 0x00, 0xA6, 0x11, 0x00, 0xA6, 0x10, 0x00, 0xAD, 0x0F, 0x0B, 0xA6, 0x14, 0x00, 0xA6,
+	0x11, 0x00, 0xA6, 0x14, 0xA8, 0xA8, 0x11, 0x00, 0xA6, 0x11, 0x00, 0xB1, 0x13, 0xA8, 0x6E, 0x0F, 0x49, 0x49, 0x12, 0x75, 0x75, 0x13, 0x7F, 0x7F, 0x11, 0xAD, 0xAD, 0x13, 0x00, 0xAE,
+	0x10, 0x00, 0xA6, 0x17, 0x00, 0xA6, 0x19, 0x00, 0xAE, 0x14, 0x49, 0x0A, 0x16, 0x00, 0xA6, 0x10, 0x00, 0x0A, 0x12, 0x6E, 0xA8, 0x1A, 0x00, 0xA8, 0x11, 0x27, 0xA6, 0x0E, 0xB2, 0x0B,
+	0x0F, 0x00, 0x26, 0x0C, 0x00, 0xB3, 0x0A, 0x00, 0x05, 0x0F, 0xAE, 0xAE, 0x0D, 0x76, 0xB4, 0x12, 0xB5, 0xB5, 0x0B, 0xB6, 0xB7, 0x0E, 0x00, 0xB8, 0x0E, 0x00, 0xB8, 0x0C, 0x00, 0xB5,
+	0x0E, 0x0B, 0xB8, 0x11, 0x00, 0xB8, 0x0D, 0x00, 0xB8, 0x0D, 0x76, 0x76, 0x0D, 0x00, 0xB8, 0x0E, 0x00, 0x7A, 0x0D, 0x76, 0xB9, 0x0C, 0x05, 0x05, 0x0E, 0x05, 0x05, 0x16, 0x76, 0x76,
+	0x0D, 0xB5, 0xB5, 0x10, 0x00, 0xAE, 0x0D, 0x00, 0xB8, 0x14, 0x00, 0xB8, 0x16, 0x00, 0xAE, 0x0F, 0x05, 0x73, 0x12, 0x00, 0xB8, 0x0D, 0x00, 0x73, 0x0C, 0xB6, 0x76, 0x13, 0x00, 0x76,
+	0x0D, 0x27, 0xB8, 0x12, 0x00, 0xA6, 0x0D, 0x76, 0xB4, 0x0E, 0xBA, 0xBB, 0x0A, 0x00, 0xBC, 0x0E, 0x76, 0x43, 0x0C, 0xBD, 0xBE, 0x04, 0x00, 0xBF, 0x08, 0x1B, 0x1B, 0x04, 0x34, 0xC0,
+	0x16, 0x0B, 0x73, 0x14, 0x00, 0x73, 0x0E, 0xBA, 0xC1, 0x0C, 0x00, 0xB5, 0x12, 0x00, 0xA6, 0x0E, 0x05, 0x05, 0x0D, 0x00, 0xB8, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6,
+	0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6,
+	0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6,
+	0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6,
+	0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x01, 0xC2, 0xC2, 0x01, 0xC3, 0xC3, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6,
+	0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x12, 0x00, 0xA6, 0x0D, 0x00, 0xC4, 0x0B, 0x00, 0xC5,
+
+	// Glyph offsets (2 bytes each, little endian)
+	0x00, 0x00, 0x0D, 0x00, 0x14, 0x00, 0x24, 0x00, 0x56, 0x00, 0x85, 0x00, 0xC9, 0x00, 0x07, 0x01, 0x0B, 0x01, 0x20, 0x01, 0x35, 0x01, 0x5A, 0x01, 0x6C, 0x01, 0x73, 0x01, 0x7D, 0x01, 0x81, 0x01,
+	0x97, 0x01, 0xB8, 0x01, 0xD3, 0x01, 0x04, 0x02, 0x2C, 0x02, 0x50, 0x02, 0x79, 0x02, 0xA1, 0x02, 0xC7, 0x02, 0xF0, 0x02, 0x1A, 0x03, 0x1E, 0x03, 0x25, 0x03, 0x49, 0x03, 0x5A, 0x03, 0x7E, 0x03,
+	0xAC, 0x03, 0x0A, 0x04, 0x3F, 0x04, 0x60, 0x04, 0x8F, 0x04, 0xB3, 0x04, 0xCD, 0x04, 0xE2, 0x04, 0x1B, 0x05, 0x31, 0x05, 0x36, 0x05, 0x5A, 0x05, 0x85, 0x05, 0x96, 0x05, 0xC3, 0x05, 0xEB, 0x05,
+	0x1B, 0x06, 0x35, 0x06, 0x76, 0x06, 0x9A, 0x06, 0xD1, 0x06, 0xE8, 0x06, 0x11, 0x07, 0x44, 0x07, 0x8E, 0x07, 0xBE, 0x07, 0xEC, 0x07, 0x25, 0x08, 0x2E, 0x08, 0x44, 0x08, 0x4D, 0x08, 0x75, 0x08,
+	0x86, 0x08, 0x98, 0x08, 0xC4, 0x08, 0xE2, 0x08, 0x00, 0x09, 0x1E, 0x09, 0x44, 0x09, 0x55, 0x09, 0x79, 0x09, 0x8F, 0x09, 0x95, 0x09, 0xA3, 0x09, 0xC3, 0x09, 0xC8, 0x09, 0xF8, 0x09, 0x11, 0x0A,
+	0x2F, 0x0A, 0x4C, 0x0A, 0x69, 0x0A, 0x7A, 0x0A, 0xA2, 0x0A, 0xB1, 0x0A, 0xC8, 0x0A, 0xEB, 0x0A, 0x22, 0x0B, 0x41, 0x0B, 0x65, 0x0B, 0x8E, 0x0B, 0xA3, 0x0B, 0xA6, 0x0B, 0xBB, 0x0B, 0xD4, 0x0B,
+	0xE0, 0x0B, 0xE5, 0x0B, 0x0F, 0x0C, 0x31, 0x0C, 0x5B, 0x0C, 0x7D, 0x0C, 0xAD, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C,
+	0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C,
+	0xD7, 0x0C, 0xDA, 0x0C, 0xE1, 0x0C, 0x00, 0x0D, 0x27, 0x0D, 0x45, 0x0D, 0x7C, 0x0D, 0x7F, 0x0D, 0xB3, 0x0D, 0xC1, 0x0D, 0x06, 0x0E, 0x2A, 0x0E, 0x54, 0x0E, 0x73, 0x01, 0x65, 0x0E, 0xA8, 0x0E,
+	0xBA, 0x0E, 0xCF, 0x0E, 0xE3, 0x0E, 0xFF, 0x0E, 0x17, 0x0F, 0x27, 0x0F, 0x45, 0x0F, 0x61, 0x0F, 0x65, 0x0F, 0x70, 0x0F, 0x81, 0x0F, 0x9F, 0x0F, 0xC9, 0x0F, 0x0B, 0x10, 0x56, 0x10, 0x9B, 0x10,
+	0xC9, 0x10, 0x04, 0x11, 0x3F, 0x11, 0x7D, 0x11, 0xBC, 0x11, 0xF5, 0x11, 0x30, 0x12, 0x69, 0x12, 0xA2, 0x12, 0xCF, 0x12, 0xFC, 0x12, 0x39, 0x13, 0x61, 0x13, 0x74, 0x13, 0x84, 0x13, 0x9C, 0x13,
+	0xA9, 0x13, 0xD3, 0x13, 0x03, 0x14, 0x44, 0x14, 0x81, 0x14, 0xC5, 0x14, 0x02, 0x15, 0x3B, 0x15, 0x5F, 0x15, 0xA6, 0x15, 0xDA, 0x15, 0x0E, 0x16, 0x48, 0x16, 0x79, 0x16, 0xAD, 0x16, 0xC6, 0x16,
+	0xF8, 0x16, 0x2D, 0x17, 0x62, 0x17, 0x9B, 0x17, 0xCF, 0x17, 0xFF, 0x17, 0x39, 0x18, 0x7A, 0x18, 0x9D, 0x18, 0xD2, 0x18, 0x07, 0x19, 0x3C, 0x19, 0x69, 0x19, 0x7E, 0x19, 0x93, 0x19, 0xB1, 0x19,
+	0xC1, 0x19, 0xF0, 0x19, 0x15, 0x1A, 0x3F, 0x1A, 0x69, 0x1A, 0x94, 0x1A, 0xBE, 0x1A, 0xE2, 0x1A, 0xF5, 0x1A, 0x27, 0x1B, 0x4A, 0x1B, 0x6C, 0x1B, 0x92, 0x1B, 0xAF, 0x1B, 0xD5, 0x1B, 0xF2, 0x1B,
+	0x19, 0x1C, 0x56, 0x1C, 0x89, 0x1C, 0xC7, 0x1C, 0xFF, 0x1C, 0x35, 0x1D, 0x62, 0x1D, 0xA0, 0x1D, 0xC7, 0x1D, 0x08, 0x1E, 0x32, 0x1E, 0x65, 0x1E, 0x83, 0x1E, 0xC4, 0x1E, 0xEE, 0x1E, 0x2B, 0x1F,
+	0x4F, 0x1F, 0x77, 0x1F, 0x99, 0x1F, 0xB7, 0x1F, 0xDF, 0x1F, 0x12, 0x20, 0x3F, 0x20, 0x5D, 0x20, 0x84, 0x20, 0xA7, 0x20, 0xD3, 0x20, 0x0E, 0x21, 0x43, 0x21, 0x8B, 0x21, 0xBF, 0x21, 0x03, 0x22,
+	0x34, 0x22, 0x6F, 0x22, 0x9A, 0x22, 0xD8, 0x22, 0x07, 0x23, 0x3B, 0x23, 0x64, 0x23, 0x83, 0x23, 0xA7, 0x23, 0xBD, 0x23, 0xD3, 0x23, 0xE0, 0x23, 0xED, 0x23, 0x02, 0x24, 0x17, 0x24, 0x23, 0x24,
+	0x31, 0x24, 0x37, 0x24, 0x3C, 0x24, 0x67, 0x24, 0x7C, 0x24, 0xAD, 0x24, 0xC4, 0x24, 0xF3, 0x24, 0x16, 0x25, 0x37, 0x25, 0x57, 0x25, 0x66, 0x25, 0x81, 0x25, 0x8C, 0x25, 0xA6, 0x25, 0xB5, 0x25,
+	0xCA, 0x25, 0xD6, 0x25, 0xF3, 0x25, 0xFE, 0x25, 0x2B, 0x26, 0x52, 0x26, 0x7C, 0x26, 0x9C, 0x26, 0xCC, 0x26, 0xF8, 0x26, 0x1D, 0x27, 0x46, 0x27, 0x63, 0x27, 0x91, 0x27, 0xB2, 0x27, 0xED, 0x27,
+	0x12, 0x28, 0x54, 0x28, 0x7E, 0x28, 0xAE, 0x28, 0xE9, 0x28, 0x1E, 0x29, 0x33, 0x29, 0x62, 0x29, 0x74, 0x29, 0xB0, 0x29, 0xCF, 0x29, 0x0F, 0x2A, 0x43, 0x2A, 0x86, 0x2A, 0xBD, 0x2A, 0xF9, 0x2A,
+	0x27, 0x2B, 0x6A, 0x2B, 0xA4, 0x2B, 0xC0, 0x2B, 0xD8, 0x2B, 0x07, 0x2C, 0x1E, 0x2C, 0x38, 0x2C, 0x49, 0x2C, 0x7C, 0x2C, 0xA3, 0x2C, 0xCE, 0x2C, 0xED, 0x2C, 0x1F, 0x2D, 0x43, 0x2D, 0x74, 0x2D,
+	0x97, 0x2D, 0xCF, 0x2D, 0xF6, 0x2D, 0x25, 0x2E, 0x46, 0x2E, 0x93, 0x2E, 0xCE, 0x2E, 0x08, 0x2F, 0x30, 0x2F, 0x65, 0x2F, 0xA5, 0x2F, 0xD8, 0x2F, 0x15, 0x30, 0x45, 0x30, 0x88, 0x30, 0xBE, 0x30,
+	0xCA, 0x30, 0xF3, 0x30, 0x27, 0x31, 0x4C, 0x31, 0x7E, 0x31, 0xB3, 0x31, 0xBC, 0x31, 0xCE, 0x31, 0xE9, 0x31, 0x1E, 0x32, 0x4A, 0x32, 0x70, 0x32, 0x9C, 0x32, 0xB7, 0x32, 0xF3, 0x32, 0x0F, 0x33,
+	0x3F, 0x33, 0x5F, 0x33, 0x85, 0x33, 0x99, 0x33, 0xBD, 0x33, 0xD8, 0x33, 0x17, 0x34, 0x41, 0x34, 0x6C, 0x34, 0x9E, 0x34, 0xC4, 0x34, 0xE1, 0x34, 0x11, 0x35, 0x29, 0x35, 0x53, 0x35, 0x6C, 0x35,
+	0x8B, 0x35, 0xB8, 0x35, 0xCF, 0x35, 0x03, 0x36, 0x2E, 0x36, 0x5F, 0x36, 0x7B, 0x36, 0x97, 0x36, 0xBA, 0x36, 0xE0, 0x36, 0x03, 0x37, 0x2C, 0x37, 0x4B, 0x37, 0x79, 0x37, 0xAE, 0x37, 0xD5, 0x37,
+	0xF9, 0x37, 0x24, 0x38, 0x3D, 0x38, 0x4C, 0x38, 0x69, 0x38, 0x8D, 0x38, 0xBE, 0x38, 0xDD, 0x38, 0xFE, 0x38, 0x26, 0x39, 0x44, 0x39, 0x5D, 0x39, 0x84, 0x39, 0x97, 0x39, 0xB4, 0x39, 0xC7, 0x39,
+	0xE4, 0x39, 0x03, 0x3A, 0x14, 0x3A, 0x3A, 0x3A, 0x69, 0x3A, 0x8E, 0x3A, 0xA5, 0x3A, 0xBF, 0x3A, 0xDC, 0x3A, 0xFC, 0x3A, 0x18, 0x3B, 0x3A, 0x3B, 0x54, 0x3B, 0x75, 0x3B, 0x9B, 0x3B, 0x9C, 0x32,
+	0xB8, 0x3B, 0xE3, 0x3B, 0x07, 0x3C, 0x23, 0x3C, 0x46, 0x3C, 0x6B, 0x3C, 0x73, 0x3C, 0x84, 0x3C, 0x8E, 0x3C, 0xBB, 0x3C, 0xDF, 0x3C, 0x00, 0x3D, 0x9C, 0x32, 0x23, 0x3D, 0x4D, 0x3D, 0x9C, 0x32,
+	0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32,
+	0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32,
+	0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x63, 0x3D, 0x67, 0x3D, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x9C, 0x32, 0x6A, 0x3D,
+	0x7F, 0x3D,
+
+	// Glyphs
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x33, 0x06, 0x00, 0x96, 0x38, 0x06, 0x66, 0x0F, 0x05, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x56, 0x0F, 0x06,
+	0x66, 0x0F, 0x05, 0x00, 0x0F, 0x24, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x26, 0x32, 0x06, 0x2B, 0x75, 0x07, 0xAB, 0x0B, 0x88, 0x23, 0x0B, 0x46, 0x21, 0x26, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x26, 0x14,
+	0x06, 0x2B, 0x76, 0x06, 0x2B, 0x83, 0x08, 0xBA, 0x0B, 0x76, 0x26, 0x0B, 0x36, 0x22, 0x26, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x0F, 0x04, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x68, 0x56, 0x07, 0x87,
+	0x37, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x00, 0xF4, 0x90, 0x04, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x36, 0x36, 0x35, 0x06, 0x37, 0x36, 0x24, 0x07, 0x38, 0x95, 0x07, 0x29,
+	0x76, 0x08, 0x0F, 0x15, 0x0B, 0x69, 0x0F, 0x02, 0xA7, 0x0F, 0x36, 0x36, 0x0E, 0x26, 0x28, 0x0E, 0x00, 0x26, 0x28, 0x26, 0x06, 0x36, 0x36, 0x35, 0x06, 0xA7, 0x44, 0x07, 0x78, 0x35, 0x09, 0x0F,
+	0x33, 0x0B, 0x0F, 0x32, 0x0C, 0x3F, 0x0E, 0x3E, 0x0F, 0x3C, 0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x39, 0x84, 0x08, 0x38, 0xA4, 0x07, 0x36, 0x35, 0x36, 0x06, 0x26, 0x26, 0x28, 0x06, 0x2E, 0x28, 0x06,
+	0x00, 0x3E, 0x36, 0x06, 0xAF, 0x07, 0x0F, 0x62, 0x09, 0x0F, 0x53, 0x09, 0x0F, 0x72, 0x08, 0x0F, 0x41, 0x41, 0x07, 0x3F, 0x35, 0x06, 0x68, 0x21, 0x27, 0x06, 0xA7, 0x27, 0x06, 0x36, 0x54, 0x26,
+	0x06, 0x26, 0x65, 0x25, 0x06, 0x26, 0x25, 0x42, 0x23, 0x06, 0x26, 0x34, 0x34, 0x21, 0x07, 0x36, 0x23, 0x56, 0x07, 0x67, 0x38, 0x08, 0x48, 0x67, 0x07, 0x0F, 0x52, 0x31, 0x06, 0x5F, 0x24, 0x06,
+	0x2F, 0x27, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x66, 0x0F, 0x05, 0x00, 0xBD, 0x08, 0xFA, 0x20, 0x05, 0x89, 0x83, 0x04, 0x57, 0x5D, 0x02, 0x46, 0x0F, 0x42, 0x01, 0x35, 0x0F, 0x36, 0x25, 0x0F, 0x28,
+	0x25, 0x0F, 0x28, 0x35, 0x0F, 0x36, 0x46, 0x0F, 0x42, 0x01, 0x57, 0x5D, 0x02, 0x89, 0x83, 0x04, 0xFA, 0x20, 0x05, 0xBD, 0x08, 0x1A, 0x0F, 0x06, 0x29, 0x0F, 0x06, 0x29, 0x13, 0x0F, 0x02, 0x1A,
+	0x32, 0x0F, 0x01, 0x4A, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0x4A, 0x0F, 0x03, 0x1A, 0x32, 0x0F, 0x01, 0x29, 0x13, 0x0F, 0x02, 0x29, 0x0F, 0x06, 0x1A, 0x0F, 0x06, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE9, 0x09, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x38, 0x22, 0x02, 0x0F, 0x78, 0x02, 0x0F, 0x22, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x38, 0x06,
+	0x00, 0x0F, 0x29, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x82, 0x07, 0x9D, 0x0A, 0x8A, 0x0E, 0x86, 0x0F, 0x03, 0x65, 0x0F, 0x06, 0x25, 0x0F, 0x0A, 0x8C, 0x0C, 0xE9, 0x09, 0xF8, 0x10, 0x08, 0x37, 0x3C,
+	0x07, 0x36, 0x3E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x36, 0x3E, 0x06, 0x37, 0x4B, 0x07, 0xF8, 0x10, 0x08, 0xE9, 0x09, 0x8C, 0x0C, 0x0F, 0x29, 0x06, 0x29, 0x2D, 0x06, 0x38, 0x2D,
+	0x06, 0x37, 0x2E, 0x06, 0x27, 0x2F, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x29, 0x4B, 0x06, 0x47, 0x5A, 0x06, 0x37, 0x6A, 0x06, 0x36,
+	0x3A, 0x22, 0x06, 0x26, 0x3A, 0x23, 0x06, 0x26, 0x39, 0x24, 0x06, 0x26, 0x29, 0x25, 0x06, 0x26, 0x28, 0x26, 0x06, 0x36, 0x36, 0x26, 0x06, 0x37, 0x43, 0x27, 0x06, 0x97, 0x28, 0x06, 0x68, 0x2A,
+	0x06, 0x0F, 0x29, 0x06, 0x0F, 0x16, 0x0A, 0x38, 0x49, 0x08, 0x47, 0x59, 0x07, 0x37, 0x2D, 0x07, 0x36, 0x3E, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36, 0x45, 0x35, 0x06, 0x47, 0x31,
+	0x31, 0x24, 0x07, 0x87, 0x82, 0x07, 0x68, 0x73, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x0F, 0x51, 0x0B, 0x3F, 0x21, 0x0B, 0x3E, 0x22, 0x0B, 0x4C, 0x23, 0x0B, 0x3B, 0x25, 0x0B, 0x49, 0x26,
+	0x0B, 0x38, 0x28, 0x0B, 0x46, 0x29, 0x0B, 0xF6, 0x50, 0x06, 0x00, 0x0F, 0x24, 0x0B, 0x00, 0x00, 0x0F, 0x16, 0x0A, 0xA6, 0x35, 0x08, 0xA6, 0x45, 0x07, 0x66, 0x22, 0x27, 0x07, 0x26, 0x26, 0x37,
+	0x06, 0x26, 0x25, 0x29, 0x06, 0x00, 0x00, 0x00, 0x26, 0x35, 0x37, 0x06, 0x26, 0x36, 0x35, 0x07, 0x26, 0xB6, 0x07, 0x26, 0x97, 0x08, 0x0F, 0x52, 0x0A, 0xCA, 0x0A, 0xF8, 0x10, 0x08, 0x57, 0x23,
+	0x44, 0x07, 0x27, 0x25, 0x27, 0x07, 0x36, 0x24, 0x29, 0x06, 0x26, 0x25, 0x29, 0x06, 0x00, 0x00, 0x36, 0x34, 0x37, 0x06, 0x37, 0x34, 0x35, 0x07, 0x37, 0xB4, 0x07, 0x28, 0x95, 0x08, 0x0F, 0x42,
+	0x0B, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x26, 0x4E, 0x06, 0x26, 0x8A, 0x06, 0x26, 0xA8, 0x06, 0x26, 0x66, 0x0C, 0x26, 0x54, 0x0F, 0x26, 0x52, 0x0F, 0x02, 0x26, 0x41, 0x0F, 0x04, 0x56, 0x0F,
+	0x06, 0x46, 0x0F, 0x07, 0x26, 0x0F, 0x09, 0x0F, 0x34, 0x0A, 0x68, 0x73, 0x08, 0x87, 0x82, 0x07, 0x37, 0x53, 0x25, 0x07, 0x36, 0x45, 0x35, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36,
+	0x45, 0x26, 0x06, 0x37, 0x53, 0x25, 0x07, 0x87, 0x82, 0x07, 0x68, 0x73, 0x08, 0x0F, 0x34, 0x0A, 0x3B, 0x0F, 0x03, 0x98, 0x25, 0x08, 0xB7, 0x34, 0x07, 0x37, 0x35, 0x34, 0x07, 0x36, 0x37, 0x34,
+	0x06, 0x26, 0x29, 0x25, 0x06, 0x00, 0x00, 0x26, 0x29, 0x34, 0x06, 0x36, 0x27, 0x25, 0x07, 0x47, 0x24, 0x44, 0x07, 0xF8, 0x10, 0x08, 0xD9, 0x0A, 0x5D, 0x0E, 0x3A, 0x3A, 0x06, 0x00, 0x3A, 0x3A,
+	0x22, 0x02, 0x3A, 0x7A, 0x02, 0x3F, 0x0E, 0x00, 0x2E, 0x21, 0x0D, 0x00, 0x3D, 0x31, 0x0C, 0x2D, 0x23, 0x0C, 0x3C, 0x33, 0x0B, 0x2C, 0x25, 0x0B, 0x00, 0x2B, 0x27, 0x0A, 0x00, 0x3A, 0x37, 0x09,
+	0x2A, 0x29, 0x09, 0x39, 0x39, 0x08, 0x29, 0x2B, 0x08, 0x2C, 0x25, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x2B, 0x08, 0x39, 0x39, 0x08,
+	0x2A, 0x29, 0x09, 0x3A, 0x28, 0x09, 0x2B, 0x27, 0x0A, 0x00, 0x2C, 0x25, 0x0B, 0x00, 0x3C, 0x33, 0x0B, 0x2D, 0x23, 0x0C, 0x3D, 0x31, 0x0C, 0x2E, 0x21, 0x0D, 0x00, 0x3F, 0x0E, 0x00, 0x2A, 0x0F,
+	0x05, 0x48, 0x0F, 0x05, 0x57, 0x0F, 0x05, 0x37, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x26, 0x1B, 0x33, 0x06, 0x26, 0x39, 0x33, 0x06, 0x26, 0x48, 0x33, 0x06, 0x26, 0x37, 0x0E, 0x26, 0x27, 0x0F, 0x27,
+	0x25, 0x0F, 0x01, 0x97, 0x0F, 0x01, 0x78, 0x0F, 0x02, 0x49, 0x0F, 0x04, 0x0F, 0x61, 0x0A, 0xCD, 0x07, 0x5B, 0x55, 0x06, 0x3A, 0x3B, 0x05, 0x39, 0x3D, 0x04, 0x28, 0x0F, 0x31, 0x03, 0x27, 0x86,
+	0x24, 0x03, 0x36, 0xB4, 0x23, 0x03, 0x26, 0x44, 0x36, 0x23, 0x02, 0x26, 0x33, 0x29, 0x23, 0x02, 0x25, 0x33, 0x2A, 0x23, 0x02, 0x25, 0x23, 0x2B, 0x23, 0x02, 0x25, 0x23, 0x2A, 0x24, 0x02, 0x00,
+	0x25, 0x23, 0x38, 0x25, 0x02, 0x25, 0x24, 0x65, 0x33, 0x02, 0x25, 0xD5, 0x22, 0x03, 0x35, 0xA2, 0x32, 0x22, 0x03, 0x26, 0x52, 0x28, 0x31, 0x03, 0x36, 0x11, 0x2C, 0x21, 0x04, 0x37, 0x2C, 0x08,
+	0x38, 0x3A, 0x08, 0x59, 0x63, 0x09, 0xAB, 0x0B, 0x2F, 0x0F, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C,
+	0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x77, 0x24, 0x0C, 0x6A, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x26, 0x26, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x34, 0x28, 0x06, 0x37, 0x52, 0x36, 0x06, 0x77, 0x31, 0x34, 0x07, 0x58, 0x93, 0x07, 0x0F, 0x62, 0x09,
+	0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x47, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3E, 0x06,
+	0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x39, 0x38, 0x09, 0x0F, 0x16, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3E,
+	0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x4E, 0x0E, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+	0x0F, 0x09, 0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x28, 0x26,
+	0x06, 0x00, 0x36, 0x27, 0x26, 0x06, 0x27, 0x27, 0x35, 0x06, 0x37, 0x26, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x48, 0x84, 0x08, 0x1A, 0x85, 0x08, 0x0F, 0x71, 0x09, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x15, 0x0B, 0x0F, 0x35, 0x09, 0x0F, 0x55, 0x07, 0x0F,
+	0x37, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x2F, 0x07, 0xF6, 0x40, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x10, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F,
+	0x21, 0x0E, 0x3E, 0x0F, 0x3D, 0x0F, 0x01, 0x5C, 0x0F, 0x3B, 0x41, 0x0D, 0x3A, 0x43, 0x0C, 0x39, 0x45, 0x0B, 0x38, 0x38, 0x0A, 0x37, 0x4A, 0x08, 0x36, 0x4C, 0x07, 0x26, 0x4E, 0x06, 0x16, 0x0F,
+	0x31, 0x06, 0x0F, 0x1A, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x66, 0x0F, 0x05, 0x68, 0x0F,
+	0x03, 0x6B, 0x0F, 0x6E, 0x0C, 0x0F, 0x71, 0x09, 0x0F, 0x74, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x62, 0x09, 0x6E, 0x0C, 0x6B, 0x0F, 0x68, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x49, 0x0F, 0x04, 0x4B, 0x0F, 0x02, 0x5C, 0x0F, 0x4E, 0x0E, 0x5F, 0x0C, 0x0F, 0x42, 0x0B, 0x0F, 0x44, 0x09,
+	0x0F, 0x55, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06,
+	0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x0E, 0x37, 0x34, 0x0F, 0xA7, 0x0F, 0x78, 0x0F, 0x02, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x4A,
+	0x07, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x0F, 0x41, 0x04, 0x26, 0x0F, 0x51, 0x03, 0x26, 0x0F, 0x61, 0x02, 0x26, 0x0F, 0x21, 0x32, 0x01,
+	0x27, 0x2E, 0x24, 0x01, 0x37, 0x3C, 0x24, 0x01, 0x38, 0x3A, 0x25, 0x01, 0x58, 0x56, 0x25, 0x01, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x26, 0x48, 0x0C, 0x26, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x54, 0x06, 0x88, 0x37, 0x06, 0x4A, 0x2A, 0x06, 0x0F, 0x16, 0x0A, 0x49, 0x28, 0x09,
+	0x68, 0x46, 0x08, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x26, 0x36, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x37, 0x26, 0x06,
+	0x36, 0x36, 0x25, 0x07, 0x47, 0x35, 0x33, 0x07, 0x38, 0x95, 0x07, 0x29, 0x76, 0x08, 0x0F, 0x34, 0x0A, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26,
+	0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0x38, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0x16, 0x0F, 0x0A, 0x36, 0x0F, 0x08, 0x66, 0x0F, 0x05, 0x77, 0x0F, 0x03, 0x7A, 0x0F, 0x6D,
+	0x0D, 0x7F, 0x0A, 0x0F, 0x73, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x73, 0x07, 0x7F, 0x0A, 0x6D, 0x0D, 0x7A, 0x0F, 0x77, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0x36, 0x0F,
+	0x08, 0x16, 0x0F, 0x0A, 0x46, 0x0F, 0x07, 0x76, 0x0F, 0x04, 0x88, 0x0F, 0x01, 0x8B, 0x0D, 0x8E, 0x0A, 0x0F, 0x82, 0x07, 0x0F, 0x65, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x81, 0x08,
+	0x8D, 0x0B, 0x8A, 0x0E, 0x87, 0x0F, 0x02, 0x56, 0x0F, 0x06, 0x00, 0x77, 0x0F, 0x03, 0x8A, 0x0E, 0x8D, 0x0B, 0x0F, 0x81, 0x08, 0x0F, 0x74, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x82,
+	0x07, 0x8E, 0x0A, 0x8B, 0x0D, 0x88, 0x0F, 0x01, 0x76, 0x0F, 0x04, 0x46, 0x0F, 0x07, 0x0F, 0x1A, 0x06, 0x26, 0x3F, 0x06, 0x36, 0x4D, 0x06, 0x56, 0x4A, 0x07, 0x48, 0x47, 0x09, 0x49, 0x45, 0x0A,
+	0x4B, 0x41, 0x0C, 0x7C, 0x0D, 0x3E, 0x0F, 0x7C, 0x0D, 0x4B, 0x41, 0x0C, 0x4A, 0x53, 0x0A, 0x48, 0x47, 0x09, 0x47, 0x59, 0x07, 0x36, 0x4D, 0x06, 0x26, 0x3F, 0x06, 0x0F, 0x1A, 0x06, 0x16, 0x0F,
+	0x0A, 0x36, 0x0F, 0x08, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x59, 0x0F, 0x03, 0x4B, 0x0F, 0x02, 0x5C, 0x0F, 0xCE, 0x06, 0xBF, 0x06, 0xCE, 0x06, 0x5C, 0x0F, 0x4B, 0x0F, 0x02, 0x59, 0x0F, 0x03,
+	0x57, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x16, 0x0F, 0x0A, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x3C, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23,
+	0x06, 0x26, 0x38, 0x25, 0x06, 0x26, 0x46, 0x26, 0x06, 0x26, 0x45, 0x27, 0x06, 0x26, 0x44, 0x28, 0x06, 0x26, 0x42, 0x2A, 0x06, 0x26, 0x41, 0x2B, 0x06, 0x66, 0x2C, 0x06, 0x46, 0x2E, 0x06, 0x36,
+	0x2F, 0x06, 0x0F, 0x29, 0x06, 0xF5, 0xC0, 0x00, 0x00, 0x25, 0x0F, 0x28, 0x00, 0x00, 0x25, 0x0F, 0x0A, 0x65, 0x0F, 0x06, 0x86, 0x0F, 0x03, 0x8A, 0x0E, 0x9D, 0x0A, 0x0F, 0x82, 0x07, 0x0F, 0x56,
+	0x06, 0x0F, 0x29, 0x06, 0x25, 0x0F, 0x28, 0x00, 0x00, 0xF5, 0xC0, 0x00, 0x00, 0x1F, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x4C, 0x0F, 0x01, 0x4A, 0x0F, 0x03, 0x48, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x26,
+	0x0F, 0x09, 0x00, 0x46, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x4A, 0x0F, 0x03, 0x4C, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x1F, 0x0F, 0x01, 0x0F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0F, 0x0B, 0x25, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x27, 0x0F, 0x08, 0x18, 0x0F, 0x08, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93,
+	0x06, 0x3B, 0x23, 0x34, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x24, 0x08, 0xDB, 0x08, 0xFB, 0x06, 0xDD, 0x06,
+	0x0F, 0x29, 0x06, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C, 0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08,
+	0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4B, 0x37, 0x07, 0x3C, 0x36, 0x08, 0x2D, 0x26, 0x09,
+	0x6F, 0x0B, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x1B, 0x1C, 0x07, 0x2B, 0x2A, 0x07, 0x4D, 0x42, 0x09, 0xF5, 0x60, 0x06, 0x00, 0x6F, 0x0B,
+	0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23,
+	0x08, 0x0F, 0x31, 0x0D, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0xF6, 0x50, 0x06, 0xF5, 0x60, 0x06, 0x25, 0x23, 0x0F, 0x05, 0x00, 0x00, 0x6F, 0x0B, 0xCC, 0x24, 0x02, 0xEB, 0x33, 0x01, 0x4A, 0x48, 0x32,
+	0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C, 0x24, 0x00, 0x00, 0x2B, 0x2A, 0x25, 0x3B, 0x28, 0x35, 0x4D, 0x42, 0x53, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x40, 0x03, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x2B, 0x0F,
+	0x04, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x5A, 0x0F, 0x02, 0xFB, 0x06, 0xEC, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x2F, 0x00, 0x25, 0xF3, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x25,
+	0xF3, 0x40, 0x03, 0xF5, 0x60, 0x06, 0x00, 0x0F, 0x23, 0x0C, 0x0F, 0x31, 0x0D, 0x4F, 0x0D, 0x7E, 0x0B, 0x3D, 0x42, 0x0A, 0x3C, 0x54, 0x08, 0x4A, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x1A, 0x2D, 0x06,
+	0x0F, 0x1A, 0x06, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x1C, 0x0F, 0x04, 0x1B, 0x0F, 0x05, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB,
+	0x06, 0xDD, 0x06, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x2B, 0x0F,
+	0x04, 0x1B, 0x0F, 0x05, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x5A, 0x0F, 0x02, 0xFB, 0x06, 0xEC, 0x06, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06,
+	0x00, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0xFA, 0x70, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C, 0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00,
+	0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08, 0x6F, 0x0B, 0x6F, 0x0B, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x1B, 0x2B, 0x07,
+	0x2B, 0x2A, 0x07, 0x4D, 0x42, 0x09, 0xFA, 0x70, 0x00, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x3B, 0x0F, 0x03, 0x3A, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x1E, 0x27, 0x08, 0x5C, 0x35, 0x07,
+	0x7B, 0x25, 0x07, 0x3A, 0x32, 0x35, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x34, 0x33, 0x06, 0x3B, 0x74, 0x07, 0x2C, 0x74, 0x07, 0x1D,
+	0x36, 0x09, 0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x08, 0xF7, 0x40, 0x06, 0x00, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x28,
+	0x07, 0x00, 0xDA, 0x09, 0xFA, 0x10, 0x06, 0x00, 0x1A, 0x0F, 0x06, 0x5A, 0x0F, 0x02, 0x8A, 0x0E, 0x8D, 0x0B, 0x0F, 0x91, 0x07, 0x0F, 0x65, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x81,
+	0x08, 0x8D, 0x0B, 0x8A, 0x0E, 0x5A, 0x0F, 0x02, 0x1A, 0x0F, 0x06, 0x2A, 0x0F, 0x05, 0x6A, 0x0F, 0x01, 0x9A, 0x0D, 0x9E, 0x09, 0x0F, 0x83, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x82,
+	0x07, 0x8D, 0x0B, 0x7A, 0x0F, 0x2A, 0x0F, 0x05, 0x7A, 0x0F, 0x8D, 0x0B, 0x0F, 0x82, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x83, 0x06, 0x9E, 0x09, 0x9A, 0x0D, 0x6A, 0x0F, 0x01, 0x2A,
+	0x0F, 0x05, 0x2A, 0x2C, 0x06, 0x3A, 0x49, 0x06, 0x5A, 0x55, 0x07, 0x5C, 0x42, 0x09, 0x7E, 0x0B, 0x0F, 0x31, 0x0D, 0x7E, 0x0B, 0x5C, 0x42, 0x09, 0x5A, 0x55, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C,
+	0x06, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x8C, 0x39, 0x0F, 0x71, 0x35, 0x01, 0x0F, 0xC4, 0x01, 0x0F, 0x68, 0x03, 0x0F, 0x75, 0x05, 0x0F, 0x81, 0x08, 0x8D, 0x0B, 0x8A, 0x0E, 0x4A,
+	0x0F, 0x03, 0x1A, 0x0F, 0x06, 0x0F, 0x29, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47, 0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x2A, 0x54, 0x23, 0x06, 0x2A, 0x43, 0x25, 0x06, 0x2A, 0x51,
+	0x26, 0x06, 0x6A, 0x28, 0x06, 0x5A, 0x29, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x22, 0x0D, 0x00, 0x0F, 0x41, 0x0C, 0x6F, 0x0B, 0xB6, 0xC2, 0x01, 0xB5, 0xC4, 0x35, 0x0F, 0x36, 0x25,
+	0x0F, 0x28, 0x00, 0xF5, 0xC0, 0x00, 0x25, 0x0F, 0x28, 0x00, 0x00, 0x35, 0x0F, 0x36, 0xC5, 0xC3, 0xB6, 0xD1, 0x01, 0x6F, 0x0B, 0x0F, 0x32, 0x0C, 0x0F, 0x22, 0x0D, 0x3F, 0x0E, 0x2F, 0x0F, 0x2E,
+	0x0F, 0x01, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0x2F, 0x0F, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0x3E, 0x0F, 0xF7, 0x30, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x00, 0x00, 0xF7, 0x30, 0x07,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x4F, 0x0D, 0x6E, 0x0C, 0x8D, 0x0B, 0x3C, 0x21, 0x31, 0x0A, 0x3B, 0x22, 0x32, 0x09, 0x1B, 0x24, 0x14, 0x09, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x0F, 0x08, 0x26, 0x0F, 0x09, 0x35, 0x0F, 0x09, 0x34, 0x0F, 0x0A, 0x33, 0x0F, 0x0B, 0xF2, 0xC0,
+	0x03, 0x00, 0x33, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x27, 0x0F, 0x08, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x24, 0x14, 0x09, 0x3B, 0x22, 0x32, 0x09, 0x3C, 0x21, 0x31, 0x0A, 0x8D, 0x0B, 0x6E, 0x0C, 0x4F, 0x0D, 0x0F, 0x21, 0x0E, 0x0F, 0x28, 0x07, 0x0F, 0x29,
+	0x06, 0x0F, 0x39, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x3B, 0x03, 0xF2, 0xD0, 0x02, 0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x0F, 0x29, 0x06, 0x0F, 0x28, 0x07, 0x18, 0x1E, 0x08,
+	0x27, 0x2E, 0x07, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x23, 0x05, 0x24, 0x0F, 0x25, 0x04, 0x23, 0x0F, 0x27, 0x03, 0xF2, 0xD0, 0x02, 0x00, 0x23, 0x0F, 0x27, 0x03, 0x24, 0x0F, 0x25, 0x04, 0x25,
+	0x0F, 0x23, 0x05, 0x26, 0x0F, 0x21, 0x06, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x17, 0x0F, 0x11, 0x07, 0x27, 0x2E, 0x07, 0x28, 0x2C, 0x08, 0x29, 0x2A, 0x09, 0x2A, 0x28, 0x0A, 0x2B, 0x26, 0x0B,
+	0xC2, 0xC4, 0x02, 0x00, 0x2B, 0x26, 0x0B, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x28, 0x2C, 0x08, 0x27, 0x2E, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x0F, 0x0F, 0x02, 0x3A, 0xE4, 0x01, 0x3A, 0xF3, 0x01,
+	0x00, 0x8C, 0x0C, 0xCA, 0x0A, 0xE9, 0x09, 0x29, 0x39, 0x09, 0x28, 0x2C, 0x08, 0x00, 0x46, 0x4C, 0x06, 0x28, 0x2C, 0x08, 0x38, 0x3A, 0x08, 0x39, 0x38, 0x09, 0x49, 0x46, 0x09, 0x2B, 0x36, 0x0A,
+	0x2F, 0x27, 0x06, 0x2F, 0x36, 0x06, 0xFA, 0x10, 0x06, 0xF8, 0x21, 0x06, 0xF7, 0x22, 0x06, 0x36, 0x26, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36, 0x26, 0x27, 0x06, 0x37, 0x3D,
+	0x06, 0x28, 0x4B, 0x07, 0x0F, 0x36, 0x08, 0x2A, 0x61, 0x21, 0x0A, 0xCA, 0x0A, 0x3B, 0x34, 0x0B, 0x2B, 0x26, 0x0B, 0x2A, 0x28, 0x0A, 0x00, 0x00, 0x00, 0x2B, 0x26, 0x0B, 0x3B, 0x34, 0x0B, 0xCA,
+	0x0A, 0x2A, 0x61, 0x21, 0x0A, 0x16, 0x0F, 0x0A, 0x36, 0x27, 0x22, 0x0A, 0x46, 0x26, 0x22, 0x0A, 0x57, 0x24, 0x22, 0x0A, 0x59, 0x22, 0x22, 0x0A, 0x4B, 0x21, 0x22, 0x0A, 0x5D, 0x22, 0x0A, 0xCE,
+	0x06, 0x00, 0x5D, 0x22, 0x0A, 0x4B, 0x21, 0x22, 0x0A, 0x59, 0x22, 0x22, 0x0A, 0x57, 0x24, 0x22, 0x0A, 0x46, 0x26, 0x22, 0x0A, 0x36, 0x27, 0x22, 0x0A, 0x16, 0x0F, 0x0A, 0xB5, 0xB5, 0x00, 0x28,
+	0x35, 0x26, 0x06, 0x56, 0x53, 0x35, 0x05, 0x66, 0x21, 0x32, 0x25, 0x05, 0x35, 0x42, 0x24, 0x26, 0x04, 0x25, 0x34, 0x24, 0x26, 0x04, 0x25, 0x24, 0x26, 0x25, 0x04, 0x25, 0x25, 0x25, 0x25, 0x04,
+	0x00, 0x25, 0x25, 0x35, 0x24, 0x04, 0x26, 0x34, 0x43, 0x23, 0x05, 0x36, 0x64, 0x71, 0x05, 0x27, 0x55, 0x52, 0x06, 0x27, 0x0F, 0x08, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x27, 0x0F, 0x08,
+	0x00, 0x2F, 0x0F, 0x8C, 0x0C, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x18, 0x1E, 0x08, 0x27, 0x54, 0x25, 0x07, 0x17, 0x84, 0x14, 0x07, 0x26, 0x23, 0x26, 0x23, 0x06, 0x16, 0x23, 0x28, 0x13, 0x06,
+	0x16, 0x13, 0x1A, 0x13, 0x06, 0x00, 0x00, 0x16, 0x23, 0x28, 0x13, 0x06, 0x26, 0x23, 0x26, 0x23, 0x06, 0x17, 0x14, 0x16, 0x14, 0x07, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x29, 0x2A, 0x09, 0x2A,
+	0x28, 0x0A, 0x8C, 0x0C, 0x2F, 0x0F, 0x2D, 0x0F, 0x02, 0x27, 0x52, 0x0F, 0x01, 0x27, 0x71, 0x0F, 0x26, 0x22, 0x14, 0x0F, 0x16, 0x13, 0x15, 0x0F, 0x00, 0x16, 0x13, 0x14, 0x0F, 0x01, 0x36, 0x11,
+	0x22, 0x0F, 0x02, 0xA7, 0x0F, 0x89, 0x0F, 0x0F, 0x11, 0x0F, 0x0F, 0x13, 0x0D, 0x0F, 0x32, 0x0C, 0x0F, 0x51, 0x0B, 0x3F, 0x32, 0x09, 0x3D, 0x35, 0x08, 0x2D, 0x27, 0x08, 0x1D, 0x19, 0x08, 0x0F,
+	0x32, 0x0C, 0x0F, 0x51, 0x0B, 0x3F, 0x31, 0x0A, 0x3E, 0x33, 0x09, 0x3D, 0x35, 0x08, 0x2D, 0x27, 0x08, 0x1D, 0x19, 0x08, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0x09, 0x00, 0x2F, 0x0F, 0x8C, 0x0C, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x18, 0x1E, 0x08, 0x27, 0x2E, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x26, 0xC2, 0x22, 0x06, 0x16, 0x13, 0x15,
+	0x18, 0x06, 0x00, 0x00, 0x16, 0x13, 0x35, 0x16, 0x06, 0x16, 0x23, 0x63, 0x14, 0x06, 0x26, 0x53, 0x33, 0x22, 0x06, 0x17, 0x34, 0x16, 0x12, 0x07, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x29, 0x2A,
+	0x09, 0x2A, 0x28, 0x0A, 0x8C, 0x0C, 0x2F, 0x0F, 0x23, 0x0F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0F, 0x05, 0x27, 0x22, 0x0F,
+	0x04, 0x26, 0x24, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x27, 0x22, 0x0F, 0x04, 0x48, 0x0F, 0x05, 0x2E, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x22, 0x06, 0x00, 0x2E, 0x28, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x27, 0x0E, 0x27, 0x36, 0x0E, 0x26, 0x26, 0x11, 0x0E, 0x16, 0x26, 0x12, 0x0E, 0x16, 0x25, 0x13, 0x0E, 0x16, 0x34, 0x13, 0x0E, 0x76, 0x14, 0x0E, 0x57, 0x15, 0x0E, 0x27,
+	0x26, 0x0F, 0x27, 0x36, 0x0E, 0x16, 0x1A, 0x0E, 0x16, 0x14, 0x15, 0x0E, 0x00, 0x16, 0x23, 0x15, 0x0E, 0x56, 0x61, 0x0E, 0x37, 0x52, 0x0F, 0x18, 0x0F, 0x08, 0x27, 0x0F, 0x08, 0x26, 0x0F, 0x09,
+	0x25, 0x0F, 0x0A, 0x00, 0x15, 0x0F, 0x0B, 0xFA, 0x70, 0x00, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x28, 0x07, 0x0F, 0x27, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x0F,
+	0x38, 0x06, 0x0F, 0x29, 0x06, 0x49, 0x0F, 0x04, 0x87, 0x0F, 0x02, 0x00, 0xA6, 0x0F, 0x01, 0x00, 0xF6, 0x90, 0x02, 0x00, 0x16, 0x0F, 0x0A, 0x00, 0x00, 0xF6, 0x90, 0x02, 0x00, 0x16, 0x0F, 0x0A,
+	0x00, 0x0F, 0x31, 0x0D, 0x00, 0x0F, 0x2F, 0x0F, 0x2B, 0x22, 0x00, 0x0F, 0x5C, 0x0F, 0x3D, 0x01, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0x00, 0x0F, 0x12, 0x0E, 0x00,
+	0x00, 0x3A, 0x0F, 0x04, 0x78, 0x0F, 0x02, 0x97, 0x0F, 0x01, 0x26, 0x27, 0x0F, 0x16, 0x19, 0x0F, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x47, 0x41, 0x0F, 0x01, 0x78, 0x0F, 0x02, 0x3A, 0x0F, 0x04, 0x1D,
+	0x19, 0x08, 0x2D, 0x27, 0x08, 0x3D, 0x35, 0x08, 0x3E, 0x33, 0x09, 0x3F, 0x31, 0x0A, 0x0F, 0x51, 0x0B, 0x0F, 0x32, 0x0C, 0x1D, 0x19, 0x08, 0x2D, 0x27, 0x08, 0x3D, 0x35, 0x08, 0x3F, 0x22, 0x0A,
+	0x0F, 0x51, 0x0B, 0x0F, 0x32, 0x0C, 0x0F, 0x13, 0x0D, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0xC6, 0x17, 0x06, 0x0F, 0x12, 0x26, 0x06, 0x0F, 0x12, 0x44, 0x06, 0x0F,
+	0x12, 0x33, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x16, 0x09, 0x3B, 0x36, 0x09, 0x3A, 0x26, 0x11, 0x09, 0x38, 0x36, 0x12, 0x09, 0x46, 0x36, 0x13, 0x09,
+	0x26, 0x27, 0x15, 0x09, 0xCE, 0x06, 0x00, 0x0F, 0x17, 0x09, 0x00, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0xC6, 0x17, 0x06, 0x0F, 0x12, 0x26, 0x06, 0x0F, 0x12, 0x44,
+	0x06, 0x0F, 0x12, 0x33, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x0F, 0x01, 0x3B, 0x0F, 0x03, 0x3A, 0x13, 0x27, 0x06, 0x38, 0x24, 0x36, 0x06, 0x46, 0x24,
+	0x26, 0x11, 0x06, 0x26, 0x16, 0x26, 0x12, 0x06, 0x1E, 0x25, 0x13, 0x06, 0x1E, 0x34, 0x13, 0x06, 0x7E, 0x14, 0x06, 0x5F, 0x15, 0x06, 0x27, 0x26, 0x0F, 0x27, 0x36, 0x0E, 0x16, 0x1A, 0x0E, 0x16,
+	0x14, 0x15, 0x17, 0x06, 0x16, 0x14, 0x15, 0x26, 0x06, 0x16, 0x23, 0x15, 0x44, 0x06, 0x56, 0x61, 0x33, 0x08, 0x37, 0x52, 0x32, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x16,
+	0x09, 0x3B, 0x36, 0x09, 0x3A, 0x26, 0x11, 0x09, 0x38, 0x36, 0x12, 0x09, 0x46, 0x36, 0x13, 0x09, 0x26, 0x27, 0x15, 0x09, 0xCE, 0x06, 0x00, 0x0F, 0x17, 0x09, 0x00, 0x0F, 0x67, 0x04, 0x0F, 0x86,
+	0x03, 0x0F, 0x45, 0x51, 0x02, 0x0F, 0x34, 0x26, 0x02, 0x0F, 0x33, 0x28, 0x01, 0x0F, 0x32, 0x29, 0x01, 0x3A, 0x42, 0x2A, 0x01, 0x00, 0x3A, 0x22, 0x2C, 0x01, 0x0F, 0x3D, 0x01, 0x0F, 0x3C, 0x02,
+	0x0F, 0x5A, 0x02, 0x0F, 0x4A, 0x03, 0x0F, 0x2A, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x11, 0x75, 0x24, 0x0C,
+	0x11, 0x54, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x13, 0x73, 0x24, 0x0C, 0x13, 0x66, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47,
+	0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C, 0x13, 0x52, 0x27, 0x0C, 0x13, 0x22,
+	0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x11, 0x68, 0x22, 0x0C, 0x11, 0x8A, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F,
+	0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x13, 0x88, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x30, 0x53, 0x27, 0x0C, 0x20, 0x24, 0x2A, 0x0C,
+	0x20, 0x54, 0x27, 0x0C, 0x30, 0x74, 0x24, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x13, 0x88, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06,
+	0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x31, 0x88, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x20, 0x75, 0x24, 0x0C, 0x20, 0x54, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53,
+	0x27, 0x0C, 0x22, 0x73, 0x24, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x31, 0x88, 0x0C, 0x30, 0x6C, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F,
+	0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x22, 0x73, 0x24, 0x0C, 0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x22, 0x73, 0x24,
+	0x0C, 0x22, 0x66, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72,
+	0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x52, 0x63, 0x22, 0x0C, 0x31, 0x91, 0x24, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0xC2, 0x24, 0x0C, 0x33, 0x64, 0x22, 0x0C,
+	0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x64, 0x07, 0x0F, 0x62, 0x09, 0x6F, 0x0B, 0x7D, 0x0C,
+	0x6B, 0x21, 0x0C, 0x69, 0x23, 0x0C, 0x57, 0x26, 0x0C, 0x46, 0x28, 0x0C, 0x26, 0x2A, 0x0C, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x47, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F,
+	0x21, 0x24, 0x26, 0x0F, 0x41, 0x22, 0x00, 0x26, 0x0F, 0x21, 0x51, 0x26, 0x0F, 0x21, 0x32, 0x01, 0x36, 0x3E, 0x06, 0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x39, 0x38, 0x09, 0x0F,
+	0x16, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x11, 0x24, 0x27, 0x27, 0x06, 0x00, 0x21, 0x23, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06,
+	0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x13, 0x22, 0x27, 0x27, 0x06, 0x00,
+	0x22, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x11, 0x24, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x26, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x00, 0x30,
+	0x23, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27,
+	0x27, 0x06, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29,
+	0x06, 0x11, 0x0F, 0x0F, 0x00, 0x21, 0xF3, 0x50, 0x06, 0x22, 0xF2, 0x50, 0x06, 0x13, 0xF2, 0x50, 0x06, 0x13, 0x0F, 0x0D, 0x13, 0xF2, 0x50, 0x06, 0x00, 0x22, 0xF2, 0x50, 0x06, 0x21, 0x0F, 0x0E,
+	0x11, 0x0F, 0x0F, 0x00, 0x22, 0x0F, 0x0D, 0x21, 0x0F, 0x0E, 0x30, 0xF3, 0x50, 0x06, 0x20, 0xF4, 0x50, 0x06, 0x00, 0x30, 0x0F, 0x0E, 0x22, 0x0F, 0x0D, 0x13, 0x0F, 0x0D, 0x22, 0x0F, 0x0D, 0x00,
+	0xF6, 0x50, 0x06, 0x00, 0x00, 0x22, 0x0F, 0x0D, 0x00, 0x2F, 0x0F, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x36, 0x3E,
+	0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x4E, 0x0E, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x31, 0x44, 0x0F, 0x05, 0x30,
+	0x46, 0x0F, 0x04, 0x20, 0x49, 0x0F, 0x02, 0x20, 0x5A, 0x0F, 0x21, 0x4B, 0x0E, 0x21, 0x5C, 0x0C, 0x22, 0x4D, 0x0B, 0x22, 0x4F, 0x09, 0x31, 0x0F, 0x51, 0x07, 0x30, 0x0F, 0x44, 0x06, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x11, 0x24, 0x3F, 0x06, 0x11, 0x24, 0x0F, 0x21, 0x06, 0x21, 0x23,
+	0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09,
+	0xAB, 0x0B, 0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x22,
+	0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x11, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E,
+	0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F,
+	0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x13, 0x23, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9,
+	0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x31, 0x23, 0x2E, 0x07, 0x30, 0x23, 0x3F, 0x06, 0x20, 0x24, 0x0F, 0x21,
+	0x06, 0x00, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x31, 0x23, 0x2E, 0x07, 0x30, 0x34, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B,
+	0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21,
+	0x06, 0x00, 0x00, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0x1B, 0x19, 0x0A, 0x3A, 0x37,
+	0x09, 0x3B, 0x35, 0x0A, 0x3C, 0x33, 0x0B, 0x3D, 0x31, 0x0C, 0x5E, 0x0D, 0x3F, 0x0E, 0x5E, 0x0D, 0x3D, 0x31, 0x0C, 0x3C, 0x33, 0x0B, 0x3B, 0x35, 0x0A, 0x3A, 0x37, 0x09, 0x1B, 0x19, 0x0A, 0x4E,
+	0x0E, 0xAB, 0x14, 0x06, 0xE9, 0x21, 0x06, 0x58, 0x76, 0x06, 0x38, 0x3A, 0x08, 0x37, 0x5A, 0x07, 0x27, 0x3A, 0x21, 0x07, 0x26, 0x3A, 0x32, 0x06, 0x26, 0x39, 0x24, 0x06, 0x26, 0x38, 0x25, 0x06,
+	0x26, 0x46, 0x26, 0x06, 0x26, 0x35, 0x28, 0x06, 0x26, 0x34, 0x29, 0x06, 0x36, 0x32, 0x2A, 0x06, 0x27, 0x31, 0x2A, 0x07, 0x57, 0x3A, 0x07, 0x38, 0x3A, 0x08, 0x76, 0x56, 0x08, 0x35, 0xE1, 0x09,
+	0x25, 0xA4, 0x0B, 0x15, 0x38, 0x0F, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x00, 0x21, 0x0F, 0x26, 0x06,
+	0x22, 0x0F, 0x25, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x13, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6,
+	0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x11, 0x0F, 0x36, 0x06,
+	0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x13, 0x0F, 0x24, 0x07, 0x22, 0x0F, 0x34,
+	0x06, 0x21, 0x0F, 0x26, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x10, 0x0F, 0x28, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x13, 0x0F, 0x24, 0x07, 0x0F, 0x46, 0x07,
+	0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x22, 0x0F, 0x34, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x0F, 0x29,
+	0x06, 0x00, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0x16, 0x0F, 0x0A, 0x36, 0x0F, 0x08, 0x46,
+	0x0F, 0x07, 0x57, 0x0F, 0x05, 0x59, 0x0F, 0x03, 0x4B, 0x0F, 0x02, 0x13, 0x58, 0x0F, 0x13, 0xCA, 0x06, 0x22, 0xBB, 0x06, 0x21, 0xCB, 0x06, 0x11, 0x5A, 0x0F, 0x11, 0x49, 0x0F, 0x02, 0x59, 0x0F,
+	0x03, 0x57, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x16, 0x0F, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x2A, 0x28, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x36, 0x0A, 0x3B,
+	0x34, 0x0B, 0x9B, 0x0C, 0x7C, 0x0D, 0xF9, 0x20, 0x06, 0xF7, 0x40, 0x06, 0xF6, 0x50, 0x06, 0x26, 0x0F, 0x09, 0x25, 0x0F, 0x0A, 0x00, 0x25, 0x0F, 0x31, 0x06, 0x25, 0x36, 0x28, 0x06, 0x25, 0x65,
+	0x26, 0x06, 0x35, 0x33, 0x31, 0x26, 0x06, 0x76, 0x33, 0x25, 0x06, 0x66, 0x35, 0x24, 0x06, 0x38, 0x77, 0x07, 0x0F, 0x73, 0x07, 0x0F, 0x35, 0x09, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93,
+	0x06, 0x3B, 0x23, 0x34, 0x06, 0x14, 0x25, 0x34, 0x25, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06, 0x34, 0x23, 0x24, 0x26, 0x06, 0x25, 0x23, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x17, 0x32,
+	0x23, 0x24, 0x08, 0xDB, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x17, 0x22,
+	0x24, 0x26, 0x06, 0x26, 0x22, 0x24, 0x26, 0x06, 0x25, 0x23, 0x24, 0x16, 0x07, 0x24, 0x24, 0x24, 0x25, 0x07, 0x24, 0x34, 0x23, 0x24, 0x08, 0x14, 0xD6, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29,
+	0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x17, 0x33, 0x93, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x25, 0x23, 0x34, 0x25, 0x06, 0x34, 0x23, 0x24, 0x26, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06,
+	0x24, 0x24, 0x24, 0x16, 0x07, 0x34, 0x23, 0x24, 0x25, 0x07, 0x35, 0x32, 0x23, 0x24, 0x08, 0x26, 0xD3, 0x08, 0x17, 0xF3, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74,
+	0x07, 0x3B, 0x93, 0x06, 0x35, 0x33, 0x23, 0x34, 0x06, 0x24, 0x24, 0x34, 0x25, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06, 0x00, 0x25, 0x23, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x26, 0x32,
+	0x23, 0x24, 0x08, 0x35, 0xD3, 0x08, 0x34, 0xF4, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x26, 0x22, 0x34,
+	0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x26, 0x32, 0x23, 0x24, 0x08, 0x26, 0xD3, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F,
+	0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x52, 0x23, 0x34, 0x25, 0x06, 0x31, 0x31, 0x22, 0x24, 0x26, 0x06, 0x21, 0x23, 0x22, 0x24, 0x26, 0x06, 0x21, 0x23, 0x22,
+	0x24, 0x16, 0x07, 0x21, 0x23, 0x22, 0x24, 0x25, 0x07, 0x52, 0x33, 0x23, 0x24, 0x08, 0x33, 0xD5, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B,
+	0x93, 0x06, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x00, 0x00, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x24, 0x08, 0xCB, 0x09, 0x00, 0xEB, 0x07, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24,
+	0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08,
+	0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x24, 0x2A, 0x4C, 0x22, 0x00, 0x2A, 0x2C, 0x51, 0x3A, 0x3A, 0x32, 0x01, 0x4B, 0x37, 0x07, 0x3C, 0x36, 0x08, 0x2D, 0x26, 0x09, 0x6F, 0x0B, 0xAD,
+	0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x14, 0x35, 0x24, 0x34, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06,
+	0x17, 0x32, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06,
+	0x17, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x24, 0x34, 0x24, 0x25, 0x06, 0x14, 0x36, 0x23, 0x24, 0x07, 0x7C, 0x33,
+	0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0x17, 0xC4, 0x08, 0x26, 0x33, 0x23, 0x33, 0x07, 0x25, 0x33, 0x24, 0x34, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x25,
+	0x25, 0x06, 0x00, 0x34, 0x23, 0x25, 0x25, 0x06, 0x35, 0x32, 0x24, 0x25, 0x06, 0x26, 0x33, 0x23, 0x24, 0x07, 0x17, 0x74, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09,
+	0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x26, 0x33, 0x23, 0x24, 0x07, 0x26,
+	0x74, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x14, 0x0F, 0x0C, 0x24, 0x0F, 0x0B, 0x34, 0xF3, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x26, 0xF2, 0x10, 0x06, 0x17, 0x0F, 0x09, 0x17, 0x0F,
+	0x09, 0x26, 0xF2, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06, 0x24, 0x0F, 0x0B, 0x14, 0x0F, 0x0C, 0x17, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x25, 0x0F, 0x0A, 0x34, 0xF3, 0x10, 0x06,
+	0x24, 0xF4, 0x10, 0x06, 0x00, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x17, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x26, 0x0F, 0x09,
+	0x00, 0x0F, 0x61, 0x0A, 0xAE, 0x08, 0xCD, 0x07, 0x15, 0x22, 0x33, 0x36, 0x07, 0x15, 0x12, 0x33, 0x38, 0x06, 0x25, 0x11, 0x23, 0x2A, 0x06, 0x36, 0x23, 0x2A, 0x06, 0x00, 0x46, 0x22, 0x2A, 0x06,
+	0x16, 0x31, 0x21, 0x39, 0x06, 0x16, 0x62, 0x28, 0x07, 0x25, 0xF3, 0x07, 0xCC, 0x08, 0x7F, 0x0A, 0xFA, 0x10, 0x06, 0x00, 0x35, 0xD5, 0x06, 0x24, 0x25, 0x0F, 0x04, 0x24, 0x15, 0x0F, 0x05, 0x24,
+	0x24, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x26, 0x22, 0x0F, 0x05, 0x00, 0x35, 0x52, 0x0F, 0x02, 0x34, 0xF4, 0x06, 0xEC, 0x06, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x14, 0x35,
+	0x3A, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x17, 0x32, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F,
+	0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x17, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x24, 0x34, 0x3A, 0x06, 0x14,
+	0x36, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0x17, 0xE3, 0x07, 0x26, 0x33, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06,
+	0x00, 0x34, 0x23, 0x2C, 0x06, 0x35, 0x32, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0x17, 0xE3, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x35, 0x33, 0x38, 0x07, 0x24, 0x34,
+	0x3A, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x00, 0x25, 0x23, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x35, 0x33, 0x38, 0x07, 0x34, 0xE4, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B,
+	0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x26, 0x32, 0x3A, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0x26, 0xE3, 0x07, 0xBC, 0x09,
+	0x6F, 0x0B, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x22, 0x32, 0x0A, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1A, 0x06, 0x6F, 0x23, 0x06, 0xEC, 0x06, 0xEB, 0x07, 0x3B,
+	0x47, 0x07, 0x3A, 0x36, 0x31, 0x06, 0x2A, 0x36, 0x23, 0x06, 0x2A, 0x35, 0x24, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x33, 0x26, 0x06, 0x3A, 0x31, 0x36, 0x06, 0x4B, 0x37, 0x07, 0xEB, 0x07, 0xEA,
+	0x08, 0x2A, 0x82, 0x0A, 0x1A, 0x0F, 0x06, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x14, 0x0F, 0x24, 0x06, 0x24, 0x0F, 0x23, 0x06, 0x34, 0x0F, 0x22, 0x06, 0x25, 0x0F, 0x22, 0x06, 0x26, 0x2F,
+	0x07, 0x17, 0x2F, 0x07, 0xDA, 0x09, 0xFA, 0x10, 0x06, 0x00, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x17, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x22, 0x06,
+	0x24, 0x0F, 0x22, 0x07, 0x00, 0x14, 0xD5, 0x09, 0xFA, 0x10, 0x06, 0x00, 0xEA, 0x08, 0x17, 0xF2, 0x07, 0x26, 0x5D, 0x06, 0x25, 0x0F, 0x22, 0x06, 0x34, 0x0F, 0x22, 0x06, 0x24, 0x0F, 0x23, 0x06,
+	0x00, 0x34, 0x0F, 0x21, 0x07, 0x35, 0x2F, 0x07, 0x26, 0xD2, 0x09, 0x17, 0xF2, 0x10, 0x06, 0xFA, 0x10, 0x06, 0xEA, 0x08, 0xFA, 0x07, 0x26, 0x5D, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06,
+	0x00, 0x00, 0x0F, 0x28, 0x07, 0x26, 0x2F, 0x07, 0x26, 0xD2, 0x09, 0xFA, 0x10, 0x06, 0x00, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x8C, 0x39, 0x17, 0x78, 0x35, 0x01, 0x26, 0xCB, 0x01,
+	0x25, 0x0F, 0x61, 0x03, 0x24, 0x7E, 0x05, 0x24, 0x8A, 0x08, 0x14, 0x88, 0x0B, 0x8A, 0x0E, 0x4A, 0x0F, 0x03, 0x1A, 0x0F, 0x06, 0xF5, 0xC0, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C,
+	0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08, 0x6F, 0x0B, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x26, 0x84, 0x39, 0x26, 0x78, 0x35,
+	0x01, 0x0F, 0xC4, 0x01, 0x0F, 0x68, 0x03, 0x0F, 0x75, 0x05, 0x0F, 0x81, 0x08, 0x26, 0x85, 0x0B, 0x26, 0x82, 0x0E, 0x4A, 0x0F, 0x03, 0x1A, 0x0F, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F,
+	0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x8C, 0x0C, 0x21, 0x67, 0x22, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x74, 0x24,
+	0x0C, 0x21, 0x67, 0x22, 0x0C, 0x21, 0x89, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x26,
+	0x33, 0x32, 0x34, 0x06, 0x26, 0x32, 0x33, 0x25, 0x06, 0x26, 0x22, 0x24, 0x26, 0x06, 0x00, 0x26, 0x22, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x26, 0x32, 0x23, 0x33, 0x08, 0x26, 0xE3,
+	0x07, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x20, 0x8A, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x31, 0x73,
+	0x24, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x22, 0x22, 0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x31, 0x73, 0x24, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x20, 0x8A, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65,
+	0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x24, 0x35, 0x32, 0x34, 0x06, 0x34, 0x33, 0x33, 0x25, 0x06, 0x35, 0x22, 0x24, 0x26, 0x06, 0x26,
+	0x22, 0x24, 0x26, 0x06, 0x26, 0x22, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x35, 0x32, 0x23, 0x33, 0x08, 0x34, 0xE4, 0x07, 0x24, 0xF5, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F,
+	0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C, 0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x77, 0x24,
+	0x0C, 0x6A, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x37, 0x01, 0x0F, 0x72, 0x62, 0x0F, 0x75, 0x23, 0x0F, 0x47, 0x24, 0x0F, 0x1A, 0x24, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x32,
+	0x34, 0x06, 0x3A, 0x33, 0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x33, 0x08, 0xEB, 0x33, 0x01, 0xFB, 0x60, 0xED, 0x23, 0x0F, 0x29,
+	0x24, 0x00, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x36, 0x3E, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06,
+	0x22, 0x22, 0x0F, 0x21, 0x06, 0x12, 0x23, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x11, 0x34, 0x2E, 0x07, 0x11, 0x25, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x29, 0x39, 0x09,
+	0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x17, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x3B, 0x06, 0x24, 0x34, 0x3A, 0x06,
+	0x14, 0x46, 0x46, 0x07, 0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x13, 0x32, 0x3E, 0x06, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23,
+	0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x22, 0x32, 0x2E, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x47,
+	0x3B, 0x07, 0x48, 0x48, 0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0x17, 0xE3, 0x07, 0x26, 0x33, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x34,
+	0x23, 0x2C, 0x06, 0x25, 0x23, 0x3B, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x17, 0x43, 0x46, 0x07, 0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C,
+	0x07, 0x36, 0x3E, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x36, 0x2E, 0x07, 0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48,
+	0x48, 0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x00, 0x00, 0x2A, 0x3B, 0x06, 0x3A, 0x3A, 0x06, 0x4B, 0x46, 0x07,
+	0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x10, 0x35, 0x3E, 0x06, 0x20, 0x24, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x31,
+	0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x34, 0x2E, 0x07, 0x10, 0x26, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48,
+	0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0x14, 0xE6, 0x07, 0x24, 0x35, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x25,
+	0x23, 0x3B, 0x06, 0x24, 0x34, 0x3A, 0x06, 0x14, 0x46, 0x46, 0x07, 0x3C, 0x36, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x10, 0x25, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21,
+	0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x33, 0x3E, 0x06, 0x20, 0x25, 0x2E, 0x07, 0x10, 0x36, 0x3C,
+	0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x2B, 0x2A, 0x07,
+	0x2C, 0x37, 0x08, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x25, 0x12, 0x0F, 0x07, 0x2F, 0x0F, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x26, 0x0F, 0x21, 0x06, 0x36, 0x3E, 0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06,
+	0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x27, 0x21, 0x2C, 0x06, 0x00, 0x27, 0x22, 0x2A, 0x07, 0x27, 0x23, 0x37, 0x08, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27,
+	0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x26, 0x43, 0x22,
+	0x33, 0x07, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x20, 0x24, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x00, 0x31, 0x22, 0x27, 0x27, 0x06, 0x30,
+	0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x24, 0x45, 0x22, 0x33, 0x07, 0x34, 0x33, 0x24,
+	0x34, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x35, 0x32, 0x24, 0x34, 0x06, 0x34, 0x34, 0x23, 0x34, 0x06, 0x24, 0x85, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD,
+	0x09, 0xDB, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x24, 0x34, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x8B, 0x33,
+	0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x27, 0x27, 0x32, 0x01, 0x26, 0x27, 0x87, 0x26, 0x27, 0x37, 0x23,
+	0x26, 0x27, 0x27, 0x24, 0x0F, 0x29, 0x24, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x32, 0x01, 0x2A, 0x25, 0x85, 0x2A, 0x25, 0x35,
+	0x23, 0x2A, 0x25, 0x25, 0x24, 0x3A, 0x24, 0x34, 0x24, 0x3B, 0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x10, 0x25, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27,
+	0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06,
+	0x10, 0x25, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x14, 0x46, 0x22, 0x33, 0x07, 0x24, 0x34, 0x24, 0x34, 0x06, 0x25, 0x23,
+	0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x25, 0x33, 0x24, 0x34, 0x06, 0x24, 0x35, 0x23, 0x34, 0x06, 0x14, 0x86, 0x33, 0x07,
+	0x7C, 0x23, 0x08, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30,
+	0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x28, 0x26, 0x06, 0x21, 0x23, 0x28, 0x26, 0x06, 0x22, 0x22, 0x28, 0x26, 0x06, 0x13, 0x32, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25,
+	0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x17, 0x42, 0x48, 0x32, 0x01, 0x26, 0x32, 0x3A, 0x33, 0x25, 0x23, 0x2C, 0x24,
+	0x34, 0x23, 0x2C, 0x24, 0x24, 0x24, 0x2C, 0x24, 0x34, 0x14, 0x1C, 0x25, 0x25, 0x24, 0x2A, 0x34, 0x26, 0x34, 0x36, 0x34, 0x01, 0x17, 0xF2, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D,
+	0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x20, 0x25, 0x2E, 0x07, 0x30, 0x23, 0x3F, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06,
+	0x00, 0x22, 0x22, 0x28, 0x26, 0x06, 0x31, 0x22, 0x28, 0x26, 0x06, 0x30, 0x23, 0x28, 0x26, 0x06, 0x20, 0x34, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08,
+	0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x24, 0x44, 0x48, 0x32, 0x01, 0x34, 0x33, 0x3A, 0x33, 0x35, 0x22, 0x2C, 0x24, 0x26, 0x22, 0x2C, 0x24, 0x00, 0x26, 0x13, 0x1C,
+	0x25, 0x35, 0x23, 0x2A, 0x34, 0x34, 0x35, 0x36, 0x34, 0x01, 0x24, 0xF4, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07,
+	0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x22, 0x22, 0x28, 0x26, 0x06, 0x26, 0x28, 0x26, 0x06, 0x00, 0x36, 0x27, 0x35,
+	0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x4A, 0x48, 0x32, 0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C,
+	0x24, 0x26, 0x22, 0x2C, 0x24, 0x00, 0x26, 0x13, 0x1C, 0x25, 0x2B, 0x2A, 0x34, 0x3C, 0x36, 0x34, 0x01, 0xFA, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09,
+	0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x21, 0x12, 0x26, 0x0F, 0x21, 0x51, 0x26, 0x28, 0x26, 0x41,
+	0x01, 0x26, 0x28, 0x26, 0x06, 0x00, 0x36, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01,
+	0x4A, 0x48, 0x32, 0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C, 0x24, 0x44, 0x22, 0x2C, 0x24, 0x53, 0x22, 0x2C, 0x24, 0x13, 0x22, 0x13, 0x1C, 0x25, 0x2B, 0x2A, 0x34, 0x3C, 0x36, 0x34, 0x01, 0xFA, 0x60,
+	0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x2E, 0x0F, 0x01, 0x13, 0x2A, 0x0F, 0x01, 0x22, 0x2A, 0x0F, 0x01, 0x21, 0x2B, 0x0F, 0x01, 0x30, 0x2B, 0x0F, 0x01, 0x20,
+	0x2C, 0x0F, 0x01, 0x30, 0x2B, 0x0F, 0x01, 0x21, 0x2B, 0x0F, 0x01, 0x22, 0x2A, 0x0F, 0x01, 0x13, 0x2A, 0x0F, 0x01, 0x2E, 0x0F, 0x01, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x12,
+	0xF2, 0x60, 0x06, 0x21, 0x29, 0x0F, 0x03, 0x20, 0x29, 0x0F, 0x04, 0x20, 0x28, 0x0F, 0x05, 0x10, 0x29, 0x0F, 0x05, 0x20, 0x28, 0x0F, 0x05, 0x00, 0x21, 0x37, 0x0F, 0x04, 0x12, 0xF7, 0x10, 0x06,
+	0xFB, 0x06, 0xEC, 0x06, 0x29, 0x0F, 0x06, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x29, 0x23, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x29, 0x0F, 0x06, 0x27, 0x0F, 0x08, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x27, 0x23, 0x0F, 0x03, 0x27, 0x22, 0x0F, 0x04, 0x27, 0x21, 0x0F, 0x05, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x3A, 0x0F, 0x04,
+	0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0x22, 0x0F, 0x0D, 0x30, 0x0F, 0x0E, 0x20, 0x0F, 0x0F, 0x20, 0xF4, 0x50, 0x06, 0x21, 0xF3, 0x50, 0x06, 0x00, 0x22, 0x0F, 0x0D, 0x00, 0x26, 0x0F, 0x09,
+	0x34, 0x0F, 0x0A, 0x24, 0x0F, 0x0B, 0x24, 0xF4, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x21, 0x0F, 0x0E, 0x00, 0x21, 0xF3, 0x50, 0x06, 0x00, 0x00, 0x21, 0x0F, 0x0E,
+	0x26, 0x0F, 0x09, 0x00, 0x26, 0xF2, 0x10, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x09, 0x20, 0x0F, 0x0F, 0x30, 0x0F, 0x0E, 0x31, 0x0F, 0x0D, 0x22, 0xF2, 0x50, 0x06, 0x00, 0x00, 0x31, 0x0F, 0x0D, 0x30,
+	0x0F, 0x0E, 0x24, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0xF2, 0x10, 0x06, 0x00, 0x00, 0x35, 0x0F, 0x09, 0x34, 0x0F, 0x0A, 0x0F, 0x3D, 0x01, 0x0F, 0x6B, 0xF6, 0x60, 0x23, 0xF6,
+	0x50, 0x24, 0x00, 0x0F, 0x3D, 0x01, 0x0F, 0x6B, 0x25, 0xF3, 0x20, 0x23, 0x25, 0xF3, 0x10, 0x24, 0x00, 0x22, 0xF2, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x0F, 0x0F, 0x02, 0x0F, 0x16, 0x0A, 0x0F, 0x36, 0x08, 0x0F, 0x55, 0x07, 0x0F, 0x37, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x3F, 0x06, 0x26, 0x3E,
+	0x07, 0xF6, 0x40, 0x07, 0xF6, 0x30, 0x08, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x2F, 0x00, 0x00, 0x25, 0xF3, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x25, 0xF3, 0x50, 0x02, 0x0F, 0x16, 0x0A, 0x0F,
+	0x36, 0x08, 0x0F, 0x55, 0x07, 0x0F, 0x37, 0x07, 0x0F, 0x38, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x3F, 0x06, 0x20, 0x24, 0x3E,
+	0x07, 0x30, 0xF3, 0x40, 0x07, 0x21, 0xF3, 0x30, 0x08, 0x22, 0xF2, 0x20, 0x09, 0x27, 0x0F, 0x26, 0x26, 0x0F, 0x27, 0x35, 0xF2, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x35, 0xF2, 0x50, 0x02, 0x26, 0x0F,
+	0x09, 0x27, 0x0F, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x2F, 0x0F, 0x2E, 0x0F, 0x01, 0x4D, 0x0F, 0x7C, 0x28, 0x12, 0x3B, 0x42, 0x57, 0x3A, 0x44, 0x46, 0x01, 0x39, 0x46, 0x0A,
+	0x38, 0x39, 0x09, 0x37, 0x4B, 0x07, 0x36, 0x4D, 0x06, 0x26, 0x3F, 0x06, 0x16, 0x0F, 0x22, 0x06, 0x0F, 0x1A, 0x06, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x32, 0x0C, 0x0F, 0x31, 0x0D, 0x5F, 0x27,
+	0x12, 0x7E, 0x56, 0x3D, 0x42, 0x45, 0x01, 0x3C, 0x45, 0x08, 0x3B, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C, 0x06, 0x1A, 0x1E, 0x06, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x32, 0x0C, 0x0F, 0x31,
+	0x0D, 0x4F, 0x0D, 0x7E, 0x0B, 0x3D, 0x42, 0x0A, 0x3C, 0x45, 0x08, 0x3B, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C, 0x06, 0x1A, 0x1E, 0x06, 0xF6, 0x50, 0x06, 0x13, 0xF2, 0x50, 0x06, 0x22, 0xF2,
+	0x50, 0x06, 0x12, 0x0F, 0x26, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xF2, 0x60, 0x06, 0x21, 0xF2, 0x60, 0x06, 0x11,
+	0xF3, 0x60, 0x06, 0x20, 0x0F, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x29, 0x21, 0x12, 0x0F, 0x29, 0x51, 0x0F, 0x29, 0x41, 0x01, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0xF5, 0x60, 0x21, 0x12, 0xF5, 0x60, 0x51, 0xF5, 0x60, 0x41, 0x01, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x26, 0x12, 0x2D, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E,
+	0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x25, 0x12, 0x0F, 0x07, 0x55, 0x0F, 0x07, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00,
+	0x2F, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x2F, 0x0F, 0x00, 0x0F, 0x31, 0x0D, 0x0F, 0x21, 0x0E, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x2E, 0x28, 0x06, 0x2D, 0x29, 0x06, 0x00, 0x2C, 0x2A, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x23, 0x0C, 0x0F, 0x22, 0x0D, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x49, 0x0F, 0x04, 0x4B, 0x0F, 0x02, 0x13, 0x58, 0x0F, 0x22, 0x4A, 0x0E, 0x12, 0x5C, 0x0C, 0x21, 0x5E, 0x0A, 0x11, 0x0F, 0x42, 0x09, 0x11,
+	0x0F, 0x53, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x17, 0x22, 0x0F, 0x05, 0x26, 0x22, 0x0F, 0x05, 0x25, 0x23,
+	0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x24, 0x34, 0x0F, 0x04, 0x14, 0xF5, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x49, 0x0F, 0x04,
+	0x4B, 0x0F, 0x02, 0x5C, 0x2A, 0x12, 0x4E, 0x59, 0x5F, 0x47, 0x01, 0x0F, 0x52, 0x0A, 0x0F, 0x44, 0x09, 0x0F, 0x55, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00,
+	0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x2F, 0x12, 0x2A, 0x5F, 0x2A, 0x4F, 0x01, 0x2A, 0x0F, 0x05, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x46, 0x0F, 0x07, 0x10, 0x56, 0x0F, 0x05, 0x20, 0x47, 0x0F, 0x04, 0x21, 0x48, 0x0F, 0x02, 0x31, 0x58, 0x0F, 0x22, 0x4A, 0x0E, 0x31, 0x5B, 0x0C, 0x21, 0x5E, 0x0A, 0x20, 0x0F, 0x42, 0x09,
+	0x10, 0x0F, 0x54, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x14, 0xF5, 0x10, 0x06, 0x24, 0x26, 0x0F, 0x03, 0x25, 0x24, 0x0F, 0x04, 0x35, 0x22, 0x0F, 0x05,
+	0x26, 0x22, 0x0F, 0x05, 0x35, 0x22, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x34, 0x0F, 0x04, 0x14, 0xF5, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0x36, 0x13, 0x0F, 0x04, 0x76, 0x0F, 0x04, 0x66,
+	0x0F, 0x05, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06,
+	0x00, 0x00, 0x29, 0x0F, 0x06, 0x28, 0x0F, 0x07, 0x27, 0x0F, 0x08, 0x00, 0x26, 0x2F, 0x07, 0x26, 0x3E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x36, 0x2F, 0x06, 0x37, 0x4C, 0x06,
+	0xF7, 0x30, 0x07, 0xF8, 0x10, 0x08, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x2A, 0x0F, 0x23, 0x3A, 0x0F, 0x22, 0xFA, 0x70, 0xFB, 0x60,
+	0xFC, 0x30, 0x02, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D, 0x07, 0x21, 0x33, 0x3E, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x33, 0x2E, 0x07, 0x27, 0x2E, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x26, 0x33, 0x47, 0x07, 0x26, 0x32, 0x3A, 0x06, 0x26,
+	0x22, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x26, 0x32, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0xEB, 0x07, 0xCC, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D,
+	0x07, 0x20, 0x34, 0x3E, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x30, 0x33, 0x2E, 0x07, 0x20,
+	0x25, 0x2E, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x24, 0x35, 0x47, 0x07, 0x34, 0x33, 0x3A, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x26,
+	0x22, 0x2C, 0x06, 0x00, 0x00, 0x35, 0x32, 0x3A, 0x06, 0x34, 0x34, 0x38, 0x07, 0x24, 0xE5, 0x07, 0xCC, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D,
+	0x07, 0x13, 0x32, 0x3E, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x10, 0x12, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06,
+	0x21, 0x33, 0x2E, 0x07, 0x20, 0x25, 0x2E, 0x07, 0x20, 0x45, 0x4A, 0x07, 0x10, 0x57, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x17, 0x33, 0x47, 0x07, 0x26, 0x32,
+	0x3A, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x00, 0x14, 0x12, 0x22, 0x2C, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x25, 0x34, 0x38, 0x07, 0x24, 0xE5, 0x07, 0x24, 0xC6, 0x08, 0x7C, 0x0D,
+	0xCA, 0x0A, 0xE9, 0x09, 0x48, 0x57, 0x08, 0x37, 0x4B, 0x07, 0x27, 0x3D, 0x07, 0x27, 0x3E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4B, 0x46, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00,
+	0x3A, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0xCC, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x34, 0x06, 0x3B,
+	0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x13, 0x22, 0x28, 0x0E, 0x22, 0x22, 0x28, 0x0E, 0x12, 0x23, 0x28, 0x0E, 0x21,
+	0x23, 0x28, 0x0E, 0x11, 0x24, 0x48, 0x0C, 0x11, 0x24, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F, 0x1A, 0x06, 0xFA, 0x10,
+	0x06, 0x00, 0x17, 0xF2, 0x10, 0x06, 0x26, 0x24, 0x0F, 0x03, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x26, 0x28,
+	0x29, 0x12, 0x26, 0x28, 0x59, 0x26, 0x28, 0x49, 0x01, 0x26, 0x48, 0x0C, 0x26, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F,
+	0x1A, 0x06, 0xFA, 0x10, 0x21, 0x12, 0xFA, 0x10, 0x51, 0xFA, 0x10, 0x41, 0x01, 0x2C, 0x0F, 0x03, 0x2A, 0x0F, 0x05, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x10, 0x25, 0x28, 0x0E,
+	0x20, 0x24, 0x28, 0x0E, 0x21, 0x23, 0x28, 0x0E, 0x31, 0x22, 0x28, 0x0E, 0x22, 0x22, 0x28, 0x0E, 0x31, 0x22, 0x28, 0x0E, 0x21, 0x23, 0x48, 0x0C, 0x20, 0x24, 0x58, 0x0B, 0x10, 0x35, 0x86, 0x09,
+	0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F, 0x1A, 0x06, 0x14, 0x0F, 0x0C, 0x24, 0xF4, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x35, 0xF2, 0x10, 0x06, 0x26,
+	0x24, 0x0F, 0x03, 0x35, 0x22, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36,
+	0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x13, 0x22, 0x36, 0x27, 0x06, 0x22, 0x22, 0x36, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x20, 0x24, 0x37, 0x26, 0x06,
+	0x10, 0x35, 0x36, 0x35, 0x06, 0x37, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x7B, 0x35, 0x06, 0x3A, 0x32, 0x35, 0x06, 0x2A,
+	0x24, 0x26, 0x06, 0x17, 0x22, 0x34, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x35, 0x24, 0x06, 0x24, 0x34, 0x34, 0x33, 0x06, 0x14, 0x36, 0x74, 0x07,
+	0x3B, 0x74, 0x07, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x13, 0x32, 0x34, 0x37, 0x06, 0x22, 0x22, 0x26, 0x28, 0x06, 0x21, 0x23, 0x36,
+	0x27, 0x06, 0x30, 0x23, 0x36, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x21, 0x23, 0x37, 0x26, 0x06, 0x22, 0x32, 0x36, 0x35, 0x06, 0x13, 0x33, 0x36, 0x33, 0x07,
+	0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x17, 0x73, 0x35, 0x06, 0x26, 0x32, 0x32, 0x35, 0x06, 0x25, 0x23, 0x24, 0x26, 0x06, 0x34, 0x23, 0x34,
+	0x25, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x25, 0x23, 0x35, 0x24, 0x06, 0x26, 0x32, 0x34, 0x33, 0x06, 0x17, 0x33, 0x74, 0x07, 0x3B, 0x74, 0x07, 0x0F, 0x16, 0x0A,
+	0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x26, 0x36, 0x27, 0x24, 0x26, 0x36, 0x27, 0x11, 0x22, 0x26, 0x27,
+	0x47, 0x22, 0x26, 0x27, 0x27, 0x51, 0x26, 0x37, 0x26, 0x32, 0x01, 0x36, 0x36, 0x35, 0x06, 0x37, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B,
+	0x35, 0x07, 0x7B, 0x35, 0x06, 0x3A, 0x32, 0x35, 0x06, 0x2A, 0x24, 0x26, 0x24, 0x2A, 0x34, 0x25, 0x11, 0x22, 0x2A, 0x25, 0x45, 0x22, 0x2A, 0x25, 0x25, 0x51, 0x2A, 0x35, 0x24, 0x32, 0x01, 0x3A,
+	0x34, 0x33, 0x06, 0x3B, 0x74, 0x07, 0x00, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x10, 0x35, 0x34, 0x37, 0x06, 0x20, 0x24, 0x26, 0x28,
+	0x06, 0x21, 0x23, 0x36, 0x27, 0x06, 0x31, 0x22, 0x36, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x37, 0x26, 0x06, 0x20, 0x34, 0x36, 0x35, 0x06, 0x10,
+	0x36, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x14, 0x76, 0x35, 0x06, 0x24, 0x34, 0x32, 0x35, 0x06, 0x25, 0x23, 0x24, 0x26,
+	0x06, 0x35, 0x22, 0x34, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x35, 0x24, 0x06, 0x24, 0x34, 0x34, 0x33, 0x06, 0x14, 0x36, 0x74, 0x07, 0x3B, 0x74,
+	0x07, 0x1D, 0x45, 0x09, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x21, 0x12, 0xF6, 0x50, 0x51, 0xF6, 0x50, 0x41, 0x01, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x10, 0x07, 0xF7, 0x40, 0x06, 0xF7, 0x40, 0x21, 0x12, 0x2A, 0x2C, 0x51, 0x2A, 0x2C, 0x41, 0x01, 0x2A, 0x2C, 0x06, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x10, 0x25,
+	0x0F, 0x09, 0x20, 0x24, 0x0F, 0x09, 0x21, 0x23, 0x0F, 0x09, 0x31, 0xF2, 0x50, 0x06, 0x22, 0xF2, 0x50, 0x06, 0x31, 0xF2, 0x50, 0x06, 0x21, 0x23, 0x0F, 0x09, 0x20, 0x24, 0x0F, 0x09, 0x10, 0x25,
+	0x0F, 0x09, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x10, 0x07, 0xF7, 0x40, 0x06, 0x00, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x25, 0x12, 0x0F, 0x07, 0x55, 0x0F, 0x07, 0x26, 0x0F,
+	0x09, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x2A, 0x24, 0x0E, 0x00, 0xF9, 0x10, 0x07, 0xF7,
+	0x40, 0x06, 0x00, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x22, 0x0F, 0x24, 0x07, 0x30, 0x0F, 0x35, 0x06, 0x20, 0x0F, 0x27, 0x06,
+	0x00, 0x21, 0x0F, 0x26, 0x06, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x31, 0x0F, 0x24, 0x07, 0x20, 0x0F, 0x44, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07,
+	0x26, 0xF2, 0x10, 0x06, 0x34, 0x0F, 0x31, 0x06, 0x24, 0x0F, 0x23, 0x06, 0x00, 0x25, 0x0F, 0x22, 0x06, 0x00, 0x26, 0x2F, 0x07, 0x26, 0x2E, 0x08, 0x35, 0xF2, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06,
+	0xFA, 0x10, 0x06, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x21, 0x0F, 0x35, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x00, 0x00, 0x00, 0x00, 0x21, 0x0F, 0x35,
+	0x06, 0x21, 0x0F, 0x25, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x26,
+	0x2F, 0x07, 0x26, 0x2E, 0x08, 0x26, 0xF2, 0x10, 0x06, 0xFA, 0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x20, 0x0F, 0x26, 0x07, 0x30, 0x0F, 0x35, 0x06,
+	0x31, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x00, 0x00, 0x31, 0x0F, 0x25, 0x06, 0x30, 0x0F, 0x35, 0x06, 0x20, 0x0F, 0x26, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA,
+	0x08, 0xFA, 0x07, 0x24, 0xF4, 0x10, 0x06, 0x34, 0x0F, 0x31, 0x06, 0x35, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x35, 0x2F, 0x07, 0x34, 0x2F, 0x08, 0x24, 0xF4, 0x10, 0x06, 0xFA,
+	0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x31, 0x0F, 0x34, 0x06, 0x50, 0x0F, 0x24, 0x06, 0x10, 0x23, 0x0F, 0x23, 0x06, 0x00, 0x00,
+	0x50, 0x0F, 0x24, 0x06, 0x31, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x33, 0x0F, 0x32, 0x06, 0x52,
+	0x0F, 0x22, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x52, 0x0F, 0x21, 0x07, 0x33, 0x0F, 0x21, 0x08, 0xFA, 0x10, 0x06, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F,
+	0x46, 0x07, 0x13, 0x0F, 0x24, 0x07, 0x22, 0x0F, 0x34, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x00, 0x10, 0x12, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x21, 0x0F, 0x35, 0x06,
+	0x20, 0x0F, 0x26, 0x07, 0x20, 0x0F, 0x44, 0x07, 0x10, 0xF5, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x17, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x22,
+	0x06, 0x24, 0x0F, 0x23, 0x06, 0x00, 0x14, 0x12, 0x2F, 0x07, 0x26, 0x2E, 0x08, 0x25, 0xF3, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46,
+	0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x29, 0x32, 0x01, 0x0F, 0x89, 0x0F, 0x39, 0x23, 0x0F, 0x29, 0x24, 0x0F, 0x38, 0x24, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6,
+	0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x32, 0x01, 0x0F, 0x28, 0x61, 0x0F, 0x27, 0x12, 0x23, 0xFA,
+	0x10, 0x24, 0x00, 0xFA, 0x10, 0x06, 0x26, 0x0F, 0x09, 0x56, 0x0F, 0x06, 0x96, 0x0F, 0x02, 0xA8, 0x0E, 0xAC, 0x0A, 0x0F, 0x91, 0x07, 0x0F, 0x74, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x13,
+	0x8C, 0x08, 0x22, 0x98, 0x0B, 0x21, 0x86, 0x0F, 0x30, 0x73, 0x0F, 0x04, 0x20, 0x34, 0x0F, 0x08, 0x30, 0x73, 0x0F, 0x04, 0x21, 0x86, 0x0F, 0x22, 0x98, 0x0B, 0x13, 0x8C, 0x08, 0x0F, 0x74, 0x06,
+	0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x0F, 0x91, 0x07, 0x9C, 0x0B, 0xA8, 0x0E, 0x96, 0x0F, 0x02, 0x56, 0x0F, 0x06, 0x2A, 0x0F, 0x05, 0x6A, 0x0F, 0x01, 0xAA, 0x0C, 0xAE, 0x08, 0x0F, 0x74, 0x06,
+	0x0F, 0x29, 0x06, 0x17, 0x6C, 0x06, 0x26, 0x88, 0x08, 0x25, 0x85, 0x0C, 0x34, 0x63, 0x0F, 0x01, 0x24, 0x24, 0x0F, 0x05, 0x34, 0x63, 0x0F, 0x01, 0x25, 0x85, 0x0C, 0x26, 0x88, 0x08, 0x17, 0x6C,
+	0x06, 0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x9F, 0x08, 0xAA, 0x0C, 0x6A, 0x0F, 0x01, 0x16, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x46, 0x0F, 0x07, 0x47, 0x0F, 0x06, 0x58, 0x0F, 0x04, 0x13, 0x46, 0x0F,
+	0x03, 0x22, 0x57, 0x0F, 0x01, 0x21, 0x4A, 0x0F, 0x30, 0xCB, 0x06, 0x20, 0xBD, 0x06, 0x30, 0xCB, 0x06, 0x21, 0x4A, 0x0F, 0x22, 0x57, 0x0F, 0x01, 0x13, 0x46, 0x0F, 0x03, 0x58, 0x0F, 0x04, 0x47,
+	0x0F, 0x06, 0x46, 0x0F, 0x07, 0x26, 0x0F, 0x09, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x17, 0x84, 0x2A, 0x26, 0x77, 0x37, 0x25, 0x7B, 0x42, 0x01, 0x34, 0x8F, 0x02, 0x24, 0x0F, 0x61,
+	0x04, 0x34, 0x6C, 0x07, 0x25, 0x69, 0x0A, 0x26, 0x75, 0x0C, 0x17, 0x72, 0x0F, 0x4A, 0x0F, 0x03, 0x16, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x46, 0x0F, 0x07, 0x47, 0x0F, 0x06, 0x58, 0x0F, 0x04, 0x4A,
+	0x0F, 0x03, 0x31, 0x57, 0x0F, 0x01, 0x31, 0x49, 0x0F, 0xCE, 0x06, 0xBF, 0x06, 0xCE, 0x06, 0x4D, 0x0F, 0x31, 0x57, 0x0F, 0x01, 0x31, 0x46, 0x0F, 0x03, 0x58, 0x0F, 0x04, 0x47, 0x0F, 0x06, 0x46,
+	0x0F, 0x07, 0x26, 0x0F, 0x09, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x4B, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23, 0x06, 0x13, 0x22, 0x47, 0x25, 0x06, 0x22,
+	0x22, 0x46, 0x26, 0x06, 0x12, 0x23, 0x45, 0x27, 0x06, 0x21, 0x23, 0x43, 0x29, 0x06, 0x11, 0x24, 0x42, 0x2A, 0x06, 0x11, 0x24, 0x41, 0x2B, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E, 0x06, 0x26, 0x0F,
+	0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47, 0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x17, 0x22, 0x45, 0x23, 0x06, 0x26, 0x22, 0x43, 0x25, 0x06,
+	0x25, 0x23, 0x42, 0x26, 0x06, 0x24, 0x24, 0x41, 0x27, 0x06, 0x24, 0x54, 0x29, 0x06, 0x14, 0x45, 0x2A, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D,
+	0x06, 0x26, 0x4B, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23, 0x06, 0x26, 0x47, 0x25, 0x06, 0x22, 0x22, 0x46, 0x26, 0x06, 0x22, 0x22, 0x45, 0x27, 0x06, 0x22, 0x22, 0x43, 0x29, 0x06,
+	0x26, 0x42, 0x2A, 0x06, 0x26, 0x41, 0x2B, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47,
+	0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x26, 0x22, 0x45, 0x23, 0x06, 0x26, 0x22, 0x43, 0x25, 0x06, 0x26, 0x22, 0x42, 0x26, 0x06, 0x2A, 0x41, 0x27, 0x06, 0x5A, 0x29, 0x06, 0x4A, 0x2A, 0x06, 0x3A,
+	0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x4B, 0x21, 0x06, 0x10, 0x25, 0x4A, 0x22, 0x06, 0x20, 0x24, 0x49, 0x23, 0x06, 0x21, 0x23, 0x47, 0x25,
+	0x06, 0x31, 0x22, 0x46, 0x26, 0x06, 0x22, 0x22, 0x45, 0x27, 0x06, 0x31, 0x22, 0x43, 0x29, 0x06, 0x21, 0x23, 0x42, 0x2A, 0x06, 0x20, 0x24, 0x41, 0x2B, 0x06, 0x10, 0x55, 0x2D, 0x06, 0x46, 0x2E,
+	0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x14, 0x25, 0x59, 0x06, 0x24, 0x24, 0x47, 0x21, 0x06, 0x25, 0x23, 0x46, 0x22, 0x06, 0x35, 0x22, 0x45, 0x23,
+	0x06, 0x26, 0x22, 0x43, 0x25, 0x06, 0x35, 0x22, 0x42, 0x26, 0x06, 0x25, 0x23, 0x41, 0x27, 0x06, 0x24, 0x54, 0x29, 0x06, 0x14, 0x45, 0x2A, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0xF7, 0x40,
+	0x06, 0xF6, 0x50, 0x06, 0xF5, 0x60, 0x06, 0x25, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x26, 0x27, 0x06, 0x00, 0x23, 0x22, 0x26, 0x27, 0x06, 0x00, 0x27, 0x26, 0x27,
+	0x06, 0x00, 0x00, 0x23, 0x22, 0x26, 0x27, 0x06, 0x00, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00,
+	0x27, 0x25, 0x0F, 0x01, 0x27, 0x15, 0x0F, 0x02, 0x27, 0x24, 0x0F, 0x02, 0x27, 0x24, 0x19, 0x07, 0x27, 0x24, 0x28, 0x07, 0x27, 0x24, 0x38, 0x06, 0x27, 0x24, 0x29, 0x06, 0x2D, 0x29, 0x06, 0x00,
+	0x2E, 0x37, 0x06, 0xBE, 0x07, 0x9F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x14, 0x22, 0x0F, 0x08, 0x23, 0x22, 0x0F, 0x08, 0x13, 0x23, 0x0F, 0x08, 0x22,
+	0x23, 0x0F, 0x08, 0x12, 0x24, 0x0F, 0x08, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x0F, 0x0F, 0x02, 0x7D, 0x0C, 0xBB, 0x0A, 0x3A, 0x22, 0x42, 0x09, 0x29, 0x24, 0x34, 0x08, 0x28, 0x25, 0x35, 0x07, 0x28,
+	0x25, 0x26, 0x07, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x3D, 0x06, 0x28, 0x2D, 0x07, 0x48, 0x3A, 0x07, 0x49, 0x47, 0x08, 0x3A, 0x37, 0x09, 0x1B, 0x19, 0x0A, 0x0F, 0x0F,
+	0x02, 0x0F, 0x26, 0x09, 0x4A, 0x37, 0x08, 0x69, 0x37, 0x07, 0x28, 0x33, 0x27, 0x07, 0x28, 0x24, 0x37, 0x06, 0x27, 0x35, 0x27, 0x06, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x27, 0x36, 0x26, 0x06,
+	0x27, 0x27, 0x26, 0x06, 0x00, 0x28, 0x26, 0x25, 0x07, 0x38, 0x26, 0x33, 0x07, 0x39, 0x75, 0x08, 0x2A, 0x56, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x23,
+	0x0F, 0x0C, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x23, 0x0F, 0x0C, 0x00, 0x0F, 0x26, 0x09, 0x0F, 0x46, 0x07, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x27, 0x2F, 0x06, 0x00, 0x00,
+	0x27, 0x2E, 0x07, 0xF7, 0x20, 0x08, 0xF7, 0x10, 0x09, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x55, 0x07, 0xAD, 0x09, 0xD7, 0x0C, 0x67, 0x0F, 0x04, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x35, 0x06, 0x0F, 0x31, 0x33, 0x07, 0x0F, 0x72, 0x08, 0x0F, 0x53, 0x09, 0x0F, 0x0F,
+	0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x35, 0x06,
+	0x0F, 0x31, 0x33, 0x07, 0x0F, 0x72, 0x08, 0x0F, 0x53, 0x09, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x25, 0x0F, 0x01, 0x27, 0x24, 0x0F, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0F, 0x02, 0x2E, 0x0F, 0x01, 0xCE, 0x06, 0x0F, 0xA1, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x14, 0x39, 0x0F, 0x23,
+	0x68, 0x0D, 0x13, 0x38, 0x41, 0x0C, 0x22, 0x37, 0x44, 0x0A, 0x12, 0x46, 0x46, 0x09, 0x12, 0x35, 0x59, 0x07, 0x37, 0x4C, 0x06, 0x27, 0x3E, 0x06, 0x17, 0x0F, 0x12, 0x06, 0x0F, 0x0F, 0x02, 0x00,
+	0x00, 0xF7, 0x40, 0x06, 0x17, 0x0F, 0x12, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x0F, 0x0F, 0x02, 0x17, 0x0F, 0x09, 0x37, 0x3D, 0x06,
+	0x47, 0x2D, 0x06, 0x58, 0x2B, 0x06, 0x21, 0x57, 0x29, 0x06, 0x31, 0x48, 0x37, 0x06, 0x32, 0x58, 0x34, 0x07, 0x23, 0x4A, 0x41, 0x08, 0x23, 0x6C, 0x09, 0x23, 0x4C, 0x0B, 0x23, 0x4A, 0x0D, 0x32,
+	0x48, 0x0F, 0x31, 0x57, 0x0F, 0x01, 0x21, 0x56, 0x0F, 0x03, 0x57, 0x0F, 0x05, 0x37, 0x0F, 0x07, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x53, 0x09, 0x5F, 0x0C, 0x7D, 0x0C, 0x5A,
+	0x23, 0x0C, 0x58, 0x25, 0x0C, 0x37, 0x28, 0x0C, 0x00, 0x58, 0x25, 0x0C, 0x5A, 0x23, 0x0C, 0x7D, 0x0C, 0x5F, 0x0C, 0x0F, 0x53, 0x09, 0x0F, 0x55, 0x07, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F,
+	0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x36, 0x35, 0x06, 0x27, 0x37, 0x33, 0x07, 0x0F, 0x72, 0x08, 0x0F, 0x53, 0x09, 0x0F,
+	0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x34, 0x27, 0x06, 0x28, 0x14, 0x21, 0x25, 0x07, 0x78, 0x22, 0x33, 0x07, 0x59,
+	0x73, 0x08, 0x0F, 0x53, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x38, 0x06, 0x0F,
+	0x56, 0x06, 0x0F, 0x92, 0x06, 0xCA, 0x22, 0x06, 0xA7, 0x27, 0x06, 0x37, 0x2E, 0x06, 0x27, 0x2F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x0F, 0x02,
+	0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x17, 0x0F, 0x12, 0x06, 0x27, 0x3E, 0x06, 0x37,
+	0x4C, 0x06, 0x48, 0x58, 0x07, 0x49, 0x55, 0x09, 0x3B, 0x43, 0x0B, 0x8C, 0x0C, 0x5D, 0x0E, 0x2E, 0x0F, 0x01, 0x2F, 0x0F, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x0F, 0x00, 0x3E, 0x0F, 0x00, 0x6D,
+	0x0D, 0x3C, 0x41, 0x0C, 0x4A, 0x44, 0x0A, 0x39, 0x47, 0x09, 0x38, 0x4A, 0x07, 0x37, 0x4C, 0x06, 0x27, 0x3E, 0x06, 0x17, 0x0F, 0x12, 0x06, 0x0F, 0x0F, 0x02, 0x1A, 0x1B, 0x09, 0x39, 0x39, 0x08,
+	0x48, 0x49, 0x07, 0x38, 0x2C, 0x07, 0x37, 0x3D, 0x06, 0x27, 0x2F, 0x06, 0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x37, 0x44, 0x25, 0x07, 0x28, 0x44, 0x34, 0x07, 0x78, 0x72, 0x08, 0x4A, 0x54,
+	0x09, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x47, 0x06, 0x0F, 0x46, 0x07, 0x0F, 0x44, 0x09, 0x0F, 0x43, 0x0A, 0x0F, 0x41, 0x0C, 0x5E, 0x0D, 0x4D, 0x0F, 0x5B, 0x0F, 0x01, 0x4A,
+	0x0F, 0x03, 0x48, 0x0F, 0x05, 0x47, 0x0F, 0x06, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x47, 0x06, 0x21, 0x0F, 0x43, 0x07, 0x31, 0x4F, 0x09, 0x32, 0x4D,
+	0x0A, 0x23, 0x4B, 0x0C, 0x23, 0x59, 0x0D, 0x23, 0x48, 0x0F, 0x23, 0x56, 0x0F, 0x01, 0x32, 0x45, 0x0F, 0x03, 0x31, 0x44, 0x0F, 0x05, 0x21, 0x44, 0x0F, 0x06, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F,
+	0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x3E, 0x0F, 0x6D, 0x0D, 0x3C, 0x41, 0x0C, 0x3B, 0x44, 0x0A, 0x49, 0x46, 0x09, 0x38, 0x59, 0x07, 0x37, 0x4C, 0x06, 0x27, 0x3E, 0x06,
+	0x17, 0x0F, 0x12, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x55, 0x07, 0xAD, 0x09, 0xD7, 0x0C, 0x67, 0x0F, 0x04, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06,
+	0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x57, 0x0F, 0x05, 0x69, 0x0F, 0x02, 0x6B, 0x0F, 0x6E, 0x0C, 0x0F, 0x61, 0x0A, 0x0F, 0x64, 0x07, 0x0F, 0x56, 0x06, 0x00, 0x0F, 0x64, 0x07,
+	0x0F, 0x61, 0x0A, 0x6E, 0x0C, 0x5C, 0x0F, 0x69, 0x0F, 0x02, 0x57, 0x0F, 0x05, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x7D, 0x0C, 0xBB, 0x0A, 0x3A, 0x37, 0x09, 0x29, 0x3A, 0x08, 0x28, 0x3C, 0x07, 0x28, 0x2D, 0x07, 0x27, 0x2F, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x2D, 0x07, 0x00, 0x29, 0x2B, 0x08, 0x3A, 0x37, 0x09, 0xBB, 0x0A, 0x7D, 0x0C, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x27, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+	0x25, 0x0F, 0x38, 0x33, 0x0F, 0x79, 0x0F, 0x01, 0x5A, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x7D, 0x0C, 0xBB, 0x0A, 0x3A, 0x46, 0x09, 0x29, 0x3A, 0x08, 0x28, 0x3C, 0x07, 0x28, 0x2D, 0x07, 0x27, 0x2F,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x3D, 0x06, 0x28, 0x2D, 0x07, 0x48, 0x3A, 0x07, 0x49, 0x47, 0x08, 0x3A, 0x37, 0x09, 0x1B, 0x19, 0x0A, 0x0F, 0x0F, 0x02, 0x27, 0x0F, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x17, 0x0F, 0x09, 0x37, 0x3D, 0x06, 0x47, 0x2D, 0x06, 0x58, 0x2B, 0x06, 0x5A, 0x29,
+	0x06, 0x4C, 0x37, 0x06, 0x5D, 0x34, 0x07, 0x4F, 0x41, 0x08, 0x0F, 0x62, 0x09, 0x0F, 0x42, 0x0B, 0x4F, 0x0D, 0x4D, 0x0F, 0x5B, 0x0F, 0x01, 0x59, 0x0F, 0x03, 0x57, 0x0F, 0x05, 0x37, 0x0F, 0x07,
+	0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x6D, 0x0D, 0x9B, 0x0C, 0x3A, 0x35, 0x0B, 0x2A, 0x28, 0x0A, 0x39, 0x38, 0x09, 0x29, 0x2A, 0x09, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x29, 0x2A, 0x09, 0x00,
+	0x00, 0x39, 0x38, 0x09, 0x2A, 0x28, 0x0A, 0x3A, 0x35, 0x0B, 0x9B, 0x0C, 0x6D, 0x0D, 0x0F, 0x0F, 0x02, 0x17, 0x0F, 0x12, 0x06, 0x27, 0x3E, 0x06, 0x37, 0x4C, 0x06, 0x48, 0x49, 0x07, 0x49, 0x46,
+	0x09, 0x4B, 0x43, 0x0A, 0x8C, 0x0C, 0x5E, 0x0D, 0x4E, 0x0E, 0x8C, 0x0C, 0x4B, 0x52, 0x0A, 0x49, 0x46, 0x09, 0x48, 0x58, 0x07, 0x37, 0x4C, 0x06, 0x27, 0x3E, 0x06, 0x17, 0x0F, 0x12, 0x06, 0x0F,
+	0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xA7,
+	0x0F, 0xC7, 0x0D, 0x0F, 0x22, 0x0D, 0x0F, 0x23, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x22, 0x0D, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F,
+	0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40,
+	0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x89, 0x00,
+	0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x35, 0x06, 0x0F, 0x31, 0x33, 0x07, 0x0F, 0x72, 0x08,
+	0x0F, 0x53, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x35, 0x06, 0x0F, 0x31, 0x33, 0x07, 0x0F, 0x72, 0x08, 0x0F,
+	0x53, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x2F, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x35,
+	0x06, 0x0F, 0x31, 0x33, 0x07, 0x0F, 0x72, 0x08, 0x0F, 0x53, 0x09, 0x0F, 0x0F, 0x02, 0x1B, 0x19, 0x0A, 0x3A, 0x37, 0x09, 0x49, 0x38, 0x08, 0x38, 0x3B, 0x07, 0x28, 0x2D, 0x07, 0x37, 0x3D, 0x06,
+	0x27, 0x26, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x28, 0x25, 0x26, 0x07, 0x00, 0x29, 0x24, 0x34, 0x08, 0x49, 0x22, 0x52, 0x08, 0xBB, 0x0A, 0x7D, 0x0C, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06,
+	0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0C, 0xCA, 0x0A, 0x49, 0x47, 0x08, 0x38, 0x3B, 0x07, 0x28, 0x2D, 0x07, 0x37, 0x3D, 0x06, 0x27, 0x2F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x37, 0x3D,
+	0x06, 0x28, 0x2D, 0x07, 0x38, 0x3B, 0x07, 0x49, 0x47, 0x08, 0xBB, 0x0A, 0x7D, 0x0C, 0x0F, 0x0F, 0x02, 0x0F, 0x1A, 0x06, 0x5A, 0x29, 0x06, 0x79, 0x46, 0x06, 0x38, 0x33, 0x34, 0x08, 0x37, 0x25,
+	0x42, 0x09, 0x27, 0x57, 0x0B, 0x27, 0x47, 0x0C, 0x27, 0x27, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x2D, 0x54, 0x08, 0x3C, 0x73, 0x07, 0x2C, 0x24,
+	0x33, 0x06, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x00, 0x2B, 0x24, 0x24, 0x07, 0x3B, 0x23, 0x23, 0x08, 0xDC, 0x07, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xCB, 0x09, 0xF9,
+	0x08, 0x38, 0x33, 0x35, 0x07, 0x28, 0x23, 0x29, 0x06, 0x27, 0x23, 0x2A, 0x06, 0x00, 0x36, 0x23, 0x2A, 0x06, 0x26, 0x24, 0x2A, 0x06, 0x00, 0x26, 0x34, 0x38, 0x06, 0x26, 0xC5, 0x07, 0x26, 0xA6,
+	0x08, 0x0F, 0x61, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x42, 0x33, 0x06, 0x5C, 0x71, 0x07, 0x3D, 0x53, 0x08, 0x0F, 0x0F, 0x02,
+	0x00, 0xFB, 0x06, 0x00, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x47, 0x06, 0x0F, 0x74, 0x06, 0xDD, 0x06, 0xAB, 0x23, 0x06, 0x5B, 0x28, 0x06, 0x2B, 0x2B, 0x06,
+	0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x0F, 0x02, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x22, 0x33, 0x07, 0x3B, 0x23, 0x24, 0x07, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3B,
+	0x23, 0x25, 0x06, 0x3C, 0x22, 0x24, 0x07, 0x6D, 0x33, 0x07, 0x4F, 0x23, 0x08, 0x1B, 0x1D, 0x06, 0x2B, 0x3A, 0x06, 0x4B, 0x56, 0x06, 0x3D, 0x53, 0x08, 0x3E, 0x41, 0x0A, 0x5F, 0x0C, 0x0F, 0x31,
+	0x0D, 0x0F, 0x22, 0x0D, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x0D, 0x0F, 0x31, 0x0D, 0x5F, 0x0C, 0x3E, 0x41, 0x0A, 0x3D, 0x53, 0x08, 0x4B, 0x56, 0x06, 0x2B, 0x3A, 0x06, 0x1B, 0x1D, 0x06, 0x0F, 0x0F,
+	0x02, 0x2D, 0x27, 0x08, 0x3C, 0x37, 0x07, 0x3B, 0x39, 0x06, 0x2B, 0x2B, 0x06, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x3B, 0x42, 0x33, 0x06, 0x5C, 0x62, 0x07, 0x3D, 0x44, 0x08, 0x0F, 0x0F, 0x02,
+	0x00, 0xFB, 0x06, 0x00, 0x0F, 0x47, 0x06, 0x0F, 0x36, 0x08, 0x0F, 0x44, 0x09, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x0F, 0x01, 0x4B, 0x0F, 0x02, 0xFB, 0x06, 0x00, 0x0F, 0x0F,
+	0x02, 0x00, 0xFB, 0x06, 0x25, 0xF4, 0x06, 0x35, 0x4E, 0x06, 0x36, 0x3C, 0x08, 0x27, 0x4A, 0x09, 0x27, 0x48, 0x0B, 0x27, 0x37, 0x0D, 0x27, 0x45, 0x0E, 0x36, 0x34, 0x0F, 0x01, 0x35, 0x43, 0x0F,
+	0x02, 0x25, 0xF4, 0x06, 0xFB, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x0D, 0x0F, 0x31, 0x0D, 0x5F, 0x0C, 0x3E, 0x41, 0x0A, 0x3D, 0x44, 0x08, 0x4B, 0x56, 0x06, 0x2B, 0x3A,
+	0x06, 0x1B, 0x1D, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x47, 0x06, 0x0F, 0x73, 0x07, 0xCB, 0x09, 0x8B, 0x0D, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02,
+	0x00, 0xFB, 0x06, 0x00, 0x4B, 0x0F, 0x02, 0x6B, 0x0F, 0x6E, 0x0C, 0x0F, 0x62, 0x09, 0x0F, 0x65, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x62, 0x09, 0x6E, 0x0C, 0x5C, 0x0F, 0x4B, 0x0F,
+	0x02, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x37,
+	0x07, 0x3B, 0x39, 0x06, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x3B, 0x39, 0x06, 0x3C, 0x37, 0x07, 0xBD, 0x08, 0x7F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x2B, 0x0F, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x60, 0x00, 0x2D, 0x27, 0x08, 0x2C, 0x29, 0x07, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x3B, 0x39, 0x06, 0x3C, 0x37, 0x07,
+	0xBD, 0x08, 0x8E, 0x0A, 0x0F, 0x0F, 0x02, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x37, 0x07, 0x2C, 0x29, 0x07, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x3B, 0x39, 0x06, 0x3C, 0x37, 0x07, 0x3D, 0x35, 0x08,
+	0x2E, 0x25, 0x09, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x0F, 0x04, 0x4B, 0x2F, 0x7B, 0x2C, 0x6E, 0x2A, 0x0F, 0x71, 0x36,
+	0x0F, 0x64, 0x42, 0x01, 0x0F, 0x87, 0x02, 0x0F, 0x67, 0x04, 0x0F, 0x64, 0x07, 0x0F, 0x62, 0x09, 0x6E, 0x0C, 0x7B, 0x0E, 0x4B, 0x0F, 0x02, 0x2B, 0x0F, 0x04, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x37,
+	0x07, 0x3B, 0x39, 0x06, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x2C, 0x29, 0x07, 0x2D, 0x27, 0x08, 0xF6, 0xB0, 0x00, 0x2D, 0x27, 0x08, 0x2C, 0x29, 0x07, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x3B,
+	0x39, 0x06, 0x3C, 0x37, 0x07, 0xBD, 0x08, 0x7F, 0x0A, 0x1B, 0x1D, 0x06, 0x2B, 0x3A, 0x06, 0x4B, 0x47, 0x06, 0x4C, 0x35, 0x08, 0x4E, 0x41, 0x09, 0x6F, 0x0B, 0x0F, 0x32, 0x0C, 0x6F, 0x0B, 0x4E,
+	0x41, 0x09, 0x4C, 0x35, 0x08, 0x4B, 0x47, 0x06, 0x2B, 0x3A, 0x06, 0x1B, 0x1D, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+	0x06, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x8B, 0x0D, 0x9B, 0x0C, 0x0F, 0x33, 0x0B, 0x0F, 0x24, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0x14, 0x0C, 0x0F, 0x23, 0x0C, 0xFB, 0x06, 0x00, 0x0F,
+	0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00,
+	0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x89, 0x00, 0x2B, 0x0F, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x32, 0x33, 0x06, 0x0F, 0x73, 0x07, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F,
+	0x22, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x23, 0x23, 0x07, 0x0F, 0x73, 0x07, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06,
+	0x00, 0x0F, 0x22, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x32, 0x23, 0x07, 0x0F, 0x73, 0x07, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x2D, 0x27, 0x08, 0x3C, 0x37, 0x07, 0x2C, 0x29, 0x07,
+	0x2B, 0x2B, 0x06, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x3B, 0x23, 0x34, 0x06, 0x3C, 0x22, 0x33, 0x07, 0xBD, 0x08, 0x7F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x0D, 0x00,
+	0x00, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x37, 0x07, 0x3B, 0x39, 0x06, 0x2B, 0x2B, 0x06, 0x00, 0x00, 0x00, 0x3B, 0x39, 0x06, 0x3C, 0x37, 0x07, 0xBD, 0x08, 0x7F, 0x0A, 0x0F, 0x1A, 0x06, 0x5D, 0x26,
+	0x06, 0x7C, 0x34, 0x06, 0x2C, 0x23, 0x42, 0x07, 0x2B, 0x55, 0x09, 0x2B, 0x45, 0x0A, 0x2B, 0x25, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x7F, 0x0A, 0xBD, 0x08, 0x3C,
+	0x22, 0x33, 0x07, 0x26, 0x33, 0x23, 0x24, 0x07, 0x26, 0x23, 0x24, 0x25, 0x06, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x26, 0x33, 0x23, 0x25, 0x06, 0x26, 0x34, 0x22, 0x24, 0x07, 0x6D, 0x33, 0x07,
+	0x4F, 0x23, 0x08, 0x28, 0x0F, 0x07, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x28, 0x23, 0x0F, 0x02, 0x28, 0x22, 0x0F, 0x03, 0x28, 0x21, 0x0F, 0x04, 0x00, 0x2B, 0x0F, 0x04, 0x2B, 0x0F, 0x22, 0x00, 0x3B,
+	0x0F, 0x21, 0xFC, 0x50, 0xFD, 0x30, 0x01, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x18, 0x22, 0x0F, 0x04, 0x27, 0x22, 0x0F, 0x04, 0x26, 0x23, 0x0F, 0x04, 0x25, 0x24, 0x0F, 0x04, 0x00, 0x15,
+	0x25, 0x0F, 0x04, 0x0F, 0x0F, 0x02, 0x7F, 0x0A, 0xBD, 0x08, 0x3C, 0x22, 0x42, 0x07, 0x2C, 0x23, 0x24, 0x07, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x00, 0x2B, 0x2B, 0x06, 0x00, 0x2C, 0x29, 0x07,
+	0x3C, 0x37, 0x07, 0x1E, 0x27, 0x08, 0x0F, 0x0F, 0x02, 0x4D, 0x25, 0x08, 0x6C, 0x34, 0x07, 0x3B, 0x22, 0x35, 0x06, 0x2B, 0x24, 0x25, 0x06, 0x00, 0x00, 0x2B, 0x34, 0x24, 0x06, 0x2B, 0x25, 0x24,
+	0x06, 0x2C, 0x34, 0x22, 0x07, 0x3C, 0x64, 0x07, 0x2D, 0x45, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x26, 0xF3, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x26, 0x0F, 0x09, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x0F, 0x02,
+	0x26, 0x0F, 0x09, 0x00, 0x0F, 0x2F, 0x00, 0x26, 0xF3, 0x60, 0x26, 0xF3, 0x50, 0x01, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x47, 0x06, 0x0F, 0x73, 0x07, 0xDB, 0x08, 0x9B, 0x0C, 0x3B, 0x0F, 0x03, 0x2B,
+	0x0F, 0x04, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x32, 0x23, 0x07, 0x0F, 0x73, 0x07, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0xFB,
+	0x06, 0x00, 0x0F, 0x22, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x25, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x32, 0x33, 0x06, 0x0F, 0x73, 0x07, 0x0F, 0x54, 0x08, 0x28,
+	0x0F, 0x07, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x28, 0x23, 0x0F, 0x02, 0x28, 0x22, 0x0F, 0x03, 0x28, 0x21, 0x0F, 0x04, 0x00, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x3B, 0x0F, 0x03, 0xEC, 0x06, 0xDD, 0x06,
+	0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x22, 0x0D, 0x18, 0x37, 0x0D, 0x27, 0x56, 0x0C, 0x26, 0x36, 0x41, 0x0A, 0x25, 0x36, 0x44, 0x08, 0x25, 0x44, 0x56, 0x06, 0x15, 0x25, 0x3A, 0x06,
+	0x1B, 0x1D, 0x06, 0x2B, 0x0F, 0x04, 0x4B, 0x2F, 0x7B, 0x2C, 0x26, 0x66, 0x2A, 0x36, 0x77, 0x36, 0x37, 0x69, 0x42, 0x01, 0x28, 0x8C, 0x02, 0x28, 0x6C, 0x04, 0x28, 0x69, 0x07, 0x28, 0x67, 0x09,
+	0x37, 0x64, 0x0C, 0x36, 0x72, 0x0E, 0x26, 0x43, 0x0F, 0x02, 0x2B, 0x0F, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x0F, 0x89, 0x00, 0x0F, 0x29, 0x06, 0x00,
+	0xFB, 0x06, 0x00, 0x26, 0x11, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0xF7, 0x40, 0x06, 0x00, 0x27, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x0F, 0x08, 0x00, 0x0F,
+	0x0F, 0x02, 0x00, 0xFB, 0x06, 0x00, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0F, 0x04, 0x00,
+};
+
+#elif USE_JAPANESE_CHARACTERS
+
+extern const uint8_t glcd28x32_packed[] =
+{
+	28,			// character width in pixels
+	32,			// row height in pixels
+	3,			// space columns between characters before kerning
+	3,			// font format: sparse packed
+	0x20, 0x00,	// lowest character code (2 bytes, little endian)
+	0xFF, 0x30,	// highest character code (2 bytes, little endian)
+
+	// Number of ranges, then the first code, last code and first glyph of each range (2 bytes each, little endian)
+	0x02, 0x00,
+	0x20, 0x00, 0x7F, 0x01, 0x00, 0x00,
+	0x40, 0x30, 0xFF, 0x30, 0x60, 0x01,
+
+	// Number of edge columns (2 bytes, little endian), then the edge columns
+	0xDF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x8F, 0x03, 0xC0, 0x7F, 0x80, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xE0, 0xFF, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0x00, 0x80, 0x33, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x03, 0x60, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x00,
+	0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x1C, 0x80, 0x33,
+	0x00, 0x1C, 0x80, 0x3F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0xC0, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0xFF, 0x1F, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+	0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x07, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0xF0, 0xFF, 0x03, 0x60, 0xFC, 0xFF, 0x03,
+	0x60, 0xFC, 0xFF, 0x1F, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x40, 0xC0, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0xFC, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x01,
+	0x00, 0x00, 0x03, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x1C, 0xFE, 0x7F, 0x00, 0x1C, 0xFF, 0x7F, 0x00, 0x18, 0x38, 0x00,
+	0x00, 0x80, 0x01, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xEC, 0x37, 0x00, 0xE0, 0xFF, 0xE0, 0xFF, 0x00, 0x83, 0x03, 0x03, 0x80, 0xC1, 0xE7, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x01, 0x03, 0x00, 0x80, 0x0F, 0x02, 0x00,
+	0x80, 0x81, 0x01, 0x00, 0x80, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x0F, 0x02,
+	0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x00, 0x20, 0xC0, 0x01, 0x00,
+	0x00, 0xF0, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC2,
+	0x00, 0x00, 0x00, 0xC3, 0x00, 0x06, 0x70, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0xC7, 0x00, 0x00, 0xE0, 0x07, 0x00,
+	0x00, 0x06, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0xC0, 0xFF, 0xFF, 0xC3, 0x60, 0xFC, 0xFF, 0xC3, 0xCC, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x00, 0x60, 0xFC, 0xFF, 0x3F, 0xCC, 0xFF, 0x7F, 0x00, 0x80, 0x01, 0x00, 0xC0, 0x00, 0x04, 0x00, 0x02,
+	0xE4, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x9B, 0xE0, 0xFF, 0xFF, 0x7B, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xC0, 0x11, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x3F,
+	0x00, 0xF0, 0xFF, 0x00, 0x30, 0xF0, 0xFF, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x9B, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x38, 0xFC, 0x01, 0x00, 0x20, 0x78, 0x00, 0x00, 0x0C, 0x03, 0x00,
+	0x00, 0x0C, 0x03, 0x03, 0xC0, 0xFF, 0x7F, 0x00, 0x30, 0xFC, 0xFF, 0x03, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x03, 0xF8, 0xFF, 0xFF, 0x7F,
+	0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x30, 0x00, 0x10, 0x00, 0x70, 0x00, 0x00, 0x40, 0x00, 0x00, 0x18,
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0xE0, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x02, 0x00, 0x1E, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xC0, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x60, 0x00,
+	0x00, 0x00, 0x30, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x18, 0x80, 0x01,
+	0xE0, 0x01, 0x80, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x0C, 0x60, 0x00, 0x40, 0x00, 0x00, 0x06, 0x00, 0x80, 0x07, 0x00, 0xC0, 0xFF, 0xFF, 0x3F,
+
+	// Width, leading edge and trailing edge of each glyph
+	0x0B, 0x00, 0x00, 0x03, 0x01, 0x02, 0x08, 0x03, 0x03, 0x10, 0x04, 0x05, 0x10, 0x06, 0x07, 0x18, 0x08, 0x09, 0x12, 0x0A, 0x0B, 0x02, 0x03, 0x03, 0x07, 0x0C, 0x0D, 0x07, 0x0D, 0x0C,
+	0x0B, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x02, 0x10, 0x11, 0x08, 0x12, 0x12, 0x02, 0x13, 0x13, 0x08, 0x0B, 0x14, 0x0E, 0x15, 0x15, 0x0D, 0x0B, 0x0B, 0x0E, 0x0B, 0x0B, 0x0E, 0x06, 0x16,
+	0x0E, 0x17, 0x04, 0x0E, 0x06, 0x18, 0x0D, 0x19, 0x1A, 0x0E, 0x1B, 0x1B, 0x0E, 0x16, 0x16, 0x0E, 0x1C, 0x1D, 0x02, 0x1E, 0x1E, 0x02, 0x1F, 0x20, 0x0F, 0x21, 0x22, 0x0F, 0x23, 0x23,
+	0x0F, 0x22, 0x21, 0x0E, 0x24, 0x25, 0x19, 0x26, 0x0F, 0x13, 0x27, 0x27, 0x0F, 0x28, 0x09, 0x13, 0x0F, 0x06, 0x12, 0x28, 0x29, 0x10, 0x28, 0x0B, 0x0F, 0x28, 0x1B, 0x14, 0x0F, 0x2A,
+	0x11, 0x28, 0x28, 0x03, 0x28, 0x28, 0x0D, 0x07, 0x2B, 0x10, 0x28, 0x27, 0x0D, 0x28, 0x0B, 0x13, 0x28, 0x28, 0x11, 0x28, 0x28, 0x15, 0x29, 0x2C, 0x0F, 0x28, 0x2D, 0x15, 0x29, 0x2C,
+	0x11, 0x28, 0x2E, 0x11, 0x06, 0x16, 0x11, 0x1B, 0x1B, 0x11, 0x2F, 0x2F, 0x13, 0x30, 0x30, 0x1C, 0x31, 0x31, 0x11, 0x27, 0x27, 0x11, 0x30, 0x30, 0x10, 0x13, 0x0B, 0x06, 0x32, 0x0D,
+	0x08, 0x14, 0x0B, 0x06, 0x0D, 0x32, 0x0E, 0x33, 0x33, 0x10, 0x34, 0x34, 0x06, 0x35, 0x36, 0x0F, 0x37, 0x0B, 0x0D, 0x38, 0x39, 0x0D, 0x39, 0x3A, 0x0D, 0x39, 0x38, 0x0E, 0x39, 0x3B,
+	0x08, 0x24, 0x3C, 0x0D, 0x39, 0x3D, 0x0C, 0x38, 0x3E, 0x03, 0x3F, 0x3F, 0x05, 0x34, 0x40, 0x0C, 0x38, 0x27, 0x03, 0x38, 0x38, 0x15, 0x41, 0x3E, 0x0C, 0x41, 0x3E, 0x0E, 0x39, 0x39,
+	0x0D, 0x42, 0x39, 0x0D, 0x39, 0x42, 0x08, 0x41, 0x24, 0x0D, 0x43, 0x44, 0x08, 0x24, 0x45, 0x0C, 0x46, 0x41, 0x0D, 0x0E, 0x0E, 0x15, 0x24, 0x24, 0x0B, 0x45, 0x45, 0x0D, 0x0E, 0x0E,
+	0x0C, 0x0B, 0x0B, 0x09, 0x12, 0x0D, 0x02, 0x32, 0x32, 0x09, 0x0D, 0x12, 0x0F, 0x21, 0x2C, 0x05, 0x47, 0x47, 0x03, 0x00, 0x00, 0x1A, 0x48, 0x48, 0x0C, 0x49, 0x49, 0x1A, 0x48, 0x48,
+	0x0C, 0x4A, 0x4A, 0x0E, 0x4B, 0x4B, 0x0E, 0x4C, 0x4C, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x4D, 0x4E,
+	0x0C, 0x15, 0x4F, 0x0E, 0x50, 0x51, 0x0C, 0x52, 0x52, 0x10, 0x30, 0x30, 0x02, 0x53, 0x53, 0x0C, 0x54, 0x55, 0x08, 0x49, 0x49, 0x15, 0x0F, 0x0F, 0x0B, 0x56, 0x57, 0x0E, 0x58, 0x59,
+	0x0F, 0x0F, 0x5A, 0x08, 0x12, 0x12, 0x15, 0x0F, 0x0F, 0x10, 0x5B, 0x5B, 0x08, 0x5C, 0x5C, 0x0E, 0x5D, 0x5D, 0x08, 0x5E, 0x5F, 0x08, 0x60, 0x61, 0x06, 0x36, 0x35, 0x0E, 0x42, 0x0B,
+	0x0E, 0x25, 0x30, 0x02, 0x3B, 0x3B, 0x05, 0x34, 0x62, 0x08, 0x63, 0x64, 0x0B, 0x65, 0x65, 0x0E, 0x59, 0x58, 0x16, 0x63, 0x66, 0x16, 0x63, 0x67, 0x15, 0x60, 0x66, 0x0E, 0x68, 0x69,
+	0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x1B, 0x0B, 0x0B, 0x13, 0x0F, 0x06, 0x10, 0x28, 0x0B, 0x10, 0x28, 0x0B,
+	0x10, 0x28, 0x0B, 0x10, 0x28, 0x0B, 0x06, 0x6A, 0x6B, 0x06, 0x6C, 0x6A, 0x08, 0x6D, 0x6B, 0x07, 0x6D, 0x6D, 0x14, 0x0F, 0x29, 0x11, 0x28, 0x28, 0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C,
+	0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C, 0x0D, 0x6E, 0x6E, 0x15, 0x29, 0x6F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x30, 0x30,
+	0x0F, 0x28, 0x70, 0x0F, 0x71, 0x72, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x18, 0x73, 0x3B, 0x0D, 0x39, 0x3A,
+	0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x06, 0x74, 0x75, 0x06, 0x75, 0x74, 0x0A, 0x75, 0x75, 0x08, 0x1B, 0x1B, 0x0E, 0x26, 0x76, 0x0C, 0x41, 0x3E,
+	0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x0F, 0x0F, 0x10, 0x27, 0x0E, 0x0C, 0x46, 0x41, 0x0C, 0x46, 0x41, 0x0C, 0x46, 0x41,
+	0x0C, 0x46, 0x41, 0x0D, 0x0E, 0x0E, 0x0D, 0x32, 0x39, 0x0D, 0x0E, 0x0E, 0x13, 0x27, 0x27, 0x0F, 0x73, 0x0B, 0x13, 0x27, 0x27, 0x0F, 0x73, 0x0B, 0x13, 0x27, 0x77, 0x0F, 0x73, 0x78,
+	0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x11, 0x28, 0x19, 0x10, 0x7A, 0x7C,
+	0x13, 0x0F, 0x19, 0x0E, 0x7A, 0x38, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x78, 0x0D, 0x7D, 0x7E,
+	0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81,
+	0x11, 0x28, 0x28, 0x0D, 0x38, 0x3E, 0x14, 0x82, 0x82, 0x0F, 0x49, 0x3E, 0x08, 0x6D, 0x6D, 0x08, 0x1B, 0x1B, 0x06, 0x83, 0x83, 0x06, 0x1B, 0x1B, 0x08, 0x84, 0x85, 0x08, 0x86, 0x87,
+	0x05, 0x62, 0x88, 0x05, 0x62, 0x89, 0x03, 0x8A, 0x8A, 0x03, 0x41, 0x41, 0x10, 0x28, 0x8B, 0x09, 0x3F, 0x8C, 0x0D, 0x06, 0x8D, 0x07, 0x8E, 0x49, 0x11, 0x28, 0x27, 0x0D, 0x38, 0x8F,
+	0x0D, 0x41, 0x8F, 0x0D, 0x28, 0x0B, 0x04, 0x90, 0x84, 0x0D, 0x28, 0x0B, 0x03, 0x91, 0x92, 0x0D, 0x28, 0x0B, 0x06, 0x38, 0x93, 0x0D, 0x28, 0x0B, 0x07, 0x38, 0x0F, 0x0F, 0x3B, 0x0B,
+	0x05, 0x94, 0x38, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x10, 0x95, 0x3E, 0x10, 0x28, 0x96, 0x0D, 0x41, 0x97,
+	0x13, 0x70, 0x19, 0x0D, 0x7A, 0x98, 0x13, 0x70, 0x19, 0x0D, 0x7A, 0x98, 0x13, 0x70, 0x19, 0x0D, 0x7A, 0x99, 0x1B, 0x70, 0x0B, 0x18, 0x7A, 0x7E, 0x12, 0x28, 0x27, 0x07, 0x41, 0x9A,
+	0x12, 0x28, 0x27, 0x06, 0x9B, 0x24, 0x12, 0x28, 0x27, 0x08, 0x74, 0x9A, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D,
+	0x10, 0x06, 0x9C, 0x0E, 0x66, 0x9E, 0x10, 0x1B, 0x1B, 0x08, 0x24, 0x45, 0x10, 0x1B, 0x1B, 0x0A, 0x24, 0x93, 0x10, 0x1B, 0x1B, 0x08, 0x9F, 0xA0, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41,
+	0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0xA2, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41,
+	0x1A, 0x1B, 0xA3, 0x14, 0x24, 0xA4, 0x12, 0x30, 0x1B, 0x0D, 0x0E, 0xA5, 0x12, 0x30, 0x1B, 0x10, 0x13, 0x0B, 0x0D, 0x13, 0x0B, 0x10, 0x13, 0x0B, 0x0D, 0x13, 0x0B, 0x10, 0x13, 0x0B,
+	0x0D, 0x13, 0x0B, 0x04, 0xA6, 0x14, 0x19, 0x00, 0xA7, 0x18, 0x00, 0xA8, 0x19, 0x00, 0xA9, 0x18, 0x00, 0xAA, 0x19, 0x00, 0x73, 0x15, 0x00, 0x0A, 0x16, 0x00, 0xAB, 0x17, 0x00, 0xAC,
+	0x19, 0x00, 0xAC, 0x19, 0x00, 0x33, 0x1A, 0x00, 0x1C, 0x1A, 0xAD, 0x3B, 0x1B, 0xAD, 0x75, 0x18, 0x00, 0xAE, 0x1A, 0x00, 0x30, 0x14, 0x00, 0xAF, 0x17, 0x00, 0xB0, 0x1A, 0x00, 0x1C,
+	0x1B, 0x00, 0x75, 0x17, 0x00, 0xB1, 0x1B, 0x00, 0x1B, 0x18, 0x00, 0xB2, 0x1B, 0x00, 0x30, 0x19, 0x00, 0x66, 0x19, 0x00, 0x66, 0x1A, 0x00, 0x82, 0x1A, 0xB3, 0x75, 0x1A, 0xB4, 0xB5,
+	0x1B, 0xB4, 0x49, 0x18, 0x00, 0x0F, 0x19, 0x12, 0xB6, 0x1A, 0x00, 0x69, 0x1B, 0x05, 0xB7, 0x17, 0x00, 0x73, 0x1B, 0x00, 0x1B, 0x18, 0x00, 0x09, 0x19, 0xB8, 0xB9, 0x1B, 0xBA, 0x36,
+	0x18, 0x00, 0x49, 0x1A, 0x00, 0x33, 0x17, 0x00, 0xB1, 0x1B, 0x00, 0x36, 0x1A, 0xBB, 0xB5, 0x19, 0x00, 0xBC, 0x1B, 0xBD, 0x69, 0x1B, 0xBE, 0xBF, 0x19, 0x00, 0x39, 0x1B, 0x00, 0x27,
+	0x1B, 0x00, 0x1B, 0x1B, 0x00, 0x1B, 0x1A, 0x00, 0x94, 0x1C, 0x00, 0x36, 0x1B, 0x00, 0xC0, 0x1B, 0xBC, 0x27, 0x1A, 0xBC, 0xC1, 0x1B, 0xBC, 0xC2, 0x1B, 0xC3, 0xBF, 0x1A, 0xC3, 0xBF,
+	0x1A, 0xC3, 0x0B, 0x1A, 0x00, 0x27, 0x1B, 0x00, 0x49, 0x1C, 0x00, 0xC4, 0x18, 0x00, 0x69, 0x1A, 0xC5, 0x06, 0x1A, 0x00, 0xBA, 0x19, 0x00, 0x26, 0x18, 0x00, 0x73, 0x17, 0x00, 0xC6,
+	0x19, 0x21, 0xC7, 0x18, 0x00, 0x09, 0x19, 0x00, 0xC8, 0x16, 0x00, 0xB1, 0x18, 0x00, 0x27, 0x17, 0x00, 0x73, 0x16, 0x00, 0xC9, 0x18, 0x00, 0x73, 0x1B, 0xBE, 0xCA, 0x17, 0x00, 0x73,
+	0x18, 0x00, 0x0A, 0x1A, 0xBE, 0xAB, 0x19, 0x00, 0xA9, 0x19, 0xCB, 0xCC, 0x18, 0x00, 0xCD, 0x1A, 0xCE, 0xCF, 0x1A, 0x00, 0x0E, 0x19, 0x00, 0x07, 0x18, 0x00, 0x2C, 0x19, 0x00, 0xA7,
+	0x19, 0x00, 0xA7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0xC0, 0x36, 0x06, 0x93, 0x93, 0x15, 0x00, 0xD0, 0x16, 0x00, 0x24, 0x18, 0xCE, 0x0E, 0x14, 0x00, 0xD1, 0x18, 0x00, 0xBA,
+	0x1A, 0x00, 0x36, 0x16, 0x00, 0xB6, 0x18, 0x00, 0x30, 0x17, 0x00, 0xB0, 0x18, 0x00, 0x65, 0x17, 0x00, 0xB1, 0x19, 0x69, 0x69, 0x18, 0x00, 0x0F, 0x19, 0x00, 0x05, 0x17, 0x00, 0xD2,
+	0x1A, 0x00, 0x49, 0x19, 0x00, 0x3B, 0x1A, 0xD3, 0x30, 0x18, 0x00, 0x0E, 0x1B, 0x64, 0x75, 0x1A, 0x64, 0x05, 0x1A, 0x64, 0x75, 0x17, 0x00, 0xD4, 0x1A, 0x00, 0x14, 0x1A, 0xB5, 0xB5,
+	0x1A, 0xB5, 0x49, 0x19, 0x00, 0xB4, 0x1B, 0x00, 0xB7, 0x19, 0x00, 0xD5, 0x1A, 0xD5, 0x30, 0x18, 0x2C, 0x65, 0x1B, 0x21, 0x75, 0x18, 0x00, 0x49, 0x1A, 0x00, 0x30, 0x18, 0x64, 0x0E,
+	0x1B, 0x64, 0x30, 0x19, 0x00, 0x0F, 0x1A, 0x0F, 0xB6, 0x17, 0x00, 0xB5, 0x19, 0x00, 0x36, 0x1B, 0x00, 0x30, 0x19, 0x00, 0xB4, 0x1B, 0x00, 0x1B, 0x17, 0x00, 0x17, 0x18, 0x00, 0xB7,
+	0x19, 0x00, 0xB5, 0x19, 0x00, 0x0B, 0x17, 0x00, 0xD6, 0x1A, 0x00, 0x06, 0x16, 0x00, 0x75, 0x1A, 0xD5, 0xD5, 0x1B, 0xD5, 0x75, 0x1B, 0xCE, 0x31, 0x18, 0x00, 0xBC, 0x1A, 0x00, 0x75,
+	0x1A, 0x00, 0x31, 0x18, 0x00, 0xB7, 0x1B, 0x00, 0x30, 0x1B, 0x00, 0xC0, 0x1B, 0xC3, 0xBF, 0x1A, 0x07, 0x27, 0x1A, 0x04, 0x0B, 0x1A, 0x00, 0xBE, 0x1A, 0xD7, 0x49, 0x1A, 0xD7, 0xD8,
+	0x1A, 0x00, 0xB7, 0x17, 0x00, 0x82, 0x1A, 0x69, 0xB1, 0x18, 0x00, 0xBF, 0x19, 0x00, 0x48, 0x18, 0x00, 0xB0, 0x1A, 0x56, 0x82, 0x18, 0x00, 0xB1, 0x1A, 0x0B, 0x0B, 0x15, 0x00, 0xD9,
+	0x17, 0x00, 0xD4, 0x18, 0x00, 0x56, 0x15, 0x00, 0xDA, 0x1B, 0xD5, 0xC3, 0x19, 0x00, 0x48, 0x18, 0x00, 0xD4, 0x17, 0x00, 0xCD, 0x18, 0x00, 0x82, 0x19, 0x00, 0xDB, 0x1A, 0x00, 0x69,
+	0x19, 0x00, 0x36, 0x1A, 0x00, 0x56, 0x1B, 0x00, 0x75, 0x16, 0x00, 0x5A, 0x18, 0x00, 0x0F, 0x1A, 0x00, 0x75, 0x1B, 0x00, 0x75, 0x1A, 0x00, 0xDC, 0x1A, 0x00, 0x30, 0x11, 0x00, 0xDD,
+	0x19, 0x00, 0x48, 0x15, 0x00, 0xBE, 0x17, 0x00, 0xB6, 0x16, 0x00, 0xDE,
+
+	// Glyph offsets (2 bytes each, little endian)
+	0x00, 0x00, 0x0D, 0x00, 0x14, 0x00, 0x24, 0x00, 0x56, 0x00, 0x85, 0x00, 0xC9, 0x00, 0x07, 0x01, 0x0B, 0x01, 0x20, 0x01, 0x35, 0x01, 0x5A, 0x01, 0x6C, 0x01, 0x73, 0x01, 0x7D, 0x01, 0x81, 0x01,
+	0x97, 0x01, 0xB8, 0x01, 0xD3, 0x01, 0x04, 0x02, 0x2C, 0x02, 0x50, 0x02, 0x79, 0x02, 0xA1, 0x02, 0xC7, 0x02, 0xF0, 0x02, 0x1A, 0x03, 0x1E, 0x03, 0x25, 0x03, 0x49, 0x03, 0x5A, 0x03, 0x7E, 0x03,
+	0xAC, 0x03, 0x0A, 0x04, 0x3F, 0x04, 0x60, 0x04, 0x8F, 0x04, 0xB3, 0x04, 0xCD, 0x04, 0xE2, 0x04, 0x1B, 0x05, 0x31, 0x05, 0x36, 0x05, 0x5A, 0x05, 0x85, 0x05, 0x96, 0x05, 0xC3, 0x05, 0xEB, 0x05,
+	0x1B, 0x06, 0x35, 0x06, 0x76, 0x06, 0x9A, 0x06, 0xD1, 0x06, 0xE8, 0x06, 0x11, 0x07, 0x44, 0x07, 0x8E, 0x07, 0xBE, 0x07, 0xEC, 0x07, 0x25, 0x08, 0x2E, 0x08, 0x44, 0x08, 0x4D, 0x08, 0x75, 0x08,
+	0x86, 0x08, 0x98, 0x08, 0xC4, 0x08, 0xE2, 0x08, 0x00, 0x09, 0x1E, 0x09, 0x44, 0x09, 0x55, 0x09, 0x79, 0x09, 0x8F, 0x09, 0x95, 0x09, 0xA3, 0x09, 0xC3, 0x09, 0xC8, 0x09, 0xF8, 0x09, 0x11, 0x0A,
+	0x2F, 0x0A, 0x4C, 0x0A, 0x69, 0x0A, 0x7A, 0x0A, 0xA2, 0x0A, 0xB1, 0x0A, 0xC8, 0x0A, 0xEB, 0x0A, 0x22, 0x0B, 0x41, 0x0B, 0x65, 0x0B, 0x8E, 0x0B, 0xA3, 0x0B, 0xA6, 0x0B, 0xBB, 0x0B, 0xD4, 0x0B,
+	0xE0, 0x0B, 0xE5, 0x0B, 0x0F, 0x0C, 0x31, 0x0C, 0x5B, 0x0C, 0x7D, 0x0C, 0xAD, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C,
+	0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C,
+	0xD7, 0x0C, 0xDA, 0x0C, 0xE1, 0x0C, 0x00, 0x0D, 0x27, 0x0D, 0x45, 0x0D, 0x7C, 0x0D, 0x7F, 0x0D, 0xB3, 0x0D, 0xC1, 0x0D, 0x06, 0x0E, 0x2A, 0x0E, 0x54, 0x0E, 0x73, 0x01, 0x65, 0x0E, 0xA8, 0x0E,
+	0xBA, 0x0E, 0xCF, 0x0E, 0xE3, 0x0E, 0xFF, 0x0E, 0x17, 0x0F, 0x27, 0x0F, 0x45, 0x0F, 0x61, 0x0F, 0x65, 0x0F, 0x70, 0x0F, 0x81, 0x0F, 0x9F, 0x0F, 0xC9, 0x0F, 0x0B, 0x10, 0x56, 0x10, 0x9B, 0x10,
+	0xC9, 0x10, 0x04, 0x11, 0x3F, 0x11, 0x7D, 0x11, 0xBC, 0x11, 0xF5, 0x11, 0x30, 0x12, 0x69, 0x12, 0xA2, 0x12, 0xCF, 0x12, 0xFC, 0x12, 0x39, 0x13, 0x61, 0x13, 0x74, 0x13, 0x84, 0x13, 0x9C, 0x13,
+	0xA9, 0x13, 0xD3, 0x13, 0x03, 0x14, 0x44, 0x14, 0x81, 0x14, 0xC5, 0x14, 0x02, 0x15, 0x3B, 0x15, 0x5F, 0x15, 0xA6, 0x15, 0xDA, 0x15, 0x0E, 0x16, 0x48, 0x16, 0x79, 0x16, 0xAD, 0x16, 0xC6, 0x16,
+	0xF8, 0x16, 0x2D, 0x17, 0x62, 0x17, 0x9B, 0x17, 0xCF, 0x17, 0xFF, 0x17, 0x39, 0x18, 0x7A, 0x18, 0x9D, 0x18, 0xD2, 0x18, 0x07, 0x19, 0x3C, 0x19, 0x69, 0x19, 0x7E, 0x19, 0x93, 0x19, 0xB1, 0x19,
+	0xC1, 0x19, 0xF0, 0x19, 0x15, 0x1A, 0x3F, 0x1A, 0x69, 0x1A, 0x94, 0x1A, 0xBE, 0x1A, 0xE2, 0x1A, 0xF5, 0x1A, 0x27, 0x1B, 0x4A, 0x1B, 0x6C, 0x1B, 0x92, 0x1B, 0xAF, 0x1B, 0xD5, 0x1B, 0xF2, 0x1B,
+	0x19, 0x1C, 0x56, 0x1C, 0x89, 0x1C, 0xC7, 0x1C, 0xFF, 0x1C, 0x35, 0x1D, 0x62, 0x1D, 0xA0, 0x1D, 0xC7, 0x1D, 0x08, 0x1E, 0x32, 0x1E, 0x65, 0x1E, 0x83, 0x1E, 0xC4, 0x1E, 0xEE, 0x1E, 0x2B, 0x1F,
+	0x4F, 0x1F, 0x77, 0x1F, 0x99, 0x1F, 0xB7, 0x1F, 0xDF, 0x1F, 0x12, 0x20, 0x3F, 0x20, 0x5D, 0x20, 0x84, 0x20, 0xA7, 0x20, 0xD3, 0x20, 0x0E, 0x21, 0x43, 0x21, 0x8B, 0x21, 0xBF, 0x21, 0x03, 0x22,
+	0x34, 0x22, 0x6F, 0x22, 0x9A, 0x22, 0xD8, 0x22, 0x07, 0x23, 0x3B, 0x23, 0x64, 0x23, 0x83, 0x23, 0xA7, 0x23, 0xBD, 0x23, 0xD3, 0x23, 0xE0, 0x23, 0xED, 0x23, 0x02, 0x24, 0x17, 0x24, 0x23, 0x24,
+	0x31, 0x24, 0x37, 0x24, 0x3C, 0x24, 0x67, 0x24, 0x7C, 0x24, 0xAD, 0x24, 0xC4, 0x24, 0xF3, 0x24, 0x16, 0x25, 0x37, 0x25, 0x57, 0x25, 0x66, 0x25, 0x81, 0x25, 0x8C, 0x25, 0xA6, 0x25, 0xB5, 0x25,
+	0xCA, 0x25, 0xD6, 0x25, 0xF3, 0x25, 0xFE, 0x25, 0x2B, 0x26, 0x52, 0x26, 0x7C, 0x26, 0x9C, 0x26, 0xCC, 0x26, 0xF8, 0x26, 0x1D, 0x27, 0x46, 0x27, 0x63, 0x27, 0x91, 0x27, 0xB2, 0x27, 0xED, 0x27,
+	0x12, 0x28, 0x54, 0x28, 0x7E, 0x28, 0xAE, 0x28, 0xE9, 0x28, 0x1E, 0x29, 0x33, 0x29, 0x62, 0x29, 0x74, 0x29, 0xB0, 0x29, 0xCF, 0x29, 0x0F, 0x2A, 0x43, 0x2A, 0x86, 0x2A, 0xBD, 0x2A, 0xF9, 0x2A,
+	0x27, 0x2B, 0x6A, 0x2B, 0xA4, 0x2B, 0xC0, 0x2B, 0xD8, 0x2B, 0x07, 0x2C, 0x1E, 0x2C, 0x38, 0x2C, 0x49, 0x2C, 0x7C, 0x2C, 0xA3, 0x2C, 0xCE, 0x2C, 0xED, 0x2C, 0x1F, 0x2D, 0x43, 0x2D, 0x74, 0x2D,
+	0x97, 0x2D, 0xCF, 0x2D, 0xF6, 0x2D, 0x25, 0x2E, 0x46, 0x2E, 0x93, 0x2E, 0xCE, 0x2E, 0x08, 0x2F, 0x30, 0x2F, 0x65, 0x2F, 0xA5, 0x2F, 0xD8, 0x2F, 0x15, 0x30, 0x45, 0x30, 0x88, 0x30, 0xBE, 0x30,
+	0xCA, 0x30, 0x3E, 0x31, 0x90, 0x31, 0xEC, 0x31, 0x22, 0x32, 0x5F, 0x32, 0x99, 0x32, 0xDF, 0x32, 0x28, 0x33, 0x7A, 0x33, 0xC5, 0x33, 0x1B, 0x34, 0x61, 0x34, 0xB0, 0x34, 0x05, 0x35, 0x67, 0x35,
+	0x9D, 0x35, 0xDF, 0x35, 0x1C, 0x36, 0x68, 0x36, 0x93, 0x36, 0xD0, 0x36, 0x12, 0x37, 0x62, 0x37, 0x9A, 0x37, 0xD5, 0x37, 0x14, 0x38, 0x67, 0x38, 0xA1, 0x38, 0xE6, 0x38, 0x2C, 0x39, 0x82, 0x39,
+	0xC1, 0x39, 0x13, 0x3A, 0x58, 0x3A, 0xAB, 0x3A, 0xDE, 0x3A, 0x17, 0x3B, 0x5A, 0x3B, 0x99, 0x3B, 0xE5, 0x3B, 0x22, 0x3C, 0x70, 0x3C, 0xBE, 0x3C, 0xF3, 0x3C, 0x46, 0x3D, 0x95, 0x3D, 0xDD, 0x3D,
+	0x25, 0x3E, 0x71, 0x3E, 0xC1, 0x3E, 0x0D, 0x3F, 0x64, 0x3F, 0xBD, 0x3F, 0x12, 0x40, 0x65, 0x40, 0xBF, 0x40, 0x0C, 0x41, 0x56, 0x41, 0xA3, 0x41, 0xED, 0x41, 0x3E, 0x42, 0x95, 0x42, 0xD9, 0x42,
+	0x32, 0x43, 0x79, 0x43, 0xC7, 0x43, 0x08, 0x44, 0x45, 0x44, 0x8B, 0x44, 0xCC, 0x44, 0x12, 0x45, 0x46, 0x45, 0x84, 0x45, 0xC5, 0x45, 0x01, 0x46, 0x5D, 0x46, 0xA9, 0x46, 0xF9, 0x46, 0x38, 0x47,
+	0x81, 0x47, 0xDB, 0x47, 0x41, 0x48, 0x9A, 0x48, 0xE2, 0x48, 0x38, 0x49, 0x7B, 0x49, 0xCA, 0x30, 0xCA, 0x30, 0xD7, 0x0C, 0xD7, 0x0C, 0xB7, 0x49, 0xCC, 0x49, 0xDF, 0x49, 0x0F, 0x4A, 0x47, 0x4A,
+	0x99, 0x4A, 0xB1, 0x4A, 0xEE, 0x4A, 0x3F, 0x4B, 0x77, 0x4B, 0xB4, 0x4B, 0xEA, 0x4B, 0x23, 0x4C, 0x45, 0x4C, 0x6A, 0x4C, 0xA2, 0x4C, 0xE3, 0x4C, 0x1B, 0x4D, 0x60, 0x4D, 0xA0, 0x4D, 0xEF, 0x4D,
+	0x35, 0x4E, 0x8A, 0x4E, 0xC6, 0x4E, 0x14, 0x4F, 0x31, 0x4F, 0x60, 0x4F, 0x94, 0x4F, 0xDA, 0x4F, 0x23, 0x50, 0x75, 0x50, 0xBD, 0x50, 0x0E, 0x51, 0x4D, 0x51, 0x98, 0x51, 0xD8, 0x51, 0x24, 0x52,
+	0x75, 0x52, 0xD0, 0x52, 0x0C, 0x53, 0x54, 0x53, 0x92, 0x53, 0xD7, 0x53, 0x27, 0x54, 0x65, 0x54, 0xB7, 0x54, 0xE3, 0x54, 0x16, 0x55, 0x48, 0x55, 0x69, 0x55, 0xB4, 0x55, 0xFE, 0x55, 0x36, 0x56,
+	0x77, 0x56, 0xC0, 0x56, 0x0A, 0x57, 0x40, 0x57, 0x83, 0x57, 0xC6, 0x57, 0x04, 0x58, 0x4D, 0x58, 0x95, 0x58, 0xE1, 0x58, 0x2B, 0x59, 0x78, 0x59, 0xB8, 0x59, 0x00, 0x5A, 0x49, 0x5A, 0x94, 0x5A,
+	0xDE, 0x5A, 0x27, 0x5B, 0x68, 0x5B, 0x96, 0x5B, 0xD4, 0x5B, 0x20, 0x5C, 0x47, 0x5C, 0x73, 0x5C, 0x91, 0x5C, 0xB1, 0x5C, 0xF9, 0x5C, 0x26, 0x5D, 0x6C, 0x5D, 0xA4, 0x5D, 0xC4, 0x5D, 0xFA, 0x5D,
+	0x32, 0x5E, 0x58, 0x5E, 0x96, 0x5E, 0xE2, 0x5E, 0x2A, 0x5F, 0x71, 0x5F, 0x9D, 0x5F, 0xD2, 0x5F, 0x19, 0x60, 0x51, 0x60, 0x92, 0x60, 0xE9, 0x60, 0xFF, 0x60, 0x1C, 0x61, 0x4A, 0x61, 0x80, 0x61,
+
+	// Glyphs
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x33, 0x06, 0x00, 0x96, 0x38, 0x06, 0x66, 0x0F, 0x05, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x56, 0x0F, 0x06,
+	0x66, 0x0F, 0x05, 0x00, 0x0F, 0x24, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x26, 0x32, 0x06, 0x2B, 0x75, 0x07, 0xAB, 0x0B, 0x88, 0x23, 0x0B, 0x46, 0x21, 0x26, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x26, 0x14,
+	0x06, 0x2B, 0x76, 0x06, 0x2B, 0x83, 0x08, 0xBA, 0x0B, 0x76, 0x26, 0x0B, 0x36, 0x22, 0x26, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x0F, 0x04, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x68, 0x56, 0x07, 0x87,
+	0x37, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x00, 0xF4, 0x90, 0x04, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x36, 0x36, 0x35, 0x06, 0x37, 0x36, 0x24, 0x07, 0x38, 0x95, 0x07, 0x29,
+	0x76, 0x08, 0x0F, 0x15, 0x0B, 0x69, 0x0F, 0x02, 0xA7, 0x0F, 0x36, 0x36, 0x0E, 0x26, 0x28, 0x0E, 0x00, 0x26, 0x28, 0x26, 0x06, 0x36, 0x36, 0x35, 0x06, 0xA7, 0x44, 0x07, 0x78, 0x35, 0x09, 0x0F,
+	0x33, 0x0B, 0x0F, 0x32, 0x0C, 0x3F, 0x0E, 0x3E, 0x0F, 0x3C, 0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x39, 0x84, 0x08, 0x38, 0xA4, 0x07, 0x36, 0x35, 0x36, 0x06, 0x26, 0x26, 0x28, 0x06, 0x2E, 0x28, 0x06,
+	0x00, 0x3E, 0x36, 0x06, 0xAF, 0x07, 0x0F, 0x62, 0x09, 0x0F, 0x53, 0x09, 0x0F, 0x72, 0x08, 0x0F, 0x41, 0x41, 0x07, 0x3F, 0x35, 0x06, 0x68, 0x21, 0x27, 0x06, 0xA7, 0x27, 0x06, 0x36, 0x54, 0x26,
+	0x06, 0x26, 0x65, 0x25, 0x06, 0x26, 0x25, 0x42, 0x23, 0x06, 0x26, 0x34, 0x34, 0x21, 0x07, 0x36, 0x23, 0x56, 0x07, 0x67, 0x38, 0x08, 0x48, 0x67, 0x07, 0x0F, 0x52, 0x31, 0x06, 0x5F, 0x24, 0x06,
+	0x2F, 0x27, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x66, 0x0F, 0x05, 0x00, 0xBD, 0x08, 0xFA, 0x20, 0x05, 0x89, 0x83, 0x04, 0x57, 0x5D, 0x02, 0x46, 0x0F, 0x42, 0x01, 0x35, 0x0F, 0x36, 0x25, 0x0F, 0x28,
+	0x25, 0x0F, 0x28, 0x35, 0x0F, 0x36, 0x46, 0x0F, 0x42, 0x01, 0x57, 0x5D, 0x02, 0x89, 0x83, 0x04, 0xFA, 0x20, 0x05, 0xBD, 0x08, 0x1A, 0x0F, 0x06, 0x29, 0x0F, 0x06, 0x29, 0x13, 0x0F, 0x02, 0x1A,
+	0x32, 0x0F, 0x01, 0x4A, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0x4A, 0x0F, 0x03, 0x1A, 0x32, 0x0F, 0x01, 0x29, 0x13, 0x0F, 0x02, 0x29, 0x0F, 0x06, 0x1A, 0x0F, 0x06, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE9, 0x09, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x38, 0x22, 0x02, 0x0F, 0x78, 0x02, 0x0F, 0x22, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x38, 0x06,
+	0x00, 0x0F, 0x29, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x82, 0x07, 0x9D, 0x0A, 0x8A, 0x0E, 0x86, 0x0F, 0x03, 0x65, 0x0F, 0x06, 0x25, 0x0F, 0x0A, 0x8C, 0x0C, 0xE9, 0x09, 0xF8, 0x10, 0x08, 0x37, 0x3C,
+	0x07, 0x36, 0x3E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x36, 0x3E, 0x06, 0x37, 0x4B, 0x07, 0xF8, 0x10, 0x08, 0xE9, 0x09, 0x8C, 0x0C, 0x0F, 0x29, 0x06, 0x29, 0x2D, 0x06, 0x38, 0x2D,
+	0x06, 0x37, 0x2E, 0x06, 0x27, 0x2F, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x29, 0x4B, 0x06, 0x47, 0x5A, 0x06, 0x37, 0x6A, 0x06, 0x36,
+	0x3A, 0x22, 0x06, 0x26, 0x3A, 0x23, 0x06, 0x26, 0x39, 0x24, 0x06, 0x26, 0x29, 0x25, 0x06, 0x26, 0x28, 0x26, 0x06, 0x36, 0x36, 0x26, 0x06, 0x37, 0x43, 0x27, 0x06, 0x97, 0x28, 0x06, 0x68, 0x2A,
+	0x06, 0x0F, 0x29, 0x06, 0x0F, 0x16, 0x0A, 0x38, 0x49, 0x08, 0x47, 0x59, 0x07, 0x37, 0x2D, 0x07, 0x36, 0x3E, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36, 0x45, 0x35, 0x06, 0x47, 0x31,
+	0x31, 0x24, 0x07, 0x87, 0x82, 0x07, 0x68, 0x73, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x0F, 0x51, 0x0B, 0x3F, 0x21, 0x0B, 0x3E, 0x22, 0x0B, 0x4C, 0x23, 0x0B, 0x3B, 0x25, 0x0B, 0x49, 0x26,
+	0x0B, 0x38, 0x28, 0x0B, 0x46, 0x29, 0x0B, 0xF6, 0x50, 0x06, 0x00, 0x0F, 0x24, 0x0B, 0x00, 0x00, 0x0F, 0x16, 0x0A, 0xA6, 0x35, 0x08, 0xA6, 0x45, 0x07, 0x66, 0x22, 0x27, 0x07, 0x26, 0x26, 0x37,
+	0x06, 0x26, 0x25, 0x29, 0x06, 0x00, 0x00, 0x00, 0x26, 0x35, 0x37, 0x06, 0x26, 0x36, 0x35, 0x07, 0x26, 0xB6, 0x07, 0x26, 0x97, 0x08, 0x0F, 0x52, 0x0A, 0xCA, 0x0A, 0xF8, 0x10, 0x08, 0x57, 0x23,
+	0x44, 0x07, 0x27, 0x25, 0x27, 0x07, 0x36, 0x24, 0x29, 0x06, 0x26, 0x25, 0x29, 0x06, 0x00, 0x00, 0x36, 0x34, 0x37, 0x06, 0x37, 0x34, 0x35, 0x07, 0x37, 0xB4, 0x07, 0x28, 0x95, 0x08, 0x0F, 0x42,
+	0x0B, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x26, 0x4E, 0x06, 0x26, 0x8A, 0x06, 0x26, 0xA8, 0x06, 0x26, 0x66, 0x0C, 0x26, 0x54, 0x0F, 0x26, 0x52, 0x0F, 0x02, 0x26, 0x41, 0x0F, 0x04, 0x56, 0x0F,
+	0x06, 0x46, 0x0F, 0x07, 0x26, 0x0F, 0x09, 0x0F, 0x34, 0x0A, 0x68, 0x73, 0x08, 0x87, 0x82, 0x07, 0x37, 0x53, 0x25, 0x07, 0x36, 0x45, 0x35, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36,
+	0x45, 0x26, 0x06, 0x37, 0x53, 0x25, 0x07, 0x87, 0x82, 0x07, 0x68, 0x73, 0x08, 0x0F, 0x34, 0x0A, 0x3B, 0x0F, 0x03, 0x98, 0x25, 0x08, 0xB7, 0x34, 0x07, 0x37, 0x35, 0x34, 0x07, 0x36, 0x37, 0x34,
+	0x06, 0x26, 0x29, 0x25, 0x06, 0x00, 0x00, 0x26, 0x29, 0x34, 0x06, 0x36, 0x27, 0x25, 0x07, 0x47, 0x24, 0x44, 0x07, 0xF8, 0x10, 0x08, 0xD9, 0x0A, 0x5D, 0x0E, 0x3A, 0x3A, 0x06, 0x00, 0x3A, 0x3A,
+	0x22, 0x02, 0x3A, 0x7A, 0x02, 0x3F, 0x0E, 0x00, 0x2E, 0x21, 0x0D, 0x00, 0x3D, 0x31, 0x0C, 0x2D, 0x23, 0x0C, 0x3C, 0x33, 0x0B, 0x2C, 0x25, 0x0B, 0x00, 0x2B, 0x27, 0x0A, 0x00, 0x3A, 0x37, 0x09,
+	0x2A, 0x29, 0x09, 0x39, 0x39, 0x08, 0x29, 0x2B, 0x08, 0x2C, 0x25, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x2B, 0x08, 0x39, 0x39, 0x08,
+	0x2A, 0x29, 0x09, 0x3A, 0x28, 0x09, 0x2B, 0x27, 0x0A, 0x00, 0x2C, 0x25, 0x0B, 0x00, 0x3C, 0x33, 0x0B, 0x2D, 0x23, 0x0C, 0x3D, 0x31, 0x0C, 0x2E, 0x21, 0x0D, 0x00, 0x3F, 0x0E, 0x00, 0x2A, 0x0F,
+	0x05, 0x48, 0x0F, 0x05, 0x57, 0x0F, 0x05, 0x37, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x26, 0x1B, 0x33, 0x06, 0x26, 0x39, 0x33, 0x06, 0x26, 0x48, 0x33, 0x06, 0x26, 0x37, 0x0E, 0x26, 0x27, 0x0F, 0x27,
+	0x25, 0x0F, 0x01, 0x97, 0x0F, 0x01, 0x78, 0x0F, 0x02, 0x49, 0x0F, 0x04, 0x0F, 0x61, 0x0A, 0xCD, 0x07, 0x5B, 0x55, 0x06, 0x3A, 0x3B, 0x05, 0x39, 0x3D, 0x04, 0x28, 0x0F, 0x31, 0x03, 0x27, 0x86,
+	0x24, 0x03, 0x36, 0xB4, 0x23, 0x03, 0x26, 0x44, 0x36, 0x23, 0x02, 0x26, 0x33, 0x29, 0x23, 0x02, 0x25, 0x33, 0x2A, 0x23, 0x02, 0x25, 0x23, 0x2B, 0x23, 0x02, 0x25, 0x23, 0x2A, 0x24, 0x02, 0x00,
+	0x25, 0x23, 0x38, 0x25, 0x02, 0x25, 0x24, 0x65, 0x33, 0x02, 0x25, 0xD5, 0x22, 0x03, 0x35, 0xA2, 0x32, 0x22, 0x03, 0x26, 0x52, 0x28, 0x31, 0x03, 0x36, 0x11, 0x2C, 0x21, 0x04, 0x37, 0x2C, 0x08,
+	0x38, 0x3A, 0x08, 0x59, 0x63, 0x09, 0xAB, 0x0B, 0x2F, 0x0F, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C,
+	0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x77, 0x24, 0x0C, 0x6A, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x26, 0x26, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x34, 0x28, 0x06, 0x37, 0x52, 0x36, 0x06, 0x77, 0x31, 0x34, 0x07, 0x58, 0x93, 0x07, 0x0F, 0x62, 0x09,
+	0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x47, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3E, 0x06,
+	0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x39, 0x38, 0x09, 0x0F, 0x16, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3E,
+	0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x4E, 0x0E, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+	0x0F, 0x09, 0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x28, 0x26,
+	0x06, 0x00, 0x36, 0x27, 0x26, 0x06, 0x27, 0x27, 0x35, 0x06, 0x37, 0x26, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x48, 0x84, 0x08, 0x1A, 0x85, 0x08, 0x0F, 0x71, 0x09, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x15, 0x0B, 0x0F, 0x35, 0x09, 0x0F, 0x55, 0x07, 0x0F,
+	0x37, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x2F, 0x07, 0xF6, 0x40, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x10, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F,
+	0x21, 0x0E, 0x3E, 0x0F, 0x3D, 0x0F, 0x01, 0x5C, 0x0F, 0x3B, 0x41, 0x0D, 0x3A, 0x43, 0x0C, 0x39, 0x45, 0x0B, 0x38, 0x38, 0x0A, 0x37, 0x4A, 0x08, 0x36, 0x4C, 0x07, 0x26, 0x4E, 0x06, 0x16, 0x0F,
+	0x31, 0x06, 0x0F, 0x1A, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x66, 0x0F, 0x05, 0x68, 0x0F,
+	0x03, 0x6B, 0x0F, 0x6E, 0x0C, 0x0F, 0x71, 0x09, 0x0F, 0x74, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x62, 0x09, 0x6E, 0x0C, 0x6B, 0x0F, 0x68, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x49, 0x0F, 0x04, 0x4B, 0x0F, 0x02, 0x5C, 0x0F, 0x4E, 0x0E, 0x5F, 0x0C, 0x0F, 0x42, 0x0B, 0x0F, 0x44, 0x09,
+	0x0F, 0x55, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06,
+	0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x0E, 0x37, 0x34, 0x0F, 0xA7, 0x0F, 0x78, 0x0F, 0x02, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x4A,
+	0x07, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x0F, 0x41, 0x04, 0x26, 0x0F, 0x51, 0x03, 0x26, 0x0F, 0x61, 0x02, 0x26, 0x0F, 0x21, 0x32, 0x01,
+	0x27, 0x2E, 0x24, 0x01, 0x37, 0x3C, 0x24, 0x01, 0x38, 0x3A, 0x25, 0x01, 0x58, 0x56, 0x25, 0x01, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x26, 0x48, 0x0C, 0x26, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x54, 0x06, 0x88, 0x37, 0x06, 0x4A, 0x2A, 0x06, 0x0F, 0x16, 0x0A, 0x49, 0x28, 0x09,
+	0x68, 0x46, 0x08, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x26, 0x36, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x37, 0x26, 0x06,
+	0x36, 0x36, 0x25, 0x07, 0x47, 0x35, 0x33, 0x07, 0x38, 0x95, 0x07, 0x29, 0x76, 0x08, 0x0F, 0x34, 0x0A, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26,
+	0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0x38, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0x16, 0x0F, 0x0A, 0x36, 0x0F, 0x08, 0x66, 0x0F, 0x05, 0x77, 0x0F, 0x03, 0x7A, 0x0F, 0x6D,
+	0x0D, 0x7F, 0x0A, 0x0F, 0x73, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x73, 0x07, 0x7F, 0x0A, 0x6D, 0x0D, 0x7A, 0x0F, 0x77, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0x36, 0x0F,
+	0x08, 0x16, 0x0F, 0x0A, 0x46, 0x0F, 0x07, 0x76, 0x0F, 0x04, 0x88, 0x0F, 0x01, 0x8B, 0x0D, 0x8E, 0x0A, 0x0F, 0x82, 0x07, 0x0F, 0x65, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x81, 0x08,
+	0x8D, 0x0B, 0x8A, 0x0E, 0x87, 0x0F, 0x02, 0x56, 0x0F, 0x06, 0x00, 0x77, 0x0F, 0x03, 0x8A, 0x0E, 0x8D, 0x0B, 0x0F, 0x81, 0x08, 0x0F, 0x74, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x82,
+	0x07, 0x8E, 0x0A, 0x8B, 0x0D, 0x88, 0x0F, 0x01, 0x76, 0x0F, 0x04, 0x46, 0x0F, 0x07, 0x0F, 0x1A, 0x06, 0x26, 0x3F, 0x06, 0x36, 0x4D, 0x06, 0x56, 0x4A, 0x07, 0x48, 0x47, 0x09, 0x49, 0x45, 0x0A,
+	0x4B, 0x41, 0x0C, 0x7C, 0x0D, 0x3E, 0x0F, 0x7C, 0x0D, 0x4B, 0x41, 0x0C, 0x4A, 0x53, 0x0A, 0x48, 0x47, 0x09, 0x47, 0x59, 0x07, 0x36, 0x4D, 0x06, 0x26, 0x3F, 0x06, 0x0F, 0x1A, 0x06, 0x16, 0x0F,
+	0x0A, 0x36, 0x0F, 0x08, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x59, 0x0F, 0x03, 0x4B, 0x0F, 0x02, 0x5C, 0x0F, 0xCE, 0x06, 0xBF, 0x06, 0xCE, 0x06, 0x5C, 0x0F, 0x4B, 0x0F, 0x02, 0x59, 0x0F, 0x03,
+	0x57, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x16, 0x0F, 0x0A, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x3C, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23,
+	0x06, 0x26, 0x38, 0x25, 0x06, 0x26, 0x46, 0x26, 0x06, 0x26, 0x45, 0x27, 0x06, 0x26, 0x44, 0x28, 0x06, 0x26, 0x42, 0x2A, 0x06, 0x26, 0x41, 0x2B, 0x06, 0x66, 0x2C, 0x06, 0x46, 0x2E, 0x06, 0x36,
+	0x2F, 0x06, 0x0F, 0x29, 0x06, 0xF5, 0xC0, 0x00, 0x00, 0x25, 0x0F, 0x28, 0x00, 0x00, 0x25, 0x0F, 0x0A, 0x65, 0x0F, 0x06, 0x86, 0x0F, 0x03, 0x8A, 0x0E, 0x9D, 0x0A, 0x0F, 0x82, 0x07, 0x0F, 0x56,
+	0x06, 0x0F, 0x29, 0x06, 0x25, 0x0F, 0x28, 0x00, 0x00, 0xF5, 0xC0, 0x00, 0x00, 0x1F, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x4C, 0x0F, 0x01, 0x4A, 0x0F, 0x03, 0x48, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x26,
+	0x0F, 0x09, 0x00, 0x46, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x4A, 0x0F, 0x03, 0x4C, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x1F, 0x0F, 0x01, 0x0F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0F, 0x0B, 0x25, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x27, 0x0F, 0x08, 0x18, 0x0F, 0x08, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93,
+	0x06, 0x3B, 0x23, 0x34, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x24, 0x08, 0xDB, 0x08, 0xFB, 0x06, 0xDD, 0x06,
+	0x0F, 0x29, 0x06, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C, 0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08,
+	0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4B, 0x37, 0x07, 0x3C, 0x36, 0x08, 0x2D, 0x26, 0x09,
+	0x6F, 0x0B, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x1B, 0x1C, 0x07, 0x2B, 0x2A, 0x07, 0x4D, 0x42, 0x09, 0xF5, 0x60, 0x06, 0x00, 0x6F, 0x0B,
+	0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23,
+	0x08, 0x0F, 0x31, 0x0D, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0xF6, 0x50, 0x06, 0xF5, 0x60, 0x06, 0x25, 0x23, 0x0F, 0x05, 0x00, 0x00, 0x6F, 0x0B, 0xCC, 0x24, 0x02, 0xEB, 0x33, 0x01, 0x4A, 0x48, 0x32,
+	0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C, 0x24, 0x00, 0x00, 0x2B, 0x2A, 0x25, 0x3B, 0x28, 0x35, 0x4D, 0x42, 0x53, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x40, 0x03, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x2B, 0x0F,
+	0x04, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x5A, 0x0F, 0x02, 0xFB, 0x06, 0xEC, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x2F, 0x00, 0x25, 0xF3, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x25,
+	0xF3, 0x40, 0x03, 0xF5, 0x60, 0x06, 0x00, 0x0F, 0x23, 0x0C, 0x0F, 0x31, 0x0D, 0x4F, 0x0D, 0x7E, 0x0B, 0x3D, 0x42, 0x0A, 0x3C, 0x54, 0x08, 0x4A, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x1A, 0x2D, 0x06,
+	0x0F, 0x1A, 0x06, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x1C, 0x0F, 0x04, 0x1B, 0x0F, 0x05, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB,
+	0x06, 0xDD, 0x06, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x2B, 0x0F,
+	0x04, 0x1B, 0x0F, 0x05, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x5A, 0x0F, 0x02, 0xFB, 0x06, 0xEC, 0x06, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06,
+	0x00, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0xFA, 0x70, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C, 0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00,
+	0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08, 0x6F, 0x0B, 0x6F, 0x0B, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x1B, 0x2B, 0x07,
+	0x2B, 0x2A, 0x07, 0x4D, 0x42, 0x09, 0xFA, 0x70, 0x00, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x3B, 0x0F, 0x03, 0x3A, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x1E, 0x27, 0x08, 0x5C, 0x35, 0x07,
+	0x7B, 0x25, 0x07, 0x3A, 0x32, 0x35, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x34, 0x33, 0x06, 0x3B, 0x74, 0x07, 0x2C, 0x74, 0x07, 0x1D,
+	0x36, 0x09, 0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x08, 0xF7, 0x40, 0x06, 0x00, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x28,
+	0x07, 0x00, 0xDA, 0x09, 0xFA, 0x10, 0x06, 0x00, 0x1A, 0x0F, 0x06, 0x5A, 0x0F, 0x02, 0x8A, 0x0E, 0x8D, 0x0B, 0x0F, 0x91, 0x07, 0x0F, 0x65, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x81,
+	0x08, 0x8D, 0x0B, 0x8A, 0x0E, 0x5A, 0x0F, 0x02, 0x1A, 0x0F, 0x06, 0x2A, 0x0F, 0x05, 0x6A, 0x0F, 0x01, 0x9A, 0x0D, 0x9E, 0x09, 0x0F, 0x83, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x82,
+	0x07, 0x8D, 0x0B, 0x7A, 0x0F, 0x2A, 0x0F, 0x05, 0x7A, 0x0F, 0x8D, 0x0B, 0x0F, 0x82, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x83, 0x06, 0x9E, 0x09, 0x9A, 0x0D, 0x6A, 0x0F, 0x01, 0x2A,
+	0x0F, 0x05, 0x2A, 0x2C, 0x06, 0x3A, 0x49, 0x06, 0x5A, 0x55, 0x07, 0x5C, 0x42, 0x09, 0x7E, 0x0B, 0x0F, 0x31, 0x0D, 0x7E, 0x0B, 0x5C, 0x42, 0x09, 0x5A, 0x55, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C,
+	0x06, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x8C, 0x39, 0x0F, 0x71, 0x35, 0x01, 0x0F, 0xC4, 0x01, 0x0F, 0x68, 0x03, 0x0F, 0x75, 0x05, 0x0F, 0x81, 0x08, 0x8D, 0x0B, 0x8A, 0x0E, 0x4A,
+	0x0F, 0x03, 0x1A, 0x0F, 0x06, 0x0F, 0x29, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47, 0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x2A, 0x54, 0x23, 0x06, 0x2A, 0x43, 0x25, 0x06, 0x2A, 0x51,
+	0x26, 0x06, 0x6A, 0x28, 0x06, 0x5A, 0x29, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x22, 0x0D, 0x00, 0x0F, 0x41, 0x0C, 0x6F, 0x0B, 0xB6, 0xC2, 0x01, 0xB5, 0xC4, 0x35, 0x0F, 0x36, 0x25,
+	0x0F, 0x28, 0x00, 0xF5, 0xC0, 0x00, 0x25, 0x0F, 0x28, 0x00, 0x00, 0x35, 0x0F, 0x36, 0xC5, 0xC3, 0xB6, 0xD1, 0x01, 0x6F, 0x0B, 0x0F, 0x32, 0x0C, 0x0F, 0x22, 0x0D, 0x3F, 0x0E, 0x2F, 0x0F, 0x2E,
+	0x0F, 0x01, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0x2F, 0x0F, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0x3E, 0x0F, 0xF7, 0x30, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x00, 0x00, 0xF7, 0x30, 0x07,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x4F, 0x0D, 0x6E, 0x0C, 0x8D, 0x0B, 0x3C, 0x21, 0x31, 0x0A, 0x3B, 0x22, 0x32, 0x09, 0x1B, 0x24, 0x14, 0x09, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x0F, 0x08, 0x26, 0x0F, 0x09, 0x35, 0x0F, 0x09, 0x34, 0x0F, 0x0A, 0x33, 0x0F, 0x0B, 0xF2, 0xC0,
+	0x03, 0x00, 0x33, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x27, 0x0F, 0x08, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x24, 0x14, 0x09, 0x3B, 0x22, 0x32, 0x09, 0x3C, 0x21, 0x31, 0x0A, 0x8D, 0x0B, 0x6E, 0x0C, 0x4F, 0x0D, 0x0F, 0x21, 0x0E, 0x0F, 0x28, 0x07, 0x0F, 0x29,
+	0x06, 0x0F, 0x39, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x3B, 0x03, 0xF2, 0xD0, 0x02, 0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x0F, 0x29, 0x06, 0x0F, 0x28, 0x07, 0x18, 0x1E, 0x08,
+	0x27, 0x2E, 0x07, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x23, 0x05, 0x24, 0x0F, 0x25, 0x04, 0x23, 0x0F, 0x27, 0x03, 0xF2, 0xD0, 0x02, 0x00, 0x23, 0x0F, 0x27, 0x03, 0x24, 0x0F, 0x25, 0x04, 0x25,
+	0x0F, 0x23, 0x05, 0x26, 0x0F, 0x21, 0x06, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x17, 0x0F, 0x11, 0x07, 0x27, 0x2E, 0x07, 0x28, 0x2C, 0x08, 0x29, 0x2A, 0x09, 0x2A, 0x28, 0x0A, 0x2B, 0x26, 0x0B,
+	0xC2, 0xC4, 0x02, 0x00, 0x2B, 0x26, 0x0B, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x28, 0x2C, 0x08, 0x27, 0x2E, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x0F, 0x0F, 0x02, 0x3A, 0xE4, 0x01, 0x3A, 0xF3, 0x01,
+	0x00, 0x8C, 0x0C, 0xCA, 0x0A, 0xE9, 0x09, 0x29, 0x39, 0x09, 0x28, 0x2C, 0x08, 0x00, 0x46, 0x4C, 0x06, 0x28, 0x2C, 0x08, 0x38, 0x3A, 0x08, 0x39, 0x38, 0x09, 0x49, 0x46, 0x09, 0x2B, 0x36, 0x0A,
+	0x2F, 0x27, 0x06, 0x2F, 0x36, 0x06, 0xFA, 0x10, 0x06, 0xF8, 0x21, 0x06, 0xF7, 0x22, 0x06, 0x36, 0x26, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36, 0x26, 0x27, 0x06, 0x37, 0x3D,
+	0x06, 0x28, 0x4B, 0x07, 0x0F, 0x36, 0x08, 0x2A, 0x61, 0x21, 0x0A, 0xCA, 0x0A, 0x3B, 0x34, 0x0B, 0x2B, 0x26, 0x0B, 0x2A, 0x28, 0x0A, 0x00, 0x00, 0x00, 0x2B, 0x26, 0x0B, 0x3B, 0x34, 0x0B, 0xCA,
+	0x0A, 0x2A, 0x61, 0x21, 0x0A, 0x16, 0x0F, 0x0A, 0x36, 0x27, 0x22, 0x0A, 0x46, 0x26, 0x22, 0x0A, 0x57, 0x24, 0x22, 0x0A, 0x59, 0x22, 0x22, 0x0A, 0x4B, 0x21, 0x22, 0x0A, 0x5D, 0x22, 0x0A, 0xCE,
+	0x06, 0x00, 0x5D, 0x22, 0x0A, 0x4B, 0x21, 0x22, 0x0A, 0x59, 0x22, 0x22, 0x0A, 0x57, 0x24, 0x22, 0x0A, 0x46, 0x26, 0x22, 0x0A, 0x36, 0x27, 0x22, 0x0A, 0x16, 0x0F, 0x0A, 0xB5, 0xB5, 0x00, 0x28,
+	0x35, 0x26, 0x06, 0x56, 0x53, 0x35, 0x05, 0x66, 0x21, 0x32, 0x25, 0x05, 0x35, 0x42, 0x24, 0x26, 0x04, 0x25, 0x34, 0x24, 0x26, 0x04, 0x25, 0x24, 0x26, 0x25, 0x04, 0x25, 0x25, 0x25, 0x25, 0x04,
+	0x00, 0x25, 0x25, 0x35, 0x24, 0x04, 0x26, 0x34, 0x43, 0x23, 0x05, 0x36, 0x64, 0x71, 0x05, 0x27, 0x55, 0x52, 0x06, 0x27, 0x0F, 0x08, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x27, 0x0F, 0x08,
+	0x00, 0x2F, 0x0F, 0x8C, 0x0C, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x18, 0x1E, 0x08, 0x27, 0x54, 0x25, 0x07, 0x17, 0x84, 0x14, 0x07, 0x26, 0x23, 0x26, 0x23, 0x06, 0x16, 0x23, 0x28, 0x13, 0x06,
+	0x16, 0x13, 0x1A, 0x13, 0x06, 0x00, 0x00, 0x16, 0x23, 0x28, 0x13, 0x06, 0x26, 0x23, 0x26, 0x23, 0x06, 0x17, 0x14, 0x16, 0x14, 0x07, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x29, 0x2A, 0x09, 0x2A,
+	0x28, 0x0A, 0x8C, 0x0C, 0x2F, 0x0F, 0x2D, 0x0F, 0x02, 0x27, 0x52, 0x0F, 0x01, 0x27, 0x71, 0x0F, 0x26, 0x22, 0x14, 0x0F, 0x16, 0x13, 0x15, 0x0F, 0x00, 0x16, 0x13, 0x14, 0x0F, 0x01, 0x36, 0x11,
+	0x22, 0x0F, 0x02, 0xA7, 0x0F, 0x89, 0x0F, 0x0F, 0x11, 0x0F, 0x0F, 0x13, 0x0D, 0x0F, 0x32, 0x0C, 0x0F, 0x51, 0x0B, 0x3F, 0x32, 0x09, 0x3D, 0x35, 0x08, 0x2D, 0x27, 0x08, 0x1D, 0x19, 0x08, 0x0F,
+	0x32, 0x0C, 0x0F, 0x51, 0x0B, 0x3F, 0x31, 0x0A, 0x3E, 0x33, 0x09, 0x3D, 0x35, 0x08, 0x2D, 0x27, 0x08, 0x1D, 0x19, 0x08, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0x09, 0x00, 0x2F, 0x0F, 0x8C, 0x0C, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x18, 0x1E, 0x08, 0x27, 0x2E, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x26, 0xC2, 0x22, 0x06, 0x16, 0x13, 0x15,
+	0x18, 0x06, 0x00, 0x00, 0x16, 0x13, 0x35, 0x16, 0x06, 0x16, 0x23, 0x63, 0x14, 0x06, 0x26, 0x53, 0x33, 0x22, 0x06, 0x17, 0x34, 0x16, 0x12, 0x07, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x29, 0x2A,
+	0x09, 0x2A, 0x28, 0x0A, 0x8C, 0x0C, 0x2F, 0x0F, 0x23, 0x0F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0F, 0x05, 0x27, 0x22, 0x0F,
+	0x04, 0x26, 0x24, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x27, 0x22, 0x0F, 0x04, 0x48, 0x0F, 0x05, 0x2E, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x22, 0x06, 0x00, 0x2E, 0x28, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x27, 0x0E, 0x27, 0x36, 0x0E, 0x26, 0x26, 0x11, 0x0E, 0x16, 0x26, 0x12, 0x0E, 0x16, 0x25, 0x13, 0x0E, 0x16, 0x34, 0x13, 0x0E, 0x76, 0x14, 0x0E, 0x57, 0x15, 0x0E, 0x27,
+	0x26, 0x0F, 0x27, 0x36, 0x0E, 0x16, 0x1A, 0x0E, 0x16, 0x14, 0x15, 0x0E, 0x00, 0x16, 0x23, 0x15, 0x0E, 0x56, 0x61, 0x0E, 0x37, 0x52, 0x0F, 0x18, 0x0F, 0x08, 0x27, 0x0F, 0x08, 0x26, 0x0F, 0x09,
+	0x25, 0x0F, 0x0A, 0x00, 0x15, 0x0F, 0x0B, 0xFA, 0x70, 0x00, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x28, 0x07, 0x0F, 0x27, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x0F,
+	0x38, 0x06, 0x0F, 0x29, 0x06, 0x49, 0x0F, 0x04, 0x87, 0x0F, 0x02, 0x00, 0xA6, 0x0F, 0x01, 0x00, 0xF6, 0x90, 0x02, 0x00, 0x16, 0x0F, 0x0A, 0x00, 0x00, 0xF6, 0x90, 0x02, 0x00, 0x16, 0x0F, 0x0A,
+	0x00, 0x0F, 0x31, 0x0D, 0x00, 0x0F, 0x2F, 0x0F, 0x2B, 0x22, 0x00, 0x0F, 0x5C, 0x0F, 0x3D, 0x01, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0x00, 0x0F, 0x12, 0x0E, 0x00,
+	0x00, 0x3A, 0x0F, 0x04, 0x78, 0x0F, 0x02, 0x97, 0x0F, 0x01, 0x26, 0x27, 0x0F, 0x16, 0x19, 0x0F, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x47, 0x41, 0x0F, 0x01, 0x78, 0x0F, 0x02, 0x3A, 0x0F, 0x04, 0x1D,
+	0x19, 0x08, 0x2D, 0x27, 0x08, 0x3D, 0x35, 0x08, 0x3E, 0x33, 0x09, 0x3F, 0x31, 0x0A, 0x0F, 0x51, 0x0B, 0x0F, 0x32, 0x0C, 0x1D, 0x19, 0x08, 0x2D, 0x27, 0x08, 0x3D, 0x35, 0x08, 0x3F, 0x22, 0x0A,
+	0x0F, 0x51, 0x0B, 0x0F, 0x32, 0x0C, 0x0F, 0x13, 0x0D, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0xC6, 0x17, 0x06, 0x0F, 0x12, 0x26, 0x06, 0x0F, 0x12, 0x44, 0x06, 0x0F,
+	0x12, 0x33, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x16, 0x09, 0x3B, 0x36, 0x09, 0x3A, 0x26, 0x11, 0x09, 0x38, 0x36, 0x12, 0x09, 0x46, 0x36, 0x13, 0x09,
+	0x26, 0x27, 0x15, 0x09, 0xCE, 0x06, 0x00, 0x0F, 0x17, 0x09, 0x00, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0xC6, 0x17, 0x06, 0x0F, 0x12, 0x26, 0x06, 0x0F, 0x12, 0x44,
+	0x06, 0x0F, 0x12, 0x33, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x0F, 0x01, 0x3B, 0x0F, 0x03, 0x3A, 0x13, 0x27, 0x06, 0x38, 0x24, 0x36, 0x06, 0x46, 0x24,
+	0x26, 0x11, 0x06, 0x26, 0x16, 0x26, 0x12, 0x06, 0x1E, 0x25, 0x13, 0x06, 0x1E, 0x34, 0x13, 0x06, 0x7E, 0x14, 0x06, 0x5F, 0x15, 0x06, 0x27, 0x26, 0x0F, 0x27, 0x36, 0x0E, 0x16, 0x1A, 0x0E, 0x16,
+	0x14, 0x15, 0x17, 0x06, 0x16, 0x14, 0x15, 0x26, 0x06, 0x16, 0x23, 0x15, 0x44, 0x06, 0x56, 0x61, 0x33, 0x08, 0x37, 0x52, 0x32, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x16,
+	0x09, 0x3B, 0x36, 0x09, 0x3A, 0x26, 0x11, 0x09, 0x38, 0x36, 0x12, 0x09, 0x46, 0x36, 0x13, 0x09, 0x26, 0x27, 0x15, 0x09, 0xCE, 0x06, 0x00, 0x0F, 0x17, 0x09, 0x00, 0x0F, 0x67, 0x04, 0x0F, 0x86,
+	0x03, 0x0F, 0x45, 0x51, 0x02, 0x0F, 0x34, 0x26, 0x02, 0x0F, 0x33, 0x28, 0x01, 0x0F, 0x32, 0x29, 0x01, 0x3A, 0x42, 0x2A, 0x01, 0x00, 0x3A, 0x22, 0x2C, 0x01, 0x0F, 0x3D, 0x01, 0x0F, 0x3C, 0x02,
+	0x0F, 0x5A, 0x02, 0x0F, 0x4A, 0x03, 0x0F, 0x2A, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x11, 0x75, 0x24, 0x0C,
+	0x11, 0x54, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x13, 0x73, 0x24, 0x0C, 0x13, 0x66, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47,
+	0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C, 0x13, 0x52, 0x27, 0x0C, 0x13, 0x22,
+	0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x11, 0x68, 0x22, 0x0C, 0x11, 0x8A, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F,
+	0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x13, 0x88, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x30, 0x53, 0x27, 0x0C, 0x20, 0x24, 0x2A, 0x0C,
+	0x20, 0x54, 0x27, 0x0C, 0x30, 0x74, 0x24, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x13, 0x88, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06,
+	0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x31, 0x88, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x20, 0x75, 0x24, 0x0C, 0x20, 0x54, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53,
+	0x27, 0x0C, 0x22, 0x73, 0x24, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x31, 0x88, 0x0C, 0x30, 0x6C, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F,
+	0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x22, 0x73, 0x24, 0x0C, 0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x22, 0x73, 0x24,
+	0x0C, 0x22, 0x66, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72,
+	0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x52, 0x63, 0x22, 0x0C, 0x31, 0x91, 0x24, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0xC2, 0x24, 0x0C, 0x33, 0x64, 0x22, 0x0C,
+	0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x64, 0x07, 0x0F, 0x62, 0x09, 0x6F, 0x0B, 0x7D, 0x0C,
+	0x6B, 0x21, 0x0C, 0x69, 0x23, 0x0C, 0x57, 0x26, 0x0C, 0x46, 0x28, 0x0C, 0x26, 0x2A, 0x0C, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x47, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F,
+	0x21, 0x24, 0x26, 0x0F, 0x41, 0x22, 0x00, 0x26, 0x0F, 0x21, 0x51, 0x26, 0x0F, 0x21, 0x32, 0x01, 0x36, 0x3E, 0x06, 0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x39, 0x38, 0x09, 0x0F,
+	0x16, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x11, 0x24, 0x27, 0x27, 0x06, 0x00, 0x21, 0x23, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06,
+	0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x13, 0x22, 0x27, 0x27, 0x06, 0x00,
+	0x22, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x11, 0x24, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x26, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x00, 0x30,
+	0x23, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27,
+	0x27, 0x06, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29,
+	0x06, 0x11, 0x0F, 0x0F, 0x00, 0x21, 0xF3, 0x50, 0x06, 0x22, 0xF2, 0x50, 0x06, 0x13, 0xF2, 0x50, 0x06, 0x13, 0x0F, 0x0D, 0x13, 0xF2, 0x50, 0x06, 0x00, 0x22, 0xF2, 0x50, 0x06, 0x21, 0x0F, 0x0E,
+	0x11, 0x0F, 0x0F, 0x00, 0x22, 0x0F, 0x0D, 0x21, 0x0F, 0x0E, 0x30, 0xF3, 0x50, 0x06, 0x20, 0xF4, 0x50, 0x06, 0x00, 0x30, 0x0F, 0x0E, 0x22, 0x0F, 0x0D, 0x13, 0x0F, 0x0D, 0x22, 0x0F, 0x0D, 0x00,
+	0xF6, 0x50, 0x06, 0x00, 0x00, 0x22, 0x0F, 0x0D, 0x00, 0x2F, 0x0F, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x36, 0x3E,
+	0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x4E, 0x0E, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x31, 0x44, 0x0F, 0x05, 0x30,
+	0x46, 0x0F, 0x04, 0x20, 0x49, 0x0F, 0x02, 0x20, 0x5A, 0x0F, 0x21, 0x4B, 0x0E, 0x21, 0x5C, 0x0C, 0x22, 0x4D, 0x0B, 0x22, 0x4F, 0x09, 0x31, 0x0F, 0x51, 0x07, 0x30, 0x0F, 0x44, 0x06, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x11, 0x24, 0x3F, 0x06, 0x11, 0x24, 0x0F, 0x21, 0x06, 0x21, 0x23,
+	0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09,
+	0xAB, 0x0B, 0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x22,
+	0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x11, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E,
+	0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F,
+	0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x13, 0x23, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9,
+	0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x31, 0x23, 0x2E, 0x07, 0x30, 0x23, 0x3F, 0x06, 0x20, 0x24, 0x0F, 0x21,
+	0x06, 0x00, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x31, 0x23, 0x2E, 0x07, 0x30, 0x34, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B,
+	0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21,
+	0x06, 0x00, 0x00, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0x1B, 0x19, 0x0A, 0x3A, 0x37,
+	0x09, 0x3B, 0x35, 0x0A, 0x3C, 0x33, 0x0B, 0x3D, 0x31, 0x0C, 0x5E, 0x0D, 0x3F, 0x0E, 0x5E, 0x0D, 0x3D, 0x31, 0x0C, 0x3C, 0x33, 0x0B, 0x3B, 0x35, 0x0A, 0x3A, 0x37, 0x09, 0x1B, 0x19, 0x0A, 0x4E,
+	0x0E, 0xAB, 0x14, 0x06, 0xE9, 0x21, 0x06, 0x58, 0x76, 0x06, 0x38, 0x3A, 0x08, 0x37, 0x5A, 0x07, 0x27, 0x3A, 0x21, 0x07, 0x26, 0x3A, 0x32, 0x06, 0x26, 0x39, 0x24, 0x06, 0x26, 0x38, 0x25, 0x06,
+	0x26, 0x46, 0x26, 0x06, 0x26, 0x35, 0x28, 0x06, 0x26, 0x34, 0x29, 0x06, 0x36, 0x32, 0x2A, 0x06, 0x27, 0x31, 0x2A, 0x07, 0x57, 0x3A, 0x07, 0x38, 0x3A, 0x08, 0x76, 0x56, 0x08, 0x35, 0xE1, 0x09,
+	0x25, 0xA4, 0x0B, 0x15, 0x38, 0x0F, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x00, 0x21, 0x0F, 0x26, 0x06,
+	0x22, 0x0F, 0x25, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x13, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6,
+	0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x11, 0x0F, 0x36, 0x06,
+	0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x13, 0x0F, 0x24, 0x07, 0x22, 0x0F, 0x34,
+	0x06, 0x21, 0x0F, 0x26, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x10, 0x0F, 0x28, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x13, 0x0F, 0x24, 0x07, 0x0F, 0x46, 0x07,
+	0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x22, 0x0F, 0x34, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x0F, 0x29,
+	0x06, 0x00, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0x16, 0x0F, 0x0A, 0x36, 0x0F, 0x08, 0x46,
+	0x0F, 0x07, 0x57, 0x0F, 0x05, 0x59, 0x0F, 0x03, 0x4B, 0x0F, 0x02, 0x13, 0x58, 0x0F, 0x13, 0xCA, 0x06, 0x22, 0xBB, 0x06, 0x21, 0xCB, 0x06, 0x11, 0x5A, 0x0F, 0x11, 0x49, 0x0F, 0x02, 0x59, 0x0F,
+	0x03, 0x57, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x16, 0x0F, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x2A, 0x28, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x36, 0x0A, 0x3B,
+	0x34, 0x0B, 0x9B, 0x0C, 0x7C, 0x0D, 0xF9, 0x20, 0x06, 0xF7, 0x40, 0x06, 0xF6, 0x50, 0x06, 0x26, 0x0F, 0x09, 0x25, 0x0F, 0x0A, 0x00, 0x25, 0x0F, 0x31, 0x06, 0x25, 0x36, 0x28, 0x06, 0x25, 0x65,
+	0x26, 0x06, 0x35, 0x33, 0x31, 0x26, 0x06, 0x76, 0x33, 0x25, 0x06, 0x66, 0x35, 0x24, 0x06, 0x38, 0x77, 0x07, 0x0F, 0x73, 0x07, 0x0F, 0x35, 0x09, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93,
+	0x06, 0x3B, 0x23, 0x34, 0x06, 0x14, 0x25, 0x34, 0x25, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06, 0x34, 0x23, 0x24, 0x26, 0x06, 0x25, 0x23, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x17, 0x32,
+	0x23, 0x24, 0x08, 0xDB, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x17, 0x22,
+	0x24, 0x26, 0x06, 0x26, 0x22, 0x24, 0x26, 0x06, 0x25, 0x23, 0x24, 0x16, 0x07, 0x24, 0x24, 0x24, 0x25, 0x07, 0x24, 0x34, 0x23, 0x24, 0x08, 0x14, 0xD6, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29,
+	0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x17, 0x33, 0x93, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x25, 0x23, 0x34, 0x25, 0x06, 0x34, 0x23, 0x24, 0x26, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06,
+	0x24, 0x24, 0x24, 0x16, 0x07, 0x34, 0x23, 0x24, 0x25, 0x07, 0x35, 0x32, 0x23, 0x24, 0x08, 0x26, 0xD3, 0x08, 0x17, 0xF3, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74,
+	0x07, 0x3B, 0x93, 0x06, 0x35, 0x33, 0x23, 0x34, 0x06, 0x24, 0x24, 0x34, 0x25, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06, 0x00, 0x25, 0x23, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x26, 0x32,
+	0x23, 0x24, 0x08, 0x35, 0xD3, 0x08, 0x34, 0xF4, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x26, 0x22, 0x34,
+	0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x26, 0x32, 0x23, 0x24, 0x08, 0x26, 0xD3, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F,
+	0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x52, 0x23, 0x34, 0x25, 0x06, 0x31, 0x31, 0x22, 0x24, 0x26, 0x06, 0x21, 0x23, 0x22, 0x24, 0x26, 0x06, 0x21, 0x23, 0x22,
+	0x24, 0x16, 0x07, 0x21, 0x23, 0x22, 0x24, 0x25, 0x07, 0x52, 0x33, 0x23, 0x24, 0x08, 0x33, 0xD5, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B,
+	0x93, 0x06, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x00, 0x00, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x24, 0x08, 0xCB, 0x09, 0x00, 0xEB, 0x07, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24,
+	0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08,
+	0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x24, 0x2A, 0x4C, 0x22, 0x00, 0x2A, 0x2C, 0x51, 0x3A, 0x3A, 0x32, 0x01, 0x4B, 0x37, 0x07, 0x3C, 0x36, 0x08, 0x2D, 0x26, 0x09, 0x6F, 0x0B, 0xAD,
+	0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x14, 0x35, 0x24, 0x34, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06,
+	0x17, 0x32, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06,
+	0x17, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x24, 0x34, 0x24, 0x25, 0x06, 0x14, 0x36, 0x23, 0x24, 0x07, 0x7C, 0x33,
+	0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0x17, 0xC4, 0x08, 0x26, 0x33, 0x23, 0x33, 0x07, 0x25, 0x33, 0x24, 0x34, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x25,
+	0x25, 0x06, 0x00, 0x34, 0x23, 0x25, 0x25, 0x06, 0x35, 0x32, 0x24, 0x25, 0x06, 0x26, 0x33, 0x23, 0x24, 0x07, 0x17, 0x74, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09,
+	0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x26, 0x33, 0x23, 0x24, 0x07, 0x26,
+	0x74, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x14, 0x0F, 0x0C, 0x24, 0x0F, 0x0B, 0x34, 0xF3, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x26, 0xF2, 0x10, 0x06, 0x17, 0x0F, 0x09, 0x17, 0x0F,
+	0x09, 0x26, 0xF2, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06, 0x24, 0x0F, 0x0B, 0x14, 0x0F, 0x0C, 0x17, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x25, 0x0F, 0x0A, 0x34, 0xF3, 0x10, 0x06,
+	0x24, 0xF4, 0x10, 0x06, 0x00, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x17, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x26, 0x0F, 0x09,
+	0x00, 0x0F, 0x61, 0x0A, 0xAE, 0x08, 0xCD, 0x07, 0x15, 0x22, 0x33, 0x36, 0x07, 0x15, 0x12, 0x33, 0x38, 0x06, 0x25, 0x11, 0x23, 0x2A, 0x06, 0x36, 0x23, 0x2A, 0x06, 0x00, 0x46, 0x22, 0x2A, 0x06,
+	0x16, 0x31, 0x21, 0x39, 0x06, 0x16, 0x62, 0x28, 0x07, 0x25, 0xF3, 0x07, 0xCC, 0x08, 0x7F, 0x0A, 0xFA, 0x10, 0x06, 0x00, 0x35, 0xD5, 0x06, 0x24, 0x25, 0x0F, 0x04, 0x24, 0x15, 0x0F, 0x05, 0x24,
+	0x24, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x26, 0x22, 0x0F, 0x05, 0x00, 0x35, 0x52, 0x0F, 0x02, 0x34, 0xF4, 0x06, 0xEC, 0x06, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x14, 0x35,
+	0x3A, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x17, 0x32, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F,
+	0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x17, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x24, 0x34, 0x3A, 0x06, 0x14,
+	0x36, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0x17, 0xE3, 0x07, 0x26, 0x33, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06,
+	0x00, 0x34, 0x23, 0x2C, 0x06, 0x35, 0x32, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0x17, 0xE3, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x35, 0x33, 0x38, 0x07, 0x24, 0x34,
+	0x3A, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x00, 0x25, 0x23, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x35, 0x33, 0x38, 0x07, 0x34, 0xE4, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B,
+	0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x26, 0x32, 0x3A, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0x26, 0xE3, 0x07, 0xBC, 0x09,
+	0x6F, 0x0B, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x22, 0x32, 0x0A, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1A, 0x06, 0x6F, 0x23, 0x06, 0xEC, 0x06, 0xEB, 0x07, 0x3B,
+	0x47, 0x07, 0x3A, 0x36, 0x31, 0x06, 0x2A, 0x36, 0x23, 0x06, 0x2A, 0x35, 0x24, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x33, 0x26, 0x06, 0x3A, 0x31, 0x36, 0x06, 0x4B, 0x37, 0x07, 0xEB, 0x07, 0xEA,
+	0x08, 0x2A, 0x82, 0x0A, 0x1A, 0x0F, 0x06, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x14, 0x0F, 0x24, 0x06, 0x24, 0x0F, 0x23, 0x06, 0x34, 0x0F, 0x22, 0x06, 0x25, 0x0F, 0x22, 0x06, 0x26, 0x2F,
+	0x07, 0x17, 0x2F, 0x07, 0xDA, 0x09, 0xFA, 0x10, 0x06, 0x00, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x17, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x22, 0x06,
+	0x24, 0x0F, 0x22, 0x07, 0x00, 0x14, 0xD5, 0x09, 0xFA, 0x10, 0x06, 0x00, 0xEA, 0x08, 0x17, 0xF2, 0x07, 0x26, 0x5D, 0x06, 0x25, 0x0F, 0x22, 0x06, 0x34, 0x0F, 0x22, 0x06, 0x24, 0x0F, 0x23, 0x06,
+	0x00, 0x34, 0x0F, 0x21, 0x07, 0x35, 0x2F, 0x07, 0x26, 0xD2, 0x09, 0x17, 0xF2, 0x10, 0x06, 0xFA, 0x10, 0x06, 0xEA, 0x08, 0xFA, 0x07, 0x26, 0x5D, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06,
+	0x00, 0x00, 0x0F, 0x28, 0x07, 0x26, 0x2F, 0x07, 0x26, 0xD2, 0x09, 0xFA, 0x10, 0x06, 0x00, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x8C, 0x39, 0x17, 0x78, 0x35, 0x01, 0x26, 0xCB, 0x01,
+	0x25, 0x0F, 0x61, 0x03, 0x24, 0x7E, 0x05, 0x24, 0x8A, 0x08, 0x14, 0x88, 0x0B, 0x8A, 0x0E, 0x4A, 0x0F, 0x03, 0x1A, 0x0F, 0x06, 0xF5, 0xC0, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C,
+	0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08, 0x6F, 0x0B, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x26, 0x84, 0x39, 0x26, 0x78, 0x35,
+	0x01, 0x0F, 0xC4, 0x01, 0x0F, 0x68, 0x03, 0x0F, 0x75, 0x05, 0x0F, 0x81, 0x08, 0x26, 0x85, 0x0B, 0x26, 0x82, 0x0E, 0x4A, 0x0F, 0x03, 0x1A, 0x0F, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F,
+	0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x8C, 0x0C, 0x21, 0x67, 0x22, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x74, 0x24,
+	0x0C, 0x21, 0x67, 0x22, 0x0C, 0x21, 0x89, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x26,
+	0x33, 0x32, 0x34, 0x06, 0x26, 0x32, 0x33, 0x25, 0x06, 0x26, 0x22, 0x24, 0x26, 0x06, 0x00, 0x26, 0x22, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x26, 0x32, 0x23, 0x33, 0x08, 0x26, 0xE3,
+	0x07, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x20, 0x8A, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x31, 0x73,
+	0x24, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x22, 0x22, 0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x31, 0x73, 0x24, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x20, 0x8A, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65,
+	0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x24, 0x35, 0x32, 0x34, 0x06, 0x34, 0x33, 0x33, 0x25, 0x06, 0x35, 0x22, 0x24, 0x26, 0x06, 0x26,
+	0x22, 0x24, 0x26, 0x06, 0x26, 0x22, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x35, 0x32, 0x23, 0x33, 0x08, 0x34, 0xE4, 0x07, 0x24, 0xF5, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F,
+	0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C, 0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x77, 0x24,
+	0x0C, 0x6A, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x37, 0x01, 0x0F, 0x72, 0x62, 0x0F, 0x75, 0x23, 0x0F, 0x47, 0x24, 0x0F, 0x1A, 0x24, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x32,
+	0x34, 0x06, 0x3A, 0x33, 0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x33, 0x08, 0xEB, 0x33, 0x01, 0xFB, 0x60, 0xED, 0x23, 0x0F, 0x29,
+	0x24, 0x00, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x36, 0x3E, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06,
+	0x22, 0x22, 0x0F, 0x21, 0x06, 0x12, 0x23, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x11, 0x34, 0x2E, 0x07, 0x11, 0x25, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x29, 0x39, 0x09,
+	0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x17, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x3B, 0x06, 0x24, 0x34, 0x3A, 0x06,
+	0x14, 0x46, 0x46, 0x07, 0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x13, 0x32, 0x3E, 0x06, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23,
+	0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x22, 0x32, 0x2E, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x47,
+	0x3B, 0x07, 0x48, 0x48, 0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0x17, 0xE3, 0x07, 0x26, 0x33, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x34,
+	0x23, 0x2C, 0x06, 0x25, 0x23, 0x3B, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x17, 0x43, 0x46, 0x07, 0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C,
+	0x07, 0x36, 0x3E, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x36, 0x2E, 0x07, 0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48,
+	0x48, 0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x00, 0x00, 0x2A, 0x3B, 0x06, 0x3A, 0x3A, 0x06, 0x4B, 0x46, 0x07,
+	0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x10, 0x35, 0x3E, 0x06, 0x20, 0x24, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x31,
+	0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x34, 0x2E, 0x07, 0x10, 0x26, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48,
+	0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0x14, 0xE6, 0x07, 0x24, 0x35, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x25,
+	0x23, 0x3B, 0x06, 0x24, 0x34, 0x3A, 0x06, 0x14, 0x46, 0x46, 0x07, 0x3C, 0x36, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x10, 0x25, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21,
+	0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x33, 0x3E, 0x06, 0x20, 0x25, 0x2E, 0x07, 0x10, 0x36, 0x3C,
+	0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x2B, 0x2A, 0x07,
+	0x2C, 0x37, 0x08, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x25, 0x12, 0x0F, 0x07, 0x2F, 0x0F, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x26, 0x0F, 0x21, 0x06, 0x36, 0x3E, 0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06,
+	0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x27, 0x21, 0x2C, 0x06, 0x00, 0x27, 0x22, 0x2A, 0x07, 0x27, 0x23, 0x37, 0x08, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27,
+	0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x26, 0x43, 0x22,
+	0x33, 0x07, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x20, 0x24, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x00, 0x31, 0x22, 0x27, 0x27, 0x06, 0x30,
+	0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x24, 0x45, 0x22, 0x33, 0x07, 0x34, 0x33, 0x24,
+	0x34, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x35, 0x32, 0x24, 0x34, 0x06, 0x34, 0x34, 0x23, 0x34, 0x06, 0x24, 0x85, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD,
+	0x09, 0xDB, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x24, 0x34, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x8B, 0x33,
+	0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x27, 0x27, 0x32, 0x01, 0x26, 0x27, 0x87, 0x26, 0x27, 0x37, 0x23,
+	0x26, 0x27, 0x27, 0x24, 0x0F, 0x29, 0x24, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x32, 0x01, 0x2A, 0x25, 0x85, 0x2A, 0x25, 0x35,
+	0x23, 0x2A, 0x25, 0x25, 0x24, 0x3A, 0x24, 0x34, 0x24, 0x3B, 0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x10, 0x25, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27,
+	0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06,
+	0x10, 0x25, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x14, 0x46, 0x22, 0x33, 0x07, 0x24, 0x34, 0x24, 0x34, 0x06, 0x25, 0x23,
+	0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x25, 0x33, 0x24, 0x34, 0x06, 0x24, 0x35, 0x23, 0x34, 0x06, 0x14, 0x86, 0x33, 0x07,
+	0x7C, 0x23, 0x08, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30,
+	0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x28, 0x26, 0x06, 0x21, 0x23, 0x28, 0x26, 0x06, 0x22, 0x22, 0x28, 0x26, 0x06, 0x13, 0x32, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25,
+	0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x17, 0x42, 0x48, 0x32, 0x01, 0x26, 0x32, 0x3A, 0x33, 0x25, 0x23, 0x2C, 0x24,
+	0x34, 0x23, 0x2C, 0x24, 0x24, 0x24, 0x2C, 0x24, 0x34, 0x14, 0x1C, 0x25, 0x25, 0x24, 0x2A, 0x34, 0x26, 0x34, 0x36, 0x34, 0x01, 0x17, 0xF2, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D,
+	0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x20, 0x25, 0x2E, 0x07, 0x30, 0x23, 0x3F, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06,
+	0x00, 0x22, 0x22, 0x28, 0x26, 0x06, 0x31, 0x22, 0x28, 0x26, 0x06, 0x30, 0x23, 0x28, 0x26, 0x06, 0x20, 0x34, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08,
+	0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x24, 0x44, 0x48, 0x32, 0x01, 0x34, 0x33, 0x3A, 0x33, 0x35, 0x22, 0x2C, 0x24, 0x26, 0x22, 0x2C, 0x24, 0x00, 0x26, 0x13, 0x1C,
+	0x25, 0x35, 0x23, 0x2A, 0x34, 0x34, 0x35, 0x36, 0x34, 0x01, 0x24, 0xF4, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07,
+	0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x22, 0x22, 0x28, 0x26, 0x06, 0x26, 0x28, 0x26, 0x06, 0x00, 0x36, 0x27, 0x35,
+	0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x4A, 0x48, 0x32, 0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C,
+	0x24, 0x26, 0x22, 0x2C, 0x24, 0x00, 0x26, 0x13, 0x1C, 0x25, 0x2B, 0x2A, 0x34, 0x3C, 0x36, 0x34, 0x01, 0xFA, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09,
+	0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x21, 0x12, 0x26, 0x0F, 0x21, 0x51, 0x26, 0x28, 0x26, 0x41,
+	0x01, 0x26, 0x28, 0x26, 0x06, 0x00, 0x36, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01,
+	0x4A, 0x48, 0x32, 0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C, 0x24, 0x44, 0x22, 0x2C, 0x24, 0x53, 0x22, 0x2C, 0x24, 0x13, 0x22, 0x13, 0x1C, 0x25, 0x2B, 0x2A, 0x34, 0x3C, 0x36, 0x34, 0x01, 0xFA, 0x60,
+	0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x2E, 0x0F, 0x01, 0x13, 0x2A, 0x0F, 0x01, 0x22, 0x2A, 0x0F, 0x01, 0x21, 0x2B, 0x0F, 0x01, 0x30, 0x2B, 0x0F, 0x01, 0x20,
+	0x2C, 0x0F, 0x01, 0x30, 0x2B, 0x0F, 0x01, 0x21, 0x2B, 0x0F, 0x01, 0x22, 0x2A, 0x0F, 0x01, 0x13, 0x2A, 0x0F, 0x01, 0x2E, 0x0F, 0x01, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x12,
+	0xF2, 0x60, 0x06, 0x21, 0x29, 0x0F, 0x03, 0x20, 0x29, 0x0F, 0x04, 0x20, 0x28, 0x0F, 0x05, 0x10, 0x29, 0x0F, 0x05, 0x20, 0x28, 0x0F, 0x05, 0x00, 0x21, 0x37, 0x0F, 0x04, 0x12, 0xF7, 0x10, 0x06,
+	0xFB, 0x06, 0xEC, 0x06, 0x29, 0x0F, 0x06, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x29, 0x23, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x29, 0x0F, 0x06, 0x27, 0x0F, 0x08, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x27, 0x23, 0x0F, 0x03, 0x27, 0x22, 0x0F, 0x04, 0x27, 0x21, 0x0F, 0x05, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x3A, 0x0F, 0x04,
+	0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0x22, 0x0F, 0x0D, 0x30, 0x0F, 0x0E, 0x20, 0x0F, 0x0F, 0x20, 0xF4, 0x50, 0x06, 0x21, 0xF3, 0x50, 0x06, 0x00, 0x22, 0x0F, 0x0D, 0x00, 0x26, 0x0F, 0x09,
+	0x34, 0x0F, 0x0A, 0x24, 0x0F, 0x0B, 0x24, 0xF4, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x21, 0x0F, 0x0E, 0x00, 0x21, 0xF3, 0x50, 0x06, 0x00, 0x00, 0x21, 0x0F, 0x0E,
+	0x26, 0x0F, 0x09, 0x00, 0x26, 0xF2, 0x10, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x09, 0x20, 0x0F, 0x0F, 0x30, 0x0F, 0x0E, 0x31, 0x0F, 0x0D, 0x22, 0xF2, 0x50, 0x06, 0x00, 0x00, 0x31, 0x0F, 0x0D, 0x30,
+	0x0F, 0x0E, 0x24, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0xF2, 0x10, 0x06, 0x00, 0x00, 0x35, 0x0F, 0x09, 0x34, 0x0F, 0x0A, 0x0F, 0x3D, 0x01, 0x0F, 0x6B, 0xF6, 0x60, 0x23, 0xF6,
+	0x50, 0x24, 0x00, 0x0F, 0x3D, 0x01, 0x0F, 0x6B, 0x25, 0xF3, 0x20, 0x23, 0x25, 0xF3, 0x10, 0x24, 0x00, 0x22, 0xF2, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x0F, 0x0F, 0x02, 0x0F, 0x16, 0x0A, 0x0F, 0x36, 0x08, 0x0F, 0x55, 0x07, 0x0F, 0x37, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x3F, 0x06, 0x26, 0x3E,
+	0x07, 0xF6, 0x40, 0x07, 0xF6, 0x30, 0x08, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x2F, 0x00, 0x00, 0x25, 0xF3, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x25, 0xF3, 0x50, 0x02, 0x0F, 0x16, 0x0A, 0x0F,
+	0x36, 0x08, 0x0F, 0x55, 0x07, 0x0F, 0x37, 0x07, 0x0F, 0x38, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x3F, 0x06, 0x20, 0x24, 0x3E,
+	0x07, 0x30, 0xF3, 0x40, 0x07, 0x21, 0xF3, 0x30, 0x08, 0x22, 0xF2, 0x20, 0x09, 0x27, 0x0F, 0x26, 0x26, 0x0F, 0x27, 0x35, 0xF2, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x35, 0xF2, 0x50, 0x02, 0x26, 0x0F,
+	0x09, 0x27, 0x0F, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x2F, 0x0F, 0x2E, 0x0F, 0x01, 0x4D, 0x0F, 0x7C, 0x28, 0x12, 0x3B, 0x42, 0x57, 0x3A, 0x44, 0x46, 0x01, 0x39, 0x46, 0x0A,
+	0x38, 0x39, 0x09, 0x37, 0x4B, 0x07, 0x36, 0x4D, 0x06, 0x26, 0x3F, 0x06, 0x16, 0x0F, 0x22, 0x06, 0x0F, 0x1A, 0x06, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x32, 0x0C, 0x0F, 0x31, 0x0D, 0x5F, 0x27,
+	0x12, 0x7E, 0x56, 0x3D, 0x42, 0x45, 0x01, 0x3C, 0x45, 0x08, 0x3B, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C, 0x06, 0x1A, 0x1E, 0x06, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x32, 0x0C, 0x0F, 0x31,
+	0x0D, 0x4F, 0x0D, 0x7E, 0x0B, 0x3D, 0x42, 0x0A, 0x3C, 0x45, 0x08, 0x3B, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C, 0x06, 0x1A, 0x1E, 0x06, 0xF6, 0x50, 0x06, 0x13, 0xF2, 0x50, 0x06, 0x22, 0xF2,
+	0x50, 0x06, 0x12, 0x0F, 0x26, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xF2, 0x60, 0x06, 0x21, 0xF2, 0x60, 0x06, 0x11,
+	0xF3, 0x60, 0x06, 0x20, 0x0F, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x29, 0x21, 0x12, 0x0F, 0x29, 0x51, 0x0F, 0x29, 0x41, 0x01, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0xF5, 0x60, 0x21, 0x12, 0xF5, 0x60, 0x51, 0xF5, 0x60, 0x41, 0x01, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x26, 0x12, 0x2D, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E,
+	0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x25, 0x12, 0x0F, 0x07, 0x55, 0x0F, 0x07, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00,
+	0x2F, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x2F, 0x0F, 0x00, 0x0F, 0x31, 0x0D, 0x0F, 0x21, 0x0E, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x2E, 0x28, 0x06, 0x2D, 0x29, 0x06, 0x00, 0x2C, 0x2A, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x23, 0x0C, 0x0F, 0x22, 0x0D, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x49, 0x0F, 0x04, 0x4B, 0x0F, 0x02, 0x13, 0x58, 0x0F, 0x22, 0x4A, 0x0E, 0x12, 0x5C, 0x0C, 0x21, 0x5E, 0x0A, 0x11, 0x0F, 0x42, 0x09, 0x11,
+	0x0F, 0x53, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x17, 0x22, 0x0F, 0x05, 0x26, 0x22, 0x0F, 0x05, 0x25, 0x23,
+	0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x24, 0x34, 0x0F, 0x04, 0x14, 0xF5, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x49, 0x0F, 0x04,
+	0x4B, 0x0F, 0x02, 0x5C, 0x2A, 0x12, 0x4E, 0x59, 0x5F, 0x47, 0x01, 0x0F, 0x52, 0x0A, 0x0F, 0x44, 0x09, 0x0F, 0x55, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00,
+	0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x2F, 0x12, 0x2A, 0x5F, 0x2A, 0x4F, 0x01, 0x2A, 0x0F, 0x05, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x46, 0x0F, 0x07, 0x10, 0x56, 0x0F, 0x05, 0x20, 0x47, 0x0F, 0x04, 0x21, 0x48, 0x0F, 0x02, 0x31, 0x58, 0x0F, 0x22, 0x4A, 0x0E, 0x31, 0x5B, 0x0C, 0x21, 0x5E, 0x0A, 0x20, 0x0F, 0x42, 0x09,
+	0x10, 0x0F, 0x54, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x14, 0xF5, 0x10, 0x06, 0x24, 0x26, 0x0F, 0x03, 0x25, 0x24, 0x0F, 0x04, 0x35, 0x22, 0x0F, 0x05,
+	0x26, 0x22, 0x0F, 0x05, 0x35, 0x22, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x34, 0x0F, 0x04, 0x14, 0xF5, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0x36, 0x13, 0x0F, 0x04, 0x76, 0x0F, 0x04, 0x66,
+	0x0F, 0x05, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06,
+	0x00, 0x00, 0x29, 0x0F, 0x06, 0x28, 0x0F, 0x07, 0x27, 0x0F, 0x08, 0x00, 0x26, 0x2F, 0x07, 0x26, 0x3E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x36, 0x2F, 0x06, 0x37, 0x4C, 0x06,
+	0xF7, 0x30, 0x07, 0xF8, 0x10, 0x08, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x2A, 0x0F, 0x23, 0x3A, 0x0F, 0x22, 0xFA, 0x70, 0xFB, 0x60,
+	0xFC, 0x30, 0x02, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D, 0x07, 0x21, 0x33, 0x3E, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x33, 0x2E, 0x07, 0x27, 0x2E, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x26, 0x33, 0x47, 0x07, 0x26, 0x32, 0x3A, 0x06, 0x26,
+	0x22, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x26, 0x32, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0xEB, 0x07, 0xCC, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D,
+	0x07, 0x20, 0x34, 0x3E, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x30, 0x33, 0x2E, 0x07, 0x20,
+	0x25, 0x2E, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x24, 0x35, 0x47, 0x07, 0x34, 0x33, 0x3A, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x26,
+	0x22, 0x2C, 0x06, 0x00, 0x00, 0x35, 0x32, 0x3A, 0x06, 0x34, 0x34, 0x38, 0x07, 0x24, 0xE5, 0x07, 0xCC, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D,
+	0x07, 0x13, 0x32, 0x3E, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x10, 0x12, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06,
+	0x21, 0x33, 0x2E, 0x07, 0x20, 0x25, 0x2E, 0x07, 0x20, 0x45, 0x4A, 0x07, 0x10, 0x57, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x17, 0x33, 0x47, 0x07, 0x26, 0x32,
+	0x3A, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x00, 0x14, 0x12, 0x22, 0x2C, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x25, 0x34, 0x38, 0x07, 0x24, 0xE5, 0x07, 0x24, 0xC6, 0x08, 0x7C, 0x0D,
+	0xCA, 0x0A, 0xE9, 0x09, 0x48, 0x57, 0x08, 0x37, 0x4B, 0x07, 0x27, 0x3D, 0x07, 0x27, 0x3E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4B, 0x46, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00,
+	0x3A, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0xCC, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x34, 0x06, 0x3B,
+	0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x13, 0x22, 0x28, 0x0E, 0x22, 0x22, 0x28, 0x0E, 0x12, 0x23, 0x28, 0x0E, 0x21,
+	0x23, 0x28, 0x0E, 0x11, 0x24, 0x48, 0x0C, 0x11, 0x24, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F, 0x1A, 0x06, 0xFA, 0x10,
+	0x06, 0x00, 0x17, 0xF2, 0x10, 0x06, 0x26, 0x24, 0x0F, 0x03, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x26, 0x28,
+	0x29, 0x12, 0x26, 0x28, 0x59, 0x26, 0x28, 0x49, 0x01, 0x26, 0x48, 0x0C, 0x26, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F,
+	0x1A, 0x06, 0xFA, 0x10, 0x21, 0x12, 0xFA, 0x10, 0x51, 0xFA, 0x10, 0x41, 0x01, 0x2C, 0x0F, 0x03, 0x2A, 0x0F, 0x05, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x10, 0x25, 0x28, 0x0E,
+	0x20, 0x24, 0x28, 0x0E, 0x21, 0x23, 0x28, 0x0E, 0x31, 0x22, 0x28, 0x0E, 0x22, 0x22, 0x28, 0x0E, 0x31, 0x22, 0x28, 0x0E, 0x21, 0x23, 0x48, 0x0C, 0x20, 0x24, 0x58, 0x0B, 0x10, 0x35, 0x86, 0x09,
+	0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F, 0x1A, 0x06, 0x14, 0x0F, 0x0C, 0x24, 0xF4, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x35, 0xF2, 0x10, 0x06, 0x26,
+	0x24, 0x0F, 0x03, 0x35, 0x22, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36,
+	0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x13, 0x22, 0x36, 0x27, 0x06, 0x22, 0x22, 0x36, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x20, 0x24, 0x37, 0x26, 0x06,
+	0x10, 0x35, 0x36, 0x35, 0x06, 0x37, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x7B, 0x35, 0x06, 0x3A, 0x32, 0x35, 0x06, 0x2A,
+	0x24, 0x26, 0x06, 0x17, 0x22, 0x34, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x35, 0x24, 0x06, 0x24, 0x34, 0x34, 0x33, 0x06, 0x14, 0x36, 0x74, 0x07,
+	0x3B, 0x74, 0x07, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x13, 0x32, 0x34, 0x37, 0x06, 0x22, 0x22, 0x26, 0x28, 0x06, 0x21, 0x23, 0x36,
+	0x27, 0x06, 0x30, 0x23, 0x36, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x21, 0x23, 0x37, 0x26, 0x06, 0x22, 0x32, 0x36, 0x35, 0x06, 0x13, 0x33, 0x36, 0x33, 0x07,
+	0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x17, 0x73, 0x35, 0x06, 0x26, 0x32, 0x32, 0x35, 0x06, 0x25, 0x23, 0x24, 0x26, 0x06, 0x34, 0x23, 0x34,
+	0x25, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x25, 0x23, 0x35, 0x24, 0x06, 0x26, 0x32, 0x34, 0x33, 0x06, 0x17, 0x33, 0x74, 0x07, 0x3B, 0x74, 0x07, 0x0F, 0x16, 0x0A,
+	0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x26, 0x36, 0x27, 0x24, 0x26, 0x36, 0x27, 0x11, 0x22, 0x26, 0x27,
+	0x47, 0x22, 0x26, 0x27, 0x27, 0x51, 0x26, 0x37, 0x26, 0x32, 0x01, 0x36, 0x36, 0x35, 0x06, 0x37, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B,
+	0x35, 0x07, 0x7B, 0x35, 0x06, 0x3A, 0x32, 0x35, 0x06, 0x2A, 0x24, 0x26, 0x24, 0x2A, 0x34, 0x25, 0x11, 0x22, 0x2A, 0x25, 0x45, 0x22, 0x2A, 0x25, 0x25, 0x51, 0x2A, 0x35, 0x24, 0x32, 0x01, 0x3A,
+	0x34, 0x33, 0x06, 0x3B, 0x74, 0x07, 0x00, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x10, 0x35, 0x34, 0x37, 0x06, 0x20, 0x24, 0x26, 0x28,
+	0x06, 0x21, 0x23, 0x36, 0x27, 0x06, 0x31, 0x22, 0x36, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x37, 0x26, 0x06, 0x20, 0x34, 0x36, 0x35, 0x06, 0x10,
+	0x36, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x14, 0x76, 0x35, 0x06, 0x24, 0x34, 0x32, 0x35, 0x06, 0x25, 0x23, 0x24, 0x26,
+	0x06, 0x35, 0x22, 0x34, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x35, 0x24, 0x06, 0x24, 0x34, 0x34, 0x33, 0x06, 0x14, 0x36, 0x74, 0x07, 0x3B, 0x74,
+	0x07, 0x1D, 0x45, 0x09, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x21, 0x12, 0xF6, 0x50, 0x51, 0xF6, 0x50, 0x41, 0x01, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x10, 0x07, 0xF7, 0x40, 0x06, 0xF7, 0x40, 0x21, 0x12, 0x2A, 0x2C, 0x51, 0x2A, 0x2C, 0x41, 0x01, 0x2A, 0x2C, 0x06, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x10, 0x25,
+	0x0F, 0x09, 0x20, 0x24, 0x0F, 0x09, 0x21, 0x23, 0x0F, 0x09, 0x31, 0xF2, 0x50, 0x06, 0x22, 0xF2, 0x50, 0x06, 0x31, 0xF2, 0x50, 0x06, 0x21, 0x23, 0x0F, 0x09, 0x20, 0x24, 0x0F, 0x09, 0x10, 0x25,
+	0x0F, 0x09, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x10, 0x07, 0xF7, 0x40, 0x06, 0x00, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x25, 0x12, 0x0F, 0x07, 0x55, 0x0F, 0x07, 0x26, 0x0F,
+	0x09, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x2A, 0x24, 0x0E, 0x00, 0xF9, 0x10, 0x07, 0xF7,
+	0x40, 0x06, 0x00, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x22, 0x0F, 0x24, 0x07, 0x30, 0x0F, 0x35, 0x06, 0x20, 0x0F, 0x27, 0x06,
+	0x00, 0x21, 0x0F, 0x26, 0x06, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x31, 0x0F, 0x24, 0x07, 0x20, 0x0F, 0x44, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07,
+	0x26, 0xF2, 0x10, 0x06, 0x34, 0x0F, 0x31, 0x06, 0x24, 0x0F, 0x23, 0x06, 0x00, 0x25, 0x0F, 0x22, 0x06, 0x00, 0x26, 0x2F, 0x07, 0x26, 0x2E, 0x08, 0x35, 0xF2, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06,
+	0xFA, 0x10, 0x06, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x21, 0x0F, 0x35, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x00, 0x00, 0x00, 0x00, 0x21, 0x0F, 0x35,
+	0x06, 0x21, 0x0F, 0x25, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x26,
+	0x2F, 0x07, 0x26, 0x2E, 0x08, 0x26, 0xF2, 0x10, 0x06, 0xFA, 0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x20, 0x0F, 0x26, 0x07, 0x30, 0x0F, 0x35, 0x06,
+	0x31, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x00, 0x00, 0x31, 0x0F, 0x25, 0x06, 0x30, 0x0F, 0x35, 0x06, 0x20, 0x0F, 0x26, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA,
+	0x08, 0xFA, 0x07, 0x24, 0xF4, 0x10, 0x06, 0x34, 0x0F, 0x31, 0x06, 0x35, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x35, 0x2F, 0x07, 0x34, 0x2F, 0x08, 0x24, 0xF4, 0x10, 0x06, 0xFA,
+	0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x31, 0x0F, 0x34, 0x06, 0x50, 0x0F, 0x24, 0x06, 0x10, 0x23, 0x0F, 0x23, 0x06, 0x00, 0x00,
+	0x50, 0x0F, 0x24, 0x06, 0x31, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x33, 0x0F, 0x32, 0x06, 0x52,
+	0x0F, 0x22, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x52, 0x0F, 0x21, 0x07, 0x33, 0x0F, 0x21, 0x08, 0xFA, 0x10, 0x06, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F,
+	0x46, 0x07, 0x13, 0x0F, 0x24, 0x07, 0x22, 0x0F, 0x34, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x00, 0x10, 0x12, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x21, 0x0F, 0x35, 0x06,
+	0x20, 0x0F, 0x26, 0x07, 0x20, 0x0F, 0x44, 0x07, 0x10, 0xF5, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x17, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x22,
+	0x06, 0x24, 0x0F, 0x23, 0x06, 0x00, 0x14, 0x12, 0x2F, 0x07, 0x26, 0x2E, 0x08, 0x25, 0xF3, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46,
+	0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x29, 0x32, 0x01, 0x0F, 0x89, 0x0F, 0x39, 0x23, 0x0F, 0x29, 0x24, 0x0F, 0x38, 0x24, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6,
+	0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x32, 0x01, 0x0F, 0x28, 0x61, 0x0F, 0x27, 0x12, 0x23, 0xFA,
+	0x10, 0x24, 0x00, 0xFA, 0x10, 0x06, 0x26, 0x0F, 0x09, 0x56, 0x0F, 0x06, 0x96, 0x0F, 0x02, 0xA8, 0x0E, 0xAC, 0x0A, 0x0F, 0x91, 0x07, 0x0F, 0x74, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x13,
+	0x8C, 0x08, 0x22, 0x98, 0x0B, 0x21, 0x86, 0x0F, 0x30, 0x73, 0x0F, 0x04, 0x20, 0x34, 0x0F, 0x08, 0x30, 0x73, 0x0F, 0x04, 0x21, 0x86, 0x0F, 0x22, 0x98, 0x0B, 0x13, 0x8C, 0x08, 0x0F, 0x74, 0x06,
+	0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x0F, 0x91, 0x07, 0x9C, 0x0B, 0xA8, 0x0E, 0x96, 0x0F, 0x02, 0x56, 0x0F, 0x06, 0x2A, 0x0F, 0x05, 0x6A, 0x0F, 0x01, 0xAA, 0x0C, 0xAE, 0x08, 0x0F, 0x74, 0x06,
+	0x0F, 0x29, 0x06, 0x17, 0x6C, 0x06, 0x26, 0x88, 0x08, 0x25, 0x85, 0x0C, 0x34, 0x63, 0x0F, 0x01, 0x24, 0x24, 0x0F, 0x05, 0x34, 0x63, 0x0F, 0x01, 0x25, 0x85, 0x0C, 0x26, 0x88, 0x08, 0x17, 0x6C,
+	0x06, 0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x9F, 0x08, 0xAA, 0x0C, 0x6A, 0x0F, 0x01, 0x16, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x46, 0x0F, 0x07, 0x47, 0x0F, 0x06, 0x58, 0x0F, 0x04, 0x13, 0x46, 0x0F,
+	0x03, 0x22, 0x57, 0x0F, 0x01, 0x21, 0x4A, 0x0F, 0x30, 0xCB, 0x06, 0x20, 0xBD, 0x06, 0x30, 0xCB, 0x06, 0x21, 0x4A, 0x0F, 0x22, 0x57, 0x0F, 0x01, 0x13, 0x46, 0x0F, 0x03, 0x58, 0x0F, 0x04, 0x47,
+	0x0F, 0x06, 0x46, 0x0F, 0x07, 0x26, 0x0F, 0x09, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x17, 0x84, 0x2A, 0x26, 0x77, 0x37, 0x25, 0x7B, 0x42, 0x01, 0x34, 0x8F, 0x02, 0x24, 0x0F, 0x61,
+	0x04, 0x34, 0x6C, 0x07, 0x25, 0x69, 0x0A, 0x26, 0x75, 0x0C, 0x17, 0x72, 0x0F, 0x4A, 0x0F, 0x03, 0x16, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x46, 0x0F, 0x07, 0x47, 0x0F, 0x06, 0x58, 0x0F, 0x04, 0x4A,
+	0x0F, 0x03, 0x31, 0x57, 0x0F, 0x01, 0x31, 0x49, 0x0F, 0xCE, 0x06, 0xBF, 0x06, 0xCE, 0x06, 0x4D, 0x0F, 0x31, 0x57, 0x0F, 0x01, 0x31, 0x46, 0x0F, 0x03, 0x58, 0x0F, 0x04, 0x47, 0x0F, 0x06, 0x46,
+	0x0F, 0x07, 0x26, 0x0F, 0x09, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x4B, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23, 0x06, 0x13, 0x22, 0x47, 0x25, 0x06, 0x22,
+	0x22, 0x46, 0x26, 0x06, 0x12, 0x23, 0x45, 0x27, 0x06, 0x21, 0x23, 0x43, 0x29, 0x06, 0x11, 0x24, 0x42, 0x2A, 0x06, 0x11, 0x24, 0x41, 0x2B, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E, 0x06, 0x26, 0x0F,
+	0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47, 0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x17, 0x22, 0x45, 0x23, 0x06, 0x26, 0x22, 0x43, 0x25, 0x06,
+	0x25, 0x23, 0x42, 0x26, 0x06, 0x24, 0x24, 0x41, 0x27, 0x06, 0x24, 0x54, 0x29, 0x06, 0x14, 0x45, 0x2A, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D,
+	0x06, 0x26, 0x4B, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23, 0x06, 0x26, 0x47, 0x25, 0x06, 0x22, 0x22, 0x46, 0x26, 0x06, 0x22, 0x22, 0x45, 0x27, 0x06, 0x22, 0x22, 0x43, 0x29, 0x06,
+	0x26, 0x42, 0x2A, 0x06, 0x26, 0x41, 0x2B, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47,
+	0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x26, 0x22, 0x45, 0x23, 0x06, 0x26, 0x22, 0x43, 0x25, 0x06, 0x26, 0x22, 0x42, 0x26, 0x06, 0x2A, 0x41, 0x27, 0x06, 0x5A, 0x29, 0x06, 0x4A, 0x2A, 0x06, 0x3A,
+	0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x4B, 0x21, 0x06, 0x10, 0x25, 0x4A, 0x22, 0x06, 0x20, 0x24, 0x49, 0x23, 0x06, 0x21, 0x23, 0x47, 0x25,
+	0x06, 0x31, 0x22, 0x46, 0x26, 0x06, 0x22, 0x22, 0x45, 0x27, 0x06, 0x31, 0x22, 0x43, 0x29, 0x06, 0x21, 0x23, 0x42, 0x2A, 0x06, 0x20, 0x24, 0x41, 0x2B, 0x06, 0x10, 0x55, 0x2D, 0x06, 0x46, 0x2E,
+	0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x14, 0x25, 0x59, 0x06, 0x24, 0x24, 0x47, 0x21, 0x06, 0x25, 0x23, 0x46, 0x22, 0x06, 0x35, 0x22, 0x45, 0x23,
+	0x06, 0x26, 0x22, 0x43, 0x25, 0x06, 0x35, 0x22, 0x42, 0x26, 0x06, 0x25, 0x23, 0x41, 0x27, 0x06, 0x24, 0x54, 0x29, 0x06, 0x14, 0x45, 0x2A, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0xF7, 0x40,
+	0x06, 0xF6, 0x50, 0x06, 0xF5, 0x60, 0x06, 0x25, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0xF3, 0xD0, 0x01, 0x33, 0x0F, 0x28, 0x01, 0x13, 0x21, 0x0F, 0x16, 0x11, 0x01, 0x13, 0x32, 0x0F, 0x22, 0x12,
+	0x01, 0x13, 0x24, 0x1F, 0x14, 0x01, 0x13, 0x25, 0x1D, 0x15, 0x01, 0x13, 0x26, 0x1B, 0x16, 0x01, 0x13, 0x27, 0x19, 0x17, 0x01, 0x13, 0x29, 0x25, 0x18, 0x01, 0x13, 0x2A, 0x23, 0x19, 0x01, 0x13,
+	0x2B, 0x11, 0x1B, 0x01, 0x13, 0x3C, 0x1B, 0x01, 0x13, 0x2B, 0x11, 0x1B, 0x01, 0x13, 0x1A, 0x24, 0x19, 0x01, 0x13, 0x19, 0x26, 0x18, 0x01, 0x13, 0x27, 0x28, 0x17, 0x01, 0x13, 0x26, 0x1B, 0x16,
+	0x01, 0x13, 0x25, 0x1D, 0x15, 0x01, 0x13, 0x24, 0x1F, 0x14, 0x01, 0x13, 0x22, 0x0F, 0x23, 0x12, 0x01, 0x13, 0x21, 0x0F, 0x25, 0x11, 0x01, 0x33, 0x0F, 0x28, 0x01, 0xF3, 0xD0, 0x01, 0x0F, 0x0F,
+	0x02, 0x00, 0x00, 0x00, 0x0F, 0x48, 0x05, 0x2C, 0x67, 0x05, 0x2C, 0x36, 0x23, 0x04, 0x2C, 0x35, 0x24, 0x04, 0x2C, 0x34, 0x25, 0x04, 0x2C, 0x24, 0x25, 0x05, 0xEA, 0x21, 0x05, 0xF9, 0x40, 0x04,
+	0x59, 0x23, 0x54, 0x04, 0x2C, 0x22, 0x34, 0x07, 0x2C, 0x22, 0x33, 0x08, 0x2C, 0x22, 0x32, 0x24, 0x03, 0x2C, 0x52, 0x26, 0x03, 0x3B, 0x51, 0x27, 0x03, 0x2B, 0x32, 0x38, 0x03, 0x2B, 0x12, 0x21,
+	0x27, 0x04, 0x2B, 0x24, 0x36, 0x04, 0x1C, 0x25, 0x34, 0x05, 0x0F, 0x83, 0x06, 0x0F, 0x55, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x47, 0x06, 0x29, 0x89, 0x04, 0x29, 0x47, 0x24, 0x04, 0x29, 0x36,
+	0x26, 0x04, 0x29, 0x35, 0x27, 0x04, 0x29, 0x25, 0x28, 0x04, 0x29, 0x24, 0x28, 0x05, 0x29, 0x84, 0x31, 0x05, 0x15, 0xF1, 0x50, 0x05, 0xB5, 0x57, 0x04, 0x29, 0x23, 0x66, 0x04, 0x29, 0x22, 0x55,
+	0x12, 0x04, 0x29, 0x22, 0x44, 0x09, 0x29, 0x22, 0x52, 0x16, 0x03, 0x29, 0x82, 0x36, 0x02, 0x29, 0x52, 0x29, 0x03, 0x28, 0x42, 0x2B, 0x03, 0x28, 0x42, 0x3A, 0x03, 0x28, 0x24, 0x2A, 0x04, 0x28,
+	0x34, 0x28, 0x05, 0x3F, 0x45, 0x05, 0x0F, 0x91, 0x07, 0x0F, 0x63, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x09, 0xEC, 0x06, 0x0F, 0x67, 0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x2C, 0x03,
+	0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x49, 0x04, 0x0F, 0x57, 0x05, 0x0F, 0x28, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2D, 0x0F, 0x02, 0x4D, 0x0F, 0x5E, 0x0D, 0x0F, 0x71, 0x09, 0x0F, 0x83, 0x06, 0x0F,
+	0x37, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xC8, 0x0C, 0xF8, 0x10, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x39, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x2B, 0x04, 0x00, 0x0F, 0x3A, 0x04, 0x0F, 0x48, 0x05, 0x0F,
+	0x65, 0x06, 0x0F, 0x36, 0x08, 0x0F, 0x17, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x1A, 0x0F, 0x06, 0x39, 0x0F, 0x05, 0x59, 0x0F, 0x03, 0x6B, 0x0F, 0x7D, 0x0C, 0x9F, 0x08, 0x0F, 0x54, 0x08, 0x0F,
+	0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x31, 0x0D, 0x00, 0x0F, 0x21, 0x0E, 0x2A, 0x24, 0x1A, 0x03, 0x2A, 0x24, 0x39, 0x02, 0x2A, 0x23, 0x2A, 0x03, 0x00, 0x2B, 0x22, 0x2A, 0x03, 0x2B,
+	0x22, 0x39, 0x03, 0x2B, 0x22, 0x29, 0x04, 0x2B, 0x22, 0x28, 0x05, 0x2B, 0x32, 0x36, 0x05, 0x2B, 0x33, 0x43, 0x06, 0x0F, 0x82, 0x07, 0x0F, 0x53, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2E,
+	0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x00, 0x17, 0x25, 0x0F, 0x02, 0x26, 0x25, 0x1C, 0x04, 0x26, 0x25, 0x2C, 0x03, 0x26, 0x34, 0x2C, 0x03, 0x26, 0x24, 0x3C, 0x03, 0x26, 0x24, 0x2C, 0x04, 0x27, 0x23,
+	0x2C, 0x04, 0x27, 0x23, 0x3B, 0x04, 0x27, 0x23, 0x2B, 0x05, 0x27, 0x23, 0x3A, 0x05, 0x27, 0x33, 0x38, 0x06, 0x27, 0x24, 0x47, 0x06, 0x27, 0x34, 0x45, 0x07, 0x9E, 0x09, 0x0F, 0x51, 0x0B, 0x0F,
+	0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x0F, 0x21, 0x47, 0x03, 0x0F, 0x21, 0x36, 0x05, 0x1B, 0x24, 0x35, 0x06, 0x2A, 0x24, 0x34, 0x07, 0x2A, 0x24, 0x33, 0x08, 0x2A,
+	0x24, 0x32, 0x09, 0x2A, 0x14, 0x42, 0x09, 0x1B, 0x14, 0x42, 0x09, 0x2B, 0x13, 0x21, 0x42, 0x06, 0x2B, 0x33, 0x54, 0x04, 0x2B, 0x32, 0x38, 0x03, 0x2B, 0x22, 0x2A, 0x03, 0x0F, 0x11, 0x2A, 0x03,
+	0x0F, 0x2C, 0x03, 0x00, 0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x2D, 0x4A, 0x03, 0x2D, 0x49, 0x04, 0x2D, 0x48, 0x05, 0x15, 0x11, 0x25, 0x47, 0x06,
+	0x26, 0x25, 0x46, 0x07, 0x26, 0x25, 0x45, 0x08, 0x26, 0x25, 0x44, 0x09, 0x26, 0x15, 0x44, 0x0A, 0x26, 0x15, 0x53, 0x0A, 0x26, 0x15, 0x32, 0x31, 0x09, 0x27, 0x23, 0x31, 0x52, 0x07, 0x27, 0x53,
+	0x74, 0x04, 0x27, 0x43, 0x58, 0x03, 0x27, 0x33, 0x3B, 0x03, 0x27, 0x23, 0x2D, 0x03, 0x1D, 0x2D, 0x03, 0x0F, 0x2C, 0x03, 0x00, 0x00, 0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00,
+	0x2E, 0x47, 0x05, 0x2E, 0x66, 0x04, 0x2E, 0x35, 0x22, 0x04, 0x2E, 0x25, 0x24, 0x03, 0x2E, 0x24, 0x25, 0x03, 0xFA, 0x40, 0x03, 0xFA, 0x30, 0x04, 0x2E, 0x23, 0x0B, 0x2E, 0x13, 0x0C, 0x2D, 0x23,
+	0x0C, 0x2D, 0x23, 0x27, 0x03, 0x00, 0x0F, 0x23, 0x27, 0x03, 0x0F, 0x23, 0x36, 0x03, 0x1D, 0x24, 0x26, 0x04, 0x2C, 0x25, 0x25, 0x04, 0x2D, 0x34, 0x23, 0x05, 0x2D, 0x75, 0x05, 0x2E, 0x45, 0x07,
+	0x3E, 0x0F, 0x1F, 0x0F, 0x01, 0x0F, 0x0F, 0x02, 0x00, 0x2A, 0x3B, 0x06, 0x2A, 0x69, 0x05, 0x2A, 0x38, 0x32, 0x04, 0x2A, 0x37, 0x34, 0x03, 0x2A, 0x27, 0x26, 0x03, 0x2A, 0x36, 0x26, 0x03, 0xAA,
+	0x27, 0x03, 0xF5, 0x90, 0x03, 0x75, 0xB5, 0x04, 0x2A, 0x25, 0x0D, 0x29, 0x26, 0x0D, 0x29, 0x25, 0x19, 0x04, 0x29, 0x25, 0x29, 0x03, 0x00, 0x1A, 0x25, 0x29, 0x03, 0x0F, 0x21, 0x29, 0x03, 0x0F,
+	0x21, 0x28, 0x04, 0x19, 0x36, 0x27, 0x04, 0x28, 0x27, 0x36, 0x04, 0x29, 0x36, 0x34, 0x05, 0x39, 0x86, 0x06, 0x2A, 0x58, 0x07, 0x2B, 0x0F, 0x04, 0x3B, 0x0F, 0x03, 0x0F, 0x0F, 0x02, 0x2C, 0x1E,
+	0x03, 0x2C, 0x3C, 0x03, 0x2C, 0x5A, 0x03, 0x2C, 0x68, 0x04, 0x1C, 0x67, 0x06, 0x2B, 0x73, 0x09, 0xAB, 0x0B, 0xC6, 0x18, 0x05, 0x95, 0x2D, 0x03, 0x55, 0x21, 0x2E, 0x03, 0x2B, 0x2E, 0x03, 0x00,
+	0x00, 0x2B, 0x3D, 0x03, 0x3B, 0x68, 0x04, 0xFC, 0x05, 0xAD, 0x09, 0x0F, 0x0F, 0x02, 0x19, 0x0F, 0x07, 0x38, 0x0F, 0x06, 0x49, 0x0F, 0x04, 0x5A, 0x0F, 0x02, 0x6C, 0x0E, 0x6E, 0x0C, 0x0F, 0x31,
+	0x0D, 0x0F, 0x0F, 0x02, 0x2C, 0x1E, 0x03, 0x2C, 0x3C, 0x03, 0x2C, 0x4B, 0x03, 0x2C, 0x59, 0x04, 0x2C, 0x66, 0x06, 0x2C, 0x63, 0x09, 0x9C, 0x0B, 0xB7, 0x18, 0x05, 0x86, 0x2D, 0x03, 0x46, 0x21,
+	0x2E, 0x03, 0x2B, 0x2E, 0x03, 0x00, 0x00, 0x2B, 0x3D, 0x03, 0x3B, 0x68, 0x04, 0xFC, 0x05, 0xAD, 0x09, 0x0F, 0x0F, 0x02, 0x1A, 0x0F, 0x06, 0x25, 0x32, 0x0F, 0x05, 0x45, 0x41, 0x0F, 0x03, 0x37,
+	0x51, 0x0F, 0x01, 0x14, 0x13, 0x64, 0x0D, 0x34, 0x68, 0x0B, 0x45, 0x38, 0x0C, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2E, 0x0F, 0x01, 0x28, 0x24, 0x55, 0x06, 0x28, 0x24, 0x74,
+	0x05, 0x28, 0x24, 0x14, 0x34, 0x04, 0x28, 0x24, 0x2A, 0x04, 0x28, 0x24, 0x3A, 0x03, 0x28, 0x24, 0x2B, 0x03, 0x00, 0x00, 0x15, 0x22, 0x24, 0x2B, 0x03, 0x55, 0x24, 0x2B, 0x03, 0x84, 0x22, 0x24,
+	0x25, 0x03, 0x88, 0x24, 0x25, 0x03, 0x28, 0x52, 0x23, 0x25, 0x03, 0x37, 0x54, 0x21, 0x25, 0x03, 0x27, 0x34, 0x51, 0x25, 0x03, 0x27, 0x24, 0x43, 0x34, 0x03, 0x27, 0x24, 0x25, 0x0A, 0x18, 0x24,
+	0x0F, 0x02, 0x3C, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x00, 0x2E, 0x0F, 0x01, 0x28, 0x24, 0x55, 0x06, 0x28, 0x24, 0x74, 0x05, 0x28, 0x24, 0x24, 0x33, 0x04, 0x28, 0x24, 0x2A, 0x04, 0x28, 0x24, 0x3A,
+	0x03, 0x28, 0x24, 0x2B, 0x03, 0x00, 0x00, 0x15, 0x22, 0x24, 0x2B, 0x03, 0x64, 0x24, 0x2B, 0x03, 0x94, 0x21, 0x24, 0x25, 0x03, 0x88, 0x24, 0x25, 0x03, 0x28, 0x52, 0x23, 0x25, 0x03, 0x37, 0x54,
+	0x21, 0x25, 0x03, 0x27, 0x34, 0x61, 0x24, 0x03, 0x27, 0x24, 0x44, 0x23, 0x04, 0x15, 0x21, 0x24, 0x25, 0x0A, 0x34, 0x26, 0x0F, 0x02, 0x36, 0x33, 0x0F, 0x02, 0x13, 0x13, 0x0F, 0x09, 0x33, 0x0F,
+	0x0B, 0x44, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x4F, 0x0D, 0x6E, 0x0C, 0x3D, 0x32, 0x0B, 0x3C, 0x34, 0x0A, 0x2C, 0x36, 0x09, 0x3B, 0x37,
+	0x08, 0x3A, 0x48, 0x07, 0x39, 0x3A, 0x07, 0x38, 0x3C, 0x06, 0x37, 0x3E, 0x05, 0x36, 0x0F, 0x31, 0x04, 0x45, 0x0F, 0x32, 0x03, 0x26, 0x0F, 0x43, 0x02, 0x16, 0x0F, 0x25, 0x03, 0x0F, 0x0F, 0x02,
+	0x00, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x4F, 0x0D, 0x6E, 0x0C, 0x3D, 0x32, 0x0B, 0x3C, 0x34, 0x0A, 0x2C, 0x36, 0x09, 0x3B, 0x37, 0x08, 0x3A, 0x48, 0x07, 0x39, 0x3A, 0x07, 0x38, 0x3C, 0x06, 0x37,
+	0x3E, 0x05, 0x36, 0x0F, 0x31, 0x04, 0x45, 0x23, 0x3C, 0x03, 0x26, 0x44, 0x4A, 0x02, 0x16, 0x37, 0x2A, 0x03, 0x1B, 0x13, 0x0F, 0x01, 0x4A, 0x0F, 0x03, 0x3C, 0x0F, 0x02, 0x1E, 0x0F, 0x02, 0x0F,
+	0x0F, 0x02, 0x00, 0x00, 0xCC, 0x08, 0xF6, 0x70, 0x04, 0x66, 0x5B, 0x04, 0x16, 0x5D, 0x07, 0x0F, 0x34, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x00, 0x2C, 0x1E, 0x03, 0x2C, 0x2D,
+	0x03, 0x2C, 0x3D, 0x02, 0x2C, 0x3C, 0x03, 0x2C, 0x4A, 0x04, 0x2C, 0x58, 0x05, 0xF6, 0x40, 0x07, 0xF6, 0x10, 0x0A, 0x2C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x3B, 0x0F, 0x03, 0x0F, 0x0F, 0x02, 0x00,
+	0xCC, 0x08, 0xF6, 0x70, 0x04, 0x66, 0x5B, 0x04, 0x16, 0x5D, 0x07, 0x0F, 0x34, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x00, 0x2C, 0x1E, 0x03, 0x2C, 0x2D, 0x03, 0x2C, 0x4C, 0x02,
+	0x2C, 0x4B, 0x03, 0x2C, 0x4A, 0x04, 0x2C, 0x58, 0x05, 0xF6, 0x40, 0x07, 0xF6, 0x10, 0x0A, 0x2C, 0x0F, 0x03, 0x25, 0x25, 0x0F, 0x03, 0x45, 0x23, 0x0F, 0x03, 0x27, 0x23, 0x0F, 0x03, 0x24, 0x35,
+	0x0F, 0x03, 0x45, 0x0F, 0x08, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x74, 0x06, 0x0F, 0x84, 0x05, 0x28, 0x19, 0x35, 0x04, 0x28, 0x0F, 0x21, 0x04, 0x00, 0x28, 0x0F, 0x22,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0F, 0x31, 0x03, 0x0F, 0x2B, 0x04, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x74, 0x06, 0x0F, 0x84, 0x05, 0x28,
+	0x19, 0x35, 0x04, 0x28, 0x0F, 0x21, 0x04, 0x00, 0x28, 0x0F, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x22, 0x0F, 0x31, 0x03, 0x34, 0x0F, 0x24, 0x04, 0x36,
+	0x0F, 0x22, 0x04, 0x13, 0x23, 0x0F, 0x08, 0x33, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2A, 0x0F, 0x05, 0x2A, 0x58, 0x07, 0x2A, 0x96, 0x05, 0x2A,
+	0x17, 0x35, 0x04, 0x2A, 0x2E, 0x04, 0x00, 0x2A, 0x2F, 0x03, 0x00, 0x00, 0x00, 0x25, 0x23, 0x2F, 0x03, 0x75, 0x26, 0x27, 0x03, 0x76, 0x25, 0x27, 0x03, 0x69, 0x23, 0x27, 0x03, 0x89, 0x21, 0x27,
+	0x03, 0x39, 0x62, 0x27, 0x03, 0x29, 0x55, 0x35, 0x03, 0x29, 0x46, 0x0B, 0x29, 0x18, 0x0C, 0x38, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2A, 0x0F, 0x05, 0x2A, 0x58, 0x07, 0x2A, 0x96, 0x05,
+	0x2A, 0x36, 0x34, 0x04, 0x2A, 0x2E, 0x04, 0x00, 0x2A, 0x2F, 0x03, 0x00, 0x00, 0x00, 0x25, 0x23, 0x2F, 0x03, 0x75, 0x26, 0x27, 0x03, 0x76, 0x25, 0x27, 0x03, 0x69, 0x23, 0x27, 0x03, 0x89, 0x21,
+	0x27, 0x03, 0x39, 0x62, 0x27, 0x03, 0x14, 0x24, 0x55, 0x35, 0x03, 0x24, 0x23, 0x46, 0x0B, 0x35, 0x21, 0x18, 0x0C, 0x56, 0x0F, 0x06, 0x23, 0x0F, 0x0C, 0x33, 0x0F, 0x0B, 0x25, 0x0F, 0x0A, 0x16,
+	0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x60, 0x06, 0xF5, 0x70, 0x05, 0x25, 0x0F, 0x33, 0x04, 0x0F, 0x3B, 0x03, 0x0F, 0x2C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0x3B, 0x03, 0x0F, 0x2B, 0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x2A, 0x05, 0x0F, 0x39, 0x05, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x36, 0x08, 0x0F, 0x17, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xF5, 0x60, 0x06, 0xF5, 0x70, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x3B, 0x03, 0x0F, 0x2C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0F, 0x23, 0x03, 0x38, 0x3F, 0x03, 0x49, 0x2D, 0x04, 0x2B,
+	0x3C, 0x04, 0x17, 0x0F, 0x22, 0x05, 0x46, 0x3E, 0x05, 0x48, 0x3B, 0x06, 0x29, 0x3B, 0x07, 0x0F, 0x36, 0x08, 0x0F, 0x17, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x29, 0x45, 0x17, 0x04, 0x29, 0x83, 0x25, 0x03, 0x29, 0x23, 0x24, 0x34, 0x03, 0x29, 0x22, 0x35, 0x33, 0x03, 0x29, 0x22, 0x26, 0x32, 0x04, 0x29, 0x22, 0x26, 0x31, 0x05, 0x29, 0x22, 0x66,
+	0x05, 0xB5, 0x64, 0x06, 0xF5, 0x40, 0x08, 0x29, 0x65, 0x0A, 0x29, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x39, 0x0F, 0x05, 0x00, 0x29, 0x0F, 0x06, 0x00, 0x00,
+	0x00, 0x29, 0x46, 0x17, 0x03, 0x29, 0x84, 0x25, 0x02, 0x29, 0x24, 0x24, 0x34, 0x02, 0x29, 0x23, 0x35, 0x33, 0x02, 0x29, 0x23, 0x26, 0x32, 0x03, 0x29, 0x23, 0x26, 0x22, 0x04, 0x29, 0x23, 0x66,
+	0x04, 0xC5, 0x64, 0x05, 0xF5, 0x60, 0x06, 0x29, 0x66, 0x09, 0x29, 0x0F, 0x06, 0x00, 0x25, 0x22, 0x0F, 0x06, 0x65, 0x0F, 0x06, 0x47, 0x0F, 0x06, 0x24, 0x23, 0x0F, 0x06, 0x34, 0x22, 0x0F, 0x06,
+	0x35, 0x21, 0x0F, 0x06, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x2E, 0x0F, 0x01, 0x00, 0x3D, 0x0F, 0x01, 0x2D, 0x0F, 0x02, 0x00, 0x00, 0xF7, 0x40, 0x06, 0xF7, 0x50, 0x05, 0x2D, 0x2A, 0x05, 0x2D,
+	0x2B, 0x04, 0x00, 0x00, 0x1D, 0x2C, 0x04, 0x2C, 0x26, 0x24, 0x04, 0x00, 0x00, 0x00, 0xF6, 0x10, 0x24, 0x04, 0xF6, 0x25, 0x04, 0x2C, 0x2C, 0x04, 0x2C, 0x3B, 0x04, 0x2C, 0x0F, 0x03, 0x00, 0x00,
+	0x00, 0x2E, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x06, 0xF7, 0x60, 0x04, 0x2D, 0x2B, 0x04, 0x2D, 0x3B, 0x03, 0x2D, 0x2C, 0x03, 0x00, 0x00, 0x2C, 0x26, 0x25, 0x03, 0x00, 0x00,
+	0x00, 0x2C, 0x35, 0x25, 0x03, 0xF6, 0x10, 0x25, 0x03, 0xF6, 0x26, 0x03, 0x2C, 0x2D, 0x03, 0x16, 0x25, 0x3C, 0x03, 0x36, 0x23, 0x0F, 0x03, 0x28, 0x22, 0x0F, 0x03, 0x15, 0x26, 0x0F, 0x03, 0x35,
+	0x24, 0x0F, 0x03, 0x27, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x22, 0x0D, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x36, 0x27, 0x0E, 0x00, 0x26, 0x37, 0x0E, 0x26, 0x46, 0x43, 0x07, 0x26, 0x55, 0x81,
+	0x05, 0x26, 0x34, 0x51, 0x34, 0x04, 0x26, 0x33, 0x32, 0x27, 0x04, 0x26, 0x32, 0x23, 0x28, 0x04, 0x26, 0x31, 0x33, 0x29, 0x03, 0x26, 0x21, 0x24, 0x2A, 0x03, 0x46, 0x25, 0x2A, 0x03, 0x00, 0x45,
+	0x26, 0x2A, 0x03, 0x26, 0x27, 0x2A, 0x03, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x0F, 0x22, 0x0D, 0x00, 0x0F, 0x31, 0x0D, 0x0F, 0x21, 0x0E, 0x36, 0x27, 0x0E, 0x00, 0x26, 0x37, 0x0E,
+	0x26, 0x46, 0x43, 0x07, 0x26, 0x55, 0x81, 0x05, 0x26, 0x34, 0x51, 0x34, 0x04, 0x26, 0x33, 0x32, 0x27, 0x04, 0x26, 0x32, 0x33, 0x27, 0x04, 0x26, 0x31, 0x33, 0x29, 0x03, 0x26, 0x21, 0x24, 0x2A,
+	0x03, 0x46, 0x25, 0x2A, 0x03, 0x00, 0x45, 0x26, 0x2A, 0x03, 0x26, 0x12, 0x24, 0x2A, 0x03, 0x49, 0x22, 0x0F, 0x3B, 0x21, 0x0F, 0x19, 0x13, 0x21, 0x0F, 0x38, 0x24, 0x0F, 0x3A, 0x0F, 0x04, 0x1B,
+	0x0F, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x2A, 0x0F, 0x05, 0x2A, 0x2E, 0x04, 0x2A, 0x4C, 0x04, 0x2A, 0x6A, 0x04, 0x2A, 0x77, 0x06, 0x2A, 0x74, 0x09, 0xAA, 0x0C, 0xC5, 0x0F, 0x85, 0x0F, 0x04, 0x45,
+	0x21, 0x0F, 0x05, 0x29, 0x0F, 0x06, 0x29, 0x5A, 0x06, 0x29, 0x6A, 0x05, 0x29, 0x23, 0x29, 0x05, 0x29, 0x23, 0x39, 0x04, 0x2E, 0x2A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x2A,
+	0x05, 0x0F, 0x0F, 0x02, 0x2B, 0x0F, 0x04, 0x2B, 0x2E, 0x03, 0x2B, 0x4C, 0x03, 0x2B, 0x6A, 0x03, 0x2B, 0x77, 0x05, 0x2B, 0x83, 0x08, 0xAB, 0x0B, 0xB6, 0x0F, 0x86, 0x0F, 0x03, 0x46, 0x21, 0x0F,
+	0x04, 0x2A, 0x0F, 0x05, 0x2A, 0x69, 0x05, 0x2A, 0x79, 0x04, 0x2A, 0x22, 0x2A, 0x04, 0x2A, 0x22, 0x3A, 0x03, 0x2E, 0x2B, 0x03, 0x00, 0x00, 0x00, 0x27, 0x25, 0x2B, 0x03, 0x47, 0x23, 0x2B, 0x03,
+	0x39, 0x22, 0x2B, 0x03, 0x16, 0x13, 0x23, 0x2B, 0x03, 0x36, 0x0F, 0x22, 0x04, 0x47, 0x0F, 0x06, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x0F, 0x06, 0x00, 0x29, 0x1A, 0x0A, 0x29, 0x38,
+	0x0A, 0x29, 0x84, 0x09, 0xC9, 0x0B, 0xC5, 0x21, 0x27, 0x03, 0x75, 0x26, 0x27, 0x03, 0x25, 0x22, 0x26, 0x28, 0x03, 0x29, 0x26, 0x28, 0x03, 0x29, 0x25, 0x29, 0x03, 0x00, 0x00, 0x00, 0x28, 0x26,
+	0x38, 0x03, 0x28, 0x26, 0x28, 0x04, 0x28, 0x36, 0x27, 0x04, 0x28, 0x27, 0x36, 0x04, 0x28, 0x37, 0x34, 0x05, 0x0F, 0x83, 0x06, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x2A, 0x0F, 0x05, 0x00,
+	0x2A, 0x19, 0x0A, 0x2A, 0x37, 0x0A, 0x2A, 0x74, 0x09, 0xBA, 0x0B, 0xB6, 0x21, 0x27, 0x03, 0x76, 0x25, 0x27, 0x03, 0x26, 0x22, 0x25, 0x28, 0x03, 0x2A, 0x25, 0x28, 0x03, 0x2A, 0x24, 0x29, 0x03,
+	0x00, 0x00, 0x00, 0x29, 0x25, 0x38, 0x03, 0x29, 0x25, 0x28, 0x04, 0x29, 0x35, 0x27, 0x04, 0x29, 0x26, 0x36, 0x04, 0x15, 0x23, 0x36, 0x34, 0x05, 0x25, 0x8B, 0x06, 0x46, 0x59, 0x08, 0x14, 0x13,
+	0x0F, 0x08, 0x24, 0x0F, 0x0B, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x11, 0x0F, 0x0F, 0x31, 0x0D, 0x3F, 0x0E, 0x00, 0x2F, 0x0F, 0x00, 0x3E, 0x1A, 0x04,
+	0x2E, 0x2B, 0x03, 0x00, 0x00, 0x2D, 0x2C, 0x03, 0x2D, 0x2B, 0x04, 0x00, 0x00, 0x2D, 0x2A, 0x05, 0x3D, 0x38, 0x05, 0x2E, 0x37, 0x06, 0x4E, 0x44, 0x06, 0xAF, 0x07, 0x0F, 0x62, 0x09, 0x0F, 0x0F,
+	0x02, 0x1C, 0x0F, 0x04, 0x3C, 0x0F, 0x02, 0x00, 0x2C, 0x0F, 0x03, 0x3B, 0x0F, 0x03, 0x00, 0x2B, 0x0F, 0x04, 0x3A, 0x0F, 0x04, 0x2A, 0x2D, 0x05, 0x00, 0x00, 0x00, 0x29, 0x2D, 0x06, 0x00, 0x00,
+	0x00, 0x29, 0x3C, 0x06, 0x29, 0x2C, 0x07, 0x29, 0x3B, 0x07, 0x2A, 0x2A, 0x08, 0x3A, 0x38, 0x08, 0x3B, 0x45, 0x09, 0xAC, 0x0A, 0x5E, 0x0D, 0x0F, 0x0F, 0x02, 0x1D, 0x0F, 0x03, 0x3D, 0x0F, 0x01,
+	0x00, 0x2D, 0x0F, 0x02, 0x3C, 0x0F, 0x02, 0x00, 0x2C, 0x0F, 0x03, 0x00, 0x2B, 0x2D, 0x04, 0x00, 0x00, 0x00, 0x2A, 0x2D, 0x05, 0x00, 0x00, 0x00, 0x2A, 0x3C, 0x05, 0x2A, 0x2C, 0x06, 0x2A, 0x3B,
+	0x06, 0x16, 0x24, 0x2A, 0x07, 0x36, 0x32, 0x38, 0x07, 0x37, 0x32, 0x45, 0x08, 0x15, 0x13, 0xA3, 0x09, 0x44, 0x57, 0x0C, 0x36, 0x0F, 0x08, 0x18, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x0F,
+	0x06, 0x00, 0x38, 0x0F, 0x06, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x28, 0x76, 0x09, 0x28, 0xB3, 0x08, 0x28, 0x42, 0x46, 0x06, 0x28, 0x31, 0x49, 0x05, 0x18, 0x31, 0x3B, 0x05, 0x38, 0x3E,
+	0x04, 0x47, 0x2F, 0x04, 0x37, 0x0F, 0x21, 0x04, 0x37, 0x0F, 0x22, 0x03, 0x27, 0x0F, 0x23, 0x03, 0x00, 0x27, 0x0F, 0x13, 0x04, 0x27, 0x0F, 0x08, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x0F, 0x06,
+	0x00, 0x38, 0x0F, 0x06, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x28, 0x76, 0x09, 0x28, 0xB3, 0x08, 0x28, 0x42, 0x46, 0x06, 0x28, 0x31, 0x49, 0x05, 0x18, 0x31, 0x3B, 0x05, 0x38, 0x3E, 0x04,
+	0x47, 0x2F, 0x04, 0x37, 0x0F, 0x21, 0x04, 0x37, 0x0F, 0x22, 0x03, 0x27, 0x24, 0x2C, 0x03, 0x27, 0x44, 0x2A, 0x03, 0x27, 0x36, 0x19, 0x04, 0x27, 0x13, 0x13, 0x0F, 0x27, 0x42, 0x0F, 0x02, 0x3D,
+	0x0F, 0x01, 0x1F, 0x0F, 0x01, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x46, 0x07, 0x27, 0x8A, 0x05, 0x66, 0x36, 0x34, 0x04, 0x68, 0x33, 0x26, 0x04, 0x9A, 0x27, 0x04, 0x6C, 0x29, 0x03,
+	0x3E, 0x2A, 0x03, 0x00, 0x3D, 0x2B, 0x03, 0x2D, 0x2C, 0x03, 0x3C, 0x2C, 0x03, 0x2C, 0x2D, 0x03, 0x3B, 0x2D, 0x03, 0x2B, 0x2E, 0x03, 0x3A, 0x2E, 0x03, 0x39, 0x2F, 0x03, 0x2A, 0x3E, 0x03, 0x0F,
+	0x2B, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x46, 0x07, 0x36, 0x8A, 0x05, 0x66, 0x36, 0x34, 0x04, 0x68, 0x33, 0x26, 0x04, 0x9A, 0x27, 0x04, 0x6C, 0x29, 0x03, 0x3E, 0x2A, 0x03, 0x00,
+	0x3D, 0x2B, 0x03, 0x2D, 0x2C, 0x03, 0x3C, 0x2C, 0x03, 0x2C, 0x2D, 0x03, 0x3B, 0x2D, 0x03, 0x2B, 0x2E, 0x03, 0x3A, 0x2E, 0x03, 0x16, 0x32, 0x2F, 0x03, 0x26, 0x13, 0x3E, 0x03, 0x46, 0x0F, 0x21,
+	0x04, 0x28, 0x0F, 0x07, 0x15, 0x0F, 0x0B, 0x44, 0x0F, 0x09, 0x36, 0x0F, 0x08, 0x18, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x19, 0x1C, 0x09, 0x2A, 0x29, 0x09, 0x2A, 0x48, 0x08, 0x2A, 0x56, 0x09, 0x2A,
+	0x54, 0x0B, 0x2A, 0x52, 0x0D, 0x7A, 0x0F, 0x78, 0x48, 0x05, 0x75, 0x6A, 0x04, 0x75, 0x2A, 0x22, 0x04, 0x15, 0x23, 0x2A, 0x24, 0x03, 0x29, 0x2A, 0x24, 0x03, 0x00, 0x00, 0x18, 0x2C, 0x24, 0x03,
+	0x0F, 0x26, 0x33, 0x03, 0xEE, 0x04, 0x1A, 0xD3, 0x05, 0x29, 0x2B, 0x08, 0x2A, 0x2B, 0x07, 0x3A, 0x2A, 0x07, 0x2B, 0x2B, 0x06, 0x3B, 0x3A, 0x05, 0x3C, 0x1A, 0x06, 0x2C, 0x0F, 0x03, 0x0F, 0x0F,
+	0x02, 0x00, 0x00, 0xED, 0x05, 0xF6, 0x80, 0x03, 0x86, 0x69, 0x03, 0x26, 0x1B, 0x41, 0x07, 0x0F, 0x25, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x65, 0x06, 0x29, 0x6A, 0x05, 0x29, 0x2E, 0x05,
+	0x29, 0x3E, 0x04, 0x29, 0x2F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3E, 0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x0F, 0x02, 0x0F, 0x65, 0x06, 0x0F, 0x93, 0x05, 0x38, 0x55, 0x34, 0x04,
+	0xA8, 0x28, 0x04, 0x7A, 0x29, 0x04, 0x6D, 0x36, 0x04, 0x2C, 0x61, 0x24, 0x05, 0x3B, 0x44, 0x22, 0x06, 0x2B, 0x76, 0x06, 0x2A, 0x49, 0x07, 0x2A, 0x56, 0x09, 0x2A, 0x64, 0x0A, 0x29, 0x71, 0x34,
+	0x06, 0xB5, 0x56, 0x05, 0x65, 0x2B, 0x31, 0x04, 0x29, 0x2A, 0x23, 0x04, 0x00, 0x00, 0x2A, 0x29, 0x23, 0x04, 0x3A, 0x28, 0x22, 0x05, 0x3B, 0x58, 0x05, 0x3C, 0x47, 0x06, 0xCD, 0x07, 0xBF, 0x06,
+	0x0F, 0x39, 0x05, 0x0F, 0x2A, 0x05, 0x0F, 0x18, 0x08, 0x0F, 0x37, 0x07, 0x3A, 0x48, 0x07, 0x2A, 0x47, 0x09, 0x2A, 0x46, 0x0A, 0x2A, 0x45, 0x0B, 0x2A, 0x43, 0x0D, 0xFA, 0x40, 0x03, 0xF5, 0x90,
+	0x03, 0x75, 0x31, 0x0F, 0x01, 0x15, 0x14, 0x22, 0x0F, 0x02, 0x2C, 0x0F, 0x03, 0x3B, 0x0F, 0x03, 0x2B, 0x49, 0x06, 0x2A, 0x69, 0x05, 0x2A, 0x29, 0x32, 0x04, 0x29, 0x29, 0x24, 0x04, 0x00, 0x00,
+	0x00, 0x2A, 0x38, 0x31, 0x05, 0x4A, 0x67, 0x05, 0xEB, 0x07, 0xBE, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x39, 0x05, 0x0F, 0x19, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x61, 0x0A, 0xBD, 0x08, 0x4C, 0x36,
+	0x07, 0x3B, 0x39, 0x06, 0x2A, 0x2C, 0x06, 0x39, 0x2C, 0x06, 0x29, 0x3C, 0x06, 0x28, 0x3C, 0x07, 0x28, 0x59, 0x08, 0x37, 0x76, 0x09, 0x27, 0xA2, 0x0B, 0xB7, 0x18, 0x05, 0x67, 0x2D, 0x04, 0x27,
+	0x0F, 0x22, 0x04, 0x27, 0x0F, 0x31, 0x04, 0x37, 0x2F, 0x05, 0x28, 0x2F, 0x05, 0x38, 0x3D, 0x05, 0x29, 0x3C, 0x06, 0x3A, 0x39, 0x07, 0x4B, 0x55, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x0F, 0x0F, 0x02,
+	0x00, 0xDD, 0x06, 0xF6, 0x80, 0x03, 0x86, 0x69, 0x03, 0x26, 0x6C, 0x06, 0x0F, 0x44, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x48, 0x05, 0x2B, 0x78, 0x04, 0x2B, 0x28, 0x23, 0x04, 0x2B, 0x37,
+	0x24, 0x03, 0x2B, 0x27, 0x25, 0x03, 0x00, 0x00, 0x00, 0xF6, 0x10, 0x34, 0x03, 0xF6, 0x70, 0x04, 0x2B, 0x86, 0x05, 0x2B, 0x38, 0x08, 0x2B, 0x39, 0x07, 0x2B, 0x2A, 0x07, 0x3A, 0x3A, 0x06, 0x0F,
+	0x39, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xDD, 0x06, 0xF6, 0x80, 0x03, 0x76, 0x5B, 0x03, 0x16, 0x4E, 0x07, 0x0F, 0x25, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x39, 0x05, 0x2B, 0x69,
+	0x04, 0x2B, 0x29, 0x22, 0x04, 0x2B, 0x28, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x28, 0x33, 0x03, 0xF6, 0x70, 0x04, 0xF6, 0x60, 0x05, 0x2B, 0x39, 0x07, 0x15, 0x25, 0x2A, 0x07, 0x35, 0x23,
+	0x3A, 0x06, 0x36, 0x22, 0x3B, 0x05, 0x14, 0x35, 0x2C, 0x05, 0x34, 0x0F, 0x13, 0x06, 0x26, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0xDD, 0x06, 0xF6, 0x80, 0x03, 0x76, 0x5B, 0x03, 0x26, 0x4D, 0x07,
+	0x0F, 0x25, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x39, 0x05, 0x2B, 0x69, 0x04, 0x2B, 0x29, 0x22, 0x04, 0x2B, 0x28, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x28, 0x33, 0x03, 0xF6, 0x70, 0x04,
+	0xF6, 0x60, 0x05, 0x2B, 0x39, 0x07, 0x26, 0x23, 0x2A, 0x07, 0x24, 0x12, 0x22, 0x2B, 0x06, 0x14, 0x14, 0x21, 0x3B, 0x05, 0x14, 0x14, 0x11, 0x2D, 0x05, 0x24, 0x12, 0x0F, 0x11, 0x06, 0x26, 0x0F,
+	0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x28, 0x0F, 0x07, 0x28, 0x78, 0x07, 0x28, 0xB5, 0x06, 0x28, 0x53, 0x46, 0x04, 0x18, 0x42, 0x2B, 0x04, 0x18, 0x31, 0x3D, 0x03, 0x57, 0x2F, 0x03, 0x37, 0x0F,
+	0x22, 0x03, 0x27, 0x0F, 0x23, 0x03, 0x00, 0x18, 0x0F, 0x23, 0x03, 0x0F, 0x3B, 0x03, 0x0F, 0x2B, 0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x48, 0x05, 0x37, 0x6A, 0x06, 0xF7, 0x20, 0x08, 0x16, 0xD1, 0x0B,
+	0x5B, 0x0F, 0x01, 0x5D, 0x0E, 0x4F, 0x0D, 0x0F, 0x51, 0x0B, 0x0F, 0x23, 0x0C, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x0F, 0x06, 0x29, 0x78, 0x06, 0x29, 0xB5, 0x05, 0x29, 0x53, 0x36, 0x04, 0x19, 0x42,
+	0x3A, 0x03, 0x19, 0x31, 0x3D, 0x02, 0x58, 0x2F, 0x02, 0x48, 0x0F, 0x21, 0x02, 0x38, 0x0F, 0x22, 0x02, 0x28, 0x0F, 0x23, 0x02, 0x00, 0x0F, 0x2D, 0x02, 0x0F, 0x2C, 0x03, 0x0F, 0x3B, 0x03, 0x0F,
+	0x3A, 0x04, 0x0F, 0x49, 0x04, 0x38, 0x6A, 0x05, 0xF8, 0x20, 0x07, 0x17, 0xD1, 0x0A, 0x16, 0x55, 0x0F, 0x36, 0x55, 0x0D, 0x37, 0x46, 0x0C, 0x15, 0x13, 0x57, 0x0A, 0x35, 0x2B, 0x0B, 0x36, 0x0F,
+	0x08, 0x18, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x0F, 0x06, 0x29, 0x78, 0x06, 0x29, 0xB5, 0x05, 0x29, 0x53, 0x36, 0x04, 0x19, 0x42, 0x3A, 0x03, 0x28, 0x31, 0x3D, 0x02, 0x58, 0x2F, 0x02,
+	0x48, 0x0F, 0x21, 0x02, 0x38, 0x0F, 0x22, 0x02, 0x37, 0x0F, 0x23, 0x02, 0x28, 0x0F, 0x23, 0x02, 0x0F, 0x2D, 0x02, 0x0F, 0x2C, 0x03, 0x0F, 0x3B, 0x03, 0x0F, 0x3A, 0x04, 0x0F, 0x49, 0x04, 0x37,
+	0x6B, 0x05, 0xF7, 0x30, 0x07, 0xE8, 0x0A, 0x45, 0x53, 0x0F, 0x24, 0x22, 0x54, 0x0D, 0x14, 0x14, 0x46, 0x0C, 0x14, 0x14, 0x48, 0x0A, 0x24, 0x22, 0x19, 0x0C, 0x45, 0x0F, 0x08, 0x0F, 0x0F, 0x02,
+	0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x27, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x26, 0x13, 0x05, 0x0F, 0x2C, 0x03, 0x17, 0x18, 0x2A, 0x03, 0x26, 0x37,
+	0x29, 0x03, 0x27, 0x46, 0x28, 0x03, 0x27, 0x47, 0x27, 0x03, 0x28, 0x12, 0x35, 0x26, 0x03, 0x68, 0x45, 0x33, 0x03, 0x49, 0x87, 0x04, 0x39, 0x5A, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x13, 0x0D,
+	0x0F, 0x42, 0x0B, 0x0F, 0x43, 0x0A, 0x0F, 0x55, 0x07, 0x0F, 0x66, 0x05, 0x0F, 0x48, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x0F,
+	0x36, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x26, 0x13, 0x05, 0x0F, 0x2C, 0x03, 0x17, 0x18, 0x2A, 0x03, 0x26, 0x27, 0x2A, 0x03, 0x27, 0x46, 0x28, 0x03, 0x27, 0x47, 0x27, 0x03, 0x28, 0x12, 0x35, 0x26,
+	0x03, 0x68, 0x45, 0x33, 0x03, 0x49, 0x87, 0x04, 0x39, 0x5A, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x19, 0x18, 0x0D, 0x39, 0x45, 0x0B, 0x4A, 0x44, 0x0A, 0x18, 0x13, 0x57, 0x07, 0x28, 0x6B, 0x05, 0x48,
+	0x4B, 0x05, 0x2A, 0x1D, 0x06, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x27, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x26, 0x13, 0x05, 0x0F, 0x2C, 0x03, 0x26,
+	0x18, 0x2A, 0x03, 0x26, 0x37, 0x29, 0x03, 0x36, 0x46, 0x28, 0x03, 0x27, 0x38, 0x27, 0x03, 0x37, 0x12, 0x35, 0x26, 0x03, 0x68, 0x45, 0x33, 0x03, 0x58, 0x87, 0x04, 0x39, 0x5A, 0x05, 0x0F, 0x0F,
+	0x02, 0x00, 0x0F, 0x13, 0x0D, 0x49, 0x34, 0x0C, 0x27, 0x23, 0x44, 0x0A, 0x17, 0x15, 0x55, 0x08, 0x17, 0x15, 0x57, 0x06, 0x17, 0x15, 0x58, 0x05, 0x18, 0x23, 0x3A, 0x05, 0x49, 0x1D, 0x05, 0x0F,
+	0x0F, 0x02, 0x0F, 0x14, 0x0C, 0x0F, 0x33, 0x0B, 0x0F, 0x52, 0x0A, 0x0F, 0x41, 0x0C, 0x4F, 0x0D, 0x4E, 0x0E, 0x3D, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x3A, 0x0F, 0x04, 0x2A, 0x0F,
+	0x05, 0x3A, 0x0F, 0x04, 0x3B, 0x0F, 0x03, 0x3C, 0x0F, 0x02, 0x4C, 0x0F, 0x01, 0x3E, 0x0F, 0x3F, 0x0E, 0x0F, 0x41, 0x0C, 0x0F, 0x42, 0x0B, 0x0F, 0x43, 0x0A, 0x0F, 0x44, 0x09, 0x0F, 0x45, 0x08,
+	0x0F, 0x46, 0x07, 0x0F, 0x47, 0x06, 0x0F, 0x48, 0x05, 0x0F, 0x19, 0x07, 0x0F, 0x14, 0x0C, 0x0F, 0x33, 0x0B, 0x0F, 0x52, 0x0A, 0x0F, 0x41, 0x0C, 0x4F, 0x0D, 0x4E, 0x0E, 0x3D, 0x0F, 0x01, 0x3C,
+	0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x3A, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x3A, 0x0F, 0x04, 0x3B, 0x0F, 0x03, 0x3C, 0x0F, 0x02, 0x3D, 0x0F, 0x01, 0x3E, 0x0F, 0x3F, 0x0E, 0x19, 0x46, 0x0C, 0x38, 0x46,
+	0x0B, 0x49, 0x45, 0x0A, 0x2B, 0x46, 0x09, 0x17, 0x4C, 0x08, 0x37, 0x4B, 0x07, 0x48, 0x4A, 0x06, 0x1A, 0x4C, 0x05, 0x0F, 0x19, 0x07, 0x0F, 0x14, 0x0C, 0x0F, 0x24, 0x0B, 0x0F, 0x43, 0x0A, 0x0F,
+	0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x4D, 0x0F, 0x4C, 0x0F, 0x01, 0x3B, 0x0F, 0x03, 0x3A, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x3A, 0x0F, 0x04, 0x3B, 0x0F, 0x03, 0x4C, 0x0F, 0x01, 0x4D,
+	0x0F, 0x4E, 0x0E, 0x0F, 0x31, 0x0D, 0x39, 0x35, 0x0C, 0x18, 0x13, 0x35, 0x0B, 0x17, 0x15, 0x45, 0x09, 0x17, 0x15, 0x46, 0x08, 0x17, 0x15, 0x47, 0x07, 0x18, 0x13, 0x49, 0x06, 0x39, 0x4B, 0x05,
+	0x0F, 0x29, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xED, 0x05, 0xF5, 0x90, 0x03, 0x86, 0x5A, 0x03, 0x26, 0x5D, 0x06, 0x0F, 0x44, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x48, 0x05, 0x27, 0x25, 0x66,
+	0x04, 0x27, 0x25, 0x26, 0x22, 0x04, 0x27, 0x25, 0x25, 0x24, 0x03, 0x00, 0x00, 0x00, 0x27, 0x25, 0x25, 0x33, 0x03, 0xF7, 0x60, 0x04, 0xF7, 0x50, 0x05, 0x27, 0x25, 0x26, 0x08, 0x27, 0x25, 0x36,
+	0x07, 0x17, 0x26, 0x37, 0x06, 0x00, 0x26, 0x26, 0x38, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0xED, 0x05, 0xF6, 0x80, 0x03, 0x67, 0x6A, 0x03, 0x17, 0x6B, 0x07, 0x0F, 0x25, 0x0A, 0x0F,
+	0x0F, 0x02, 0x00, 0x0F, 0x48, 0x05, 0x28, 0x24, 0x66, 0x04, 0x28, 0x24, 0x26, 0x22, 0x04, 0x28, 0x24, 0x25, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x33, 0x03, 0xF8, 0x50, 0x04, 0x28, 0x24,
+	0x56, 0x05, 0x28, 0x24, 0x26, 0x08, 0x16, 0x21, 0x24, 0x27, 0x07, 0x55, 0x24, 0x37, 0x06, 0x37, 0x24, 0x28, 0x06, 0x15, 0x0F, 0x24, 0x05, 0x44, 0x0F, 0x12, 0x06, 0x27, 0x0F, 0x08, 0x0F, 0x0F,
+	0x02, 0x00, 0xED, 0x05, 0xF6, 0x80, 0x03, 0x76, 0x6A, 0x03, 0x16, 0x6C, 0x07, 0x0F, 0x25, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x48, 0x05, 0x28, 0x24, 0x66, 0x04, 0x28, 0x24, 0x26, 0x22, 0x04,
+	0x28, 0x24, 0x25, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x33, 0x03, 0xF8, 0x50, 0x04, 0x28, 0x24, 0x56, 0x05, 0x28, 0x24, 0x26, 0x08, 0x28, 0x24, 0x27, 0x07, 0x55, 0x24, 0x37, 0x06, 0x23,
+	0x22, 0x25, 0x38, 0x05, 0x13, 0x14, 0x25, 0x29, 0x05, 0x13, 0x14, 0x0F, 0x11, 0x06, 0x14, 0x12, 0x0F, 0x09, 0x44, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x38, 0x33, 0x46, 0x05, 0x29,
+	0x24, 0x65, 0x04, 0x29, 0x24, 0x25, 0x22, 0x04, 0x29, 0x24, 0x24, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x30, 0x23, 0x04, 0xF5, 0x80, 0x04, 0x29, 0x24, 0x55, 0x05, 0x29, 0x24, 0x25,
+	0x08, 0x29, 0x24, 0x16, 0x08, 0x29, 0x24, 0x26, 0x07, 0x00, 0x38, 0x33, 0x27, 0x06, 0x28, 0x24, 0x38, 0x05, 0x28, 0x24, 0x39, 0x04, 0x0F, 0x2A, 0x05, 0x0F, 0x0F, 0x02, 0x0F, 0x46, 0x07, 0x0F,
+	0x74, 0x06, 0x0F, 0x33, 0x33, 0x05, 0x0F, 0x32, 0x25, 0x05, 0x27, 0x28, 0x26, 0x05, 0x27, 0x27, 0x36, 0x05, 0x27, 0x27, 0x44, 0x06, 0x27, 0x27, 0x52, 0x07, 0x27, 0x77, 0x09, 0x27, 0x66, 0x0B,
+	0x27, 0x64, 0x0D, 0x27, 0x72, 0x0E, 0x77, 0x22, 0x1A, 0x03, 0x57, 0x24, 0x39, 0x02, 0x46, 0x26, 0x29, 0x03, 0x17, 0x38, 0x37, 0x03, 0x0F, 0x22, 0x36, 0x04, 0x0F, 0x22, 0x35, 0x05, 0x0F, 0x32,
+	0x42, 0x06, 0x0F, 0x73, 0x07, 0xAD, 0x09, 0x9D, 0x0A, 0x0F, 0x35, 0x09, 0x0F, 0x45, 0x08, 0x0F, 0x16, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x56, 0x0A, 0x29, 0x75, 0x09, 0x29, 0x34, 0x33, 0x08,
+	0x29, 0x23, 0x26, 0x08, 0x00, 0x29, 0x33, 0x64, 0x05, 0xF5, 0x80, 0x04, 0xF5, 0x10, 0x35, 0x03, 0x29, 0x0F, 0x21, 0x03, 0x00, 0x00, 0x28, 0x0F, 0x22, 0x03, 0x00, 0x00, 0x0F, 0x2C, 0x03, 0x00,
+	0x0F, 0x3B, 0x03, 0x28, 0x0F, 0x21, 0x04, 0x38, 0x3E, 0x04, 0x39, 0x78, 0x05, 0x3A, 0x67, 0x06, 0x3B, 0x0F, 0x03, 0x3C, 0x0F, 0x02, 0x1D, 0x0F, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x64, 0x07,
+	0x0F, 0x92, 0x06, 0x4F, 0x35, 0x05, 0x38, 0x43, 0x27, 0x05, 0x97, 0x29, 0x05, 0x6A, 0x29, 0x05, 0x7C, 0x25, 0x06, 0x3B, 0x52, 0x32, 0x06, 0x2B, 0x75, 0x07, 0x2B, 0x47, 0x08, 0x2A, 0x76, 0x07,
+	0x2A, 0x54, 0x22, 0x07, 0x2A, 0x61, 0x14, 0x13, 0x04, 0x7A, 0x2A, 0x03, 0x86, 0x2D, 0x03, 0x66, 0x3E, 0x03, 0x15, 0x34, 0x2D, 0x04, 0x2B, 0x3C, 0x04, 0x3B, 0x2B, 0x05, 0x3C, 0x48, 0x05, 0x4D,
+	0x45, 0x06, 0xAE, 0x08, 0x0F, 0x61, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x21, 0x0E, 0x29, 0x25, 0x0E, 0x29, 0x16, 0x0E, 0x1A, 0x26, 0x0D, 0x2A, 0x25, 0x0D, 0x00, 0x2A, 0xC2, 0x06, 0xF5, 0x70,
+	0x05, 0xB5, 0x22, 0x35, 0x04, 0x15, 0x24, 0x26, 0x26, 0x04, 0x2A, 0x26, 0x27, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x2C, 0x03, 0x0F, 0x3B, 0x03, 0x0F, 0x11, 0x29, 0x04, 0x3F, 0x37, 0x04, 0x4F,
+	0x35, 0x05, 0x0F, 0x92, 0x06, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x13, 0x0D, 0x0F, 0x33, 0x0B, 0x0F, 0x23, 0x0C, 0x2C, 0x33, 0x0C, 0x4B, 0x22, 0x0D, 0x6D, 0x0D, 0x5F, 0x0C, 0x7F,
+	0x0A, 0x2F, 0x62, 0x07, 0x1A, 0x24, 0x74, 0x04, 0x39, 0x22, 0x68, 0x02, 0x3A, 0x21, 0x3B, 0x02, 0x2B, 0x21, 0x34, 0x09, 0x2D, 0x26, 0x09, 0x00, 0x00, 0x00, 0x2D, 0x35, 0x09, 0x2E, 0x24, 0x0A,
+	0x8E, 0x0A, 0x0F, 0x41, 0x0C, 0x0F, 0x0F, 0x02, 0x3F, 0x0E, 0x00, 0x17, 0x27, 0x0F, 0x27, 0x35, 0x0F, 0x47, 0x23, 0x0F, 0x01, 0x88, 0x0F, 0x01, 0x6A, 0x0F, 0x01, 0x6C, 0x0E, 0x2C, 0x61, 0x0B,
+	0x3B, 0x73, 0x08, 0x15, 0x25, 0x77, 0x05, 0x34, 0x24, 0x89, 0x02, 0x35, 0x22, 0x5D, 0x02, 0x36, 0x21, 0x26, 0x18, 0x03, 0x27, 0x21, 0x36, 0x0B, 0x38, 0x28, 0x0B, 0x29, 0x28, 0x0B, 0x00, 0x00,
+	0x00, 0x39, 0x36, 0x0B, 0x3A, 0x34, 0x0C, 0x8B, 0x0D, 0x6C, 0x0E, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xFB, 0x10, 0x05, 0x3B, 0x45, 0x22, 0x05, 0x0F, 0x32, 0x0C, 0x0F, 0x31,
+	0x0D, 0x3F, 0x33, 0x15, 0x02, 0x2F, 0x35, 0x14, 0x02, 0x2E, 0x37, 0x32, 0x01, 0x2E, 0x68, 0x02, 0x2A, 0x21, 0x58, 0x04, 0xFA, 0x20, 0x05, 0xCC, 0x21, 0x05, 0x2D, 0x2A, 0x05, 0x00, 0x3D, 0x28,
+	0x06, 0x2E, 0x28, 0x06, 0x3F, 0x34, 0x07, 0x9F, 0x08, 0x0F, 0x62, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xCB, 0x09, 0xF7, 0x30, 0x07, 0x47, 0x55, 0x31, 0x07, 0x3F, 0x0E, 0x3D, 0x0F, 0x01, 0x3C,
+	0x15, 0x0B, 0x2C, 0x44, 0x16, 0x03, 0x2B, 0x46, 0x15, 0x03, 0x2A, 0x29, 0x34, 0x02, 0x2A, 0x2A, 0x41, 0x03, 0x2A, 0x6A, 0x04, 0x65, 0x5A, 0x06, 0xF5, 0x50, 0x07, 0xD8, 0x22, 0x07, 0x29, 0x2C,
+	0x07, 0x00, 0x39, 0x2A, 0x08, 0x2A, 0x2A, 0x08, 0x3A, 0x38, 0x08, 0x3B, 0x45, 0x09, 0xAC, 0x0A, 0x6E, 0x0C, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x49, 0x04, 0x0F, 0x68, 0x03, 0x0F,
+	0x28, 0x22, 0x03, 0x0F, 0x27, 0x24, 0x02, 0x00, 0x00, 0x00, 0xEA, 0x33, 0x02, 0xFA, 0x40, 0x03, 0x2E, 0x57, 0x04, 0x2E, 0x27, 0x07, 0x2E, 0x28, 0x06, 0x00, 0x2E, 0x29, 0x05, 0x2E, 0x39, 0x04,
+	0x2E, 0x3A, 0x03, 0x0F, 0x2B, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x48, 0x05, 0x0F, 0x76, 0x04, 0x0F, 0x26, 0x23, 0x04, 0x0F, 0x35, 0x33, 0x03, 0x0F, 0x25, 0x25, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0xF6, 0x10, 0x24, 0x04, 0xF6, 0x70, 0x04, 0x2B, 0x68, 0x05, 0x2B, 0x28, 0x09, 0x2B, 0x29, 0x08, 0x00, 0x2B, 0x39, 0x07, 0x2B, 0x2A, 0x07, 0x2B, 0x3A, 0x06, 0x2B, 0x3B, 0x05, 0x2B, 0x3C,
+	0x04, 0x0F, 0x1A, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x43, 0x0A, 0xCA, 0x0A, 0x00, 0x2A, 0x26, 0x16, 0x05, 0x25, 0x2A, 0x28, 0x03, 0x35, 0x29, 0x28, 0x03, 0x26, 0x28, 0x29, 0x03,
+	0x00, 0x26, 0x27, 0x2A, 0x03, 0x36, 0x26, 0x2A, 0x03, 0x27, 0x26, 0x2A, 0x03, 0x00, 0x27, 0x26, 0x29, 0x04, 0x00, 0x37, 0x35, 0x37, 0x04, 0x17, 0x28, 0x27, 0x05, 0x0F, 0x31, 0x44, 0x05, 0x0F,
+	0x92, 0x06, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xCA, 0x0A, 0xF5, 0x20, 0x0A, 0x45, 0x43, 0x0F, 0x01, 0x3B, 0x1E, 0x03, 0x2A, 0x3F, 0x02, 0x29, 0x0F, 0x21, 0x03, 0x28,
+	0x0F, 0x22, 0x03, 0x00, 0x27, 0x0F, 0x32, 0x03, 0x27, 0x0F, 0x22, 0x04, 0x27, 0x0F, 0x31, 0x04, 0x27, 0x0F, 0x21, 0x05, 0x28, 0x4D, 0x05, 0x38, 0x4B, 0x06, 0x49, 0x57, 0x07, 0xDA, 0x09, 0x8D,
+	0x0B, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x15, 0x0B, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x27, 0x29, 0x0C, 0x27, 0x38, 0x0C, 0x27, 0x37, 0x44, 0x05, 0x27, 0x36, 0x64, 0x04, 0x27, 0x45, 0x33,
+	0x22, 0x04, 0x27, 0x45, 0x23, 0x33, 0x03, 0x27, 0x24, 0x11, 0x24, 0x24, 0x03, 0x27, 0x23, 0x21, 0x24, 0x24, 0x03, 0x27, 0x32, 0x21, 0x34, 0x23, 0x03, 0x27, 0x31, 0x22, 0x35, 0x22, 0x03, 0x57,
+	0x23, 0x66, 0x03, 0x47, 0x24, 0x57, 0x03, 0x37, 0x35, 0x28, 0x04, 0x36, 0x27, 0x28, 0x04, 0x27, 0x37, 0x26, 0x05, 0x0F, 0x32, 0x43, 0x05, 0x0F, 0x83, 0x06, 0x0F, 0x54, 0x08, 0x0F, 0x18, 0x08,
+	0x0F, 0x47, 0x06, 0x2B, 0x48, 0x07, 0x2B, 0x47, 0x08, 0x2B, 0x55, 0x09, 0x2B, 0x44, 0x0B, 0x1B, 0x44, 0x0C, 0xFB, 0x30, 0x03, 0xF5, 0x90, 0x03, 0x75, 0x31, 0x0F, 0x01, 0x15, 0x14, 0x32, 0x0F,
+	0x01, 0x3C, 0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x29, 0x0F, 0x06, 0x00, 0x00, 0x39, 0x87, 0x05, 0xFA, 0x30, 0x04, 0x8B, 0x27, 0x04, 0x0F, 0x2B, 0x04, 0x00,
+	0x0F, 0x3A, 0x04, 0x0F, 0x2A, 0x05, 0x0F, 0x48, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x16, 0x0A, 0x0F, 0x35, 0x09, 0x0F, 0x34, 0x0A, 0x27, 0x39, 0x0B, 0x37, 0x37, 0x0C, 0x27, 0x38, 0x0C, 0x27,
+	0x37, 0x28, 0x03, 0x27, 0x36, 0x29, 0x03, 0x27, 0x45, 0x29, 0x03, 0x27, 0x44, 0x2A, 0x03, 0x27, 0x53, 0x2A, 0x03, 0x27, 0x23, 0x21, 0x2A, 0x03, 0x27, 0x22, 0x22, 0x2A, 0x03, 0x27, 0x21, 0x23,
+	0x39, 0x03, 0x47, 0x24, 0x29, 0x04, 0x00, 0x37, 0x35, 0x37, 0x04, 0x36, 0x27, 0x27, 0x05, 0x0F, 0x32, 0x43, 0x05, 0x0F, 0x83, 0x06, 0x0F, 0x54, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2E,
+	0x38, 0x05, 0x2E, 0x36, 0x07, 0x2E, 0x25, 0x09, 0x2E, 0x24, 0x0A, 0x2E, 0xB2, 0x03, 0xF9, 0x50, 0x03, 0xA9, 0x0D, 0x19, 0x14, 0x12, 0x0E, 0x0F, 0x21, 0x0E, 0x2F, 0x0F, 0x2F, 0x1A, 0x04, 0x2E,
+	0x3A, 0x03, 0x2E, 0x2A, 0x04, 0x00, 0x2E, 0x39, 0x04, 0x2E, 0x29, 0x05, 0x2F, 0x37, 0x05, 0x3F, 0x44, 0x06, 0x0F, 0x91, 0x07, 0x0F, 0x53, 0x09, 0x0F, 0x18, 0x08, 0x0F, 0x47, 0x06, 0x2B, 0x48,
+	0x07, 0x2B, 0x47, 0x08, 0x2B, 0x55, 0x09, 0x1B, 0x45, 0x0B, 0x2A, 0x44, 0x0C, 0xFA, 0x40, 0x03, 0xF5, 0x90, 0x03, 0x75, 0x32, 0x0F, 0x15, 0x14, 0x23, 0x0F, 0x01, 0x2D, 0x0F, 0x02, 0x3C, 0x0F,
+	0x02, 0x2C, 0x0F, 0x03, 0x00, 0x2B, 0x2D, 0x04, 0x00, 0x2B, 0x3C, 0x04, 0x2B, 0x2C, 0x05, 0x00, 0x2B, 0x3B, 0x05, 0x3B, 0x39, 0x06, 0x3C, 0x37, 0x07, 0x3D, 0x45, 0x07, 0x9E, 0x09, 0x0F, 0x51,
+	0x0B, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x57, 0x05, 0x0F, 0x94, 0x04, 0x0F, 0x43, 0x24, 0x04, 0x36, 0x38, 0x26, 0x04, 0x36, 0x27, 0x37, 0x04, 0x26, 0x27, 0x37, 0x05, 0x26, 0x26, 0x46, 0x06, 0x26,
+	0x26, 0x53, 0x08, 0x26, 0x25, 0x61, 0x0A, 0x26, 0x75, 0x34, 0x05, 0x26, 0x72, 0x56, 0x04, 0x86, 0x38, 0x31, 0x03, 0x65, 0x21, 0x28, 0x23, 0x03, 0x26, 0x24, 0x28, 0x23, 0x03, 0x2C, 0x28, 0x23,
+	0x03, 0x2C, 0x38, 0x22, 0x03, 0x2D, 0x38, 0x21, 0x03, 0x2D, 0x49, 0x04, 0x3D, 0x39, 0x04, 0x3E, 0x38, 0x04, 0x3F, 0x36, 0x05, 0x0F, 0xA1, 0x06, 0x0F, 0x63, 0x08, 0x0F, 0x0F, 0x02, 0x0F, 0x1D,
+	0x03, 0x0F, 0x2C, 0x03, 0x1F, 0x4A, 0x02, 0x3E, 0x38, 0x04, 0x2E, 0x38, 0x05, 0x16, 0x26, 0x38, 0x06, 0x26, 0x34, 0x37, 0x07, 0x26, 0x24, 0x32, 0x42, 0x07, 0x26, 0x33, 0x92, 0x07, 0x26, 0x32,
+	0x22, 0x41, 0x31, 0x06, 0x26, 0x32, 0x12, 0x23, 0x33, 0x05, 0x26, 0x31, 0x13, 0x23, 0x44, 0x03, 0x66, 0x13, 0x32, 0x26, 0x03, 0x66, 0x63, 0x44, 0x03, 0x36, 0x21, 0x54, 0x33, 0x05, 0x36, 0x21,
+	0x27, 0x23, 0x06, 0x26, 0x32, 0x25, 0x23, 0x07, 0x35, 0x23, 0x25, 0x23, 0x07, 0x17, 0x33, 0x33, 0x23, 0x07, 0x7C, 0x34, 0x06, 0x4D, 0x37, 0x05, 0x0F, 0x4A, 0x03, 0x0F, 0x4B, 0x02, 0x0F, 0x2C,
+	0x03, 0x0F, 0x0F, 0x02, 0x00, 0x29, 0x18, 0x0C, 0x29, 0x37, 0x0B, 0x29, 0x45, 0x0C, 0x29, 0x44, 0x0D, 0x29, 0x43, 0x0E, 0x29, 0x51, 0x46, 0x05, 0x59, 0x21, 0x74, 0x04, 0x66, 0x22, 0x34, 0x23,
+	0x04, 0x55, 0x24, 0x24, 0x34, 0x03, 0x25, 0x21, 0x24, 0x23, 0x26, 0x03, 0x28, 0x24, 0x32, 0x26, 0x03, 0x28, 0x34, 0x21, 0x27, 0x03, 0x28, 0x95, 0x23, 0x03, 0x28, 0x86, 0x23, 0x03, 0x28, 0x36,
+	0x28, 0x03, 0x37, 0x26, 0x29, 0x03, 0x27, 0x27, 0x29, 0x03, 0x27, 0x26, 0x2A, 0x03, 0x2F, 0x2A, 0x03, 0x3E, 0x39, 0x03, 0x2E, 0x1A, 0x05, 0x3D, 0x0F, 0x01, 0x0F, 0x0F, 0x02, 0x0F, 0x1C, 0x04,
+	0x0F, 0x4A, 0x03, 0x0F, 0x68, 0x03, 0x0F, 0x66, 0x05, 0x0F, 0x54, 0x08, 0x0F, 0x52, 0x0A, 0x6F, 0x0B, 0x6D, 0x0D, 0x5B, 0x21, 0x0D, 0x59, 0x22, 0x0E, 0x57, 0x24, 0x0E, 0x46, 0x26, 0x0E, 0x36,
+	0x37, 0x0D, 0x16, 0xAA, 0x05, 0x0F, 0xA3, 0x04, 0x0F, 0x3B, 0x03, 0x0F, 0x2C, 0x03, 0x00, 0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x0F, 0x47, 0x06, 0x0F, 0x55, 0x07, 0x0F,
+	0x26, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2E, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x00, 0x17, 0x25, 0x0F, 0x02, 0x26, 0x25, 0x1C, 0x04, 0x26, 0x25, 0x2C, 0x03, 0x26, 0x34, 0x2C, 0x03, 0x26, 0x24,
+	0x3C, 0x03, 0x26, 0x24, 0x2C, 0x04, 0x27, 0x23, 0x2C, 0x04, 0x27, 0x23, 0x3B, 0x04, 0x27, 0x23, 0x2B, 0x05, 0x27, 0x23, 0x3A, 0x05, 0x27, 0x33, 0x38, 0x06, 0x27, 0x24, 0x47, 0x06, 0x27, 0x34,
+	0x45, 0x07, 0x18, 0x95, 0x09, 0x38, 0x55, 0x0B, 0x3A, 0x0F, 0x04, 0x17, 0x13, 0x0F, 0x05, 0x37, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x1A, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x21,
+	0x19, 0x04, 0x3F, 0x47, 0x03, 0x2F, 0x56, 0x04, 0x2F, 0x64, 0x05, 0x2F, 0x52, 0x08, 0x8E, 0x0A, 0x9A, 0x28, 0x03, 0x4A, 0x21, 0x2A, 0x03, 0x2F, 0x2A, 0x03, 0x00, 0x2F, 0x39, 0x03, 0x3F, 0x46,
+	0x04, 0x0F, 0xB1, 0x05, 0x0F, 0x72, 0x08, 0x0F, 0x0F, 0x02, 0x2D, 0x0F, 0x02, 0x3D, 0x0F, 0x01, 0x4E, 0x0E, 0x0F, 0x41, 0x0C, 0x0F, 0x52, 0x0A, 0x0F, 0x15, 0x0B, 0x0F, 0x0F, 0x02, 0x00, 0x00,
+	0x00, 0x0F, 0xB1, 0x05, 0xFB, 0x40, 0x02, 0x5B, 0x59, 0x02, 0x1B, 0x5A, 0x05, 0x0F, 0x17, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x0F, 0x21, 0x1B, 0x02, 0x0F, 0x21, 0x2B, 0x01,
+	0x0F, 0x21, 0x2A, 0x02, 0x0F, 0x21, 0x39, 0x02, 0x0F, 0x21, 0x46, 0x04, 0xFB, 0x10, 0x05, 0xDB, 0x08, 0x2F, 0x0F, 0x00, 0x00, 0x3E, 0x0F, 0x45, 0x0F, 0x08, 0x47, 0x0F, 0x06, 0x29, 0x0F, 0x06,
+	0x24, 0x0F, 0x0B, 0x44, 0x0F, 0x09, 0x46, 0x0F, 0x07, 0x18, 0x0F, 0x08, 0x55, 0x0F, 0x07, 0x24, 0x23, 0x0F, 0x06, 0x14, 0x15, 0x0F, 0x06, 0x00, 0x24, 0x23, 0x0F, 0x06, 0x55, 0x0F, 0x07, 0x0F,
+	0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0F, 0x06, 0x39, 0x0F, 0x05, 0x3A, 0x2A, 0x07, 0x3B, 0x39, 0x06, 0x3C, 0x28, 0x07, 0x3D, 0x36, 0x07, 0x4E, 0x24, 0x08, 0x4F,
+	0x32, 0x08, 0x0F, 0x41, 0x31, 0x08, 0x0F, 0x62, 0x09, 0x0F, 0x44, 0x09, 0x0F, 0x25, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0F, 0x04, 0x2B, 0x0F, 0x04, 0x3B, 0x1B,
+	0x06, 0x3C, 0x39, 0x05, 0x3D, 0x28, 0x06, 0x3E, 0x36, 0x06, 0x4F, 0x34, 0x06, 0x19, 0x46, 0x23, 0x07, 0x38, 0x46, 0x31, 0x07, 0x3A, 0x65, 0x08, 0x2B, 0x47, 0x08, 0x27, 0x3C, 0x08, 0x47, 0x0F,
+	0x06, 0x39, 0x0F, 0x05, 0x2A, 0x0F, 0x05, 0x0F, 0x0F, 0x02, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x0F, 0x4A, 0x03, 0x0F, 0x58, 0x04, 0x0F, 0x47, 0x06, 0x0F, 0x55, 0x07, 0x0F, 0x44, 0x09, 0x0F,
+	0x52, 0x34, 0x03, 0x6F, 0x26, 0x03, 0x7D, 0x28, 0x02, 0x5B, 0x21, 0x29, 0x02, 0x59, 0x13, 0x2A, 0x02, 0x57, 0x24, 0x2A, 0x02, 0x83, 0x25, 0x39, 0x02, 0x44, 0x21, 0x25, 0x29, 0x03, 0x24, 0x23,
+	0x35, 0x37, 0x03, 0x29, 0x36, 0x44, 0x04, 0x39, 0x95, 0x06, 0x2A, 0x57, 0x08, 0x2A, 0x0F, 0x05, 0x3A, 0x0F, 0x04, 0x2B, 0x0F, 0x04, 0x1A, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1E, 0x14, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x00, 0x2C, 0x1E, 0x03, 0x2C, 0x3D,
+	0x02, 0x2C, 0x3C, 0x03, 0x00, 0x2C, 0x4A, 0x04, 0x2C, 0x48, 0x06, 0x2C, 0x92, 0x07, 0x2C, 0x62, 0x0A, 0x2C, 0x0F, 0x03, 0x2C, 0x15, 0x0C, 0x2C, 0x24, 0x0C, 0x2C, 0x43, 0x0B, 0x2C, 0x33, 0x0C,
+	0x2C, 0x41, 0x0D, 0x5C, 0x0F, 0x4C, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0x1D, 0x0F, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x27, 0x0F, 0x08, 0x27, 0x0F, 0x12, 0x05, 0x27, 0x0F, 0x22, 0x04, 0x27, 0x0F,
+	0x32, 0x03, 0x27, 0x0F, 0x31, 0x04, 0x27, 0x3F, 0x05, 0x27, 0x4E, 0x05, 0x27, 0x4D, 0x06, 0x27, 0x5A, 0x08, 0x27, 0xB3, 0x09, 0x27, 0x73, 0x0D, 0x27, 0x0F, 0x08, 0x00, 0x27, 0x16, 0x0F, 0x01,
+	0x27, 0x35, 0x0F, 0x27, 0x34, 0x0F, 0x01, 0x27, 0x33, 0x0F, 0x02, 0x27, 0x32, 0x0F, 0x03, 0x27, 0x31, 0x0F, 0x04, 0x57, 0x0F, 0x05, 0x47, 0x0F, 0x06, 0x27, 0x0F, 0x08, 0x18, 0x0F, 0x08, 0x0F,
+	0x0F, 0x02, 0x00, 0x00, 0x0F, 0x25, 0x0A, 0x00, 0x0F, 0x34, 0x0A, 0x0F, 0x24, 0x0B, 0x00, 0x0F, 0x33, 0x0B, 0x0F, 0x23, 0x0C, 0x0F, 0x32, 0x0C, 0x0F, 0x22, 0x0D, 0x0F, 0x31, 0x0D, 0x0F, 0xE1,
+	0x02, 0xFF, 0x02, 0x3E, 0x0F, 0x3D, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0x4B, 0x0F, 0x02, 0x4A, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x1B, 0x0F, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x22, 0x0D, 0x0F, 0x32,
+	0x0C, 0x0F, 0x31, 0x0D, 0x00, 0x0F, 0x21, 0x0E, 0x3F, 0x0E, 0x00, 0x2F, 0x0F, 0x3E, 0x0F, 0x2E, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0xFC, 0x20, 0x03, 0xFB, 0x30, 0x03, 0x3A, 0x0F,
+	0x04, 0x39, 0x0F, 0x05, 0x00, 0x47, 0x0F, 0x06, 0x46, 0x0F, 0x07, 0x45, 0x0F, 0x08, 0x26, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x0A, 0x00, 0x2E, 0x0F,
+	0x01, 0x00, 0x2E, 0x1C, 0x03, 0x2E, 0x2C, 0x02, 0x2E, 0x3B, 0x02, 0x6A, 0x2B, 0x03, 0x6A, 0x3A, 0x03, 0x2E, 0x2A, 0x04, 0x2E, 0x39, 0x04, 0x2E, 0x38, 0x05, 0x2E, 0x37, 0x06, 0x2E, 0x45, 0x07,
+	0x2E, 0x71, 0x08, 0x8E, 0x0A, 0x5E, 0x0D, 0x1E, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x9A, 0x0D, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x2A, 0x1F, 0x04, 0x2A, 0x2F, 0x03, 0x2A, 0x3E, 0x03,
+	0x00, 0x75, 0x2E, 0x04, 0x75, 0x3D, 0x04, 0x2A, 0x3C, 0x05, 0x2A, 0x4B, 0x05, 0x2A, 0x4A, 0x06, 0x2A, 0x49, 0x07, 0x2A, 0x48, 0x08, 0x2A, 0x56, 0x09, 0x2A, 0x63, 0x0B, 0x9A, 0x0D, 0x7A, 0x0F,
+	0x3A, 0x0F, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x2B, 0x04, 0x00, 0x2D, 0x2B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x04, 0x00, 0x2D, 0x2B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0x2B, 0x04, 0x0F, 0x0F, 0x02, 0x0F, 0x2A, 0x05, 0x00, 0x29, 0x2E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x30, 0x05, 0x00, 0x29, 0x2E, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x2A, 0x05, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x1A, 0x06, 0x2F, 0x28, 0x05, 0x2F, 0x38, 0x04, 0x2F, 0x37, 0x05, 0x2F, 0x36, 0x06, 0x2F,
+	0x26, 0x07, 0x2F, 0x25, 0x08, 0x2F, 0x34, 0x08, 0x2F, 0x33, 0x25, 0x02, 0x2F, 0x32, 0x26, 0x02, 0x2F, 0x31, 0x27, 0x02, 0x5F, 0x28, 0x02, 0xFB, 0x40, 0x02, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x19, 0x07, 0x2B, 0x3A, 0x06, 0x2B, 0x2A, 0x07, 0x2B, 0x39, 0x07, 0x2B, 0x38, 0x08, 0x2B, 0x28, 0x09, 0x2B, 0x37, 0x09, 0x2B, 0x36, 0x0A, 0x2B, 0x35,
+	0x0B, 0x2B, 0x34, 0x27, 0x03, 0x2B, 0x33, 0x28, 0x03, 0x2B, 0x32, 0x29, 0x03, 0x2B, 0x31, 0x2A, 0x03, 0x5B, 0x2B, 0x03, 0xF6, 0x80, 0x03, 0xF6, 0x70, 0x04, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x2B, 0x1D, 0x05, 0x2B, 0x2D, 0x04, 0x2B, 0x3C, 0x04, 0x2B, 0x3B, 0x05, 0x2B, 0x3A, 0x06, 0x2B, 0x49, 0x06, 0x2B, 0x47, 0x08, 0x2B, 0x55, 0x09, 0x2B,
+	0x71, 0x0B, 0xD6, 0x0D, 0x86, 0x0F, 0x03, 0x2B, 0x1D, 0x05, 0x2B, 0x2D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x3C, 0x04, 0x2B, 0x77, 0x05, 0xFB, 0x06, 0xAB, 0x0B, 0x0F, 0x0F, 0x02, 0x00, 0x2B,
+	0x1E, 0x04, 0x2B, 0x2E, 0x03, 0x2B, 0x3D, 0x03, 0x2B, 0x3C, 0x04, 0x2B, 0x3B, 0x05, 0x2B, 0x4A, 0x05, 0x2B, 0x48, 0x07, 0x2B, 0x65, 0x08, 0x2B, 0x81, 0x0A, 0xD6, 0x0D, 0x86, 0x0F, 0x03, 0x2B,
+	0x1E, 0x04, 0x2B, 0x2E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x3D, 0x03, 0x26, 0x23, 0x88, 0x03, 0x45, 0xF2, 0x10, 0x05, 0x28, 0xA1, 0x0B, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x27, 0x0F, 0x08,
+	0x0F, 0x0F, 0x02, 0x00, 0x2C, 0x26, 0x0A, 0x3B, 0x26, 0x0A, 0x00, 0x3B, 0x35, 0x0A, 0x2B, 0x36, 0x0A, 0x2B, 0x26, 0x0B, 0x00, 0x00, 0x35, 0x32, 0x26, 0x0B, 0x85, 0x26, 0x0B, 0xF6, 0x0B, 0xEA,
+	0x08, 0x2A, 0xC5, 0x03, 0x2A, 0x26, 0x81, 0x03, 0x2A, 0x26, 0x36, 0x03, 0x39, 0x26, 0x0C, 0x29, 0x36, 0x0C, 0x29, 0x26, 0x0D, 0x00, 0x38, 0x26, 0x0D, 0x1A, 0x26, 0x0D, 0x0F, 0x31, 0x0D, 0x00,
+	0x0F, 0x0F, 0x02, 0x2C, 0x27, 0x09, 0x3C, 0x35, 0x09, 0x2C, 0x36, 0x09, 0x00, 0x2C, 0x26, 0x0A, 0x3B, 0x26, 0x0A, 0x00, 0x2B, 0x27, 0x0A, 0x36, 0x22, 0x36, 0x0A, 0x95, 0x35, 0x0A, 0xF6, 0x0B,
+	0xDB, 0x08, 0x3A, 0xD4, 0x02, 0x2A, 0x27, 0x81, 0x02, 0x2A, 0x36, 0x36, 0x02, 0x2A, 0x36, 0x0B, 0x2A, 0x26, 0x0C, 0x39, 0x26, 0x0C, 0x15, 0x33, 0x26, 0x0C, 0x44, 0x31, 0x26, 0x0C, 0x36, 0x12,
+	0x35, 0x0C, 0x13, 0x14, 0x38, 0x0C, 0x33, 0x2B, 0x0D, 0x44, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x11, 0x0F, 0x0F, 0x21, 0x0E, 0x3F, 0x0E, 0x3E, 0x1A, 0x04, 0x3D, 0x2B,
+	0x03, 0x3C, 0x3B, 0x03, 0x3B, 0x3C, 0x03, 0x49, 0x3C, 0x04, 0x48, 0x3D, 0x04, 0x56, 0x3D, 0x05, 0x65, 0x2D, 0x06, 0x25, 0x22, 0x3C, 0x06, 0x29, 0x3B, 0x07, 0x29, 0x3A, 0x08, 0x29, 0x39, 0x09,
+	0x29, 0x47, 0x0A, 0x29, 0x46, 0x0B, 0x29, 0x44, 0x0D, 0x29, 0x61, 0x0E, 0x79, 0x0F, 0x01, 0x59, 0x0F, 0x03, 0x1A, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x0F, 0x12, 0x0E, 0x0F, 0x22, 0x0D, 0x0F, 0x31,
+	0x0D, 0x3F, 0x1A, 0x03, 0x3E, 0x2B, 0x02, 0x3D, 0x3B, 0x02, 0x3C, 0x3C, 0x02, 0x3B, 0x3C, 0x03, 0x49, 0x3D, 0x03, 0x57, 0x3D, 0x04, 0x66, 0x3D, 0x04, 0x36, 0x21, 0x3C, 0x05, 0x16, 0x23, 0x3B,
+	0x06, 0x2A, 0x3A, 0x07, 0x2A, 0x49, 0x07, 0x2A, 0x47, 0x09, 0x2A, 0x46, 0x0A, 0x2A, 0x54, 0x0B, 0x2A, 0x52, 0x0D, 0x16, 0x83, 0x0E, 0x35, 0x52, 0x0F, 0x02, 0x67, 0x0F, 0x04, 0x14, 0x13, 0x0F,
+	0x08, 0x34, 0x0F, 0x0A, 0x45, 0x0F, 0x08, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x0F, 0x12, 0x0E, 0x00, 0x0F, 0x31, 0x0D, 0x3F, 0x0E, 0x4D, 0x0F, 0x4C, 0x0F, 0x01, 0x5A, 0x1C, 0x04, 0x15, 0x61,
+	0x1E, 0x04, 0x76, 0x3D, 0x03, 0x36, 0x22, 0x3D, 0x03, 0x2B, 0x3C, 0x04, 0x2B, 0x4A, 0x05, 0x2B, 0x49, 0x06, 0x2B, 0x57, 0x07, 0x2B, 0x73, 0x09, 0xAB, 0x0B, 0x6B, 0x0F, 0x2B, 0x0F, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x12, 0x0E, 0x00, 0x0F, 0x31, 0x0D, 0x3F, 0x0E, 0x4D, 0x0F, 0x4C, 0x0F, 0x01, 0x5A, 0x1C, 0x04, 0x85, 0x2E, 0x03, 0x76, 0x3D, 0x03, 0x36, 0x22, 0x4C,
+	0x03, 0x2B, 0x3C, 0x04, 0x2B, 0x4A, 0x05, 0x2B, 0x49, 0x06, 0x2B, 0x57, 0x07, 0x2B, 0x73, 0x09, 0xAB, 0x0B, 0x6B, 0x0F, 0x2B, 0x0F, 0x04, 0x00, 0x15, 0x25, 0x0F, 0x04, 0x35, 0x23, 0x0F, 0x04,
+	0x46, 0x21, 0x0F, 0x04, 0x14, 0x13, 0x22, 0x0F, 0x04, 0x34, 0x24, 0x0F, 0x04, 0x35, 0x23, 0x0F, 0x04, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x28, 0x2E, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x50, 0x04, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x29, 0x2E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x24, 0x2E, 0x05, 0x34, 0x22, 0x2E, 0x05, 0xF5, 0x90, 0x03, 0x17, 0xF1, 0x50, 0x03, 0x23, 0x0F, 0x0C, 0x44, 0x0F, 0x09, 0x25, 0x0F, 0x0A,
+	0x0F, 0x0F, 0x02, 0x2C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0B, 0x00, 0x2C, 0x1D, 0x04, 0x2C, 0x2D, 0x03, 0x2C, 0x3D, 0x02, 0x2C, 0x3C, 0x03, 0x00, 0x2C, 0x3B, 0x04, 0x2C, 0x3A,
+	0x05, 0x2C, 0x58, 0x05, 0x2C, 0x56, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x0B, 0x2C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x2C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+	0x0B, 0x00, 0x2C, 0x1D, 0x04, 0x2C, 0x2D, 0x03, 0x2C, 0x3D, 0x02, 0x2C, 0x3C, 0x03, 0x2C, 0x3B, 0x04, 0x2C, 0x4A, 0x04, 0x2C, 0x49, 0x05, 0x2C, 0x56, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x0B, 0x2C,
+	0x0F, 0x03, 0x16, 0x25, 0x0F, 0x03, 0x36, 0x23, 0x0F, 0x03, 0x28, 0x22, 0x0F, 0x03, 0x15, 0x26, 0x0F, 0x03, 0x35, 0x11, 0x22, 0x0F, 0x03, 0x27, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x1E, 0x0F,
+	0x02, 0x3C, 0x1B, 0x05, 0x3D, 0x3A, 0x03, 0x3E, 0x39, 0x03, 0x17, 0x36, 0x29, 0x04, 0x36, 0x36, 0x28, 0x04, 0x27, 0x27, 0x37, 0x04, 0x37, 0x16, 0x38, 0x04, 0x38, 0x3D, 0x05, 0x29, 0x3D, 0x05,
+	0x39, 0x3B, 0x06, 0x1A, 0x3C, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x36, 0x08, 0x00, 0x0F, 0x35, 0x09, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x0F, 0x32, 0x0C, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x4D, 0x0F,
+	0x2E, 0x0F, 0x01, 0x0F, 0x0F, 0x02, 0x00, 0x1E, 0x0F, 0x02, 0x3C, 0x1B, 0x05, 0x3D, 0x3A, 0x03, 0x2E, 0x3A, 0x03, 0x17, 0x36, 0x29, 0x04, 0x36, 0x36, 0x28, 0x04, 0x36, 0x27, 0x37, 0x04, 0x37,
+	0x16, 0x38, 0x04, 0x28, 0x3E, 0x05, 0x38, 0x3D, 0x05, 0x39, 0x2C, 0x06, 0x1A, 0x3C, 0x06, 0x0F, 0x37, 0x07, 0x00, 0x0F, 0x36, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x25, 0x0A, 0x17, 0x3B, 0x0A, 0x46,
+	0x38, 0x0B, 0x48, 0x35, 0x0C, 0x1A, 0x44, 0x0D, 0x25, 0x47, 0x0E, 0x45, 0x44, 0x0F, 0x37, 0x15, 0x0F, 0x01, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x1B, 0x05, 0x0F, 0x3B, 0x03, 0x0F,
+	0x3A, 0x04, 0x28, 0x3F, 0x04, 0x28, 0x3E, 0x05, 0x00, 0x28, 0x3D, 0x06, 0x28, 0x3C, 0x07, 0x28, 0x3B, 0x08, 0x28, 0x3A, 0x09, 0x28, 0x49, 0x09, 0x28, 0x48, 0x0A, 0x28, 0x47, 0x0B, 0x28, 0x56,
+	0x0B, 0x28, 0x84, 0x0A, 0x28, 0x43, 0x42, 0x09, 0x78, 0x45, 0x08, 0x68, 0x47, 0x07, 0x48, 0x4A, 0x06, 0x28, 0x4D, 0x05, 0x0F, 0x49, 0x04, 0x0F, 0x4A, 0x03, 0x0F, 0x1B, 0x05, 0x0F, 0x0F, 0x02,
+	0x0F, 0x1B, 0x05, 0x0F, 0x3B, 0x03, 0x28, 0x3F, 0x04, 0x00, 0x28, 0x3E, 0x05, 0x28, 0x2E, 0x06, 0x28, 0x3D, 0x06, 0x28, 0x3C, 0x07, 0x28, 0x3B, 0x08, 0x28, 0x3A, 0x09, 0x28, 0x39, 0x0A, 0x28,
+	0x48, 0x0A, 0x28, 0x47, 0x0B, 0x28, 0x56, 0x0B, 0x28, 0x84, 0x0A, 0x28, 0x52, 0x42, 0x09, 0x78, 0x45, 0x08, 0x68, 0x47, 0x07, 0x15, 0x42, 0x4A, 0x06, 0x64, 0x4D, 0x05, 0x36, 0x5F, 0x03, 0x14,
+	0x13, 0x0F, 0x31, 0x04, 0x33, 0x0F, 0x15, 0x05, 0x35, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x3E, 0x0F, 0x2E, 0x0F, 0x01, 0x00, 0x00, 0x3D, 0x0F, 0x01, 0x2D, 0x0F, 0x02, 0x00, 0xF5,
+	0x60, 0x06, 0xF5, 0x70, 0x05, 0x3C, 0x3A, 0x04, 0x2C, 0x2C, 0x04, 0x00, 0x00, 0x00, 0x3B, 0x2C, 0x04, 0x2B, 0x16, 0x26, 0x04, 0x2B, 0x44, 0x25, 0x04, 0x2B, 0x43, 0x26, 0x04, 0x2B, 0x42, 0x27,
+	0x04, 0x7A, 0x29, 0x04, 0x6A, 0x39, 0x04, 0x4A, 0x3B, 0x04, 0x3A, 0x0F, 0x04, 0x0F, 0x0F, 0x02, 0x3F, 0x0E, 0x2F, 0x0F, 0x00, 0x00, 0x3E, 0x0F, 0x00, 0x2E, 0x0F, 0x01, 0xF6, 0x60, 0x05, 0xF6,
+	0x70, 0x04, 0x3D, 0x3A, 0x03, 0x2D, 0x2C, 0x03, 0x00, 0x00, 0x00, 0x3C, 0x2C, 0x03, 0x2C, 0x16, 0x26, 0x03, 0x2C, 0x44, 0x25, 0x03, 0x2C, 0x43, 0x26, 0x03, 0x2C, 0x32, 0x28, 0x03, 0x25, 0x74,
+	0x29, 0x03, 0x45, 0x62, 0x39, 0x03, 0x37, 0x41, 0x3B, 0x03, 0x24, 0x12, 0x32, 0x0F, 0x03, 0x34, 0x0F, 0x0A, 0x36, 0x0F, 0x08, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x18, 0x0F, 0x08,
+	0x38, 0x0F, 0x06, 0x67, 0x0F, 0x04, 0x59, 0x0F, 0x03, 0x5B, 0x1B, 0x04, 0x4D, 0x29, 0x04, 0x2E, 0x3A, 0x03, 0x0F, 0x3A, 0x04, 0x00, 0x0F, 0x39, 0x05, 0x0F, 0x38, 0x06, 0x0F, 0x47, 0x06, 0x0F,
+	0x46, 0x07, 0x0F, 0x45, 0x08, 0x0F, 0x53, 0x09, 0x0F, 0x42, 0x0B, 0x6E, 0x0C, 0x7B, 0x0E, 0x97, 0x0F, 0x01, 0x67, 0x0F, 0x04, 0x27, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x18, 0x0F, 0x08, 0x38,
+	0x0F, 0x06, 0x58, 0x0F, 0x04, 0x5A, 0x0F, 0x02, 0x5B, 0x1B, 0x04, 0x4D, 0x29, 0x04, 0x1F, 0x3A, 0x03, 0x0F, 0x3A, 0x04, 0x00, 0x0F, 0x39, 0x05, 0x0F, 0x38, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x46,
+	0x07, 0x0F, 0x45, 0x08, 0x0F, 0x53, 0x09, 0x0F, 0x51, 0x0B, 0x14, 0x69, 0x0C, 0x24, 0x84, 0x0E, 0x35, 0x71, 0x0F, 0x01, 0x26, 0x31, 0x0F, 0x05, 0x13, 0x0F, 0x0D, 0x33, 0x0F, 0x0B, 0x34, 0x0F,
+	0x0A, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x0F, 0x12, 0x0E, 0x0F, 0x31, 0x0D, 0x3F, 0x0E, 0x2F, 0x1B, 0x03, 0x3E, 0x3A, 0x02, 0x3D, 0x2B, 0x03, 0x4B, 0x3B, 0x03, 0x4A, 0x3C, 0x03, 0x49, 0x13,
+	0x38, 0x04, 0x47, 0x34, 0x37, 0x04, 0x65, 0x25, 0x36, 0x05, 0x35, 0x21, 0x35, 0x34, 0x06, 0x16, 0x22, 0x36, 0x42, 0x06, 0x29, 0x27, 0x32, 0x07, 0x29, 0x67, 0x08, 0x29, 0x48, 0x09, 0x29, 0x57,
+	0x09, 0x29, 0x75, 0x09, 0x29, 0x53, 0x32, 0x08, 0x29, 0x51, 0x35, 0x07, 0x79, 0x17, 0x08, 0x49, 0x0F, 0x04, 0x1A, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x0F, 0x12, 0x0E, 0x0F, 0x31, 0x0D, 0x3F, 0x0E,
+	0x2F, 0x1B, 0x03, 0x2E, 0x3B, 0x02, 0x4C, 0x2B, 0x03, 0x4B, 0x3B, 0x03, 0x4A, 0x2C, 0x04, 0x48, 0x14, 0x38, 0x04, 0x47, 0x34, 0x27, 0x05, 0x65, 0x35, 0x35, 0x05, 0x35, 0x21, 0x35, 0x34, 0x06,
+	0x15, 0x23, 0x36, 0x32, 0x07, 0x29, 0x77, 0x07, 0x29, 0x67, 0x08, 0x29, 0x48, 0x09, 0x29, 0x66, 0x09, 0x29, 0x85, 0x08, 0x29, 0x62, 0x42, 0x07, 0x15, 0x83, 0x25, 0x08, 0x44, 0x61, 0x17, 0x09,
+	0x66, 0x0F, 0x05, 0x14, 0x23, 0x0F, 0x07, 0x33, 0x0F, 0x0B, 0x35, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x2F, 0x0F, 0x00, 0x27, 0x26, 0x0F, 0x00, 0x27, 0x26, 0x1A, 0x04, 0x27,
+	0x26, 0x39, 0x03, 0x00, 0x27, 0x26, 0x38, 0x04, 0x27, 0x26, 0x37, 0x05, 0x27, 0x26, 0x45, 0x06, 0x27, 0x26, 0x53, 0x07, 0xF7, 0x10, 0x09, 0xE7, 0x0B, 0x27, 0x26, 0x0F, 0x26, 0x27, 0x0F, 0x00,
+	0x00, 0x00, 0x35, 0x27, 0x0F, 0x26, 0x27, 0x0F, 0x2F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x2F, 0x0F, 0x00, 0x28, 0x25, 0x0F, 0x00, 0x28, 0x25, 0x1A, 0x04, 0x28, 0x25, 0x39, 0x03, 0x00, 0x28,
+	0x25, 0x38, 0x04, 0x28, 0x25, 0x37, 0x05, 0x28, 0x25, 0x45, 0x06, 0x28, 0x25, 0x53, 0x07, 0xF8, 0x09, 0xC8, 0x0C, 0x28, 0x25, 0x0F, 0x27, 0x26, 0x0F, 0x00, 0x00, 0x00, 0x36, 0x11, 0x24, 0x0F,
+	0x27, 0x31, 0x22, 0x0F, 0x3B, 0x21, 0x0F, 0x19, 0x13, 0x21, 0x0F, 0x29, 0x24, 0x0F, 0x3A, 0x0F, 0x04, 0x1B, 0x0F, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x1D, 0x0F, 0x03, 0x4D, 0x0F, 0x8C,
+	0x0C, 0x0F, 0x41, 0x18, 0x03, 0x0F, 0x13, 0x19, 0x03, 0x0F, 0x3C, 0x02, 0x0F, 0x2C, 0x03, 0x3B, 0x3C, 0x03, 0x6B, 0x29, 0x04, 0x5D, 0x37, 0x04, 0x0F, 0x11, 0x37, 0x05, 0x0F, 0x38, 0x06, 0x0F,
+	0x37, 0x07, 0x0F, 0x45, 0x08, 0x0F, 0x44, 0x09, 0x0F, 0x51, 0x0B, 0x8C, 0x0C, 0x5C, 0x0F, 0x2C, 0x0F, 0x03, 0x0F, 0x0F, 0x02, 0x00, 0x28, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x78, 0x0F, 0x02, 0x6B,
+	0x0F, 0x3D, 0x0F, 0x01, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x00, 0x17, 0x0F, 0x32, 0x04, 0x46, 0x3F, 0x04, 0x67, 0x3B, 0x05, 0x59, 0x39, 0x06, 0x2C, 0x48, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x36,
+	0x08, 0x0F, 0x44, 0x09, 0x0F, 0x43, 0x0A, 0x0F, 0x51, 0x0B, 0x5E, 0x0D, 0x6B, 0x0F, 0x87, 0x0F, 0x02, 0x67, 0x0F, 0x04, 0x18, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x19, 0x0F, 0x07, 0x49, 0x0F,
+	0x04, 0x78, 0x0F, 0x02, 0x6B, 0x0F, 0x3E, 0x1A, 0x04, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x00, 0x27, 0x0F, 0x31, 0x04, 0x47, 0x3E, 0x04, 0x77, 0x3A, 0x05, 0x5A, 0x38, 0x06, 0x1D, 0x39, 0x06,
+	0x0F, 0x37, 0x07, 0x0F, 0x36, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x43, 0x0A, 0x14, 0x5B, 0x0B, 0x24, 0x58, 0x0D, 0x35, 0x73, 0x0E, 0x26, 0x71, 0x0F, 0x01, 0x13, 0x36, 0x0F, 0x04, 0x33, 0x13, 0x0F,
+	0x07, 0x34, 0x0F, 0x0A, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x2E, 0x0F, 0x01, 0x00, 0x00, 0x27, 0x25, 0x0F, 0x01, 0x27, 0x25, 0x1B, 0x04, 0x27, 0x25, 0x2B, 0x03, 0x27, 0x25, 0x3A, 0x03,
+	0x27, 0x25, 0x39, 0x04, 0x27, 0x25, 0x38, 0x05, 0x27, 0x25, 0x47, 0x05, 0x27, 0x25, 0x64, 0x06, 0x27, 0xA5, 0x08, 0x27, 0x75, 0x0B, 0x27, 0x25, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2E, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x2E, 0x0F, 0x01, 0x00, 0x00, 0x27, 0x25, 0x0F, 0x01, 0x27, 0x25, 0x1B, 0x04, 0x27, 0x25, 0x2B, 0x03, 0x27, 0x25, 0x3A, 0x03, 0x27, 0x25,
+	0x39, 0x04, 0x27, 0x25, 0x38, 0x05, 0x27, 0x25, 0x47, 0x05, 0x27, 0x25, 0x64, 0x06, 0x27, 0xA5, 0x08, 0x27, 0x75, 0x0B, 0x27, 0x25, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x28, 0x0F, 0x01,
+	0x34, 0x27, 0x0F, 0x01, 0x36, 0x25, 0x0F, 0x01, 0x14, 0x22, 0x25, 0x0F, 0x01, 0x33, 0x28, 0x0F, 0x01, 0x34, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xF6, 0x80, 0x03, 0x00, 0x2E, 0x0F, 0x01, 0x3E, 0x0F, 0x00, 0x2F, 0x0F, 0x3F, 0x0E, 0x0F, 0x21, 0x0E, 0x0F, 0x31, 0x0D, 0x00, 0x0F, 0x22, 0x0D, 0x0F, 0x32, 0x0C, 0x0F, 0x23, 0x0C,
+	0x0F, 0x33, 0x0B, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x90, 0x03, 0x00, 0x3D, 0x0F, 0x01, 0x2E, 0x0F, 0x01, 0x3E, 0x0F, 0x00, 0x2F, 0x0F, 0x3F, 0x0E, 0x17, 0x37,
+	0x0E, 0x46, 0x36, 0x0D, 0x48, 0x34, 0x0D, 0x29, 0x36, 0x0C, 0x25, 0x3A, 0x0C, 0x45, 0x39, 0x0B, 0x37, 0x0F, 0x07, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x2C, 0x0F, 0x03, 0x00, 0x00, 0x2C,
+	0x1C, 0x05, 0x2C, 0x2C, 0x04, 0x2C, 0x4B, 0x03, 0x2C, 0x3B, 0x04, 0x2C, 0x3A, 0x05, 0x2C, 0x48, 0x06, 0x2C, 0x47, 0x07, 0x2C, 0x64, 0x08, 0xF5, 0x20, 0x0A, 0xE5, 0x0D, 0x2C, 0x0F, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x29, 0x2D, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x1C, 0x04, 0x0F, 0x2C, 0x03, 0x28, 0x0F, 0x31, 0x03, 0x28, 0x15, 0x3A, 0x03, 0x28, 0x24, 0x39, 0x04,
+	0x28, 0x34, 0x38, 0x04, 0x28, 0x35, 0x36, 0x05, 0x28, 0x26, 0x45, 0x05, 0x28, 0x36, 0x43, 0x06, 0x28, 0x37, 0x32, 0x07, 0x28, 0x28, 0x31, 0x08, 0x28, 0x58, 0x09, 0x28, 0x39, 0x0A, 0x28, 0x67,
+	0x09, 0x28, 0x85, 0x09, 0x28, 0x53, 0x33, 0x08, 0x98, 0x35, 0x07, 0x68, 0x39, 0x06, 0x48, 0x4B, 0x05, 0x19, 0x1E, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x16, 0x0A, 0x0F, 0x26, 0x09, 0x29, 0x39,
+	0x09, 0x00, 0x29, 0x29, 0x0A, 0x29, 0x38, 0x0A, 0x00, 0x29, 0x28, 0x0B, 0x29, 0x37, 0x0B, 0x29, 0x27, 0x0C, 0x29, 0x36, 0x0C, 0x65, 0xD5, 0x03, 0x65, 0xE4, 0x03, 0x29, 0x24, 0x0F, 0x29, 0x33,
+	0x0F, 0x29, 0x32, 0x13, 0x0C, 0x29, 0x31, 0x23, 0x0C, 0x59, 0x24, 0x0C, 0x49, 0x35, 0x0B, 0x39, 0x37, 0x0A, 0x1A, 0x29, 0x0A, 0x0F, 0x35, 0x09, 0x0F, 0x36, 0x08, 0x0F, 0x16, 0x0A, 0x0F, 0x0F,
+	0x02, 0x00, 0x00, 0x0F, 0x1B, 0x05, 0x0F, 0x2A, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x00, 0x0F, 0x36, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x34, 0x0A,
+	0x0F, 0x42, 0x0B, 0x0F, 0x41, 0x0C, 0x5E, 0x0D, 0x5C, 0x0F, 0x78, 0x0F, 0x02, 0x76, 0x0F, 0x04, 0x56, 0x0F, 0x06, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x0F, 0x1B, 0x05, 0x0F, 0x3A, 0x04, 0x0F,
+	0x58, 0x04, 0x0F, 0x56, 0x06, 0x0F, 0x64, 0x07, 0x0F, 0x71, 0x09, 0x8D, 0x0B, 0xA8, 0x0E, 0x69, 0x0F, 0x02, 0x29, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0F, 0x07, 0x48,
+	0x0F, 0x05, 0x59, 0x0F, 0x03, 0x6B, 0x0F, 0x6D, 0x0D, 0x7F, 0x0A, 0x0F, 0x82, 0x07, 0x0F, 0x85, 0x04, 0x0F, 0x58, 0x04, 0x0F, 0x1B, 0x05, 0x0F, 0x0F, 0x02, 0x0F, 0x1B, 0x05, 0x0F, 0x3A, 0x04,
+	0x0F, 0x58, 0x04, 0x0F, 0x56, 0x06, 0x0F, 0x64, 0x07, 0x0F, 0x71, 0x09, 0x9C, 0x0B, 0xA8, 0x0E, 0x69, 0x0F, 0x02, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0F, 0x06,
+	0x58, 0x0F, 0x04, 0x69, 0x0F, 0x02, 0x6B, 0x0F, 0x16, 0x76, 0x0C, 0x45, 0x77, 0x09, 0x37, 0x88, 0x06, 0x14, 0x13, 0x7C, 0x04, 0x34, 0x0F, 0x32, 0x05, 0x45, 0x0F, 0x12, 0x05, 0x17, 0x0F, 0x09,
+	0x0F, 0x0F, 0x02, 0x0F, 0x1C, 0x04, 0x0F, 0x2B, 0x04, 0x0F, 0x49, 0x04, 0x0F, 0x57, 0x05, 0x0F, 0x65, 0x06, 0x0F, 0x63, 0x08, 0x7F, 0x0A, 0x9A, 0x0D, 0x79, 0x0F, 0x01, 0x49, 0x0F, 0x04, 0x0F,
+	0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0F, 0x07, 0x39, 0x0F, 0x05, 0x68, 0x0F, 0x03, 0x5B, 0x0F, 0x01, 0x6D, 0x0D, 0x46, 0x75, 0x0A, 0x25, 0x22, 0x87, 0x06, 0x15, 0x14, 0x89, 0x04, 0x15,
+	0x14, 0x5C, 0x04, 0x25, 0x22, 0x1F, 0x05, 0x46, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0xF6, 0x60, 0x05, 0x2F, 0x28, 0x05, 0x3E, 0x29, 0x04, 0x00, 0x2E,
+	0x2A, 0x04, 0x00, 0x3D, 0x2A, 0x04, 0x2D, 0x2B, 0x04, 0x00, 0x3C, 0x2B, 0x04, 0x2C, 0x2C, 0x04, 0x00, 0x3B, 0x2C, 0x04, 0x2B, 0x2D, 0x04, 0x3A, 0x2D, 0x04, 0x1B, 0x3D, 0x04, 0x0F, 0x3A, 0x04,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0xF6, 0x60, 0x05, 0x2F, 0x28, 0x05, 0x3E, 0x29, 0x04, 0x00, 0x2E, 0x2A, 0x04, 0x00, 0x3D, 0x2A, 0x04, 0x2D, 0x2B, 0x04, 0x00, 0x3C,
+	0x2B, 0x04, 0x2C, 0x2C, 0x04, 0x00, 0x3B, 0x2C, 0x04, 0x25, 0x24, 0x2D, 0x04, 0x45, 0x31, 0x2D, 0x04, 0x37, 0x12, 0x3C, 0x04, 0x24, 0x12, 0x0F, 0x31, 0x04, 0x34, 0x0F, 0x0A, 0x26, 0x0F, 0x09,
+	0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0xF6, 0x60, 0x05, 0x2F, 0x28, 0x05, 0x2F, 0x29, 0x04, 0x3E, 0x29, 0x04, 0x2E, 0x2A, 0x04, 0x00, 0x00, 0x3D, 0x2A,
+	0x04, 0x2D, 0x2B, 0x04, 0x00, 0x3C, 0x2B, 0x04, 0x2C, 0x2C, 0x04, 0x3B, 0x2C, 0x04, 0x00, 0x76, 0x2D, 0x04, 0x25, 0x22, 0x11, 0x3C, 0x04, 0x15, 0x14, 0x3E, 0x04, 0x15, 0x14, 0x0F, 0x06, 0x25,
+	0x22, 0x0F, 0x06, 0x46, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x00, 0x28, 0x0F, 0x11, 0x05, 0x28, 0x0F, 0x31, 0x03, 0x28, 0x0F, 0x21, 0x04, 0x28, 0x3F, 0x04, 0x00,
+	0x28, 0x3E, 0x05, 0x00, 0x28, 0x3D, 0x06, 0x28, 0x3C, 0x07, 0x28, 0x4B, 0x07, 0x28, 0x4A, 0x08, 0x28, 0x49, 0x09, 0x28, 0x57, 0x0A, 0x28, 0x55, 0x0C, 0x28, 0x72, 0x0D, 0x98, 0x0F, 0x68, 0x0F,
+	0x03, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x00, 0x28, 0x0F, 0x11, 0x05, 0x28, 0x0F, 0x31, 0x03, 0x28, 0x3F, 0x04, 0x00, 0x28, 0x2F, 0x05, 0x28, 0x3E, 0x05,
+	0x28, 0x3D, 0x06, 0x00, 0x28, 0x3C, 0x07, 0x28, 0x3B, 0x08, 0x28, 0x3A, 0x09, 0x28, 0x48, 0x0A, 0x28, 0x56, 0x0B, 0x14, 0x23, 0x64, 0x0C, 0x24, 0xA2, 0x0E, 0xB5, 0x0F, 0x01, 0x76, 0x0F, 0x04,
+	0x13, 0x14, 0x0F, 0x08, 0x33, 0x0F, 0x0B, 0x44, 0x0F, 0x09, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x28, 0x0F, 0x11, 0x05, 0x28, 0x0F, 0x21, 0x04, 0x28, 0x0F,
+	0x31, 0x03, 0x28, 0x3F, 0x04, 0x00, 0x28, 0x3E, 0x05, 0x00, 0x28, 0x3D, 0x06, 0x00, 0x28, 0x3C, 0x07, 0x28, 0x3B, 0x08, 0x28, 0x3A, 0x09, 0x28, 0x48, 0x0A, 0x28, 0x56, 0x0B, 0x28, 0x64, 0x0C,
+	0xA8, 0x0E, 0xA5, 0x0F, 0x02, 0x24, 0x32, 0x0F, 0x06, 0x14, 0x14, 0x0F, 0x07, 0x00, 0x24, 0x22, 0x0F, 0x07, 0x45, 0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x0F, 0x14, 0x0C, 0x0F, 0x33, 0x0B, 0x0F, 0x52,
+	0x0A, 0x0F, 0x41, 0x0C, 0x4F, 0x0D, 0x3E, 0x0F, 0x4C, 0x0F, 0x01, 0x4B, 0x0F, 0x02, 0x4A, 0x0F, 0x03, 0x49, 0x0F, 0x04, 0x39, 0x0F, 0x05, 0x49, 0x0F, 0x04, 0x3A, 0x0F, 0x04, 0x4B, 0x0F, 0x02,
+	0x4C, 0x0F, 0x01, 0x4D, 0x0F, 0x4E, 0x0E, 0x4F, 0x0D, 0x0F, 0x41, 0x0C, 0x0F, 0x42, 0x0B, 0x0F, 0x43, 0x0A, 0x0F, 0x44, 0x09, 0x0F, 0x55, 0x07, 0x0F, 0x47, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x19,
+	0x07, 0x0F, 0x15, 0x0B, 0x0F, 0x34, 0x0A, 0x0F, 0x53, 0x09, 0x0F, 0x42, 0x0B, 0x0F, 0x41, 0x0C, 0x3F, 0x0E, 0x3E, 0x0F, 0x3D, 0x0F, 0x01, 0x3C, 0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x2B, 0x0F, 0x04,
+	0x3B, 0x0F, 0x03, 0x2C, 0x0F, 0x03, 0x4C, 0x0F, 0x01, 0x4D, 0x0F, 0x4E, 0x0E, 0x4F, 0x0D, 0x1A, 0x45, 0x0C, 0x39, 0x45, 0x0B, 0x3A, 0x45, 0x0A, 0x2C, 0x45, 0x09, 0x18, 0x14, 0x46, 0x08, 0x38,
+	0x5A, 0x06, 0x39, 0x4B, 0x05, 0x1B, 0x3C, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x0F, 0x02, 0x0F, 0x24, 0x0B, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x0F, 0x41, 0x0C, 0x4F, 0x0D, 0x4E, 0x0E, 0x3D, 0x0F,
+	0x01, 0x3C, 0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x00, 0x3B, 0x0F, 0x03, 0x3C, 0x0F, 0x02, 0x3D, 0x0F, 0x01, 0x3E, 0x0F, 0x3F, 0x0E, 0x0F, 0x31, 0x0D, 0x39, 0x45, 0x0B, 0x18, 0x13,
+	0x45, 0x0A, 0x17, 0x15, 0x45, 0x09, 0x17, 0x15, 0x46, 0x08, 0x17, 0x15, 0x47, 0x07, 0x18, 0x13, 0x49, 0x06, 0x39, 0x4B, 0x05, 0x0F, 0x29, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0x2A, 0x1B, 0x08, 0x2A,
+	0x49, 0x07, 0x2A, 0x48, 0x08, 0x2A, 0x56, 0x09, 0x2A, 0x45, 0x0B, 0x2A, 0x44, 0x0C, 0x2A, 0x24, 0x0E, 0x2A, 0x2F, 0x03, 0x00, 0x00, 0x00, 0xF5, 0x90, 0x03, 0xF5, 0x80, 0x04, 0x2A, 0x0F, 0x05,
+	0x00, 0x00, 0x00, 0x2A, 0x15, 0x0E, 0x2A, 0x34, 0x0D, 0x2A, 0x45, 0x0B, 0x2A, 0x56, 0x09, 0x2A, 0x48, 0x08, 0x2A, 0x49, 0x07, 0x0F, 0x18, 0x08, 0x0F, 0x0F, 0x02, 0x2B, 0x2A, 0x07, 0x2B, 0x39,
+	0x07, 0x2B, 0x38, 0x08, 0x2B, 0x46, 0x09, 0x2B, 0x45, 0x0A, 0x2B, 0x43, 0x0C, 0x2B, 0x24, 0x0D, 0x2B, 0x2E, 0x03, 0x00, 0x00, 0x00, 0xF6, 0x80, 0x03, 0xF6, 0x70, 0x04, 0x2B, 0x0F, 0x04, 0x00,
+	0x00, 0x00, 0x2B, 0x14, 0x0E, 0x16, 0x24, 0x43, 0x0C, 0x45, 0x22, 0x44, 0x0B, 0x37, 0x21, 0x46, 0x09, 0x15, 0x13, 0x21, 0x57, 0x07, 0x25, 0x24, 0x39, 0x07, 0x36, 0x1E, 0x08, 0x27, 0x0F, 0x08,
+	0x0F, 0x0F, 0x02, 0x2B, 0x2A, 0x07, 0x2B, 0x39, 0x07, 0x2B, 0x38, 0x08, 0x2B, 0x46, 0x09, 0x2B, 0x45, 0x0A, 0x2B, 0x43, 0x0C, 0x2B, 0x24, 0x0D, 0x2B, 0x2E, 0x03, 0x00, 0x00, 0x00, 0xF6, 0x80,
+	0x03, 0xF6, 0x70, 0x04, 0x2B, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x24, 0x0D, 0x45, 0x22, 0x43, 0x0C, 0x24, 0x22, 0x21, 0x35, 0x0B, 0x14, 0x14, 0x21, 0x46, 0x09, 0x14, 0x14, 0x21, 0x57,
+	0x07, 0x24, 0x22, 0x21, 0x39, 0x07, 0x45, 0x1E, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x28, 0x26, 0x0E, 0x28, 0x36, 0x0D, 0x00, 0x28, 0x37, 0x0C, 0x28, 0x38, 0x0B,
+	0x28, 0x39, 0x0A, 0x28, 0x3A, 0x09, 0x28, 0x4A, 0x08, 0x28, 0x69, 0x07, 0x28, 0x38, 0x32, 0x06, 0x28, 0x37, 0x34, 0x05, 0x28, 0x36, 0x46, 0x03, 0x28, 0x35, 0x28, 0x04, 0x28, 0x34, 0x1A, 0x04,
+	0x28, 0x42, 0x0F, 0x01, 0x28, 0x41, 0x0F, 0x02, 0x68, 0x0F, 0x03, 0x58, 0x0F, 0x04, 0x38, 0x0F, 0x06, 0x19, 0x0F, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x28, 0x07, 0x0F, 0x37, 0x07,
+	0x2E, 0x27, 0x07, 0x17, 0x26, 0x27, 0x07, 0x26, 0x26, 0x27, 0x07, 0x36, 0x35, 0x36, 0x06, 0x36, 0x26, 0x36, 0x06, 0x27, 0x26, 0x27, 0x06, 0x00, 0x27, 0x36, 0x36, 0x05, 0x37, 0x35, 0x36, 0x05,
+	0x37, 0x26, 0x27, 0x05, 0x28, 0x26, 0x27, 0x05, 0x28, 0x36, 0x36, 0x04, 0x38, 0x35, 0x36, 0x04, 0x38, 0x26, 0x27, 0x04, 0x29, 0x36, 0x36, 0x03, 0x39, 0x1F, 0x04, 0x29, 0x0F, 0x06, 0x0F, 0x0F,
+	0x02, 0x0F, 0x2A, 0x05, 0x00, 0x00, 0x00, 0x0F, 0x39, 0x05, 0x0F, 0x66, 0x05, 0x0F, 0x93, 0x05, 0x8F, 0x12, 0x06, 0x8C, 0x24, 0x06, 0x89, 0x27, 0x06, 0x86, 0x2A, 0x06, 0x56, 0x2D, 0x06, 0x26,
+	0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x0F, 0x12, 0x26, 0x06, 0x0F, 0x22, 0x25, 0x06, 0x0F, 0x51, 0x32, 0x06, 0x0F, 0x43, 0x21, 0x07, 0x0F, 0x64, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x58,
+	0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x2B, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x00, 0x1C, 0x3C, 0x04, 0x3A, 0x2C, 0x05, 0x3B, 0x3A, 0x05, 0x3B, 0x39, 0x06, 0x3C, 0x37,
+	0x07, 0x3D, 0x45, 0x07, 0x3E, 0x43, 0x08, 0x3E, 0x42, 0x09, 0x7F, 0x0A, 0x0F, 0x51, 0x0B, 0x5F, 0x0C, 0x8D, 0x0B, 0x5C, 0x41, 0x0A, 0x69, 0x44, 0x09, 0x76, 0x47, 0x08, 0x56, 0x4A, 0x07, 0x17,
+	0x4E, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x19, 0x07, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x28, 0x26, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x30, 0x06, 0xF8, 0x40, 0x05, 0x28,
+	0x26, 0x37, 0x04, 0x28, 0x26, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x21, 0x28, 0x04, 0x0F, 0x21, 0x0E, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x0F, 0x31,
+	0x0D, 0x0F, 0x21, 0x0E, 0x00, 0x1A, 0x25, 0x0E, 0x4A, 0x22, 0x0E, 0x8A, 0x0E, 0x8D, 0x0B, 0x9F, 0x08, 0x2F, 0x83, 0x04, 0x2F, 0x76, 0x02, 0x2F, 0x49, 0x02, 0x2E, 0x0F, 0x01, 0x2E, 0x24, 0x0A,
+	0x2E, 0x33, 0x0A, 0x2E, 0x32, 0x0B, 0x2E, 0x31, 0x0C, 0x2D, 0x31, 0x0D, 0x5D, 0x0E, 0x3D, 0x0F, 0x01, 0x1E, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x2D, 0x0F, 0x02, 0x00, 0x00, 0x3C, 0x0F, 0x02, 0x2C,
+	0x0F, 0x03, 0x15, 0x26, 0x0F, 0x03, 0x45, 0x23, 0x0F, 0x03, 0x95, 0x0F, 0x03, 0x97, 0x0F, 0x01, 0x9B, 0x0C, 0x2B, 0x91, 0x09, 0x2B, 0x95, 0x05, 0x2B, 0x88, 0x03, 0x2B, 0x4C, 0x03, 0x3A, 0x1F,
+	0x03, 0x2A, 0x16, 0x0D, 0x2A, 0x25, 0x0D, 0x2A, 0x44, 0x0C, 0x2A, 0x43, 0x0D, 0x39, 0x32, 0x0F, 0x29, 0x32, 0x0F, 0x01, 0x69, 0x0F, 0x02, 0x59, 0x0F, 0x03, 0x39, 0x0F, 0x05, 0x29, 0x0F, 0x06,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x2B, 0x04, 0x00, 0x00, 0x2E, 0x2A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x48, 0x04, 0x2E, 0xB1, 0x04, 0xEE, 0x04, 0x7E, 0x25,
+	0x04, 0x0F, 0x2B, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x29, 0x2D, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x69,
+	0x06, 0x29, 0xC3, 0x06, 0xF9, 0x20, 0x06, 0x99, 0x26, 0x06, 0x29, 0x2D, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x2C, 0x04, 0x2C, 0x25, 0x25,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x20, 0x03, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x28, 0x2F, 0x05, 0x28, 0x26, 0x27, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x50, 0x04, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x2D, 0x0F, 0x02, 0x00, 0x00, 0x27, 0x24, 0x0F, 0x02, 0x00,
+	0x27, 0x24, 0x2B, 0x04, 0x27, 0x24, 0x3B, 0x03, 0x27, 0x24, 0x2B, 0x04, 0x27, 0x24, 0x3A, 0x04, 0x27, 0x24, 0x2A, 0x05, 0x27, 0x24, 0x39, 0x05, 0x00, 0x27, 0x24, 0x38, 0x06, 0x27, 0x24, 0x37,
+	0x07, 0x27, 0x24, 0x46, 0x07, 0x27, 0x24, 0x45, 0x08, 0x27, 0x24, 0x44, 0x09, 0x27, 0x24, 0x51, 0x0B, 0x27, 0x74, 0x0C, 0x5D, 0x0E, 0x2D, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE6, 0x0C, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x1C, 0x04, 0x0F, 0x3B, 0x03, 0x00, 0x0F, 0x2B, 0x04, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x0F, 0x38, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x64,
+	0x07, 0xF6, 0x20, 0x09, 0xE6, 0x0C, 0x0F, 0x0F, 0x02, 0x0F, 0x1B, 0x05, 0x0F, 0x2A, 0x05, 0x0F, 0x49, 0x04, 0x0F, 0x48, 0x05, 0x0F, 0x46, 0x07, 0x0F, 0x63, 0x08, 0xF6, 0x10, 0x0A, 0xC6, 0x0E,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x60, 0x05, 0xF6, 0x70, 0x04, 0x0F, 0x39, 0x05, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x0F, 0x27, 0x08, 0x0F, 0x36, 0x08,
+	0x0F, 0x35, 0x09, 0x0F, 0x34, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x14, 0x0C, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x60, 0x05, 0xF6, 0x70, 0x04, 0x0F, 0x2A, 0x05, 0x0F, 0x39, 0x05,
+	0x00, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x00, 0x0F, 0x37, 0x07, 0x00, 0x0F, 0x36, 0x08, 0x00, 0x0F, 0x35, 0x09, 0x0F, 0x34, 0x0A, 0x0F, 0x24, 0x0B, 0x0F, 0x33, 0x0B, 0x0F, 0x32, 0x0C, 0x4F,
+	0x0D, 0x0F, 0x21, 0x0E, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xF8, 0x50, 0x04, 0x00, 0x28, 0x2E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xF8, 0x50, 0x04, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x0B, 0x00, 0x2D, 0x0F, 0x02, 0x00, 0x2D, 0x2D, 0x02, 0x2D, 0x3D, 0x01, 0x2D, 0x2D, 0x02, 0x2D, 0x3C, 0x02, 0x2D, 0x2C,
+	0x03, 0x2D, 0x3B, 0x03, 0x2D, 0x3A, 0x04, 0x2D, 0x39, 0x05, 0x2D, 0x38, 0x06, 0x2D, 0x46, 0x07, 0x2D, 0x63, 0x08, 0x9D, 0x0A, 0x7D, 0x0C, 0x3D, 0x0F, 0x01, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0xA8,
+	0x0E, 0x00, 0x28, 0x0F, 0x07, 0x00, 0x28, 0x0F, 0x12, 0x04, 0x00, 0x28, 0x0F, 0x31, 0x03, 0x00, 0x28, 0x3F, 0x04, 0x00, 0x28, 0x3E, 0x05, 0x00, 0x28, 0x3D, 0x06, 0x28, 0x3C, 0x07, 0x28, 0x3B,
+	0x08, 0x28, 0x49, 0x09, 0x28, 0x57, 0x0A, 0x28, 0x83, 0x0B, 0xB8, 0x0D, 0x88, 0x0F, 0x01, 0x29, 0x0F, 0x06, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x26, 0x09, 0x2A, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0xDA, 0x09, 0x00, 0x2A, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x80, 0x03, 0x00, 0x2A, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x2A, 0x05, 0x28,
+	0x2F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xF2, 0x05, 0x00, 0x28, 0x2F, 0x05, 0x00, 0x28, 0x16, 0x28, 0x05, 0x28, 0x25, 0x28, 0x05, 0x28, 0x44, 0x27, 0x05, 0x28, 0x33,
+	0x29, 0x05, 0x28, 0x41, 0x2A, 0x05, 0x68, 0x2B, 0x05, 0x48, 0x2D, 0x05, 0x38, 0x2E, 0x05, 0x18, 0x0F, 0x21, 0x05, 0x0F, 0x2A, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x27, 0x0F, 0x08, 0x27,
+	0x26, 0x0F, 0x00, 0x27, 0x26, 0x1A, 0x04, 0x27, 0x26, 0x2A, 0x03, 0x27, 0x26, 0x39, 0x03, 0x00, 0x27, 0x26, 0x29, 0x04, 0x27, 0x26, 0x38, 0x04, 0x27, 0x26, 0x28, 0x05, 0x27, 0x26, 0x37, 0x05,
+	0x27, 0x26, 0x36, 0x06, 0x27, 0x26, 0x35, 0x07, 0x27, 0x26, 0x34, 0x08, 0x27, 0x26, 0x43, 0x08, 0x27, 0x26, 0x41, 0x0A, 0x27, 0x66, 0x0B, 0x27, 0x83, 0x0C, 0xB7, 0x0E, 0x77, 0x0F, 0x03, 0x18,
+	0x0F, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x1B, 0x05, 0x18, 0x0F, 0x32, 0x03, 0x37, 0x0F, 0x31, 0x03, 0x38, 0x3F, 0x03, 0x48, 0x2E, 0x04, 0x39, 0x3D, 0x04, 0x3A, 0x3C, 0x04, 0x3B, 0x2B,
+	0x05, 0x3C, 0x39, 0x05, 0x1D, 0x2A, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x37, 0x07, 0x00, 0x0F, 0x36, 0x08, 0x0F, 0x35, 0x09, 0x0F, 0x44, 0x09, 0x0F, 0x43, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x41, 0x0C,
+	0x4F, 0x0D, 0x5D, 0x0E, 0x4C, 0x0F, 0x01, 0x2D, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x9A, 0x0D, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x2A, 0x1F, 0x04, 0x2A, 0x2F, 0x03, 0x2A, 0x3E, 0x03,
+	0x00, 0x75, 0x2E, 0x04, 0x75, 0x3D, 0x04, 0x2A, 0x3C, 0x05, 0x2A, 0x4B, 0x05, 0x2A, 0x4A, 0x06, 0x2A, 0x49, 0x07, 0x2A, 0x48, 0x08, 0x15, 0x24, 0x56, 0x09, 0x34, 0x23, 0x63, 0x0B, 0x36, 0x91,
+	0x0D, 0x27, 0x71, 0x0F, 0x24, 0x34, 0x0F, 0x04, 0x43, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x2F, 0x2A, 0x03, 0x00, 0x2F, 0x39, 0x03, 0x2F, 0x38,
+	0x04, 0x2F, 0x46, 0x05, 0x2F, 0x45, 0x06, 0x2F, 0x61, 0x08, 0xBB, 0x0A, 0x7B, 0x0E, 0x2F, 0x2A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x66, 0x03, 0xDF, 0x04, 0x8F, 0x09, 0x0F, 0x0F, 0x02,
+	0x00, 0x00, 0x0F, 0x15, 0x0B, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x0F, 0x41, 0x0C, 0x4F, 0x0D, 0x5C, 0x2B, 0x02, 0x7A, 0x2B, 0x02, 0x2B, 0x22, 0x3A, 0x02, 0x2F, 0x39, 0x03, 0x2F, 0x38, 0x04,
+	0x2F, 0x46, 0x05, 0x2F, 0x63, 0x06, 0x9F, 0x08, 0x5F, 0x0C, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0xA9, 0x0D, 0x00, 0x29, 0x0F, 0x06, 0x00, 0x29, 0x0F, 0x12,
+	0x03, 0x00, 0x29, 0x0F, 0x31, 0x02, 0x00, 0x29, 0x0F, 0x21, 0x03, 0x29, 0x3F, 0x03, 0x29, 0x3E, 0x04, 0x00, 0x29, 0x3D, 0x05, 0x29, 0x3C, 0x06, 0x29, 0x3B, 0x07, 0x29, 0x49, 0x08, 0x15, 0x23,
+	0x57, 0x09, 0x44, 0x21, 0x83, 0x0A, 0x26, 0xB1, 0x0C, 0x17, 0x81, 0x0F, 0x14, 0x25, 0x0F, 0x05, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x26, 0x09,
+	0x2A, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x09, 0x00, 0x2A, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x80, 0x03, 0x00, 0x2A, 0x29, 0x09, 0x00, 0x25, 0x23, 0x29, 0x09, 0x36,
+	0x21, 0x29, 0x09, 0x18, 0x21, 0x29, 0x09, 0x24, 0x24, 0x29, 0x09, 0x35, 0x0F, 0x09, 0x17, 0x0F, 0x09, 0x0F, 0x0F, 0x02, 0x00, 0x0F, 0x2A, 0x05, 0x29, 0x2E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x29, 0xE2, 0x05, 0x00, 0x29, 0x2E, 0x05, 0x00, 0x29, 0x15, 0x28, 0x05, 0x29, 0x34, 0x27, 0x05, 0x00, 0x15, 0x23, 0x33, 0x28, 0x05, 0x44, 0x21, 0x41, 0x29, 0x05, 0x26, 0x61,
+	0x2A, 0x05, 0x17, 0x41, 0x2C, 0x05, 0x24, 0x33, 0x2D, 0x05, 0x44, 0x11, 0x2F, 0x05, 0x16, 0x0F, 0x23, 0x05, 0x0F, 0x0F, 0x02, 0x00, 0x28, 0x0F, 0x07, 0x28, 0x26, 0x0E, 0x00, 0x28, 0x26, 0x1A,
+	0x03, 0x28, 0x26, 0x2A, 0x02, 0x28, 0x26, 0x39, 0x02, 0x00, 0x28, 0x26, 0x29, 0x03, 0x28, 0x26, 0x38, 0x03, 0x28, 0x26, 0x28, 0x04, 0x28, 0x26, 0x37, 0x04, 0x28, 0x26, 0x36, 0x05, 0x28, 0x26,
+	0x35, 0x06, 0x28, 0x26, 0x44, 0x06, 0x28, 0x26, 0x43, 0x07, 0x28, 0x26, 0x42, 0x08, 0x14, 0x23, 0x66, 0x0A, 0x24, 0x22, 0x74, 0x0B, 0xF4, 0x0D, 0x16, 0x81, 0x0F, 0x01, 0x13, 0x34, 0x0F, 0x06,
+	0x33, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x16, 0x0F, 0x0A, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x0D, 0x6E, 0x0C, 0x00, 0x00, 0x00, 0x4F, 0x0D, 0x0F,
+	0x0F, 0x02, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0F, 0x04, 0x3B, 0x0F, 0x03, 0x4B, 0x0F, 0x02, 0x4C, 0x0F, 0x01, 0x4D, 0x0F, 0x4E, 0x0E, 0x4F, 0x0D, 0x0F, 0x42, 0x0B, 0x0F, 0x43, 0x0A, 0x0F, 0x44,
+	0x09, 0x0F, 0x55, 0x07, 0x0F, 0x36, 0x08, 0x0F, 0x18, 0x08, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0F, 0x04, 0x2C, 0x0F, 0x03, 0x4B, 0x0F, 0x02, 0x3D, 0x0F, 0x01, 0x3E,
+	0x0F, 0x4E, 0x0E, 0x4F, 0x0D, 0x0F, 0x41, 0x0C, 0x19, 0x38, 0x0B, 0x48, 0x47, 0x09, 0x3A, 0x47, 0x08, 0x1C, 0x48, 0x07, 0x27, 0x2D, 0x08, 0x47, 0x0F, 0x06, 0x39, 0x0F, 0x05, 0x1B, 0x0F, 0x05,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x90, 0x02, 0x00,
+};
+
+#else
+
+extern const uint8_t glcd28x32_packed[] =
+{
+	28,			// character width in pixels
+	32,			// row height in pixels
+	3,			// space columns between characters before kerning
+	3,			// font format: sparse packed
+	0x20, 0x00,	// lowest character code (2 bytes, little endian)
+	0x7F, 0x01,	// highest character code (2 bytes, little endian)
+
+	// Number of ranges, then the first code, last code and first glyph of each range (2 bytes each, little endian)
+	0x01, 0x00,
+	0x20, 0x00, 0x7F, 0x01, 0x00, 0x00,
+
+	// Number of edge columns (2 bytes, little endian), then the edge columns
+	0xA7, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x8F, 0x03, 0xC0, 0x7F, 0x80, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xE0, 0xFF, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0x00, 0x80, 0x33, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x03, 0x60, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x00,
+	0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x1C, 0x80, 0x33,
+	0x00, 0x1C, 0x80, 0x3F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0xC0, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0xFF, 0x1F, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+	0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x07, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0xF0, 0xFF, 0x03, 0x60, 0xFC, 0xFF, 0x03,
+	0x60, 0xFC, 0xFF, 0x1F, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x40, 0xC0, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0xFC, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x01,
+	0x00, 0x00, 0x03, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x1C, 0xFE, 0x7F, 0x00, 0x1C, 0xFF, 0x7F, 0x00, 0x18, 0x38, 0x00,
+	0x00, 0x80, 0x01, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xEC, 0x37, 0x00, 0xE0, 0xFF, 0xE0, 0xFF, 0x00, 0x83, 0x03, 0x03, 0x80, 0xC1, 0xE7, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x01, 0x03, 0x00, 0x80, 0x0F, 0x02, 0x00,
+	0x80, 0x81, 0x01, 0x00, 0x80, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x0F, 0x02,
+	0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x00, 0x20, 0xC0, 0x01, 0x00,
+	0x00, 0xF0, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC2,
+	0x00, 0x00, 0x00, 0xC3, 0x00, 0x06, 0x70, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0xC7, 0x00, 0x00, 0xE0, 0x07, 0x00,
+	0x00, 0x06, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0xC0, 0xFF, 0xFF, 0xC3, 0x60, 0xFC, 0xFF, 0xC3, 0xCC, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x00, 0x60, 0xFC, 0xFF, 0x3F, 0xCC, 0xFF, 0x7F, 0x00, 0x80, 0x01, 0x00, 0xC0, 0x00, 0x04, 0x00, 0x02,
+	0xE4, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x9B, 0xE0, 0xFF, 0xFF, 0x7B, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xC0, 0x11, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x3F,
+	0x00, 0xF0, 0xFF, 0x00, 0x30, 0xF0, 0xFF, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x9B, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x38, 0xFC, 0x01, 0x00, 0x20, 0x78, 0x00, 0x00, 0x0C, 0x03, 0x00,
+	0x00, 0x0C, 0x03, 0x03, 0xC0, 0xFF, 0x7F, 0x00, 0x30, 0xFC, 0xFF, 0x03, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x03,
+
+	// Width, leading edge and trailing edge of each glyph
+	0x0B, 0x00, 0x00, 0x03, 0x01, 0x02, 0x08, 0x03, 0x03, 0x10, 0x04, 0x05, 0x10, 0x06, 0x07, 0x18, 0x08, 0x09, 0x12, 0x0A, 0x0B, 0x02, 0x03, 0x03, 0x07, 0x0C, 0x0D, 0x07, 0x0D, 0x0C,
+	0x0B, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x02, 0x10, 0x11, 0x08, 0x12, 0x12, 0x02, 0x13, 0x13, 0x08, 0x0B, 0x14, 0x0E, 0x15, 0x15, 0x0D, 0x0B, 0x0B, 0x0E, 0x0B, 0x0B, 0x0E, 0x06, 0x16,
+	0x0E, 0x17, 0x04, 0x0E, 0x06, 0x18, 0x0D, 0x19, 0x1A, 0x0E, 0x1B, 0x1B, 0x0E, 0x16, 0x16, 0x0E, 0x1C, 0x1D, 0x02, 0x1E, 0x1E, 0x02, 0x1F, 0x20, 0x0F, 0x21, 0x22, 0x0F, 0x23, 0x23,
+	0x0F, 0x22, 0x21, 0x0E, 0x24, 0x25, 0x19, 0x26, 0x0F, 0x13, 0x27, 0x27, 0x0F, 0x28, 0x09, 0x13, 0x0F, 0x06, 0x12, 0x28, 0x29, 0x10, 0x28, 0x0B, 0x0F, 0x28, 0x1B, 0x14, 0x0F, 0x2A,
+	0x11, 0x28, 0x28, 0x03, 0x28, 0x28, 0x0D, 0x07, 0x2B, 0x10, 0x28, 0x27, 0x0D, 0x28, 0x0B, 0x13, 0x28, 0x28, 0x11, 0x28, 0x28, 0x15, 0x29, 0x2C, 0x0F, 0x28, 0x2D, 0x15, 0x29, 0x2C,
+	0x11, 0x28, 0x2E, 0x11, 0x06, 0x16, 0x11, 0x1B, 0x1B, 0x11, 0x2F, 0x2F, 0x13, 0x30, 0x30, 0x1C, 0x31, 0x31, 0x11, 0x27, 0x27, 0x11, 0x30, 0x30, 0x10, 0x13, 0x0B, 0x06, 0x32, 0x0D,
+	0x08, 0x14, 0x0B, 0x06, 0x0D, 0x32, 0x0E, 0x33, 0x33, 0x10, 0x34, 0x34, 0x06, 0x35, 0x36, 0x0F, 0x37, 0x0B, 0x0D, 0x38, 0x39, 0x0D, 0x39, 0x3A, 0x0D, 0x39, 0x38, 0x0E, 0x39, 0x3B,
+	0x08, 0x24, 0x3C, 0x0D, 0x39, 0x3D, 0x0C, 0x38, 0x3E, 0x03, 0x3F, 0x3F, 0x05, 0x34, 0x40, 0x0C, 0x38, 0x27, 0x03, 0x38, 0x38, 0x15, 0x41, 0x3E, 0x0C, 0x41, 0x3E, 0x0E, 0x39, 0x39,
+	0x0D, 0x42, 0x39, 0x0D, 0x39, 0x42, 0x08, 0x41, 0x24, 0x0D, 0x43, 0x44, 0x08, 0x24, 0x45, 0x0C, 0x46, 0x41, 0x0D, 0x0E, 0x0E, 0x15, 0x24, 0x24, 0x0B, 0x45, 0x45, 0x0D, 0x0E, 0x0E,
+	0x0C, 0x0B, 0x0B, 0x09, 0x12, 0x0D, 0x02, 0x32, 0x32, 0x09, 0x0D, 0x12, 0x0F, 0x21, 0x2C, 0x05, 0x47, 0x47, 0x03, 0x00, 0x00, 0x1A, 0x48, 0x48, 0x0C, 0x49, 0x49, 0x1A, 0x48, 0x48,
+	0x0C, 0x4A, 0x4A, 0x0E, 0x4B, 0x4B, 0x0E, 0x4C, 0x4C, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x4D, 0x4E,
+	0x0C, 0x15, 0x4F, 0x0E, 0x50, 0x51, 0x0C, 0x52, 0x52, 0x10, 0x30, 0x30, 0x02, 0x53, 0x53, 0x0C, 0x54, 0x55, 0x08, 0x49, 0x49, 0x15, 0x0F, 0x0F, 0x0B, 0x56, 0x57, 0x0E, 0x58, 0x59,
+	0x0F, 0x0F, 0x5A, 0x08, 0x12, 0x12, 0x15, 0x0F, 0x0F, 0x10, 0x5B, 0x5B, 0x08, 0x5C, 0x5C, 0x0E, 0x5D, 0x5D, 0x08, 0x5E, 0x5F, 0x08, 0x60, 0x61, 0x06, 0x36, 0x35, 0x0E, 0x42, 0x0B,
+	0x0E, 0x25, 0x30, 0x02, 0x3B, 0x3B, 0x05, 0x34, 0x62, 0x08, 0x63, 0x64, 0x0B, 0x65, 0x65, 0x0E, 0x59, 0x58, 0x16, 0x63, 0x66, 0x16, 0x63, 0x67, 0x15, 0x60, 0x66, 0x0E, 0x68, 0x69,
+	0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x13, 0x27, 0x27, 0x1B, 0x0B, 0x0B, 0x13, 0x0F, 0x06, 0x10, 0x28, 0x0B, 0x10, 0x28, 0x0B,
+	0x10, 0x28, 0x0B, 0x10, 0x28, 0x0B, 0x06, 0x6A, 0x6B, 0x06, 0x6C, 0x6A, 0x08, 0x6D, 0x6B, 0x07, 0x6D, 0x6D, 0x14, 0x0F, 0x29, 0x11, 0x28, 0x28, 0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C,
+	0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C, 0x15, 0x29, 0x2C, 0x0D, 0x6E, 0x6E, 0x15, 0x29, 0x6F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x2F, 0x2F, 0x11, 0x30, 0x30,
+	0x0F, 0x28, 0x70, 0x0F, 0x71, 0x72, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x0F, 0x37, 0x0B, 0x18, 0x73, 0x3B, 0x0D, 0x39, 0x3A,
+	0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x0E, 0x39, 0x3B, 0x06, 0x74, 0x75, 0x06, 0x75, 0x74, 0x0A, 0x75, 0x75, 0x08, 0x1B, 0x1B, 0x0E, 0x26, 0x76, 0x0C, 0x41, 0x3E,
+	0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x39, 0x39, 0x0E, 0x0F, 0x0F, 0x10, 0x27, 0x0E, 0x0C, 0x46, 0x41, 0x0C, 0x46, 0x41, 0x0C, 0x46, 0x41,
+	0x0C, 0x46, 0x41, 0x0D, 0x0E, 0x0E, 0x0D, 0x32, 0x39, 0x0D, 0x0E, 0x0E, 0x13, 0x27, 0x27, 0x0F, 0x73, 0x0B, 0x13, 0x27, 0x27, 0x0F, 0x73, 0x0B, 0x13, 0x27, 0x77, 0x0F, 0x73, 0x78,
+	0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x12, 0x70, 0x79, 0x0C, 0x7A, 0x7B, 0x11, 0x28, 0x19, 0x10, 0x7A, 0x7C,
+	0x13, 0x0F, 0x19, 0x0E, 0x7A, 0x38, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x10, 0x28, 0x78, 0x0D, 0x7D, 0x7E,
+	0x10, 0x28, 0x0B, 0x0D, 0x7D, 0x7E, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81, 0x13, 0x7F, 0x80, 0x0E, 0x7A, 0x81,
+	0x11, 0x28, 0x28, 0x0D, 0x38, 0x3E, 0x14, 0x82, 0x82, 0x0F, 0x49, 0x3E, 0x08, 0x6D, 0x6D, 0x08, 0x1B, 0x1B, 0x06, 0x83, 0x83, 0x06, 0x1B, 0x1B, 0x08, 0x84, 0x85, 0x08, 0x86, 0x87,
+	0x05, 0x62, 0x88, 0x05, 0x62, 0x89, 0x03, 0x8A, 0x8A, 0x03, 0x41, 0x41, 0x10, 0x28, 0x8B, 0x09, 0x3F, 0x8C, 0x0D, 0x06, 0x8D, 0x07, 0x8E, 0x49, 0x11, 0x28, 0x27, 0x0D, 0x38, 0x8F,
+	0x0D, 0x41, 0x8F, 0x0D, 0x28, 0x0B, 0x04, 0x90, 0x84, 0x0D, 0x28, 0x0B, 0x03, 0x91, 0x92, 0x0D, 0x28, 0x0B, 0x06, 0x38, 0x93, 0x0D, 0x28, 0x0B, 0x07, 0x38, 0x0F, 0x0F, 0x3B, 0x0B,
+	0x05, 0x94, 0x38, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x11, 0x28, 0x28, 0x0D, 0x41, 0x3E, 0x10, 0x95, 0x3E, 0x10, 0x28, 0x96, 0x0D, 0x41, 0x97,
+	0x13, 0x70, 0x19, 0x0D, 0x7A, 0x98, 0x13, 0x70, 0x19, 0x0D, 0x7A, 0x98, 0x13, 0x70, 0x19, 0x0D, 0x7A, 0x99, 0x1B, 0x70, 0x0B, 0x18, 0x7A, 0x7E, 0x12, 0x28, 0x27, 0x07, 0x41, 0x9A,
+	0x12, 0x28, 0x27, 0x06, 0x9B, 0x24, 0x12, 0x28, 0x27, 0x08, 0x74, 0x9A, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D, 0x10, 0x06, 0x9C, 0x0D, 0x66, 0x9D,
+	0x10, 0x06, 0x9C, 0x0E, 0x66, 0x9E, 0x10, 0x1B, 0x1B, 0x08, 0x24, 0x45, 0x10, 0x1B, 0x1B, 0x0A, 0x24, 0x93, 0x10, 0x1B, 0x1B, 0x08, 0x9F, 0xA0, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41,
+	0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0xA2, 0x10, 0x2F, 0xA1, 0x0D, 0x46, 0x41,
+	0x1A, 0x1B, 0xA3, 0x14, 0x24, 0xA4, 0x12, 0x30, 0x1B, 0x0D, 0x0E, 0xA5, 0x12, 0x30, 0x1B, 0x10, 0x13, 0x0B, 0x0D, 0x13, 0x0B, 0x10, 0x13, 0x0B, 0x0D, 0x13, 0x0B, 0x10, 0x13, 0x0B,
+	0x0D, 0x13, 0x0B, 0x04, 0xA6, 0x14,
+
+	// Glyph offsets (2 bytes each, little endian)
+	0x00, 0x00, 0x0D, 0x00, 0x14, 0x00, 0x24, 0x00, 0x56, 0x00, 0x85, 0x00, 0xC9, 0x00, 0x07, 0x01, 0x0B, 0x01, 0x20, 0x01, 0x35, 0x01, 0x5A, 0x01, 0x6C, 0x01, 0x73, 0x01, 0x7D, 0x01, 0x81, 0x01,
+	0x97, 0x01, 0xB8, 0x01, 0xD3, 0x01, 0x04, 0x02, 0x2C, 0x02, 0x50, 0x02, 0x79, 0x02, 0xA1, 0x02, 0xC7, 0x02, 0xF0, 0x02, 0x1A, 0x03, 0x1E, 0x03, 0x25, 0x03, 0x49, 0x03, 0x5A, 0x03, 0x7E, 0x03,
+	0xAC, 0x03, 0x0A, 0x04, 0x3F, 0x04, 0x60, 0x04, 0x8F, 0x04, 0xB3, 0x04, 0xCD, 0x04, 0xE2, 0x04, 0x1B, 0x05, 0x31, 0x05, 0x36, 0x05, 0x5A, 0x05, 0x85, 0x05, 0x96, 0x05, 0xC3, 0x05, 0xEB, 0x05,
+	0x1B, 0x06, 0x35, 0x06, 0x76, 0x06, 0x9A, 0x06, 0xD1, 0x06, 0xE8, 0x06, 0x11, 0x07, 0x44, 0x07, 0x8E, 0x07, 0xBE, 0x07, 0xEC, 0x07, 0x25, 0x08, 0x2E, 0x08, 0x44, 0x08, 0x4D, 0x08, 0x75, 0x08,
+	0x86, 0x08, 0x98, 0x08, 0xC4, 0x08, 0xE2, 0x08, 0x00, 0x09, 0x1E, 0x09, 0x44, 0x09, 0x55, 0x09, 0x79, 0x09, 0x8F, 0x09, 0x95, 0x09, 0xA3, 0x09, 0xC3, 0x09, 0xC8, 0x09, 0xF8, 0x09, 0x11, 0x0A,
+	0x2F, 0x0A, 0x4C, 0x0A, 0x69, 0x0A, 0x7A, 0x0A, 0xA2, 0x0A, 0xB1, 0x0A, 0xC8, 0x0A, 0xEB, 0x0A, 0x22, 0x0B, 0x41, 0x0B, 0x65, 0x0B, 0x8E, 0x0B, 0xA3, 0x0B, 0xA6, 0x0B, 0xBB, 0x0B, 0xD4, 0x0B,
+	0xE0, 0x0B, 0xE5, 0x0B, 0x0F, 0x0C, 0x31, 0x0C, 0x5B, 0x0C, 0x7D, 0x0C, 0xAD, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C,
+	0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C, 0xD7, 0x0C,
+	0xD7, 0x0C, 0xDA, 0x0C, 0xE1, 0x0C, 0x00, 0x0D, 0x27, 0x0D, 0x45, 0x0D, 0x7C, 0x0D, 0x7F, 0x0D, 0xB3, 0x0D, 0xC1, 0x0D, 0x06, 0x0E, 0x2A, 0x0E, 0x54, 0x0E, 0x73, 0x01, 0x65, 0x0E, 0xA8, 0x0E,
+	0xBA, 0x0E, 0xCF, 0x0E, 0xE3, 0x0E, 0xFF, 0x0E, 0x17, 0x0F, 0x27, 0x0F, 0x45, 0x0F, 0x61, 0x0F, 0x65, 0x0F, 0x70, 0x0F, 0x81, 0x0F, 0x9F, 0x0F, 0xC9, 0x0F, 0x0B, 0x10, 0x56, 0x10, 0x9B, 0x10,
+	0xC9, 0x10, 0x04, 0x11, 0x3F, 0x11, 0x7D, 0x11, 0xBC, 0x11, 0xF5, 0x11, 0x30, 0x12, 0x69, 0x12, 0xA2, 0x12, 0xCF, 0x12, 0xFC, 0x12, 0x39, 0x13, 0x61, 0x13, 0x74, 0x13, 0x84, 0x13, 0x9C, 0x13,
+	0xA9, 0x13, 0xD3, 0x13, 0x03, 0x14, 0x44, 0x14, 0x81, 0x14, 0xC5, 0x14, 0x02, 0x15, 0x3B, 0x15, 0x5F, 0x15, 0xA6, 0x15, 0xDA, 0x15, 0x0E, 0x16, 0x48, 0x16, 0x79, 0x16, 0xAD, 0x16, 0xC6, 0x16,
+	0xF8, 0x16, 0x2D, 0x17, 0x62, 0x17, 0x9B, 0x17, 0xCF, 0x17, 0xFF, 0x17, 0x39, 0x18, 0x7A, 0x18, 0x9D, 0x18, 0xD2, 0x18, 0x07, 0x19, 0x3C, 0x19, 0x69, 0x19, 0x7E, 0x19, 0x93, 0x19, 0xB1, 0x19,
+	0xC1, 0x19, 0xF0, 0x19, 0x15, 0x1A, 0x3F, 0x1A, 0x69, 0x1A, 0x94, 0x1A, 0xBE, 0x1A, 0xE2, 0x1A, 0xF5, 0x1A, 0x27, 0x1B, 0x4A, 0x1B, 0x6C, 0x1B, 0x92, 0x1B, 0xAF, 0x1B, 0xD5, 0x1B, 0xF2, 0x1B,
+	0x19, 0x1C, 0x56, 0x1C, 0x89, 0x1C, 0xC7, 0x1C, 0xFF, 0x1C, 0x35, 0x1D, 0x62, 0x1D, 0xA0, 0x1D, 0xC7, 0x1D, 0x08, 0x1E, 0x32, 0x1E, 0x65, 0x1E, 0x83, 0x1E, 0xC4, 0x1E, 0xEE, 0x1E, 0x2B, 0x1F,
+	0x4F, 0x1F, 0x77, 0x1F, 0x99, 0x1F, 0xB7, 0x1F, 0xDF, 0x1F, 0x12, 0x20, 0x3F, 0x20, 0x5D, 0x20, 0x84, 0x20, 0xA7, 0x20, 0xD3, 0x20, 0x0E, 0x21, 0x43, 0x21, 0x8B, 0x21, 0xBF, 0x21, 0x03, 0x22,
+	0x34, 0x22, 0x6F, 0x22, 0x9A, 0x22, 0xD8, 0x22, 0x07, 0x23, 0x3B, 0x23, 0x64, 0x23, 0x83, 0x23, 0xA7, 0x23, 0xBD, 0x23, 0xD3, 0x23, 0xE0, 0x23, 0xED, 0x23, 0x02, 0x24, 0x17, 0x24, 0x23, 0x24,
+	0x31, 0x24, 0x37, 0x24, 0x3C, 0x24, 0x67, 0x24, 0x7C, 0x24, 0xAD, 0x24, 0xC4, 0x24, 0xF3, 0x24, 0x16, 0x25, 0x37, 0x25, 0x57, 0x25, 0x66, 0x25, 0x81, 0x25, 0x8C, 0x25, 0xA6, 0x25, 0xB5, 0x25,
+	0xCA, 0x25, 0xD6, 0x25, 0xF3, 0x25, 0xFE, 0x25, 0x2B, 0x26, 0x52, 0x26, 0x7C, 0x26, 0x9C, 0x26, 0xCC, 0x26, 0xF8, 0x26, 0x1D, 0x27, 0x46, 0x27, 0x63, 0x27, 0x91, 0x27, 0xB2, 0x27, 0xED, 0x27,
+	0x12, 0x28, 0x54, 0x28, 0x7E, 0x28, 0xAE, 0x28, 0xE9, 0x28, 0x1E, 0x29, 0x33, 0x29, 0x62, 0x29, 0x74, 0x29, 0xB0, 0x29, 0xCF, 0x29, 0x0F, 0x2A, 0x43, 0x2A, 0x86, 0x2A, 0xBD, 0x2A, 0xF9, 0x2A,
+	0x27, 0x2B, 0x6A, 0x2B, 0xA4, 0x2B, 0xC0, 0x2B, 0xD8, 0x2B, 0x07, 0x2C, 0x1E, 0x2C, 0x38, 0x2C, 0x49, 0x2C, 0x7C, 0x2C, 0xA3, 0x2C, 0xCE, 0x2C, 0xED, 0x2C, 0x1F, 0x2D, 0x43, 0x2D, 0x74, 0x2D,
+	0x97, 0x2D, 0xCF, 0x2D, 0xF6, 0x2D, 0x25, 0x2E, 0x46, 0x2E, 0x93, 0x2E, 0xCE, 0x2E, 0x08, 0x2F, 0x30, 0x2F, 0x65, 0x2F, 0xA5, 0x2F, 0xD8, 0x2F, 0x15, 0x30, 0x45, 0x30, 0x88, 0x30, 0xBE, 0x30,
+
+	// Glyphs
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x33, 0x06, 0x00, 0x96, 0x38, 0x06, 0x66, 0x0F, 0x05, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x56, 0x0F, 0x06,
+	0x66, 0x0F, 0x05, 0x00, 0x0F, 0x24, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x26, 0x32, 0x06, 0x2B, 0x75, 0x07, 0xAB, 0x0B, 0x88, 0x23, 0x0B, 0x46, 0x21, 0x26, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x26, 0x14,
+	0x06, 0x2B, 0x76, 0x06, 0x2B, 0x83, 0x08, 0xBA, 0x0B, 0x76, 0x26, 0x0B, 0x36, 0x22, 0x26, 0x0B, 0x2B, 0x26, 0x0B, 0x2B, 0x0F, 0x04, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x68, 0x56, 0x07, 0x87,
+	0x37, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x00, 0xF4, 0x90, 0x04, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x36, 0x36, 0x35, 0x06, 0x37, 0x36, 0x24, 0x07, 0x38, 0x95, 0x07, 0x29,
+	0x76, 0x08, 0x0F, 0x15, 0x0B, 0x69, 0x0F, 0x02, 0xA7, 0x0F, 0x36, 0x36, 0x0E, 0x26, 0x28, 0x0E, 0x00, 0x26, 0x28, 0x26, 0x06, 0x36, 0x36, 0x35, 0x06, 0xA7, 0x44, 0x07, 0x78, 0x35, 0x09, 0x0F,
+	0x33, 0x0B, 0x0F, 0x32, 0x0C, 0x3F, 0x0E, 0x3E, 0x0F, 0x3C, 0x0F, 0x02, 0x3B, 0x0F, 0x03, 0x39, 0x84, 0x08, 0x38, 0xA4, 0x07, 0x36, 0x35, 0x36, 0x06, 0x26, 0x26, 0x28, 0x06, 0x2E, 0x28, 0x06,
+	0x00, 0x3E, 0x36, 0x06, 0xAF, 0x07, 0x0F, 0x62, 0x09, 0x0F, 0x53, 0x09, 0x0F, 0x72, 0x08, 0x0F, 0x41, 0x41, 0x07, 0x3F, 0x35, 0x06, 0x68, 0x21, 0x27, 0x06, 0xA7, 0x27, 0x06, 0x36, 0x54, 0x26,
+	0x06, 0x26, 0x65, 0x25, 0x06, 0x26, 0x25, 0x42, 0x23, 0x06, 0x26, 0x34, 0x34, 0x21, 0x07, 0x36, 0x23, 0x56, 0x07, 0x67, 0x38, 0x08, 0x48, 0x67, 0x07, 0x0F, 0x52, 0x31, 0x06, 0x5F, 0x24, 0x06,
+	0x2F, 0x27, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x66, 0x0F, 0x05, 0x00, 0xBD, 0x08, 0xFA, 0x20, 0x05, 0x89, 0x83, 0x04, 0x57, 0x5D, 0x02, 0x46, 0x0F, 0x42, 0x01, 0x35, 0x0F, 0x36, 0x25, 0x0F, 0x28,
+	0x25, 0x0F, 0x28, 0x35, 0x0F, 0x36, 0x46, 0x0F, 0x42, 0x01, 0x57, 0x5D, 0x02, 0x89, 0x83, 0x04, 0xFA, 0x20, 0x05, 0xBD, 0x08, 0x1A, 0x0F, 0x06, 0x29, 0x0F, 0x06, 0x29, 0x13, 0x0F, 0x02, 0x1A,
+	0x32, 0x0F, 0x01, 0x4A, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0x4A, 0x0F, 0x03, 0x1A, 0x32, 0x0F, 0x01, 0x29, 0x13, 0x0F, 0x02, 0x29, 0x0F, 0x06, 0x1A, 0x0F, 0x06, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE9, 0x09, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x38, 0x22, 0x02, 0x0F, 0x78, 0x02, 0x0F, 0x22, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x38, 0x06,
+	0x00, 0x0F, 0x29, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x82, 0x07, 0x9D, 0x0A, 0x8A, 0x0E, 0x86, 0x0F, 0x03, 0x65, 0x0F, 0x06, 0x25, 0x0F, 0x0A, 0x8C, 0x0C, 0xE9, 0x09, 0xF8, 0x10, 0x08, 0x37, 0x3C,
+	0x07, 0x36, 0x3E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x36, 0x3E, 0x06, 0x37, 0x4B, 0x07, 0xF8, 0x10, 0x08, 0xE9, 0x09, 0x8C, 0x0C, 0x0F, 0x29, 0x06, 0x29, 0x2D, 0x06, 0x38, 0x2D,
+	0x06, 0x37, 0x2E, 0x06, 0x27, 0x2F, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x29, 0x4B, 0x06, 0x47, 0x5A, 0x06, 0x37, 0x6A, 0x06, 0x36,
+	0x3A, 0x22, 0x06, 0x26, 0x3A, 0x23, 0x06, 0x26, 0x39, 0x24, 0x06, 0x26, 0x29, 0x25, 0x06, 0x26, 0x28, 0x26, 0x06, 0x36, 0x36, 0x26, 0x06, 0x37, 0x43, 0x27, 0x06, 0x97, 0x28, 0x06, 0x68, 0x2A,
+	0x06, 0x0F, 0x29, 0x06, 0x0F, 0x16, 0x0A, 0x38, 0x49, 0x08, 0x47, 0x59, 0x07, 0x37, 0x2D, 0x07, 0x36, 0x3E, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36, 0x45, 0x35, 0x06, 0x47, 0x31,
+	0x31, 0x24, 0x07, 0x87, 0x82, 0x07, 0x68, 0x73, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x33, 0x0B, 0x0F, 0x51, 0x0B, 0x3F, 0x21, 0x0B, 0x3E, 0x22, 0x0B, 0x4C, 0x23, 0x0B, 0x3B, 0x25, 0x0B, 0x49, 0x26,
+	0x0B, 0x38, 0x28, 0x0B, 0x46, 0x29, 0x0B, 0xF6, 0x50, 0x06, 0x00, 0x0F, 0x24, 0x0B, 0x00, 0x00, 0x0F, 0x16, 0x0A, 0xA6, 0x35, 0x08, 0xA6, 0x45, 0x07, 0x66, 0x22, 0x27, 0x07, 0x26, 0x26, 0x37,
+	0x06, 0x26, 0x25, 0x29, 0x06, 0x00, 0x00, 0x00, 0x26, 0x35, 0x37, 0x06, 0x26, 0x36, 0x35, 0x07, 0x26, 0xB6, 0x07, 0x26, 0x97, 0x08, 0x0F, 0x52, 0x0A, 0xCA, 0x0A, 0xF8, 0x10, 0x08, 0x57, 0x23,
+	0x44, 0x07, 0x27, 0x25, 0x27, 0x07, 0x36, 0x24, 0x29, 0x06, 0x26, 0x25, 0x29, 0x06, 0x00, 0x00, 0x36, 0x34, 0x37, 0x06, 0x37, 0x34, 0x35, 0x07, 0x37, 0xB4, 0x07, 0x28, 0x95, 0x08, 0x0F, 0x42,
+	0x0B, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x26, 0x4E, 0x06, 0x26, 0x8A, 0x06, 0x26, 0xA8, 0x06, 0x26, 0x66, 0x0C, 0x26, 0x54, 0x0F, 0x26, 0x52, 0x0F, 0x02, 0x26, 0x41, 0x0F, 0x04, 0x56, 0x0F,
+	0x06, 0x46, 0x0F, 0x07, 0x26, 0x0F, 0x09, 0x0F, 0x34, 0x0A, 0x68, 0x73, 0x08, 0x87, 0x82, 0x07, 0x37, 0x53, 0x25, 0x07, 0x36, 0x45, 0x35, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36,
+	0x45, 0x26, 0x06, 0x37, 0x53, 0x25, 0x07, 0x87, 0x82, 0x07, 0x68, 0x73, 0x08, 0x0F, 0x34, 0x0A, 0x3B, 0x0F, 0x03, 0x98, 0x25, 0x08, 0xB7, 0x34, 0x07, 0x37, 0x35, 0x34, 0x07, 0x36, 0x37, 0x34,
+	0x06, 0x26, 0x29, 0x25, 0x06, 0x00, 0x00, 0x26, 0x29, 0x34, 0x06, 0x36, 0x27, 0x25, 0x07, 0x47, 0x24, 0x44, 0x07, 0xF8, 0x10, 0x08, 0xD9, 0x0A, 0x5D, 0x0E, 0x3A, 0x3A, 0x06, 0x00, 0x3A, 0x3A,
+	0x22, 0x02, 0x3A, 0x7A, 0x02, 0x3F, 0x0E, 0x00, 0x2E, 0x21, 0x0D, 0x00, 0x3D, 0x31, 0x0C, 0x2D, 0x23, 0x0C, 0x3C, 0x33, 0x0B, 0x2C, 0x25, 0x0B, 0x00, 0x2B, 0x27, 0x0A, 0x00, 0x3A, 0x37, 0x09,
+	0x2A, 0x29, 0x09, 0x39, 0x39, 0x08, 0x29, 0x2B, 0x08, 0x2C, 0x25, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x2B, 0x08, 0x39, 0x39, 0x08,
+	0x2A, 0x29, 0x09, 0x3A, 0x28, 0x09, 0x2B, 0x27, 0x0A, 0x00, 0x2C, 0x25, 0x0B, 0x00, 0x3C, 0x33, 0x0B, 0x2D, 0x23, 0x0C, 0x3D, 0x31, 0x0C, 0x2E, 0x21, 0x0D, 0x00, 0x3F, 0x0E, 0x00, 0x2A, 0x0F,
+	0x05, 0x48, 0x0F, 0x05, 0x57, 0x0F, 0x05, 0x37, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x26, 0x1B, 0x33, 0x06, 0x26, 0x39, 0x33, 0x06, 0x26, 0x48, 0x33, 0x06, 0x26, 0x37, 0x0E, 0x26, 0x27, 0x0F, 0x27,
+	0x25, 0x0F, 0x01, 0x97, 0x0F, 0x01, 0x78, 0x0F, 0x02, 0x49, 0x0F, 0x04, 0x0F, 0x61, 0x0A, 0xCD, 0x07, 0x5B, 0x55, 0x06, 0x3A, 0x3B, 0x05, 0x39, 0x3D, 0x04, 0x28, 0x0F, 0x31, 0x03, 0x27, 0x86,
+	0x24, 0x03, 0x36, 0xB4, 0x23, 0x03, 0x26, 0x44, 0x36, 0x23, 0x02, 0x26, 0x33, 0x29, 0x23, 0x02, 0x25, 0x33, 0x2A, 0x23, 0x02, 0x25, 0x23, 0x2B, 0x23, 0x02, 0x25, 0x23, 0x2A, 0x24, 0x02, 0x00,
+	0x25, 0x23, 0x38, 0x25, 0x02, 0x25, 0x24, 0x65, 0x33, 0x02, 0x25, 0xD5, 0x22, 0x03, 0x35, 0xA2, 0x32, 0x22, 0x03, 0x26, 0x52, 0x28, 0x31, 0x03, 0x36, 0x11, 0x2C, 0x21, 0x04, 0x37, 0x2C, 0x08,
+	0x38, 0x3A, 0x08, 0x59, 0x63, 0x09, 0xAB, 0x0B, 0x2F, 0x0F, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C,
+	0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x77, 0x24, 0x0C, 0x6A, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x26, 0x26, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x34, 0x28, 0x06, 0x37, 0x52, 0x36, 0x06, 0x77, 0x31, 0x34, 0x07, 0x58, 0x93, 0x07, 0x0F, 0x62, 0x09,
+	0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x47, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3E, 0x06,
+	0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x39, 0x38, 0x09, 0x0F, 0x16, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3E,
+	0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x4E, 0x0E, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+	0x0F, 0x09, 0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x28, 0x26,
+	0x06, 0x00, 0x36, 0x27, 0x26, 0x06, 0x27, 0x27, 0x35, 0x06, 0x37, 0x26, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x48, 0x84, 0x08, 0x1A, 0x85, 0x08, 0x0F, 0x71, 0x09, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x15, 0x0B, 0x0F, 0x35, 0x09, 0x0F, 0x55, 0x07, 0x0F,
+	0x37, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x2F, 0x07, 0xF6, 0x40, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x10, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F,
+	0x21, 0x0E, 0x3E, 0x0F, 0x3D, 0x0F, 0x01, 0x5C, 0x0F, 0x3B, 0x41, 0x0D, 0x3A, 0x43, 0x0C, 0x39, 0x45, 0x0B, 0x38, 0x38, 0x0A, 0x37, 0x4A, 0x08, 0x36, 0x4C, 0x07, 0x26, 0x4E, 0x06, 0x16, 0x0F,
+	0x31, 0x06, 0x0F, 0x1A, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x66, 0x0F, 0x05, 0x68, 0x0F,
+	0x03, 0x6B, 0x0F, 0x6E, 0x0C, 0x0F, 0x71, 0x09, 0x0F, 0x74, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x62, 0x09, 0x6E, 0x0C, 0x6B, 0x0F, 0x68, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x49, 0x0F, 0x04, 0x4B, 0x0F, 0x02, 0x5C, 0x0F, 0x4E, 0x0E, 0x5F, 0x0C, 0x0F, 0x42, 0x0B, 0x0F, 0x44, 0x09,
+	0x0F, 0x55, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06,
+	0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x0E, 0x37, 0x34, 0x0F, 0xA7, 0x0F, 0x78, 0x0F, 0x02, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x4A,
+	0x07, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x0F, 0x41, 0x04, 0x26, 0x0F, 0x51, 0x03, 0x26, 0x0F, 0x61, 0x02, 0x26, 0x0F, 0x21, 0x32, 0x01,
+	0x27, 0x2E, 0x24, 0x01, 0x37, 0x3C, 0x24, 0x01, 0x38, 0x3A, 0x25, 0x01, 0x58, 0x56, 0x25, 0x01, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x26, 0x48, 0x0C, 0x26, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x54, 0x06, 0x88, 0x37, 0x06, 0x4A, 0x2A, 0x06, 0x0F, 0x16, 0x0A, 0x49, 0x28, 0x09,
+	0x68, 0x46, 0x08, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x26, 0x36, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x37, 0x26, 0x06,
+	0x36, 0x36, 0x25, 0x07, 0x47, 0x35, 0x33, 0x07, 0x38, 0x95, 0x07, 0x29, 0x76, 0x08, 0x0F, 0x34, 0x0A, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26,
+	0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0x38, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0x16, 0x0F, 0x0A, 0x36, 0x0F, 0x08, 0x66, 0x0F, 0x05, 0x77, 0x0F, 0x03, 0x7A, 0x0F, 0x6D,
+	0x0D, 0x7F, 0x0A, 0x0F, 0x73, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x73, 0x07, 0x7F, 0x0A, 0x6D, 0x0D, 0x7A, 0x0F, 0x77, 0x0F, 0x03, 0x66, 0x0F, 0x05, 0x36, 0x0F,
+	0x08, 0x16, 0x0F, 0x0A, 0x46, 0x0F, 0x07, 0x76, 0x0F, 0x04, 0x88, 0x0F, 0x01, 0x8B, 0x0D, 0x8E, 0x0A, 0x0F, 0x82, 0x07, 0x0F, 0x65, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x81, 0x08,
+	0x8D, 0x0B, 0x8A, 0x0E, 0x87, 0x0F, 0x02, 0x56, 0x0F, 0x06, 0x00, 0x77, 0x0F, 0x03, 0x8A, 0x0E, 0x8D, 0x0B, 0x0F, 0x81, 0x08, 0x0F, 0x74, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x82,
+	0x07, 0x8E, 0x0A, 0x8B, 0x0D, 0x88, 0x0F, 0x01, 0x76, 0x0F, 0x04, 0x46, 0x0F, 0x07, 0x0F, 0x1A, 0x06, 0x26, 0x3F, 0x06, 0x36, 0x4D, 0x06, 0x56, 0x4A, 0x07, 0x48, 0x47, 0x09, 0x49, 0x45, 0x0A,
+	0x4B, 0x41, 0x0C, 0x7C, 0x0D, 0x3E, 0x0F, 0x7C, 0x0D, 0x4B, 0x41, 0x0C, 0x4A, 0x53, 0x0A, 0x48, 0x47, 0x09, 0x47, 0x59, 0x07, 0x36, 0x4D, 0x06, 0x26, 0x3F, 0x06, 0x0F, 0x1A, 0x06, 0x16, 0x0F,
+	0x0A, 0x36, 0x0F, 0x08, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x59, 0x0F, 0x03, 0x4B, 0x0F, 0x02, 0x5C, 0x0F, 0xCE, 0x06, 0xBF, 0x06, 0xCE, 0x06, 0x5C, 0x0F, 0x4B, 0x0F, 0x02, 0x59, 0x0F, 0x03,
+	0x57, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x16, 0x0F, 0x0A, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x3C, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23,
+	0x06, 0x26, 0x38, 0x25, 0x06, 0x26, 0x46, 0x26, 0x06, 0x26, 0x45, 0x27, 0x06, 0x26, 0x44, 0x28, 0x06, 0x26, 0x42, 0x2A, 0x06, 0x26, 0x41, 0x2B, 0x06, 0x66, 0x2C, 0x06, 0x46, 0x2E, 0x06, 0x36,
+	0x2F, 0x06, 0x0F, 0x29, 0x06, 0xF5, 0xC0, 0x00, 0x00, 0x25, 0x0F, 0x28, 0x00, 0x00, 0x25, 0x0F, 0x0A, 0x65, 0x0F, 0x06, 0x86, 0x0F, 0x03, 0x8A, 0x0E, 0x9D, 0x0A, 0x0F, 0x82, 0x07, 0x0F, 0x56,
+	0x06, 0x0F, 0x29, 0x06, 0x25, 0x0F, 0x28, 0x00, 0x00, 0xF5, 0xC0, 0x00, 0x00, 0x1F, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x4C, 0x0F, 0x01, 0x4A, 0x0F, 0x03, 0x48, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x26,
+	0x0F, 0x09, 0x00, 0x46, 0x0F, 0x07, 0x48, 0x0F, 0x05, 0x4A, 0x0F, 0x03, 0x4C, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x1F, 0x0F, 0x01, 0x0F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0F, 0x0B, 0x25, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x27, 0x0F, 0x08, 0x18, 0x0F, 0x08, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93,
+	0x06, 0x3B, 0x23, 0x34, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x24, 0x08, 0xDB, 0x08, 0xFB, 0x06, 0xDD, 0x06,
+	0x0F, 0x29, 0x06, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C, 0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08,
+	0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4B, 0x37, 0x07, 0x3C, 0x36, 0x08, 0x2D, 0x26, 0x09,
+	0x6F, 0x0B, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x1B, 0x1C, 0x07, 0x2B, 0x2A, 0x07, 0x4D, 0x42, 0x09, 0xF5, 0x60, 0x06, 0x00, 0x6F, 0x0B,
+	0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23,
+	0x08, 0x0F, 0x31, 0x0D, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0xF6, 0x50, 0x06, 0xF5, 0x60, 0x06, 0x25, 0x23, 0x0F, 0x05, 0x00, 0x00, 0x6F, 0x0B, 0xCC, 0x24, 0x02, 0xEB, 0x33, 0x01, 0x4A, 0x48, 0x32,
+	0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C, 0x24, 0x00, 0x00, 0x2B, 0x2A, 0x25, 0x3B, 0x28, 0x35, 0x4D, 0x42, 0x53, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x40, 0x03, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x2B, 0x0F,
+	0x04, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x5A, 0x0F, 0x02, 0xFB, 0x06, 0xEC, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x2F, 0x00, 0x25, 0xF3, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x25,
+	0xF3, 0x40, 0x03, 0xF5, 0x60, 0x06, 0x00, 0x0F, 0x23, 0x0C, 0x0F, 0x31, 0x0D, 0x4F, 0x0D, 0x7E, 0x0B, 0x3D, 0x42, 0x0A, 0x3C, 0x54, 0x08, 0x4A, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x1A, 0x2D, 0x06,
+	0x0F, 0x1A, 0x06, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x1C, 0x0F, 0x04, 0x1B, 0x0F, 0x05, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB,
+	0x06, 0xDD, 0x06, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x2B, 0x0F,
+	0x04, 0x1B, 0x0F, 0x05, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x5A, 0x0F, 0x02, 0xFB, 0x06, 0xEC, 0x06, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06,
+	0x00, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0xFA, 0x70, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C, 0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00,
+	0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08, 0x6F, 0x0B, 0x6F, 0x0B, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x1B, 0x2B, 0x07,
+	0x2B, 0x2A, 0x07, 0x4D, 0x42, 0x09, 0xFA, 0x70, 0x00, 0xFA, 0x10, 0x06, 0x00, 0xDD, 0x06, 0x3B, 0x0F, 0x03, 0x3A, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x1E, 0x27, 0x08, 0x5C, 0x35, 0x07,
+	0x7B, 0x25, 0x07, 0x3A, 0x32, 0x35, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x34, 0x33, 0x06, 0x3B, 0x74, 0x07, 0x2C, 0x74, 0x07, 0x1D,
+	0x36, 0x09, 0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x08, 0xF7, 0x40, 0x06, 0x00, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x28,
+	0x07, 0x00, 0xDA, 0x09, 0xFA, 0x10, 0x06, 0x00, 0x1A, 0x0F, 0x06, 0x5A, 0x0F, 0x02, 0x8A, 0x0E, 0x8D, 0x0B, 0x0F, 0x91, 0x07, 0x0F, 0x65, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x81,
+	0x08, 0x8D, 0x0B, 0x8A, 0x0E, 0x5A, 0x0F, 0x02, 0x1A, 0x0F, 0x06, 0x2A, 0x0F, 0x05, 0x6A, 0x0F, 0x01, 0x9A, 0x0D, 0x9E, 0x09, 0x0F, 0x83, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x56, 0x06, 0x0F, 0x82,
+	0x07, 0x8D, 0x0B, 0x7A, 0x0F, 0x2A, 0x0F, 0x05, 0x7A, 0x0F, 0x8D, 0x0B, 0x0F, 0x82, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x83, 0x06, 0x9E, 0x09, 0x9A, 0x0D, 0x6A, 0x0F, 0x01, 0x2A,
+	0x0F, 0x05, 0x2A, 0x2C, 0x06, 0x3A, 0x49, 0x06, 0x5A, 0x55, 0x07, 0x5C, 0x42, 0x09, 0x7E, 0x0B, 0x0F, 0x31, 0x0D, 0x7E, 0x0B, 0x5C, 0x42, 0x09, 0x5A, 0x55, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C,
+	0x06, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x8C, 0x39, 0x0F, 0x71, 0x35, 0x01, 0x0F, 0xC4, 0x01, 0x0F, 0x68, 0x03, 0x0F, 0x75, 0x05, 0x0F, 0x81, 0x08, 0x8D, 0x0B, 0x8A, 0x0E, 0x4A,
+	0x0F, 0x03, 0x1A, 0x0F, 0x06, 0x0F, 0x29, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47, 0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x2A, 0x54, 0x23, 0x06, 0x2A, 0x43, 0x25, 0x06, 0x2A, 0x51,
+	0x26, 0x06, 0x6A, 0x28, 0x06, 0x5A, 0x29, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x22, 0x0D, 0x00, 0x0F, 0x41, 0x0C, 0x6F, 0x0B, 0xB6, 0xC2, 0x01, 0xB5, 0xC4, 0x35, 0x0F, 0x36, 0x25,
+	0x0F, 0x28, 0x00, 0xF5, 0xC0, 0x00, 0x25, 0x0F, 0x28, 0x00, 0x00, 0x35, 0x0F, 0x36, 0xC5, 0xC3, 0xB6, 0xD1, 0x01, 0x6F, 0x0B, 0x0F, 0x32, 0x0C, 0x0F, 0x22, 0x0D, 0x3F, 0x0E, 0x2F, 0x0F, 0x2E,
+	0x0F, 0x01, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0x2F, 0x0F, 0x00, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0x3E, 0x0F, 0xF7, 0x30, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x00, 0x00, 0xF7, 0x30, 0x07,
+	0x0F, 0x0F, 0x02, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x4F, 0x0D, 0x6E, 0x0C, 0x8D, 0x0B, 0x3C, 0x21, 0x31, 0x0A, 0x3B, 0x22, 0x32, 0x09, 0x1B, 0x24, 0x14, 0x09, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x0F, 0x08, 0x26, 0x0F, 0x09, 0x35, 0x0F, 0x09, 0x34, 0x0F, 0x0A, 0x33, 0x0F, 0x0B, 0xF2, 0xC0,
+	0x03, 0x00, 0x33, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x27, 0x0F, 0x08, 0x0F, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x24, 0x14, 0x09, 0x3B, 0x22, 0x32, 0x09, 0x3C, 0x21, 0x31, 0x0A, 0x8D, 0x0B, 0x6E, 0x0C, 0x4F, 0x0D, 0x0F, 0x21, 0x0E, 0x0F, 0x28, 0x07, 0x0F, 0x29,
+	0x06, 0x0F, 0x39, 0x05, 0x0F, 0x3A, 0x04, 0x0F, 0x3B, 0x03, 0xF2, 0xD0, 0x02, 0x00, 0x0F, 0x3B, 0x03, 0x0F, 0x3A, 0x04, 0x0F, 0x39, 0x05, 0x0F, 0x29, 0x06, 0x0F, 0x28, 0x07, 0x18, 0x1E, 0x08,
+	0x27, 0x2E, 0x07, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x23, 0x05, 0x24, 0x0F, 0x25, 0x04, 0x23, 0x0F, 0x27, 0x03, 0xF2, 0xD0, 0x02, 0x00, 0x23, 0x0F, 0x27, 0x03, 0x24, 0x0F, 0x25, 0x04, 0x25,
+	0x0F, 0x23, 0x05, 0x26, 0x0F, 0x21, 0x06, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x17, 0x0F, 0x11, 0x07, 0x27, 0x2E, 0x07, 0x28, 0x2C, 0x08, 0x29, 0x2A, 0x09, 0x2A, 0x28, 0x0A, 0x2B, 0x26, 0x0B,
+	0xC2, 0xC4, 0x02, 0x00, 0x2B, 0x26, 0x0B, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x28, 0x2C, 0x08, 0x27, 0x2E, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x0F, 0x0F, 0x02, 0x3A, 0xE4, 0x01, 0x3A, 0xF3, 0x01,
+	0x00, 0x8C, 0x0C, 0xCA, 0x0A, 0xE9, 0x09, 0x29, 0x39, 0x09, 0x28, 0x2C, 0x08, 0x00, 0x46, 0x4C, 0x06, 0x28, 0x2C, 0x08, 0x38, 0x3A, 0x08, 0x39, 0x38, 0x09, 0x49, 0x46, 0x09, 0x2B, 0x36, 0x0A,
+	0x2F, 0x27, 0x06, 0x2F, 0x36, 0x06, 0xFA, 0x10, 0x06, 0xF8, 0x21, 0x06, 0xF7, 0x22, 0x06, 0x36, 0x26, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x36, 0x26, 0x27, 0x06, 0x37, 0x3D,
+	0x06, 0x28, 0x4B, 0x07, 0x0F, 0x36, 0x08, 0x2A, 0x61, 0x21, 0x0A, 0xCA, 0x0A, 0x3B, 0x34, 0x0B, 0x2B, 0x26, 0x0B, 0x2A, 0x28, 0x0A, 0x00, 0x00, 0x00, 0x2B, 0x26, 0x0B, 0x3B, 0x34, 0x0B, 0xCA,
+	0x0A, 0x2A, 0x61, 0x21, 0x0A, 0x16, 0x0F, 0x0A, 0x36, 0x27, 0x22, 0x0A, 0x46, 0x26, 0x22, 0x0A, 0x57, 0x24, 0x22, 0x0A, 0x59, 0x22, 0x22, 0x0A, 0x4B, 0x21, 0x22, 0x0A, 0x5D, 0x22, 0x0A, 0xCE,
+	0x06, 0x00, 0x5D, 0x22, 0x0A, 0x4B, 0x21, 0x22, 0x0A, 0x59, 0x22, 0x22, 0x0A, 0x57, 0x24, 0x22, 0x0A, 0x46, 0x26, 0x22, 0x0A, 0x36, 0x27, 0x22, 0x0A, 0x16, 0x0F, 0x0A, 0xB5, 0xB5, 0x00, 0x28,
+	0x35, 0x26, 0x06, 0x56, 0x53, 0x35, 0x05, 0x66, 0x21, 0x32, 0x25, 0x05, 0x35, 0x42, 0x24, 0x26, 0x04, 0x25, 0x34, 0x24, 0x26, 0x04, 0x25, 0x24, 0x26, 0x25, 0x04, 0x25, 0x25, 0x25, 0x25, 0x04,
+	0x00, 0x25, 0x25, 0x35, 0x24, 0x04, 0x26, 0x34, 0x43, 0x23, 0x05, 0x36, 0x64, 0x71, 0x05, 0x27, 0x55, 0x52, 0x06, 0x27, 0x0F, 0x08, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x27, 0x0F, 0x08,
+	0x00, 0x2F, 0x0F, 0x8C, 0x0C, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x18, 0x1E, 0x08, 0x27, 0x54, 0x25, 0x07, 0x17, 0x84, 0x14, 0x07, 0x26, 0x23, 0x26, 0x23, 0x06, 0x16, 0x23, 0x28, 0x13, 0x06,
+	0x16, 0x13, 0x1A, 0x13, 0x06, 0x00, 0x00, 0x16, 0x23, 0x28, 0x13, 0x06, 0x26, 0x23, 0x26, 0x23, 0x06, 0x17, 0x14, 0x16, 0x14, 0x07, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x29, 0x2A, 0x09, 0x2A,
+	0x28, 0x0A, 0x8C, 0x0C, 0x2F, 0x0F, 0x2D, 0x0F, 0x02, 0x27, 0x52, 0x0F, 0x01, 0x27, 0x71, 0x0F, 0x26, 0x22, 0x14, 0x0F, 0x16, 0x13, 0x15, 0x0F, 0x00, 0x16, 0x13, 0x14, 0x0F, 0x01, 0x36, 0x11,
+	0x22, 0x0F, 0x02, 0xA7, 0x0F, 0x89, 0x0F, 0x0F, 0x11, 0x0F, 0x0F, 0x13, 0x0D, 0x0F, 0x32, 0x0C, 0x0F, 0x51, 0x0B, 0x3F, 0x32, 0x09, 0x3D, 0x35, 0x08, 0x2D, 0x27, 0x08, 0x1D, 0x19, 0x08, 0x0F,
+	0x32, 0x0C, 0x0F, 0x51, 0x0B, 0x3F, 0x31, 0x0A, 0x3E, 0x33, 0x09, 0x3D, 0x35, 0x08, 0x2D, 0x27, 0x08, 0x1D, 0x19, 0x08, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8F, 0x09, 0x00, 0x2F, 0x0F, 0x8C, 0x0C, 0x2A, 0x28, 0x0A, 0x29, 0x2A, 0x09, 0x18, 0x1E, 0x08, 0x27, 0x2E, 0x07, 0x17, 0x0F, 0x11, 0x07, 0x26, 0xC2, 0x22, 0x06, 0x16, 0x13, 0x15,
+	0x18, 0x06, 0x00, 0x00, 0x16, 0x13, 0x35, 0x16, 0x06, 0x16, 0x23, 0x63, 0x14, 0x06, 0x26, 0x53, 0x33, 0x22, 0x06, 0x17, 0x34, 0x16, 0x12, 0x07, 0x27, 0x2E, 0x07, 0x18, 0x1E, 0x08, 0x29, 0x2A,
+	0x09, 0x2A, 0x28, 0x0A, 0x8C, 0x0C, 0x2F, 0x0F, 0x23, 0x0F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0F, 0x05, 0x27, 0x22, 0x0F,
+	0x04, 0x26, 0x24, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x27, 0x22, 0x0F, 0x04, 0x48, 0x0F, 0x05, 0x2E, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x22, 0x06, 0x00, 0x2E, 0x28, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x27, 0x0E, 0x27, 0x36, 0x0E, 0x26, 0x26, 0x11, 0x0E, 0x16, 0x26, 0x12, 0x0E, 0x16, 0x25, 0x13, 0x0E, 0x16, 0x34, 0x13, 0x0E, 0x76, 0x14, 0x0E, 0x57, 0x15, 0x0E, 0x27,
+	0x26, 0x0F, 0x27, 0x36, 0x0E, 0x16, 0x1A, 0x0E, 0x16, 0x14, 0x15, 0x0E, 0x00, 0x16, 0x23, 0x15, 0x0E, 0x56, 0x61, 0x0E, 0x37, 0x52, 0x0F, 0x18, 0x0F, 0x08, 0x27, 0x0F, 0x08, 0x26, 0x0F, 0x09,
+	0x25, 0x0F, 0x0A, 0x00, 0x15, 0x0F, 0x0B, 0xFA, 0x70, 0x00, 0x00, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x28, 0x07, 0x0F, 0x27, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x0F,
+	0x38, 0x06, 0x0F, 0x29, 0x06, 0x49, 0x0F, 0x04, 0x87, 0x0F, 0x02, 0x00, 0xA6, 0x0F, 0x01, 0x00, 0xF6, 0x90, 0x02, 0x00, 0x16, 0x0F, 0x0A, 0x00, 0x00, 0xF6, 0x90, 0x02, 0x00, 0x16, 0x0F, 0x0A,
+	0x00, 0x0F, 0x31, 0x0D, 0x00, 0x0F, 0x2F, 0x0F, 0x2B, 0x22, 0x00, 0x0F, 0x5C, 0x0F, 0x3D, 0x01, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0x00, 0x0F, 0x12, 0x0E, 0x00,
+	0x00, 0x3A, 0x0F, 0x04, 0x78, 0x0F, 0x02, 0x97, 0x0F, 0x01, 0x26, 0x27, 0x0F, 0x16, 0x19, 0x0F, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x47, 0x41, 0x0F, 0x01, 0x78, 0x0F, 0x02, 0x3A, 0x0F, 0x04, 0x1D,
+	0x19, 0x08, 0x2D, 0x27, 0x08, 0x3D, 0x35, 0x08, 0x3E, 0x33, 0x09, 0x3F, 0x31, 0x0A, 0x0F, 0x51, 0x0B, 0x0F, 0x32, 0x0C, 0x1D, 0x19, 0x08, 0x2D, 0x27, 0x08, 0x3D, 0x35, 0x08, 0x3F, 0x22, 0x0A,
+	0x0F, 0x51, 0x0B, 0x0F, 0x32, 0x0C, 0x0F, 0x13, 0x0D, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0xC6, 0x17, 0x06, 0x0F, 0x12, 0x26, 0x06, 0x0F, 0x12, 0x44, 0x06, 0x0F,
+	0x12, 0x33, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x16, 0x09, 0x3B, 0x36, 0x09, 0x3A, 0x26, 0x11, 0x09, 0x38, 0x36, 0x12, 0x09, 0x46, 0x36, 0x13, 0x09,
+	0x26, 0x27, 0x15, 0x09, 0xCE, 0x06, 0x00, 0x0F, 0x17, 0x09, 0x00, 0x28, 0x17, 0x0E, 0x27, 0x18, 0x0E, 0x17, 0x19, 0x0E, 0xC6, 0x0E, 0xC6, 0x17, 0x06, 0x0F, 0x12, 0x26, 0x06, 0x0F, 0x12, 0x44,
+	0x06, 0x0F, 0x12, 0x33, 0x08, 0x0F, 0x34, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x0F, 0x01, 0x3B, 0x0F, 0x03, 0x3A, 0x13, 0x27, 0x06, 0x38, 0x24, 0x36, 0x06, 0x46, 0x24,
+	0x26, 0x11, 0x06, 0x26, 0x16, 0x26, 0x12, 0x06, 0x1E, 0x25, 0x13, 0x06, 0x1E, 0x34, 0x13, 0x06, 0x7E, 0x14, 0x06, 0x5F, 0x15, 0x06, 0x27, 0x26, 0x0F, 0x27, 0x36, 0x0E, 0x16, 0x1A, 0x0E, 0x16,
+	0x14, 0x15, 0x17, 0x06, 0x16, 0x14, 0x15, 0x26, 0x06, 0x16, 0x23, 0x15, 0x44, 0x06, 0x56, 0x61, 0x33, 0x08, 0x37, 0x52, 0x32, 0x0A, 0x0F, 0x42, 0x0B, 0x0F, 0x31, 0x0D, 0x4E, 0x0E, 0x3D, 0x16,
+	0x09, 0x3B, 0x36, 0x09, 0x3A, 0x26, 0x11, 0x09, 0x38, 0x36, 0x12, 0x09, 0x46, 0x36, 0x13, 0x09, 0x26, 0x27, 0x15, 0x09, 0xCE, 0x06, 0x00, 0x0F, 0x17, 0x09, 0x00, 0x0F, 0x67, 0x04, 0x0F, 0x86,
+	0x03, 0x0F, 0x45, 0x51, 0x02, 0x0F, 0x34, 0x26, 0x02, 0x0F, 0x33, 0x28, 0x01, 0x0F, 0x32, 0x29, 0x01, 0x3A, 0x42, 0x2A, 0x01, 0x00, 0x3A, 0x22, 0x2C, 0x01, 0x0F, 0x3D, 0x01, 0x0F, 0x3C, 0x02,
+	0x0F, 0x5A, 0x02, 0x0F, 0x4A, 0x03, 0x0F, 0x2A, 0x05, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x11, 0x75, 0x24, 0x0C,
+	0x11, 0x54, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x13, 0x73, 0x24, 0x0C, 0x13, 0x66, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47,
+	0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C, 0x13, 0x52, 0x27, 0x0C, 0x13, 0x22,
+	0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x11, 0x68, 0x22, 0x0C, 0x11, 0x8A, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F,
+	0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x13, 0x88, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x30, 0x53, 0x27, 0x0C, 0x20, 0x24, 0x2A, 0x0C,
+	0x20, 0x54, 0x27, 0x0C, 0x30, 0x74, 0x24, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x13, 0x88, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06,
+	0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x31, 0x88, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x20, 0x75, 0x24, 0x0C, 0x20, 0x54, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53,
+	0x27, 0x0C, 0x22, 0x73, 0x24, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x31, 0x88, 0x0C, 0x30, 0x6C, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F,
+	0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x22, 0x66, 0x22, 0x0C, 0x22, 0x73, 0x24, 0x0C, 0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x22, 0x73, 0x24,
+	0x0C, 0x22, 0x66, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72,
+	0x08, 0x7F, 0x0A, 0x8C, 0x0C, 0x52, 0x63, 0x22, 0x0C, 0x31, 0x91, 0x24, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0xC2, 0x24, 0x0C, 0x33, 0x64, 0x22, 0x0C,
+	0x8C, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x64, 0x07, 0x0F, 0x62, 0x09, 0x6F, 0x0B, 0x7D, 0x0C,
+	0x6B, 0x21, 0x0C, 0x69, 0x23, 0x0C, 0x57, 0x26, 0x0C, 0x46, 0x28, 0x0C, 0x26, 0x2A, 0x0C, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x2F, 0x0F, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x65, 0x08, 0x47, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F,
+	0x21, 0x24, 0x26, 0x0F, 0x41, 0x22, 0x00, 0x26, 0x0F, 0x21, 0x51, 0x26, 0x0F, 0x21, 0x32, 0x01, 0x36, 0x3E, 0x06, 0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x39, 0x38, 0x09, 0x0F,
+	0x16, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x11, 0x24, 0x27, 0x27, 0x06, 0x00, 0x21, 0x23, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06,
+	0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x13, 0x22, 0x27, 0x27, 0x06, 0x00,
+	0x22, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x11, 0x24, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x26, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x00, 0x30,
+	0x23, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x13, 0x22, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27,
+	0x27, 0x06, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29,
+	0x06, 0x11, 0x0F, 0x0F, 0x00, 0x21, 0xF3, 0x50, 0x06, 0x22, 0xF2, 0x50, 0x06, 0x13, 0xF2, 0x50, 0x06, 0x13, 0x0F, 0x0D, 0x13, 0xF2, 0x50, 0x06, 0x00, 0x22, 0xF2, 0x50, 0x06, 0x21, 0x0F, 0x0E,
+	0x11, 0x0F, 0x0F, 0x00, 0x22, 0x0F, 0x0D, 0x21, 0x0F, 0x0E, 0x30, 0xF3, 0x50, 0x06, 0x20, 0xF4, 0x50, 0x06, 0x00, 0x30, 0x0F, 0x0E, 0x22, 0x0F, 0x0D, 0x13, 0x0F, 0x0D, 0x22, 0x0F, 0x0D, 0x00,
+	0xF6, 0x50, 0x06, 0x00, 0x00, 0x22, 0x0F, 0x0D, 0x00, 0x2F, 0x0F, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x36, 0x3E,
+	0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x4E, 0x0E, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x31, 0x44, 0x0F, 0x05, 0x30,
+	0x46, 0x0F, 0x04, 0x20, 0x49, 0x0F, 0x02, 0x20, 0x5A, 0x0F, 0x21, 0x4B, 0x0E, 0x21, 0x5C, 0x0C, 0x22, 0x4D, 0x0B, 0x22, 0x4F, 0x09, 0x31, 0x0F, 0x51, 0x07, 0x30, 0x0F, 0x44, 0x06, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x11, 0x24, 0x3F, 0x06, 0x11, 0x24, 0x0F, 0x21, 0x06, 0x21, 0x23,
+	0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09,
+	0xAB, 0x0B, 0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x22,
+	0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x11, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E,
+	0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F,
+	0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x13, 0x23, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9,
+	0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x31, 0x23, 0x2E, 0x07, 0x30, 0x23, 0x3F, 0x06, 0x20, 0x24, 0x0F, 0x21,
+	0x06, 0x00, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x31, 0x23, 0x2E, 0x07, 0x30, 0x34, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B,
+	0x3E, 0x0F, 0x4E, 0x0E, 0xAB, 0x0B, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x38, 0x3A, 0x08, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21,
+	0x06, 0x00, 0x00, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x38, 0x3A, 0x08, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xAB, 0x0B, 0x3E, 0x0F, 0x1B, 0x19, 0x0A, 0x3A, 0x37,
+	0x09, 0x3B, 0x35, 0x0A, 0x3C, 0x33, 0x0B, 0x3D, 0x31, 0x0C, 0x5E, 0x0D, 0x3F, 0x0E, 0x5E, 0x0D, 0x3D, 0x31, 0x0C, 0x3C, 0x33, 0x0B, 0x3B, 0x35, 0x0A, 0x3A, 0x37, 0x09, 0x1B, 0x19, 0x0A, 0x4E,
+	0x0E, 0xAB, 0x14, 0x06, 0xE9, 0x21, 0x06, 0x58, 0x76, 0x06, 0x38, 0x3A, 0x08, 0x37, 0x5A, 0x07, 0x27, 0x3A, 0x21, 0x07, 0x26, 0x3A, 0x32, 0x06, 0x26, 0x39, 0x24, 0x06, 0x26, 0x38, 0x25, 0x06,
+	0x26, 0x46, 0x26, 0x06, 0x26, 0x35, 0x28, 0x06, 0x26, 0x34, 0x29, 0x06, 0x36, 0x32, 0x2A, 0x06, 0x27, 0x31, 0x2A, 0x07, 0x57, 0x3A, 0x07, 0x38, 0x3A, 0x08, 0x76, 0x56, 0x08, 0x35, 0xE1, 0x09,
+	0x25, 0xA4, 0x0B, 0x15, 0x38, 0x0F, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x00, 0x21, 0x0F, 0x26, 0x06,
+	0x22, 0x0F, 0x25, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x13, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6,
+	0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x11, 0x0F, 0x36, 0x06,
+	0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x13, 0x0F, 0x24, 0x07, 0x22, 0x0F, 0x34,
+	0x06, 0x21, 0x0F, 0x26, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x10, 0x0F, 0x28, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x13, 0x0F, 0x24, 0x07, 0x0F, 0x46, 0x07,
+	0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x22, 0x0F, 0x34, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x0F, 0x29,
+	0x06, 0x00, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xF6, 0x0B, 0x16, 0x0F, 0x0A, 0x36, 0x0F, 0x08, 0x46,
+	0x0F, 0x07, 0x57, 0x0F, 0x05, 0x59, 0x0F, 0x03, 0x4B, 0x0F, 0x02, 0x13, 0x58, 0x0F, 0x13, 0xCA, 0x06, 0x22, 0xBB, 0x06, 0x21, 0xCB, 0x06, 0x11, 0x5A, 0x0F, 0x11, 0x49, 0x0F, 0x02, 0x59, 0x0F,
+	0x03, 0x57, 0x0F, 0x05, 0x46, 0x0F, 0x07, 0x36, 0x0F, 0x08, 0x16, 0x0F, 0x0A, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x2A, 0x28, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x36, 0x0A, 0x3B,
+	0x34, 0x0B, 0x9B, 0x0C, 0x7C, 0x0D, 0xF9, 0x20, 0x06, 0xF7, 0x40, 0x06, 0xF6, 0x50, 0x06, 0x26, 0x0F, 0x09, 0x25, 0x0F, 0x0A, 0x00, 0x25, 0x0F, 0x31, 0x06, 0x25, 0x36, 0x28, 0x06, 0x25, 0x65,
+	0x26, 0x06, 0x35, 0x33, 0x31, 0x26, 0x06, 0x76, 0x33, 0x25, 0x06, 0x66, 0x35, 0x24, 0x06, 0x38, 0x77, 0x07, 0x0F, 0x73, 0x07, 0x0F, 0x35, 0x09, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93,
+	0x06, 0x3B, 0x23, 0x34, 0x06, 0x14, 0x25, 0x34, 0x25, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06, 0x34, 0x23, 0x24, 0x26, 0x06, 0x25, 0x23, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x17, 0x32,
+	0x23, 0x24, 0x08, 0xDB, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x17, 0x22,
+	0x24, 0x26, 0x06, 0x26, 0x22, 0x24, 0x26, 0x06, 0x25, 0x23, 0x24, 0x16, 0x07, 0x24, 0x24, 0x24, 0x25, 0x07, 0x24, 0x34, 0x23, 0x24, 0x08, 0x14, 0xD6, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29,
+	0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x17, 0x33, 0x93, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x25, 0x23, 0x34, 0x25, 0x06, 0x34, 0x23, 0x24, 0x26, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06,
+	0x24, 0x24, 0x24, 0x16, 0x07, 0x34, 0x23, 0x24, 0x25, 0x07, 0x35, 0x32, 0x23, 0x24, 0x08, 0x26, 0xD3, 0x08, 0x17, 0xF3, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74,
+	0x07, 0x3B, 0x93, 0x06, 0x35, 0x33, 0x23, 0x34, 0x06, 0x24, 0x24, 0x34, 0x25, 0x06, 0x24, 0x24, 0x24, 0x26, 0x06, 0x00, 0x25, 0x23, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x26, 0x32,
+	0x23, 0x24, 0x08, 0x35, 0xD3, 0x08, 0x34, 0xF4, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x26, 0x22, 0x34,
+	0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x26, 0x32, 0x23, 0x24, 0x08, 0x26, 0xD3, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F,
+	0x44, 0x09, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x52, 0x23, 0x34, 0x25, 0x06, 0x31, 0x31, 0x22, 0x24, 0x26, 0x06, 0x21, 0x23, 0x22, 0x24, 0x26, 0x06, 0x21, 0x23, 0x22,
+	0x24, 0x16, 0x07, 0x21, 0x23, 0x22, 0x24, 0x25, 0x07, 0x52, 0x33, 0x23, 0x24, 0x08, 0x33, 0xD5, 0x08, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B,
+	0x93, 0x06, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x00, 0x00, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x24, 0x08, 0xCB, 0x09, 0x00, 0xEB, 0x07, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24,
+	0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08,
+	0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x24, 0x2A, 0x4C, 0x22, 0x00, 0x2A, 0x2C, 0x51, 0x3A, 0x3A, 0x32, 0x01, 0x4B, 0x37, 0x07, 0x3C, 0x36, 0x08, 0x2D, 0x26, 0x09, 0x6F, 0x0B, 0xAD,
+	0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x14, 0x35, 0x24, 0x34, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06,
+	0x17, 0x32, 0x24, 0x25, 0x06, 0x3B, 0x23, 0x24, 0x07, 0x7C, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06,
+	0x17, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x24, 0x34, 0x24, 0x25, 0x06, 0x14, 0x36, 0x23, 0x24, 0x07, 0x7C, 0x33,
+	0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09, 0x17, 0xC4, 0x08, 0x26, 0x33, 0x23, 0x33, 0x07, 0x25, 0x33, 0x24, 0x34, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x25,
+	0x25, 0x06, 0x00, 0x34, 0x23, 0x25, 0x25, 0x06, 0x35, 0x32, 0x24, 0x25, 0x06, 0x26, 0x33, 0x23, 0x24, 0x07, 0x17, 0x74, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x6F, 0x0B, 0xAD, 0x09,
+	0xCC, 0x08, 0x3B, 0x23, 0x33, 0x07, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x24, 0x25, 0x06, 0x26, 0x33, 0x23, 0x24, 0x07, 0x26,
+	0x74, 0x33, 0x07, 0x6D, 0x23, 0x08, 0x0F, 0x31, 0x0D, 0x14, 0x0F, 0x0C, 0x24, 0x0F, 0x0B, 0x34, 0xF3, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x26, 0xF2, 0x10, 0x06, 0x17, 0x0F, 0x09, 0x17, 0x0F,
+	0x09, 0x26, 0xF2, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06, 0x24, 0x0F, 0x0B, 0x14, 0x0F, 0x0C, 0x17, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x25, 0x0F, 0x0A, 0x34, 0xF3, 0x10, 0x06,
+	0x24, 0xF4, 0x10, 0x06, 0x00, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x17, 0x0F, 0x09, 0x26, 0x0F, 0x09, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x26, 0x0F, 0x09,
+	0x00, 0x0F, 0x61, 0x0A, 0xAE, 0x08, 0xCD, 0x07, 0x15, 0x22, 0x33, 0x36, 0x07, 0x15, 0x12, 0x33, 0x38, 0x06, 0x25, 0x11, 0x23, 0x2A, 0x06, 0x36, 0x23, 0x2A, 0x06, 0x00, 0x46, 0x22, 0x2A, 0x06,
+	0x16, 0x31, 0x21, 0x39, 0x06, 0x16, 0x62, 0x28, 0x07, 0x25, 0xF3, 0x07, 0xCC, 0x08, 0x7F, 0x0A, 0xFA, 0x10, 0x06, 0x00, 0x35, 0xD5, 0x06, 0x24, 0x25, 0x0F, 0x04, 0x24, 0x15, 0x0F, 0x05, 0x24,
+	0x24, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x26, 0x22, 0x0F, 0x05, 0x00, 0x35, 0x52, 0x0F, 0x02, 0x34, 0xF4, 0x06, 0xEC, 0x06, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x14, 0x35,
+	0x3A, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x17, 0x32, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F,
+	0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x17, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x24, 0x34, 0x3A, 0x06, 0x14,
+	0x36, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0x17, 0xE3, 0x07, 0x26, 0x33, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06,
+	0x00, 0x34, 0x23, 0x2C, 0x06, 0x35, 0x32, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0x17, 0xE3, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B, 0xAD, 0x09, 0xEB, 0x07, 0x35, 0x33, 0x38, 0x07, 0x24, 0x34,
+	0x3A, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x00, 0x25, 0x23, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x35, 0x33, 0x38, 0x07, 0x34, 0xE4, 0x07, 0xBC, 0x09, 0x6F, 0x0B, 0x6F, 0x0B,
+	0xAD, 0x09, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x26, 0x32, 0x3A, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0x26, 0xE3, 0x07, 0xBC, 0x09,
+	0x6F, 0x0B, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x22, 0x32, 0x0A, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1A, 0x06, 0x6F, 0x23, 0x06, 0xEC, 0x06, 0xEB, 0x07, 0x3B,
+	0x47, 0x07, 0x3A, 0x36, 0x31, 0x06, 0x2A, 0x36, 0x23, 0x06, 0x2A, 0x35, 0x24, 0x06, 0x2A, 0x34, 0x25, 0x06, 0x2A, 0x33, 0x26, 0x06, 0x3A, 0x31, 0x36, 0x06, 0x4B, 0x37, 0x07, 0xEB, 0x07, 0xEA,
+	0x08, 0x2A, 0x82, 0x0A, 0x1A, 0x0F, 0x06, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x14, 0x0F, 0x24, 0x06, 0x24, 0x0F, 0x23, 0x06, 0x34, 0x0F, 0x22, 0x06, 0x25, 0x0F, 0x22, 0x06, 0x26, 0x2F,
+	0x07, 0x17, 0x2F, 0x07, 0xDA, 0x09, 0xFA, 0x10, 0x06, 0x00, 0xEA, 0x08, 0xFA, 0x07, 0x0F, 0x56, 0x06, 0x0F, 0x29, 0x06, 0x17, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x22, 0x06,
+	0x24, 0x0F, 0x22, 0x07, 0x00, 0x14, 0xD5, 0x09, 0xFA, 0x10, 0x06, 0x00, 0xEA, 0x08, 0x17, 0xF2, 0x07, 0x26, 0x5D, 0x06, 0x25, 0x0F, 0x22, 0x06, 0x34, 0x0F, 0x22, 0x06, 0x24, 0x0F, 0x23, 0x06,
+	0x00, 0x34, 0x0F, 0x21, 0x07, 0x35, 0x2F, 0x07, 0x26, 0xD2, 0x09, 0x17, 0xF2, 0x10, 0x06, 0xFA, 0x10, 0x06, 0xEA, 0x08, 0xFA, 0x07, 0x26, 0x5D, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06,
+	0x00, 0x00, 0x0F, 0x28, 0x07, 0x26, 0x2F, 0x07, 0x26, 0xD2, 0x09, 0xFA, 0x10, 0x06, 0x00, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x8C, 0x39, 0x17, 0x78, 0x35, 0x01, 0x26, 0xCB, 0x01,
+	0x25, 0x0F, 0x61, 0x03, 0x24, 0x7E, 0x05, 0x24, 0x8A, 0x08, 0x14, 0x88, 0x0B, 0x8A, 0x0E, 0x4A, 0x0F, 0x03, 0x1A, 0x0F, 0x06, 0xF5, 0xC0, 0x00, 0x4D, 0x42, 0x09, 0x2B, 0x2A, 0x07, 0x1B, 0x1C,
+	0x07, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x3A, 0x3A, 0x06, 0x4A, 0x48, 0x06, 0xEB, 0x07, 0xCC, 0x08, 0x6F, 0x0B, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x26, 0x84, 0x39, 0x26, 0x78, 0x35,
+	0x01, 0x0F, 0xC4, 0x01, 0x0F, 0x68, 0x03, 0x0F, 0x75, 0x05, 0x0F, 0x81, 0x08, 0x26, 0x85, 0x0B, 0x26, 0x82, 0x0E, 0x4A, 0x0F, 0x03, 0x1A, 0x0F, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F,
+	0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x8C, 0x0C, 0x21, 0x67, 0x22, 0x0C, 0x21, 0x74, 0x24, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x23, 0x2A, 0x0C, 0x21, 0x53, 0x27, 0x0C, 0x21, 0x74, 0x24,
+	0x0C, 0x21, 0x67, 0x22, 0x0C, 0x21, 0x89, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x26,
+	0x33, 0x32, 0x34, 0x06, 0x26, 0x32, 0x33, 0x25, 0x06, 0x26, 0x22, 0x24, 0x26, 0x06, 0x00, 0x26, 0x22, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x26, 0x32, 0x23, 0x33, 0x08, 0x26, 0xE3,
+	0x07, 0xFB, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x20, 0x8A, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x31, 0x73,
+	0x24, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x22, 0x22, 0x2A, 0x0C, 0x22, 0x52, 0x27, 0x0C, 0x31, 0x73, 0x24, 0x0C, 0x30, 0x67, 0x22, 0x0C, 0x20, 0x8A, 0x0C, 0x6F, 0x0B, 0x0F, 0x72, 0x08, 0x0F, 0x65,
+	0x06, 0x0F, 0x47, 0x06, 0x0F, 0x1A, 0x06, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x24, 0x35, 0x32, 0x34, 0x06, 0x34, 0x33, 0x33, 0x25, 0x06, 0x35, 0x22, 0x24, 0x26, 0x06, 0x26,
+	0x22, 0x24, 0x26, 0x06, 0x26, 0x22, 0x24, 0x16, 0x07, 0x26, 0x22, 0x24, 0x25, 0x07, 0x35, 0x32, 0x23, 0x33, 0x08, 0x34, 0xE4, 0x07, 0x24, 0xF5, 0x06, 0xDD, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x0F,
+	0x1A, 0x06, 0x0F, 0x47, 0x06, 0x0F, 0x65, 0x06, 0x0F, 0x72, 0x08, 0x6F, 0x0B, 0x8C, 0x0C, 0x6A, 0x22, 0x0C, 0x77, 0x24, 0x0C, 0x56, 0x27, 0x0C, 0x26, 0x2A, 0x0C, 0x56, 0x27, 0x0C, 0x77, 0x24,
+	0x0C, 0x6A, 0x22, 0x0C, 0x8C, 0x0C, 0x6F, 0x37, 0x01, 0x0F, 0x72, 0x62, 0x0F, 0x75, 0x23, 0x0F, 0x47, 0x24, 0x0F, 0x1A, 0x24, 0x0F, 0x54, 0x08, 0x2C, 0x74, 0x07, 0x3B, 0x93, 0x06, 0x3B, 0x32,
+	0x34, 0x06, 0x3A, 0x33, 0x25, 0x06, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x2A, 0x24, 0x16, 0x07, 0x2A, 0x24, 0x25, 0x07, 0x3A, 0x23, 0x33, 0x08, 0xEB, 0x33, 0x01, 0xFB, 0x60, 0xED, 0x23, 0x0F, 0x29,
+	0x24, 0x00, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x36, 0x3E, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x13, 0x22, 0x0F, 0x21, 0x06,
+	0x22, 0x22, 0x0F, 0x21, 0x06, 0x12, 0x23, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x11, 0x34, 0x2E, 0x07, 0x11, 0x25, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48, 0x08, 0x29, 0x39, 0x09,
+	0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x17, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x3B, 0x06, 0x24, 0x34, 0x3A, 0x06,
+	0x14, 0x46, 0x46, 0x07, 0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x13, 0x32, 0x3E, 0x06, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23,
+	0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x22, 0x32, 0x2E, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x47,
+	0x3B, 0x07, 0x48, 0x48, 0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0x17, 0xE3, 0x07, 0x26, 0x33, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x34, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x34,
+	0x23, 0x2C, 0x06, 0x25, 0x23, 0x3B, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x17, 0x43, 0x46, 0x07, 0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C,
+	0x07, 0x36, 0x3E, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x36, 0x2E, 0x07, 0x27, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48,
+	0x48, 0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x3B, 0x38, 0x07, 0x3A, 0x3A, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x00, 0x00, 0x2A, 0x3B, 0x06, 0x3A, 0x3A, 0x06, 0x4B, 0x46, 0x07,
+	0x3C, 0x36, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x10, 0x35, 0x3E, 0x06, 0x20, 0x24, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x31,
+	0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x34, 0x2E, 0x07, 0x10, 0x26, 0x2E, 0x07, 0x47, 0x3B, 0x07, 0x48, 0x48,
+	0x08, 0x29, 0x39, 0x09, 0x8E, 0x0A, 0xCC, 0x08, 0x14, 0xE6, 0x07, 0x24, 0x35, 0x38, 0x07, 0x25, 0x33, 0x3A, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x26, 0x22, 0x2C, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x25,
+	0x23, 0x3B, 0x06, 0x24, 0x34, 0x3A, 0x06, 0x14, 0x46, 0x46, 0x07, 0x3C, 0x36, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x21, 0x06, 0x10, 0x25, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21,
+	0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x33, 0x3E, 0x06, 0x20, 0x25, 0x2E, 0x07, 0x10, 0x36, 0x3C,
+	0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x2B, 0x2A, 0x07,
+	0x2C, 0x37, 0x08, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x25, 0x12, 0x0F, 0x07, 0x2F, 0x0F, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x26, 0x0F, 0x21, 0x06, 0x36, 0x3E, 0x06, 0x27, 0x2E, 0x07, 0x37, 0x3C, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4A, 0x48, 0x06,
+	0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x27, 0x21, 0x2C, 0x06, 0x00, 0x27, 0x22, 0x2A, 0x07, 0x27, 0x23, 0x37, 0x08, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27,
+	0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x26, 0x43, 0x22,
+	0x33, 0x07, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x26, 0x32, 0x24, 0x34, 0x06, 0x26, 0x33, 0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x20, 0x24, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x00, 0x31, 0x22, 0x27, 0x27, 0x06, 0x30,
+	0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x24, 0x45, 0x22, 0x33, 0x07, 0x34, 0x33, 0x24,
+	0x34, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x35, 0x32, 0x24, 0x34, 0x06, 0x34, 0x34, 0x23, 0x34, 0x06, 0x24, 0x85, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6,
+	0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x22, 0x22, 0x27, 0x27, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD,
+	0x09, 0xDB, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x00, 0x00, 0x3A, 0x24, 0x34, 0x06, 0x3B, 0x23, 0x34, 0x06, 0x8B, 0x33,
+	0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x27, 0x27, 0x32, 0x01, 0x26, 0x27, 0x87, 0x26, 0x27, 0x37, 0x23,
+	0x26, 0x27, 0x27, 0x24, 0x0F, 0x29, 0x24, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x32, 0x01, 0x2A, 0x25, 0x85, 0x2A, 0x25, 0x35,
+	0x23, 0x2A, 0x25, 0x25, 0x24, 0x3A, 0x24, 0x34, 0x24, 0x3B, 0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x10, 0x25, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27,
+	0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06,
+	0x10, 0x25, 0x27, 0x27, 0x06, 0x26, 0x27, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x7E, 0x0B, 0xAD, 0x09, 0xDB, 0x08, 0x14, 0x46, 0x22, 0x33, 0x07, 0x24, 0x34, 0x24, 0x34, 0x06, 0x25, 0x23,
+	0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x25, 0x33, 0x24, 0x34, 0x06, 0x24, 0x35, 0x23, 0x34, 0x06, 0x14, 0x86, 0x33, 0x07,
+	0x7C, 0x23, 0x08, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x13, 0x23, 0x2E, 0x07, 0x22, 0x22, 0x3F, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30,
+	0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x28, 0x26, 0x06, 0x21, 0x23, 0x28, 0x26, 0x06, 0x22, 0x22, 0x28, 0x26, 0x06, 0x13, 0x32, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25,
+	0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x17, 0x42, 0x48, 0x32, 0x01, 0x26, 0x32, 0x3A, 0x33, 0x25, 0x23, 0x2C, 0x24,
+	0x34, 0x23, 0x2C, 0x24, 0x24, 0x24, 0x2C, 0x24, 0x34, 0x14, 0x1C, 0x25, 0x25, 0x24, 0x2A, 0x34, 0x26, 0x34, 0x36, 0x34, 0x01, 0x17, 0xF2, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D,
+	0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x20, 0x25, 0x2E, 0x07, 0x30, 0x23, 0x3F, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06,
+	0x00, 0x22, 0x22, 0x28, 0x26, 0x06, 0x31, 0x22, 0x28, 0x26, 0x06, 0x30, 0x23, 0x28, 0x26, 0x06, 0x20, 0x34, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08,
+	0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x24, 0x44, 0x48, 0x32, 0x01, 0x34, 0x33, 0x3A, 0x33, 0x35, 0x22, 0x2C, 0x24, 0x26, 0x22, 0x2C, 0x24, 0x00, 0x26, 0x13, 0x1C,
+	0x25, 0x35, 0x23, 0x2A, 0x34, 0x34, 0x35, 0x36, 0x34, 0x01, 0x24, 0xF4, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07,
+	0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x22, 0x22, 0x28, 0x26, 0x06, 0x26, 0x28, 0x26, 0x06, 0x00, 0x36, 0x27, 0x35,
+	0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01, 0x4A, 0x48, 0x32, 0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C,
+	0x24, 0x26, 0x22, 0x2C, 0x24, 0x00, 0x26, 0x13, 0x1C, 0x25, 0x2B, 0x2A, 0x34, 0x3C, 0x36, 0x34, 0x01, 0xFA, 0x60, 0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0x6D, 0x0D, 0xCA, 0x0A, 0xE9, 0x09,
+	0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x37, 0x3C, 0x07, 0x27, 0x2E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x21, 0x12, 0x26, 0x0F, 0x21, 0x51, 0x26, 0x28, 0x26, 0x41,
+	0x01, 0x26, 0x28, 0x26, 0x06, 0x00, 0x36, 0x27, 0x35, 0x06, 0x27, 0x27, 0x25, 0x07, 0x47, 0x25, 0x34, 0x07, 0x38, 0x85, 0x08, 0x29, 0x85, 0x08, 0x8E, 0x0A, 0xCC, 0x14, 0x03, 0xEB, 0x33, 0x01,
+	0x4A, 0x48, 0x32, 0x01, 0x3A, 0x3A, 0x33, 0x2A, 0x2C, 0x24, 0x44, 0x22, 0x2C, 0x24, 0x53, 0x22, 0x2C, 0x24, 0x13, 0x22, 0x13, 0x1C, 0x25, 0x2B, 0x2A, 0x34, 0x3C, 0x36, 0x34, 0x01, 0xFA, 0x60,
+	0x01, 0xFA, 0x50, 0x02, 0xFA, 0x30, 0x04, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x2E, 0x0F, 0x01, 0x13, 0x2A, 0x0F, 0x01, 0x22, 0x2A, 0x0F, 0x01, 0x21, 0x2B, 0x0F, 0x01, 0x30, 0x2B, 0x0F, 0x01, 0x20,
+	0x2C, 0x0F, 0x01, 0x30, 0x2B, 0x0F, 0x01, 0x21, 0x2B, 0x0F, 0x01, 0x22, 0x2A, 0x0F, 0x01, 0x13, 0x2A, 0x0F, 0x01, 0x2E, 0x0F, 0x01, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x12,
+	0xF2, 0x60, 0x06, 0x21, 0x29, 0x0F, 0x03, 0x20, 0x29, 0x0F, 0x04, 0x20, 0x28, 0x0F, 0x05, 0x10, 0x29, 0x0F, 0x05, 0x20, 0x28, 0x0F, 0x05, 0x00, 0x21, 0x37, 0x0F, 0x04, 0x12, 0xF7, 0x10, 0x06,
+	0xFB, 0x06, 0xEC, 0x06, 0x29, 0x0F, 0x06, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x29, 0x23, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00,
+	0x29, 0x0F, 0x06, 0x27, 0x0F, 0x08, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x27, 0x23, 0x0F, 0x03, 0x27, 0x22, 0x0F, 0x04, 0x27, 0x21, 0x0F, 0x05, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0x3A, 0x0F, 0x04,
+	0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0x22, 0x0F, 0x0D, 0x30, 0x0F, 0x0E, 0x20, 0x0F, 0x0F, 0x20, 0xF4, 0x50, 0x06, 0x21, 0xF3, 0x50, 0x06, 0x00, 0x22, 0x0F, 0x0D, 0x00, 0x26, 0x0F, 0x09,
+	0x34, 0x0F, 0x0A, 0x24, 0x0F, 0x0B, 0x24, 0xF4, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x21, 0x0F, 0x0E, 0x00, 0x21, 0xF3, 0x50, 0x06, 0x00, 0x00, 0x21, 0x0F, 0x0E,
+	0x26, 0x0F, 0x09, 0x00, 0x26, 0xF2, 0x10, 0x06, 0x00, 0x00, 0x26, 0x0F, 0x09, 0x20, 0x0F, 0x0F, 0x30, 0x0F, 0x0E, 0x31, 0x0F, 0x0D, 0x22, 0xF2, 0x50, 0x06, 0x00, 0x00, 0x31, 0x0F, 0x0D, 0x30,
+	0x0F, 0x0E, 0x24, 0x0F, 0x0B, 0x34, 0x0F, 0x0A, 0x35, 0x0F, 0x09, 0x26, 0xF2, 0x10, 0x06, 0x00, 0x00, 0x35, 0x0F, 0x09, 0x34, 0x0F, 0x0A, 0x0F, 0x3D, 0x01, 0x0F, 0x6B, 0xF6, 0x60, 0x23, 0xF6,
+	0x50, 0x24, 0x00, 0x0F, 0x3D, 0x01, 0x0F, 0x6B, 0x25, 0xF3, 0x20, 0x23, 0x25, 0xF3, 0x10, 0x24, 0x00, 0x22, 0xF2, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x0F, 0x0F, 0x02, 0x0F, 0x16, 0x0A, 0x0F, 0x36, 0x08, 0x0F, 0x55, 0x07, 0x0F, 0x37, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x26, 0x3F, 0x06, 0x26, 0x3E,
+	0x07, 0xF6, 0x40, 0x07, 0xF6, 0x30, 0x08, 0x25, 0xF3, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x2F, 0x00, 0x00, 0x25, 0xF3, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x25, 0xF3, 0x50, 0x02, 0x0F, 0x16, 0x0A, 0x0F,
+	0x36, 0x08, 0x0F, 0x55, 0x07, 0x0F, 0x37, 0x07, 0x0F, 0x38, 0x06, 0x13, 0x0F, 0x25, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x30, 0x23, 0x3F, 0x06, 0x20, 0x24, 0x3E,
+	0x07, 0x30, 0xF3, 0x40, 0x07, 0x21, 0xF3, 0x30, 0x08, 0x22, 0xF2, 0x20, 0x09, 0x27, 0x0F, 0x26, 0x26, 0x0F, 0x27, 0x35, 0xF2, 0x70, 0x25, 0xF3, 0x60, 0x01, 0x35, 0xF2, 0x50, 0x02, 0x26, 0x0F,
+	0x09, 0x27, 0x0F, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x21, 0x0E, 0x2F, 0x0F, 0x2E, 0x0F, 0x01, 0x4D, 0x0F, 0x7C, 0x28, 0x12, 0x3B, 0x42, 0x57, 0x3A, 0x44, 0x46, 0x01, 0x39, 0x46, 0x0A,
+	0x38, 0x39, 0x09, 0x37, 0x4B, 0x07, 0x36, 0x4D, 0x06, 0x26, 0x3F, 0x06, 0x16, 0x0F, 0x22, 0x06, 0x0F, 0x1A, 0x06, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x32, 0x0C, 0x0F, 0x31, 0x0D, 0x5F, 0x27,
+	0x12, 0x7E, 0x56, 0x3D, 0x42, 0x45, 0x01, 0x3C, 0x45, 0x08, 0x3B, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C, 0x06, 0x1A, 0x1E, 0x06, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x0F, 0x32, 0x0C, 0x0F, 0x31,
+	0x0D, 0x4F, 0x0D, 0x7E, 0x0B, 0x3D, 0x42, 0x0A, 0x3C, 0x45, 0x08, 0x3B, 0x47, 0x07, 0x3A, 0x49, 0x06, 0x2A, 0x2C, 0x06, 0x1A, 0x1E, 0x06, 0xF6, 0x50, 0x06, 0x13, 0xF2, 0x50, 0x06, 0x22, 0xF2,
+	0x50, 0x06, 0x12, 0x0F, 0x26, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x11, 0x0F, 0x27, 0x06, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xF2, 0x60, 0x06, 0x21, 0xF2, 0x60, 0x06, 0x11,
+	0xF3, 0x60, 0x06, 0x20, 0x0F, 0x0F, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x0F, 0x29, 0x21, 0x12, 0x0F, 0x29, 0x51, 0x0F, 0x29, 0x41, 0x01, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0xF5, 0x60, 0x21, 0x12, 0xF5, 0x60, 0x51, 0xF5, 0x60, 0x41, 0x01, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x26, 0x12, 0x2D, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E,
+	0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x25, 0x12, 0x0F, 0x07, 0x55, 0x0F, 0x07, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00,
+	0x2F, 0x27, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0xF5, 0x60, 0x06, 0x00, 0x00, 0x0F, 0x0F, 0x02, 0x00, 0x2F, 0x0F, 0x00, 0x0F, 0x31, 0x0D, 0x0F, 0x21, 0x0E, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x2E, 0x28, 0x06, 0x2D, 0x29, 0x06, 0x00, 0x2C, 0x2A, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x23, 0x0C, 0x0F, 0x22, 0x0D, 0xF5, 0x60, 0x06, 0x00, 0x00, 0xF6, 0x50,
+	0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x49, 0x0F, 0x04, 0x4B, 0x0F, 0x02, 0x13, 0x58, 0x0F, 0x22, 0x4A, 0x0E, 0x12, 0x5C, 0x0C, 0x21, 0x5E, 0x0A, 0x11, 0x0F, 0x42, 0x09, 0x11,
+	0x0F, 0x53, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x17, 0x22, 0x0F, 0x05, 0x26, 0x22, 0x0F, 0x05, 0x25, 0x23,
+	0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x24, 0x34, 0x0F, 0x04, 0x14, 0xF5, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x46, 0x0F, 0x07, 0x57, 0x0F, 0x05, 0x49, 0x0F, 0x04,
+	0x4B, 0x0F, 0x02, 0x5C, 0x2A, 0x12, 0x4E, 0x59, 0x5F, 0x47, 0x01, 0x0F, 0x52, 0x0A, 0x0F, 0x44, 0x09, 0x0F, 0x55, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00,
+	0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x2F, 0x12, 0x2A, 0x5F, 0x2A, 0x4F, 0x01, 0x2A, 0x0F, 0x05, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06, 0x00,
+	0x00, 0x46, 0x0F, 0x07, 0x10, 0x56, 0x0F, 0x05, 0x20, 0x47, 0x0F, 0x04, 0x21, 0x48, 0x0F, 0x02, 0x31, 0x58, 0x0F, 0x22, 0x4A, 0x0E, 0x31, 0x5B, 0x0C, 0x21, 0x5E, 0x0A, 0x20, 0x0F, 0x42, 0x09,
+	0x10, 0x0F, 0x54, 0x07, 0x0F, 0x47, 0x06, 0xF6, 0x50, 0x06, 0x00, 0x00, 0xFA, 0x10, 0x06, 0x00, 0x14, 0xF5, 0x10, 0x06, 0x24, 0x26, 0x0F, 0x03, 0x25, 0x24, 0x0F, 0x04, 0x35, 0x22, 0x0F, 0x05,
+	0x26, 0x22, 0x0F, 0x05, 0x35, 0x22, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x34, 0x0F, 0x04, 0x14, 0xF5, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0x36, 0x13, 0x0F, 0x04, 0x76, 0x0F, 0x04, 0x66,
+	0x0F, 0x05, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x3A, 0x0F, 0x04, 0xFA, 0x10, 0x06, 0xFB, 0x06, 0xEC, 0x06, 0xF6, 0x50, 0x06,
+	0x00, 0x00, 0x29, 0x0F, 0x06, 0x28, 0x0F, 0x07, 0x27, 0x0F, 0x08, 0x00, 0x26, 0x2F, 0x07, 0x26, 0x3E, 0x07, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x36, 0x2F, 0x06, 0x37, 0x4C, 0x06,
+	0xF7, 0x30, 0x07, 0xF8, 0x10, 0x08, 0xFA, 0x10, 0x06, 0x00, 0x00, 0x2C, 0x0F, 0x03, 0x2B, 0x0F, 0x04, 0x2A, 0x0F, 0x05, 0x00, 0x00, 0x2A, 0x0F, 0x23, 0x3A, 0x0F, 0x22, 0xFA, 0x70, 0xFB, 0x60,
+	0xFC, 0x30, 0x02, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D, 0x07, 0x21, 0x33, 0x3E, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x33, 0x2E, 0x07, 0x27, 0x2E, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x26, 0x33, 0x47, 0x07, 0x26, 0x32, 0x3A, 0x06, 0x26,
+	0x22, 0x2C, 0x06, 0x00, 0x00, 0x00, 0x26, 0x32, 0x3A, 0x06, 0x26, 0x33, 0x38, 0x07, 0xEB, 0x07, 0xCC, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D,
+	0x07, 0x20, 0x34, 0x3E, 0x06, 0x30, 0x23, 0x0F, 0x21, 0x06, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x31, 0x22, 0x0F, 0x21, 0x06, 0x30, 0x33, 0x2E, 0x07, 0x20,
+	0x25, 0x2E, 0x07, 0x47, 0x4A, 0x07, 0x58, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x24, 0x35, 0x47, 0x07, 0x34, 0x33, 0x3A, 0x06, 0x35, 0x22, 0x2C, 0x06, 0x26,
+	0x22, 0x2C, 0x06, 0x00, 0x00, 0x35, 0x32, 0x3A, 0x06, 0x34, 0x34, 0x38, 0x07, 0x24, 0xE5, 0x07, 0xCC, 0x08, 0x7C, 0x0D, 0xCA, 0x0A, 0xE9, 0x09, 0x58, 0x56, 0x08, 0x47, 0x4A, 0x07, 0x27, 0x3D,
+	0x07, 0x13, 0x32, 0x3E, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x20, 0x24, 0x0F, 0x21, 0x06, 0x00, 0x10, 0x12, 0x22, 0x0F, 0x21, 0x06, 0x22, 0x22, 0x0F, 0x21, 0x06,
+	0x21, 0x33, 0x2E, 0x07, 0x20, 0x25, 0x2E, 0x07, 0x20, 0x45, 0x4A, 0x07, 0x10, 0x57, 0x56, 0x08, 0xE9, 0x09, 0xCA, 0x0A, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x17, 0x33, 0x47, 0x07, 0x26, 0x32,
+	0x3A, 0x06, 0x25, 0x23, 0x2C, 0x06, 0x24, 0x24, 0x2C, 0x06, 0x00, 0x14, 0x12, 0x22, 0x2C, 0x06, 0x26, 0x32, 0x3A, 0x06, 0x25, 0x34, 0x38, 0x07, 0x24, 0xE5, 0x07, 0x24, 0xC6, 0x08, 0x7C, 0x0D,
+	0xCA, 0x0A, 0xE9, 0x09, 0x48, 0x57, 0x08, 0x37, 0x4B, 0x07, 0x27, 0x3D, 0x07, 0x27, 0x3E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x27,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x8E, 0x0A, 0xCC, 0x08, 0xEB, 0x07, 0x4B, 0x46, 0x07, 0x3A, 0x3A, 0x06, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x00,
+	0x3A, 0x3A, 0x06, 0x3B, 0x38, 0x07, 0xEB, 0x07, 0xBC, 0x09, 0xCC, 0x08, 0x4B, 0x22, 0x33, 0x07, 0x3A, 0x24, 0x34, 0x06, 0x2A, 0x25, 0x25, 0x06, 0x00, 0x00, 0x00, 0x3A, 0x24, 0x34, 0x06, 0x3B,
+	0x23, 0x34, 0x06, 0x8B, 0x33, 0x07, 0x7C, 0x23, 0x08, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x13, 0x22, 0x28, 0x0E, 0x22, 0x22, 0x28, 0x0E, 0x12, 0x23, 0x28, 0x0E, 0x21,
+	0x23, 0x28, 0x0E, 0x11, 0x24, 0x48, 0x0C, 0x11, 0x24, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F, 0x1A, 0x06, 0xFA, 0x10,
+	0x06, 0x00, 0x17, 0xF2, 0x10, 0x06, 0x26, 0x24, 0x0F, 0x03, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x00, 0x00, 0x00, 0x26, 0x28,
+	0x29, 0x12, 0x26, 0x28, 0x59, 0x26, 0x28, 0x49, 0x01, 0x26, 0x48, 0x0C, 0x26, 0x58, 0x0B, 0x36, 0x86, 0x09, 0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F,
+	0x1A, 0x06, 0xFA, 0x10, 0x21, 0x12, 0xFA, 0x10, 0x51, 0xFA, 0x10, 0x41, 0x01, 0x2C, 0x0F, 0x03, 0x2A, 0x0F, 0x05, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x28, 0x0E, 0x10, 0x25, 0x28, 0x0E,
+	0x20, 0x24, 0x28, 0x0E, 0x21, 0x23, 0x28, 0x0E, 0x31, 0x22, 0x28, 0x0E, 0x22, 0x22, 0x28, 0x0E, 0x31, 0x22, 0x28, 0x0E, 0x21, 0x23, 0x48, 0x0C, 0x20, 0x24, 0x58, 0x0B, 0x10, 0x35, 0x86, 0x09,
+	0x37, 0x34, 0x43, 0x08, 0xA7, 0x44, 0x07, 0x88, 0x37, 0x06, 0x59, 0x2A, 0x06, 0x0F, 0x1A, 0x06, 0x14, 0x0F, 0x0C, 0x24, 0xF4, 0x10, 0x06, 0x25, 0xF3, 0x10, 0x06, 0x35, 0xF2, 0x10, 0x06, 0x26,
+	0x24, 0x0F, 0x03, 0x35, 0x22, 0x0F, 0x05, 0x25, 0x23, 0x0F, 0x05, 0x24, 0x24, 0x0F, 0x05, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36,
+	0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x13, 0x22, 0x36, 0x27, 0x06, 0x22, 0x22, 0x36, 0x27, 0x06, 0x21, 0x23, 0x27, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x20, 0x24, 0x37, 0x26, 0x06,
+	0x10, 0x35, 0x36, 0x35, 0x06, 0x37, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x7B, 0x35, 0x06, 0x3A, 0x32, 0x35, 0x06, 0x2A,
+	0x24, 0x26, 0x06, 0x17, 0x22, 0x34, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x25, 0x25, 0x06, 0x24, 0x24, 0x35, 0x24, 0x06, 0x24, 0x34, 0x34, 0x33, 0x06, 0x14, 0x36, 0x74, 0x07,
+	0x3B, 0x74, 0x07, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x13, 0x32, 0x34, 0x37, 0x06, 0x22, 0x22, 0x26, 0x28, 0x06, 0x21, 0x23, 0x36,
+	0x27, 0x06, 0x30, 0x23, 0x36, 0x27, 0x06, 0x20, 0x24, 0x27, 0x27, 0x06, 0x30, 0x23, 0x27, 0x27, 0x06, 0x21, 0x23, 0x37, 0x26, 0x06, 0x22, 0x32, 0x36, 0x35, 0x06, 0x13, 0x33, 0x36, 0x33, 0x07,
+	0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x17, 0x73, 0x35, 0x06, 0x26, 0x32, 0x32, 0x35, 0x06, 0x25, 0x23, 0x24, 0x26, 0x06, 0x34, 0x23, 0x34,
+	0x25, 0x06, 0x24, 0x24, 0x25, 0x25, 0x06, 0x34, 0x23, 0x25, 0x25, 0x06, 0x25, 0x23, 0x35, 0x24, 0x06, 0x26, 0x32, 0x34, 0x33, 0x06, 0x17, 0x33, 0x74, 0x07, 0x3B, 0x74, 0x07, 0x0F, 0x16, 0x0A,
+	0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x36, 0x34, 0x37, 0x06, 0x26, 0x26, 0x28, 0x06, 0x26, 0x36, 0x27, 0x24, 0x26, 0x36, 0x27, 0x11, 0x22, 0x26, 0x27,
+	0x47, 0x22, 0x26, 0x27, 0x27, 0x51, 0x26, 0x37, 0x26, 0x32, 0x01, 0x36, 0x36, 0x35, 0x06, 0x37, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B,
+	0x35, 0x07, 0x7B, 0x35, 0x06, 0x3A, 0x32, 0x35, 0x06, 0x2A, 0x24, 0x26, 0x24, 0x2A, 0x34, 0x25, 0x11, 0x22, 0x2A, 0x25, 0x45, 0x22, 0x2A, 0x25, 0x25, 0x51, 0x2A, 0x35, 0x24, 0x32, 0x01, 0x3A,
+	0x34, 0x33, 0x06, 0x3B, 0x74, 0x07, 0x00, 0x0F, 0x16, 0x0A, 0x49, 0x38, 0x08, 0x78, 0x55, 0x07, 0x87, 0x37, 0x07, 0x27, 0x34, 0x27, 0x07, 0x10, 0x35, 0x34, 0x37, 0x06, 0x20, 0x24, 0x26, 0x28,
+	0x06, 0x21, 0x23, 0x36, 0x27, 0x06, 0x31, 0x22, 0x36, 0x27, 0x06, 0x22, 0x22, 0x27, 0x27, 0x06, 0x31, 0x22, 0x27, 0x27, 0x06, 0x21, 0x23, 0x37, 0x26, 0x06, 0x20, 0x34, 0x36, 0x35, 0x06, 0x10,
+	0x36, 0x36, 0x33, 0x07, 0x47, 0x95, 0x07, 0x38, 0x76, 0x08, 0x0F, 0x17, 0x09, 0x4C, 0x36, 0x07, 0x6B, 0x35, 0x07, 0x14, 0x76, 0x35, 0x06, 0x24, 0x34, 0x32, 0x35, 0x06, 0x25, 0x23, 0x24, 0x26,
+	0x06, 0x35, 0x22, 0x34, 0x25, 0x06, 0x26, 0x22, 0x25, 0x25, 0x06, 0x35, 0x22, 0x25, 0x25, 0x06, 0x25, 0x23, 0x35, 0x24, 0x06, 0x24, 0x34, 0x34, 0x33, 0x06, 0x14, 0x36, 0x74, 0x07, 0x3B, 0x74,
+	0x07, 0x1D, 0x45, 0x09, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x21, 0x12, 0xF6, 0x50, 0x51, 0xF6, 0x50, 0x41, 0x01, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x10, 0x07, 0xF7, 0x40, 0x06, 0xF7, 0x40, 0x21, 0x12, 0x2A, 0x2C, 0x51, 0x2A, 0x2C, 0x41, 0x01, 0x2A, 0x2C, 0x06, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x10, 0x25,
+	0x0F, 0x09, 0x20, 0x24, 0x0F, 0x09, 0x21, 0x23, 0x0F, 0x09, 0x31, 0xF2, 0x50, 0x06, 0x22, 0xF2, 0x50, 0x06, 0x31, 0xF2, 0x50, 0x06, 0x21, 0x23, 0x0F, 0x09, 0x20, 0x24, 0x0F, 0x09, 0x10, 0x25,
+	0x0F, 0x09, 0x26, 0x0F, 0x09, 0x00, 0x00, 0x2A, 0x0F, 0x05, 0x00, 0xF9, 0x10, 0x07, 0xF7, 0x40, 0x06, 0x00, 0x2A, 0x2C, 0x06, 0x00, 0x00, 0x25, 0x12, 0x0F, 0x07, 0x55, 0x0F, 0x07, 0x26, 0x0F,
+	0x09, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x00, 0x00, 0x00, 0xF6, 0x50, 0x06, 0x00, 0x00, 0x26, 0x27, 0x0F, 0x00, 0x00, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x2A, 0x24, 0x0E, 0x00, 0xF9, 0x10, 0x07, 0xF7,
+	0x40, 0x06, 0x00, 0x2A, 0x24, 0x26, 0x06, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x22, 0x0F, 0x24, 0x07, 0x30, 0x0F, 0x35, 0x06, 0x20, 0x0F, 0x27, 0x06,
+	0x00, 0x21, 0x0F, 0x26, 0x06, 0x00, 0x22, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x34, 0x06, 0x31, 0x0F, 0x24, 0x07, 0x20, 0x0F, 0x44, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07,
+	0x26, 0xF2, 0x10, 0x06, 0x34, 0x0F, 0x31, 0x06, 0x24, 0x0F, 0x23, 0x06, 0x00, 0x25, 0x0F, 0x22, 0x06, 0x00, 0x26, 0x2F, 0x07, 0x26, 0x2E, 0x08, 0x35, 0xF2, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06,
+	0xFA, 0x10, 0x06, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x21, 0x0F, 0x35, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x00, 0x00, 0x00, 0x00, 0x21, 0x0F, 0x35,
+	0x06, 0x21, 0x0F, 0x25, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x26, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x00, 0x26,
+	0x2F, 0x07, 0x26, 0x2E, 0x08, 0x26, 0xF2, 0x10, 0x06, 0xFA, 0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x20, 0x0F, 0x26, 0x07, 0x30, 0x0F, 0x35, 0x06,
+	0x31, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x00, 0x00, 0x31, 0x0F, 0x25, 0x06, 0x30, 0x0F, 0x35, 0x06, 0x20, 0x0F, 0x26, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA,
+	0x08, 0xFA, 0x07, 0x24, 0xF4, 0x10, 0x06, 0x34, 0x0F, 0x31, 0x06, 0x35, 0x0F, 0x21, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x35, 0x2F, 0x07, 0x34, 0x2F, 0x08, 0x24, 0xF4, 0x10, 0x06, 0xFA,
+	0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46, 0x07, 0x0F, 0x28, 0x07, 0x31, 0x0F, 0x34, 0x06, 0x50, 0x0F, 0x24, 0x06, 0x10, 0x23, 0x0F, 0x23, 0x06, 0x00, 0x00,
+	0x50, 0x0F, 0x24, 0x06, 0x31, 0x0F, 0x34, 0x06, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x33, 0x0F, 0x32, 0x06, 0x52,
+	0x0F, 0x22, 0x06, 0x21, 0x23, 0x0F, 0x21, 0x06, 0x00, 0x00, 0x52, 0x0F, 0x21, 0x07, 0x33, 0x0F, 0x21, 0x08, 0xFA, 0x10, 0x06, 0x00, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F,
+	0x46, 0x07, 0x13, 0x0F, 0x24, 0x07, 0x22, 0x0F, 0x34, 0x06, 0x21, 0x0F, 0x26, 0x06, 0x20, 0x0F, 0x27, 0x06, 0x00, 0x10, 0x12, 0x0F, 0x25, 0x06, 0x22, 0x0F, 0x25, 0x06, 0x21, 0x0F, 0x35, 0x06,
+	0x20, 0x0F, 0x26, 0x07, 0x20, 0x0F, 0x44, 0x07, 0x10, 0xF5, 0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x17, 0x3F, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x25, 0x0F, 0x22,
+	0x06, 0x24, 0x0F, 0x23, 0x06, 0x00, 0x14, 0x12, 0x2F, 0x07, 0x26, 0x2E, 0x08, 0x25, 0xF3, 0x10, 0x06, 0x24, 0xF4, 0x10, 0x06, 0x00, 0xF6, 0x0B, 0xF6, 0x20, 0x09, 0xF6, 0x30, 0x08, 0x0F, 0x46,
+	0x07, 0x0F, 0x28, 0x07, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x29, 0x32, 0x01, 0x0F, 0x89, 0x0F, 0x39, 0x23, 0x0F, 0x29, 0x24, 0x0F, 0x38, 0x24, 0x0F, 0x28, 0x07, 0x0F, 0x46, 0x07, 0xF6,
+	0x30, 0x08, 0xF6, 0x20, 0x09, 0xEA, 0x08, 0xFA, 0x07, 0xFA, 0x10, 0x06, 0x0F, 0x38, 0x06, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x0F, 0x29, 0x32, 0x01, 0x0F, 0x28, 0x61, 0x0F, 0x27, 0x12, 0x23, 0xFA,
+	0x10, 0x24, 0x00, 0xFA, 0x10, 0x06, 0x26, 0x0F, 0x09, 0x56, 0x0F, 0x06, 0x96, 0x0F, 0x02, 0xA8, 0x0E, 0xAC, 0x0A, 0x0F, 0x91, 0x07, 0x0F, 0x74, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x13,
+	0x8C, 0x08, 0x22, 0x98, 0x0B, 0x21, 0x86, 0x0F, 0x30, 0x73, 0x0F, 0x04, 0x20, 0x34, 0x0F, 0x08, 0x30, 0x73, 0x0F, 0x04, 0x21, 0x86, 0x0F, 0x22, 0x98, 0x0B, 0x13, 0x8C, 0x08, 0x0F, 0x74, 0x06,
+	0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x0F, 0x91, 0x07, 0x9C, 0x0B, 0xA8, 0x0E, 0x96, 0x0F, 0x02, 0x56, 0x0F, 0x06, 0x2A, 0x0F, 0x05, 0x6A, 0x0F, 0x01, 0xAA, 0x0C, 0xAE, 0x08, 0x0F, 0x74, 0x06,
+	0x0F, 0x29, 0x06, 0x17, 0x6C, 0x06, 0x26, 0x88, 0x08, 0x25, 0x85, 0x0C, 0x34, 0x63, 0x0F, 0x01, 0x24, 0x24, 0x0F, 0x05, 0x34, 0x63, 0x0F, 0x01, 0x25, 0x85, 0x0C, 0x26, 0x88, 0x08, 0x17, 0x6C,
+	0x06, 0x0F, 0x29, 0x06, 0x0F, 0x74, 0x06, 0x9F, 0x08, 0xAA, 0x0C, 0x6A, 0x0F, 0x01, 0x16, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x46, 0x0F, 0x07, 0x47, 0x0F, 0x06, 0x58, 0x0F, 0x04, 0x13, 0x46, 0x0F,
+	0x03, 0x22, 0x57, 0x0F, 0x01, 0x21, 0x4A, 0x0F, 0x30, 0xCB, 0x06, 0x20, 0xBD, 0x06, 0x30, 0xCB, 0x06, 0x21, 0x4A, 0x0F, 0x22, 0x57, 0x0F, 0x01, 0x13, 0x46, 0x0F, 0x03, 0x58, 0x0F, 0x04, 0x47,
+	0x0F, 0x06, 0x46, 0x0F, 0x07, 0x26, 0x0F, 0x09, 0x1A, 0x0F, 0x06, 0x4A, 0x0F, 0x21, 0x7A, 0x2D, 0x17, 0x84, 0x2A, 0x26, 0x77, 0x37, 0x25, 0x7B, 0x42, 0x01, 0x34, 0x8F, 0x02, 0x24, 0x0F, 0x61,
+	0x04, 0x34, 0x6C, 0x07, 0x25, 0x69, 0x0A, 0x26, 0x75, 0x0C, 0x17, 0x72, 0x0F, 0x4A, 0x0F, 0x03, 0x16, 0x0F, 0x0A, 0x26, 0x0F, 0x09, 0x46, 0x0F, 0x07, 0x47, 0x0F, 0x06, 0x58, 0x0F, 0x04, 0x4A,
+	0x0F, 0x03, 0x31, 0x57, 0x0F, 0x01, 0x31, 0x49, 0x0F, 0xCE, 0x06, 0xBF, 0x06, 0xCE, 0x06, 0x4D, 0x0F, 0x31, 0x57, 0x0F, 0x01, 0x31, 0x46, 0x0F, 0x03, 0x58, 0x0F, 0x04, 0x47, 0x0F, 0x06, 0x46,
+	0x0F, 0x07, 0x26, 0x0F, 0x09, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x4B, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23, 0x06, 0x13, 0x22, 0x47, 0x25, 0x06, 0x22,
+	0x22, 0x46, 0x26, 0x06, 0x12, 0x23, 0x45, 0x27, 0x06, 0x21, 0x23, 0x43, 0x29, 0x06, 0x11, 0x24, 0x42, 0x2A, 0x06, 0x11, 0x24, 0x41, 0x2B, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E, 0x06, 0x26, 0x0F,
+	0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47, 0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x17, 0x22, 0x45, 0x23, 0x06, 0x26, 0x22, 0x43, 0x25, 0x06,
+	0x25, 0x23, 0x42, 0x26, 0x06, 0x24, 0x24, 0x41, 0x27, 0x06, 0x24, 0x54, 0x29, 0x06, 0x14, 0x45, 0x2A, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D,
+	0x06, 0x26, 0x4B, 0x21, 0x06, 0x26, 0x4A, 0x22, 0x06, 0x26, 0x49, 0x23, 0x06, 0x26, 0x47, 0x25, 0x06, 0x22, 0x22, 0x46, 0x26, 0x06, 0x22, 0x22, 0x45, 0x27, 0x06, 0x22, 0x22, 0x43, 0x29, 0x06,
+	0x26, 0x42, 0x2A, 0x06, 0x26, 0x41, 0x2B, 0x06, 0x56, 0x2D, 0x06, 0x46, 0x2E, 0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x2A, 0x59, 0x06, 0x2A, 0x47,
+	0x21, 0x06, 0x2A, 0x46, 0x22, 0x06, 0x26, 0x22, 0x45, 0x23, 0x06, 0x26, 0x22, 0x43, 0x25, 0x06, 0x26, 0x22, 0x42, 0x26, 0x06, 0x2A, 0x41, 0x27, 0x06, 0x5A, 0x29, 0x06, 0x4A, 0x2A, 0x06, 0x3A,
+	0x2B, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x26, 0x4E, 0x06, 0x26, 0x5D, 0x06, 0x26, 0x4B, 0x21, 0x06, 0x10, 0x25, 0x4A, 0x22, 0x06, 0x20, 0x24, 0x49, 0x23, 0x06, 0x21, 0x23, 0x47, 0x25,
+	0x06, 0x31, 0x22, 0x46, 0x26, 0x06, 0x22, 0x22, 0x45, 0x27, 0x06, 0x31, 0x22, 0x43, 0x29, 0x06, 0x21, 0x23, 0x42, 0x2A, 0x06, 0x20, 0x24, 0x41, 0x2B, 0x06, 0x10, 0x55, 0x2D, 0x06, 0x46, 0x2E,
+	0x06, 0x26, 0x0F, 0x21, 0x06, 0x0F, 0x29, 0x06, 0x0F, 0x38, 0x06, 0x2A, 0x4A, 0x06, 0x14, 0x25, 0x59, 0x06, 0x24, 0x24, 0x47, 0x21, 0x06, 0x25, 0x23, 0x46, 0x22, 0x06, 0x35, 0x22, 0x45, 0x23,
+	0x06, 0x26, 0x22, 0x43, 0x25, 0x06, 0x35, 0x22, 0x42, 0x26, 0x06, 0x25, 0x23, 0x41, 0x27, 0x06, 0x24, 0x54, 0x29, 0x06, 0x14, 0x45, 0x2A, 0x06, 0x3A, 0x2B, 0x06, 0x0F, 0x29, 0x06, 0xF7, 0x40,
+	0x06, 0xF6, 0x50, 0x06, 0xF5, 0x60, 0x06, 0x25, 0x0F, 0x0A,
+};
+
+#endif
+
+// End
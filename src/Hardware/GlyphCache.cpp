@@ -0,0 +1,68 @@
+/*
+ * GlyphCache.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "GlyphCache.hpp"
+
+GlyphCache::Glyph& GlyphCache::Lookup(const uint8_t *font, uint16_t ch, uint8_t order, bool& found)
+{
+	++clock;
+	Glyph *victim = &glyphs[0];
+	for (Glyph& g : glyphs)
+	{
+		if (g.font == font && g.ch == ch && g.order == order)
+		{
+			g.lastUsed = clock;
+			++hits;
+			found = true;
+			return g;
+		}
+		if (g.font == nullptr)
+		{
+			if (victim->font != nullptr)
+			{
+				victim = &g;
+			}
+		}
+		else if (victim->font != nullptr && clock - g.lastUsed > clock - victim->lastUsed)
+		{
+			victim = &g;			// g was used less recently than victim
+		}
+	}
+
+	++misses;
+	found = false;
+	victim->font = font;
+	victim->ch = ch;
+	victim->order = order;
+	victim->lastUsed = clock;
+	victim->numRuns = 0;
+	return *victim;
+}
+
+void GlyphCache::Clear()
+{
+	for (Glyph& g : glyphs)
+	{
+		g.font = nullptr;
+	}
+	clock = 0;
+	ResetStats();
+}
+
+size_t GlyphCache::GetBytesUsed() const
+{
+	size_t total = 0;
+	for (const Glyph& g : glyphs)
+	{
+		if (g.font != nullptr)
+		{
+			total += g.numRuns;
+		}
+	}
+	return total;
+}
+
+// End
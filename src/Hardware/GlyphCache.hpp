@@ -0,0 +1,63 @@
+/*
+ * GlyphCache.hpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Small LRU cache of glyphs that have already been converted to runs of foreground and background pixels,
+ * in the order in which the display controller fills a window. Colours are applied when the runs are drawn,
+ * so one entry serves every colour pair.
+ */
+
+#ifndef SRC_HARDWARE_GLYPHCACHE_HPP_
+#define SRC_HARDWARE_GLYPHCACHE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include "asf.h"
+
+class GlyphCache
+{
+public:
+#if SAM4S
+	static constexpr size_t NumGlyphs = 32;
+#else
+	static constexpr size_t NumGlyphs = 12;
+#endif
+	static constexpr size_t MaxRuns = 128;				// glyphs that need more runs than this are not cached
+
+	// Each run is one byte, with the foreground flag in bit 7 and the run length minus one in bits 0-6
+	static constexpr uint8_t ForegroundRun = 0x80;
+	static constexpr size_t MaxRunLength = 128;
+
+	struct Glyph
+	{
+		const uint8_t *font;			// the font the glyph belongs to, or nullptr if this entry is free
+		uint32_t lastUsed;
+		uint32_t lastColData;			// the data of the last non-blank column, for kerning against the next character
+		uint16_t ch;
+		uint8_t order;					// the fill order that the runs were generated for
+		bool hasInk;					// true if lastColData is valid
+		uint8_t numRuns;				// 0 if the glyph has too many runs to cache
+		uint8_t runs[MaxRuns];
+	};
+
+	GlyphCache() { Clear(); }
+
+	// Look up a glyph. If it is not in the cache then return the least recently used entry, which the caller must fill in.
+	Glyph& Lookup(const uint8_t *font, uint16_t ch, uint8_t order, bool& found);
+
+	void Clear();
+	void ResetStats() { hits = misses = 0; }
+
+	uint32_t GetHits() const { return hits; }
+	uint32_t GetMisses() const { return misses; }
+	size_t GetBytesUsed() const;
+	static constexpr size_t GetCapacity() { return NumGlyphs * MaxRuns; }
+
+private:
+	Glyph glyphs[NumGlyphs];
+	uint32_t clock;
+	uint32_t hits, misses;
+};
+
+#endif /* SRC_HARDWARE_GLYPHCACHE_HPP_ */
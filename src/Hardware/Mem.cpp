@@ -6,6 +6,7 @@
  */
 
 #include "Mem.hpp"
+#include "chipid.h"
 #include <General/SimpleMath.h>
 
 #define MEM_DEBUG 0
@@ -46,6 +47,20 @@ void* operator new(size_t objsize)
 void operator delete(void* obj) { (void)obj; }
 void operator delete(void* obj, unsigned int) { (void)obj; }
 
+void *GetHeapTop()
+{
+	if (heap == nullptr)
+	{
+		heap = (unsigned char *)&_end;
+	}
+	return heap;
+}
+
+void SetHeapTop(void *top)
+{
+	heap = static_cast<unsigned char *>(top);
+}
+
 static const uint32_t SramSizes[] =
 {
 	48 * 1024,
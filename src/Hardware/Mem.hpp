@@ -10,7 +10,7 @@
 #define MEM_H_
 
 #include <cstddef>
-#include "chipid.h"
+#include <cstdint>
 
 void* operator new(size_t objsize);
 
@@ -21,6 +21,10 @@ void InitMemory();
 uint32_t GetRamSize();
 uint32_t GetFreeMemory();
 
+// Nothing is ever freed, but a group of objects can be created again in the same memory by setting the top of the heap back to where it was when they were first created
+void *GetHeapTop();
+void SetHeapTop(void *top);
+
 #endif /* MEMH_H_ */
 
 // End
@@ -53,6 +53,10 @@ public:
 	{
 		return (port->PIO_PDSR & mask) != 0;
 	}
+
+	// Access to the port and mask, for code that has to drive the pin directly with precise timing
+	Pio *getPio() const { return port; }
+	uint32_t getMask() const { return mask; }
 	
 	static void delay(uint8_t del);
 	
@@ -12,6 +12,8 @@
 #include <General/CRC16.h>
 #include <General/String.h>
 #include <General/SafeVsnprintf.h>
+#include <General/SimpleMath.h>
+#include <Library/UnicodeComposer.hpp>
 
 #define DEBUG 0
 #include "Debug.hpp"
@@ -32,6 +34,9 @@ namespace SerialIo
 	uint8_t checksum = 0;
 	CRC16 crc;
 	volatile uint32_t timeLastCharacterReceived = 0;
+	volatile uint32_t timeLineStarted = 0;
+	static uint32_t lineQuietTime = DefaultLineQuietTime;
+	static volatile bool atLineStart = true;
 
 	enum CheckType {
 		None,
@@ -42,28 +47,7 @@ namespace SerialIo
 
 	static struct SerialIoCbs *cbs = nullptr;
 	static int serialIoErrors = 0;
-
-	// Translation tables for combining characters.
-	// The first character in each pair is the character that the combining mark is applied to.
-	// The second character is what is translates to if the value is >=0x80, else the value it translates to minus 0x0100.
-	const char* _ecv_array const trGrave =		"A\xC0"			"E\xC8" 				"I\xCC"         "O\xD2" "U\xD9"
-											"a\xE0"			"e\xE8" 				"i\xEC"			"o\xF2" "u\xF9"			;
-	const char* _ecv_array const trAcute =		"A\xC1" "C\x06" "E\xC9" 				"I\xCD" "L\x39" "N\x43" "O\xD3" "R\x54" "S\x5A" "U\xDA" "Y\xDD"	"Z\x79"
-											"a\xE1" "c\x07" "e\xE9" 				"i\xED" "l\x39"	"n\x44"	"o\xF3" "r\x55" "s\x5B" "u\xFA" "y\xFD" "z\x7a"	;
-	const char* _ecv_array const trCircumflex =	"A\xC2" "C\x08" "E\xCA" "G\x1C" "H\x24" "I\xCE" "J\x34"	"O\xD4" "S\x5C" "U\xDB" "W\x74" "Y\x76"
-											"a\xE2" "c\x09" "e\xEA" "g\x1D" "h\x25" "i\xEE" "j\x35"	"o\xF4" "s\x5D" "u\xFB"	"w\x75"	"y\x77"	;
-	const char* _ecv_array const trTilde =		"A\xC3"                 				"I\x28" "N\xD1" "O\xD5" "U\x68"
-											"a\xE3"                 				"i\x29"	"n\xF1"	"o\xF5"	"u\x69"			;
-	const char* _ecv_array const trBreve =		"A\x02"			"E\x14" "G\x1E" 		"I\x2C"			"O\x4E" "U\x6c"
-											"a\x03"			"e\x15" "g\x1F" 		"i\x2D"			"o\x4F" "u\x6d"			;
-	const char* _ecv_array const trUmlaut =		"A\xC4"			"E\xCB" 				"I\xCF"         "O\xD6" "U\xDC" "Y\x78"
-											"a\xE4"			"e\xEB" 				"i\xEF"			"o\xF6" "u\xFC" "y\xFF"	;
-	const char* _ecv_array const trCircle =		"A\xC5"															"U\x6E"
-											"a\xE5"                                 						"u\x6F"			;
-	const char* _ecv_array const trCaron =		"C\x0C"	"D\x0C" "E\x1A" "N\x47" "R\x58" "S\x60" "T\x64" "Z\x7D"
-											"c\x0D" "d\x0F" "e\x1B" "n\x48" "r\x59" "s\x61" "t\x65" "z\x7E"					;
-	const char* _ecv_array const trCedilla =		"C\xC7"
-											"c\xE7"																			;
+	static uint32_t pendingBaudRate = 0;			// the baud rate to change to once the current message has been received, or 0
 
 	// Initialize the serial I/O subsystem, or re-initialize it with a new baud rate
 	void Init(uint32_t baudRate, struct SerialIoCbs *callbacks)
@@ -91,11 +75,6 @@ namespace SerialIo
 		uart_enable_interrupt(UARTn, UART_IER_RXRDY | UART_IER_OVRE | UART_IER_FRAME);
 	}
 
-	void SetBaudRate(uint32_t baudRate)
-	{
-		Init(baudRate, cbs);
-	}
-
 	void SetCRC16(bool enable)
 	{
 		if (enable)
@@ -281,6 +260,7 @@ namespace SerialIo
 	// fieldId is the name of the field being received. A '^' character indicates the position of an _ecv_array index, and a ':' character indicates a field separator.
 	String<150> fieldId;
 	String<1028> fieldVal;
+	static UnicodeComposer composer;		// combines diacritical marks in fieldVal with the letters before them
 	size_t arrayIndices[MaxArrayNesting];
 	size_t arrayDepth = 0;
 
@@ -357,117 +337,16 @@ namespace SerialIo
 		}
 	}
 
-	// Look for combining characters in the string value and convert them if possible
-	static void ConvertUnicode()
+	static void StartStringValue()
 	{
-		unsigned int numContinuationBytesLeft = 0;
-		uint32_t charVal;
-		for (size_t i = 0; i < fieldVal.strlen(); )
-		{
-			const unsigned char c = fieldVal[i++];
-			if (numContinuationBytesLeft == 0)
-			{
-				if (c >= 0x80)
-				{
-					if ((c & 0xE0) == 0xC0)
-					{
-						charVal = (uint32_t)(c & 0x1F);
-						numContinuationBytesLeft = 1;
-					}
-					else if ((c & 0xF0) == 0xE0)
-					{
-						charVal = (uint32_t)(c & 0x0F);
-						numContinuationBytesLeft = 2;
-					}
-					else if ((c & 0xF8) == 0xF0)
-					{
-						charVal = (uint32_t)(c & 0x07);
-						numContinuationBytesLeft = 3;
-					}
-					else if ((c & 0xFC) == 0xF8)
-					{
-						charVal = (uint32_t)(c & 0x03);
-						numContinuationBytesLeft = 4;
-					}
-					else if ((c & 0xFE) == 0xFC)
-					{
-						charVal = (uint32_t)(c & 0x01);
-						numContinuationBytesLeft = 5;
-					}
-				}
-			}
-			else if ((c & 0xC0) == 0x80)
-			{
-				charVal = (charVal << 6) | (c & 0x3F);
-				--numContinuationBytesLeft;
-				if (numContinuationBytesLeft == 0)
-				{
-					const char* _ecv_array trtab;
-					switch(charVal)
-					{
-					case 0x0300:	// grave accent
-						trtab = trGrave;
-						break;
-					case 0x0301:	// acute accent
-						trtab = trAcute;
-						break;
-					case 0x0302:	// circumflex
-						trtab = trCircumflex;
-						break;
-					case 0x0303:	// tilde
-						trtab = trTilde;
-						break;
-					case 0x0306:	// breve
-						trtab = trBreve;
-						break;
-					case 0x0308:	// umlaut
-						trtab = trUmlaut;
-						break;
-					case 0x030A:	// small circle
-						trtab = trCircle;
-						break;
-					case 0x030C:	// caron
-						trtab = trCaron;
-						break;
-					case 0x0327:	// cedilla
-						trtab = trCedilla;
-						break;
-					default:
-						trtab = nullptr;
-						break;
-					}
+		fieldVal.Clear();
+		composer.Reset();
+	}
 
-					// If it is a diacritical mark that we handle, try to combine it with the previous character.
-					// The diacritical marks are in the range 03xx so they are encoded as 2 UTF8 bytes.
-					if (trtab != nullptr && i > 2)
-					{
-						const char c2 = fieldVal[i - 3];
-						while (*trtab != 0 && *trtab != c2)
-						{
-							trtab += 2;
-						}
-						if (*trtab != 0)
-						{
-							// Get the translated character and encode it as 2 UTF8 bytes
-							uint16_t c3 = (uint16_t)(uint8_t)trtab[1];
-							if (c3 < 0x80)
-							{
-								c3 |= 0x0100;
-							}
-							fieldVal[i - 3] = (c3 >> 6) | 0xC0;
-							fieldVal[i - 2] = (c3 & 0x3F) | 0x80;
-							fieldVal.Erase(i - 1);
-							--i;
-						}
-					}
-				}
-			}
-			else
-			{
-				// Bad UTF8 state
-				numContinuationBytesLeft = 0;
-			}
-		}
+	// Append a character of a string value. Return true if the value was truncated, like String::cat.
+	static bool AppendStringChar(char c)
+	{
+		return composer.Append(fieldVal, c);
 	}
 
 	// Check whether the incoming character signals the end of the value. If it does, process it and return true.
@@ -553,11 +432,24 @@ namespace SerialIo
 		}
 	}
 
+	// Change to the pending baud rate if there is one, once everything that we have sent has left the UART.
+	// uart_init resets the transmitter, which would lose the character being sent and the one waiting to be sent.
+	static void ApplyPendingBaudRate()
+	{
+		if (pendingBaudRate != 0)
+		{
+			while (uart_is_tx_empty(UARTn) == 0) { }
+			Init(pendingBaudRate, cbs);
+			pendingBaudRate = 0;
+		}
+	}
+
 	// This is the JSON parser state machine
 	void CheckInput()
 	{
 		while (nextIn != nextOut)
 		{
+
 			char c = rxBuffer[nextOut];
 			nextOut = (nextOut + 1) % rxBufsize;
 			if (c == '\n')
@@ -673,7 +565,7 @@ namespace SerialIo
 					case ' ':
 						break;
 					case '"':
-						fieldVal.Clear();
+						StartStringValue();
 						state = jsStringVal;
 						break;
 					case '[':
@@ -738,7 +630,6 @@ namespace SerialIo
 					switch (c)
 					{
 					case '"':
-						ConvertUnicode();
 						ProcessField();
 						state = jsEndVal;
 						break;
@@ -753,7 +644,7 @@ namespace SerialIo
 						}
 						else
 						{
-							fieldVal.cat(c);	// ignore any error so that long string parameters just get truncated
+							AppendStringChar(c);	// ignore any error so that long string parameters just get truncated
 						}
 						break;
 					}
@@ -767,7 +658,7 @@ namespace SerialIo
 						case '"':
 						case '\\':
 						case '/':
-							if (fieldVal.cat(c))
+							if (AppendStringChar(c))
 							{
 								state = jsError;
 								dbg("jsError: jsStringEscape 1");
@@ -775,7 +666,7 @@ namespace SerialIo
 							break;
 						case 'n':
 						case 't':
-							if (fieldVal.cat(' '))		// replace newline and tab by space
+							if (AppendStringChar(' '))		// replace newline and tab by space
 							{
 								state = jsError;
 								dbg("jsError: jsStringEscape 2");
@@ -909,6 +800,11 @@ namespace SerialIo
 				if (lastState != state) { dbg("state %d -> %d", lastState, state); }
 #endif
 			}
+
+			if (state == jsBegin)
+			{
+				ApplyPendingBaudRate();				// the message that asked for the change has ended
+			}
 		}
 	}
 
@@ -934,6 +830,11 @@ namespace SerialIo
 			}
 		}
 		timeLastCharacterReceived = SystemTick::GetTickCount();
+		if (atLineStart)
+		{
+			timeLineStarted = timeLastCharacterReceived;
+		}
+		atLineStart = (c == '\n');
 	}
 
 	// Called by the ISR to signify an error. We wait for the next end of line.
@@ -948,7 +849,29 @@ namespace SerialIo
 	bool SerialLineQuiet()
 	{
 		const uint32_t loc_timeLastCharacterReceived = timeLastCharacterReceived;		// capture this before we call mills() in case of an interrupt
-		return SystemTick::GetTickCount() - loc_timeLastCharacterReceived >= MinimumLineQuietTime;
+		return SystemTick::GetTickCount() - loc_timeLastCharacterReceived >= lineQuietTime;
+	}
+
+	void SetLineQuietTime(uint32_t quietTime)
+	{
+		lineQuietTime = quietTime;
+	}
+
+	// Change the baud rate. If we are part way through receiving a message then the rest of it is still coming at the old rate,
+	// so the change is made by CheckInput when the message has ended.
+	void SetBaudRate(uint32_t baudRate)
+	{
+		pendingBaudRate = baudRate;
+		if (state == jsBegin)
+		{
+			ApplyPendingBaudRate();
+		}
+	}
+
+	// Return the time at which we received the first character of the most recent line
+	uint32_t GetLineStartTime()
+	{
+		return timeLineStarted;
 	}
 }
 
@@ -38,6 +38,8 @@ namespace SerialIo
 	void SendFilename(const char * _ecv_array dir, const char * _ecv_array name);
 	void CheckInput();
 	bool SerialLineQuiet();
+	void SetLineQuietTime(uint32_t quietTime);
+	uint32_t GetLineStartTime();
 }
 
 #endif /* SERIALIO_H_ */
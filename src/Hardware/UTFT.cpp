@@ -50,20 +50,120 @@
 #undef min
 #undef max
 #include "UTFT.hpp"
+#include "Mem.hpp"
 #include "Configuration.hpp"
 #include "memorysaver.h"
-#include <cstring>			// for strchr
+#include <cstring>			// for strchr, memcmp and memcpy
+#include <algorithm>		// for std::min and std::max
 
 #define DEBUG 0
 #include "Debug.hpp"
 
+// memorysaver.h leaves only the controllers that we are built for. If that is just the CPLD or just the SSD1963 family
+// then the code that depends on the controller is compiled for that controller alone.
+#if defined(DISABLE_SSD1963_480) && defined(DISABLE_SSD1963_800) && !defined(DISABLE_CPLD_800)
+inline bool UTFT::isCpld() const { return true; }
+#elif defined(DISABLE_CPLD_800)
+inline bool UTFT::isCpld() const { return false; }
+#else
+inline bool UTFT::isCpld() const { return displayModel == CPLD_800; }
+#endif
+
+// Burst transfers.
+// Single writes use OneBitPort::pulseLow, which is slow enough for the display controller before its PLL has been started.
+// Blocks of pixel data are only written after initialisation, so for those we use a cycle-counted WR strobe unrolled several times.
+// Stores to the PIO take at least one clock each, so the padding below keeps WR low for at least 2 clocks at 64MHz (31ns)
+// and at least 4 clocks at 120MHz (33ns), and the whole write cycle at least twice that.
+#if SAM4S
+# define WR_LOW_PADDING		"nop\n nop\n nop\n"
+# define WR_HIGH_PADDING	"nop\n nop\n"
+#else
+# define WR_LOW_PADDING		"nop\n"
+# define WR_HIGH_PADDING	"nop\n"
+#endif
+
+static inline __attribute__((always_inline)) void BurstStrobe(Pio *pio, uint32_t mask)
+{
+	pio->PIO_CODR = mask;
+	asm volatile (WR_LOW_PADDING ::: "memory");
+	pio->PIO_SODR = mask;
+	asm volatile (WR_HIGH_PADDING ::: "memory");
+}
+
+static inline __attribute__((always_inline)) void BurstWrite(Pio *pio, uint32_t mask, uint16_t VHL)
+{
+# if SAM4S
+	PIOA->PIO_ODSR = (uint32_t)VHL << 16;
+# else
+	PIOA->PIO_ODSR = VHL;
+# endif
+	BurstStrobe(pio, mask);
+}
+
 // Write the previous 16-bit data again the specified number of times.
 // Only supported in 9 and 16 bit modes. Used to speed up setting large blocks of pixels to the same colour.
 void UTFT::LCD_Write_Again(uint32_t num)
 {
+#if UTFT_BUS_STATS
+	busStats.writes += num;
+#endif
+	Pio * const pio = portWR.getPio();
+	const uint32_t mask = portWR.getMask();
+	while (num >= 8)
+	{
+		BurstStrobe(pio, mask);
+		BurstStrobe(pio, mask);
+		BurstStrobe(pio, mask);
+		BurstStrobe(pio, mask);
+		BurstStrobe(pio, mask);
+		BurstStrobe(pio, mask);
+		BurstStrobe(pio, mask);
+		BurstStrobe(pio, mask);
+		num -= 8;
+	}
+	while (num != 0)
+	{
+		BurstStrobe(pio, mask);
+		--num;
+	}
+}
+
+// Write a block of 16-bit data from a buffer
+void UTFT::LCD_Write_Burst_DATA16(const uint16_t *data, uint32_t num)
+{
+#if UTFT_BAND_RENDERING
+	if (bandRows != 0)
+	{
+		bandWrite(data, 0, num);
+		return;
+	}
+#endif
+#if UTFT_HARDWARE_SCROLL
+	if (segPixelsLeft != 0)
+	{
+		scrollWrite(data, 0, num);
+		return;
+	}
+#endif
+#if UTFT_BUS_STATS
+	busStats.pixels += num;
+	busStats.writes += num;
+#endif
+	Pio * const pio = portWR.getPio();
+	const uint32_t mask = portWR.getMask();
+	portRS.setHigh();
+	while (num >= 4)
+	{
+		BurstWrite(pio, mask, data[0]);
+		BurstWrite(pio, mask, data[1]);
+		BurstWrite(pio, mask, data[2]);
+		BurstWrite(pio, mask, data[3]);
+		data += 4;
+		num -= 4;
+	}
 	while (num != 0)
 	{
-		portWR.pulseLow();
+		BurstWrite(pio, mask, *data++);
 		--num;
 	}
 }
@@ -79,7 +179,7 @@ UTFT::UTFT(DisplayType model, unsigned int RS, unsigned int WR, unsigned int CS,
 	: fcolour(0xFFFF), bcolour(0), transparentBackground(false),
 	  displayModel(model),
 	  portRS(RS), portWR(WR), portCS(CS), portRST(RST), portSDA(RS), portSCL(SER_LATCH),
-	  numContinuationBytesLeft(0)
+	  fixedDigits(false), digitWidth(0), digitWidthFont(nullptr), numContinuationBytesLeft(0), busStats{0, 0, 0, 0}
 {
 	switch (model)
 	{
@@ -141,6 +241,16 @@ UTFT::UTFT(DisplayType model, unsigned int RS, unsigned int WR, unsigned int CS,
 	portWR.setMode(OneBitPort::Output);
 	portCS.setMode(OneBitPort::Output);
 	portRST.setMode(OneBitPort::Output);
+
+#if UTFT_BAND_RENDERING
+	bandBuffer = nullptr;
+	bandLines = bandRows = 0;
+#endif
+#if UTFT_HARDWARE_SCROLL
+	canScroll = false;
+	scrollTop = scrollHeight = scrollOffset = 0;
+	segPixelsLeft = 0;
+#endif
 }
 
 inline void UTFT::LCD_Write_Bus(uint16_t VHL)
@@ -151,22 +261,62 @@ inline void UTFT::LCD_Write_Bus(uint16_t VHL)
 	PIOA->PIO_ODSR = VHL;
 # endif
 	portWR.pulseLow();
+#if UTFT_BUS_STATS
+	++busStats.writes;
+#endif
 }
 
 inline void UTFT::LCD_Write_COM(uint8_t VL)
 {
+#if UTFT_BUS_STATS
+	++busStats.commands;
+#endif
 	portRS.setLow();
 	LCD_Write_Bus((uint16_t)VL);
 }
 
 inline void UTFT::LCD_Write_DATA16(uint16_t VHL)
 {
+#if UTFT_BAND_RENDERING
+	if (bandRows != 0)
+	{
+		bandWrite(nullptr, VHL, 1);
+		return;
+	}
+#endif
+#if UTFT_HARDWARE_SCROLL
+	if (segPixelsLeft != 0)
+	{
+		scrollWrite(nullptr, VHL, 1);
+		return;
+	}
+#endif
+#if UTFT_BUS_STATS
+	++busStats.pixels;
+#endif
 	portRS.setHigh();
 	LCD_Write_Bus(VHL);
 }
 
 inline void UTFT::LCD_Write_Repeated_DATA16(uint16_t VHL, uint32_t num)
 {
+#if UTFT_BAND_RENDERING
+	if (bandRows != 0)
+	{
+		bandWrite(nullptr, VHL, num);
+		return;
+	}
+#endif
+#if UTFT_HARDWARE_SCROLL
+	if (segPixelsLeft != 0)
+	{
+		scrollWrite(nullptr, VHL, num);
+		return;
+	}
+#endif
+#if UTFT_BUS_STATS
+	busStats.pixels += num;
+#endif
 	portRS.setHigh();
 	LCD_Write_Bus(VHL);
 	LCD_Write_Again(num - 1);
@@ -180,11 +330,12 @@ void UTFT::LCD_Write_DATA8(uint8_t VL)
 	LCD_Write_Bus((uint16_t)VL);
 }
 
-// This one is used for setXY so we inline it
+// This one is used for setXY so we inline it. The data is a register value, not a pixel, so it goes straight to the bus.
 inline void UTFT::LCD_Write_COM_DATA16(uint8_t com1, uint16_t dat1)
 {
 	LCD_Write_COM(com1);
-	LCD_Write_DATA16(dat1);
+	portRS.setHigh();
+	LCD_Write_Bus(dat1);
 }
 
 void UTFT::setOrientation(DisplayOrientation o, bool isER, bool getCS)
@@ -194,6 +345,9 @@ void UTFT::setOrientation(DisplayOrientation o, bool isER, bool getCS)
 	{
 		assertCS();
 	}
+#if UTFT_HARDWARE_SCROLL
+	canScroll = false;
+#endif
 
 	switch(displayModel)
 	{
@@ -214,6 +368,9 @@ void UTFT::setOrientation(DisplayOrientation o, bool isER, bool getCS)
 			}
 			LCD_Write_DATA8(rotation);
 		}
+#if UTFT_HARDWARE_SCROLL
+		canScroll = (o & (SwapXY | ReverseY)) == 0;		// the scroll area is in frame buffer rows, so they must be the display rows
+#endif
 		break;
 #endif
 #ifndef DISABLE_SSD1963_800
@@ -233,11 +390,22 @@ void UTFT::setOrientation(DisplayOrientation o, bool isER, bool getCS)
 			}
 			LCD_Write_DATA8(rotation);
 		}
+#if UTFT_HARDWARE_SCROLL
+		canScroll = (o & (SwapXY | ReverseY)) == 0;		// the scroll area is in frame buffer rows, so they must be the display rows
+#endif
 		break;
 #endif
 	default:
 		break;
 	}
+#if UTFT_HARDWARE_SCROLL
+	if (scrollHeight != 0)
+	{
+		// The rows of the scroll area have changed, so remove it. The caller will redraw the display anyway.
+		scrollHeight = scrollOffset = 0;
+		setScrollRegisters();
+	}
+#endif
 	if (getCS)
 	{
 		removeCS();
@@ -1371,6 +1539,60 @@ void UTFT::InitLCD(DisplayOrientation po, bool is24bit, bool isER)
 
 void UTFT::setXY(uint16_t p_x1, uint16_t p_y1, uint16_t p_x2, uint16_t p_y2)
 {
+#if UTFT_BAND_RENDERING
+	if (bandRows != 0)
+	{
+		bandSetWindow(p_x1, p_y1, p_x2, p_y2);
+		return;
+	}
+#endif
+#if UTFT_HARDWARE_SCROLL
+	uint32_t pixelsInPart = 0;
+	segPixelsLeft = 0;
+	if (scrollOffset != 0)
+	{
+		// Map the rows of the window to the frame buffer rows displayed in their place. Those rows are contiguous except where the
+		// window crosses the top or bottom of the scroll area or the row at which it wraps round, so we split the window there.
+		const uint16_t scrollBottom = scrollTop + scrollHeight - 1;
+		const uint16_t wrapRow = scrollBottom - scrollOffset;
+		uint16_t partBottom = p_y2;
+		if (p_y1 < scrollTop && p_y2 >= scrollTop)
+		{
+			partBottom = scrollTop - 1;
+		}
+		else if (p_y1 <= wrapRow && p_y2 > wrapRow)
+		{
+			partBottom = wrapRow;
+		}
+		else if (p_y1 <= scrollBottom && p_y2 > scrollBottom)
+		{
+			partBottom = scrollBottom;
+		}
+
+		if (partBottom != p_y2)
+		{
+			segX1 = p_x1;
+			segY1 = partBottom + 1;
+			segX2 = p_x2;
+			segY2 = p_y2;
+			pixelsInPart = (uint32_t)(p_x2 - p_x1 + 1) * (uint32_t)(partBottom - p_y1 + 1);
+		}
+		if (p_y1 >= scrollTop && p_y1 <= scrollBottom)
+		{
+			const uint16_t rows = partBottom - p_y1;
+			const uint16_t row = p_y1 - scrollTop + scrollOffset;
+			p_y1 = scrollTop + ((row >= scrollHeight) ? row - scrollHeight : row);
+			p_y2 = p_y1 + rows;
+		}
+		else
+		{
+			p_y2 = partBottom;
+		}
+	}
+#endif
+#if UTFT_BUS_STATS
+	++busStats.windows;
+#endif
 	uint16_t x1, x2, y1, y2;
 	if (orient & SwapXY)
 	{
@@ -1420,29 +1642,27 @@ void UTFT::setXY(uint16_t p_x1, uint16_t p_y1, uint16_t p_x2, uint16_t p_y2)
 	}
 
 #if 1
-	switch(displayModel)
+	if (isCpld())
 	{
-		case CPLD_800:
-			LCD_Write_COM_DATA16(0x02, y1);	// start row register (0-480)
-			LCD_Write_COM_DATA16(0x03, x1);	// start column register (0-800)
-			LCD_Write_COM_DATA16(0x06, y2);	// end row register (0-480)
-			LCD_Write_COM_DATA16(0x07, x2);	// end column register (0-800)
-			LCD_Write_COM(0x0F);
-			break;
-
-		default:
-			// Optimised code supporting only the SSD1963
-			// In the following we use LCD_WRITE_BUS to write additional data without having to write RS again.
-			LCD_Write_COM_DATA16(0x2b, y1>>8);
-			LCD_Write_Bus(y1);
-			LCD_Write_Bus(y2>>8);
-			LCD_Write_Bus(y2);
-			LCD_Write_COM_DATA16(0x2a, x1>>8);
-			LCD_Write_Bus(x1);
-			LCD_Write_Bus(x2>>8);
-			LCD_Write_Bus(x2);
-			LCD_Write_COM(0x2c);
-			break;
+		LCD_Write_COM_DATA16(0x02, y1);	// start row register (0-480)
+		LCD_Write_COM_DATA16(0x03, x1);	// start column register (0-800)
+		LCD_Write_COM_DATA16(0x06, y2);	// end row register (0-480)
+		LCD_Write_COM_DATA16(0x07, x2);	// end column register (0-800)
+		LCD_Write_COM(0x0F);
+	}
+	else
+	{
+		// Optimised code supporting only the SSD1963
+		// In the following we use LCD_WRITE_BUS to write additional data without having to write RS again.
+		LCD_Write_COM_DATA16(0x2b, y1>>8);
+		LCD_Write_Bus(y1);
+		LCD_Write_Bus(y2>>8);
+		LCD_Write_Bus(y2);
+		LCD_Write_COM_DATA16(0x2a, x1>>8);
+		LCD_Write_Bus(x1);
+		LCD_Write_Bus(x2>>8);
+		LCD_Write_Bus(x2);
+		LCD_Write_COM(0x2c);
 	}
 #else
 
@@ -1569,6 +1789,9 @@ void UTFT::setXY(uint16_t p_x1, uint16_t p_y1, uint16_t p_x2, uint16_t p_y2)
 		break;
 	}
 #endif
+#if UTFT_HARDWARE_SCROLL
+	segPixelsLeft = pixelsInPart;			// set this last, because setting up the window writes data too
+#endif
 }
 
 void UTFT::drawRect(int x1, int y1, int x2, int y2)
@@ -1608,67 +1831,114 @@ void UTFT::drawRoundRect(int x1, int y1, int x2, int y2)
 	}
 	if ((x2-x1) > 4 && (y2-y1) > 4)
 	{
-		drawPixel(x1+1, y1+1);
-		drawPixel(x2-1, y1+1);
-		drawPixel(x1+1, y2-1);
-		drawPixel(x2-1, y2-1);
-		drawHLine(x1+2, y1, x2-x1-3);
-		drawHLine(x1+2, y2, x2-x1-3);
-		drawVLine(x1, y1+2, y2-y1-3);
-		drawVLine(x2, y1+2, y2-y1-3);
+		assertCS();
+		fillWindow(x1+1, y1+1, x1+1, y1+1, fcolour);
+		fillWindow(x2-1, y1+1, x2-1, y1+1, fcolour);
+		fillWindow(x1+1, y2-1, x1+1, y2-1, fcolour);
+		fillWindow(x2-1, y2-1, x2-1, y2-1, fcolour);
+		fillWindow(x1+2, y1, x2-2, y1, fcolour);
+		fillWindow(x1+2, y2, x2-2, y2, fcolour);
+		fillWindow(x1, y1+2, x1, y2-2, fcolour);
+		fillWindow(x2, y1+2, x2, y2-2, fcolour);
+		removeCS();
 	}
 }
 
-// Apply the specified gradient to the foreground color
+// Return the colour of line 'line' of a gradient that starts at the foreground colour and adds 'grad' every 'gradChange' lines.
 // Since this does no wrap-around-check the color and the gradient
 // have to be chosen such that there does not happen a wrap around
 // For the default light gradient UTFT::fromRGB(255-8-8, 255-8-4, 255-8)
 // this means a minimum of 32 for red and blue and 24 for green
 // and for default dark gradient UTFT::fromRGB(8, 8, 8)
 // this means maximum of 239 for r, g, b
-inline void UTFT::applyGradient(uint16_t grad)
+inline Colour UTFT::gradientColour(Colour grad, uint8_t gradChange, unsigned int line) const
 {
-	fcolour += grad;
+	return (Colour)(fcolour + grad * (line/gradChange));
 }
 
-void UTFT::fillRect(int x1, int y1, int x2, int y2, Colour grad, uint8_t gradChange)
+// Fill a rectangle with a single colour. CS must already be asserted.
+inline void UTFT::fillWindow(int x1, int y1, int x2, int y2, Colour c)
 {
-	if (x1>x2)
+	setXY(x1, y1, x2, y2);
+	LCD_Write_Repeated_DATA16(c, (uint32_t)(x2 - x1 + 1) * (uint32_t)(y2 - y1 + 1));
+}
+
+// Fill a rectangle with a gradient that changes every 'gradChange' columns if 'byCols' is true, else every 'gradChange' rows.
+// The first column or row is line 'firstLine' of the gradient. CS must already be asserted.
+// If the controller fills the window along the same lines as the gradient then we need just one window, with one run of colour
+// for each group of lines. Otherwise we need one window for each group of lines.
+void UTFT::fillGradient(int x1, int y1, int x2, int y2, unsigned int firstLine, Colour grad, uint8_t gradChange, bool byCols)
+{
+	if (x2 < x1 || y2 < y1)
 	{
-		swap(x1, x2);
+		return;
 	}
-	if (y1>y2)
+
+	if (grad == 0)
 	{
-		swap(y1, y2);
+		fillWindow(x1, y1, x2, y2, fcolour);
+		return;
 	}
 
-	Colour fcolourSave = fcolour;
-	uint8_t gradCount = 0;
-	if (orient & SwapXY)
+	const int lineStart = (byCols) ? x1 : y1;
+	const int lineEnd = (byCols) ? x2 : y2;
+	const DisplayOrientation order = fillOrder();
+	if (((order & SwapXY) != 0) == byCols)
 	{
-		for (int i = x1; i <= x2; i++)
+		const int numLines = lineEnd - lineStart + 1;
+		const uint32_t lineLength = (byCols) ? y2 - y1 + 1 : x2 - x1 + 1;
+		const bool reversed = (order & ((byCols) ? ReverseX : ReverseY)) != 0;
+		setXY(x1, y1, x2, y2);
+		Colour runColour = gradientColour(grad, gradChange, firstLine + ((reversed) ? numLines - 1 : 0));
+		uint32_t runLines = 0;
+		for (int i = 0; i < numLines; ++i)
 		{
-			drawVLine(i, y1, y2-y1+1);
-			if (++gradCount == gradChange)
+			const Colour c = gradientColour(grad, gradChange, firstLine + ((reversed) ? numLines - 1 - i : i));
+			if (c != runColour)
 			{
-				gradCount = 0;
-				applyGradient(grad);
+				LCD_Write_Repeated_DATA16(runColour, runLines * lineLength);
+				runColour = c;
+				runLines = 0;
 			}
+			++runLines;
 		}
+		LCD_Write_Repeated_DATA16(runColour, runLines * lineLength);
 	}
 	else
 	{
-		for (int i = y1; i <= y2; i++)
+		unsigned int line = firstLine;
+		for (int start = lineStart; start <= lineEnd; )
 		{
-			drawHLine(x1, i, x2-x1+1);
-			if (++gradCount == gradChange)
+			const int end = std::min<int>(lineEnd, start + (gradChange - 1 - line % gradChange));
+			const Colour c = gradientColour(grad, gradChange, line);
+			if (byCols)
+			{
+				fillWindow(start, y1, end, y2, c);
+			}
+			else
 			{
-				gradCount = 0;
-				applyGradient(grad);
+				fillWindow(x1, start, x2, end, c);
 			}
+			line += end - start + 1;
+			start = end + 1;
 		}
 	}
-	fcolour = fcolourSave;
+}
+
+void UTFT::fillRect(int x1, int y1, int x2, int y2, Colour grad, uint8_t gradChange)
+{
+	if (x1>x2)
+	{
+		swap(x1, x2);
+	}
+	if (y1>y2)
+	{
+		swap(y1, y2);
+	}
+
+	assertCS();
+	fillGradient(x1, y1, x2, y2, 0, grad, gradChange, (orient & SwapXY) != 0);
+	removeCS();
 }
 
 void UTFT::fillRoundRect(int x1, int y1, int x2, int y2, Colour grad, uint8_t gradChange)
@@ -1684,46 +1954,20 @@ void UTFT::fillRoundRect(int x1, int y1, int x2, int y2, Colour grad, uint8_t gr
 
 	if ((x2-x1) > 4 && (y2-y1) > 4)
 	{
-		Colour fcolourSave = fcolour;
-		uint8_t gradCount = 0;
-
-		drawHLine(x1+2, y1, x2-x1-3);
-		++y1;
-		if (++gradCount == gradChange)
-		{
-			gradCount = 0;
-			applyGradient(grad);
-		}
-		drawHLine(x1+1, y1, x2-x1-1);
-		++y1;
-		if (++gradCount == gradChange)
-		{
-			gradCount = 0;
-			applyGradient(grad);
-		}
-		while (y1 + 1 < y2)
-		{
-			drawHLine(x1, y1, x2-x1+1);
-			++y1;
-			if (++gradCount == gradChange)
-			{
-				gradCount = 0;
-				applyGradient(grad);
-			}
-		}
-		drawHLine(x1+1, y1, x2-x1-1);
-		++y1;
-		if (++gradCount == gradChange)
-		{
-			gradCount = 0;
-			applyGradient(grad);
-		}
-		drawHLine(x1+2, y1, x2-x1-3);
-
-		fcolour = fcolourSave;
+		// The top two and bottom two rows are shortened to round the corners
+		const unsigned int lastLine = y2 - y1;
+		assertCS();
+		fillWindow(x1+2, y1, x2-2, y1, fcolour);
+		fillWindow(x1+1, y1+1, x2-1, y1+1, gradientColour(grad, gradChange, 1));
+		fillGradient(x1, y1+2, x2, y2-2, 2, grad, gradChange, false);
+		fillWindow(x1+1, y2-1, x2-1, y2-1, gradientColour(grad, gradChange, lastLine - 1));
+		fillWindow(x1+2, y2, x2-2, y2, gradientColour(grad, gradChange, lastLine));
+		removeCS();
 	}
 }
 
+// Draw a circle using the midpoint algorithm. Points in the same octant that share a row or column are drawn as one span,
+// so we need a window for each step of the minor coordinate instead of one for each pixel.
 void UTFT::drawCircle(int x, int y, int radius)
 {
 	int f = 1 - radius;
@@ -1731,48 +1975,41 @@ void UTFT::drawCircle(int x, int y, int radius)
 	int ddF_y = -2 * radius;
 	int x1 = 0;
 	int y1 = radius;
+	int runStart = 0;				// the value of x1 at the start of the current run of points with the same y1
 
 	assertCS();
-	setXY(x, y + radius, x, y + radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x, y - radius, x, y - radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x + radius, y, x + radius, y);
-	LCD_Write_DATA16(fcolour);
-	setXY(x - radius, y, x - radius, y);
-	LCD_Write_DATA16(fcolour);
-
-	while(x1 < y1)
+	for (;;)
 	{
-		if(f >= 0)
+		const bool done = (x1 >= y1);
+		if (done || f >= 0)
 		{
+			// y1 is about to change or we have finished, so draw the run in all eight octants
+			fillWindow(x + runStart, y + y1, x + x1, y + y1, fcolour);
+			fillWindow(x - x1, y + y1, x - runStart, y + y1, fcolour);
+			fillWindow(x + runStart, y - y1, x + x1, y - y1, fcolour);
+			fillWindow(x - x1, y - y1, x - runStart, y - y1, fcolour);
+			fillWindow(x + y1, y + runStart, x + y1, y + x1, fcolour);
+			fillWindow(x - y1, y + runStart, x - y1, y + x1, fcolour);
+			fillWindow(x + y1, y - x1, x + y1, y - runStart, fcolour);
+			fillWindow(x - y1, y - x1, x - y1, y - runStart, fcolour);
+			if (done)
+			{
+				break;
+			}
 			y1--;
 			ddF_y += 2;
 			f += ddF_y;
+			runStart = x1 + 1;
 		}
 		x1++;
 		ddF_x += 2;
 		f += ddF_x;
-		setXY(x + x1, y + y1, x + x1, y + y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - x1, y + y1, x - x1, y + y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x + x1, y - y1, x + x1, y - y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - x1, y - y1, x - x1, y - y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x + y1, y + x1, x + y1, y + x1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - y1, y + x1, x - y1, y + x1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x + y1, y - x1, x + y1, y - x1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - y1, y - x1, x - y1, y - x1);
-		LCD_Write_DATA16(fcolour);
 	}
 	removeCS();
 }
 
+// Fill a circle using the midpoint algorithm, drawing each row once as a single span.
+// Rows y +/- x1 are drawn as x1 increases. Rows y +/- y1 are drawn just before y1 changes, when they are at their widest.
 void UTFT::fillCircle(int x, int y, int radius)
 {
 	int f = 1 - radius;
@@ -1782,17 +2019,21 @@ void UTFT::fillCircle(int x, int y, int radius)
 	int y1 = radius;
 
 	assertCS();
-	setXY(x, y + radius, x, y + radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x, y - radius, x, y - radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x - radius, y, x + radius, y);
-	LCD_Write_Repeated_DATA16(fcolour, radius + radius);
-
-	while(x1 < y1)
+	fillWindow(x - radius, y, x + radius, y, fcolour);
+	for (;;)
 	{
-		if(f >= 0)
+		const bool done = (x1 >= y1);
+		if (done || f >= 0)
 		{
+			if (y1 > x1)
+			{
+				fillWindow(x - x1, y + y1, x + x1, y + y1, fcolour);
+				fillWindow(x - x1, y - y1, x + x1, y - y1, fcolour);
+			}
+			if (done)
+			{
+				break;
+			}
 			y1--;
 			ddF_y += 2;
 			f += ddF_y;
@@ -1800,14 +2041,8 @@ void UTFT::fillCircle(int x, int y, int radius)
 		x1++;
 		ddF_x += 2;
 		f += ddF_x;
-		setXY(x - x1, y + y1, x + x1, y + y1);
-		LCD_Write_Repeated_DATA16(fcolour, x1 + x1);
-		setXY(x - x1, y - y1, x + x1, y - y1);
-		LCD_Write_Repeated_DATA16(fcolour, x1 + x1);
-		setXY(x - y1, y + x1, x + y1, y + x1);
-		LCD_Write_Repeated_DATA16(fcolour, y1 + y1);
-		setXY(x - y1, y - x1, x + y1, y - x1);
-		LCD_Write_Repeated_DATA16(fcolour, y1 + y1);
+		fillWindow(x - y1, y + x1, x + y1, y + x1, fcolour);
+		fillWindow(x - y1, y - x1, x + y1, y - x1, fcolour);
 	}
 	removeCS();
 }
@@ -1849,20 +2084,34 @@ void UTFT::drawLine(int x1, int y1, int x2, int y2)
 	}
 	else
 	{
-		// Draw a line using the Bresenham Algorithm (thanks Wikipedia)
+		// Draw a line using the Bresenham Algorithm (thanks Wikipedia).
+		// Consecutive points that differ only in the major coordinate are drawn as one span.
 		int dx = (x2 >= x1) ? x2 - x1 : x1 - x2;
 		int dy = (y2 >= y1) ? y2 - y1 : y1 - y2;
 		int sx = (x1 < x2) ? 1 : -1;
 		int sy = (y1 < y2) ? 1 : -1;
 		int err = dx - dy;
+		const bool xMajor = (dx >= dy);
+		int runStart = (xMajor) ? x1 : y1;
 
 		assertCS();
 		for (;;)
 		{
-			setXY(x1, y1, x1, y1);
-			LCD_Write_DATA16(fcolour);
-			if (x1 == x2 && y1 == y2) break;
+			const bool done = (x1 == x2 && y1 == y2);
 			int e2 = err + err;
+			const bool minorStep = (xMajor) ? e2 < dx : e2 > -dy;
+			if (done || minorStep)
+			{
+				if (xMajor)
+				{
+					fillWindow(std::min<int>(runStart, x1), y1, std::max<int>(runStart, x1), y1, fcolour);
+				}
+				else
+				{
+					fillWindow(x1, std::min<int>(runStart, y1), x1, std::max<int>(runStart, y1), fcolour);
+				}
+				if (done) break;
+			}
 			if (e2 > -dy)
 			{
 				err -= dy;
@@ -1873,6 +2122,10 @@ void UTFT::drawLine(int x1, int y1, int x2, int y2)
 				err += dx;
 				y1 += sy;
 			}
+			if (minorStep)
+			{
+				runStart = (xMajor) ? x1 : y1;
+			}
 		}
 		removeCS();
 	}
@@ -1927,6 +2180,47 @@ int UTFT::printf(const char* fmt, ...) noexcept
 	return ret;
 }
 
+// Start measuring text. We do this by putting the text position below the bottom of the display.
+void UTFT::startMeasuring(uint16_t maxWidth)
+{
+	setTextPos(0, getDisplayYSize(), maxWidth);
+}
+
+uint16_t UTFT::measureText(const char *s, uint16_t maxWidth, size_t maxBytes)
+{
+	startMeasuring(maxWidth);
+	numContinuationBytesLeft = 0;
+	while (maxBytes != 0 && *s != 0)
+	{
+		write(*s++);
+		--maxBytes;
+	}
+	numContinuationBytesLeft = 0;				// in case we stopped part way through a UTF8 sequence
+	return textXpos;
+}
+
+// Return the number of bytes at the start of s that make up whole characters and can be printed within maxWidth pixels
+size_t UTFT::fitText(const char *s, uint16_t maxWidth, size_t maxBytes)
+{
+	startMeasuring(maxWidth + 1);				// allow the text to go one pixel over, so that we can tell when it doesn't fit
+	numContinuationBytesLeft = 0;
+	size_t fit = 0;
+	for (size_t i = 0; i < maxBytes && s[i] != 0; ++i)
+	{
+		write(s[i]);
+		if (numContinuationBytesLeft == 0)
+		{
+			if (textXpos > maxWidth)
+			{
+				break;
+			}
+			fit = i + 1;
+		}
+	}
+	numContinuationBytesLeft = 0;
+	return fit;
+}
+
 void UTFT::clearToMargin()
 {
 	if (textXpos < textRightMargin)
@@ -2014,24 +2308,14 @@ size_t UTFT::write(uint8_t c)
 // If textYpos is off the end of the display, then don't write anything, just update textXpos and lastCharColData
 size_t UTFT::writeNative(uint16_t c)
 {
-    if (c < cfont.firstChar || c > cfont.lastChar)
-    {
-		c = 0x007F;			// replace unsupported characters by square box
-    }
-#if USE_CYRILLIC_CHARACTERS
-    else if (c >= 1025 && c <= 1169)
-    {
-    	c -= 641;				// Cyrillic characters are shifted down to save space
-    }
-#elif USE_JAPANESE_CHARACTERS
-    else if (c >= 12352 && c <= 12543)		//0x3040 - 0x309F : Hiragana(ja), 0x30A0 - 0x30FF : Katakana(ja)
-    {
-    	c -= 11968;				// Japanese characters are shifted down to save space
-    }
-#endif
+	uint16_t glyph = findGlyph(c);
+	if (glyph == NoGlyph)
+	{
+		c = 0x007F;				// replace unsupported characters by square box
+		glyph = findGlyph(c);
+	}
 
 	uint8_t ySize = cfont.y_size;
-    const uint8_t bytesPerColumn = (ySize + 7)/8;
 	if (textYpos >= getDisplayYSize())
 	{
 		ySize = 0;
@@ -2040,13 +2324,64 @@ size_t UTFT::writeNative(uint16_t c)
 	{
 		ySize = getDisplayYSize() - textYpos;
 	}
-    const uint8_t bytesPerChar = (bytesPerColumn * cfont.x_size) + 1;
-    const uint8_t *fontPtr = (const uint8_t*)cfont.font + (bytesPerChar * (c - cfont.firstChar));
-
+	// Find the width of the character, the columns that it is kerned on, and its column data.
+	// Packed fonts have a table of the widths and kerning columns, so we only unpack a character if we are going to draw it.
+	// Packed characters are unpacked to one 32-bit word per column.
 	const uint32_t cmask = (1UL << cfont.y_size) - 1;
+	uint32_t unpacked[MaxFontColumns];
+	const uint8_t *fontPtr;
+	uint8_t bytesPerColumn;
+	uint8_t nCols;
+	uint32_t firstColData, lastColData;
+	if (cfont.format != FontFormatBitmap)
+	{
+		const uint8_t *metrics = cfont.glyphMetrics + 3 * glyph;
+		nCols = std::min<uint8_t>(metrics[0], MaxFontColumns);
+		firstColData = getEdge(metrics[1]);
+		lastColData = getEdge(metrics[2]);
+		if (ySize != 0)
+		{
+			unpackGlyph(glyph, unpacked);
+		}
+		fontPtr = reinterpret_cast<const uint8_t*>(unpacked);
+		bytesPerColumn = sizeof(uint32_t);
+	}
+	else
+	{
+		bytesPerColumn = (cfont.y_size + 7)/8;
+		const uint8_t bytesPerChar = (bytesPerColumn * cfont.x_size) + 1;
+		fontPtr = (const uint8_t*)cfont.font + (bytesPerChar * glyph);
+		nCols = *fontPtr++;
+		firstColData = *(uint32_t*)(fontPtr) & cmask;    // atmega328p is little-endian
+		if (firstColData == 0)  // for characters with deliberate space row at the start, e.g. decimal point
+		{
+			firstColData = *(uint32_t*)(fontPtr + bytesPerColumn) & cmask;	// get the next column instead
+		}
+		lastColData = 0;
+		for (uint8_t col = nCols; col != 0 && lastColData == 0; )
+		{
+			--col;
+			lastColData = *(uint32_t*)(fontPtr + col * bytesPerColumn) & cmask;
+		}
+	}
 
-    uint8_t nCols = *(uint8_t*)(fontPtr++);
-	assertCS();
+	if (ySize != 0)
+	{
+		assertCS();
+	}
+
+	// Fixed width digits are centred in the width of the widest digit
+	const bool fixedWidth = fixedDigits && c >= '0' && c <= '9';
+	uint8_t padLeft = 0, padRight = 0;
+	if (fixedWidth)
+	{
+		const uint8_t width = getDigitWidth();
+		if (width > nCols)
+		{
+			padLeft = (width - nCols)/2;
+			padRight = width - nCols - padLeft;
+		}
+	}
 
 	if (lastCharColData != 0)	// if we have written anything other than spaces
 	{
@@ -2055,108 +2390,365 @@ size_t UTFT::writeNative(uint16_t c)
 		// Decide whether to add the full number of space columns first (auto-kerning)
 		// We don't add a space column before a space character.
 		// We add a space column after a space character if we would have added one between the preceding and following characters.
-		uint32_t thisCharColData = *(uint32_t*)(fontPtr) & cmask;    // atmega328p is little-endian
-		if (thisCharColData == 0)  // for characters with deliberate space row at the start, e.g. decimal point
+		const bool kern = (numSpaces >= 2)
+						? ((firstColData & lastCharColData) == 0)
+						: (((firstColData | (firstColData << 1)) & (lastCharColData | (lastCharColData << 1))) == 0);
+		if (kern && !fixedWidth)
 		{
-			thisCharColData = *(uint32_t*)(fontPtr + bytesPerColumn) & cmask;	// get the next column instead
+			--numSpaces;	// kern the character pair
 		}
+		writeSpaceColumns(numSpaces, ySize);
+	}
+	writeSpaceColumns(padLeft, ySize);
 
-		const bool kern = (numSpaces >= 2)
-						? ((thisCharColData & lastCharColData) == 0)
-						: (((thisCharColData | (thisCharColData << 1)) & (lastCharColData | (lastCharColData << 1))) == 0);
-		if (kern)
+	if (ySize == 0)
+	{
+		// We are only measuring the text, or it is off the display. Skip to the end of the character.
+		// If it doesn't all fit then the next character won't either, so we don't need to find the last visible column with ink in it.
+		const uint8_t colsToSkip = (textXpos >= textRightMargin) ? 0 : (uint8_t)std::min<unsigned int>(nCols, textRightMargin - textXpos);
+		if (colsToSkip != 0 && lastColData != 0)
 		{
-			--numSpaces;	// kern the character pair
+			lastCharColData = lastColData;
 		}
-		while (numSpaces != 0 && textXpos < textRightMargin)
+		textXpos += colsToSkip;
+	}
+	else if (nCols != 0 && ySize == cfont.y_size && textXpos + nCols <= textRightMargin && drawCachedGlyph(c, fontPtr, nCols, bytesPerColumn, cmask))
+	{
+		// The whole character fitted, so we drew it from the glyph cache
+		textXpos += nCols;
+	}
+	else
+	{
+		while (nCols != 0 && textXpos < textRightMargin)
 		{
-			// Add a single space column after the character
-			if (ySize != 0 && !transparentBackground)
+			uint32_t colData = *(uint32_t*)(fontPtr);
+			fontPtr += bytesPerColumn;
+			if (colData != 0)
 			{
-				setXY(textXpos, textYpos, textXpos, textYpos + ySize - 1);
-				LCD_Write_Repeated_DATA16(bcolour, ySize);
+				lastCharColData = colData & cmask;
 			}
+			drawGlyphColumn(colData, ySize);
+			--nCols;
 			++textXpos;
-			--numSpaces;
 		}
 	}
 
-    while (nCols != 0 && textXpos < textRightMargin)
-    {
-		uint32_t colData = *(uint32_t*)(fontPtr);
-		fontPtr += bytesPerColumn;
-		if (colData != 0)
+	if (fixedWidth)
+	{
+		writeSpaceColumns(padRight, ySize);
+		lastCharColData = cmask;			// so that the next character isn't kerned against the digit either
+	}
+	if (ySize != 0)
+	{
+		removeCS();
+	}
+	return 1;
+}
+
+// Write background columns after a character, or just advance the text position if ySize is zero
+void UTFT::writeSpaceColumns(uint8_t numColumns, uint8_t ySize)
+{
+	while (numColumns != 0 && textXpos < textRightMargin)
+	{
+		if (ySize != 0 && !transparentBackground)
 		{
-			lastCharColData = colData & cmask;
+			setXY(textXpos, textYpos, textXpos, textYpos + ySize - 1);
+			LCD_Write_Repeated_DATA16(bcolour, ySize);
 		}
-		if (ySize != 0)
+		++textXpos;
+		--numColumns;
+	}
+}
+
+static inline uint16_t getLE16(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+// Return the index of the glyph for character c in the current font, or NoGlyph if the font doesn't have one
+uint16_t UTFT::findGlyph(uint16_t c) const
+{
+	if (cfont.format == FontFormatSparse)
+	{
+		// The ranges are in ascending order of character code, so do a binary search
+		uint16_t low = 0, high = cfont.numRanges;
+		while (low < high)
 		{
-			bool doSetXY = true;
-			if (orient & InvertText)
+			const uint16_t mid = (low + high)/2;
+			const uint8_t *range = cfont.ranges + 6 * mid;
+			if (c < getLE16(range))
 			{
-				uint32_t mask = 1u << (ySize - 1);
-				for (uint8_t i = 0; i < ySize; ++i)
-				{
-					if (colData & mask)
-					{
-						if (doSetXY)
-						{
-							setXY(textXpos, textYpos, textXpos, textYpos + ySize - i - 1);
-							doSetXY = false;
-						}
-						LCD_Write_DATA16(fcolour);
-					}
-					else if (transparentBackground)
-					{
-						doSetXY = true;
-					}
-					else
-					{
-						if (doSetXY)
-						{
-							setXY(textXpos, textYpos, textXpos, textYpos + ySize - i - 1);
-							doSetXY = false;
-						}
-						LCD_Write_DATA16(bcolour);
-					}
-					colData <<= 1;
-				}
+				high = mid;
+			}
+			else if (c > getLE16(range + 2))
+			{
+				low = mid + 1;
 			}
 			else
 			{
-				for (uint8_t i = 0; i < ySize; ++i)
+				return getLE16(range + 4) + (c - getLE16(range));
+			}
+		}
+		return NoGlyph;
+	}
+
+#if USE_CYRILLIC_CHARACTERS
+	if (c >= 1025 && c <= 1169)
+	{
+		c -= 641;				// Cyrillic characters are shifted down to save space
+	}
+#elif USE_JAPANESE_CHARACTERS
+	if (c >= 12352 && c <= 12543)		//0x3040 - 0x309F : Hiragana(ja), 0x30A0 - 0x30FF : Katakana(ja)
+	{
+		c -= 11968;				// Japanese characters are shifted down to save space
+	}
+#endif
+	return (c < cfont.firstChar || c > cfont.lastChar) ? NoGlyph : c - cfont.firstChar;
+}
+
+// Return the number of columns used by a glyph of the current font
+uint8_t UTFT::glyphColumns(uint16_t index) const
+{
+	if (cfont.format != FontFormatBitmap)
+	{
+		return std::min<uint8_t>(cfont.glyphMetrics[3 * index], MaxFontColumns);
+	}
+	const uint8_t bytesPerChar = (((cfont.y_size + 7)/8) * cfont.x_size) + 1;
+	return cfont.font[bytesPerChar * index];
+}
+
+// Return the data of one of the kerning columns of the current font, which must be a packed one
+uint32_t UTFT::getEdge(uint8_t edge) const
+{
+	const unsigned int bytesPerColumn = (cfont.y_size + 7)/8;
+	const uint8_t *p = cfont.edges + bytesPerColumn * edge;
+	uint32_t colData = 0;
+	for (unsigned int i = bytesPerColumn; i != 0; )
+	{
+		--i;
+		colData = (colData << 8) | p[i];
+	}
+	return colData;
+}
+
+// Return the width that digits are padded to when fixed width digits are enabled, which is the width of the widest digit in the current font
+uint8_t UTFT::getDigitWidth()
+{
+	if (digitWidthFont != cfont.font)
+	{
+		digitWidth = 0;
+		for (uint16_t c = '0'; c <= '9'; ++c)
+		{
+			const uint16_t glyph = findGlyph(c);
+			if (glyph != NoGlyph)
+			{
+				digitWidth = std::max<uint8_t>(digitWidth, glyphColumns(glyph));
+			}
+		}
+		digitWidthFont = cfont.font;
+	}
+	return digitWidth;
+}
+
+// Unpack a character of a packed font to one word per column, with the top row in bit 0. Return the number of columns.
+// See Tools/fontpack/fontpack.py for a description of the format.
+uint8_t UTFT::unpackGlyph(uint16_t index, uint32_t *columns) const
+{
+	const uint8_t *p = cfont.glyphData + getLE16(cfont.glyphIndex + 2 * index);
+	const uint8_t nCols = glyphColumns(index);
+	const unsigned int ySize = cfont.y_size;
+	for (uint8_t col = 0; col < nCols; ++col)
+	{
+		if (*p == 0)
+		{
+			columns[col] = (col == 0) ? 0 : columns[col - 1];
+			++p;
+			continue;
+		}
+
+		// Each byte holds a run of background pixels in the low nibble and a run of foreground pixels in the high nibble
+		uint32_t colData = 0;
+		unsigned int row = 0;
+		do
+		{
+			const uint8_t runs = *p++;
+			row += runs & 0x0F;
+			const unsigned int fgRun = runs >> 4;
+			if (fgRun != 0)
+			{
+				colData |= ((1u << fgRun) - 1) << row;
+				row += fgRun;
+			}
+		} while (row < ySize);
+		columns[col] = colData;
+	}
+	return nCols;
+}
+
+// Draw one column of a character at the current text position, as runs of foreground and background pixels
+void UTFT::drawGlyphColumn(uint32_t colData, uint8_t ySize)
+{
+	if (ySize < 32)
+	{
+		colData &= (1u << ySize) - 1;
+	}
+
+	if (transparentBackground)
+	{
+		// Each foreground run needs its own window
+		while (colData != 0)
+		{
+			const unsigned int start = __builtin_ctz(colData);
+			const uint32_t rest = ~(colData >> start);
+			const unsigned int length = (rest == 0) ? 32 : __builtin_ctz(rest);
+			setXY(textXpos, textYpos + start, textXpos, textYpos + start + length - 1);
+			LCD_Write_Repeated_DATA16(fcolour, length);
+			colData &= (length == 32) ? 0 : ~(((1u << length) - 1) << start);
+		}
+		return;
+	}
+
+	// With an opaque background the whole column is one window. Put the first pixel that the controller will fill in bit 0.
+	setXY(textXpos, textYpos, textXpos, textYpos + ySize - 1);
+	if (orient & InvertText)
+	{
+		colData = __RBIT(colData) >> (32 - ySize);
+	}
+	for (unsigned int left = ySize; left != 0; )
+	{
+		const bool foreground = (colData & 1u) != 0;
+		const uint32_t bits = (foreground) ? ~colData : colData;
+		const unsigned int length = (bits == 0) ? left : std::min<unsigned int>(__builtin_ctz(bits), left);
+		LCD_Write_Repeated_DATA16((foreground) ? fcolour : bcolour, length);
+		colData = (length == 32) ? 0 : colData >> length;
+		left -= length;
+	}
+}
+
+// Convert a glyph to runs of foreground and background pixels in the current fill order, and store them in a glyph cache entry.
+// If the glyph needs too many runs then the entry is left with no runs, so that we don't try to convert it again.
+void UTFT::rasteriseGlyph(GlyphCache::Glyph& g, const uint8_t *fontPtr, uint8_t nCols, uint8_t bytesPerColumn, uint32_t cmask)
+{
+	g.hasInk = false;
+	for (uint8_t col = 0; col < nCols; ++col)
+	{
+		const uint32_t colData = *(const uint32_t*)(fontPtr + col * bytesPerColumn);
+		if (colData != 0)
+		{
+			g.lastColData = colData & cmask;
+			g.hasInk = true;
+		}
+	}
+
+	const DisplayOrientation order = fillOrder();
+	const bool byCols = (order & SwapXY) != 0;
+	const int ySize = cfont.y_size;
+	const int numLines = (byCols) ? nCols : ySize;
+	const int lineLength = (byCols) ? ySize : nCols;
+	const int colStart = (order & ReverseX) ? nCols - 1 : 0;
+	const int colStep = (order & ReverseX) ? -1 : 1;
+	const int rowStart = (order & ReverseY) ? ySize - 1 : 0;
+	const int rowStep = (order & ReverseY) ? -1 : 1;
+
+	size_t numRuns = 0;
+	size_t runLength = 0;
+	bool runIsForeground = false;
+	for (int line = 0; line < numLines; ++line)
+	{
+		for (int pos = 0; pos < lineLength; ++pos)
+		{
+			const int col = (byCols) ? colStart + line * colStep : colStart + pos * colStep;
+			const int row = (byCols) ? rowStart + pos * rowStep : rowStart + line * rowStep;
+			const bool isForeground = ((*(const uint32_t*)(fontPtr + col * bytesPerColumn) >> row) & 1u) != 0;
+			if (runLength != 0 && (isForeground != runIsForeground || runLength == GlyphCache::MaxRunLength))
+			{
+				if (numRuns == GlyphCache::MaxRuns)
 				{
-					if (colData & 1u)
-					{
-						if (doSetXY)
-						{
-							setXY(textXpos, textYpos + i, textXpos, textYpos + ySize - 1);
-							doSetXY = false;
-						}
-						LCD_Write_DATA16(fcolour);
-					}
-					else if (transparentBackground)
-					{
-						doSetXY = true;
-					}
-					else
+					g.numRuns = 0;
+					return;
+				}
+				g.runs[numRuns++] = ((runIsForeground) ? GlyphCache::ForegroundRun : 0) | (uint8_t)(runLength - 1);
+				runLength = 0;
+			}
+			runIsForeground = isForeground;
+			++runLength;
+		}
+	}
+
+	if (numRuns == GlyphCache::MaxRuns)
+	{
+		g.numRuns = 0;
+		return;
+	}
+	g.runs[numRuns++] = ((runIsForeground) ? GlyphCache::ForegroundRun : 0) | (uint8_t)(runLength - 1);
+	g.numRuns = numRuns;
+}
+
+// Draw a whole character at the current text position from the glyph cache, converting it first if it is not already cached.
+// With an opaque background the character needs just one window. With a transparent one, each foreground run needs a window per line it covers.
+// Return false without drawing anything if the glyph is too complicated to cache.
+bool UTFT::drawCachedGlyph(uint16_t c, const uint8_t *fontPtr, uint8_t nCols, uint8_t bytesPerColumn, uint32_t cmask)
+{
+	const DisplayOrientation order = fillOrder();
+	bool found;
+	GlyphCache::Glyph& g = glyphCache.Lookup(cfont.font, c, order, found);
+	if (!found)
+	{
+		rasteriseGlyph(g, fontPtr, nCols, bytesPerColumn, cmask);
+	}
+	if (g.numRuns == 0)
+	{
+		return false;
+	}
+
+	if (g.hasInk)
+	{
+		lastCharColData = g.lastColData;
+	}
+
+	const int ySize = cfont.y_size;
+	if (!transparentBackground)
+	{
+		setXY(textXpos, textYpos, textXpos + nCols - 1, textYpos + ySize - 1);
+		for (size_t i = 0; i < g.numRuns; ++i)
+		{
+			const uint8_t run = g.runs[i];
+			LCD_Write_Repeated_DATA16((run & GlyphCache::ForegroundRun) ? fcolour : bcolour, (run & ~GlyphCache::ForegroundRun) + 1);
+		}
+	}
+	else
+	{
+		const int lineLength = (order & SwapXY) ? ySize : nCols;
+		int line = 0, pos = 0;
+		for (size_t i = 0; i < g.numRuns; ++i)
+		{
+			const uint8_t run = g.runs[i];
+			int runLength = (run & ~GlyphCache::ForegroundRun) + 1;
+			if (run & GlyphCache::ForegroundRun)
+			{
+				while (runLength != 0)
+				{
+					const int len = std::min<int>(runLength, lineLength - pos);
+					setLineWindow(textXpos, textYpos, nCols, ySize, order, line, pos, len);
+					LCD_Write_Repeated_DATA16(fcolour, len);
+					runLength -= len;
+					pos += len;
+					if (pos == lineLength)
 					{
-						if (doSetXY)
-						{
-							setXY(textXpos, textYpos + i, textXpos, textYpos + ySize - 1);
-							doSetXY = false;
-						}
-						LCD_Write_DATA16(bcolour);
+						pos = 0;
+						++line;
 					}
-					colData >>= 1;
 				}
 			}
+			else
+			{
+				pos += runLength;
+				line += pos / lineLength;
+				pos %= lineLength;
+			}
 		}
-		--nCols;
-		++textXpos;
-    }
- 	removeCS();
-	return 1;
+	}
+	return true;
 }
 
 void UTFT::setFont(const uint8_t* font)
@@ -2164,57 +2756,209 @@ void UTFT::setFont(const uint8_t* font)
 	cfont.x_size = font[0];
 	cfont.y_size = font[1];
 	cfont.spaces = font[2];
+	cfont.format = font[3];
 	cfont.firstChar = *reinterpret_cast<const uint16_t*>(font + 4);
 	cfont.lastChar = *reinterpret_cast<const uint16_t*>(font + 6);
 	cfont.font = font + 8;
+	if (cfont.format == FontFormatSparse)
+	{
+		cfont.numRanges = getLE16(cfont.font);
+		cfont.ranges = cfont.font + 2;
+		const uint8_t *numEdges = cfont.ranges + 6 * cfont.numRanges;
+		const uint8_t *lastRange = numEdges - 6;
+		const uint16_t numGlyphs = getLE16(lastRange + 4) + getLE16(lastRange + 2) - getLE16(lastRange) + 1;
+		cfont.edges = numEdges + 2;
+		cfont.glyphMetrics = cfont.edges + ((cfont.y_size + 7)/8) * getLE16(numEdges);
+		cfont.glyphIndex = cfont.glyphMetrics + 3 * numGlyphs;
+		cfont.glyphData = cfont.glyphIndex + 2 * numGlyphs;
+	}
 }
 
-// Draw a bitmap using 16-bit colours
-void UTFT::drawBitmap16(int x, int y, int sx, int sy, const uint16_t * data, int scale, bool byCols)
+// Return the order in which the controller fills an address window, expressed in logical coordinates using the DisplayOrientation bits.
+// If SwapXY is set then it fills the window a column at a time, otherwise a row at a time.
+// If ReverseX or ReverseY is set then it fills the window right-to-left or bottom-to-top respectively.
+// Any reversal that setOrientation was able to do in the controller has already been removed from 'orient'.
+inline DisplayOrientation UTFT::fillOrder() const
+{
+	return (DisplayOrientation)(orient & (SwapXY | ReverseX | ReverseY));
+}
+
+// Set up a window covering 'len' pixels of one line of the rectangle (x, y, sx, sy), starting 'pos' pixels along the line.
+// 'order' is the order in which the rectangle is being traversed, using the same bits as fillOrder.
+// Because the window is only one pixel wide, the controller fills it in the direction given by ReverseX or ReverseY in fillOrder().
+void UTFT::setLineWindow(int x, int y, int sx, int sy, DisplayOrientation order, int line, int pos, int len)
+{
+	if (order & SwapXY)
+	{
+		const int col = (order & ReverseX) ? x + sx - 1 - line : x + line;
+		const int top = (order & ReverseY) ? y + sy - pos - len : y + pos;
+		setXY(col, top, col, top + len - 1);
+	}
+	else
+	{
+		const int row = (order & ReverseY) ? y + sy - 1 - line : y + line;
+		const int left = (order & ReverseX) ? x + sx - pos - len : x + pos;
+		setXY(left, row, left + len - 1, row);
+	}
+}
+
+// Draw a rectangle of pixels taken from a random-access source. getPixel(col, row) returns the colour at that offset within the rectangle.
+// We fetch the pixels in the order in which the controller fills the window, so the whole rectangle needs only one window.
+// If 'transparent' is true then white pixels are skipped, which needs a new window after each run of them.
+template<class F> void UTFT::blitPixels(int x, int y, int sx, int sy, bool transparent, F getPixel)
 {
-	int curY = y;
+	if (sx <= 0 || sy <= 0)
+	{
+		return;
+	}
+
+	const DisplayOrientation order = fillOrder();
+	const bool byCols = (order & SwapXY) != 0;
+	const int numLines = (byCols) ? sx : sy;
+	const int lineLength = (byCols) ? sy : sx;
+	const int colStart = (order & ReverseX) ? sx - 1 : 0;
+	const int colStep = (order & ReverseX) ? -1 : 1;
+	const int rowStart = (order & ReverseY) ? sy - 1 : 0;
+	const int rowStep = (order & ReverseY) ? -1 : 1;
+
+	assertCS();
+	if (!transparent)
+	{
+		setXY(x, y, x + sx - 1, y + sy - 1);
+	}
+	for (int line = 0; line < numLines; ++line)
+	{
+		bool windowSet = !transparent;
+		for (int pos = 0; pos < lineLength; ++pos)
+		{
+			const uint16_t col = (byCols)
+									? getPixel(colStart + line * colStep, rowStart + pos * rowStep)
+									: getPixel(colStart + pos * colStep, rowStart + line * rowStep);
+			if (transparent && col == 0xFFFF)
+			{
+				windowSet = false;
+			}
+			else
+			{
+				if (!windowSet)
+				{
+					setLineWindow(x, y, sx, sy, order, line, pos, lineLength - pos);
+					windowSet = true;
+				}
+				LCD_Write_DATA16(col);
+			}
+		}
+	}
+	removeCS();
+}
+
+// Draw run-length encoded data. nextRun(col) sets 'col' to the colour of the next run and returns its length.
+// 'order' is the order of the pixels in the data, using the same bits as fillOrder.
+// The data can only be decoded in that order, so if the controller fills windows in the same order then we use one window for the whole bitmap.
+// Otherwise we use one window per line if the controller fills lines in the same direction as the data, else one window per run.
+// If 'transparent' is true then white runs are skipped, and the next run in the line starts a new window.
+template<class F> void UTFT::blitRuns(int x, int y, int sx, int sy, DisplayOrientation order, bool transparent, F nextRun)
+{
+	if (sx <= 0 || sy <= 0)
+	{
+		return;
+	}
+
+	uint32_t count = 0;
+	uint16_t col = 0;
 	assertCS();
-	for (int ty = 0; ty < sy; ty++)
+	if (fillOrder() == order && !transparent)
+	{
+		setXY(x, y, x + sx - 1, y + sy - 1);
+		for (uint32_t left = (uint32_t)sx * (uint32_t)sy; left != 0; )
+		{
+			if (count == 0)
+			{
+				count = nextRun(col);
+			}
+			const uint32_t thisCount = std::min<uint32_t>(count, left);
+			LCD_Write_Repeated_DATA16(col, thisCount);
+			count -= thisCount;
+			left -= thisCount;
+		}
+	}
+	else
 	{
-		for (int i = 0; i < scale; ++i)
+		const bool byCols = (order & SwapXY) != 0;
+		const int numLines = (byCols) ? sx : sy;
+		const int lineLength = (byCols) ? sy : sx;
+		const bool windowPerLine = ((fillOrder() ^ order) & ((byCols) ? ReverseY : ReverseX)) == 0;
+		for (int line = 0; line < numLines; ++line)
 		{
-			bool xySet = false;
-			for (int tx = 0; tx < sx; tx++)
+			bool windowSet = false;
+			for (int pos = 0; pos < lineLength; )
 			{
-				const int actualX = (orient & InvertBitmap) ? sx - tx - 1 : tx;
-				const uint16_t col = data[(byCols) ? (actualX * sy) + ty : (ty * sx) + actualX];
-				if (transparentBackground && col == 0xFFFF)
+				if (count == 0)
 				{
-					xySet = false;
+					count = nextRun(col);
+				}
+				const uint32_t thisCount = std::min<uint32_t>(count, lineLength - pos);
+				if (transparent && col == 0xFFFF)
+				{
+					windowSet = false;
 				}
 				else
 				{
-					if (!xySet)
+					if (!windowSet)
 					{
-						if (orient & InvertBitmap)
-						{
-							setXY(x, curY, x + ((sx - tx) * scale) - 1, curY);
-						}
-						else
-						{
-							setXY(x + (tx * scale), curY, x + (sx * scale) - 1, curY);
-						}
-						xySet = true;
+						setLineWindow(x, y, sx, sy, order, line, pos, (windowPerLine) ? lineLength - pos : thisCount);
+						windowSet = windowPerLine;
 					}
-					LCD_Write_Repeated_DATA16(col, scale);
+					LCD_Write_Repeated_DATA16(col, thisCount);
 				}
+				count -= thisCount;
+				pos += thisCount;
 			}
-			++curY;
 		}
 	}
 	removeCS();
 }
 
+// Draw a bitmap using 16-bit colours
+void UTFT::drawBitmap16(int x, int y, int sx, int sy, const uint16_t * data, int scale, bool byCols)
+{
+	// If the data is stored in the order in which the controller fills the window then we can stream it straight out
+	if (scale == 1 && !transparentBackground && sx > 0 && sy > 0 && fillOrder() == ((byCols) ? SwapXY : Default))
+	{
+		assertCS();
+		setXY(x, y, x + sx - 1, y + sy - 1);
+		LCD_Write_Burst_DATA16(data, (uint32_t)sx * (uint32_t)sy);
+		removeCS();
+		return;
+	}
+
+	blitPixels(x, y, sx * scale, sy * scale, transparentBackground,
+				[data, sx, sy, scale, byCols](int col, int row) -> uint16_t
+				{
+					if (scale != 1)
+					{
+						col /= scale;
+						row /= scale;
+					}
+					return data[(byCols) ? (col * sy) + row : (row * sx) + col];
+				});
+}
+
+// Convert an RGBA pixel to a native colour
+static inline uint16_t RgbaToColour(uint32_t pixel)
+{
+#define UTFT_RED(v) ((v & (0xf8 << 0)) << (11 - 3))
+#define UTFT_GREEN(v) ((v & (0xfc << 8)) >> (8 + 2 - 5))
+#define UTFT_BLUE(v) ((v & (0xf8 << 16)) >> (16 + 3 - 0))
+#define UTFT_ALPHA(v) (v & 0x00)
+	return UTFT_RED(pixel) | UTFT_GREEN(pixel) | UTFT_BLUE(pixel);
+}
+
 // Draw a bitmap stream using rgba colors
 void UTFT::drawBitmapRgbaStream(int x, int y, int width, int height, int pixels_offset, const uint32_t *pixels, size_t pixels_count)
 {
 
-	if (x < 0 || y < 0 || width < 0 || height < 0 ||
+	if (x < 0 || y < 0 || width <= 0 || height < 0 ||
 	    pixels_offset < 0 || pixels == nullptr ||
 	    (y + (pixels_offset + (int)pixels_count) / width) > (y + height))
 	{
@@ -2222,11 +2966,11 @@ void UTFT::drawBitmapRgbaStream(int x, int y, int width, int height, int pixels_
 		return;
 	}
 
-	int xd = x + pixels_offset % width;
-	int yd = x + pixels_offset / width;
+	int col = pixels_offset % width;
+	int row = pixels_offset / width;
 
 	dbg("orient %d x %d y %d w %d h %d off %d cnt %d\n", orient, x, y, width, height, pixels_offset, pixels_count, pixels);
-	dbg("current x %d y %d\n", xd, yd);
+	dbg("current x %d y %d\n", x + col, y + row);
 
 #if DEBUG
 	Colour fcoloursave = fcolour;
@@ -2238,163 +2982,212 @@ void UTFT::drawBitmapRgbaStream(int x, int y, int width, int height, int pixels_
 	fcolour = fcoloursave;
 #endif
 
-	assertCS();
-	for (size_t i = 0; i < pixels_count; i++)
+	// The stream may start and end part way along a row, so draw it as a partial row, a block of whole rows and another partial row
+	while (pixels_count != 0)
 	{
-		const uint32_t pixel = pixels[i];
-#define UTFT_RED(v) ((v & (0xf8 << 0)) << (11 - 3))
-#define UTFT_GREEN(v) ((v & (0xfc << 8)) >> (8 + 2 - 5))
-#define UTFT_BLUE(v) ((v & (0xf8 << 16)) >> (16 + 3 - 0))
-#define UTFT_ALPHA(v) (v & 0x00)
-		const uint16_t col = UTFT_RED(pixel) | UTFT_GREEN(pixel) | UTFT_BLUE(pixel);
-
-		xd = x + (pixels_offset + i) % width;
-		yd = y + (pixels_offset + i) / width;
-
-		setXY(xd, yd, xd, yd);
-
-		LCD_Write_Repeated_DATA16(col, 1);
+		const int rows = (col == 0) ? std::max<int>(pixels_count / width, 1) : 1;
+		const int cols = (rows == 1) ? std::min<int>(width - col, pixels_count) : width;
+		blitPixels(x + col, y + row, cols, rows, false,
+					[pixels, width](int c, int r) -> uint16_t
+					{
+						return RgbaToColour(pixels[(r * width) + c]);
+					});
+		const size_t n = (size_t)cols * (size_t)rows;
+		pixels += n;
+		pixels_count -= n;
+		col += cols;
+		if (col == width)
+		{
+			col = 0;
+			row += rows;
+		}
 	}
-	removeCS();
 }
 
-// Seaw a bitmap using 4-bit colours and a palette
+// Draw a bitmap using 4-bit colours and a palette
 void UTFT::drawBitmap4(int x, int y, int sx, int sy, const uint8_t * data, Palette palette, int scale, bool byCols)
 {
-	int curY = y;
-	assertCS();
-	for (int ty = 0; ty < sy; ty++)
-	{
-		for (int i = 0; i < scale; ++i)
-		{
-			bool xySet = false;
-			for (int tx = 0; tx < sx; tx++)
-			{
-				const int actualX = (orient & InvertBitmap) ? sx - tx - 1 : tx;
-				const uint16_t idx = (byCols) ? (actualX * sy) + ty : (ty * sx) + actualX;
-				const uint16_t col = (idx & 1) ? palette[data[idx >> 1] & 0x0fu] : palette[data[idx >> 1] >> 4];
-				if (transparentBackground && col == 0xFFFF)
+	blitPixels(x, y, sx * scale, sy * scale, transparentBackground,
+				[data, palette, sx, sy, scale, byCols](int col, int row) -> uint16_t
 				{
-					xySet = false;
-				}
-				else
-				{
-					if (!xySet)
+					if (scale != 1)
 					{
-						if (orient & InvertBitmap)
-						{
-							setXY(x, curY, x + ((sx - tx) * scale) - 1, curY);
-						}
-						else
-						{
-							setXY(x + (tx * scale), curY, x + (sx * scale) - 1, curY);
-						}
-						xySet = true;
+						col /= scale;
+						row /= scale;
 					}
-					LCD_Write_Repeated_DATA16(col, scale);
-				}
-			}
-			++curY;
-		}
-	}
-	removeCS();
+					const uint32_t idx = (byCols) ? (col * sy) + row : (row * sx) + col;
+					return (idx & 1) ? palette[data[idx >> 1] & 0x0fu] : palette[data[idx >> 1] >> 4];
+				});
+}
+
+// Draw a bitmap using 4-bit colours and a palette, run-length encoded.
+// Each byte holds the palette index in the top 4 bits and the run length minus one in the bottom 4 bits. The pixels are stored a row at a time.
+void UTFT::drawCompressedBitmap4(int x, int y, int sx, int sy, const uint8_t *data, Palette palette)
+{
+	blitRuns(x, y, sx, sy, Default, transparentBackground,
+				[&data, palette](uint16_t& col) -> uint32_t
+				{
+					const uint8_t run = *data++;
+					col = palette[run >> 4];
+					return (run & 0x0F) + 1;
+				});
+}
+
+// Read the next run of a compressed bitmap, which is a (repeat count - 1, data to write) pair of 16-bit values
+static inline uint32_t ReadRun(const uint16_t *&data, uint16_t& col)
+{
+	const uint32_t count = (uint32_t)*data++ + 1;
+	col = *data++;
+	return count;
 }
 
 // Draw a compressed bitmap. Data comprises alternate (repeat count - 1, data to write) pairs, both as 16-bit values.
+// The pixels are stored a column at a time, from left to right and top to bottom.
 void UTFT::drawCompressedBitmap(int x, int y, int sx, int sy, const uint16_t *data)
 {
-	uint32_t count = 0;
-	uint16_t col = 0;
-	sx += x;
-	sy += y;
-	assertCS();
-	for (int tx = x; tx < sx; tx++)
-	{
-		for (int ty = y; ty < sy; ty++)
-		{
-			if (count == 0)
-			{
-				count = *data++;
-				col = *data++;
-			}
-			else
-			{
-				--count;
-			}
-			setXY(tx, ty, tx, ty);
-			LCD_Write_DATA16(col);
-		}
-	}
-	removeCS();
+	blitRuns(x, y, sx, sy, SwapXY, false, [&data](uint16_t& col) -> uint32_t { return ReadRun(data, col); });
 }
 
 // Draw a compressed bitmap. Data comprises alternate (repeat count - 1, data to write) pairs, both as 16-bit values.
+// The pixels are stored a row at a time, from left to right and bottom to top.
 void UTFT::drawCompressedBitmapBottomToTop(int x, int y, int sx, int sy, const uint16_t *data)
 {
-	uint32_t count = 0;
-	uint16_t col = 0;
-	sx += x;
-	sy += y;
-	assertCS();
-	for (int ty = sy; ty != 0; )
+	blitRuns(x, y, sx, sy, ReverseY, false, [&data](uint16_t& col) -> uint32_t { return ReadRun(data, col); });
+}
+
+// Decoder for images in QOI format (https://qoiformat.org) that returns runs of pixels of the same native colour, so that
+// flat areas can be written with LCD_Write_Repeated_DATA16. Pixels are returned a row at a time from top to bottom.
+class QoiRunDecoder
+{
+public:
+	static constexpr size_t HeaderSize = 14;
+
+	// Return true if 'data' starts with the header of a QOI image of the specified size
+	static bool IsImage(const uint8_t *data, uint32_t width, uint32_t height)
 	{
-		--ty;
-		if ((orient & (ReverseX | SwapXY)) == 0)
+		return memcmp(data, "qoif", 4) == 0 && ReadBigEndian32(data + 4) == width && ReadBigEndian32(data + 8) == height;
+	}
+
+	QoiRunDecoder(const uint8_t *image)
+		: data(image + HeaderSize),
+		  pixelsLeft(ReadBigEndian32(image + 4) * ReadBigEndian32(image + 8)),
+		  pendingCount(0), pendingColour(0)
+	{
+		memset(index, 0, sizeof(index));
+		pixel[0] = pixel[1] = pixel[2] = 0;
+		pixel[3] = 255;
+	}
+
+	// Return the length and colour of the next run. Consecutive operations that decode to the same native colour are merged.
+	uint32_t NextRun(uint16_t& colour)
+	{
+		uint32_t count = pendingCount;
+		colour = pendingColour;
+		if (count == 0)
 		{
-			// The orientation allows us to write pixels one after another, without resetting the pixel address between them
-			setXY(x, ty, sx - 1, ty);
-			for (int tx = x; tx < sx; tx++)
+			count = DecodeOp();
+			colour = NativeColour();
+		}
+		pendingCount = 0;
+		while (pixelsLeft != 0)
+		{
+			const uint32_t n = DecodeOp();
+			const uint16_t c = NativeColour();
+			if (c != colour)
 			{
-				if (count == 0)
-				{
-					count = *data++;
-					col = *data++;
-				}
-				else
-				{
-					--count;
-				}
-				LCD_Write_DATA16(col);
+				pendingCount = n;
+				pendingColour = c;
+				break;
 			}
+			count += n;
+		}
+		return count;
+	}
+
+private:
+	static uint32_t ReadBigEndian32(const uint8_t *p)
+	{
+		return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+	}
+
+	uint16_t NativeColour() const
+	{
+		return UTFT::fromRGB(pixel[0], pixel[1], pixel[2]);
+	}
+
+	// Decode the next operation into 'pixel' and return the number of pixels it covers
+	uint32_t DecodeOp()
+	{
+		uint32_t count = 1;
+		const uint8_t op = *data++;
+		if (op == 0xFE)
+		{
+			pixel[0] = data[0];
+			pixel[1] = data[1];
+			pixel[2] = data[2];
+			data += 3;
+		}
+		else if (op == 0xFF)
+		{
+			memcpy(pixel, data, 4);
+			data += 4;
 		}
 		else
 		{
-#if 0
-			// This algorithm is faster but results in a non-uniform speed
-			int tx = x;
-			while (tx < sx)
+			switch (op >> 6)
 			{
-				if (count == 0)
-				{
-					count = (*data++) + 1;
-					col = *data++;
-				}
-				const uint32_t thisCount = std::min<uint32_t>(count, sx - tx);
-				setXY(tx, ty, tx + thisCount - 1, ty);
-				LCD_Write_Repeated_DATA16(col, thisCount);
-				count -= thisCount;
-				tx += thisCount;
-			}
-#else
-			// Original slow-but-steady algorithm
-			for (int tx = x; tx < sx; tx++)
-			{
-				if (count == 0)
-				{
-					count = *data++;
-					col = *data++;
-				}
-				else
+			case 0:				// index into the array of recently seen pixels
+				memcpy(pixel, index[op], 4);
+				break;
+
+			case 1:				// small difference from the previous pixel
+				pixel[0] += ((op >> 4) & 3) - 2;
+				pixel[1] += ((op >> 2) & 3) - 2;
+				pixel[2] += (op & 3) - 2;
+				break;
+
+			case 2:				// difference in green, and differences in red and blue relative to that
 				{
-					--count;
+					const int dg = (int)(op & 0x3F) - 32;
+					const uint8_t b2 = *data++;
+					pixel[0] += dg - 8 + (b2 >> 4);
+					pixel[1] += dg;
+					pixel[2] += dg - 8 + (b2 & 0x0F);
 				}
-				setXY(tx, ty, tx, ty);
-				LCD_Write_DATA16(col);
+				break;
+
+			default:			// run of the previous pixel, which is already in the index
+				count = (op & 0x3F) + 1;
+				break;
 			}
-#endif
 		}
+		memcpy(index[(pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + pixel[3] * 11) % 64], pixel, 4);
+		count = std::min<uint32_t>(count, pixelsLeft);
+		pixelsLeft -= count;
+		return count;
 	}
-	removeCS();
+
+	const uint8_t *data;
+	uint32_t pixelsLeft;				// the number of pixels not yet decoded
+	uint32_t pendingCount;				// the length of a run that we have decoded but not yet returned
+	uint16_t pendingColour;
+	uint8_t pixel[4];					// the last pixel decoded, as RGBA
+	uint8_t index[64][4];				// recently seen pixels, indexed by a hash of their value
+};
+
+// Return true if 'data' is a QOI image of the specified size
+bool UTFT::isQoiBitmap(const uint8_t *data, int sx, int sy)
+{
+	return QoiRunDecoder::IsImage(data, sx, sy);
+}
+
+// Draw a bitmap in QOI format. The caller must have checked it with isQoiBitmap.
+// The pixels are decoded a row at a time from top to bottom, so if the controller fills windows in the same order
+// then the whole bitmap is drawn through one window.
+void UTFT::drawQoiBitmap(int x, int y, int sx, int sy, const uint8_t *data)
+{
+	QoiRunDecoder decoder(data);
+	blitRuns(x, y, sx, sy, Default, false, [&decoder](uint16_t& col) -> uint32_t { return decoder.NextRun(col); });
 }
 
 void UTFT::lcdOff()
@@ -2433,6 +3226,275 @@ void UTFT::lcdOn()
 	removeCS();
 }
 
+// Allocate the band buffer. It must be wide enough for the display in any orientation.
+// Nothing is ever freed, so we only take the buffer if that leaves at least 'reserve' bytes free. Otherwise band rendering is not used.
+bool UTFT::allocateBand(uint16_t lines, uint32_t reserve)
+{
+#if UTFT_BAND_RENDERING
+	if (bandBuffer == nullptr && lines != 0)
+	{
+		const size_t numPixels = (size_t)(std::max(disp_x_size, disp_y_size) + 1) * lines;
+		if (GetFreeMemory() < numPixels * sizeof(uint16_t) + reserve)
+		{
+			bandLines = 0;
+			return false;
+		}
+		bandBuffer = new uint16_t[numPixels];
+		bandLines = lines;
+	}
+	return bandBuffer != nullptr;
+#else
+	(void)lines;
+	(void)reserve;
+	return false;
+#endif
+}
+
+// Start composing the band of rows that starts at 'top'. The caller must draw everything in the band, because the buffer is not cleared.
+void UTFT::beginBand(uint16_t top)
+{
+#if UTFT_BAND_RENDERING
+	if (bandLines != 0 && top < getDisplayYSize())
+	{
+		bandTop = top;
+		bandRows = std::min<uint16_t>(bandLines, getDisplayYSize() - top);
+		bandWidth = getDisplayXSize();
+
+		// The buffer holds the band in the order in which the controller fills the band window, so that endBand can send it in one burst
+		if (fillOrder() & SwapXY)
+		{
+			bandNumLines = bandWidth;
+			bandLineLength = bandRows;
+		}
+		else
+		{
+			bandNumLines = bandRows;
+			bandLineLength = bandWidth;
+		}
+		winInBand = false;
+	}
+#else
+	(void)top;
+#endif
+}
+
+// Send the band to the display and go back to drawing directly
+void UTFT::endBand()
+{
+#if UTFT_BAND_RENDERING
+	if (bandRows != 0)
+	{
+		const uint16_t rows = bandRows;
+		bandRows = 0;
+		assertCS();
+		setXY(0, bandTop, bandWidth - 1, bandTop + rows - 1);
+		LCD_Write_Burst_DATA16(bandBuffer, (uint32_t)bandWidth * rows);
+		removeCS();
+	}
+#endif
+}
+
+#if UTFT_BAND_RENDERING
+
+// Record a new address window while composing a band.
+// Consecutive pixels along a fill line of the window land in consecutive locations of the band buffer, because the buffer is stored in fill order too.
+// So we only need to know where line 0 and position 0 of the window fall in the buffer.
+void UTFT::bandSetWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	winInBand = x1 <= x2 && y1 <= y2 && x1 < bandWidth && y1 < bandTop + bandRows && y2 >= bandTop;
+	if (!winInBand)
+	{
+		return;
+	}
+
+	const DisplayOrientation order = fillOrder();
+	const int32_t sx = x2 - x1 + 1, sy = y2 - y1 + 1;
+	const int32_t firstCol = (order & ReverseX) ? bandWidth - x1 - sx : x1;
+	const int32_t firstRow = (order & ReverseY) ? bandTop + bandRows - y1 - sy : y1 - bandTop;
+	if (order & SwapXY)
+	{
+		winLineLength = sy;
+		winLineBase = firstCol;
+		winPosBase = firstRow;
+	}
+	else
+	{
+		winLineLength = sx;
+		winLineBase = firstRow;
+		winPosBase = firstCol;
+	}
+	winSize = (uint32_t)sx * (uint32_t)sy;
+	winPos = 0;
+}
+
+// Write pixels to the band buffer. If 'data' is null then we write 'num' pixels of colour 'c', else we copy 'num' pixels from 'data'.
+void UTFT::bandWrite(const uint16_t *data, Colour c, uint32_t num)
+{
+#if UTFT_BUS_STATS
+	busStats.pixels += num;
+#endif
+	if (!winInBand)
+	{
+		return;
+	}
+
+	while (num != 0)
+	{
+		const uint32_t line = winPos / winLineLength;
+		const uint32_t pos = winPos % winLineLength;
+		const uint32_t n = std::min<uint32_t>(num, winLineLength - pos);
+		const int32_t bufLine = winLineBase + (int32_t)line;
+		if (bufLine >= 0 && bufLine < bandNumLines)
+		{
+			// Clip this part of the line to the band
+			int32_t first = winPosBase + (int32_t)pos;
+			const int32_t last = std::min<int32_t>(first + (int32_t)n, bandLineLength);
+			const uint32_t skip = (first < 0) ? -first : 0;
+			first += skip;
+			if (first < last)
+			{
+				uint16_t *p = bandBuffer + bufLine * bandLineLength + first;
+				if (data != nullptr)
+				{
+					memcpy(p, data + skip, (last - first) * sizeof(uint16_t));
+				}
+				else
+				{
+					std::fill(p, p + (last - first), c);
+				}
+			}
+		}
+
+		if (data != nullptr)
+		{
+			data += n;
+		}
+		num -= n;
+		winPos += n;
+		if (winPos == winSize)
+		{
+			winPos = 0;						// the controller wraps round to the start of the window
+		}
+	}
+}
+
+#endif
+
+// Set up a scroll area, or keep the existing one if it is the same. Setting up a new one resets the scroll position,
+// so the caller must redraw the area afterwards.
+bool UTFT::setScrollArea(uint16_t top, uint16_t height)
+{
+#if UTFT_HARDWARE_SCROLL
+	if (!canScroll || height == 0 || top + height > getDisplayYSize())
+	{
+		return false;
+	}
+	if (top != scrollTop || height != scrollHeight)
+	{
+		scrollTop = top;
+		scrollHeight = height;
+		scrollOffset = 0;
+		assertCS();
+		setScrollRegisters();
+		removeCS();
+	}
+	return true;
+#else
+	(void)top;
+	(void)height;
+	return false;
+#endif
+}
+
+// Move the contents of the scroll area up by 'lines' rows
+void UTFT::scrollUp(uint16_t lines)
+{
+#if UTFT_HARDWARE_SCROLL
+	if (scrollHeight != 0)
+	{
+		scrollOffset = (scrollOffset + lines) % scrollHeight;
+		assertCS();
+		LCD_Write_COM(0x37);		// set scroll start
+		LCD_Write_DATA8((scrollTop + scrollOffset) >> 8);
+		LCD_Write_DATA8(scrollTop + scrollOffset);
+		removeCS();
+	}
+#else
+	(void)lines;
+#endif
+}
+
+#if UTFT_HARDWARE_SCROLL
+
+// Send the scroll area and position to the controller. If there is no scroll area then the whole display is set to scroll by 0 rows.
+void UTFT::setScrollRegisters()
+{
+	const uint16_t numRows = disp_y_size + 1;
+	const uint16_t top = (scrollHeight != 0) ? scrollTop : 0;
+	const uint16_t height = (scrollHeight != 0) ? scrollHeight : numRows;
+	const uint16_t bottom = numRows - top - height;
+	LCD_Write_COM(0x33);			// set scroll area
+	LCD_Write_DATA8(top >> 8);
+	LCD_Write_DATA8(top);
+	LCD_Write_DATA8(height >> 8);
+	LCD_Write_DATA8(height);
+	LCD_Write_DATA8(bottom >> 8);
+	LCD_Write_DATA8(bottom);
+	LCD_Write_COM(0x37);			// set scroll start
+	LCD_Write_DATA8((top + scrollOffset) >> 8);
+	LCD_Write_DATA8(top + scrollOffset);
+}
+
+// Write pixels to a window that is split into parts, setting up each part as the previous one is filled.
+// If 'data' is null then we write 'num' pixels of colour 'c', else we copy 'num' pixels from 'data'.
+void UTFT::scrollWrite(const uint16_t *data, Colour c, uint32_t num)
+{
+	for (;;)
+	{
+		const uint32_t n = std::min<uint32_t>(num, segPixelsLeft);
+		const uint32_t left = segPixelsLeft - n;
+		segPixelsLeft = 0;						// so that the writes go straight to the display
+		if (n != 0)
+		{
+			if (data != nullptr)
+			{
+				LCD_Write_Burst_DATA16(data, n);
+				data += n;
+			}
+			else
+			{
+				LCD_Write_Repeated_DATA16(c, n);
+			}
+			num -= n;
+		}
+		if (left != 0)
+		{
+			segPixelsLeft = left;
+			return;
+		}
+
+		setXY(segX1, segY1, segX2, segY2);		// set up the next part, which may itself be split
+		if (segPixelsLeft == 0)
+		{
+			// This is the last part
+			if (num != 0)
+			{
+				if (data != nullptr)
+				{
+					LCD_Write_Burst_DATA16(data, num);
+				}
+				else
+				{
+					LCD_Write_Repeated_DATA16(c, num);
+				}
+			}
+			return;
+		}
+	}
+}
+
+#endif
+
 uint16_t UTFT::getDisplayXSize() const
 {
 	return ((orient & SwapXY) ? disp_y_size : disp_x_size) + 1;
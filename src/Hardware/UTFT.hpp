@@ -50,8 +50,26 @@
 
 #include "OneBitPort.hpp"
 #include "DisplayOrientation.hpp"
+#include "GlyphCache.hpp"
 #include <General/SafeVsnprintf.h>
 
+// Set this nonzero to count address windows, commands, pixels and bus writes, so that the cost of the drawing primitives can be measured.
+// Each counter costs one addition per call to the bus functions, so they are cheap enough to leave enabled.
+#ifndef UTFT_BUS_STATS
+# define UTFT_BUS_STATS	(1)
+#endif
+
+// Set this nonzero to support composing the display a horizontal band at a time in RAM.
+// The band buffer takes tens of Kbytes, so by default we only support it on the SAM4S.
+#ifndef UTFT_BAND_RENDERING
+# define UTFT_BAND_RENDERING	(SAM4S)
+#endif
+
+// Set this nonzero to support hardware vertical scrolling on SSD1963 displays
+#ifndef UTFT_HARDWARE_SCROLL
+# define UTFT_HARDWARE_SCROLL	(1)
+#endif
+
 enum DisplayType {
 	HX8347A,
 	ILI9327,
@@ -90,19 +108,36 @@ enum DisplayType {
 };
 
 // This describes the structure we use to store font information.
-// The first 5 fields are also the layout of the data in the font header.
+// The first 6 fields are also the layout of the data in the font header.
+// In the column bitmap format, each character is stored as a width byte followed by x_size columns of (y_size + 7)/8 bytes each.
+// The packed format is generated from that by Tools/fontpack/fontpack.py, which describes it.
 struct FontDescriptor
 {
 	uint8_t x_size;
 	uint8_t y_size;
 	uint8_t spaces;
-	uint8_t spare;
+	uint8_t format;					// one of the FontFormat values
 	uint16_t firstChar;
 	uint16_t lastChar;
 	const uint8_t* font;
+	const uint8_t* ranges;			// packed fonts only: the table of character ranges
+	uint16_t numRanges;
+	const uint8_t* edges;			// packed fonts only: the columns that glyphs are kerned on
+	const uint8_t* glyphMetrics;	// packed fonts only: the width and edges of each glyph
+	const uint8_t* glyphIndex;		// packed fonts only: the offsets of the glyphs
+	const uint8_t* glyphData;		// packed fonts only: the glyphs
 };
 
 
+enum FontFormat : uint8_t
+{
+	FontFormatBitmap = 0,
+	FontFormatSparse = 3,			// 1 was a packed format without character ranges and 2 had no glyph metrics, which fontpack no longer generates
+};
+
+const unsigned int MaxFontColumns = 32;				// the widest character we can unpack from a packed font
+const uint16_t NoGlyph = 0xFFFF;					// the glyph index we use for characters that the current font doesn't have
+
 typedef uint16_t Colour;
 
 const Colour black = 0x0000;
@@ -141,21 +176,69 @@ public:
 	void clearToMargin();
 	int printf(const char* fmt, ...) noexcept;
 
+	// Fixed width digits. While enabled, digits are padded to the width of the widest digit in the font and are not kerned
+	// against the characters either side, so the other characters of a number stay where they are when its digits change.
+	void setFixedDigits(bool b) { fixedDigits = b; }
+	uint8_t getDigitWidth();
+
+	// Text measurement. After a call to startMeasuring, and until the next call to setTextPos, the print functions draw nothing
+	// and just advance the text position, using exactly the same spacing and kerning as when printing.
+	void startMeasuring(uint16_t maxWidth);
+	uint16_t measureText(const char *s, uint16_t maxWidth, size_t maxBytes = SIZE_MAX);		// return the width needed to print s
+	size_t fitText(const char *s, uint16_t maxWidth, size_t maxBytes = SIZE_MAX);				// return how many bytes of s fit in maxWidth
+
 	void setFont(const uint8_t* font);
 	void drawBitmap16(int x, int y, int sx, int sy, const uint16_t *data, int scale = 1, bool byCols = true);
 	void drawBitmapRgbaStream(int x, int y, int width, int height, int pixels_offset, const uint32_t *pixels, size_t pixels_count);
 	void drawBitmap4(int x, int y, int sx, int sy, const uint8_t *data, Palette palette, int scale = 1, bool byCols = true);
+	void drawCompressedBitmap4(int x, int y, int sx, int sy, const uint8_t *data, Palette palette);
 	void drawCompressedBitmap(int x, int y, int sx, int sy, const uint16_t *data);
 	void drawCompressedBitmapBottomToTop(int x, int y, int sx, int sy, const uint16_t *data);
+	static bool isQoiBitmap(const uint8_t *data, int sx, int sy);
+	void drawQoiBitmap(int x, int y, int sx, int sy, const uint8_t *data);
 	void lcdOff();
 	void lcdOn();
 	uint16_t getDisplayXSize() const;
 	uint16_t getDisplayYSize() const;
 	uint16_t getTextX() const { return textXpos; }
 	uint16_t getTextY() const { return textYpos; }
+	uint16_t getTextRightMargin() const { return textRightMargin; }
 	uint16_t getFontHeight() const { return cfont.y_size; }
+	FontFormat getFontFormat() const { return (FontFormat)cfont.format; }
 	static uint16_t GetFontHeight(const uint8_t *f) { return reinterpret_cast<const FontDescriptor*>(f)->y_size; }
 
+	// Bus activity counters. These are only maintained if UTFT_BUS_STATS is nonzero.
+	struct BusStats
+	{
+		uint32_t windows;			// number of address windows set up
+		uint32_t commands;			// number of command writes, including those used to set up the windows
+		uint32_t pixels;			// number of pixels written, to the display or to the band buffer
+		uint32_t writes;			// number of WR strobes, including those used to set up the windows
+	};
+	const BusStats& getBusStats() const { return busStats; }
+	void resetBusStats() { busStats.windows = busStats.commands = busStats.pixels = busStats.writes = 0; }
+
+	const GlyphCache& getGlyphCache() const { return glyphCache; }
+	void resetGlyphCacheStats() { glyphCache.ResetStats(); }
+
+	// Band rendering. Between beginBand and endBand, drawing goes to a buffer in RAM that holds the display rows from 'top' to
+	// top + getBandLines() - 1, and anything drawn outside those rows is discarded. endBand sends the buffer to the display in one window.
+	bool allocateBand(uint16_t lines, uint32_t reserve);	// call once during initialisation, returns false if band rendering is not supported or there isn't the memory
+	void beginBand(uint16_t top);
+	void endBand();
+#if UTFT_BAND_RENDERING
+	uint16_t getBandLines() const { return bandLines; }
+#else
+	uint16_t getBandLines() const { return 0; }
+#endif
+
+	// Hardware vertical scrolling. The rows from 'top' to top + height - 1 form a scroll area, and scrollUp moves its contents up,
+	// bringing the rows that scrolled off the top back in at the bottom. Windows are mapped to the frame buffer rows currently
+	// shown in their place, so drawing coordinates are not affected by scrolling.
+	// Only SSD1963 displays in landscape orientation without a vertical flip can do this. setOrientation removes the scroll area.
+	bool setScrollArea(uint16_t top, uint16_t height);		// returns false if the display can't scroll, else true
+	void scrollUp(uint16_t lines);
+
 private:
 	uint16_t fcolour, bcolour;
 	bool transparentBackground;
@@ -169,12 +252,58 @@ private:
 	FontDescriptor cfont;
 	uint16_t textXpos, textYpos, textRightMargin;
 	uint32_t lastCharColData;		// used for auto kerning
+	bool fixedDigits;
+	uint8_t digitWidth;				// the width of the widest digit in digitWidthFont
+	const uint8_t *digitWidthFont;
 
 	uint32_t charVal;
 	uint8_t numContinuationBytesLeft;
 
+	BusStats busStats;
+	GlyphCache glyphCache;
+
+#if UTFT_BAND_RENDERING
+	uint16_t *bandBuffer;			// holds the band in the order in which the controller fills the band window
+	uint16_t bandLines;				// the number of display rows the buffer can hold, or 0 if there is no buffer
+	uint16_t bandTop, bandRows;		// the rows being composed, bandRows is 0 when we are drawing directly to the display
+	uint16_t bandWidth;
+	uint16_t bandNumLines, bandLineLength;	// the number of fill lines in the band and their length
+
+	// The current address window while composing a band. Lines and positions are in fill order.
+	bool winInBand;					// false if the window does not intersect the band
+	uint32_t winLineLength, winSize, winPos;
+	int32_t winLineBase, winPosBase;	// where line 0 and position 0 of the window fall in the band buffer
+
+	void bandSetWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+	void bandWrite(const uint16_t *data, Colour c, uint32_t num);
+#endif
+
+#if UTFT_HARDWARE_SCROLL
+	bool canScroll;					// true if the controller and orientation support hardware scrolling
+	uint16_t scrollTop, scrollHeight;	// the scroll area, scrollHeight is 0 if there is none
+	uint16_t scrollOffset;			// the frame buffer row displayed at the top of the scroll area, relative to scrollTop
+
+	// A window whose rows are not contiguous in the frame buffer is set up one part at a time
+	uint32_t segPixelsLeft;			// the number of pixels left in the current part, or 0 if it is the last part
+	uint16_t segX1, segY1, segX2, segY2;	// the rest of the window
+
+	void setScrollRegisters();
+	void scrollWrite(const uint16_t *data, Colour c, uint32_t num);
+#endif
+
 	size_t writeNative(uint16_t c);
-	void applyGradient(uint16_t grad);
+	bool isCpld() const;
+	void writeSpaceColumns(uint8_t numColumns, uint8_t ySize);
+	uint16_t findGlyph(uint16_t c) const;
+	uint8_t glyphColumns(uint16_t index) const;
+	uint32_t getEdge(uint8_t edge) const;
+	uint8_t unpackGlyph(uint16_t index, uint32_t *columns) const;
+	void drawGlyphColumn(uint32_t colData, uint8_t ySize);
+	bool drawCachedGlyph(uint16_t c, const uint8_t *fontPtr, uint8_t nCols, uint8_t bytesPerColumn, uint32_t cmask);
+	void rasteriseGlyph(GlyphCache::Glyph& g, const uint8_t *fontPtr, uint8_t nCols, uint8_t bytesPerColumn, uint32_t cmask);
+	Colour gradientColour(Colour grad, uint8_t gradChange, unsigned int line) const;
+	void fillWindow(int x1, int y1, int x2, int y2, Colour c);
+	void fillGradient(int x1, int y1, int x2, int y2, unsigned int firstLine, Colour grad, uint8_t gradChange, bool byCols);
 
 	// Hardware interface
 	void LCD_Write_Bus(uint16_t VHL);
@@ -185,12 +314,19 @@ private:
 	void LCD_Write_DATA8(uint8_t VL);
 	void LCD_Write_DATA16(uint16_t VHL);
 	void LCD_Write_Repeated_DATA16(uint16_t VHL, uint32_t num);
+	void LCD_Write_Burst_DATA16(const uint16_t *data, uint32_t num);
 	void LCD_Write_COM_DATA16(uint8_t com1, uint16_t dat1);
 
 	void drawHLine(int x, int y, int len);
 	void drawVLine(int x, int y, int len);
 	void setXY(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
 
+	// Blit engine
+	DisplayOrientation fillOrder() const;
+	void setLineWindow(int x, int y, int sx, int sy, DisplayOrientation order, int line, int pos, int len);
+	template<class F> void blitPixels(int x, int y, int sx, int sy, bool transparent, F getPixel);
+	template<class F> void blitRuns(int x, int y, int sx, int sy, DisplayOrientation order, bool transparent, F nextRun);
+
 	void assertCS() const
 	{
 		portCS.setLow();
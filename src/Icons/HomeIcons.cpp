@@ -1,8 +1,10 @@
 /*
  * HomeIcons.cpp
  *
- * Created: 29/11/2015 12:10:12
- *  Author: David
+ * Generated from the bitmaps in this folder by Tools/iconpack/iconpack.py - do not edit.
+ *
+ * LARGE_FONT:   1144 bytes as 4-bit pixels,   264 bytes run-length encoded
+ * Small font:    530 bytes as 4-bit pixels,   164 bytes run-length encoded
  */
 
 #include "asf.h"
@@ -11,175 +13,164 @@
 
 extern const uint16_t IconPaletteLight[] =
 {
-    0x0000, 0xffff, 0x20e4, 0xffdf, 0x18e3, 0xf79e, 0xc986, 0xd30c,
-    0xc103, 0xff52, 0xfffb, 0x4569, 0x9492, 0x0000, 0x0000, 0x0000
+	0x0000,		// 0: black
+	0xFFFF,		// 1: white, drawn as transparent
+	0x20E4,		// 2: dark grey
+	0xFFDF,		// 3: very light grey, used to replace white
+	0x18E3,		// 4: very dark grey
+	0xF79E,		// 5: light grey
+	0xC986,		// 6: red
+	0xD30C,		// 7: lighter red
+	0xC103,		// 8: red
+	0xFF52,		// 9: light yellow
+	0xFFFB,		// 10: very light yellow
+	0x4569,		// 11: green
+	0x9492,		// 12: grey
+	0x0000,		// 13: unused
+	0x0000,		// 14: unused
+	0x0000,		// 15: unused
 };
 
 extern const uint16_t IconPaletteDark[] =
 {
-    0x0000, 0xffff, 0x20e4, 0xffdf, 0x18e3, 0xf79e, 0xc986, 0xd30c,
-    0xc103, 0xff52, 0xfffb, 0x4569, 0x9492, 0x0000, 0x0000, 0x0000
+	0x0000,		// 0: black
+	0xFFFF,		// 1: white, drawn as transparent
+	0x20E4,		// 2: dark grey
+	0xFFDF,		// 3: very light grey, used to replace white
+	0x18E3,		// 4: very dark grey
+	0xF79E,		// 5: light grey
+	0xC986,		// 6: red
+	0xD30C,		// 7: lighter red
+	0xC103,		// 8: red
+	0xFF52,		// 9: light yellow
+	0xFFFB,		// 10: very light yellow
+	0x4569,		// 11: green
+	0x9492,		// 12: grey
+	0x0000,		// 13: unused
+	0x0000,		// 14: unused
+	0x0000,		// 15: unused
 };
 
 #if LARGE_FONT
 
 extern const uint8_t IconHomeAll[] =
 {	35, 30,		// width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x00, 0x00, 0x00,
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33,
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x33, 0x33, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11
+	0x1F, 0x10, 0x01, 0x1F,
+	0x1F, 0x03, 0x1E,
+	0x1E, 0x05, 0x1D,
+	0x17, 0x03, 0x11, 0x07, 0x1C,
+	0x17, 0x03, 0x10, 0x09, 0x1B,
+	0x17, 0x0F, 0x1A,
+	0x17, 0x0F, 0x00, 0x19,
+	0x17, 0x0F, 0x01, 0x18,
+	0x17, 0x0F, 0x02, 0x17,
+	0x16, 0x0F, 0x04, 0x16,
+	0x15, 0x0F, 0x06, 0x15,
+	0x14, 0x0F, 0x08, 0x14,
+	0x13, 0x0F, 0x0A, 0x13,
+	0x12, 0x0F, 0x0C, 0x12,
+	0x11, 0x0F, 0x0E, 0x11,
+	0x10, 0x0F, 0x0F, 0x00, 0x10,
+	0x14, 0x0F, 0x08, 0x14,
+	0x14, 0x0F, 0x08, 0x14,
+	0x14, 0x0F, 0x08, 0x14,
+	0x14, 0x04, 0x33, 0x04, 0x34, 0x05, 0x14,
+	0x14, 0x04, 0x33, 0x04, 0x34, 0x05, 0x14,
+	0x14, 0x04, 0x33, 0x04, 0x34, 0x05, 0x14,
+	0x14, 0x04, 0x33, 0x04, 0x34, 0x05, 0x14,
+	0x14, 0x04, 0x33, 0x04, 0x34, 0x05, 0x14,
+	0x14, 0x0D, 0x34, 0x05, 0x14,
+	0x14, 0x0D, 0x34, 0x05, 0x14,
+	0x14, 0x0D, 0x34, 0x05, 0x14,
+	0x14, 0x0D, 0x34, 0x05, 0x14,
+	0x14, 0x0D, 0x34, 0x05, 0x14,
+	0x14, 0x0D, 0x34, 0x05, 0x14,
 };
 
 extern const uint8_t IconBedComp[] =
 {	41, 30,		// width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x00, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x10, 0x00,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x00,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
-    0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00,
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
-    0x01, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x00,
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
-    0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x01, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11
+	0x1F, 0x1B, 0x01, 0x1A,
+	0x1F, 0x1B, 0x01, 0x1A,
+	0x1F, 0x1B, 0x01, 0x1A,
+	0x1F, 0x1B, 0x01, 0x1A,
+	0x1F, 0x18, 0x07, 0x17,
+	0x1F, 0x19, 0x05, 0x18,
+	0x1F, 0x1A, 0x03, 0x19,
+	0x1F, 0x1B, 0x01, 0x1A,
+	0x1F, 0x1F, 0x18,
+	0x1F, 0x1F, 0x18,
+	0x1F, 0x18, 0x07, 0x17,
+	0x1F, 0x15, 0x0D, 0x14,
+	0x1F, 0x13, 0x0F, 0x01, 0x12,
+	0x03, 0x1C, 0x08, 0x15, 0x08,
+	0x06, 0x15, 0x09, 0x1B, 0x05,
+	0x0F, 0x04, 0x1F, 0x03,
+	0x12, 0x0E, 0x1F, 0x16,
+	0x15, 0x07, 0x1F, 0x1A,
+	0x1F, 0x1F, 0x18,
+	0x1F, 0x1F, 0x18,
+	0x18, 0x01, 0x1F, 0x1D,
+	0x17, 0x03, 0x1F, 0x1C,
+	0x16, 0x05, 0x1F, 0x1B,
+	0x15, 0x07, 0x1F, 0x1A,
+	0x18, 0x01, 0x1F, 0x1D,
+	0x18, 0x01, 0x1F, 0x1D,
+	0x18, 0x01, 0x1F, 0x1D,
+	0x18, 0x01, 0x1F, 0x1D,
+	0x18, 0x01, 0x1F, 0x1D,
+	0x18, 0x01, 0x1F, 0x1D,
 };
 
 #else
 
 extern const uint8_t IconHomeAll[] =
 {	25, 21,		// width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x30, 0x00, 0x00,
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x01, 0x11,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x30, 0x00, 0x00, 0x11, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33,
-    0x33, 0x31, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33,
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11,
-    0x10, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10
+	0x1B, 0x01, 0x1A,
+	0x1A, 0x03, 0x19,
+	0x15, 0x02, 0x10, 0x05, 0x18,
+	0x15, 0x0A, 0x17,
+	0x15, 0x0B, 0x16,
+	0x15, 0x0C, 0x15,
+	0x14, 0x0E, 0x14,
+	0x13, 0x0F, 0x00, 0x13,
+	0x12, 0x0F, 0x02, 0x12,
+	0x11, 0x0F, 0x04, 0x11,
+	0x10, 0x0F, 0x06, 0x10,
+	0x13, 0x0F, 0x00, 0x13,
+	0x13, 0x02, 0x32, 0x03, 0x33, 0x02, 0x13,
+	0x13, 0x02, 0x32, 0x03, 0x33, 0x02, 0x13,
+	0x13, 0x02, 0x32, 0x03, 0x33, 0x02, 0x13,
+	0x13, 0x02, 0x32, 0x03, 0x33, 0x02, 0x13,
+	0x13, 0x09, 0x33, 0x02, 0x13,
+	0x13, 0x09, 0x33, 0x02, 0x13,
+	0x13, 0x09, 0x33, 0x02, 0x13,
+	0x13, 0x09, 0x33, 0x02, 0x13,
+	0x13, 0x09, 0x33, 0x02, 0x13,
 };
 
-
 extern const uint8_t IconBedComp[] =
 {	25, 21,		// width, height
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
-    0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x11,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00,
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x00, 0x00,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x10, 0x01, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x00, 0x11, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x00, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x00, 0x01, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01,
-    0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x10,
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10
+	0x1F, 0x01, 0x16,
+	0x1F, 0x01, 0x16,
+	0x1F, 0x01, 0x16,
+	0x1D, 0x05, 0x14,
+	0x1E, 0x03, 0x15,
+	0x1F, 0x01, 0x16,
+	0x1F, 0x18,
+	0x1F, 0x18,
+	0x1D, 0x05, 0x14,
+	0x03, 0x15, 0x0E,
+	0x0D, 0x15, 0x04,
+	0x13, 0x05, 0x1E,
+	0x1F, 0x18,
+	0x1F, 0x18,
+	0x15, 0x01, 0x1F, 0x10,
+	0x14, 0x03, 0x1F,
+	0x13, 0x05, 0x1E,
+	0x15, 0x01, 0x1F, 0x10,
+	0x15, 0x01, 0x1F, 0x10,
+	0x15, 0x01, 0x1F, 0x10,
+	0x15, 0x01, 0x1F, 0x10,
 };
 
 #endif
@@ -9,6 +9,10 @@
 #ifndef ICONS_H_
 #define ICONS_H_
 
+// Each icon comprises its width and height in pixels, followed by the pixels a row at a time, run-length encoded.
+// Each byte is one run, with the palette index in the top 4 bits and the run length minus one in the bottom 4 bits.
+// The icon sources are generated from the bitmaps in this folder by Tools/iconpack/iconpack.py.
+
 extern const uint16_t IconPaletteLight[];
 extern const uint16_t IconPaletteDark[];
 
@@ -1,8 +1,10 @@
 /*
  * KeyIcons.cpp
  *
- * Created: 29/11/2015 12:10:55
- *  Author: David
+ * Generated from the bitmaps in this folder by Tools/iconpack/iconpack.py - do not edit.
+ *
+ * LARGE_FONT:    814 bytes as 4-bit pixels,   279 bytes run-length encoded
+ * Small font:    571 bytes as 4-bit pixels,   228 bytes run-length encoded
  */
 
 #include "asf.h"
@@ -12,137 +14,114 @@
 #if LARGE_FONT
 
 extern const uint8_t IconBackspace[] =
-{   30, 24,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x21, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x20, 0x00, 0x00, 0x02, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x11,
-    0x11, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11,
-    0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11,
-    0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11,
-    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x23, 0x20, 0x00, 0x00, 0x02, 0x32, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x23, 0x32, 0x00, 0x00, 0x23, 0x32, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x02, 0x33, 0x20, 0x02, 0x33, 0x20, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x00, 0x23, 0x32, 0x23, 0x32, 0x00, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x00, 0x02, 0x33, 0x33, 0x20, 0x00, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x23, 0x32, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x00, 0x02, 0x33, 0x33, 0x20, 0x00, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x00, 0x23, 0x32, 0x23, 0x32, 0x00, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x02, 0x33, 0x20, 0x02, 0x33, 0x20, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x23, 0x32, 0x00, 0x00, 0x23, 0x32, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x23, 0x20, 0x00, 0x00, 0x02, 0x32, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
-    0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11
+{	30, 24,		// width, height
+	0x19, 0x2F, 0x21, 0x11,
+	0x18, 0x20, 0x0F, 0x01, 0x20, 0x10,
+	0x17, 0x20, 0x0F, 0x03, 0x20,
+	0x16, 0x20, 0x0F, 0x04, 0x20,
+	0x15, 0x20, 0x0F, 0x05, 0x20,
+	0x14, 0x20, 0x0F, 0x06, 0x20,
+	0x13, 0x20, 0x06, 0x21, 0x06, 0x21, 0x05, 0x20,
+	0x12, 0x20, 0x06, 0x20, 0x31, 0x20, 0x04, 0x20, 0x31, 0x20, 0x04, 0x20,
+	0x11, 0x20, 0x08, 0x20, 0x31, 0x20, 0x02, 0x20, 0x31, 0x20, 0x05, 0x20,
+	0x10, 0x20, 0x0A, 0x20, 0x31, 0x20, 0x00, 0x20, 0x31, 0x20, 0x06, 0x20,
+	0x20, 0x0C, 0x20, 0x31, 0x20, 0x31, 0x20, 0x07, 0x20,
+	0x20, 0x0D, 0x20, 0x32, 0x20, 0x08, 0x20,
+	0x20, 0x0D, 0x20, 0x32, 0x20, 0x08, 0x20,
+	0x20, 0x0C, 0x20, 0x31, 0x20, 0x31, 0x20, 0x07, 0x20,
+	0x10, 0x20, 0x0A, 0x20, 0x31, 0x20, 0x00, 0x20, 0x31, 0x20, 0x06, 0x20,
+	0x11, 0x20, 0x08, 0x20, 0x31, 0x20, 0x02, 0x20, 0x31, 0x20, 0x05, 0x20,
+	0x12, 0x20, 0x06, 0x20, 0x31, 0x20, 0x04, 0x20, 0x31, 0x20, 0x04, 0x20,
+	0x13, 0x20, 0x06, 0x21, 0x06, 0x21, 0x05, 0x20,
+	0x14, 0x20, 0x0F, 0x06, 0x20,
+	0x15, 0x20, 0x0F, 0x05, 0x20,
+	0x16, 0x20, 0x0F, 0x04, 0x20,
+	0x17, 0x20, 0x0F, 0x03, 0x20,
+	0x18, 0x20, 0x0F, 0x01, 0x20, 0x10,
+	0x19, 0x2F, 0x21, 0x11,
 };
 
 extern const uint8_t IconEnter[] =
-{   30, 30,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x00, 0x01, 0x10, 0x00, 0x11, 0x00, 0x01, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11
+{	30, 30,		// width, height
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x1A, 0x02,
+	0x1F, 0x1A, 0x02,
+	0x1F, 0x1A, 0x02,
+	0x1F, 0x1A, 0x02,
+	0x1F, 0x1A, 0x02,
+	0x1F, 0x1A, 0x02,
+	0x1F, 0x1A, 0x02,
+	0x1F, 0x1A, 0x02,
+	0x15, 0x01, 0x1F, 0x12, 0x02,
+	0x14, 0x02, 0x1F, 0x12, 0x02,
+	0x13, 0x03, 0x1F, 0x12, 0x02,
+	0x12, 0x03, 0x1F, 0x13, 0x02,
+	0x11, 0x03, 0x1F, 0x14, 0x02,
+	0x10, 0x0F, 0x0C,
+	0x0F, 0x0D,
+	0x10, 0x0F, 0x0C,
+	0x11, 0x03, 0x1F, 0x17,
+	0x12, 0x03, 0x1F, 0x16,
+	0x13, 0x03, 0x1F, 0x15,
+	0x14, 0x02, 0x1F, 0x15,
+	0x15, 0x01, 0x1F, 0x15,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
 };
 
 #else
 
 extern const uint8_t IconBackspace[] =
-{   28, 18,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x12, 0x00, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x00, 0x02,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x00, 0x21, 0x11, 0x11,
-    0x11, 0x11, 0x20, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x11, 0x12, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x02, 0x20, 0x02, 0x32, 0x00, 0x00, 0x00, 0x23, 0x20, 0x02,
-    0x20, 0x02, 0x33, 0x20, 0x00, 0x02, 0x33, 0x20, 0x02, 0x20, 0x00, 0x23,
-    0x32, 0x00, 0x23, 0x32, 0x00, 0x02, 0x20, 0x00, 0x02, 0x33, 0x22, 0x33,
-    0x20, 0x00, 0x02, 0x20, 0x00, 0x00, 0x23, 0x33, 0x32, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x02, 0x33, 0x24, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00,
-    0x23, 0x33, 0x32, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x33, 0x22, 0x33,
-    0x20, 0x00, 0x02, 0x20, 0x00, 0x23, 0x32, 0x00, 0x23, 0x32, 0x00, 0x02,
-    0x20, 0x02, 0x33, 0x20, 0x00, 0x02, 0x33, 0x20, 0x02, 0x20, 0x02, 0x32,
-    0x00, 0x00, 0x00, 0x23, 0x20, 0x02, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21
+{	28, 18,		// width, height
+	0x17, 0x2F, 0x22, 0x10,
+	0x16, 0x20, 0x0F, 0x02, 0x20,
+	0x15, 0x20, 0x0F, 0x03, 0x20,
+	0x14, 0x20, 0x04, 0x21, 0x06, 0x21, 0x04, 0x20,
+	0x13, 0x20, 0x04, 0x20, 0x31, 0x20, 0x04, 0x20, 0x31, 0x20, 0x03, 0x20,
+	0x12, 0x20, 0x06, 0x20, 0x31, 0x20, 0x02, 0x20, 0x31, 0x20, 0x04, 0x20,
+	0x11, 0x20, 0x08, 0x20, 0x31, 0x20, 0x00, 0x20, 0x31, 0x20, 0x05, 0x20,
+	0x10, 0x20, 0x0A, 0x20, 0x31, 0x20, 0x31, 0x20, 0x06, 0x20,
+	0x20, 0x0C, 0x20, 0x32, 0x20, 0x07, 0x20,
+	0x20, 0x0C, 0x20, 0x32, 0x20, 0x07, 0x20,
+	0x10, 0x20, 0x0A, 0x20, 0x31, 0x20, 0x31, 0x20, 0x06, 0x20,
+	0x11, 0x20, 0x08, 0x20, 0x31, 0x20, 0x40, 0x20, 0x31, 0x20, 0x05, 0x20,
+	0x12, 0x20, 0x06, 0x20, 0x31, 0x20, 0x02, 0x20, 0x31, 0x20, 0x04, 0x20,
+	0x13, 0x20, 0x04, 0x20, 0x31, 0x20, 0x04, 0x20, 0x31, 0x20, 0x03, 0x20,
+	0x14, 0x20, 0x04, 0x21, 0x06, 0x21, 0x04, 0x20,
+	0x15, 0x20, 0x0F, 0x03, 0x20,
+	0x16, 0x20, 0x0F, 0x02, 0x20,
+	0x17, 0x2F, 0x22, 0x10,
 };
 
 extern const uint8_t IconEnter[] =
-{   30, 21,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00,
-    0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x00, 0x01, 0x10, 0x00, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x11, 0x11, 0x11
+{	30, 21,		// width, height
+	0x1F, 0x1D,
+	0x1F, 0x1A, 0x02,
+	0x1F, 0x1A, 0x02,
+	0x1F, 0x1A, 0x02,
+	0x1F, 0x1A, 0x02,
+	0x1F, 0x1A, 0x02,
+	0x15, 0x01, 0x1F, 0x12, 0x02,
+	0x14, 0x02, 0x1F, 0x12, 0x02,
+	0x13, 0x03, 0x1F, 0x12, 0x02,
+	0x12, 0x03, 0x1F, 0x13, 0x02,
+	0x11, 0x03, 0x1F, 0x14, 0x02,
+	0x10, 0x0F, 0x0C,
+	0x0F, 0x0D,
+	0x10, 0x0F, 0x0C,
+	0x11, 0x03, 0x1F, 0x17,
+	0x12, 0x03, 0x1F, 0x16,
+	0x13, 0x03, 0x1F, 0x15,
+	0x14, 0x02, 0x1F, 0x15,
+	0x15, 0x01, 0x1F, 0x15,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
 };
 
 #endif
@@ -1,8 +1,10 @@
 /*
  * MiscIcons.cpp
  *
- * Created: 29/11/2015 12:11:08
- *  Author: David
+ * Generated from the bitmaps in this folder by Tools/iconpack/iconpack.py - do not edit.
+ *
+ * LARGE_FONT:   2695 bytes as 4-bit pixels,   938 bytes run-length encoded
+ * Small font:   1293 bytes as 4-bit pixels,   592 bytes run-length encoded
  */
 
 #include "asf.h"
@@ -11,381 +13,299 @@
 
 #if LARGE_FONT
 
-extern const uint8_t IconCancel[] =
-{   30, 30,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x86, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x68, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11,
-    0x11, 0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x11, 0x11, 0x11, 0x16, 0x66, 0x66, 0x86, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x68, 0x66, 0x66, 0x61, 0x11, 0x11, 0x16, 0x66, 0x66, 0x77, 0x86,
-    0x66, 0x66, 0x66, 0x68, 0x77, 0x66, 0x66, 0x61, 0x11, 0x11, 0x66, 0x66,
-    0x63, 0x33, 0x78, 0x66, 0x66, 0x66, 0x87, 0x33, 0x36, 0x66, 0x66, 0x11,
-    0x18, 0x66, 0x68, 0x73, 0x33, 0x37, 0x66, 0x66, 0x66, 0x73, 0x33, 0x37,
-    0x86, 0x66, 0x81, 0x16, 0x66, 0x66, 0x73, 0x33, 0x33, 0x66, 0x66, 0x66,
-    0x33, 0x33, 0x37, 0x66, 0x66, 0x61, 0x16, 0x66, 0x66, 0x87, 0x33, 0x33,
-    0x36, 0x66, 0x63, 0x33, 0x33, 0x78, 0x66, 0x66, 0x61, 0x66, 0x66, 0x66,
-    0x68, 0x73, 0x33, 0x33, 0x66, 0x33, 0x33, 0x37, 0x86, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x33, 0x33, 0x33,
-    0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x33, 0x33, 0x33, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x33, 0x33, 0x33, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x33, 0x33, 0x33, 0x36, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0x73, 0x33,
-    0x33, 0x66, 0x33, 0x33, 0x37, 0x86, 0x66, 0x66, 0x66, 0x16, 0x66, 0x66,
-    0x87, 0x33, 0x33, 0x36, 0x66, 0x63, 0x33, 0x33, 0x78, 0x66, 0x66, 0x61,
-    0x16, 0x66, 0x66, 0x73, 0x33, 0x33, 0x66, 0x66, 0x66, 0x33, 0x33, 0x37,
-    0x66, 0x66, 0x61, 0x18, 0x66, 0x68, 0x73, 0x33, 0x37, 0x66, 0x66, 0x66,
-    0x73, 0x33, 0x37, 0x86, 0x66, 0x81, 0x11, 0x66, 0x66, 0x63, 0x33, 0x78,
-    0x66, 0x66, 0x66, 0x87, 0x33, 0x36, 0x66, 0x66, 0x11, 0x11, 0x16, 0x66,
-    0x66, 0x77, 0x86, 0x66, 0x66, 0x66, 0x68, 0x77, 0x66, 0x66, 0x61, 0x11,
-    0x11, 0x16, 0x66, 0x66, 0x86, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0x66,
-    0x66, 0x61, 0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 0x16, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x16, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x86, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x66, 0x66, 0x66,
-    0x61, 0x11, 0x11, 0x11, 0x11, 0x11
+extern const uint8_t IconOk[] =
+{	30, 30,		// width, height
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x17, 0xB1, 0x13,
+	0x1F, 0x16, 0xB3, 0x12,
+	0x1F, 0x15, 0xB5, 0x11,
+	0x1F, 0x14, 0xB7, 0x10,
+	0x1F, 0x13, 0xB9,
+	0x1F, 0x12, 0xB9, 0x10,
+	0x1F, 0x11, 0xB9, 0x11,
+	0x1F, 0x10, 0xB9, 0x12,
+	0x1F, 0xB9, 0x13,
+	0x13, 0xB0, 0x19, 0xB9, 0x14,
+	0x12, 0xB2, 0x17, 0xB9, 0x15,
+	0x11, 0xB4, 0x15, 0xB9, 0x16,
+	0x10, 0xB6, 0x13, 0xB9, 0x17,
+	0xB8, 0x11, 0xB9, 0x18,
+	0xBF, 0xB3, 0x19,
+	0x10, 0xBF, 0xB1, 0x1A,
+	0x11, 0xBF, 0x1B,
+	0x12, 0xBD, 0x1C,
+	0x13, 0xBB, 0x1D,
+	0x14, 0xB9, 0x1E,
+	0x15, 0xB7, 0x1F,
+	0x16, 0xB5, 0x1F, 0x10,
+	0x17, 0xB3, 0x1F, 0x11,
+	0x18, 0xB1, 0x1F, 0x12,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
 };
 
-extern const uint8_t IconOk[] =
-{   30, 30,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb,
-    0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0xbb, 0xbb, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x1b, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x1b, 0xbb, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x1b, 0xbb, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb, 0xbb, 0xbb, 0xbb, 0xb1, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x1b, 0xbb, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x1b, 0xbb, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb, 0xbb, 0xbb, 0xbb, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xb1,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b,
-    0xbb, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11
+extern const uint8_t IconCancel[] =
+{	30, 30,		// width, height
+	0x1A, 0x67, 0x1A,
+	0x17, 0x80, 0x6B, 0x80, 0x17,
+	0x16, 0x6F, 0x16,
+	0x14, 0x6F, 0x63, 0x14,
+	0x13, 0x6F, 0x65, 0x13,
+	0x12, 0x64, 0x80, 0x6B, 0x80, 0x64, 0x12,
+	0x12, 0x64, 0x71, 0x80, 0x67, 0x80, 0x71, 0x64, 0x12,
+	0x11, 0x64, 0x32, 0x70, 0x80, 0x65, 0x80, 0x70, 0x32, 0x64, 0x11,
+	0x10, 0x80, 0x62, 0x80, 0x70, 0x33, 0x70, 0x65, 0x70, 0x33, 0x70, 0x80, 0x62, 0x80, 0x10,
+	0x10, 0x64, 0x70, 0x34, 0x65, 0x34, 0x70, 0x64, 0x10,
+	0x10, 0x64, 0x80, 0x70, 0x34, 0x63, 0x34, 0x70, 0x80, 0x64, 0x10,
+	0x66, 0x80, 0x70, 0x34, 0x61, 0x34, 0x70, 0x80, 0x66,
+	0x69, 0x39, 0x69,
+	0x6A, 0x37, 0x6A,
+	0x6B, 0x35, 0x6B,
+	0x6B, 0x35, 0x6B,
+	0x6A, 0x37, 0x6A,
+	0x69, 0x39, 0x69,
+	0x66, 0x80, 0x70, 0x34, 0x61, 0x34, 0x70, 0x80, 0x66,
+	0x10, 0x64, 0x80, 0x70, 0x34, 0x63, 0x34, 0x70, 0x80, 0x64, 0x10,
+	0x10, 0x64, 0x70, 0x34, 0x65, 0x34, 0x70, 0x64, 0x10,
+	0x10, 0x80, 0x62, 0x80, 0x70, 0x33, 0x70, 0x65, 0x70, 0x33, 0x70, 0x80, 0x62, 0x80, 0x10,
+	0x11, 0x64, 0x32, 0x70, 0x80, 0x65, 0x80, 0x70, 0x32, 0x64, 0x11,
+	0x12, 0x64, 0x71, 0x80, 0x67, 0x80, 0x71, 0x64, 0x12,
+	0x12, 0x64, 0x80, 0x6B, 0x80, 0x64, 0x12,
+	0x13, 0x6F, 0x65, 0x13,
+	0x14, 0x6F, 0x63, 0x14,
+	0x16, 0x6F, 0x16,
+	0x17, 0x80, 0x6B, 0x80, 0x17,
+	0x1A, 0x67, 0x1A,
 };
 
 extern const uint8_t IconFiles[] =
-{   30, 30,   // width, height
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x11, 0x11, 0x11, 0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x10, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x10, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11,
-    0x11, 0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x11, 0x00,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11,
-    0x11, 0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x11, 0x11, 0x11, 0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x10, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x11, 0x02,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x22, 0x99, 0x29, 0x92, 0x99,
-    0x29, 0x92, 0x99, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x22, 0x99,
-    0x29, 0x92, 0x99, 0x29, 0x92, 0x99, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x22, 0x99, 0x29, 0x92, 0x99, 0x29, 0x92, 0x99, 0x20, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x22, 0x99, 0x29, 0x92, 0x99, 0x29, 0x92, 0x99,
-    0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x22, 0x99, 0x29, 0x92, 0x99,
-    0x29, 0x92, 0x99, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x22, 0x99,
-    0x29, 0x92, 0x99, 0x29, 0x92, 0x99, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11
+{	30, 30,		// width, height
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x10, 0x03, 0x16, 0x02, 0x1E,
+	0x00, 0x23, 0x00, 0x14, 0x00, 0x22, 0x00, 0x1D,
+	0x00, 0x23, 0x00, 0x14, 0x00, 0x23, 0x00, 0x1C,
+	0x00, 0x24, 0x04, 0x25, 0x00, 0x1B,
+	0x00, 0x2F, 0x20, 0x08, 0x12,
+	0x00, 0x2F, 0x29, 0x00, 0x11,
+	0x00, 0x2F, 0x2A, 0x00, 0x10,
+	0x00, 0x2F, 0x23, 0x95, 0x21, 0x00,
+	0x00, 0x2F, 0x23, 0x95, 0x21, 0x00,
+	0x00, 0x2F, 0x2B, 0x00,
+	0x00, 0x2F, 0x23, 0x95, 0x21, 0x00,
+	0x00, 0x2F, 0x23, 0x95, 0x21, 0x00,
+	0x00, 0x2F, 0x2B, 0x00,
+	0x00, 0x2F, 0x23, 0x95, 0x21, 0x00,
+	0x00, 0x2F, 0x23, 0x95, 0x21, 0x00,
+	0x00, 0x2F, 0x2B, 0x00,
+	0x00, 0x2F, 0x23, 0x95, 0x21, 0x00,
+	0x00, 0x2F, 0x23, 0x95, 0x21, 0x00,
+	0x00, 0x2F, 0x2B, 0x00,
+	0x00, 0x2F, 0x23, 0x95, 0x21, 0x00,
+	0x00, 0x2F, 0x23, 0x95, 0x21, 0x00,
+	0x00, 0x2F, 0x2B, 0x00,
+	0x10, 0x0F, 0x0B, 0x10,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1F, 0x1D,
 };
 
 extern const uint8_t IconKeyboard[] =
-{   61, 29,   // width, height
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10,
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
-    0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00,
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00,
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
-    0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11,
-    0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10,
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
-    0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00,
-    0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01,
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00,
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11,
-    0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11,
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00,
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00,
-    0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11,
-    0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11,
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10,
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
-    0x01, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00,
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10
+{	61, 29,		// width, height
+	0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04,
+	0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04,
+	0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04,
+	0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04,
+	0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04,
+	0x1F, 0x1F, 0x1F, 0x1C,
+	0x1F, 0x1F, 0x1F, 0x1C,
+	0x1F, 0x1F, 0x1F, 0x1C,
+	0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x14,
+	0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x14,
+	0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x14,
+	0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x14,
+	0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x14,
+	0x1F, 0x1F, 0x1F, 0x1C,
+	0x1F, 0x1F, 0x1F, 0x1C,
+	0x1F, 0x1F, 0x1F, 0x1C,
+	0x15, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x11,
+	0x15, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x11,
+	0x15, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x11,
+	0x15, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x11,
+	0x15, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x11,
+	0x1F, 0x1F, 0x1F, 0x1C,
+	0x1F, 0x1F, 0x1F, 0x1C,
+	0x1F, 0x1F, 0x1F, 0x1C,
+	0x1E, 0x0F, 0x0F, 0x00, 0x1C,
+	0x1E, 0x0F, 0x0F, 0x00, 0x1C,
+	0x1E, 0x0F, 0x0F, 0x00, 0x1C,
+	0x1E, 0x0F, 0x0F, 0x00, 0x1C,
+	0x1E, 0x0F, 0x0F, 0x00, 0x1C,
 };
 
 extern const uint8_t IconTrash[] =
-{   30, 30,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc1, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x11,
-    0x11, 0x11, 0x11, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc1, 0x11, 0x11, 0x1c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x11, 0x11, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x11, 0x1c, 0xc1,
-    0xcc, 0xc3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xcc, 0xc1,
-    0x11, 0xcc, 0x11, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc1, 0x11, 0xc1, 0x11, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x11, 0xc1, 0x11, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x11, 0xc1, 0x11,
-    0xcc, 0xc3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xcc, 0xc1,
-    0x11, 0xc1, 0x11, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc1, 0x11, 0xc1, 0x11, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x11, 0xcc, 0x11, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x11, 0x1c, 0xc1,
-    0xcc, 0xc3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xcc, 0xc1,
-    0x11, 0x11, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc1, 0x11, 0x11, 0x1c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x11, 0x11, 0x11, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x11, 0x11, 0x11,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x11,
-    0x11, 0x11, 0x11, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11
+{	30, 30,		// width, height
+	0x1F, 0x1D,
+	0x1F, 0x1D,
+	0x1B, 0xC6, 0x1A,
+	0x1A, 0xC1, 0x14, 0xC1, 0x19,
+	0x19, 0xC1, 0x16, 0xC1, 0x18,
+	0x18, 0xC1, 0x18, 0xC1, 0x17,
+	0x14, 0xCF, 0xC4, 0x13,
+	0x16, 0xCF, 0xC0, 0x15,
+	0x16, 0xCF, 0xC0, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xC3, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC3, 0x15,
+	0x16, 0xCF, 0xC0, 0x15,
+	0x16, 0xCF, 0xC0, 0x15,
+	0x17, 0xCE, 0x16,
+	0x1F, 0x1D,
 };
 
 #else
 
 extern const uint8_t IconOk[] =
-{   21, 21,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0xbb, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0xbb, 0xbb, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb,
-    0xbb, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb, 0xbb,
-    0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb, 0xbb, 0xbb,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb, 0xbb, 0xbb, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb,
-    0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xb1,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0xbb, 0xbb, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb,
-    0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xbb, 0xb1,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xb1, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10
+{	21, 21,		// width, height
+	0x1F, 0x14,
+	0x1F, 0x14,
+	0x1F, 0x14,
+	0x1F, 0x10, 0xB1, 0x11,
+	0x1F, 0xB3, 0x10,
+	0x1E, 0xB5,
+	0x1D, 0xB6,
+	0x1C, 0xB6, 0x10,
+	0x1B, 0xB6, 0x11,
+	0x12, 0xB1, 0x15, 0xB6, 0x12,
+	0x11, 0xB3, 0x13, 0xB6, 0x13,
+	0x10, 0xB5, 0x11, 0xB6, 0x14,
+	0x10, 0xBD, 0x15,
+	0x11, 0xBB, 0x16,
+	0x12, 0xB9, 0x17,
+	0x13, 0xB7, 0x18,
+	0x14, 0xB5, 0x19,
+	0x15, 0xB3, 0x1A,
+	0x16, 0xB1, 0x1B,
+	0x1F, 0x14,
+	0x1F, 0x14,
 };
 
 extern const uint8_t IconCancel[] =
-{   21, 21,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 0x16, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x16, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x11, 0x66, 0x66, 0x78, 0x66, 0x66,
-    0x68, 0x76, 0x66, 0x61, 0x11, 0x66, 0x66, 0x33, 0x76, 0x66, 0x66, 0x73,
-    0x36, 0x66, 0x61, 0x16, 0x66, 0x73, 0x33, 0x66, 0x66, 0x63, 0x33, 0x76,
-    0x66, 0x11, 0x66, 0x68, 0x73, 0x33, 0x66, 0x63, 0x33, 0x78, 0x66, 0x61,
-    0x66, 0x66, 0x66, 0x63, 0x33, 0x33, 0x33, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x63, 0x33, 0x33, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x33, 0x33, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63,
-    0x33, 0x33, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x33, 0x33,
-    0x33, 0x66, 0x66, 0x66, 0x61, 0x66, 0x68, 0x73, 0x33, 0x66, 0x63, 0x33,
-    0x78, 0x66, 0x61, 0x16, 0x66, 0x73, 0x33, 0x66, 0x66, 0x63, 0x33, 0x76,
-    0x66, 0x11, 0x66, 0x66, 0x33, 0x76, 0x66, 0x66, 0x73, 0x36, 0x66, 0x61,
-    0x11, 0x66, 0x66, 0x78, 0x66, 0x66, 0x68, 0x76, 0x66, 0x61, 0x11, 0x11,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x16, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 0x66,
-    0x61, 0x11, 0x11, 0x11, 0x10
+{	21, 21,		// width, height
+	0x17, 0x64, 0x17,
+	0x14, 0x6A, 0x14,
+	0x12, 0x6D, 0x13,
+	0x11, 0x6F, 0x60, 0x11,
+	0x11, 0x63, 0x70, 0x80, 0x64, 0x80, 0x70, 0x63, 0x11,
+	0x10, 0x63, 0x31, 0x70, 0x64, 0x70, 0x31, 0x63, 0x10,
+	0x10, 0x62, 0x70, 0x32, 0x64, 0x32, 0x70, 0x62, 0x10,
+	0x10, 0x62, 0x80, 0x70, 0x32, 0x62, 0x32, 0x70, 0x80, 0x62, 0x10,
+	0x66, 0x36, 0x66,
+	0x67, 0x34, 0x67,
+	0x67, 0x34, 0x67,
+	0x67, 0x34, 0x67,
+	0x66, 0x36, 0x66,
+	0x10, 0x62, 0x80, 0x70, 0x32, 0x62, 0x32, 0x70, 0x80, 0x62, 0x10,
+	0x10, 0x62, 0x70, 0x32, 0x64, 0x32, 0x70, 0x62, 0x10,
+	0x10, 0x63, 0x31, 0x70, 0x64, 0x70, 0x31, 0x63, 0x10,
+	0x11, 0x63, 0x70, 0x80, 0x64, 0x80, 0x70, 0x63, 0x11,
+	0x12, 0x6E, 0x12,
+	0x12, 0x6D, 0x13,
+	0x14, 0x6A, 0x14,
+	0x17, 0x64, 0x17,
 };
 
 extern const uint8_t IconFiles[] =
-{   21, 21,   // width, height
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x10,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x02, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0x11, 0x10, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x10, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x01, 0x11, 0x11, 0x10, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x20, 0x11, 0x11, 0x11, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x01, 0x11, 0x11, 0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11,
-    0x11, 0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0x11, 0x10,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x02, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0x11, 0x11, 0x02, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x02, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x01, 0x11, 0x11, 0x11, 0x02, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x20, 0x11, 0x11, 0x11, 0x10, 0x22, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x01, 0x11, 0x11, 0x11, 0x02, 0x29, 0x29, 0x29, 0x29, 0x29, 0x20, 0x11,
-    0x11, 0x11, 0x10, 0x22, 0x92, 0x92, 0x92, 0x92, 0x92, 0x01, 0x11, 0x11,
-    0x11, 0x02, 0x29, 0x29, 0x29, 0x29, 0x29, 0x20, 0x11, 0x11, 0x11, 0x10,
-    0x22, 0x92, 0x92, 0x92, 0x92, 0x92, 0x01, 0x11, 0x11, 0x11, 0x10, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x11, 0x10
+{	21, 21,		// width, height
+	0x1F, 0x14,
+	0x1F, 0x14,
+	0x10, 0x02, 0x14, 0x01, 0x19,
+	0x00, 0x22, 0x00, 0x12, 0x00, 0x21, 0x00, 0x18,
+	0x00, 0x23, 0x02, 0x23, 0x00, 0x17,
+	0x00, 0x2B, 0x05, 0x11,
+	0x00, 0x2F, 0x21, 0x00, 0x10,
+	0x00, 0x2F, 0x22, 0x00,
+	0x00, 0x2C, 0x94, 0x20, 0x00,
+	0x00, 0x2F, 0x22, 0x00,
+	0x00, 0x2C, 0x94, 0x20, 0x00,
+	0x00, 0x2F, 0x22, 0x00,
+	0x00, 0x2C, 0x94, 0x20, 0x00,
+	0x00, 0x2F, 0x22, 0x00,
+	0x00, 0x2C, 0x94, 0x20, 0x00,
+	0x00, 0x2F, 0x22, 0x00,
+	0x00, 0x2C, 0x94, 0x20, 0x00,
+	0x00, 0x2F, 0x22, 0x00,
+	0x10, 0x0F, 0x02, 0x10,
+	0x1F, 0x14,
+	0x1F, 0x14,
 };
 
 extern const uint8_t IconKeyboard[] =
-{   40, 21,   // width, height
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x00,
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x00,
-    0x01, 0x11, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11,
-    0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11,
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00,
-    0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11,
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
-    0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11,
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x01, 0x10, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11,
-    0x11, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x11,
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11,
-    0x11, 0x10, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11,
-    0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00,
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
-    0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x11,
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00,
-    0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-    0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x00,
-    0x01, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11,
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x00,
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00,
-    0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11,
-    0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x01, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-    0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11
+{	40, 21,		// width, height
+	0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03,
+	0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03,
+	0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03,
+	0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03,
+	0x1F, 0x1F, 0x17,
+	0x1F, 0x1F, 0x17,
+	0x12, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x12,
+	0x12, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x12,
+	0x12, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x12,
+	0x12, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x12,
+	0x1F, 0x1F, 0x17,
+	0x1F, 0x1F, 0x17,
+	0x14, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x10,
+	0x14, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x10,
+	0x14, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x10,
+	0x14, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0x10,
+	0x1F, 0x1F, 0x17,
+	0x1F, 0x1F, 0x17,
+	0x18, 0x0F, 0x06, 0x17,
+	0x18, 0x0F, 0x06, 0x17,
+	0x18, 0x0F, 0x06, 0x17,
 };
 
 extern const uint8_t IconTrash[] =
-{   20, 20,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc1, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x11,
-    0x11, 0x1c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x11, 0xcc,
-    0xcc, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3c, 0xc1, 0x1c, 0xc1, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x1c, 0x11, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xc1, 0x1c, 0x11, 0xcc, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x3c, 0xc1, 0x1c, 0x11, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1,
-    0x1c, 0xc1, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x11, 0xcc,
-    0xcc, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3c, 0xc1, 0x11, 0x1c, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1, 0x11, 0x11, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0x11, 0x11, 0x11, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11
+{	20, 20,		// width, height
+	0x1F, 0x13,
+	0x17, 0xC4, 0x16,
+	0x16, 0xC1, 0x12, 0xC1, 0x15,
+	0x15, 0xC1, 0x14, 0xC1, 0x14,
+	0x12, 0xCE, 0x11,
+	0x14, 0xCA, 0x13,
+	0x14, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x13,
+	0x14, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x13,
+	0x14, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x13,
+	0x14, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x13,
+	0x14, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x13,
+	0x14, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x13,
+	0x14, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x13,
+	0x14, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x13,
+	0x14, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x13,
+	0x14, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x13,
+	0x14, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x13,
+	0x14, 0xCA, 0x13,
+	0x15, 0xC8, 0x14,
+	0x1F, 0x13,
 };
 
 #endif
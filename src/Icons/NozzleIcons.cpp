@@ -1,8 +1,10 @@
 /*
  * NozzleIcons.cpp
  *
- * Created: 29/11/2015 12:09:40
- *  Author: David
+ * Generated from the bitmaps in this folder by Tools/iconpack/iconpack.py - do not edit.
+ *
+ * LARGE_FONT:   1658 bytes as 4-bit pixels,   621 bytes run-length encoded
+ * Small font:    870 bytes as 4-bit pixels,   443 bytes run-length encoded
  */
 
 #include "asf.h"
@@ -10,234 +12,239 @@
 #include "Icons.hpp"
 
 #if LARGE_FONT
+
 extern const uint8_t IconNozzle[] =
-{	30, 28,	// width, height
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
+{	30, 28,		// width, height
+	0x15, 0x0F, 0x01, 0x15,
+	0x15, 0x0F, 0x01, 0x15,
+	0x11, 0x0F, 0x05, 0x15,
+	0x11, 0x0F, 0x05, 0x15,
+	0x15, 0x0F, 0x05, 0x11,
+	0x15, 0x0F, 0x05, 0x11,
+	0x11, 0x0F, 0x05, 0x15,
+	0x11, 0x0F, 0x05, 0x15,
+	0x15, 0x0F, 0x05, 0x11,
+	0x15, 0x0F, 0x05, 0x11,
+	0x11, 0x0F, 0x05, 0x15,
+	0x11, 0x0F, 0x05, 0x15,
+	0x15, 0x0F, 0x05, 0x11,
+	0x15, 0x0F, 0x05, 0x11,
+	0x11, 0x0F, 0x05, 0x15,
+	0x11, 0x0F, 0x05, 0x15,
+	0x15, 0x0F, 0x01, 0x15,
+	0x0F, 0x0D,
+	0x0F, 0x0D,
+	0x0F, 0x0D,
+	0x0F, 0x0D,
+	0x0F, 0x0D,
+	0x17, 0x0D, 0x17,
+	0x18, 0x0B, 0x18,
+	0x19, 0x09, 0x19,
+	0x1A, 0x07, 0x1A,
+	0x1B, 0x05, 0x1B,
+	0x1C, 0x03, 0x1C,
 };
 
 extern const uint8_t IconSpindle[] =
-{	30, 28,	// width, height
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00, 0x10, 0x00,
-	0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x03, 0x33, 0x01, 0x11, 0x11, 0x11, 0x00,
-	0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x03, 0x00, 0x01, 0x11, 0x10, 0x01, 0x00,
-	0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x33, 0x03, 0x33, 0x01, 0x11, 0x11, 0x11, 0x10,
-	0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x33, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x10,
-	0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x33, 0x03, 0x00, 0x00, 0x30, 0x30, 0x30, 0x10,
-	0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x33, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x10,
-	0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x33, 0x03, 0x33, 0x01, 0x11, 0x11, 0x11, 0x10,
-	0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x03, 0x00, 0x01, 0x11, 0x10, 0x01, 0x00,
-	0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x03, 0x33, 0x01, 0x11, 0x11, 0x11, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x11, 0x00, 0x10, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
+{	30, 28,		// width, height
+	0x0F, 0x0D,
+	0x0F, 0x0D,
+	0x17, 0x01, 0x38, 0x01, 0x18,
+	0x17, 0x01, 0x38, 0x01, 0x18,
+	0x17, 0x01, 0x38, 0x01, 0x18,
+	0x17, 0x01, 0x38, 0x01, 0x18,
+	0x17, 0x01, 0x38, 0x01, 0x18,
+	0x17, 0x01, 0x38, 0x01, 0x18,
+	0x17, 0x01, 0x38, 0x01, 0x18,
+	0x17, 0x01, 0x38, 0x01, 0x18,
+	0x17, 0x0C, 0x18,
+	0x17, 0x0C, 0x18,
+	0x19, 0x01, 0x34, 0x01, 0x1A,
+	0x19, 0x01, 0x34, 0x01, 0x1A,
+	0x18, 0x0A, 0x19,
+	0x18, 0x00, 0x38, 0x00, 0x19,
+	0x18, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x30, 0x00, 0x19,
+	0x18, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x30, 0x00, 0x19,
+	0x18, 0x0A, 0x19,
+	0x1C, 0x02, 0x1D,
+	0x1C, 0x00, 0x30, 0x00, 0x1D,
+	0x16, 0x00, 0x14, 0x02, 0x14, 0x00, 0x17,
+	0x16, 0x00, 0x10, 0x00, 0x12, 0x00, 0x30, 0x00, 0x12, 0x00, 0x10, 0x00, 0x17,
+	0x18, 0x00, 0x10, 0x00, 0x10, 0x02, 0x10, 0x00, 0x10, 0x00, 0x19,
+	0x1A, 0x00, 0x10, 0x00, 0x30, 0x00, 0x10, 0x00, 0x1B,
+	0x09, 0x12, 0x02, 0x12, 0x0A,
+	0x0B, 0x14, 0x0C,
+	0x0F, 0x0D,
 };
 
 extern const uint8_t IconBed[] =
-{   27, 30,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x01,
-    0x10, 0x00, 0x00, 0x10, 0x01, 0x11, 0x00, 0x11, 0x10, 0x01, 0x11, 0x00,
-    0x11, 0x10, 0x01, 0x10, 0x00, 0x00, 0x10, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x01,
-    0x10, 0x00, 0x00, 0x10, 0x01, 0x11, 0x00, 0x11, 0x10, 0x01, 0x11, 0x00,
-    0x11, 0x10, 0x01, 0x10, 0x00, 0x00, 0x10, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x01,
-    0x10, 0x00, 0x00, 0x10, 0x01, 0x11, 0x00, 0x11, 0x10, 0x01, 0x11, 0x00,
-    0x11, 0x10, 0x01, 0x10, 0x00, 0x00, 0x10, 0x11, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11,
-    0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00
+{	27, 30,		// width, height
+	0x1F, 0x1A,
+	0x14, 0x01, 0x15, 0x01, 0x15, 0x01, 0x13,
+	0x13, 0x01, 0x15, 0x01, 0x15, 0x01, 0x14,
+	0x12, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15,
+	0x12, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15,
+	0x12, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15,
+	0x13, 0x01, 0x15, 0x01, 0x15, 0x01, 0x14,
+	0x14, 0x01, 0x15, 0x01, 0x15, 0x01, 0x13,
+	0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x12,
+	0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x12,
+	0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x12,
+	0x14, 0x01, 0x15, 0x01, 0x15, 0x01, 0x13,
+	0x13, 0x01, 0x15, 0x01, 0x15, 0x01, 0x14,
+	0x12, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15,
+	0x12, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15,
+	0x12, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15,
+	0x13, 0x01, 0x15, 0x01, 0x15, 0x01, 0x14,
+	0x14, 0x01, 0x15, 0x01, 0x15, 0x01, 0x13,
+	0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x12,
+	0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x12,
+	0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x12,
+	0x14, 0x01, 0x15, 0x01, 0x15, 0x01, 0x13,
+	0x13, 0x01, 0x15, 0x01, 0x15, 0x01, 0x14,
+	0x1F, 0x1A,
+	0x1F, 0x1A,
+	0x0F, 0x0A,
+	0x0F, 0x0A,
+	0x0F, 0x0A,
+	0x0F, 0x0A,
+	0x0F, 0x0A,
 };
 
 extern const uint8_t IconChamber[] =
-{	27, 30,	// width, height
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x10, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x10, 0x01, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x01, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x00, 0x11, 0x10, 0x01, 0x11, 0x00, 0x11, 0x10, 0x01, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x10, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x10, 0x01, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x01, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x00, 0x11, 0x10, 0x01, 0x11, 0x00, 0x11, 0x10, 0x01, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x10, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x10, 0x01, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x01, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x00, 0x11, 0x10, 0x01, 0x11, 0x00, 0x11, 0x10, 0x01, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+{	27, 30,		// width, height
+	0x0F, 0x0A,
+	0x0F, 0x0A,
+	0x01, 0x1F, 0x16, 0x01,
+	0x01, 0x1F, 0x16, 0x01,
+	0x01, 0x1F, 0x16, 0x01,
+	0x01, 0x10, 0x01, 0x15, 0x01, 0x15, 0x01, 0x13, 0x01,
+	0x01, 0x11, 0x01, 0x15, 0x01, 0x15, 0x01, 0x12, 0x01,
+	0x01, 0x12, 0x01, 0x15, 0x01, 0x15, 0x01, 0x11, 0x01,
+	0x01, 0x13, 0x01, 0x15, 0x01, 0x15, 0x01, 0x10, 0x01,
+	0x01, 0x13, 0x01, 0x15, 0x01, 0x15, 0x01, 0x10, 0x01,
+	0x01, 0x13, 0x01, 0x15, 0x01, 0x15, 0x01, 0x10, 0x01,
+	0x01, 0x12, 0x01, 0x15, 0x01, 0x15, 0x01, 0x11, 0x01,
+	0x01, 0x11, 0x01, 0x15, 0x01, 0x15, 0x01, 0x12, 0x01,
+	0x01, 0x10, 0x01, 0x15, 0x01, 0x15, 0x01, 0x13, 0x01,
+	0x01, 0x10, 0x01, 0x15, 0x01, 0x15, 0x01, 0x13, 0x01,
+	0x01, 0x10, 0x01, 0x15, 0x01, 0x15, 0x01, 0x13, 0x01,
+	0x01, 0x11, 0x01, 0x15, 0x01, 0x15, 0x01, 0x12, 0x01,
+	0x01, 0x12, 0x01, 0x15, 0x01, 0x15, 0x01, 0x11, 0x01,
+	0x01, 0x13, 0x01, 0x15, 0x01, 0x15, 0x01, 0x10, 0x01,
+	0x01, 0x13, 0x01, 0x15, 0x01, 0x15, 0x01, 0x10, 0x01,
+	0x01, 0x13, 0x01, 0x15, 0x01, 0x15, 0x01, 0x10, 0x01,
+	0x01, 0x12, 0x01, 0x15, 0x01, 0x15, 0x01, 0x11, 0x01,
+	0x01, 0x11, 0x01, 0x15, 0x01, 0x15, 0x01, 0x12, 0x01,
+	0x01, 0x1F, 0x16, 0x01,
+	0x01, 0x1F, 0x16, 0x01,
+	0x0F, 0x0A,
+	0x0F, 0x0A,
+	0x0F, 0x0A,
+	0x0F, 0x0A,
+	0x0F, 0x0A,
 };
 
 #else
 
 extern const uint8_t IconNozzle[] =
-{	21, 21,	// width, height
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
-	0x01, 0x10, 0x01, 0x10, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x11,
-	0x00, 0x11, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-	0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-	0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10,
-	0x01, 0x10, 0x01, 0x10, 0x01, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x11,
-	0x00, 0x11, 0x00, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x10, 0x00, 0x11, 0x11, 0x10
+{	21, 21,		// width, height
+	0x13, 0x0C, 0x13,
+	0x11, 0x0E, 0x13,
+	0x11, 0x0F, 0x00, 0x11,
+	0x13, 0x0E, 0x11,
+	0x13, 0x0C, 0x13,
+	0x11, 0x0E, 0x13,
+	0x11, 0x0F, 0x00, 0x11,
+	0x13, 0x0E, 0x11,
+	0x13, 0x0C, 0x13,
+	0x11, 0x0E, 0x13,
+	0x11, 0x0F, 0x00, 0x11,
+	0x13, 0x0E, 0x11,
+	0x13, 0x0C, 0x13,
+	0x0F, 0x04,
+	0x0F, 0x04,
+	0x0F, 0x04,
+	0x15, 0x08, 0x15,
+	0x16, 0x06, 0x16,
+	0x17, 0x04, 0x17,
+	0x18, 0x02, 0x18,
+	0x19, 0x00, 0x19,
 };
 
 extern const uint8_t IconSpindle[] =
-{	21, 21,	// width, height
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x10, 0x00, 0x01,
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x11, 0x10, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
-	0x11, 0x11, 0x00, 0x00, 0x33, 0x33, 0x33, 0x00, 0x00, 0x33, 0x01, 0x10,
-	0x10, 0x00, 0x03, 0x33, 0x33, 0x30, 0x33, 0x03, 0x00, 0x11, 0x01, 0x11,
-	0x00, 0x33, 0x33, 0x33, 0x03, 0x30, 0x33, 0x01, 0x11, 0x11, 0x10, 0x03,
-	0x33, 0x33, 0x30, 0x33, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
-	0x33, 0x03, 0x30, 0x30, 0x03, 0x03, 0x03, 0x00, 0x03, 0x33, 0x33, 0x30,
-	0x33, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x03, 0x30,
-	0x33, 0x01, 0x11, 0x11, 0x10, 0x03, 0x33, 0x33, 0x30, 0x33, 0x03, 0x00,
-	0x11, 0x01, 0x11, 0x00, 0x33, 0x33, 0x33, 0x00, 0x00, 0x33, 0x01, 0x10,
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00,
-	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x10, 0x00, 0x01,
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11,
-	0x11, 0x11, 0x11, 0x01, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x11, 0x10, 0x11, 0x10, 0x00
+{	21, 21,		// width, height
+	0x0F, 0x04,
+	0x0F, 0x04,
+	0x14, 0x00, 0x38, 0x00, 0x14,
+	0x14, 0x00, 0x38, 0x00, 0x14,
+	0x14, 0x00, 0x38, 0x00, 0x14,
+	0x14, 0x00, 0x38, 0x00, 0x14,
+	0x14, 0x00, 0x38, 0x00, 0x14,
+	0x14, 0x00, 0x38, 0x00, 0x14,
+	0x14, 0x0A, 0x14,
+	0x15, 0x00, 0x36, 0x00, 0x15,
+	0x15, 0x00, 0x36, 0x00, 0x15,
+	0x14, 0x0A, 0x14,
+	0x14, 0x00, 0x38, 0x00, 0x14,
+	0x14, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x30, 0x00, 0x14,
+	0x14, 0x0A, 0x14,
+	0x01, 0x16, 0x00, 0x30, 0x00, 0x16, 0x01,
+	0x12, 0x01, 0x13, 0x02, 0x13, 0x01, 0x12,
+	0x15, 0x01, 0x10, 0x00, 0x30, 0x00, 0x10, 0x01, 0x15,
+	0x18, 0x02, 0x18,
+	0x06, 0x11, 0x00, 0x30, 0x00, 0x11, 0x06,
+	0x06, 0x11, 0x02, 0x11, 0x06,
 };
 
-
 extern const uint8_t IconBed[] =
-{   20, 21,   // width, height
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x00, 0x11,
-    0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x00, 0x11, 0x11,
-    0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11,
-    0x00, 0x11, 0x01, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00,
-    0x00, 0x10, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11,
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
-    0x11, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00,
-    0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x00,
-    0x11, 0x00, 0x11, 0x00, 0x11, 0x01, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00,
-    0x11, 0x11, 0x00, 0x00, 0x10, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
-    0x11, 0x00, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
-    0x00, 0x01, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00,
-    0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x01, 0x00, 0x00, 0x11,
-    0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x10, 0x00, 0x11, 0x11, 0x11,
-    0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00
+{	20, 21,		// width, height
+	0x13, 0x01, 0x13, 0x01, 0x13, 0x01, 0x11,
+	0x12, 0x01, 0x13, 0x01, 0x13, 0x01, 0x12,
+	0x11, 0x01, 0x13, 0x01, 0x13, 0x01, 0x13,
+	0x11, 0x01, 0x13, 0x01, 0x13, 0x01, 0x13,
+	0x12, 0x01, 0x13, 0x01, 0x13, 0x01, 0x12,
+	0x13, 0x01, 0x13, 0x01, 0x13, 0x01, 0x11,
+	0x14, 0x01, 0x13, 0x01, 0x13, 0x01, 0x10,
+	0x14, 0x01, 0x13, 0x01, 0x13, 0x01, 0x10,
+	0x13, 0x01, 0x13, 0x01, 0x13, 0x01, 0x11,
+	0x12, 0x01, 0x13, 0x01, 0x13, 0x01, 0x12,
+	0x11, 0x01, 0x13, 0x01, 0x13, 0x01, 0x13,
+	0x11, 0x01, 0x13, 0x01, 0x13, 0x01, 0x13,
+	0x12, 0x01, 0x13, 0x01, 0x13, 0x01, 0x12,
+	0x13, 0x01, 0x13, 0x01, 0x13, 0x01, 0x11,
+	0x14, 0x01, 0x13, 0x01, 0x13, 0x01, 0x10,
+	0x14, 0x01, 0x13, 0x01, 0x13, 0x01, 0x10,
+	0x13, 0x01, 0x13, 0x01, 0x13, 0x01, 0x11,
+	0x1F, 0x13,
+	0x0F, 0x03,
+	0x0F, 0x03,
+	0x0F, 0x03,
 };
 
 extern const uint8_t IconChamber[] =
-{	20, 21,	// width, height
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x11, 
-	0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x00, 0x11, 0x11, 
-	0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x00, 0x11, 0x00, 0x11, 
-	0x00, 0x11, 0x01, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 
-	0x00, 0x10, 0x00, 0x01, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 
-	0x01, 0x10, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 
-	0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x00, 
-	0x11, 0x00, 0x11, 0x00, 0x11, 0x01, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 
-	0x11, 0x11, 0x00, 0x00, 0x10, 0x00, 0x01, 0x11, 0x11, 0x00, 0x11, 0x11, 
-	0x11, 0x00, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-	0x11, 0x10, 0x00, 0x01, 0x10, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 
-	0x00, 0x00, 0x11, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 
-	0x01, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x01, 0x00, 0x00, 0x11, 
-	0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x10, 0x00, 0x01, 0x11, 0x11, 
-	0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+{	20, 21,		// width, height
+	0x0F, 0x03,
+	0x00, 0x1F, 0x11, 0x00,
+	0x00, 0x1F, 0x11, 0x00,
+	0x00, 0x10, 0x01, 0x13, 0x01, 0x13, 0x01, 0x12, 0x00,
+	0x00, 0x11, 0x01, 0x13, 0x01, 0x13, 0x01, 0x11, 0x00,
+	0x00, 0x12, 0x01, 0x13, 0x01, 0x13, 0x01, 0x10, 0x00,
+	0x00, 0x13, 0x01, 0x13, 0x01, 0x13, 0x02,
+	0x00, 0x13, 0x01, 0x13, 0x01, 0x13, 0x02,
+	0x00, 0x12, 0x01, 0x13, 0x01, 0x13, 0x01, 0x10, 0x00,
+	0x00, 0x11, 0x01, 0x13, 0x01, 0x13, 0x01, 0x11, 0x00,
+	0x00, 0x10, 0x01, 0x13, 0x01, 0x13, 0x01, 0x12, 0x00,
+	0x00, 0x10, 0x01, 0x13, 0x01, 0x13, 0x01, 0x12, 0x00,
+	0x00, 0x11, 0x01, 0x13, 0x01, 0x13, 0x01, 0x11, 0x00,
+	0x00, 0x12, 0x01, 0x13, 0x01, 0x13, 0x01, 0x10, 0x00,
+	0x00, 0x13, 0x01, 0x13, 0x01, 0x13, 0x02,
+	0x00, 0x13, 0x01, 0x13, 0x01, 0x13, 0x02,
+	0x00, 0x12, 0x01, 0x13, 0x01, 0x13, 0x01, 0x10, 0x00,
+	0x00, 0x1F, 0x11, 0x00,
+	0x0F, 0x03,
+	0x0F, 0x03,
+	0x0F, 0x03,
 };
 
 #endif
@@ -0,0 +1,97 @@
+/*
+ * UnicodeComposer.hpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Compose an ASCII letter followed by a combining diacritical mark into a single precomposed character,
+ * while a UTF8 string is being received a byte at a time.
+ */
+
+#ifndef SRC_LIBRARY_UNICODECOMPOSER_HPP_
+#define SRC_LIBRARY_UNICODECOMPOSER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include "UnicodeComposition.hpp"
+
+class UnicodeComposer
+{
+public:
+	// Call this before appending the first character of a new string
+	void Reset()
+	{
+		lastBaseChar = 0;
+		pendingMarkLead = false;
+	}
+
+	// Append a character to 's', combining diacritical marks with the preceding letter as we go.
+	// The marks we can combine are encoded as 0xCC followed by one continuation byte, so we hold back the 0xCC until we see what follows it.
+	// A dangling 0xCC at the end of the string is invalid UTF8 and is dropped.
+	// 'S' must provide cat(char), strlen() and Truncate(size_t) like String. Return true if the value was truncated, like String::cat.
+	template<class S> bool Append(S& s, char c)
+	{
+		if (pendingMarkLead)
+		{
+			pendingMarkLead = false;
+			if ((c & 0xC0) == 0x80 && lastBaseChar != 0)
+			{
+				const uint16_t composed = Compose(lastBaseChar, c);
+				if (composed != 0)
+				{
+					// The base character is the last byte of the value and the composed character takes 2 UTF8 bytes.
+					// If there isn't room for both bytes then keep the letter without its mark rather than leave half a character.
+					const char base = lastBaseChar;
+					const size_t len = s.strlen();
+					lastBaseChar = 0;
+					s.Truncate(len - 1);
+					s.cat((char)((composed >> 6) | 0xC0));
+					if (s.cat((char)((composed & 0x3F) | 0x80)))
+					{
+						s.Truncate(len - 1);
+						s.cat(base);
+						return true;
+					}
+					return false;
+				}
+			}
+			s.cat((char)0xCC);
+		}
+
+		if (c == (char)0xCC)
+		{
+			pendingMarkLead = true;
+			return false;
+		}
+
+		const bool truncated = s.cat(c);
+		lastBaseChar = (!truncated && ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'))) ? c : 0;
+		return truncated;
+	}
+
+	// Compose an ASCII letter and a combining diacritical mark in the range U+0300 to U+033F. Return 0 if there is no composed form.
+	static uint16_t Compose(char base, char markContinuationByte)
+	{
+		const uint16_t key = ((uint16_t)(markContinuationByte & 0x3F) << 8) | (uint8_t)base;
+		const size_t numEntries = sizeof(unicodeCompositions)/sizeof(unicodeCompositions[0]);
+		size_t low = 0, high = numEntries;
+		while (low < high)
+		{
+			const size_t mid = (low + high)/2;
+			if (unicodeCompositions[mid].key < key)
+			{
+				low = mid + 1;
+			}
+			else
+			{
+				high = mid;
+			}
+		}
+		return (low < numEntries && unicodeCompositions[low].key == key) ? unicodeCompositions[low].composed : 0;
+	}
+
+private:
+	char lastBaseChar = 0;				// last character of the string if it is a letter that a combining mark can be applied to, else 0
+	bool pendingMarkLead = false;		// true if we held back the first byte of a possible combining mark
+};
+
+#endif /* SRC_LIBRARY_UNICODECOMPOSER_HPP_ */
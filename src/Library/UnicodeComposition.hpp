@@ -0,0 +1,187 @@
+/*
+ * UnicodeComposition.hpp
+ *
+ * Generated by Tools/unicode-compose/gen-compose.py - do not edit.
+ *
+ * Composition of an ASCII letter followed by a combining diacritical mark in the range U+0300 to U+033F
+ * into a precomposed character in the range U+00C0 to U+017F.
+ */
+
+#ifndef SRC_LIBRARY_UNICODECOMPOSITION_HPP_
+#define SRC_LIBRARY_UNICODECOMPOSITION_HPP_
+
+#include <cstdint>
+
+struct UnicodeCompositionEntry
+{
+	uint16_t key;			// low 6 bits of the combining mark in the high byte, base character in the low byte
+	uint16_t composed;
+};
+
+// This table is sorted by key
+constexpr UnicodeCompositionEntry unicodeCompositions[] =
+{
+	{ 0x0041, 0x00C0 },		// LATIN CAPITAL LETTER A WITH GRAVE
+	{ 0x0045, 0x00C8 },		// LATIN CAPITAL LETTER E WITH GRAVE
+	{ 0x0049, 0x00CC },		// LATIN CAPITAL LETTER I WITH GRAVE
+	{ 0x004F, 0x00D2 },		// LATIN CAPITAL LETTER O WITH GRAVE
+	{ 0x0055, 0x00D9 },		// LATIN CAPITAL LETTER U WITH GRAVE
+	{ 0x0061, 0x00E0 },		// LATIN SMALL LETTER A WITH GRAVE
+	{ 0x0065, 0x00E8 },		// LATIN SMALL LETTER E WITH GRAVE
+	{ 0x0069, 0x00EC },		// LATIN SMALL LETTER I WITH GRAVE
+	{ 0x006F, 0x00F2 },		// LATIN SMALL LETTER O WITH GRAVE
+	{ 0x0075, 0x00F9 },		// LATIN SMALL LETTER U WITH GRAVE
+	{ 0x0141, 0x00C1 },		// LATIN CAPITAL LETTER A WITH ACUTE
+	{ 0x0143, 0x0106 },		// LATIN CAPITAL LETTER C WITH ACUTE
+	{ 0x0145, 0x00C9 },		// LATIN CAPITAL LETTER E WITH ACUTE
+	{ 0x0149, 0x00CD },		// LATIN CAPITAL LETTER I WITH ACUTE
+	{ 0x014C, 0x0139 },		// LATIN CAPITAL LETTER L WITH ACUTE
+	{ 0x014E, 0x0143 },		// LATIN CAPITAL LETTER N WITH ACUTE
+	{ 0x014F, 0x00D3 },		// LATIN CAPITAL LETTER O WITH ACUTE
+	{ 0x0152, 0x0154 },		// LATIN CAPITAL LETTER R WITH ACUTE
+	{ 0x0153, 0x015A },		// LATIN CAPITAL LETTER S WITH ACUTE
+	{ 0x0155, 0x00DA },		// LATIN CAPITAL LETTER U WITH ACUTE
+	{ 0x0159, 0x00DD },		// LATIN CAPITAL LETTER Y WITH ACUTE
+	{ 0x015A, 0x0179 },		// LATIN CAPITAL LETTER Z WITH ACUTE
+	{ 0x0161, 0x00E1 },		// LATIN SMALL LETTER A WITH ACUTE
+	{ 0x0163, 0x0107 },		// LATIN SMALL LETTER C WITH ACUTE
+	{ 0x0165, 0x00E9 },		// LATIN SMALL LETTER E WITH ACUTE
+	{ 0x0169, 0x00ED },		// LATIN SMALL LETTER I WITH ACUTE
+	{ 0x016C, 0x013A },		// LATIN SMALL LETTER L WITH ACUTE
+	{ 0x016E, 0x0144 },		// LATIN SMALL LETTER N WITH ACUTE
+	{ 0x016F, 0x00F3 },		// LATIN SMALL LETTER O WITH ACUTE
+	{ 0x0172, 0x0155 },		// LATIN SMALL LETTER R WITH ACUTE
+	{ 0x0173, 0x015B },		// LATIN SMALL LETTER S WITH ACUTE
+	{ 0x0175, 0x00FA },		// LATIN SMALL LETTER U WITH ACUTE
+	{ 0x0179, 0x00FD },		// LATIN SMALL LETTER Y WITH ACUTE
+	{ 0x017A, 0x017A },		// LATIN SMALL LETTER Z WITH ACUTE
+	{ 0x0241, 0x00C2 },		// LATIN CAPITAL LETTER A WITH CIRCUMFLEX
+	{ 0x0243, 0x0108 },		// LATIN CAPITAL LETTER C WITH CIRCUMFLEX
+	{ 0x0245, 0x00CA },		// LATIN CAPITAL LETTER E WITH CIRCUMFLEX
+	{ 0x0247, 0x011C },		// LATIN CAPITAL LETTER G WITH CIRCUMFLEX
+	{ 0x0248, 0x0124 },		// LATIN CAPITAL LETTER H WITH CIRCUMFLEX
+	{ 0x0249, 0x00CE },		// LATIN CAPITAL LETTER I WITH CIRCUMFLEX
+	{ 0x024A, 0x0134 },		// LATIN CAPITAL LETTER J WITH CIRCUMFLEX
+	{ 0x024F, 0x00D4 },		// LATIN CAPITAL LETTER O WITH CIRCUMFLEX
+	{ 0x0253, 0x015C },		// LATIN CAPITAL LETTER S WITH CIRCUMFLEX
+	{ 0x0255, 0x00DB },		// LATIN CAPITAL LETTER U WITH CIRCUMFLEX
+	{ 0x0257, 0x0174 },		// LATIN CAPITAL LETTER W WITH CIRCUMFLEX
+	{ 0x0259, 0x0176 },		// LATIN CAPITAL LETTER Y WITH CIRCUMFLEX
+	{ 0x0261, 0x00E2 },		// LATIN SMALL LETTER A WITH CIRCUMFLEX
+	{ 0x0263, 0x0109 },		// LATIN SMALL LETTER C WITH CIRCUMFLEX
+	{ 0x0265, 0x00EA },		// LATIN SMALL LETTER E WITH CIRCUMFLEX
+	{ 0x0267, 0x011D },		// LATIN SMALL LETTER G WITH CIRCUMFLEX
+	{ 0x0268, 0x0125 },		// LATIN SMALL LETTER H WITH CIRCUMFLEX
+	{ 0x0269, 0x00EE },		// LATIN SMALL LETTER I WITH CIRCUMFLEX
+	{ 0x026A, 0x0135 },		// LATIN SMALL LETTER J WITH CIRCUMFLEX
+	{ 0x026F, 0x00F4 },		// LATIN SMALL LETTER O WITH CIRCUMFLEX
+	{ 0x0273, 0x015D },		// LATIN SMALL LETTER S WITH CIRCUMFLEX
+	{ 0x0275, 0x00FB },		// LATIN SMALL LETTER U WITH CIRCUMFLEX
+	{ 0x0277, 0x0175 },		// LATIN SMALL LETTER W WITH CIRCUMFLEX
+	{ 0x0279, 0x0177 },		// LATIN SMALL LETTER Y WITH CIRCUMFLEX
+	{ 0x0341, 0x00C3 },		// LATIN CAPITAL LETTER A WITH TILDE
+	{ 0x0349, 0x0128 },		// LATIN CAPITAL LETTER I WITH TILDE
+	{ 0x034E, 0x00D1 },		// LATIN CAPITAL LETTER N WITH TILDE
+	{ 0x034F, 0x00D5 },		// LATIN CAPITAL LETTER O WITH TILDE
+	{ 0x0355, 0x0168 },		// LATIN CAPITAL LETTER U WITH TILDE
+	{ 0x0361, 0x00E3 },		// LATIN SMALL LETTER A WITH TILDE
+	{ 0x0369, 0x0129 },		// LATIN SMALL LETTER I WITH TILDE
+	{ 0x036E, 0x00F1 },		// LATIN SMALL LETTER N WITH TILDE
+	{ 0x036F, 0x00F5 },		// LATIN SMALL LETTER O WITH TILDE
+	{ 0x0375, 0x0169 },		// LATIN SMALL LETTER U WITH TILDE
+	{ 0x0441, 0x0100 },		// LATIN CAPITAL LETTER A WITH MACRON
+	{ 0x0445, 0x0112 },		// LATIN CAPITAL LETTER E WITH MACRON
+	{ 0x0449, 0x012A },		// LATIN CAPITAL LETTER I WITH MACRON
+	{ 0x044F, 0x014C },		// LATIN CAPITAL LETTER O WITH MACRON
+	{ 0x0455, 0x016A },		// LATIN CAPITAL LETTER U WITH MACRON
+	{ 0x0461, 0x0101 },		// LATIN SMALL LETTER A WITH MACRON
+	{ 0x0465, 0x0113 },		// LATIN SMALL LETTER E WITH MACRON
+	{ 0x0469, 0x012B },		// LATIN SMALL LETTER I WITH MACRON
+	{ 0x046F, 0x014D },		// LATIN SMALL LETTER O WITH MACRON
+	{ 0x0475, 0x016B },		// LATIN SMALL LETTER U WITH MACRON
+	{ 0x0641, 0x0102 },		// LATIN CAPITAL LETTER A WITH BREVE
+	{ 0x0645, 0x0114 },		// LATIN CAPITAL LETTER E WITH BREVE
+	{ 0x0647, 0x011E },		// LATIN CAPITAL LETTER G WITH BREVE
+	{ 0x0649, 0x012C },		// LATIN CAPITAL LETTER I WITH BREVE
+	{ 0x064F, 0x014E },		// LATIN CAPITAL LETTER O WITH BREVE
+	{ 0x0655, 0x016C },		// LATIN CAPITAL LETTER U WITH BREVE
+	{ 0x0661, 0x0103 },		// LATIN SMALL LETTER A WITH BREVE
+	{ 0x0665, 0x0115 },		// LATIN SMALL LETTER E WITH BREVE
+	{ 0x0667, 0x011F },		// LATIN SMALL LETTER G WITH BREVE
+	{ 0x0669, 0x012D },		// LATIN SMALL LETTER I WITH BREVE
+	{ 0x066F, 0x014F },		// LATIN SMALL LETTER O WITH BREVE
+	{ 0x0675, 0x016D },		// LATIN SMALL LETTER U WITH BREVE
+	{ 0x0743, 0x010A },		// LATIN CAPITAL LETTER C WITH DOT ABOVE
+	{ 0x0745, 0x0116 },		// LATIN CAPITAL LETTER E WITH DOT ABOVE
+	{ 0x0747, 0x0120 },		// LATIN CAPITAL LETTER G WITH DOT ABOVE
+	{ 0x0749, 0x0130 },		// LATIN CAPITAL LETTER I WITH DOT ABOVE
+	{ 0x075A, 0x017B },		// LATIN CAPITAL LETTER Z WITH DOT ABOVE
+	{ 0x0763, 0x010B },		// LATIN SMALL LETTER C WITH DOT ABOVE
+	{ 0x0765, 0x0117 },		// LATIN SMALL LETTER E WITH DOT ABOVE
+	{ 0x0767, 0x0121 },		// LATIN SMALL LETTER G WITH DOT ABOVE
+	{ 0x077A, 0x017C },		// LATIN SMALL LETTER Z WITH DOT ABOVE
+	{ 0x0841, 0x00C4 },		// LATIN CAPITAL LETTER A WITH DIAERESIS
+	{ 0x0845, 0x00CB },		// LATIN CAPITAL LETTER E WITH DIAERESIS
+	{ 0x0849, 0x00CF },		// LATIN CAPITAL LETTER I WITH DIAERESIS
+	{ 0x084F, 0x00D6 },		// LATIN CAPITAL LETTER O WITH DIAERESIS
+	{ 0x0855, 0x00DC },		// LATIN CAPITAL LETTER U WITH DIAERESIS
+	{ 0x0859, 0x0178 },		// LATIN CAPITAL LETTER Y WITH DIAERESIS
+	{ 0x0861, 0x00E4 },		// LATIN SMALL LETTER A WITH DIAERESIS
+	{ 0x0865, 0x00EB },		// LATIN SMALL LETTER E WITH DIAERESIS
+	{ 0x0869, 0x00EF },		// LATIN SMALL LETTER I WITH DIAERESIS
+	{ 0x086F, 0x00F6 },		// LATIN SMALL LETTER O WITH DIAERESIS
+	{ 0x0875, 0x00FC },		// LATIN SMALL LETTER U WITH DIAERESIS
+	{ 0x0879, 0x00FF },		// LATIN SMALL LETTER Y WITH DIAERESIS
+	{ 0x0A41, 0x00C5 },		// LATIN CAPITAL LETTER A WITH RING ABOVE
+	{ 0x0A55, 0x016E },		// LATIN CAPITAL LETTER U WITH RING ABOVE
+	{ 0x0A61, 0x00E5 },		// LATIN SMALL LETTER A WITH RING ABOVE
+	{ 0x0A75, 0x016F },		// LATIN SMALL LETTER U WITH RING ABOVE
+	{ 0x0B4F, 0x0150 },		// LATIN CAPITAL LETTER O WITH DOUBLE ACUTE
+	{ 0x0B55, 0x0170 },		// LATIN CAPITAL LETTER U WITH DOUBLE ACUTE
+	{ 0x0B6F, 0x0151 },		// LATIN SMALL LETTER O WITH DOUBLE ACUTE
+	{ 0x0B75, 0x0171 },		// LATIN SMALL LETTER U WITH DOUBLE ACUTE
+	{ 0x0C43, 0x010C },		// LATIN CAPITAL LETTER C WITH CARON
+	{ 0x0C44, 0x010E },		// LATIN CAPITAL LETTER D WITH CARON
+	{ 0x0C45, 0x011A },		// LATIN CAPITAL LETTER E WITH CARON
+	{ 0x0C4C, 0x013D },		// LATIN CAPITAL LETTER L WITH CARON
+	{ 0x0C4E, 0x0147 },		// LATIN CAPITAL LETTER N WITH CARON
+	{ 0x0C52, 0x0158 },		// LATIN CAPITAL LETTER R WITH CARON
+	{ 0x0C53, 0x0160 },		// LATIN CAPITAL LETTER S WITH CARON
+	{ 0x0C54, 0x0164 },		// LATIN CAPITAL LETTER T WITH CARON
+	{ 0x0C5A, 0x017D },		// LATIN CAPITAL LETTER Z WITH CARON
+	{ 0x0C63, 0x010D },		// LATIN SMALL LETTER C WITH CARON
+	{ 0x0C64, 0x010F },		// LATIN SMALL LETTER D WITH CARON
+	{ 0x0C65, 0x011B },		// LATIN SMALL LETTER E WITH CARON
+	{ 0x0C6C, 0x013E },		// LATIN SMALL LETTER L WITH CARON
+	{ 0x0C6E, 0x0148 },		// LATIN SMALL LETTER N WITH CARON
+	{ 0x0C72, 0x0159 },		// LATIN SMALL LETTER R WITH CARON
+	{ 0x0C73, 0x0161 },		// LATIN SMALL LETTER S WITH CARON
+	{ 0x0C74, 0x0165 },		// LATIN SMALL LETTER T WITH CARON
+	{ 0x0C7A, 0x017E },		// LATIN SMALL LETTER Z WITH CARON
+	{ 0x2743, 0x00C7 },		// LATIN CAPITAL LETTER C WITH CEDILLA
+	{ 0x2747, 0x0122 },		// LATIN CAPITAL LETTER G WITH CEDILLA
+	{ 0x274B, 0x0136 },		// LATIN CAPITAL LETTER K WITH CEDILLA
+	{ 0x274C, 0x013B },		// LATIN CAPITAL LETTER L WITH CEDILLA
+	{ 0x274E, 0x0145 },		// LATIN CAPITAL LETTER N WITH CEDILLA
+	{ 0x2752, 0x0156 },		// LATIN CAPITAL LETTER R WITH CEDILLA
+	{ 0x2753, 0x015E },		// LATIN CAPITAL LETTER S WITH CEDILLA
+	{ 0x2754, 0x0162 },		// LATIN CAPITAL LETTER T WITH CEDILLA
+	{ 0x2763, 0x00E7 },		// LATIN SMALL LETTER C WITH CEDILLA
+	{ 0x2767, 0x0123 },		// LATIN SMALL LETTER G WITH CEDILLA
+	{ 0x276B, 0x0137 },		// LATIN SMALL LETTER K WITH CEDILLA
+	{ 0x276C, 0x013C },		// LATIN SMALL LETTER L WITH CEDILLA
+	{ 0x276E, 0x0146 },		// LATIN SMALL LETTER N WITH CEDILLA
+	{ 0x2772, 0x0157 },		// LATIN SMALL LETTER R WITH CEDILLA
+	{ 0x2773, 0x015F },		// LATIN SMALL LETTER S WITH CEDILLA
+	{ 0x2774, 0x0163 },		// LATIN SMALL LETTER T WITH CEDILLA
+	{ 0x2841, 0x0104 },		// LATIN CAPITAL LETTER A WITH OGONEK
+	{ 0x2845, 0x0118 },		// LATIN CAPITAL LETTER E WITH OGONEK
+	{ 0x2849, 0x012E },		// LATIN CAPITAL LETTER I WITH OGONEK
+	{ 0x2855, 0x0172 },		// LATIN CAPITAL LETTER U WITH OGONEK
+	{ 0x2861, 0x0105 },		// LATIN SMALL LETTER A WITH OGONEK
+	{ 0x2865, 0x0119 },		// LATIN SMALL LETTER E WITH OGONEK
+	{ 0x2869, 0x012F },		// LATIN SMALL LETTER I WITH OGONEK
+	{ 0x2875, 0x0173 },		// LATIN SMALL LETTER U WITH OGONEK
+};
+
+#endif /* SRC_LIBRARY_UNICODECOMPOSITION_HPP_ */
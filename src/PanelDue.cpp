@@ -37,6 +37,9 @@
 #include <ObjectModel/Axis.hpp>
 #include <ObjectModel/PrinterStatus.hpp>
 #include "ControlCommands.hpp"
+#include "RequestStats.hpp"
+#include "Subscription.hpp"
+#include <UI/RenderStats.hpp>
 #include "Library/Thumbnail.hpp"
 
 extern uint16_t _esplash[];							// defined in linker script
@@ -57,10 +60,14 @@ extern uint16_t _esplash[];							// defined in linker script
 #endif
 
 // Controlling constants
-constexpr uint32_t defaultPrinterPollInterval = 500;	// poll interval in milliseconds
 constexpr uint32_t printerResponseTimeout = 2000;	// shortest time after a response that we send another poll (gives printer time to catch up)
 
-constexpr uint32_t slowPrinterPollInterval = 4000;		// poll interval in milliseconds when screensaver active
+// Limits of the tuning parameters that the host can set using control commands
+constexpr uint32_t minPrinterPollInterval = 100;
+constexpr uint32_t maxPrinterPollInterval = 60000;
+constexpr uint32_t maxLineQuietTime = 2000;
+constexpr uint32_t minFrameRate = 1;
+constexpr uint32_t maxFrameRate = 100;
 
 const uint32_t touchBeepLength = 20;				// beep length in ms
 const uint32_t touchBeepFrequency = 4500;			// beep frequency in Hz. Resonant frequency of the piezo sounder is 4.5kHz.
@@ -126,6 +133,11 @@ Backlight *backlight = nullptr;
 
 static uint32_t lastTouchTime;
 
+// Display frame pacing
+static uint32_t frameInterval = 1000/DefaultFrameRate;		// the shortest time in milliseconds between refreshes of the display by the main loop
+static uint32_t lastFrameTime = 0;
+static bool receivingResponse = false;						// true while a response from the printer is only partly processed
+
 static uint32_t lastPollTime = 0;
 static uint32_t lastResponseTime = 0;
 static uint32_t lastOutOfBufferResponse = 0;
@@ -155,7 +167,7 @@ static int8_t lastTool = -1;
 static uint32_t remoteUpTime = 0;
 static bool initialized = false;
 static float pollIntervalMultiplier = 1.0;
-static uint32_t printerPollInterval = defaultPrinterPollInterval;
+static uint32_t printerPollInterval = DefaultPrinterPollInterval;
 
 static struct ThumbnailData thumbnailData;
 
@@ -209,6 +221,7 @@ enum ReceivedDataEvent
 	rcvPushSeq,
 	rcvPushBeepDuration,
 	rcvPushBeepFrequency,
+	rcvPushSubscribed,
 
 	// Keys for M20 response
 	rcvM20Dir,
@@ -377,6 +390,7 @@ static FieldTableEntry fieldTable[] =
 {
 	// M409 common fields
 	{ rcvKey, 							"key" },
+	{ rcvFlags, 						"flags" },
 
 	// M409 K"boards" response
 	{ rcvBoardsFirmwareName, 			"boards^:firmwareName" },
@@ -513,6 +527,7 @@ static FieldTableEntry fieldTable[] =
 	{ rcvPushSeq,						"seq" },
 	{ rcvPushBeepDuration,				"beep_length" },
 	{ rcvPushBeepFrequency,				"beep_freq" },
+	{ rcvPushSubscribed,				"subscribed" },
 
 	// Control Command message
 	{ rcvControlCommand,				"controlCommand" },
@@ -580,6 +595,11 @@ static struct Seq {
 static struct Seq *currentReqSeq = nullptr;
 static struct Seq *currentRespSeq = nullptr;
 
+// Latency statistics slots for the requests that are not object model keys. The seqs use the slots matching their index.
+static size_t statusStatsSlot;
+static size_t thumbnailStatsSlot;
+static size_t filesStatsSlot;
+
 static struct Seq* GetNextSeq(struct Seq *current)
 {
 	if (current == nullptr)
@@ -648,6 +668,14 @@ static void ResetSeqs()
 	}
 }
 
+// Return how long we wait for any message from the host before we assume the connection has been lost
+static uint32_t ConnectionTimeout()
+{
+	return (Subscription::IsActive())
+			? 3 * Subscription::GetHeartbeatInterval()
+			: 3 * (printerPollInterval + printerResponseTimeout);
+}
+
 // Return the host firmware features
 FirmwareFeatureMap GetFirmwareFeatures()
 {
@@ -715,11 +743,11 @@ static void UpdatePollRate(bool idle)
 {
 	if (idle)
 	{
-		printerPollInterval = slowPrinterPollInterval;
+		printerPollInterval = nvData.GetSlowPollInterval();
 	}
 	else
 	{
-		printerPollInterval = defaultPrinterPollInterval * pollIntervalMultiplier;
+		printerPollInterval = nvData.GetPollInterval() * pollIntervalMultiplier;
 	}
 }
 
@@ -730,6 +758,7 @@ static void InitLcd()
 	colours = &colourSchemes[nvData.colourScheme];
 	UI::InitColourScheme(colours);
 	UI::CreateFields(nvData.language, *colours, nvData.infoTimeout);	// create all the fields
+	lcd.allocateBand(DisplayBandLines, MinFreeMemoryAfterBand);			// use band rendering for full redraws if this build supports it and there is room
 	lcd.fillScr(black);													// make sure the memory is clear
 	Delay(100);															// give the LCD time to update
 	backlight->SetState(BacklightStateNormal);
@@ -917,6 +946,26 @@ void SaveSettings()
 	savedNvData.Load();
 }
 
+// Apply a new language or colour scheme by creating the fields again, then fetch the object model again to fill them in.
+// Unlike a software reset this keeps the connection to the host and doesn't show the splash screen.
+void RecreateUserInterface()
+{
+	colours = &colourSchemes[nvData.colourScheme];
+	UI::InitColourScheme(colours);
+	if (!UI::RecreateFields(nvData.language, *colours, nvData.infoTimeout))
+	{
+		Reset();										// there wasn't room to create the fields again, so start again with the new settings
+	}
+	debugField->Show(false);
+	MessageLog::UpdateMessages(true);
+
+	initialized = false;
+	lastPollTime = 0;
+	ResetSeqs();
+	Subscription::Reset();
+	mgr.Refresh(true);
+}
+
 // This is called when the status changes
 static void SetStatus(OM::PrinterStatus newStatus)
 {
@@ -942,9 +991,11 @@ static void Reconnect()
 	lastResponseTime = SystemTick::GetTickCount();
 
 	lastOutOfBufferResponse = 0;
+	RequestStats::RequestTimedOut();
 
 	SetStatus(OM::PrinterStatus::connecting);
 	ResetSeqs();
+	Subscription::Reset();
 
 	UI::LastJobFileNameAvailable(false);
 	UI::SetSimulatedTime(0);
@@ -1015,6 +1066,8 @@ static struct SerialIo::SerialIoCbs serial_cbs = {
 
 static void StartReceivedMessage()
 {
+	receivingResponse = true;
+	Subscription::StartReceivedMessage();
 	newMessageSeq = messageSeq;
 	MessageLog::BeginNewMessage();
 	FileManager::BeginNewMessage();
@@ -1031,7 +1084,9 @@ static void StartReceivedMessage()
 
 static void EndReceivedMessage()
 {
+	receivingResponse = false;
 	lastResponseTime = SystemTick::GetTickCount();
+	RequestStats::ResponseComplete();
 
 	if (currentRespSeq != nullptr)
 	{
@@ -1040,6 +1095,7 @@ static void EndReceivedMessage()
 		currentRespSeq = nullptr;
 	}
 	outOfBuffers = false;							// Reset the out-of-buffers flag
+	Subscription::EndReceivedMessage();
 
 	if (newMessageSeq != messageSeq)
 	{
@@ -1138,6 +1194,195 @@ void HandleOutOfBufferResponse()
 	outOfBuffers = true;
 }
 
+// Return true if the baud rate is one that the baud rate popup offers. Any other rate would be saved and might leave us unable to talk to the host after a reset.
+static bool IsOfferedBaudRate(uint32_t rate)
+{
+	for (int offered : BaudRates)
+	{
+		if ((uint32_t)offered == rate)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// Process a tuning control command such as "pollInterval 750". If a valid value is given then apply it.
+// In all cases report the current value back to the host. The new values are not saved unless the host also sends saveSettings.
+static void ProcessTuningCommand(ControlCommand command, const char * _ecv_array name, const char * _ecv_array null arg)
+{
+	uint32_t val;
+	const bool haveValue = arg != nullptr && GetUnsignedInteger(arg, val);
+
+	switch (command)
+	{
+	case ControlCommand::baudRate:
+		if (haveValue && IsOfferedBaudRate(val) && val != nvData.GetBaudRate())
+		{
+			// Reply at the old baud rate. SerialIo changes the rate once the reply has been sent and this message has ended,
+			// and the host has to switch too before it can hear us again.
+			SerialIo::Sendf("M118 P2 S\"%s %lu\"\n", name, val);
+			SetBaudRate(val);
+			UI::UpdateCommsSettings();
+			return;
+		}
+		val = nvData.GetBaudRate();
+		break;
+
+	case ControlCommand::frameRate:
+		if (haveValue && val >= minFrameRate && val <= maxFrameRate)
+		{
+			nvData.SetFrameRate(val);
+			frameInterval = 1000/val;
+		}
+		val = nvData.GetFrameRate();
+		break;
+
+	case ControlCommand::lineQuietTime:
+		if (haveValue && val <= maxLineQuietTime)
+		{
+			nvData.SetLineQuietTime(val);
+			SerialIo::SetLineQuietTime(val);
+		}
+		val = nvData.GetLineQuietTime();
+		break;
+
+	case ControlCommand::logLevel:
+		if (haveValue && val < (uint32_t)MessageLog::LogLevel::NumTypes)
+		{
+			nvData.SetLogLevel((MessageLog::LogLevel)val);
+			MessageLog::LogLevelSet((MessageLog::LogLevel)val);
+			UI::UpdateCommsSettings();
+		}
+		val = (uint32_t)nvData.GetLogLevel();
+		break;
+
+	case ControlCommand::pollInterval:
+		if (haveValue && val >= minPrinterPollInterval && val <= maxPrinterPollInterval)
+		{
+			nvData.SetPollInterval(val);
+			pollIntervalMultiplier = 1.0;			// the host knows best
+			UpdatePollRate(screensaverActive);
+		}
+		val = nvData.GetPollInterval();
+		break;
+
+	case ControlCommand::pushUpdates:
+		if (haveValue && val <= 1)
+		{
+			nvData.SetPushUpdates(val != 0);
+			Subscription::SetEnabled(val != 0);
+		}
+		val = nvData.GetPushUpdates();
+		break;
+
+	case ControlCommand::slowPollInterval:
+		if (haveValue && val >= minPrinterPollInterval && val <= maxPrinterPollInterval)
+		{
+			nvData.SetSlowPollInterval(val);
+			UpdatePollRate(screensaverActive);
+		}
+		val = nvData.GetSlowPollInterval();
+		break;
+
+	default:
+		return;
+	}
+
+	SerialIo::Sendf("M118 P2 S\"%s %lu\"\n", name, val);
+}
+
+static void ReportDisplayRate(const char * _ecv_array what, uint32_t pixels, uint32_t ms)
+{
+	const uint32_t hundredths = pixels / (((ms == 0) ? 1 : ms) * 10);		// in units of 10k pixels per second
+	MessageLog::AppendMessageF(MessageLog::LogLevel::Normal, "Display %s: %lu.%02lu Mpixel/s", what, hundredths / 100, hundredths % 100);
+}
+
+static uint32_t CharsPerSecond(uint32_t chars, uint32_t ms)
+{
+	return (chars * 1000)/((ms == 0) ? 1 : ms);
+}
+
+// Measure how fast we can fill the screen, blit bitmaps to it and draw and measure text in the default font, and how long a full redraw
+// of the current page takes both drawing directly and in bands if supported. Report the results in the message log and redraw the screen.
+static void RunDisplayBenchmark()
+{
+	constexpr unsigned int NumFills = 8;
+	constexpr int TileSize = 16;
+	constexpr unsigned int NumMeasures = 50;
+	const char * const sampleText = "Bed 60.0/60.0C X123.45 Y67.89";
+
+	uint16_t tile[TileSize * TileSize];
+	for (size_t i = 0; i < ARRAY_SIZE(tile); ++i)
+	{
+		tile[i] = UTFT::fromRGB(i, i * 2, 255 - i);
+	}
+
+	uint32_t start = SystemTick::GetTickCount();
+	for (unsigned int i = 0; i < NumFills; ++i)
+	{
+		lcd.fillScr((i & 1) ? white : black);
+	}
+	const uint32_t fillTime = SystemTick::GetTickCount() - start;
+
+	uint32_t blitPixels = 0;
+	start = SystemTick::GetTickCount();
+	for (int y = 0; y + TileSize <= DisplayY; y += TileSize)
+	{
+		for (int x = 0; x + TileSize <= DisplayX; x += TileSize)
+		{
+			lcd.drawBitmap16(x, y, TileSize, TileSize, tile, 1, false);
+			blitPixels += TileSize * TileSize;
+		}
+	}
+	const uint32_t blitTime = SystemTick::GetTickCount() - start;
+
+	ReportDisplayRate("fill", NumFills * (uint32_t)DisplayX * (uint32_t)DisplayY, fillTime);
+	ReportDisplayRate("blit", blitPixels, blitTime);
+
+	// Measuring text decodes every character, whereas drawing it mostly uses the glyph cache
+	const uint32_t sampleLength = strlen(sampleText);
+	uint32_t textChars = 0;
+	lcd.setFont(DEFAULT_FONT);
+	lcd.setColor(white);
+	lcd.setBackColor(black);
+	lcd.setTransparentBackground(false);
+	start = SystemTick::GetTickCount();
+	for (PixelNumber y = 0; y + lcd.getFontHeight() <= DisplayY; y += lcd.getFontHeight())
+	{
+		lcd.setTextPos(0, y, DisplayX);
+		lcd.printf("%s", sampleText);
+		textChars += sampleLength;
+	}
+	const uint32_t drawTime = SystemTick::GetTickCount() - start;
+	start = SystemTick::GetTickCount();
+	for (unsigned int i = 0; i < NumMeasures; ++i)
+	{
+		(void)lcd.measureText(sampleText, DisplayX);
+	}
+	const uint32_t measureTime = SystemTick::GetTickCount() - start;
+	MessageLog::AppendMessageF(MessageLog::LogLevel::Normal, "Display text (%s font): draw %lu, measure %lu chars/s",
+			(lcd.getFontFormat() != FontFormatBitmap) ? "packed" : "bitmap",
+			CharsPerSecond(textChars, drawTime), CharsPerSecond(NumMeasures * sampleLength, measureTime));
+
+	mgr.SetBandRendering(false);
+	start = SystemTick::GetTickCount();
+	mgr.Refresh(true);
+	const uint32_t directTime = SystemTick::GetTickCount() - start;
+	mgr.SetBandRendering(true);
+	if (lcd.getBandLines() != 0)
+	{
+		start = SystemTick::GetTickCount();
+		mgr.Refresh(true);
+		const uint32_t bandTime = SystemTick::GetTickCount() - start;
+		MessageLog::AppendMessageF(MessageLog::LogLevel::Normal, "Page redraw: direct %lums, %u-line bands %lums", directTime, lcd.getBandLines(), bandTime);
+	}
+	else
+	{
+		MessageLog::AppendMessageF(MessageLog::LogLevel::Normal, "Page redraw: direct %lums", directTime);
+	}
+}
+
 // Public functions called by the SerialIo module
 static void ProcessReceivedValue(StringRef id, const char data[], const size_t indices[])
 {
@@ -1183,6 +1428,10 @@ static void ProcessReceivedValue(StringRef id, const char data[], const size_t i
 	switch (rde)
 	{
 	// M409 section
+	case rcvFlags:
+		Subscription::ProcessFlags(data);
+		break;
+
 	case rcvKey:
 		{
 			// try a quick check otherwise search for key
@@ -1936,6 +2185,16 @@ static void ProcessReceivedValue(StringRef id, const char data[], const size_t i
 		GetInteger(data, beepFrequency);
 		break;
 
+	case rcvPushSubscribed:
+		{
+			uint32_t heartbeatInterval;
+			if (GetUnsignedInteger(data, heartbeatInterval))
+			{
+				Subscription::ProcessSubscribed(heartbeatInterval);
+			}
+		}
+		break;
+
 	// M20 section
 	case rcvM20Dir:
 		FileManager::ReceiveDirectoryName(data);
@@ -2121,7 +2380,20 @@ static void ProcessReceivedValue(StringRef id, const char data[], const size_t i
 
 	case rcvControlCommand:
 		{
-			const ControlCommandMapEntry key = (ControlCommandMapEntry) {data, ControlCommand::invalid};
+			// Some commands take a value separated from the command by a space
+			String<MaxControlCommandLength> commandName;
+			commandName.copy(data);
+			const char * _ecv_array null arg = strchr(data, ' ');
+			if (arg != nullptr)
+			{
+				commandName.Truncate(arg - data);
+				while (*arg == ' ')
+				{
+					++arg;
+				}
+			}
+
+			const ControlCommandMapEntry key = (ControlCommandMapEntry) {commandName.c_str(), ControlCommand::invalid};
 			const ControlCommandMapEntry * controlCommandFromMap =
 					(ControlCommandMapEntry *) bsearch(
 							&key,
@@ -2136,9 +2408,66 @@ static void ProcessReceivedValue(StringRef id, const char data[], const size_t i
 				UI::ShowFirmwareUpdatePopup();
 				EraseAndReset();					// Does not return
 				break;
+			case ControlCommand::latencyExport:
+				RequestStats::StartExport();
+				break;
+			case ControlCommand::latencyReset:
+				RequestStats::Reset();
+				break;
+			case ControlCommand::latencyShow:
+				RequestStats::ShowSummary();
+				break;
+			case ControlCommand::busStats:
+#if UTFT_BUS_STATS
+				{
+					// Report the display bus activity since the last time we were asked, then start counting again
+					const UTFT::BusStats& stats = lcd.getBusStats();
+					MessageLog::AppendMessageF(MessageLog::LogLevel::Normal, "Display bus: %lu windows, %lu commands, %lu pixels, %lu writes",
+						stats.windows, stats.commands, stats.pixels, stats.writes);
+					lcd.resetBusStats();
+				}
+#else
+				MessageLog::AppendMessage(MessageLog::LogLevel::Normal, "Display bus statistics not enabled");
+#endif
+				break;
+			case ControlCommand::displayBenchmark:
+				RunDisplayBenchmark();
+				break;
+			case ControlCommand::glyphCacheStats:
+				{
+					// Report the glyph cache hit rate since the last time we were asked, then start counting again
+					const GlyphCache& cache = lcd.getGlyphCache();
+					const uint32_t lookups = cache.GetHits() + cache.GetMisses();
+					MessageLog::AppendMessageF(MessageLog::LogLevel::Normal, "Glyph cache: %lu hits, %lu misses (%lu%%), %u of %u bytes used",
+						cache.GetHits(), cache.GetMisses(), (lookups == 0) ? 0 : (cache.GetHits() * 100)/lookups,
+						cache.GetBytesUsed(), GlyphCache::GetCapacity());
+					lcd.resetGlyphCacheStats();
+				}
+				break;
+			case ControlCommand::renderReset:
+				RenderStats::Reset();
+				break;
+			case ControlCommand::renderShow:
+				RenderStats::ShowSummary();
+				break;
 			case ControlCommand::reset:
 				Reset();							// Does not return
 				break;
+			case ControlCommand::saveSettings:
+				if (nvData.IsSaveNeeded())
+				{
+					SaveSettings();
+				}
+				break;
+			case ControlCommand::baudRate:
+			case ControlCommand::frameRate:
+			case ControlCommand::lineQuietTime:
+			case ControlCommand::logLevel:
+			case ControlCommand::pollInterval:
+			case ControlCommand::pushUpdates:
+			case ControlCommand::slowPollInterval:
+				ProcessTuningCommand(controlCommand, controlCommandFromMap->key, arg);
+				break;
 			default:
 				// Invalid command. Just ignore.
 				break;
@@ -2251,6 +2580,7 @@ static void ProcessArrayEnd(const char id[], const size_t indices[])
 static void ParserErrorEncountered(int currentState, const char*, int errors)
 {
 	(void)currentState;
+	receivingResponse = false;
 
 	if (errors > parserMinErrors)
 	{
@@ -2268,6 +2598,7 @@ static void ParserErrorEncountered(int currentState, const char*, int errors)
 void UpdateDebugInfo()
 {
 	freeMem->SetValue(GetFreeMemory());
+	slowestRefresh->SetValue(RenderStats::GetWorstFrameMillis());
 }
 
 #if 0
@@ -2362,6 +2693,20 @@ int main(void)
 		nvData.SetDefaults();
 	}
 	SerialIo::Init(nvData.GetBaudRate(), &serial_cbs);
+	SerialIo::SetLineQuietTime(nvData.GetLineQuietTime());
+	frameInterval = 1000/nvData.GetFrameRate();
+	Subscription::SetEnabled(nvData.GetPushUpdates());
+
+	RequestStats::Init(ARRAY_SIZE(seqs) + 3);
+	for (size_t i = 0; i < ARRAY_SIZE(seqs); ++i)
+	{
+		RequestStats::Register(seqs[i].key);
+	}
+	statusStatsSlot = RequestStats::Register("status");
+	thumbnailStatsSlot = RequestStats::Register("thumbnail");
+	filesStatsSlot = RequestStats::Register("files");
+
+	RenderStats::Init();
 
 	lastTouchTime = SystemTick::GetTickCount();
 
@@ -2426,13 +2771,28 @@ int main(void)
 	UpdatePollRate(false);
 
 	MessageLog::Init();
+#if UTFT_BAND_RENDERING
+	if (lcd.getBandLines() == 0)
+	{
+		MessageLog::AppendMessageF(MessageLog::LogLevel::Normal, "Warning: not enough memory for band rendering, %lu bytes free.", GetFreeMemory());
+	}
+#endif
 
-	// Display the splash screen if one has been appended to the file, unless it was a software reset (we use software reset to change the language or colour scheme)
-	// The splash screen data comprises the number of X pixels, then the number of Y pixels, then the data
-	if (rstc_get_reset_cause(RSTC) != RSTC_SOFTWARE_RESET && _esplash[0] == DISPLAY_X && _esplash[1] == DISPLAY_Y)
+	// Display the splash screen if one has been appended to the file, unless it was a software reset (e.g. after the UI couldn't be recreated in place)
+	// The splash screen is either a QOI image, or in the older format the number of X pixels, then the number of Y pixels, then run-length encoded data
+	const uint8_t * const splash = reinterpret_cast<const uint8_t*>(_esplash);
+	const bool isQoiSplash = UTFT::isQoiBitmap(splash, DISPLAY_X, DISPLAY_Y);
+	if (rstc_get_reset_cause(RSTC) != RSTC_SOFTWARE_RESET && (isQoiSplash || (_esplash[0] == DISPLAY_X && _esplash[1] == DISPLAY_Y)))
 	{
-		lcd.fillScr(black);
-		lcd.drawCompressedBitmapBottomToTop(0, 0, DISPLAY_X, DISPLAY_Y, _esplash + 2);
+		if (isQoiSplash)
+		{
+			lcd.drawQoiBitmap(0, 0, DISPLAY_X, DISPLAY_Y, splash);
+		}
+		else
+		{
+			lcd.fillScr(black);
+			lcd.drawCompressedBitmapBottomToTop(0, 0, DISPLAY_X, DISPLAY_Y, _esplash + 2);
+		}
 		const uint32_t now = SystemTick::GetTickCount();
 		do
 		{
@@ -2619,9 +2979,21 @@ int main(void)
 			}
 		}
 
-		// refresh the display
-		UpdateDebugInfo();
-		mgr.Refresh(false);
+		// Refresh the display. Changes are gathered up into frames so that a field that changes several times is only redrawn once:
+		// we don't redraw more often than the frame rate allows, or while a response from the printer is still arriving,
+		// unless the screen has just been touched or a new page is being drawn.
+		const uint32_t sinceLastFrame = now - lastFrameTime;
+		if (   touched
+			|| mgr.IsRefreshing()
+			|| (sinceLastFrame >= frameInterval && (!receivingResponse || sinceLastFrame >= MaxFrameDeferral))
+		   )
+		{
+			lastFrameTime = now;
+			UpdateDebugInfo();
+			RenderStats::BeginFrame();
+			mgr.Refresh(false);
+			RenderStats::EndFrame();
+		}
 
 		// beep handling
 		if (beepFrequency != 0 && beepLength != 0)
@@ -2655,23 +3027,34 @@ int main(void)
 		if (!UI::IsSetupTab())
 		{
 
-			if (now > lastResponseTime + 3 * (printerPollInterval + printerResponseTimeout))
+			const bool requestDue =    lastResponseTime >= lastPollTime
+									&& (  now > lastPollTime + printerPollInterval
+										|| !initialized
+										|| thumbnailCurrent.state == ThumbnailState::DataRequest
+									   );
+			if (requestDue && !Subscription::IsActive())
+			{
+				RequestStats::RequestDue(now);
+			}
+
+			if (now > lastResponseTime + ConnectionTimeout())
 			{
 				Reconnect();
 			}
-			else if (	lastResponseTime >= lastPollTime
-					 && SerialIo::SerialLineQuiet()
-					 && (  now > lastPollTime + printerPollInterval
-						 || !initialized
-						 || thumbnailCurrent.state == ThumbnailState::DataRequest
-						)
-					)
+			else if (requestDue && SerialIo::SerialLineQuiet())
 			{
-				if (thumbnailCurrent.state == ThumbnailState::DataRequest)
+				if (RequestStats::ExportNext(now))
 				{
+					// Latency statistics are exported one line at a time in place of a poll, and the host's reply counts as the response
+					lastPollTime = SystemTick::GetTickCount();
+				}
+				else if (thumbnailCurrent.state == ThumbnailState::DataRequest)
+				{
+					RequestStats::StartSend(thumbnailStatsSlot);
 					SerialIo::Sendf("M36.1 P\"%s\" S%d\n",
 						filenameCurrent.c_str(),
 						thumbnailCurrent.next);
+					RequestStats::EndSend();
 					lastPollTime = SystemTick::GetTickCount();
 					thumbnailCurrent.state = ThumbnailState::DataWait;
 				}
@@ -2681,7 +3064,9 @@ int main(void)
 					if (currentReqSeq != nullptr)
 					{
 						dbg("requesting %s\n", currentReqSeq->key);
+						RequestStats::StartSend(currentReqSeq - seqs);
 						SerialIo::Sendf("M409 K\"%s\" F\"%s\"\n", currentReqSeq->key, currentReqSeq->flags);
+						RequestStats::EndSend();
 						lastPollTime = SystemTick::GetTickCount();
 					}
 					else
@@ -2698,22 +3083,35 @@ int main(void)
 						bool sent = false;
 						if (OkToSend())
 						{
+							RequestStats::StartSend(filesStatsSlot);
 							sent = FileManager::ProcessTimers();
 						}
 
-						// if nothing was fetched do a status update
+						// if nothing was fetched do a status update, unless the host pushes changes to us
 						if (!sent)
 						{
-							SerialIo::Sendf("M409 F\"d99fp\"\n");
+							RequestStats::StartSend(statusStatsSlot);
+							sent = Subscription::SendStatusRequest([](size_t i) { return seqs[i].key; }, ARRAY_SIZE(seqs));
+						}
+
+						if (sent)
+						{
+							RequestStats::EndSend();
+							lastPollTime = SystemTick::GetTickCount();
 						}
-						lastPollTime = SystemTick::GetTickCount();
 					}
 				}
 			}
-			else if (now > lastPollTime + printerPollInterval + printerResponseTimeout)	  // request timeout
+			else if (   now > lastPollTime + printerPollInterval + printerResponseTimeout	  // request timeout
+					 && (!Subscription::IsActive() || lastResponseTime < lastPollTime)
+					)
 			{
 				dbg("request timeout\n");
+				Subscription::RequestTimedOut();
+				RequestStats::RequestTimedOut();
+				RequestStats::StartSend(statusStatsSlot);
 				SerialIo::Sendf("M409 F\"d99fp\"\n");
+				RequestStats::EndSend();
 				lastPollTime = SystemTick::GetTickCount();
 			}
 		}
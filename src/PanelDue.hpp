@@ -28,6 +28,7 @@ extern void CalibrateTouch();
 // Functions called from module UserInterface to manipulate non-volatile settings and associated hardware
 extern void FactoryReset();
 extern void SaveSettings();
+extern void RecreateUserInterface();
 extern bool IsSaveNeeded();
 extern void MirrorDisplay();
 extern void InvertDisplay();
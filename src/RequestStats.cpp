@@ -0,0 +1,244 @@
+/*
+ * RequestStats.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "RequestStats.hpp"
+#include <cstring>
+#include <Hardware/SerialIo.hpp>
+#include <Hardware/SysTick.hpp>
+#include <UI/MessageLog.hpp>
+#include <General/String.h>
+
+namespace RequestStats
+{
+	constexpr uint32_t ExportLineInterval = 250;		// minimum interval between exported lines, so that we don't overrun the host's input buffer
+
+	struct Slot
+	{
+		const char * _ecv_array name;
+		uint16_t timeouts;
+		uint16_t buckets[(size_t)Phase::numPhases][NumBuckets];
+	};
+
+	const char phaseLetters[] = "qthr";
+
+	static Slot *slots = nullptr;
+	static size_t numSlots = 0;
+	static size_t maxSlots = 0;
+
+	// State of the request we are currently timing
+	static size_t pendingSlot = 0;
+	static bool pending = false;
+	static uint32_t dueTime = 0;
+	static bool due = false;
+	static uint32_t sendStartTime = 0;
+	static uint32_t sendEndTime = 0;
+	static uint32_t quietWaitTime = 0;
+
+	// State of a pending export. exportLine counts lines within the current slot, 0 being the header line.
+	static bool exporting = false;
+	static size_t exportSlot = 0;
+	static size_t exportLine = 0;
+	static uint32_t lastExportTime = 0;
+
+	void Init(size_t n)
+	{
+		slots = new Slot[n];
+		maxSlots = n;
+		numSlots = 0;
+		Reset();
+	}
+
+	size_t Register(const char * _ecv_array name)
+	{
+		if (numSlots == maxSlots)
+		{
+			return maxSlots - 1;			// should not happen, but don't overrun the array
+		}
+		slots[numSlots].name = name;
+		return numSlots++;
+	}
+
+	static size_t BucketNumber(uint32_t ms)
+	{
+		const size_t bucket = (ms == 0) ? 0 : 32 - __builtin_clz(ms);
+		return (bucket < NumBuckets) ? bucket : NumBuckets - 1;
+	}
+
+	// Return the upper bound of the values counted in a bucket, or the lower bound for the last one
+	static uint32_t BucketLimit(size_t bucket)
+	{
+		return (bucket == 0) ? 0
+				: (bucket == NumBuckets - 1) ? 1u << (bucket - 1)
+					: (1u << bucket) - 1;
+	}
+
+	static void Count(Slot& slot, Phase phase, uint32_t ms)
+	{
+		uint16_t& count = slot.buckets[(size_t)phase][BucketNumber(ms)];
+		if (count != UINT16_MAX)
+		{
+			++count;
+		}
+	}
+
+	static uint32_t NumRequests(const Slot& slot)
+	{
+		uint32_t total = 0;
+		for (size_t i = 0; i < NumBuckets; ++i)
+		{
+			total += slot.buckets[(size_t)Phase::transmit][i];
+		}
+		return total;
+	}
+
+	static uint32_t Median(const Slot& slot, Phase phase, uint32_t total)
+	{
+		uint32_t seen = 0;
+		for (size_t i = 0; i < NumBuckets; ++i)
+		{
+			seen += slot.buckets[(size_t)phase][i];
+			if (2 * seen >= total)
+			{
+				return BucketLimit(i);
+			}
+		}
+		return BucketLimit(NumBuckets - 1);
+	}
+
+	void RequestDue(uint32_t now)
+	{
+		if (!due)
+		{
+			dueTime = now;
+			due = true;
+		}
+	}
+
+	void StartSend(size_t slot)
+	{
+		sendStartTime = SystemTick::GetTickCount();
+		quietWaitTime = (due) ? sendStartTime - dueTime : 0;
+		pendingSlot = slot;
+	}
+
+	void EndSend()
+	{
+		sendEndTime = SystemTick::GetTickCount();
+		pending = (slots != nullptr);
+		due = false;
+	}
+
+	void ResponseComplete()
+	{
+		if (!pending)
+		{
+			return;
+		}
+		pending = false;
+
+		// The start of the line may belong to an unsolicited message received after our response, so keep it within bounds
+		const uint32_t now = SystemTick::GetTickCount();
+		uint32_t lineStartTime = SerialIo::GetLineStartTime();
+		if (lineStartTime - sendEndTime > now - sendEndTime)
+		{
+			lineStartTime = now;
+		}
+
+		Slot& slot = slots[pendingSlot];
+		Count(slot, Phase::quietWait, quietWaitTime);
+		Count(slot, Phase::transmit, sendEndTime - sendStartTime);
+		Count(slot, Phase::host, lineStartTime - sendEndTime);
+		Count(slot, Phase::receive, now - lineStartTime);
+	}
+
+	void RequestTimedOut()
+	{
+		if (pending)
+		{
+			pending = false;
+			if (slots[pendingSlot].timeouts != UINT16_MAX)
+			{
+				++slots[pendingSlot].timeouts;
+			}
+		}
+		due = false;
+	}
+
+	void Reset()
+	{
+		for (size_t i = 0; i < maxSlots; ++i)
+		{
+			slots[i].timeouts = 0;
+			memset(slots[i].buckets, 0, sizeof(slots[i].buckets));
+		}
+		pending = false;
+		due = false;
+	}
+
+	void ShowSummary()
+	{
+		MessageLog::AppendMessage(MessageLog::LogLevel::Normal, "Median latency ms: quiet/tx/host/rx");
+		for (size_t i = 0; i < numSlots; ++i)
+		{
+			const Slot& slot = slots[i];
+			const uint32_t total = NumRequests(slot);
+			if (total != 0 || slot.timeouts != 0)
+			{
+				MessageLog::AppendMessageF(MessageLog::LogLevel::Normal, "%s n%lu t/o %u: %lu/%lu/%lu/%lu",
+						slot.name, total, slot.timeouts,
+						Median(slot, Phase::quietWait, total), Median(slot, Phase::transmit, total),
+						Median(slot, Phase::host, total), Median(slot, Phase::receive, total));
+			}
+		}
+	}
+
+	void StartExport()
+	{
+		exporting = (numSlots != 0);
+		exportSlot = 0;
+		exportLine = 0;
+	}
+
+	bool ExportNext(uint32_t now)
+	{
+		if (!exporting || now - lastExportTime < ExportLineInterval)
+		{
+			return false;
+		}
+		lastExportTime = now;
+
+		// Each slot is exported as a header line followed by one line per phase listing the bucket counts.
+		// M118 P2 sends them to the web interface console, where they can be copied out.
+		const Slot& slot = slots[exportSlot];
+		String<100> line;
+		if (exportLine == 0)
+		{
+			line.printf("latency %s n %lu timeouts %u", slot.name, NumRequests(slot), slot.timeouts);
+		}
+		else
+		{
+			const size_t phase = exportLine - 1;
+			line.printf("latency %s %c", slot.name, phaseLetters[phase]);
+			for (size_t i = 0; i < NumBuckets; ++i)
+			{
+				line.catf(" %u", slot.buckets[phase][i]);
+			}
+		}
+		SerialIo::Sendf("M118 P2 S\"%s\"\n", line.c_str());
+
+		if (++exportLine > (size_t)Phase::numPhases)
+		{
+			exportLine = 0;
+			if (++exportSlot == numSlots)
+			{
+				exporting = false;
+			}
+		}
+		return true;
+	}
+}
+
+// End
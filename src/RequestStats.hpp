@@ -0,0 +1,66 @@
+/*
+ * RequestStats.hpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Round-trip latency statistics for the requests we send to the host.
+ * Each request type gets one log2 histogram per phase of the round trip.
+ */
+
+#ifndef SRC_REQUESTSTATS_HPP_
+#define SRC_REQUESTSTATS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include "ecv.h"
+#undef array
+#undef result
+#undef value
+
+namespace RequestStats
+{
+	enum class Phase : uint8_t
+	{
+		quietWait,			// request was due but we were waiting for the serial line to go quiet
+		transmit,			// sending the command
+		host,				// from the end of the command to the first character of the response
+		receive,			// from the first character of the response to the end of the parsed message
+		numPhases
+	};
+
+	// Bucket 0 counts 0ms, bucket n counts [2^(n-1), 2^n) ms, the last bucket counts everything above that
+	constexpr size_t NumBuckets = 12;
+
+	// Allocate the statistics slots. Call this once during initialisation, before any call to Register.
+	void Init(size_t maxSlots);
+
+	// Register a request type and return its slot number
+	size_t Register(const char * _ecv_array name);
+
+	// Note that a request could be sent now if the serial line were quiet
+	void RequestDue(uint32_t now);
+
+	// Bracket the sending of a request. StartSend may be called again before EndSend if the request type changes.
+	void StartSend(size_t slot);
+	void EndSend();
+
+	// Called when the host has finished sending a response
+	void ResponseComplete();
+
+	// Called when we give up waiting for the response to the last request
+	void RequestTimedOut();
+
+	void Reset();
+
+	// Append a summary of the median latencies of each request type to the message log
+	void ShowSummary();
+
+	// Start exporting the full histograms to the host console, one line at a time
+	void StartExport();
+
+	// Send the next line of a pending export in place of a poll, and return true if a line was sent.
+	// Call this only when a request is due and the serial line is quiet, so that the host's reply can't be taken for the response to a poll.
+	bool ExportNext(uint32_t now);
+}
+
+#endif /* SRC_REQUESTSTATS_HPP_ */
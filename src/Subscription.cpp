@@ -0,0 +1,172 @@
+/*
+ * Subscription.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "Subscription.hpp"
+#include <cstring>
+#include <Hardware/SerialIo.hpp>
+#include <UI/MessageLog.hpp>
+
+namespace Subscription
+{
+	constexpr uint32_t HeartbeatInterval = 5000;			// heartbeat interval we ask for
+	constexpr const char * _ecv_array Flags = "d99fps";		// no other request uses these, so we can recognise the response when the host echoes them
+
+	enum class State : uint8_t
+	{
+		unknown,			// not requested since the last (re)connect
+		requested,			// waiting for the response to the request
+		active,				// host pushes changes and heartbeats
+		stopping,			// waiting for the response to the request to stop
+		unsupported			// host did not acknowledge, keep polling
+	};
+
+	static State state = State::unknown;
+	static bool enabled = false;
+	static uint32_t heartbeatInterval = 0;
+
+	// What we have seen of the message being received
+	static bool receivingResponse = false;		// the message is the response to a subscription request or a request to stop
+	static bool haveSubscribed = false;			// the message has a valid "subscribed" field
+	static uint32_t subscribedInterval = 0;
+
+	void SetEnabled(bool en)
+	{
+		enabled = en;
+	}
+
+	bool IsEnabled()
+	{
+		return enabled;
+	}
+
+	void Reset()
+	{
+		state = State::unknown;
+		heartbeatInterval = 0;
+		receivingResponse = false;
+	}
+
+	bool IsActive()
+	{
+		return state == State::active;
+	}
+
+	uint32_t GetHeartbeatInterval()
+	{
+		return heartbeatInterval;
+	}
+
+	bool SendStatusRequest(function_ref<const char * _ecv_array(size_t)> getKey, size_t numKeys)
+	{
+		switch (state)
+		{
+		case State::unknown:
+			if (enabled)
+			{
+				SerialIo::Sendf("M409 F\"%s\" H%lu S\"", Flags, HeartbeatInterval);
+				for (size_t i = 0; i < numKeys; ++i)
+				{
+					SerialIo::Sendf((i == 0) ? "%s" : ",%s", getKey(i));
+				}
+				SerialIo::Sendf("\"\n");
+				state = State::requested;
+				return true;
+			}
+			break;
+
+		case State::active:
+			if (enabled)
+			{
+				return false;
+			}
+			SerialIo::Sendf("M409 F\"%s\" H0\n", Flags);
+			state = State::stopping;
+			return true;
+
+		default:
+			break;
+		}
+
+		SerialIo::Sendf("M409 F\"d99fp\"\n");
+		return true;
+	}
+
+	void RequestTimedOut()
+	{
+		switch (state)
+		{
+		case State::requested:
+			state = State::unsupported;
+			MessageLog::AppendMessage(MessageLog::LogLevel::Verbose, "Info: host did not answer the request to push changes, polling");
+			break;
+
+		case State::stopping:
+			state = State::unknown;
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	void StartReceivedMessage()
+	{
+		receivingResponse = false;
+		haveSubscribed = false;
+	}
+
+	void ProcessFlags(const char * _ecv_array flags)
+	{
+		if (strcmp(flags, Flags) == 0)
+		{
+			receivingResponse = true;
+		}
+	}
+
+	void ProcessSubscribed(uint32_t interval)
+	{
+		haveSubscribed = true;
+		subscribedInterval = interval;
+	}
+
+	// Other messages may arrive before the response, e.g. the response to a poll that was still in progress, so only the response can change the state
+	void EndReceivedMessage()
+	{
+		if (!receivingResponse)
+		{
+			return;
+		}
+
+		switch (state)
+		{
+		case State::requested:
+			if (haveSubscribed && subscribedInterval != 0)
+			{
+				state = State::active;
+				heartbeatInterval = subscribedInterval;
+				MessageLog::AppendMessage(MessageLog::LogLevel::Verbose, "Info: host pushes changes");
+			}
+			else
+			{
+				state = State::unsupported;
+				MessageLog::AppendMessage(MessageLog::LogLevel::Verbose, "Info: host does not push changes, polling");
+			}
+			break;
+
+		case State::stopping:
+			state = State::unknown;
+			heartbeatInterval = 0;
+			MessageLog::AppendMessage(MessageLog::LogLevel::Verbose, "Info: host stopped pushing changes, polling");
+			break;
+
+		default:
+			break;
+		}
+		receivingResponse = false;
+	}
+}
+
+// End
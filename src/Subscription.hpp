@@ -0,0 +1,58 @@
+/*
+ * Subscription.hpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Asking the host to push object model changes to us instead of us polling for them.
+ *
+ * Once all keys have been fetched, the periodic status request becomes
+ *   M409 F"d99fps" H<heartbeat ms> S"<key>,<key>,..."
+ * A host that supports this echoes the flags and replies with "subscribed":<heartbeat ms>, then sends a message at least
+ * once per heartbeat interval. To stop, we send the same request with H0 and the host replies with "subscribed":0.
+ * Hosts without the extension ignore the H and S parameters and send a normal status response, which has no "subscribed" field.
+ * That response, an invalid "subscribed" value, or no response at all puts us back to polling until the next reconnect.
+ *
+ * This protocol has only been tried against the host stand-in in Tools/subscription, so it is off unless the pushUpdates setting is on.
+ */
+
+#ifndef SRC_SUBSCRIPTION_HPP_
+#define SRC_SUBSCRIPTION_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <General/function_ref.h>
+#include "ecv.h"
+#undef array
+#undef result
+#undef value
+
+namespace Subscription
+{
+	// Turn push updates on or off. Turning them off while the host is pushing asks it to stop at the next status request.
+	void SetEnabled(bool enabled);
+	bool IsEnabled();
+
+	// Forget any subscription, e.g. after we have lost the connection. The next status request asks for one again if push updates are on.
+	void Reset();
+
+	// Return true if the host is pushing changes to us, in which case the periodic status poll isn't needed
+	bool IsActive();
+
+	// Return the heartbeat interval that the host agreed to, if it is pushing changes to us
+	uint32_t GetHeartbeatInterval();
+
+	// Send the periodic status request, which may be a subscription request or a request to stop, and return true if anything was sent.
+	// Nothing is sent while the host is pushing changes to us. getKey returns each of the numKeys keys that the host should push.
+	bool SendStatusRequest(function_ref<const char * _ecv_array(size_t)> getKey, size_t numKeys);
+
+	// Called when we give up waiting for the response to the last request
+	void RequestTimedOut();
+
+	// Called as each message from the host is parsed, with the values of its "flags" and "subscribed" fields if it has them
+	void StartReceivedMessage();
+	void ProcessFlags(const char * _ecv_array flags);
+	void ProcessSubscribed(uint32_t heartbeatInterval);
+	void EndReceivedMessage();
+}
+
+#endif /* SRC_SUBSCRIPTION_HPP_ */
@@ -0,0 +1,88 @@
+/*
+ * DamageRegion.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "DamageRegion.hpp"
+#include <cstdint>
+
+static void Merge(DamageRect& r, const DamageRect& other)
+{
+	if (other.xmin < r.xmin) { r.xmin = other.xmin; }
+	if (other.ymin < r.ymin) { r.ymin = other.ymin; }
+	if (other.xmax > r.xmax) { r.xmax = other.xmax; }
+	if (other.ymax > r.ymax) { r.ymax = other.ymax; }
+}
+
+static uint32_t Area(const DamageRect& r)
+{
+	return (uint32_t)(r.xmax - r.xmin + 1) * (uint32_t)(r.ymax - r.ymin + 1);
+}
+
+// Add a rectangle to the region. Any existing rectangles that overlap or touch it are absorbed into it.
+// If there is no room for it then it is merged with whichever existing rectangle grows least as a result.
+void DamageRegion::Add(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax)
+{
+	if (xmax < xmin || ymax < ymin)
+	{
+		return;
+	}
+
+	DamageRect r = { xmin, ymin, xmax, ymax };
+	size_t i = 0;
+	while (i < numRects)
+	{
+		const DamageRect& other = rects[i];
+		if (   other.xmin <= r.xmax + 1 && other.xmax + 1 >= r.xmin
+			&& other.ymin <= r.ymax + 1 && other.ymax + 1 >= r.ymin)
+		{
+			Merge(r, other);
+			rects[i] = rects[--numRects];
+			i = 0;							// the bigger rectangle may now touch ones we have already looked at
+		}
+		else
+		{
+			++i;
+		}
+	}
+
+	if (numRects < MaxRects)
+	{
+		rects[numRects++] = r;
+		return;
+	}
+
+	size_t best = 0;
+	uint32_t bestGrowth = UINT32_MAX;
+	for (i = 0; i < numRects; ++i)
+	{
+		DamageRect merged = rects[i];
+		Merge(merged, r);
+		const uint32_t growth = Area(merged) - Area(rects[i]);
+		if (growth < bestGrowth)
+		{
+			best = i;
+			bestGrowth = growth;
+		}
+	}
+
+	// Merging may make the rectangle touch others, so add it again from scratch
+	Merge(r, rects[best]);
+	rects[best] = rects[--numRects];
+	Add(r.xmin, r.ymin, r.xmax, r.ymax);
+}
+
+bool DamageRegion::Intersects(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax) const
+{
+	for (size_t i = 0; i < numRects; ++i)
+	{
+		if (rects[i].Intersects(xmin, ymin, xmax, ymax))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// End
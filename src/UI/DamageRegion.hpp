@@ -0,0 +1,50 @@
+/*
+ * DamageRegion.hpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * A small set of screen rectangles that need to be redrawn. Rectangles that overlap or touch are merged as they are added.
+ */
+
+#ifndef SRC_UI_DAMAGEREGION_HPP_
+#define SRC_UI_DAMAGEREGION_HPP_
+
+#include <cstddef>
+#include <UI/DisplaySize.hpp>
+
+struct DamageRect
+{
+	PixelNumber xmin, ymin, xmax, ymax;			// inclusive
+
+	bool Intersects(PixelNumber pxmin, PixelNumber pymin, PixelNumber pxmax, PixelNumber pymax) const
+	{
+		return pxmin <= xmax && pxmax >= xmin && pymin <= ymax && pymax >= ymin;
+	}
+
+	bool IsInside(PixelNumber pxmin, PixelNumber pymin, PixelNumber pxmax, PixelNumber pymax) const
+	{
+		return xmin >= pxmin && xmax <= pxmax && ymin >= pymin && ymax <= pymax;
+	}
+};
+
+class DamageRegion
+{
+public:
+	static constexpr size_t MaxRects = 8;
+
+	DamageRegion() : numRects(0) { }
+
+	void Clear() { numRects = 0; }
+	bool IsEmpty() const { return numRects == 0; }
+	size_t GetNumRects() const { return numRects; }
+	const DamageRect& GetRect(size_t i) const { return rects[i]; }
+
+	void Add(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax);
+	bool Intersects(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax) const;
+
+private:
+	DamageRect rects[MaxRects];
+	size_t numRects;
+};
+
+#endif /* SRC_UI_DAMAGEREGION_HPP_ */
@@ -13,6 +13,8 @@
 #undef array
 #undef result
 #include <algorithm>
+#include <cctype>
+#include <General/SafeVsnprintf.h>
 
 #define DEBUG 0
 #include "Debug.hpp"
@@ -33,7 +35,7 @@ Palette DisplayField::defaultIconPalette = IconPaletteLight;
 
 DisplayField::DisplayField(PixelNumber py, PixelNumber px, PixelNumber pw)
 	: y(py), x(px), width(pw), fcolour(defaultFcolour), bcolour(defaultBcolour),
-		changed(true), visible(true), underlined(false), border(false), textRows(1), next(nullptr)
+		changed(true), visible(true), underlined(false), border(false), textRows(1), layoutChanged(true), next(nullptr)
 {
 }
 
@@ -62,7 +64,7 @@ void DisplayField::SetPositionAndWidth(PixelNumber newX, PixelNumber newWidth)
 	}
 	x = newX;
 	width = newWidth;
-	changed = true;
+	changed = layoutChanged = true;
 }
 
 void DisplayField::SetPosition(PixelNumber x, PixelNumber y)
@@ -73,7 +75,29 @@ void DisplayField::SetPosition(PixelNumber x, PixelNumber y)
 	}
 	this->x = x;
 	this->y = y;
-	changed = true;
+	changed = layoutChanged = true;
+}
+
+// Refresh a field on behalf of a window. If it needs to be redrawn then record how long that took and how much it drew.
+static void RefreshField(DisplayField *f, bool full, PixelNumber xOffset, PixelNumber yOffset)
+{
+	if (!full && !f->HasChanged())
+	{
+		return;
+	}
+	RenderStats::BeginField();
+	f->Refresh(full, xOffset, yOffset);
+	RenderStats::EndField(f->GetKind(), f->GetMinX() + xOffset, f->GetMinY() + yOffset);
+}
+
+// Return true if the field needs to be refreshed when drawing the display rows from 'top' to 'bottom' inclusive.
+// Fields that draw directly to the display outside Refresh are only refreshed in the band that holds their top row, so that they are only notified once.
+bool DisplayField::InBand(PixelNumber yOffset, PixelNumber top, PixelNumber bottom) const
+{
+	const PixelNumber minY = y + yOffset;
+	return (DrawsDirect())
+			? minY >= top && minY <= bottom
+				: minY <= bottom && minY + GetHeight() - 1 >= top;
 }
 
 /*static*/ void DisplayField::SetDefaultColours(Colour pf, Colour pb, Colour pbb, Colour pg, Colour pbp, Colour pgp, Palette pal)
@@ -90,16 +114,18 @@ void DisplayField::SetPosition(PixelNumber x, PixelNumber y)
 /*static*/ PixelNumber DisplayField::GetTextWidth(const char* _ecv_array s, PixelNumber maxWidth)
 {
 	lcd.setFont(DisplayField::defaultFont);
-	lcd.setTextPos(0, 9999, maxWidth);
-	lcd.printf("%s", s);						// dummy print to get text width
-	return lcd.getTextX();
+	return lcd.measureText(s, maxWidth);
 }
 
 /*static*/ PixelNumber DisplayField::GetTextWidth(const char* _ecv_array s, PixelNumber maxWidth, size_t maxChars)
 {
-	lcd.setTextPos(0, 9999, maxWidth);
-	lcd.printf("%.*s", maxChars, s);				// dummy print to get text width
-	return lcd.getTextX();
+	return lcd.measureText(s, maxWidth, maxChars);
+}
+
+/*static*/ size_t DisplayField::GetTextFit(const char* _ecv_array s, PixelNumber maxWidth, size_t maxChars)
+{
+	lcd.setFont(DisplayField::defaultFont);
+	return lcd.fitText(s, maxWidth, maxChars);
 }
 
 void DisplayField::Show(bool v)
@@ -107,6 +133,7 @@ void DisplayField::Show(bool v)
 	if (visible != v)
 	{
 		visible = changed = v;
+		layoutChanged = true;
 	}
 }
 
@@ -129,7 +156,7 @@ void DisplayField::SetColours(Colour pf, Colour pb)
 	{
 		fcolour = pf;
 		bcolour = pb;
-		changed = true;
+		changed = layoutChanged = true;
 	}
 }
 
@@ -196,6 +223,21 @@ bool Window::Visible(const DisplayField *p) const
 	return p->IsVisible() && !ObscuredByPopup(p);
 }
 
+// Return true if the field is entirely inside one of the popups in front of this window, so that none of it can be seen.
+// A full redraw draws every other visible field and then the popups over them, so fields that a popup only partly covers aren't left out.
+bool Window::HiddenByPopup(const DisplayField *p) const
+{
+	const PixelNumber xOffset = Xpos(), yOffset = Ypos();
+	for (const PopupWindow * null pw = next; pw != nullptr; pw = pw->next)
+	{
+		if (pw->Contains(p->GetMinX() + xOffset, p->GetMinY() + yOffset, p->GetMaxX() + xOffset, p->GetMaxY() + yOffset))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 // Get the field that has been touched, or nullptr if we can't find one
 ButtonPress Window::FindEvent(PixelNumber x, PixelNumber y)
 {
@@ -245,51 +287,186 @@ void Window::SetPopup(PopupWindow * p, PixelNumber px, PixelNumber py, bool redr
 	}
 }
 
+// Detach the topmost popup, provided that it is the one specified or none was specified, and add the area it occupied to the damaged region.
+// Return the window that was under it, or nullptr if we didn't detach anything.
+Window * null Window::DetachLastPopup(PopupWindow *whichOne, DamageRegion& damage)
+{
+	if (next == nullptr)
+	{
+		return nullptr;
+	}
+
+	// Find the penultimate window
+	Window *pw = this;
+	while (pw->next->next != nullptr)
+	{
+		pw = pw->next;
+	}
+
+	if (whichOne != nullptr && whichOne != pw->next)
+	{
+		return nullptr;
+	}
+
+	const PopupWindow * const p = pw->next;
+	damage.Add(p->Xpos(), p->Ypos(), p->Xpos() + p->GetWidth() - 1, p->Ypos() + p->GetHeight() - 1);
+	pw->next = nullptr;
+	return pw;
+}
+
 void Window::ClearPopup(bool redraw, PopupWindow *whichOne)
 {
-	if (next != nullptr)
+	DamageRegion damage;
+	Window * const pw = DetachLastPopup(whichOne, damage);
+	if (pw != nullptr)
 	{
-		// Find the penultimate window
-		Window *pw = this;
-		while (pw->next->next != nullptr)
+		if (redraw)
 		{
-			pw = pw->next;
+			// Redraw just the area that the popup uncovered
+			RepairDamage(damage);
 		}
-
-		if (whichOne == nullptr || whichOne == pw->next)
+		else
 		{
-			const PixelNumber xmin = pw->next->Xpos(), xmax = xmin + pw->next->GetWidth() - 1, ymin = pw->next->Ypos(), ymax = ymin + pw->next->GetHeight() - 1;
-			bool popupWasContained = pw->Contains(xmin, ymin, xmax, ymax);
-			if (popupWasContained)
+			const DamageRect& r = damage.GetRect(0);
+			if (pw->Contains(r.xmin, r.ymin, r.xmax, r.ymax))
 			{
 				// Clear the area that was occupied by the last window to the background colour of the penultimate window
 				lcd.setColor(pw->backgroundColour);
-				lcd.fillRoundRect(xmin, ymin, xmax, ymax);
+				lcd.fillRoundRect(r.xmin, r.ymin, r.xmax, r.ymax);
 			}
+		}
+	}
+}
 
-			// Detach the last window
-			pw->next = nullptr;
+// Redraw whatever intersects the damaged region, in this window and then in the popups above it
+void Window::RepairDamage(const DamageRegion& damage)
+{
+	if (!damage.IsEmpty())
+	{
+		RepairOwnDamage(damage);
+		if (next != nullptr)
+		{
+			next->RepairDamage(damage);
+		}
+	}
+}
 
-			if (redraw)
+// Redraw the visible fields of this window and the popups in front of it that have changed and have rows both above 'row' and at or below it.
+// This is called when a redraw a band at a time resumes at 'row', because the parts of those fields that were drawn already show their old values.
+// Fields that draw directly to the display are not clipped to bands, so they are left alone.
+void Window::RedrawChangedFieldsCrossingRow(PixelNumber row)
+{
+	const PixelNumber xOffset = Xpos(), yOffset = Ypos();
+	for (DisplayField * null pp = root; pp != nullptr; pp = pp->next)
+	{
+		if (   pp->HasChanged() && !pp->DrawsDirect() && Visible(pp)
+			&& pp->GetMinY() + yOffset < row && pp->GetMaxY() + yOffset >= row
+		   )
+		{
+			RefreshField(pp, true, xOffset, yOffset);
+		}
+	}
+	if (next != nullptr)
+	{
+		next->RedrawChangedFieldsCrossingRow(row);
+	}
+}
+
+// Redraw the visible fields of this window that intersect the damaged region, or all of them if 'all' is true.
+// Fields are redrawn in full, but fields that the damage doesn't touch are left alone.
+void Window::RedrawDamagedFields(const DamageRegion& damage, bool all)
+{
+	const PixelNumber xOffset = Xpos(), yOffset = Ypos();
+	for (DisplayField * null pp = root; pp != nullptr; pp = pp->next)
+	{
+		if (   Visible(pp)
+			&& (all || damage.Intersects(pp->GetMinX() + xOffset, pp->GetMinY() + yOffset, pp->GetMaxX() + xOffset, pp->GetMaxY() + yOffset))
+		   )
+		{
+			RefreshField(pp, true, xOffset, yOffset);
+		}
+	}
+}
+
+// Fill the rectangle to the current colour, except for the parts covered by the first 'numCovers' rectangles in 'covers'
+static void FillUncovered(const DamageRect& r, const DamageRect *covers, size_t numCovers)
+{
+	for (; numCovers != 0; ++covers, --numCovers)
+	{
+		const DamageRect& c = *covers;
+		if (c.Intersects(r.xmin, r.ymin, r.xmax, r.ymax))
+		{
+			// Fill the parts of the rectangle above, below, left and right of this cover. The rest of it is covered.
+			const PixelNumber ymin = std::max<PixelNumber>(r.ymin, c.ymin), ymax = std::min<PixelNumber>(r.ymax, c.ymax);
+			if (r.ymin < c.ymin)
 			{
-				if (popupWasContained)
-				{
-					// Re-display the fields of the penultimate window that were obscured
-					for (DisplayField * null pp = pw->root; pp != nullptr; pp = pp->next)
-					{
-						if (pp->IsVisible())
-						{
-							pp->Refresh(true, pw->Xpos(), pw->Ypos());
-						}
-					}
-				}
-				else
-				{
-					Refresh(true);		// redraw everything
-				}
+				FillUncovered(DamageRect{ r.xmin, r.ymin, r.xmax, (PixelNumber)(c.ymin - 1) }, covers + 1, numCovers - 1);
+			}
+			if (r.ymax > c.ymax)
+			{
+				FillUncovered(DamageRect{ r.xmin, (PixelNumber)(c.ymax + 1), r.xmax, r.ymax }, covers + 1, numCovers - 1);
+			}
+			if (r.xmin < c.xmin)
+			{
+				FillUncovered(DamageRect{ r.xmin, ymin, (PixelNumber)(c.xmin - 1), ymax }, covers + 1, numCovers - 1);
 			}
+			if (r.xmax > c.xmax)
+			{
+				FillUncovered(DamageRect{ (PixelNumber)(c.xmax + 1), ymin, r.xmax, ymax }, covers + 1, numCovers - 1);
+			}
+			return;
+		}
+	}
+	lcd.fillRect(r.xmin, r.ymin, r.xmax, r.ymax);
+}
+
+// Clear the parts of the damaged areas that are inside 'bounds' to the background colour.
+// The popups in front of this window repaint whatever the damage reaches of them, so we leave the parts that they cover alone.
+void Window::FillDamage(const DamageRegion& damage, const DamageRect& bounds) const
+{
+	constexpr size_t MaxCovers = 4 * PopupWindow::MaxOpaqueRects;		// popups beyond the fourth are painted over and then repainted
+	DamageRect covers[MaxCovers];
+	size_t numCovers = 0;
+	for (const PopupWindow * null pw = next; pw != nullptr && numCovers + PopupWindow::MaxOpaqueRects <= MaxCovers; pw = pw->next)
+	{
+		numCovers += pw->GetOpaqueRects(covers + numCovers);
+	}
+
+	lcd.setColor(backgroundColour);
+	for (size_t i = 0; i < damage.GetNumRects(); ++i)
+	{
+		const DamageRect& r = damage.GetRect(i);
+		if (r.Intersects(bounds.xmin, bounds.ymin, bounds.xmax, bounds.ymax))
+		{
+			const DamageRect clipped =
+			{
+				std::max<PixelNumber>(r.xmin, bounds.xmin), std::max<PixelNumber>(r.ymin, bounds.ymin),
+				std::min<PixelNumber>(r.xmax, bounds.xmax), std::min<PixelNumber>(r.ymax, bounds.ymax)
+			};
+			FillUncovered(clipped, covers, numCovers);
+		}
+	}
+}
+
+// Clear a field that has just been hidden to the background colour, except where the popups in front of this window are.
+// The popups only repaint the area they covered when they close, so the parts of the field outside them must be cleared now.
+void Window::ClearOutsidePopups(const DisplayField *f) const
+{
+	constexpr size_t MaxCovers = 4;
+	DamageRect covers[MaxCovers];
+	size_t numCovers = 0;
+	for (const PopupWindow * null pw = next; pw != nullptr; pw = pw->next)
+	{
+		if (numCovers == MaxCovers)
+		{
+			return;						// too many popups to leave out, so clear nothing rather than paint over one of them
 		}
+		covers[numCovers++] = DamageRect{ pw->Xpos(), pw->Ypos(), (PixelNumber)(pw->Xpos() + pw->GetWidth() - 1), (PixelNumber)(pw->Ypos() + pw->GetHeight() - 1) };
 	}
+
+	lcd.setColor(backgroundColour);
+	FillUncovered(DamageRect{ (PixelNumber)(f->GetMinX() + Xpos()), (PixelNumber)(f->GetMinY() + Ypos()), (PixelNumber)(f->GetMaxX() + Xpos()), (PixelNumber)(f->GetMaxY() + Ypos()) },
+					covers, numCovers);
 }
 
 bool Window::IsPopupActive(const PopupWindow *popup)
@@ -317,7 +494,7 @@ void Window::Redraw(DisplayField *f)
 			{
 				if (p->IsVisible())
 				{
-					p->Refresh(true, Xpos(), Ypos());
+					RefreshField(p, true, Xpos(), Ypos());
 				}
 				else
 				{
@@ -347,18 +524,13 @@ void Window::Show(DisplayField * null f, bool v)
 		{
 			if (p == f)
 			{
-				if (ObscuredByPopup(f))
+				if (!v)
 				{
-					// nothing to do
+					ClearOutsidePopups(f);
 				}
-				else if (v)
+				else if (!ObscuredByPopup(f))
 				{
-					f->Refresh(true, Xpos(), Ypos());
-				}
-				else
-				{
-					lcd.setColor(backgroundColour);
-					lcd.fillRect(f->GetMinX(), f->GetMinY(), f->GetMaxX(), f->GetMaxY());
+					RefreshField(f, true, Xpos(), Ypos());
 				}
 				return;
 			}
@@ -385,7 +557,8 @@ void Window::Press(ButtonPress bp, bool v)
 	}
 }
 
-MainWindow::MainWindow() : Window(black), staticLeftMargin(0)
+MainWindow::MainWindow()
+	: Window(black), staticLeftMargin(0), bandRendering(true), refreshing(false), refreshBanded(false), refreshRow(0), refreshField(nullptr)
 {
 }
 
@@ -394,27 +567,128 @@ void MainWindow::Init(Colour bc)
 	backgroundColour = bc;
 }
 
-// Refresh all fields. If 'full' is true then we rewrite them all, else we just rewrite those that have changed.
+// Refresh all fields. If 'full' is true then we rewrite them all now, else we just rewrite those that have changed.
+// If a redraw started by StartRefresh is in progress then we do the next slice of it instead.
 void MainWindow::Refresh(bool full)
 {
 	if (full)
 	{
-		lcd.fillScr(backgroundColour, staticLeftMargin);
+		StartRefresh();
+		(void)RefreshSlice(UINT32_MAX);
+		return;
+	}
+
+	if (refreshing)
+	{
+		(void)RefreshSlice(RefreshSlicePixels);
+		return;
 	}
 
 	for (DisplayField * null pp = root; pp != nullptr; pp = pp->next)
 	{
 		if (Visible(pp))
 		{
-			pp->Refresh(full, 0, 0);
+			RefreshField(pp, false, 0, 0);
 		}
 	}
 	if (next != nullptr)
 	{
-		next->Refresh(full);
+		next->Refresh(false);
 	}
 }
 
+// Start redrawing the whole display. Each call to Refresh(false) then draws about RefreshSlicePixels pixels of it,
+// so that the main loop can process serial input and touches while a new page is drawn.
+// Fields that change after they have been drawn are redrawn by Refresh(false) in the usual way when the redraw is complete.
+void MainWindow::StartRefresh()
+{
+	refreshing = true;
+
+	// The band buffer covers the whole width of the display, so we can't use it if there is a static area on the left
+	refreshBanded = bandRendering && staticLeftMargin == 0 && lcd.getBandLines() != 0;
+	refreshRow = 0;
+	refreshField = nullptr;
+}
+
+// Draw the next part of the redraw started by StartRefresh, stopping once at least 'maxPixels' pixels have been drawn.
+// Return true if the redraw is complete.
+bool MainWindow::RefreshSlice(uint32_t maxPixels)
+{
+	const PixelNumber displayWidth = lcd.getDisplayXSize();
+	const PixelNumber displayHeight = lcd.getDisplayYSize();
+	uint32_t pixels = 0;
+	if (refreshBanded)
+	{
+		const PixelNumber bandLines = lcd.getBandLines();
+		if (refreshRow != 0)
+		{
+			RedrawChangedFieldsCrossingRow(refreshRow);
+		}
+		while (refreshRow < displayHeight)
+		{
+			if (pixels >= maxPixels)
+			{
+				return false;
+			}
+			const PixelNumber bottom = std::min<PixelNumber>(refreshRow + bandLines, displayHeight) - 1;
+			RefreshBand(refreshRow, bottom);
+			pixels += (uint32_t)displayWidth * (bottom - refreshRow + 1);
+			refreshRow = bottom + 1;
+		}
+	}
+	else
+	{
+		if (refreshRow == 0)
+		{
+			lcd.fillScr(backgroundColour, staticLeftMargin);
+			pixels = (uint32_t)displayWidth * displayHeight;
+			refreshRow = displayHeight;
+			refreshField = root;
+		}
+		while (refreshField != nullptr)
+		{
+			if (pixels >= maxPixels)
+			{
+				return false;
+			}
+			DisplayField * const pp = refreshField;
+			refreshField = pp->next;
+			if (pp->IsVisible() && !HiddenByPopup(pp))
+			{
+				RefreshField(pp, true, 0, 0);
+				pixels += (uint32_t)(pp->GetMaxX() - pp->GetMinX() + 1) * (pp->GetMaxY() - pp->GetMinY() + 1);
+			}
+		}
+		if (next != nullptr)
+		{
+			next->Refresh(true);
+		}
+	}
+	refreshing = false;
+	return true;
+}
+
+// Redraw the display rows from 'top' to 'bottom' inclusive. The band is composed in RAM from the fields and popups that intersect it
+// and then sent to the display in one window, so nothing flickers and each pixel is only written to the display once.
+void MainWindow::RefreshBand(PixelNumber top, PixelNumber bottom)
+{
+	lcd.beginBand(top);
+	lcd.setColor(backgroundColour);
+	lcd.fillRect(0, top, lcd.getDisplayXSize() - 1, bottom);
+	for (DisplayField * null pp = root; pp != nullptr; pp = pp->next)
+	{
+		if (pp->IsVisible() && !HiddenByPopup(pp) && pp->InBand(0, top, bottom))
+		{
+			RefreshField(pp, true, 0, 0);
+		}
+	}
+	if (next != nullptr)
+	{
+		next->RefreshBand(top, bottom);
+	}
+	lcd.endBand();
+}
+
 bool MainWindow::Contains(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax) const
 {
 	UNUSED(xmin); UNUSED(ymin); UNUSED(xmax); UNUSED(ymax);
@@ -423,10 +697,17 @@ bool MainWindow::Contains(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax,
 
 void MainWindow::ClearAllPopups()
 {
-	while (next != nullptr)
-	{
-		ClearPopup(true);
-	}
+	// Take all the popups down before redrawing anything, so that areas covered by more than one of them are only redrawn once
+	DamageRegion damage;
+	while (DetachLastPopup(nullptr, damage) != nullptr) { }
+	RepairDamage(damage);
+}
+
+// Clear the damaged areas to the background colour and redraw the fields that they touch
+void MainWindow::RepairOwnDamage(const DamageRegion& damage)
+{
+	FillDamage(damage, DamageRect{ staticLeftMargin, 0, UINT16_MAX, UINT16_MAX });		// the damage never extends beyond the screen
+	RedrawDamagedFields(damage, false);
 }
 
 PopupWindow::PopupWindow(PixelNumber ph, PixelNumber pw, Colour pb, Colour pBorder, bool roundCorners)
@@ -438,45 +719,120 @@ void PopupWindow::Refresh(bool full)
 {
 	if (full)
 	{
-		// Draw a rectangle inside the border
-		lcd.setColor(backgroundColour);
-		if (roundedCorners)
-		{
-			lcd.fillRoundRect(xPos + 1, yPos + 2, xPos + width - 2, yPos + height - 3);
-		}
-		else
-		{
-			lcd.fillRect(xPos, yPos, xPos + width, yPos + height);
-		}
+		DrawFrame();
+	}
 
-		// Draw a double border
-		lcd.setColor(borderColour);
-		if (roundedCorners)
+	for (DisplayField * null p = root; p != nullptr; p = p->next)
+	{
+		if (p->IsVisible() && (full || !ObscuredByPopup(p)))
 		{
-			lcd.drawRoundRect(xPos, yPos, xPos + width - 1, yPos + height - 1);
-			lcd.drawRoundRect(xPos + 1, yPos + 1, xPos + width - 2, yPos + height - 2);
+			RefreshField(p, full, xPos, yPos);
 		}
-		else
+	}
+
+	if (next != nullptr)
+	{
+		next->Refresh(full);
+	}
+}
+
+// Draw the parts of this popup and the ones in front of it that fall in the band of display rows from 'top' to 'bottom' inclusive
+void PopupWindow::RefreshBand(PixelNumber top, PixelNumber bottom)
+{
+	if (yPos <= bottom && yPos + height - 1 >= top)
+	{
+		DrawFrame();
+		for (DisplayField * null p = root; p != nullptr; p = p->next)
 		{
-			lcd.drawRect(xPos, yPos, xPos + width - 1, yPos + height - 1);
-			lcd.drawRect(xPos + 1, yPos + 1, xPos + width - 2, yPos + height - 2);
+			if (p->IsVisible() && p->InBand(yPos, top, bottom))
+			{
+				RefreshField(p, true, xPos, yPos);
+			}
 		}
 	}
 
-	for (DisplayField * null p = root; p != nullptr; p = p->next)
+	if (next != nullptr)
 	{
-		if (p->IsVisible() && (full || !ObscuredByPopup(p)))
+		next->RefreshBand(top, bottom);
+	}
+}
+
+// If the damage is all inside the border then clear it and redraw the fields that it touches, else redraw the whole popup
+void PopupWindow::RepairOwnDamage(const DamageRegion& damage)
+{
+	bool damaged = false, insideBorder = true;
+	for (size_t i = 0; i < damage.GetNumRects(); ++i)
+	{
+		const DamageRect& r = damage.GetRect(i);
+		if (r.Intersects(xPos, yPos, xPos + width - 1, yPos + height - 1))
 		{
-			p->Refresh(full, xPos, yPos);
+			damaged = true;
+			if (!Contains(r.xmin, r.ymin, r.xmax, r.ymax))
+			{
+				insideBorder = false;
+			}
 		}
 	}
 
-	if (next != nullptr)
+	if (!damaged)
 	{
-		next->Refresh(full);
+		// Nothing to do
+	}
+	else if (insideBorder)
+	{
+		FillDamage(damage, DamageRect{ xPos, yPos, (PixelNumber)(xPos + width - 1), (PixelNumber)(yPos + height - 1) });
+		RedrawDamagedFields(damage, false);
+	}
+	else
+	{
+		DrawFrame();
+		RedrawDamagedFields(damage, true);
 	}
 }
 
+// Draw the background and border of the popup
+void PopupWindow::DrawFrame()
+{
+	// Draw a rectangle inside the border
+	lcd.setColor(backgroundColour);
+	if (roundedCorners)
+	{
+		lcd.fillRoundRect(xPos + 1, yPos + 2, xPos + width - 2, yPos + height - 3);
+	}
+	else
+	{
+		lcd.fillRect(xPos, yPos, xPos + width - 1, yPos + height - 1);
+	}
+
+	// Draw a double border
+	lcd.setColor(borderColour);
+	if (roundedCorners)
+	{
+		lcd.drawRoundRect(xPos, yPos, xPos + width - 1, yPos + height - 1);
+		lcd.drawRoundRect(xPos + 1, yPos + 1, xPos + width - 2, yPos + height - 2);
+	}
+	else
+	{
+		lcd.drawRect(xPos, yPos, xPos + width - 1, yPos + height - 1);
+		lcd.drawRect(xPos + 1, yPos + 1, xPos + width - 2, yPos + height - 2);
+	}
+}
+
+// Get the rectangles that DrawFrame paints over completely. Rounded corners leave a few pixels in each 3x3 corner unpainted, so we leave those squares out.
+size_t PopupWindow::GetOpaqueRects(DamageRect *rects) const
+{
+	const PixelNumber xmax = xPos + width - 1, ymax = yPos + height - 1;
+	if (!roundedCorners)
+	{
+		rects[0] = DamageRect{ xPos, yPos, xmax, ymax };
+		return 1;
+	}
+	rects[0] = DamageRect{ xPos, (PixelNumber)(yPos + 3), xmax, (PixelNumber)(ymax - 3) };
+	rects[1] = DamageRect{ (PixelNumber)(xPos + 3), yPos, (PixelNumber)(xmax - 3), (PixelNumber)(yPos + 2) };
+	rects[2] = DamageRect{ (PixelNumber)(xPos + 3), (PixelNumber)(ymax - 2), (PixelNumber)(xmax - 3), ymax };
+	return 3;
+}
+
 bool PopupWindow::Contains(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax) const
 {
 	return xPos + 2 <= xmin && yPos + 2 <= ymin && xPos + width >= xmax + 3 && yPos + height >= ymax + 3;
@@ -521,7 +877,7 @@ void ColourGradientField::Refresh(bool full, PixelNumber xOffset, PixelNumber yO
 
 PixelNumber FieldWithText::GetHeight() const
 {
-	PixelNumber height = UTFT::GetFontHeight(font) * textRows;
+	PixelNumber height = UTFT::GetFontHeight(defaultFont) * textRows;
 	height += (textRows - 1) * 2;		// 2px space between lines
 	if (underlined)
 	{
@@ -553,15 +909,19 @@ void FieldWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 			textWidth -= 4;
 		}
 
-		lcd.setFont(font);
+		lcd.setFont(defaultFont);
 		lcd.setColor(fcolour);
 		lcd.setBackColor(bcolour);
 
-		// Do a dummy print to get the text width. Needed for underlining and for centre- or right-aligned text.
-		lcd.setTextPos(0, 9999, textWidth);
-		PrintText();
-		const PixelNumber actualWidth = lcd.getTextX();
-		const PixelNumber underlineY = yOffset + UTFT::GetFontHeight(font) + 1;
+		if (!full && !layoutChanged && UpdateChangedText(yOffset))
+		{
+			changed = false;
+			return;
+		}
+
+		// Measure the text. Needed for underlining and for centre- or right-aligned text.
+		const PixelNumber actualWidth = MeasureText(textWidth);
+		const PixelNumber underlineY = yOffset + UTFT::GetFontHeight(defaultFont) + 1;
 		if (underlined)
 		{
 			// Remove previous underlining
@@ -614,10 +974,17 @@ void FieldWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 				}
 			}
 		}
-		changed = false;
+		changed = layoutChanged = false;
 	}
 }
 
+PixelNumber FieldWithText::MeasureText(PixelNumber maxWidth) const
+{
+	lcd.startMeasuring(maxWidth);
+	PrintText();
+	return lcd.getTextX();
+}
+
 void TextField::PrintText() const
 {
 	if (label != nullptr)
@@ -630,30 +997,101 @@ void TextField::PrintText() const
 	}
 }
 
-void FloatField::PrintText() const
+// Print the label, number and units, and record where each character of the number ends so that we can redraw its digits later.
+// This is called to measure the text as well as to draw it, so the positions recorded are those of the last call.
+void NumericField::PrintText() const
 {
 	if (label != nullptr)
 	{
 		lcd.printf("%s", label);
 	}
-	lcd.printf("%.*f", numDecimals, static_cast<double>(val));
+
+	char value[MaxFormattedChars];
+	FormatValue(value, sizeof(value));
+	valueX = lcd.getTextX();
+	lcd.setFixedDigits(fixedDigits);
+	size_t i;
+	for (i = 0; value[i] != 0; ++i)
+	{
+		lcd.write(value[i]);
+		if (i < MaxValueChars)
+		{
+			valueEnds[i] = (uint8_t)std::min<PixelNumber>(lcd.getTextX() - valueX, UINT8_MAX);
+		}
+	}
+	lcd.setFixedDigits(false);
+
+	// We can only update the number in place if its digits have a fixed width and all of it was drawn
+	if (fixedDigits && i <= MaxValueChars && lcd.getTextX() < lcd.getTextRightMargin() && lcd.getTextX() - valueX < UINT8_MAX)
+	{
+		memcpy(drawnValue, value, i + 1);
+	}
+	else
+	{
+		drawnValue[0] = 0;
+	}
+
 	if (units != nullptr)
 	{
 		lcd.printf("%s", units);
 	}
 }
 
-void IntegerField::PrintText() const
+// Measure the text with fixed width digits, or with proportional ones if it doesn't fit with fixed width digits
+PixelNumber NumericField::MeasureText(PixelNumber maxWidth) const
 {
-	if (label != nullptr)
+	fixedDigits = true;
+	const PixelNumber width = FieldWithText::MeasureText(maxWidth);
+	if (width < maxWidth)
 	{
-		lcd.printf("%s", label);
+		return width;
 	}
-	lcd.printf("%d", val);
-	if (units != nullptr)
+	fixedDigits = false;
+	return FieldWithText::MeasureText(maxWidth);
+}
+
+// If the number has the same length and punctuation as the one on the display then just redraw the digits that have changed and return true.
+// Otherwise return false so that the whole field is redrawn.
+bool NumericField::UpdateChangedText(PixelNumber textY)
+{
+	char value[MaxFormattedChars];
+	FormatValue(value, sizeof(value));
+	if (drawnValue[0] == 0 || strlen(value) != strlen(drawnValue))
 	{
-		lcd.printf("%s", units);
+		return false;
+	}
+	for (size_t i = 0; value[i] != 0; ++i)
+	{
+		if (value[i] != drawnValue[i] && (!isdigit(value[i]) || !isdigit(drawnValue[i])))
+		{
+			return false;
+		}
 	}
+
+	const PixelNumber digitWidth = lcd.getDigitWidth();
+	lcd.setFixedDigits(true);
+	for (size_t i = 0; value[i] != 0; ++i)
+	{
+		if (value[i] != drawnValue[i])
+		{
+			const PixelNumber digitX = valueX + valueEnds[i] - digitWidth;
+			lcd.setTextPos(digitX, textY, digitX + digitWidth);
+			lcd.write(value[i]);
+			drawnValue[i] = value[i];
+		}
+	}
+	lcd.setFixedDigits(false);
+	return true;
+}
+
+void FloatField::FormatValue(char * _ecv_array buf, size_t len) const
+{
+	SafeSnprintf(buf, len, "%.*f", numDecimals, static_cast<double>(val));
+}
+
+void IntegerField::FormatValue(char * _ecv_array buf, size_t len) const
+{
+	SafeSnprintf(buf, len, "%d", val);
 }
 
 void StaticTextField::PrintText() const
@@ -665,23 +1103,21 @@ void StaticTextField::PrintText() const
 }
 
 ButtonBase::ButtonBase(PixelNumber py, PixelNumber px, PixelNumber pw)
-	: DisplayField(py, px, pw),
-	  borderColour(defaultButtonBorderColour), gradColour(defaultGradColour),
-	  pressedBackColour(defaultPressedBackColour), pressedGradColour(defaultPressedGradColour), evt(nullEvent), pressed(false)
+	: DisplayField(py, px, pw), evt(nullEvent), pressed(false)
 {
 }
 
 PixelNumber ButtonBase::textMargin = 1;
 PixelNumber ButtonBase::iconMargin = 1;
 
-void ButtonBase::DrawOutline(PixelNumber xOffset, PixelNumber yOffset, bool isPressed) const
+void ButtonBase::DrawOutline(PixelNumber xOffset, PixelNumber yOffset, PixelNumber w, bool isPressed) const
 {
-	lcd.setColor((isPressed) ? pressedBackColour : bcolour);
+	lcd.setColor((isPressed) ? defaultPressedBackColour : bcolour);
 	// Note that we draw the filled rounded rectangle with the full width but 2 pixels less height than the border.
 	// This means that we start with the requested colour inside the border.
-	lcd.fillRoundRect(x + xOffset, y + yOffset + 1, x + xOffset + width - 1, y + yOffset + GetHeight() - 2, (isPressed) ? pressedGradColour : gradColour, buttonGradStep);
-	lcd.setColor(borderColour);
-	lcd.drawRoundRect(x + xOffset, y + yOffset, x + xOffset + width - 1, y + yOffset + GetHeight() - 1);
+	lcd.fillRoundRect(x + xOffset, y + yOffset + 1, x + xOffset + w - 1, y + yOffset + GetHeight() - 2, (isPressed) ? defaultPressedGradColour : defaultGradColour, buttonGradStep);
+	lcd.setColor(defaultButtonBorderColour);
+	lcd.drawRoundRect(x + xOffset, y + yOffset, x + xOffset + w - 1, y + yOffset + GetHeight() - 1);
 }
 
 void ButtonBase::CheckEvent(PixelNumber x, PixelNumber y, int& bestError, ButtonPress& best) /*override*/
@@ -713,7 +1149,7 @@ SingleButton::SingleButton(PixelNumber py, PixelNumber px, PixelNumber pw)
 
 void SingleButton::DrawOutline(PixelNumber xOffset, PixelNumber yOffset) const
 {
-	ButtonBase::DrawOutline(xOffset, yOffset, pressed);
+	ButtonBase::DrawOutline(xOffset, yOffset, width, pressed);
 }
 
 void SingleButton::Press(bool p, int index) /*override*/
@@ -748,8 +1184,8 @@ void ButtonWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset
 		PixelNumber rowY = y + yOffset + textMargin + 1;
 		do
 		{
-			lcd.setTextPos(0, 9999, width - 6);
-			PrintText(offset);							// dummy print to get text width
+			lcd.startMeasuring(width - 6);
+			PrintText(offset);							// measure the text
 			PixelNumber spare = width - 6 - lcd.getTextX();
 			lcd.setTextPos(x + xOffset + 3 + spare/2, rowY, x + xOffset + width - 3);	// text is always centre-aligned
 			offset += PrintText(offset) + 1;
@@ -834,29 +1270,29 @@ void IconButton::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 		DrawOutline(xOffset, yOffset);
 		const uint16_t sx = GetIconWidth(icon), sy = GetIconHeight(icon);
 		lcd.setTransparentBackground(true);
-		lcd.drawBitmap4(xOffset + x + (width - sx)/2, yOffset + y + iconMargin + 1, sx, sy, GetIconData(icon), defaultIconPalette);
+		lcd.drawCompressedBitmap4(xOffset + x + (width - sx)/2, yOffset + y + iconMargin + 1, sx, sy, GetIconData(icon), defaultIconPalette);
 		lcd.setTransparentBackground(false);
 		changed = false;
 	}
 }
 
 IconButtonWithText::IconButtonWithText(PixelNumber py, PixelNumber px, PixelNumber pw, Icon ic, event_t e, const char * text, int param)
-	: IconButton(py, px, pw, ic, e, param), font(DisplayField::defaultFont), text(text), val(0), printText(true), drawIcon(true)
+	: IconButton(py, px, pw, ic, e, param), text(text), val(0), printText(true), drawIcon(true)
 {
 }
 
 IconButtonWithText::IconButtonWithText(PixelNumber py, PixelNumber px, PixelNumber pw, Icon ic, event_t e, const char * text, const char * _ecv_array param)
-	: IconButton(py, px, pw, ic, e, param), font(DisplayField::defaultFont), text(text), val(0), printText(true), drawIcon(true)
+	: IconButton(py, px, pw, ic, e, param), text(text), val(0), printText(true), drawIcon(true)
 {
 }
 
 IconButtonWithText::IconButtonWithText(PixelNumber py, PixelNumber px, PixelNumber pw, Icon ic, event_t e, int textVal, int param)
-	: IconButton(py, px, pw, ic, e, param), font(DisplayField::defaultFont), text(nullptr), val(textVal), printText(true), drawIcon(true)
+	: IconButton(py, px, pw, ic, e, param), text(nullptr), val(textVal), printText(true), drawIcon(true)
 {
 }
 
 IconButtonWithText::IconButtonWithText(PixelNumber py, PixelNumber px, PixelNumber pw, Icon ic, event_t e, int textVal, const char * _ecv_array param)
-	: IconButton(py, px, pw, ic, e, param), font(DisplayField::defaultFont), text(nullptr), val(textVal), printText(true), drawIcon(true)
+	: IconButton(py, px, pw, ic, e, param), text(nullptr), val(textVal), printText(true), drawIcon(true)
 {
 }
 
@@ -885,9 +1321,9 @@ void IconButtonWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOf
 		const uint16_t	sx = GetIconWidth(icon),
 						sy = drawIcon ? GetIconHeight(icon) : 0;
 
-		lcd.setFont(font);
-		lcd.setTextPos(0, 9999, width - 6);
-		PrintText();							// dummy print to get text width
+		lcd.setFont(defaultFont);
+		lcd.startMeasuring(width - 6);
+		PrintText();							// measure the text
 		const PixelNumber textWidth = lcd.getTextX() + 6;	// add three pixels on each side
 
 		// Print the icon
@@ -895,7 +1331,7 @@ void IconButtonWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOf
 		const PixelNumber iconXOffset = xOffset + x + (width - (sx+textWidth))/2;
 		if (drawIcon)
 		{
-			lcd.drawBitmap4(iconXOffset, yOffset + y + iconMargin + 1, sx, sy, GetIconData(icon), defaultIconPalette);
+			lcd.drawCompressedBitmap4(iconXOffset, yOffset + y + iconMargin + 1, sx, sy, GetIconData(icon), defaultIconPalette);
 		}
 
 		// Print the text
@@ -938,11 +1374,49 @@ size_t FloatButton::PrintText(size_t offset) const
 }
 
 ButtonRow::ButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, event_t e)
-	: ButtonBase(py, px, pw), numButtons(nb), whichPressed(-1), step(ps)
+	: ButtonBase(py, px, (nb == 0) ? pw : (nb - 1) * ps + pw), numButtons(nb), whichPressed(-1), step(ps), buttonWidth(pw)
 {
 	evt = e;
 }
 
+void ButtonRow::CheckEvent(PixelNumber x, PixelNumber y, int& bestError, ButtonPress& best) /*override*/
+{
+	if (visible && GetEvent() != nullEvent)
+	{
+		const int yError = (y < GetMinY()) ? GetMinY() - y
+								: (y > GetMaxY()) ? y - GetMaxY()
+									: 0;
+		if (yError < maxYerror && yError < bestError)
+		{
+			PixelNumber minX = GetMinX();
+			PixelNumber maxX = minX + buttonWidth - 1;
+			for (size_t i = 0; i < numButtons; ++i)
+			{
+				const int xError = (x < minX) ? minX - x
+										: (x > maxX) ? x - maxX
+											: 0;
+				if (xError < maxXerror && xError + yError < bestError)
+				{
+					bestError = xError + yError;
+					best.Set(this, i);
+				}
+				minX += step;
+				maxX += step;
+			}
+		}
+	}
+}
+
+void ButtonRow::Press(bool p, int index) /*override*/
+{
+	const int newPressed = (p) ? index : -1;
+	if (newPressed != whichPressed)
+	{
+		whichPressed = newPressed;
+		changed = true;
+	}
+}
+
 /*static*/ LcdFont ButtonRowWithText::font;
 
 ButtonRowWithText::ButtonRowWithText(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, event_t e)
@@ -964,14 +1438,14 @@ void ButtonRowWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOff
 		for (unsigned int i = 0; i < numButtons; ++i)
 		{
 			const PixelNumber buttonXoffset = xOffset + i * step;
-			DrawOutline(buttonXoffset, yOffset, (int)i == whichPressed);
+			DrawOutline(buttonXoffset, yOffset, buttonWidth, (int)i == whichPressed);
 			lcd.setTransparentBackground(true);
 			lcd.setColor(fcolour);
 			lcd.setFont(font);
-			lcd.setTextPos(0, 9999, width - 6);
-			PrintText(i);							// dummy print to get text width
-			PixelNumber spare = width - 6 - lcd.getTextX();
-			lcd.setTextPos(x + buttonXoffset + 3 + spare/2, y + yOffset + textMargin + 1, x + buttonXoffset + width - 3);	// text is always centre-aligned
+			lcd.startMeasuring(buttonWidth - 6);
+			PrintText(i);							// measure the text
+			PixelNumber spare = buttonWidth - 6 - lcd.getTextX();
+			lcd.setTextPos(x + buttonXoffset + 3 + spare/2, y + yOffset + textMargin + 1, x + buttonXoffset + buttonWidth - 3);	// text is always centre-aligned
 			PrintText(i);
 			lcd.setTransparentBackground(false);
 		}
@@ -989,47 +1463,24 @@ CharButtonRow::CharButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, Pix
 {
 }
 
-void CharButtonRow::CheckEvent(PixelNumber x, PixelNumber y, int& bestError, ButtonPress& best) /*override*/
+void CharButtonRow::ChangeText(const char* _ecv_array s)
 {
-	if (visible && GetEvent() != nullEvent)
+	if (strcmp(text, s) == 0)
 	{
-		const int yError = (y < GetMinY()) ? GetMinY() - y
-								: (y > GetMaxY()) ? y - GetMaxY()
-									: 0;
-		if (yError < maxYerror && yError < bestError)
-		{
-			PixelNumber minX = GetMinX();
-			PixelNumber maxX = GetMaxX();
-			for (size_t i = 0; i < numButtons; ++i)
-			{
-				const int xError = (x < minX) ? minX - x
-										: (x > maxX) ? x - maxX
-											: 0;
-				if (xError < maxXerror && xError + yError < bestError)
-				{
-					bestError = xError + yError;
-					best.Set(this, i);
-				}
-				minX += step;
-				maxX += step;
-			}
-		}
+		return;
 	}
+	text = s;
+	changed = true;
 }
 
-void CharButtonRow::Press(bool p, int index) /*override*/
+void TextButtonRow::PrintText(unsigned int n) const
 {
-	whichPressed = (p) ? index : -1;
+	lcd.printf("%s", table.text[n]);
 }
 
-void CharButtonRow::ChangeText(const char* _ecv_array s)
+TextButtonRow::TextButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber spacing, const TextButtonRowTable& t)
+	: ButtonRowWithText(py, px, (pw + spacing)/t.numButtons - spacing, (pw + spacing)/t.numButtons, t.numButtons, t.evt), table(t)
 {
-	if (strcmp(text, s) == 0)
-	{
-		return;
-	}
-	text = s;
-	changed = true;
 }
 
 void ProgressBar::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
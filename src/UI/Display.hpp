@@ -17,6 +17,8 @@
 #include <cmath>
 #include <Hardware/UTFT.hpp>
 #include <UI/DisplaySize.hpp>
+#include <UI/DamageRegion.hpp>
+#include <UI/RenderStats.hpp>
 
 #ifndef UNUSED
 # define UNUSED(_x)	(void)(_x)
@@ -72,11 +74,13 @@ protected:
 	PixelNumber y, x;							// Coordinates of top left pixel, counting from the top left corner
 	PixelNumber width;							// number of pixels wide
 	Colour fcolour, bcolour;					// foreground and background colours
+	// The font, button outline colours and icon palette are the same for every field, so they are not stored in each one
 	uint16_t changed : 1,
 			visible : 1,
 			underlined : 1,						// really belongs in class FieldWithText, but stored here to save space
 			border : 1,							// really belongs in class FieldWithText, but stored here to save space
-			textRows : 2;						// really belongs in class FieldWithText, but stored here to save space
+			textRows : 2,						// really belongs in class FieldWithText, but stored here to save space
+			layoutChanged : 1;					// set when something other than the value has changed, so the field must be redrawn in full
 
 	static LcdFont defaultFont;
 	static Colour defaultFcolour, defaultBcolour;
@@ -96,6 +100,8 @@ public:
 
 	virtual bool IsButton() const { return false; }
 	virtual bool IsVisible() const { return visible; }
+	virtual bool DrawsDirect() const { return false; }		// true if the field draws to the display outside Refresh
+	virtual RenderStats::FieldKind GetKind() const { return RenderStats::FieldKind::other; }
 	void Show(bool v);
 	virtual void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) = 0;
 	void SetColours(Colour pf, Colour pb);
@@ -105,6 +111,7 @@ public:
 	PixelNumber GetMaxX() const { return x + width - 1; }
 	PixelNumber GetMinY() const { return y; }
 	PixelNumber GetMaxY() const { return y + GetHeight() - 1; }
+	bool InBand(PixelNumber yOffset, PixelNumber top, PixelNumber bottom) const;
 
 	void SetPositionAndWidth(PixelNumber newX, PixelNumber newWidth);
 	void SetPosition(PixelNumber x, PixelNumber y);
@@ -123,6 +130,7 @@ public:
 
 	static PixelNumber GetTextWidth(const char* _ecv_array s, PixelNumber maxWidth);						// find out how much width we need to print this text
 	static PixelNumber GetTextWidth(const char* _ecv_array s, PixelNumber maxWidth, size_t maxChars);	// find out how much width we need to print this text
+	static size_t GetTextFit(const char* _ecv_array s, PixelNumber maxWidth, size_t maxChars);		// find out how many bytes of this text fit in the width
 };
 
 class PopupWindow;
@@ -154,21 +162,48 @@ public:
 	bool IsPopupActive(const PopupWindow *popup);
 	bool ObscuredByPopup(const DisplayField *p) const;
 	bool Visible(const DisplayField *p) const;
+	bool HiddenByPopup(const DisplayField *p) const;
 	virtual bool Contains(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax) const = 0;
+	void RepairDamage(const DamageRegion& damage);
+	void RedrawChangedFieldsCrossingRow(PixelNumber row);
+
+protected:
+	virtual void RepairOwnDamage(const DamageRegion& damage) = 0;
+	Window * null DetachLastPopup(PopupWindow *whichOne, DamageRegion& damage);
+	void RedrawDamagedFields(const DamageRegion& damage, bool all);
+	void FillDamage(const DamageRegion& damage, const DamageRect& bounds) const;
+	void ClearOutsidePopups(const DisplayField *f) const;
 };
 
 class MainWindow : public Window
 {
 	PixelNumber staticLeftMargin;
+	bool bandRendering;
+
+	// State of a full redraw that is being done a slice at a time
+	bool refreshing;
+	bool refreshBanded;
+	PixelNumber refreshRow;					// with band rendering the first row not yet drawn, else nonzero once the background has been cleared
+	DisplayField * null refreshField;		// without band rendering, the next field to draw
 
 public:
 	MainWindow();
 	void Init(Colour pb);
 	void Refresh(bool full) override;
-	void SetRoot(DisplayField * null r) { root = r; }
+	void StartRefresh();
+	bool IsRefreshing() const { return refreshing; }
+	void SetRoot(DisplayField * null r) { root = r; if (refreshing) { StartRefresh(); } }
 	bool Contains(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax) const override;
 	void ClearAllPopups();
 	void SetLeftMargin(PixelNumber m) { staticLeftMargin = m; }
+	void SetBandRendering(bool b) { bandRendering = b; }
+
+protected:
+	void RepairOwnDamage(const DamageRegion& damage) override;
+
+private:
+	bool RefreshSlice(uint32_t maxPixels);
+	void RefreshBand(PixelNumber top, PixelNumber bottom);
 };
 
 class PopupWindow : public Window
@@ -186,8 +221,18 @@ public:
 	PixelNumber Xpos() const override { return xPos; }
 	PixelNumber Ypos() const override { return yPos; }
 	void Refresh(bool full) override;
+	void RefreshBand(PixelNumber top, PixelNumber bottom);
 	void SetPos(PixelNumber px, PixelNumber py) { xPos = px; yPos = py; }
 	bool Contains(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax) const override;
+	size_t GetOpaqueRects(DamageRect *rects) const;
+
+	static constexpr size_t MaxOpaqueRects = 3;
+
+protected:
+	void RepairOwnDamage(const DamageRegion& damage) override;
+
+private:
+	void DrawFrame();
 };
 
 class ColourGradientField : public DisplayField
@@ -204,21 +249,24 @@ public:
 	}
 
 	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override;
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::colourGradient; }
 };
 
 // Base class for fields displaying text
 class FieldWithText : public DisplayField
 {
-	LcdFont font;
 	TextAlignment align;
 
 protected:
 	PixelNumber GetHeight() const override;
 
 	virtual void PrintText() const = 0;
+	virtual PixelNumber MeasureText(PixelNumber maxWidth) const;						// return the width of the text, up to maxWidth
+	virtual bool UpdateChangedText(PixelNumber textY) { UNUSED(textY); return false; }	// redraw just the parts of the text that have changed, if possible
 
 	FieldWithText(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa, bool withBorder, bool isUnderlined = false)
-		: DisplayField(py, px, pw), font(DisplayField::defaultFont), align(pa)
+		: DisplayField(py, px, pw), align(pa)
 	{
 		underlined = isUnderlined;
 		border = withBorder;
@@ -256,23 +304,64 @@ public:
 		label = s;
 		changed = true;
 	}
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::text; }
 };
 
-// Class to display an optional label, a floating point value, and an optional units string
-class FloatField : public FieldWithText
+// Base class for fields that display an optional label, a number, and an optional units string.
+// The digits of the number are drawn with a fixed width, so when only the number changes and it has the same length and
+// punctuation as before, just the digits that are different are redrawn. If the text doesn't fit in the field with fixed width
+// digits then it is drawn with proportional ones and always redrawn in full, so that it isn't cut off where it used to fit.
+class NumericField : public FieldWithText
 {
+	static constexpr size_t MaxValueChars = 8;				// longer numbers are always redrawn in full
+	static constexpr size_t MaxFormattedChars = 32;			// the size of the buffer that numbers are formatted into
+
 	const char* _ecv_array null label;
 	const char* _ecv_array null units;
+	mutable PixelNumber valueX;								// where the number starts on the display
+	mutable uint8_t valueEnds[MaxValueChars];				// where each character of the number ends, relative to valueX
+	mutable char drawnValue[MaxValueChars + 1];				// the number as it was last drawn, or empty if it can't be updated in place
+	mutable bool fixedDigits;								// true if the digits are drawn with a fixed width
+
+protected:
+	NumericField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa,
+			const char * _ecv_array null pl, const char * _ecv_array null pu, bool withBorder)
+		: FieldWithText(py, px, pw, pa, withBorder), label(pl), units(pu), valueX(0), fixedDigits(true)
+	{
+		drawnValue[0] = 0;
+	}
+
+	virtual void FormatValue(char * _ecv_array buf, size_t len) const = 0;
+	void PrintText() const override;
+	PixelNumber MeasureText(PixelNumber maxWidth) const override;
+	bool UpdateChangedText(PixelNumber textY) override;
+
+public:
+	void SetLabel(const char* _ecv_array s)
+	{
+		if (label != nullptr && strcmp(label, s) == 0)
+		{
+			return;
+		}
+		label = s;
+		changed = layoutChanged = true;
+	}
+};
+
+// Class to display an optional label, a floating point value, and an optional units string
+class FloatField : public NumericField
+{
 	float val;
 	uint8_t numDecimals;
 
 protected:
-	void PrintText() const override;
+	void FormatValue(char * _ecv_array buf, size_t len) const override;
 
 public:
 	FloatField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa, uint8_t pd,
 			const char * _ecv_array pl = nullptr, const char * _ecv_array null pu = nullptr, bool withBorder = false)
-		: FieldWithText(py, px, pw, pa, withBorder), label(pl), units(pu), val(0.0), numDecimals(pd)
+		: NumericField(py, px, pw, pa, pl, pu, withBorder), val(0.0), numDecimals(pd)
 	{
 	}
 
@@ -298,31 +387,21 @@ public:
 		changed = true;
 	}
 
-	void SetLabel(const char* _ecv_array s)
-	{
-		if (strcmp(label, s) == 0)
-		{
-			return;
-		}
-		label = s;
-		changed = true;
-	}
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::floatValue; }
 };
 
 // Class to display an optional label, an integer value, and an optional units string
-class IntegerField : public FieldWithText
+class IntegerField : public NumericField
 {
-	const char* _ecv_array null label;
-	const char* _ecv_array null units;
 	int val;
 
 protected:
-	void PrintText() const override;
+	void FormatValue(char * _ecv_array buf, size_t len) const override;
 
 public:
 	IntegerField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa,
 					const char *pl = nullptr, const char *pu = nullptr, bool withBorder = false)
-		: FieldWithText(py, px, pw, pa, withBorder), label(pl), units(pu), val(0)
+		: NumericField(py, px, pw, pa, pl, pu, withBorder), val(0)
 	{
 	}
 
@@ -335,6 +414,8 @@ public:
 		val = v;
 		changed = true;
 	}
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::integer; }
 };
 
 // Class to display a text string only
@@ -355,7 +436,7 @@ public:
 	// Change the value
 	void SetValue(const char* _ecv_array null pt, bool forceUpdate = false)
 	{
-		if (!forceUpdate && strcmp(text, pt) == 0)
+		if (!forceUpdate && text != nullptr && pt != nullptr && strcmp(text, pt) == 0)
 		{
 			return;
 		}
@@ -363,17 +444,26 @@ public:
 		SetTextRows(pt);
 		changed = true;
 	}
+
+	// Take the value of another field whose pixels have been moved to this field's position, e.g. by scrolling the display
+	void TakeValue(const StaticTextField& other)
+	{
+		text = other.text;
+		SetTextRows(text);
+		changed = other.changed;
+	}
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::staticText; }
 };
 
 class ButtonBase : public DisplayField
 {
 protected:
-	Colour borderColour, gradColour, pressedBackColour, pressedGradColour;
 	event_t evt;								// event number that is triggered by touching this field
 	bool pressed;								// putting this here instead of in SingleButton saves 4 byes per button
 
 	ButtonBase(PixelNumber py, PixelNumber px, PixelNumber pw);
-	void DrawOutline(PixelNumber xOffset, PixelNumber yOffset, bool isPressed) const;
+	void DrawOutline(PixelNumber xOffset, PixelNumber yOffset, PixelNumber w, bool isPressed) const;
 	void CheckEvent(PixelNumber x, PixelNumber y, int& bestError, ButtonPress& best) override;
 
 	static PixelNumber textMargin;
@@ -446,18 +536,28 @@ protected:
 
 public:
 	CharButton(PixelNumber py, PixelNumber px, PixelNumber pw, char pc, event_t e);
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::charButton; }
 };
 
-// Base class for a row of related buttons with the same event
+// Base class for a row of related buttons with the same event.
+// The field covers the whole row, so that it is cleared and repaired as one; 'buttonWidth' is the width of each button.
 class ButtonRow : public ButtonBase
 {
 protected:
 	unsigned int numButtons;
 	int whichPressed;
 	PixelNumber step;
+	PixelNumber buttonWidth;
+
+	void CheckEvent(PixelNumber x, PixelNumber y, int& bestError, ButtonPress& best) override;
 
 public:
 	ButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, event_t e);
+
+	void Press(bool p, int index) override;
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::buttonRow; }
 };
 
 class ButtonRowWithText : public ButtonRow
@@ -483,15 +583,50 @@ class CharButtonRow : public ButtonRowWithText
 
 protected:
 	void PrintText(unsigned int n) const override;
-	void CheckEvent(PixelNumber x, PixelNumber y, int& bestError, ButtonPress& best) override;
 
 public:
 	CharButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, const char * _ecv_array s, event_t e);
 	int GetIParam(unsigned int index) const override { return (int)text[index]; }
-	void Press(bool p, int index) override;
 	void ChangeText(const char* _ecv_array s);
 };
 
+// Constant description of a row of text buttons, so that it can be held in flash
+struct TextButtonRowTable
+{
+	const char * _ecv_array const * _ecv_array text;			// the text on each button
+	const char * _ecv_array const * _ecv_array null sParams;	// the string parameter of each button, or null if they have integer parameters
+	const int * _ecv_array null iParams;						// the integer parameter of each button, or null to use 0, 1, 2...
+	unsigned int numButtons;
+	event_t evt;
+};
+
+// Row of text buttons described by a table, used in popups whose buttons never change.
+// The buttons are spread evenly across width 'pw' with 'spacing' between them, as CreateStringButtonRow does.
+class TextButtonRow : public ButtonRowWithText
+{
+	const TextButtonRowTable& table;
+
+protected:
+	void PrintText(unsigned int n) const override;
+
+public:
+	TextButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber spacing, const TextButtonRowTable& t);
+	const char* null GetSParam(unsigned int index) const override { return (table.sParams == nullptr) ? nullptr : table.sParams[index]; }
+	int GetIParam(unsigned int index) const override { return (table.iParams == nullptr) ? (int)index : table.iParams[index]; }
+};
+
+class TextButtonRowForAxis : public TextButtonRow
+{
+private:
+	char axisLetter;
+public:
+	TextButtonRowForAxis(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber spacing, const TextButtonRowTable& t)
+		: TextButtonRow(py, px, pw, spacing, t), axisLetter('\0') {}
+
+	char GetAxisLetter() const { return this->axisLetter; }
+	void SetAxisLetter(char axisLetter) { this->axisLetter = axisLetter; }
+};
+
 // Standard button with text
 class TextButton : public ButtonWithText
 {
@@ -524,6 +659,8 @@ public:
 		}
 		text = pt;
 	}
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::textButton; }
 };
 
 class TextButtonWithLabel : public TextButton
@@ -582,12 +719,13 @@ public:
 	IconButton(PixelNumber py, PixelNumber px, PixelNumber pw, Icon ic, event_t e, const char * _ecv_array param);
 
 	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override;
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::iconButton; }
 };
 
 // Standard button with an icon
 class IconButtonWithText : public IconButton
 {
-	LcdFont font;
 	const char * _ecv_array null text;
 	int val;
 	bool printText;
@@ -651,6 +789,8 @@ public:
 		changed = di != drawIcon;
 		drawIcon = di;
 	}
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::iconButtonWithText; }
 };
 
 // Button that displays an integer value, optionally preceded by a label and followed by units
@@ -684,6 +824,8 @@ public:
 		val += amount;
 		changed = true;
 	}
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::integerButton; }
 };
 
 // Button that displays a float value, optionally followed by units
@@ -718,6 +860,8 @@ public:
 		val += amount;
 		changed = true;
 	}
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::floatButton; }
 };
 
 class ProgressBar : public DisplayField
@@ -745,6 +889,8 @@ public:
 		percent = pc;
 		changed = true;
 	}
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::progressBar; }
 };
 
 class StaticImageField: public DisplayField
@@ -761,6 +907,8 @@ public:
 	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override;
 
 	PixelNumber GetHeight() const override { return height; }
+
+	RenderStats::FieldKind GetKind() const override { return RenderStats::FieldKind::staticImage; }
 };
 
 #include "qoi.h"
@@ -782,6 +930,7 @@ public:
 
 	PixelNumber GetHeight() const { return height; }
 	PixelNumber GetWidth() const { return width; }
+	bool DrawsDirect() const override { return true; }
 
 	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override;
 
@@ -60,15 +60,15 @@ namespace MessageLog
 		return logLevel;
 	}
 	
-	// Update the messages on the message tab. If 'all' is true we do the times and the text, else we just do the times.
-	void UpdateMessages(bool all)
+	// Update the message rows from 'firstRow' onwards. If 'all' is true we do the times and the text, else we just do the times that have changed.
+	static void UpdateRows(size_t firstRow, bool all)
 	{
-		size_t index = messageStartRow;
-		for (size_t i = 0; i < numMessageRows; ++i)
+		size_t index = (messageStartRow + firstRow) % numMessageRows;
+		for (size_t i = firstRow; i < numMessageRows; ++i)
 		{
 			Message *m = &messages[index];
 			uint32_t tim = m->receivedTime;
-			char* p = m->receivedTimeText;
+			char p[Message::rttLen];
 			if (tim == 0)
 			{
 				p[0] = 0;
@@ -109,7 +109,11 @@ namespace MessageLog
 					}
 				}
 			}
-			messageTimeFields[i]->SetValue(p, true);
+			if (all || strcmp(p, m->receivedTimeText) != 0)
+			{
+				SafeStrncpy(m->receivedTimeText, p, Message::rttLen);
+				messageTimeFields[i]->SetValue(m->receivedTimeText, true);
+			}
 
 			if (all)
 			{
@@ -119,6 +123,39 @@ namespace MessageLog
 		}
 	}
 
+	// Update the messages on the message tab. If 'all' is true we do the times and the text, else we just do the times.
+	void UpdateMessages(bool all)
+	{
+		UpdateRows(0, all);
+	}
+
+	// Show the log after 'numLines' new rows have been added at the bottom.
+	// If the display can scroll the rows that are still shown then the fields above the new rows take over the values of the fields
+	// whose pixels have moved into their place, and only the new rows need to be drawn. Otherwise all the rows are redrawn.
+	static void ScrollMessages(unsigned int numLines)
+	{
+		if (numLines < numMessageRows && UI::ScrollMessageRows(numLines))
+		{
+			const size_t numKept = numMessageRows - numLines;
+			for (size_t i = 0; i < numKept; ++i)
+			{
+				messageTimeFields[i]->TakeValue(*messageTimeFields[i + numLines]);
+				messageTextFields[i]->TakeValue(*messageTextFields[i + numLines]);
+			}
+			UpdateRows(numKept, true);
+			for (size_t i = numKept; i < numMessageRows; ++i)
+			{
+				// These rows show what scrolled off the top, so they must be redrawn even if the new text is the same as the old
+				messageTimeFields[i]->SetChanged();
+				messageTextFields[i]->SetChanged();
+			}
+		}
+		else
+		{
+			UpdateMessages(true);
+		}
+	}
+
 	// Add a message to the end of the list
 	// Call this only with a non empty message having no leading whitespace
 	void AppendMessage(LogLevel level, const char* _ecv_array data)
@@ -163,7 +200,7 @@ namespace MessageLog
 		} while (split && data[0] != '\0');
 
 		messageStartRow = (messageStartRow + numLines) % numMessageRows;
-		UpdateMessages(true);
+		ScrollMessages(numLines);
 	}
 
 	void AppendMessageF(LogLevel level, const char* fmt, ...)
@@ -216,23 +253,9 @@ namespace MessageLog
 	{
 		const size_t remLength = strlen(s);
 		maxChars = min<size_t>(maxChars, MaxCharsPerRow);
-		if (remLength > maxChars || DisplayField::GetTextWidth(s, width + 1) > width)
+		const size_t low = DisplayField::GetTextFit(s, width, maxChars);
+		if (low < remLength)
 		{
-			// We need to split the line, so find out where
-			size_t low = 0, high = min<size_t>(remLength, maxChars + 1);
-			while (low + 1 < high)
-			{
-				const size_t mid = (low + high)/2;
-				if (DisplayField::GetTextWidth(s, messageTextWidth + 1, mid) <= messageTextWidth)
-				{
-					low = mid;
-				}
-				else
-				{
-					high = mid;
-				}
-			}
-				
 			// The first 'low' characters fit, but no more.
 			// Look for a space or other character where we can split the line neatly
 			size_t splitPoint = low;
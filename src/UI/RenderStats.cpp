@@ -0,0 +1,183 @@
+/*
+ * RenderStats.cpp
+ *
+ *  Created on: 18 Oct 2026
+ */
+
+#include "RenderStats.hpp"
+#include <cstring>
+#include <algorithm>
+#include "asf.h"
+#include <Hardware/UTFT.hpp>
+#include <UI/MessageLog.hpp>
+
+extern UTFT lcd;
+
+namespace RenderStats
+{
+	constexpr size_t NumKindsShown = 4;			// the number of field kinds that ShowSummary lists
+
+	const char * const kindNames[] =
+	{
+		"other", "gradient", "text", "float", "integer", "static text", "char button", "text button",
+		"int button", "float button", "button row", "icon button", "icon+text button", "progress bar", "image"
+	};
+	static_assert(sizeof(kindNames)/sizeof(kindNames[0]) == (size_t)FieldKind::numKinds, "kindNames doesn't match FieldKind");
+
+	struct KindStats
+	{
+		uint32_t count;				// number of refreshes
+		uint32_t micros;			// total time taken
+		uint32_t maxMicros;			// time taken by the slowest refresh
+		uint32_t windows;			// total number of address windows set up
+		uint32_t pixels;			// total number of pixels written
+	};
+
+	struct FrameStats
+	{
+		uint32_t micros;
+		uint32_t windows;
+		uint32_t pixels;
+		uint16_t numFields;			// the number of fields that were redrawn
+		FieldKind slowestKind;		// the field that took longest to redraw, if numFields is not zero
+		PixelNumber slowestX, slowestY;
+		uint32_t slowestMicros;
+	};
+
+	static KindStats kinds[(size_t)FieldKind::numKinds];
+	static uint32_t numFrames = 0;
+	static uint32_t numDrawingFrames = 0;		// the number of frames in which at least one field was redrawn
+	static FrameStats worstFrame;
+
+	static uint32_t cyclesPerMicro = 1;
+
+	// State of the frame and field that we are currently timing
+	static bool inFrame = false;
+	static FrameStats currentFrame;
+	static uint32_t frameStartCycles, fieldStartCycles;
+	static UTFT::BusStats frameStartBus, fieldStartBus;
+
+	static uint32_t MicrosSince(uint32_t startCycles)
+	{
+		return (DWT->CYCCNT - startCycles)/cyclesPerMicro;
+	}
+
+	void Init()
+	{
+		CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+		DWT->CYCCNT = 0;
+		DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+		cyclesPerMicro = SystemCoreClock/1000000;
+		Reset();
+	}
+
+	void BeginFrame()
+	{
+		memset(&currentFrame, 0, sizeof(currentFrame));
+		frameStartBus = lcd.getBusStats();
+		frameStartCycles = DWT->CYCCNT;
+		inFrame = true;
+	}
+
+	void EndFrame()
+	{
+		inFrame = false;
+		currentFrame.micros = MicrosSince(frameStartCycles);
+		const UTFT::BusStats& bus = lcd.getBusStats();
+		currentFrame.windows = bus.windows - frameStartBus.windows;
+		currentFrame.pixels = bus.pixels - frameStartBus.pixels;
+		++numFrames;
+		if (currentFrame.numFields != 0)
+		{
+			++numDrawingFrames;
+		}
+		if (currentFrame.micros > worstFrame.micros)
+		{
+			worstFrame = currentFrame;
+		}
+	}
+
+	void BeginField()
+	{
+		fieldStartBus = lcd.getBusStats();
+		fieldStartCycles = DWT->CYCCNT;
+	}
+
+	void EndField(FieldKind kind, PixelNumber x, PixelNumber y)
+	{
+		const uint32_t micros = MicrosSince(fieldStartCycles);
+		const UTFT::BusStats& bus = lcd.getBusStats();
+		const uint32_t windows = bus.windows - fieldStartBus.windows;
+		const uint32_t pixels = bus.pixels - fieldStartBus.pixels;
+		if (windows == 0 && pixels == 0)
+		{
+			return;						// the field didn't draw anything
+		}
+
+		KindStats& stats = kinds[(size_t)kind];
+		++stats.count;
+		stats.micros += micros;
+		stats.maxMicros = std::max<uint32_t>(stats.maxMicros, micros);
+		stats.windows += windows;
+		stats.pixels += pixels;
+
+		if (inFrame)
+		{
+			if (currentFrame.numFields == 0 || micros > currentFrame.slowestMicros)
+			{
+				currentFrame.slowestKind = kind;
+				currentFrame.slowestX = x;
+				currentFrame.slowestY = y;
+				currentFrame.slowestMicros = micros;
+			}
+			++currentFrame.numFields;
+		}
+	}
+
+	void Reset()
+	{
+		memset(kinds, 0, sizeof(kinds));
+		memset(&worstFrame, 0, sizeof(worstFrame));
+		numFrames = numDrawingFrames = 0;
+	}
+
+	uint32_t GetWorstFrameMillis()
+	{
+		return worstFrame.micros/1000;
+	}
+
+	void ShowSummary()
+	{
+		MessageLog::AppendMessageF(MessageLog::LogLevel::Normal, "Refresh: %lu frames, %lu drew, worst %luus", numFrames, numDrawingFrames, worstFrame.micros);
+		if (worstFrame.numFields != 0)
+		{
+			MessageLog::AppendMessageF(MessageLog::LogLevel::Normal, "Worst: %u fields %lu win %lu px, %s at %u,%u %luus",
+				worstFrame.numFields, worstFrame.windows, worstFrame.pixels,
+				kindNames[(size_t)worstFrame.slowestKind], worstFrame.slowestX, worstFrame.slowestY, worstFrame.slowestMicros);
+		}
+
+		// List the kinds of field that took the most time in total, slowest first
+		bool shown[(size_t)FieldKind::numKinds] = { false };
+		for (size_t n = 0; n < NumKindsShown; ++n)
+		{
+			size_t worst = (size_t)FieldKind::numKinds;
+			for (size_t i = 0; i < (size_t)FieldKind::numKinds; ++i)
+			{
+				if (!shown[i] && kinds[i].count != 0 && (worst == (size_t)FieldKind::numKinds || kinds[i].micros > kinds[worst].micros))
+				{
+					worst = i;
+				}
+			}
+			if (worst == (size_t)FieldKind::numKinds)
+			{
+				break;
+			}
+			shown[worst] = true;
+			const KindStats& stats = kinds[worst];
+			MessageLog::AppendMessageF(MessageLog::LogLevel::Normal, "%s: n%lu %lums max %luus, %lu win %lu px",
+				kindNames[worst], stats.count, stats.micros/1000, stats.maxMicros, stats.windows, stats.pixels);
+		}
+	}
+}
+
+// End
@@ -0,0 +1,59 @@
+/*
+ * RenderStats.hpp
+ *
+ *  Created on: 18 Oct 2026
+ *
+ * Statistics on the cost of refreshing the display: the time and bus activity taken by each kind of field,
+ * and the slowest refresh made by the main loop. The bus activity comes from the UTFT counters, so UTFT_BUS_STATS must be nonzero.
+ */
+
+#ifndef SRC_UI_RENDERSTATS_HPP_
+#define SRC_UI_RENDERSTATS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <UI/DisplaySize.hpp>
+
+namespace RenderStats
+{
+	enum class FieldKind : uint8_t
+	{
+		other,
+		colourGradient,
+		text,
+		floatValue,
+		integer,
+		staticText,
+		charButton,
+		textButton,
+		integerButton,
+		floatButton,
+		buttonRow,
+		iconButton,
+		iconButtonWithText,
+		progressBar,
+		staticImage,
+		numKinds
+	};
+
+	// Start the cycle counter that we use for timing. Call this once during initialisation.
+	void Init();
+
+	// Bracket the refresh of the display by the main loop
+	void BeginFrame();
+	void EndFrame();
+
+	// Bracket the refresh of a field. Refreshes that don't draw anything are not counted.
+	void BeginField();
+	void EndField(FieldKind kind, PixelNumber x, PixelNumber y);
+
+	void Reset();
+
+	// Return the time taken by the slowest main loop refresh since the last reset, in milliseconds
+	uint32_t GetWorstFrameMillis();
+
+	// Append the slowest main loop refresh and the kinds of field that took longest to refresh to the message log
+	void ShowSummary();
+}
+
+#endif /* SRC_UI_RENDERSTATS_HPP_ */
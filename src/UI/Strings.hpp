@@ -1499,7 +1499,7 @@ const StringTable LanguageTables[] =
 		"value is out of range: %ld <= value <= %ld",
 		"value is out of range: %f <= value <= %f",
 		"text length is out of range: %ld <= length <= %ld",
-	}
+	},
 #endif
 #if USE_JAPANESE_CHARACTERS
 	//Japanese
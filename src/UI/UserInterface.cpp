@@ -14,7 +14,7 @@
 #include "FlashData.hpp"
 
 #include "Hardware/Buzzer.hpp"
-#include "Hardware/Reset.hpp"
+#include "Hardware/Mem.hpp"
 #include "Hardware/SerialIo.hpp"
 #include "Hardware/SysTick.hpp"
 
@@ -44,7 +44,7 @@ MainWindow mgr;
 
 // Public fields
 TextField *fwVersionField, *userCommandField, *ipAddressField;
-IntegerField *freeMem;
+IntegerField *freeMem, *slowestRefresh;
 StaticTextField *touchCalibInstruction, *debugField;
 StaticTextField *messageTextFields[numMessageRows], *messageTimeFields[numMessageRows];
 
@@ -82,6 +82,8 @@ static PopupWindow *setTempPopup, *setRPMPopup, *movePopup, *extrudePopup, *file
 		*volumePopup, *infoTimeoutPopup, *screensaverTimeoutPopup, *babystepAmountPopup, *feedrateAmountPopup, *areYouSurePopup, *keyboardPopup, *languagePopup, *coloursPopup, *screensaverPopup, *firmwareUpdatePopup;
 static StaticTextField *areYouSureTextField, *areYouSureQueryField;
 static DisplayField *emptyRoot, *baseRoot, *commonRoot, *controlRoot, *printRoot, *messageRoot, *setupRoot;
+static void *fieldsStart = nullptr, *fieldsEnd = nullptr;		// the memory that CreateFields used, so that RecreateFields can use it again
+const uint32_t RecreateFieldsReserve = 2048;					// memory left free for the stack when RecreateFields tries the new fields above the heap
 static SingleButton *homeAllButton, *bedCompButton;
 static IconButtonWithText *homeButtons[MaxDisplayableAxes], *toolButtons[MaxSlots];
 
@@ -261,42 +263,18 @@ IconButtonWithText *AddIconButtonWithText(PixelNumber row, unsigned int col, uns
 	return f;
 }
 
-// Create a row of text buttons.
+// Create a row of text buttons described by a table.
 // Optionally, set one to 'pressed' and return that one.
 // Set the colours before calling this
-ButtonPress CreateStringButtonRow(
-		Window * parentWindow,
-		PixelNumber top,
-		PixelNumber left,
-		PixelNumber totalWidth,
-		PixelNumber spacing,
-		unsigned int numButtons,
-		const char* _ecv_array const text[],
-		const char* _ecv_array const params[],
-		Event evt,
-		int selected = -1,
-		bool textButtonForAxis = false,
-		DisplayField** firstButton = nullptr)
+ButtonPress CreateStringButtonRow(Window * parentWindow, PixelNumber top, PixelNumber left, PixelNumber totalWidth, PixelNumber spacing, const TextButtonRowTable& table, int selected = -1)
 {
-	const PixelNumber step = (totalWidth + spacing)/numButtons;
+	TextButtonRow * const row = new TextButtonRow(top, left, totalWidth, spacing, table);
+	parentWindow->AddField(row);
 	ButtonPress bp;
-	// Since Window->AddField prepends fields in the linked list we start with the last element
-	for (int i = numButtons - 1; i >= 0; --i)
+	if (selected >= 0)
 	{
-		TextButton *tp =
-				textButtonForAxis
-				? new TextButtonForAxis(top, left + i * step, step - spacing, text[i], evt, params[i])
-				: new TextButton(		top, left + i * step, step - spacing, text[i], evt, params[i]);
-		parentWindow->AddField(tp);
-		if ((int)i == selected)
-		{
-			tp->Press(true, 0);
-			bp = ButtonPress(tp, 0);
-		}
-		if (firstButton != nullptr && i == 0)
-		{
-			*firstButton = tp;
-		}
+		row->Press(true, selected);
+		bp = ButtonPress(row, selected);
 	}
 	return bp;
 }
@@ -315,6 +293,15 @@ void CreateIconButtonRow(Window * pf, PixelNumber top, PixelNumber left, PixelNu
 }
 #endif
 
+// Create a popup bar whose buttons are described by a table
+PopupWindow *CreatePopupBar(const ColourScheme& colours, PixelNumber width, const TextButtonRowTable& table)
+{
+	PopupWindow *pf = new PopupWindow(popupBarHeight, width, colours.popupBackColour, colours.popupBorderColour);
+	DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
+	pf->AddField(new TextButtonRow(popupSideMargin, popupSideMargin, width - 2 * popupSideMargin, popupFieldSpacing, table));
+	return pf;
+}
+
 // Create a popup bar with string parameters
 PopupWindow *CreateStringPopupBar(const ColourScheme& colours, PixelNumber width, unsigned int numEntries, const char* const text[], const char* const params[], Event ev)
 {
@@ -449,7 +436,7 @@ static void PopupAreYouSure(Event ev, const char* text, const char* query = stri
 static void CreateIntegerAdjustPopup(const ColourScheme& colours)
 {
 	// Create the popup window used to adjust temperatures, fan speed, extrusion factor etc.
-	static const char* const tempPopupText[] = {"-5", "-1", strings->set, "+1", "+5"};
+	const char* const tempPopupText[] = {"-5", "-1", strings->set, "+1", "+5"};				// not static because the language can change
 	static const int tempPopupParams[] = { -5, -1, 0, 1, 5 };
 	setTempPopup = CreateIntPopupBar(colours, tempPopupBarWidth, 5, tempPopupText, tempPopupParams, evAdjustInt, evSetInt);
 }
@@ -457,7 +444,7 @@ static void CreateIntegerAdjustPopup(const ColourScheme& colours)
 static void CreateIntegerRPMAdjustPopup(const ColourScheme& colours)
 {
 	// Create the popup window used to adjust temperatures, fan speed, extrusion factor etc.
-	static const char* const rpmPopupText[] = {"-1000", "-100", "-10", strings->set, "+10", "+100", "+1000"};
+	const char* const rpmPopupText[] = {"-1000", "-100", "-10", strings->set, "+10", "+100", "+1000"};	// not static because the language can change
 	static const int rpmPopupParams[] = { -1000, -100, -10, 0, 10, 100, 1000 };
 	setRPMPopup = CreateIntPopupBar(colours, rpmPopupBarWidth, 7, rpmPopupText, rpmPopupParams, evAdjustInt, evSetInt);
 }
@@ -465,8 +452,10 @@ static void CreateIntegerRPMAdjustPopup(const ColourScheme& colours)
 // Create the movement popup window
 static void CreateMovePopup(const ColourScheme& colours)
 {
-	static const char * _ecv_array const xyJogValues[] = { "-100", "-10", "-1", "-0.1", "0.1",  "1", "10", "100" };
-	static const char * _ecv_array const zJogValues[] = { "-50", "-5", "-0.5", "-0.05", "0.05",  "0.5", "5", "50" };
+	static constexpr const char * _ecv_array xyJogValues[] = { "-100", "-10", "-1", "-0.1", "0.1",  "1", "10", "100" };
+	static constexpr const char * _ecv_array zJogValues[] = { "-50", "-5", "-0.5", "-0.05", "0.05",  "0.5", "5", "50" };
+	static constexpr TextButtonRowTable xyJogRow = { xyJogValues, xyJogValues, nullptr, ARRAY_SIZE(xyJogValues), evMoveAxis };
+	static constexpr TextButtonRowTable zJogRow = { zJogValues, zJogValues, nullptr, ARRAY_SIZE(zJogValues), evMoveAxis };
 
 	movePopup = new StandardPopupWindow(movePopupHeight, movePopupWidth, colours.popupBackColour, colours.popupBorderColour, colours.popupTextColour, colours.buttonImageBackColour, strings->moveHead);
 	PixelNumber ypos = popupTopMargin + buttonHeight + moveButtonRowSpacing;
@@ -478,10 +467,9 @@ static void CreateMovePopup(const ColourScheme& colours)
 	for (size_t i = 0; i < MaxDisplayableAxes; ++i)
 	{
 		DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
-		const char * _ecv_array const * _ecv_array values = (axisNames[i][0] == 'Z') ? zJogValues : xyJogValues;
-		CreateStringButtonRow(movePopup, ypos, xpos, movePopupWidth - xpos - popupSideMargin, fieldSpacing, 8, values, values, evMoveAxis, -1, true);
+		movePopup->AddField(new TextButtonRowForAxis(ypos, xpos, movePopupWidth - xpos - popupSideMargin, fieldSpacing, (axisNames[i][0] == 'Z') ? zJogRow : xyJogRow));
 
-		// We create the label after the button row, so that the buttons follow it in the field order, which makes it easier to hide them
+		// We create the label after the button row, so that the row follows it in the field order, which makes it easier to hide them
 		DisplayField::SetDefaultColours(colours.popupTextColour, colours.popupBackColour);
 		StaticTextField * const tf = new StaticTextField(ypos + labelRowAdjust, popupSideMargin, axisLabelWidth, TextAlignment::Left, axisNames[i]);
 		movePopup->AddField(tf);
@@ -502,76 +490,81 @@ static void CreateMovePopup(const ColourScheme& colours)
 // Create the extrusion controls popup
 static void CreateExtrudePopup(const ColourScheme& colours)
 {
-	static const char * _ecv_array extrudeAmountValues[] = { "100", "50", "20", "10", "5",  "1" };
-	static const char * _ecv_array extrudeSpeedValues[] = { "50", "20", "10", "5", "2", "1", "0.5" };
-	static const char * _ecv_array extrudeSpeedParams[] = { "3000", "1200", "600", "300", "120", "60", "30" };		// must be extrudeSpeedValues * 60
+	static constexpr const char * _ecv_array extrudeAmountValues[] = { "100", "50", "20", "10", "5",  "1" };
+	static constexpr const char * _ecv_array extrudeSpeedValues[] = { "50", "20", "10", "5", "2", "1", "0.5" };
+	static constexpr const char * _ecv_array extrudeSpeedParams[] = { "3000", "1200", "600", "300", "120", "60", "30" };		// must be extrudeSpeedValues * 60
+	static_assert(ARRAY_SIZE(extrudeSpeedParams) == ARRAY_SIZE(extrudeSpeedValues));
+	static constexpr TextButtonRowTable extrudeAmountRow = { extrudeAmountValues, extrudeAmountValues, nullptr, ARRAY_SIZE(extrudeAmountValues), evExtrudeAmount };
+	static constexpr TextButtonRowTable extrudeSpeedRow = { extrudeSpeedValues, extrudeSpeedParams, nullptr, ARRAY_SIZE(extrudeSpeedValues), evExtrudeRate };
 
 	extrudePopup = new StandardPopupWindow(extrudePopupHeight, extrudePopupWidth, colours.popupBackColour, colours.popupBorderColour, colours.popupTextColour, colours.buttonImageBackColour, strings->extrusionAmount);
 	PixelNumber ypos = popupTopMargin + buttonHeight + extrudeButtonRowSpacing;
 	DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
-	currentExtrudeAmountPress = CreateStringButtonRow(extrudePopup, ypos, popupSideMargin, extrudePopupWidth - 2 * popupSideMargin, fieldSpacing, 6, extrudeAmountValues, extrudeAmountValues, evExtrudeAmount, 3);
+	currentExtrudeAmountPress = CreateStringButtonRow(extrudePopup, ypos, popupSideMargin, extrudePopupWidth - 2 * popupSideMargin, fieldSpacing, extrudeAmountRow, 3);
 	ypos += buttonHeight + extrudeButtonRowSpacing;
 	DisplayField::SetDefaultColours(colours.popupTextColour, colours.popupBackColour);
 	extrudePopup->AddField(new StaticTextField(ypos + labelRowAdjust, popupSideMargin, extrudePopupWidth - 2 * popupSideMargin, TextAlignment::Centre, strings->extrusionSpeed));
 	ypos += buttonHeight + extrudeButtonRowSpacing;
 	DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
-	currentExtrudeRatePress = CreateStringButtonRow(
-			extrudePopup,
-			ypos,
-			popupSideMargin,
-			extrudePopupWidth - 2 * popupSideMargin,
-			fieldSpacing,
-			ARRAY_SIZE(extrudeSpeedValues),
-			extrudeSpeedValues,
-			extrudeSpeedParams,
-			evExtrudeRate,
-			ARRAY_SIZE(extrudeSpeedValues) / 2);
+	currentExtrudeRatePress = CreateStringButtonRow(extrudePopup, ypos, popupSideMargin, extrudePopupWidth - 2 * popupSideMargin, fieldSpacing, extrudeSpeedRow, ARRAY_SIZE(extrudeSpeedValues) / 2);
 
 	ypos += buttonHeight + extrudeButtonRowSpacing;
 	extrudePopup->AddField(new TextButton(ypos, popupSideMargin, extrudePopupWidth/3 - 2 * popupSideMargin, strings->extrude, evExtrude));
 	extrudePopup->AddField(new TextButton(ypos, (2 * extrudePopupWidth)/3 + popupSideMargin, extrudePopupWidth/3 - 2 * popupSideMargin, strings->retract, evRetract));
 }
 
+// The positions of the fields along the top of a file list popup, which depend only on the width of the popup
+struct FileListLayout
+{
+	PixelNumber closeButtonPos, navButtonWidth, upButtonPos, rightButtonPos, leftButtonPos, textPos, changeButtonPos;
+
+	constexpr FileListLayout(PixelNumber popupWidth)
+		: closeButtonPos(popupWidth - closeButtonWidth - popupSideMargin),
+		  navButtonWidth((closeButtonPos - popupSideMargin)/7),
+		  upButtonPos(closeButtonPos - navButtonWidth - fieldSpacing),
+		  rightButtonPos(upButtonPos - navButtonWidth - fieldSpacing),
+		  leftButtonPos(rightButtonPos - navButtonWidth - fieldSpacing),
+		  textPos(popupSideMargin + navButtonWidth),
+		  changeButtonPos(popupSideMargin)
+	{
+	}
+};
+
 // Create a popup used to list files pr macros
-PopupWindow *CreateFileListPopup(FileListButtons& controlButtons, TextButton ** _ecv_array fileButtons, unsigned int numRows, unsigned int numCols, const ColourScheme& colours, bool filesNotMacros,
-		PixelNumber popupHeight = fileListPopupHeight, PixelNumber popupWidth = fileListPopupWidth)
+PopupWindow *CreateFileListPopup(FileListButtons& controlButtons, TextButton ** _ecv_array fileButtons, unsigned int numRows, unsigned int numCols, const ColourScheme& colours, bool filesNotMacros)
 pre(fileButtons.lim == numRows * numCols)
 {
+	static constexpr PixelNumber popupHeight = fileListPopupHeight, popupWidth = fileListPopupWidth;
+	static constexpr FileListLayout layout(popupWidth);
+
 	PopupWindow * const popup = new StandardPopupWindow(popupHeight, popupWidth, colours.popupBackColour, colours.popupBorderColour, colours.popupTextColour, colours.buttonImageBackColour, nullptr);
-	const PixelNumber closeButtonPos = popupWidth - closeButtonWidth - popupSideMargin;
-	const PixelNumber navButtonWidth = (closeButtonPos - popupSideMargin)/7;
-	const PixelNumber upButtonPos = closeButtonPos - navButtonWidth - fieldSpacing;
-	const PixelNumber rightButtonPos = upButtonPos - navButtonWidth - fieldSpacing;
-	const PixelNumber leftButtonPos = rightButtonPos - navButtonWidth - fieldSpacing;
-	const PixelNumber textPos = popupSideMargin + navButtonWidth;
-	const PixelNumber changeButtonPos = popupSideMargin;
 
 	DisplayField::SetDefaultColours(colours.popupTextColour, colours.popupBackColour);
 	if (filesNotMacros)
 	{
-		popup->AddField(filePopupTitleField = new IntegerField(popupTopMargin + labelRowAdjust, textPos, leftButtonPos - textPos, TextAlignment::Centre, strings->filesOnCard, nullptr));
+		popup->AddField(filePopupTitleField = new IntegerField(popupTopMargin + labelRowAdjust, layout.textPos, layout.leftButtonPos - layout.textPos, TextAlignment::Centre, strings->filesOnCard, nullptr));
 		popup->AddField(fileListPopupNoFiles = new StaticTextField(popupHeight / 2 - popupTopMargin, popupSideMargin, popupWidth, TextAlignment::Centre, strings->noFilesFound));
 		fileListPopupNoFiles->Show(false);
 	}
 	else
 	{
-		popup->AddField(new StaticTextField(popupTopMargin + labelRowAdjust, textPos, leftButtonPos - textPos, TextAlignment::Centre, strings->macros));
+		popup->AddField(new StaticTextField(popupTopMargin + labelRowAdjust, layout.textPos, layout.leftButtonPos - layout.textPos, TextAlignment::Centre, strings->macros));
 	}
 
 	DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.buttonImageBackColour);
 	if (filesNotMacros)
 	{
-		popup->AddField(changeCardButton = new IconButton(popupTopMargin, changeButtonPos, navButtonWidth, IconFiles, evChangeCard, 0));
+		popup->AddField(changeCardButton = new IconButton(popupTopMargin, layout.changeButtonPos, layout.navButtonWidth, IconFiles, evChangeCard, 0));
 	}
 
 	const Event scrollEvent = (filesNotMacros) ? evScrollFiles : evScrollMacros;
 
 	DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
-	popup->AddField(controlButtons.scrollLeftButton = new TextButton(popupTopMargin, leftButtonPos, navButtonWidth, LEFT_ARROW, scrollEvent, -1));
+	popup->AddField(controlButtons.scrollLeftButton = new TextButton(popupTopMargin, layout.leftButtonPos, layout.navButtonWidth, LEFT_ARROW, scrollEvent, -1));
 	controlButtons.scrollLeftButton->Show(false);
-	popup->AddField(controlButtons.scrollRightButton = new TextButton(popupTopMargin, rightButtonPos, navButtonWidth, RIGHT_ARROW, scrollEvent, 1));
+	popup->AddField(controlButtons.scrollRightButton = new TextButton(popupTopMargin, layout.rightButtonPos, layout.navButtonWidth, RIGHT_ARROW, scrollEvent, 1));
 	controlButtons.scrollRightButton->Show(false);
-	popup->AddField(controlButtons.folderUpButton = new TextButton(popupTopMargin, upButtonPos, navButtonWidth, UP_ARROW, (filesNotMacros) ? evFilesUp : evMacrosUp));
+	popup->AddField(controlButtons.folderUpButton = new TextButton(popupTopMargin, layout.upButtonPos, layout.navButtonWidth, UP_ARROW, (filesNotMacros) ? evFilesUp : evMacrosUp));
 	controlButtons.folderUpButton->Show(false);
 
 	const PixelNumber fileFieldWidth = (popupWidth + fieldSpacing - (2 * popupSideMargin))/numCols;
@@ -697,48 +690,53 @@ static void CreateFirmwareUpdatePopup()
 // Create the baud rate adjustment popup
 static void CreateBaudRatePopup(const ColourScheme& colours)
 {
-	static const char* const baudPopupText[] = { "9600", "19200", "38400", "57600", "115200" };
-	static const int baudPopupParams[] = { 9600, 19200, 38400, 57600, 115200 };
-	baudPopup = CreateIntPopupBar(colours, fullPopupWidth, 5, baudPopupText, baudPopupParams, evAdjustBaudRate, evAdjustBaudRate);
+	static constexpr const char* baudPopupText[] = { "9600", "19200", "38400", "57600", "115200" };
+	static_assert(ARRAY_SIZE(baudPopupText) == ARRAY_SIZE(BaudRates));
+	static constexpr TextButtonRowTable baudRow = { baudPopupText, nullptr, BaudRates, ARRAY_SIZE(BaudRates), evAdjustBaudRate };
+	baudPopup = CreatePopupBar(colours, fullPopupWidth, baudRow);
 }
 
 // Create the volume adjustment popup
 static void CreateVolumePopup(const ColourScheme& colours)
 {
 	static_assert(Buzzer::MaxVolume == 5, "MaxVolume assumed to be 5 here");
-	static const char* const volumePopupText[Buzzer::MaxVolume + 1] = { "0", "1", "2", "3", "4", "5" };
-	volumePopup = CreateIntPopupBar(colours, fullPopupWidth, ARRAY_SIZE(volumePopupText), volumePopupText, nullptr, evAdjustVolume, evAdjustVolume);
+	static constexpr const char* volumePopupText[Buzzer::MaxVolume + 1] = { "0", "1", "2", "3", "4", "5" };
+	static constexpr TextButtonRowTable volumeRow = { volumePopupText, nullptr, nullptr, ARRAY_SIZE(volumePopupText), evAdjustVolume };
+	volumePopup = CreatePopupBar(colours, fullPopupWidth, volumeRow);
 }
 
 // Create the volume adjustment popup
 static void CreateInfoTimeoutPopup(const ColourScheme& colours)
 {
-	static const char* const infoTimeoutPopupText[Buzzer::MaxVolume + 1] = { "0", "2", "5", "10" };
-	static const int values[] = { 0, 2, 5, 10 };
-	infoTimeoutPopup = CreateIntPopupBar(colours, fullPopupWidth, ARRAY_SIZE(infoTimeoutPopupText), infoTimeoutPopupText, values, evAdjustInfoTimeout, evAdjustInfoTimeout);
+	static constexpr const char* infoTimeoutPopupText[] = { "0", "2", "5", "10" };
+	static constexpr int values[] = { 0, 2, 5, 10 };
+	static constexpr TextButtonRowTable infoTimeoutRow = { infoTimeoutPopupText, nullptr, values, ARRAY_SIZE(infoTimeoutPopupText), evAdjustInfoTimeout };
+	infoTimeoutPopup = CreatePopupBar(colours, fullPopupWidth, infoTimeoutRow);
 }
 
 // Create the screensaver timeout adjustment popup
 static void CreateScreensaverTimeoutPopup(const ColourScheme& colours)
 {
-	static const char* const screensaverTimeoutPopupText[Buzzer::MaxVolume + 1] = { "off", "60", "120", "180", "240", "300" };
-	static const int values[] = { 0, 60, 120, 180, 240, 300 };
-	screensaverTimeoutPopup = CreateIntPopupBar(colours, fullPopupWidth, ARRAY_SIZE(screensaverTimeoutPopupText), screensaverTimeoutPopupText, values, evAdjustScreensaverTimeout, evAdjustScreensaverTimeout);
+	static constexpr const char* screensaverTimeoutPopupText[] = { "off", "60", "120", "180", "240", "300" };
+	static constexpr int values[] = { 0, 60, 120, 180, 240, 300 };
+	static constexpr TextButtonRowTable screensaverTimeoutRow = { screensaverTimeoutPopupText, nullptr, values, ARRAY_SIZE(screensaverTimeoutPopupText), evAdjustScreensaverTimeout };
+	screensaverTimeoutPopup = CreatePopupBar(colours, fullPopupWidth, screensaverTimeoutRow);
 }
 
 // Create the babystep amount adjustment popup
 static void CreateBabystepAmountPopup(const ColourScheme& colours)
 {
-	static const int values[] = { 0, 1, 2, 3 };
-	babystepAmountPopup = CreateIntPopupBar(colours, fullPopupWidth, ARRAY_SIZE(babystepAmounts), babystepAmounts, values, evAdjustBabystepAmount, evAdjustBabystepAmount);
+	static constexpr TextButtonRowTable babystepAmountRow = { babystepAmounts, nullptr, nullptr, ARRAY_SIZE(babystepAmounts), evAdjustBabystepAmount };
+	babystepAmountPopup = CreatePopupBar(colours, fullPopupWidth, babystepAmountRow);
 }
 
 // Create the feedrate amount adjustment popup
 static void CreateFeedrateAmountPopup(const ColourScheme& colours)
 {
-	static const char* const feedrateText[] = {"600", "1200", "2400", "6000", "12000"};
-	static const int values[] = { 600, 1200, 2400, 6000, 12000 };
-	feedrateAmountPopup = CreateIntPopupBar(colours, fullPopupWidth, ARRAY_SIZE(feedrateText), feedrateText, values, evAdjustFeedrate, evAdjustFeedrate);
+	static constexpr const char* feedrateText[] = {"600", "1200", "2400", "6000", "12000"};
+	static constexpr int values[] = { 600, 1200, 2400, 6000, 12000 };
+	static constexpr TextButtonRowTable feedrateRow = { feedrateText, nullptr, values, ARRAY_SIZE(feedrateText), evAdjustFeedrate };
+	feedrateAmountPopup = CreatePopupBar(colours, fullPopupWidth, feedrateRow);
 }
 
 // Create the colour scheme change popup
@@ -775,10 +773,10 @@ static void CreateLanguagePopup(const ColourScheme& colours)
 // Create the pop-up keyboard
 static void CreateKeyboardPopup(uint32_t language, ColourScheme colours)
 {
-	static const char* _ecv_array const keysEN[8] = { "1234567890-+", "QWERTYUIOP[]", "ASDFGHJKL:@", "ZXCVBNM,./", "!\"#$%^&*()_=", "qwertyuiop{}", "asdfghjkl;'", "zxcvbnm<>?" };
-	static const char* _ecv_array const keysDE[8] = { "1234567890-+", "QWERTZUIOP[]", "ASDFGHJKL:@", "YXCVBNM,./", "!\"#$%^&*()_=", "qwertzuiop{}", "asdfghjkl;'", "yxcvbnm<>?" };
-	static const char* _ecv_array const keysFR[8] = { "1234567890-+", "AZERTWUIOP[]", "QSDFGHJKLM@", "YXCVBN.,:/", "!\"#$%^&*()_=", "azertwuiop{}", "qsdfghjklm'", "yxcvbn<>;?" };
-	static const char* _ecv_array const * const keyboards[] = {
+	static constexpr const char* _ecv_array keysEN[8] = { "1234567890-+", "QWERTYUIOP[]", "ASDFGHJKL:@", "ZXCVBNM,./", "!\"#$%^&*()_=", "qwertyuiop{}", "asdfghjkl;'", "zxcvbnm<>?" };
+	static constexpr const char* _ecv_array keysDE[8] = { "1234567890-+", "QWERTZUIOP[]", "ASDFGHJKL:@", "YXCVBNM,./", "!\"#$%^&*()_=", "qwertzuiop{}", "asdfghjkl;'", "yxcvbnm<>?" };
+	static constexpr const char* _ecv_array keysFR[8] = { "1234567890-+", "AZERTWUIOP[]", "QSDFGHJKLM@", "YXCVBN.,:/", "!\"#$%^&*()_=", "azertwuiop{}", "qsdfghjklm'", "yxcvbn<>;?" };
+	static constexpr const char* _ecv_array const * keyboards[] = {
 			keysEN,	// English
 			keysDE,	// German
 			keysFR,	// French
@@ -790,13 +788,39 @@ static void CreateKeyboardPopup(uint32_t language, ColourScheme colours)
 #if USE_CYRILLIC_CHARACTERS
 			keysEN,	// Ukrainian
 			keysEN,	// Russian
-#elif USE_JAPANESE_CHARACTERS
+#endif
+#if USE_JAPANESE_CHARACTERS
 			keysEN, // Japanese
 #endif
 	};
 
 	static_assert(ARRAY_SIZE(keyboards) >= NumLanguages, "Wrong number of keyboard entries");
 
+	// The keys beside and below the rows of character keys, which are the same for every language.
+	// 'row' counts rows of keys from the top, so row 4 is the one below the character keys.
+	struct KeyboardKey
+	{
+		uint8_t row;
+		PixelNumber x, width;
+		Icon null icon;						// the icon on the key, or null if it has text instead
+		const char * _ecv_array null text;
+		Event evt;
+		int param;
+	};
+
+	static constexpr PixelNumber keyButtonHSpace = keyButtonHStep - keyButtonWidth;
+	static constexpr PixelNumber wideKeyButtonWidth = (keyboardPopupWidth - 2 * popupSideMargin - 2 * keyButtonHSpace)/5;
+	static constexpr PixelNumber sideKeyWidth = (3 * keyButtonWidth)/2;
+	static constexpr KeyboardKey otherKeys[] =
+	{
+		{ 0, keyboardPopupWidth - popupSideMargin - (5 * keyButtonWidth)/4, (5 * keyButtonWidth)/4, IconBackspace, nullptr, evBackspace, 0 },
+		{ 2, keyboardPopupWidth - popupSideMargin - sideKeyWidth, sideKeyWidth, nullptr, UP_ARROW, evUp, 0 },
+		{ 3, keyboardPopupWidth - popupSideMargin - sideKeyWidth, sideKeyWidth, nullptr, DOWN_ARROW, evDown, 0 },
+		{ 4, popupSideMargin, wideKeyButtonWidth, nullptr, "Shift", evShift, 0 },
+		{ 4, popupSideMargin + wideKeyButtonWidth + keyButtonHSpace, 2 * wideKeyButtonWidth, nullptr, "", evKey, (int)' ' },
+		{ 4, popupSideMargin + 3 * wideKeyButtonWidth + 2 * keyButtonHSpace, wideKeyButtonWidth, IconEnter, nullptr, evSendKeyboardCommand, 0 },
+	};
+
 	keyboardPopup = new StandardPopupWindow(keyboardPopupHeight, keyboardPopupWidth, colours.popupBackColour, colours.popupBorderColour, colours.popupInfoTextColour, colours.buttonImageBackColour, nullptr, keyboardTopMargin);
 
 	// Add the text area in which the command is built
@@ -811,45 +835,32 @@ static void CreateKeyboardPopup(uint32_t language, ColourScheme colours)
 	}
 
 	currentKeyboard = keyboards[language];
-	PixelNumber row = keyboardTopMargin + keyButtonVStep;
+	const PixelNumber row = keyboardTopMargin + keyButtonVStep;
 
+	DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
 	for (size_t i = 0; i < 4; ++i)
 	{
-		DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
 		// New code using CharButtonRow to economise on RAM at the expense of more flash memory usage
 		const PixelNumber column = popupSideMargin + (i * keyButtonHStep)/3;
-		keyboardRows[i] = new CharButtonRow(row, column, keyButtonWidth, keyButtonHStep, currentKeyboard[i], evKey);
+		keyboardRows[i] = new CharButtonRow(row + i * keyButtonVStep, column, keyButtonWidth, keyButtonHStep, currentKeyboard[i], evKey);
 		keyboardPopup->AddField(keyboardRows[i]);
-		DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.buttonImageBackColour);
-		switch (i)
-		{
-		case 0:
-			keyboardPopup->AddField(new IconButton(row, keyboardPopupWidth - popupSideMargin - (5 * keyButtonWidth)/4, (5 * keyButtonWidth)/4, IconBackspace, evBackspace));
-			break;
-
-		case 2:
-			keyboardPopup->AddField(new TextButton(row, keyboardPopupWidth - popupSideMargin - (3 * keyButtonWidth)/2, (3 * keyButtonWidth)/2, UP_ARROW, evUp));
-			break;
-
-		case 3:
-			keyboardPopup->AddField(new TextButton(row, keyboardPopupWidth - popupSideMargin - (3 * keyButtonWidth)/2, (3 * keyButtonWidth)/2, DOWN_ARROW, evDown));
-			break;
+	}
 
-		default:
-			break;
+	for (const KeyboardKey& key : otherKeys)
+	{
+		const PixelNumber keyRow = row + key.row * keyButtonVStep;
+		if (key.icon != nullptr)
+		{
+			DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.buttonImageBackColour);
+			keyboardPopup->AddField(new IconButton(keyRow, key.x, key.width, key.icon, key.evt, key.param));
+		}
+		else
+		{
+			DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
+			keyboardPopup->AddField(new TextButton(keyRow, key.x, key.width, key.text, key.evt, key.param));
 		}
-		row += keyButtonVStep;
 	}
 
-	// Add the shift, space and enter keys
-	const PixelNumber keyButtonHSpace = keyButtonHStep - keyButtonWidth;
-	const PixelNumber wideKeyButtonWidth = (keyboardPopupWidth - 2 * popupSideMargin - 2 * keyButtonHSpace)/5;
-	DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
-	keyboardPopup->AddField(new TextButton(row, popupSideMargin, wideKeyButtonWidth, "Shift", evShift, 0));
-	keyboardPopup->AddField(new TextButton(row, popupSideMargin + wideKeyButtonWidth + keyButtonHSpace, 2 * wideKeyButtonWidth, "", evKey, (int)' '));
-	DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.buttonImageBackColour);
-	keyboardPopup->AddField(new IconButton(row, popupSideMargin + 3 * wideKeyButtonWidth + 2 * keyButtonHSpace, wideKeyButtonWidth, IconEnter, evSendKeyboardCommand));
-
 	keyboardDataHandler = SendGcode;
 }
 
@@ -1129,6 +1140,7 @@ static void CreateSetupTabFields(uint32_t language, const ColourScheme& colours)
 
 	DisplayField::SetDefaultColours(colours.labelTextColour, colours.defaultBackColour);
 	mgr.AddField(ipAddressField = new TextField(row9, margin, DisplayX/2 - margin, TextAlignment::Left, "IP: ", ipAddress.c_str()));
+	mgr.AddField(slowestRefresh = new IntegerField(row9, DisplayX/2, DisplayX/2 - margin, TextAlignment::Left, "Slowest refresh: ", "ms"));
 	setupRoot = mgr.GetRoot();
 }
 
@@ -1200,6 +1212,8 @@ namespace UI
 	}
 
 	static void ClearAlertOrResponse();
+	static bool ChangePage(ButtonBase *newTab);
+	void UpdateAllHomed();
 
 	// Return the number of supported languages
 	unsigned int GetNumLanguages()
@@ -1216,6 +1230,7 @@ namespace UI
 	void CreateFields(uint32_t language, const ColourScheme& colours, uint32_t p_infoTimeout)
 	{
 		infoTimeout = p_infoTimeout;
+		fieldsStart = GetHeapTop();
 
 		// Set up default colours and margins
 		mgr.Init(colours.defaultBackColour);
@@ -1253,13 +1268,68 @@ namespace UI
 		touchCalibInstruction = new StaticTextField(DisplayY/2 - 10, 0, DisplayX, TextAlignment::Centre, strings->touchTheSpot);
 
 		mgr.SetRoot(nullptr);
+		fieldsEnd = GetHeapTop();
 
 #ifdef SUPPORT_ENCODER
-		encoder = new RotaryEncoder(2, 3, 32+6);			// PA2, PA3 and PB6
-		encoder->Init(4);
+		if (encoder == nullptr)								// we may be recreating the fields
+		{
+			encoder = new RotaryEncoder(2, 3, 32+6);		// PA2, PA3 and PB6
+			encoder->Init(4);
+		}
 #endif
 	}
 
+	// Create all the fields again in the memory that they used before, after the language or colour scheme has been changed.
+	// CreateFields should allocate the same objects whatever the language and colours are, but we only know how much memory
+	// the new fields need by creating them, so we first create them in the free memory above the heap. If they fit in the old
+	// fields' memory then we create them again there and give the free memory back, leaving the objects allocated after the
+	// old fields alone. The fields are then brought up to date from the object model and our own variables;
+	// the values that only the fields held have to be fetched from the host again.
+	// Return false if there isn't room to try the new fields or they don't fit. The old fields' memory is untouched but
+	// the fields are unusable, so the caller must reset.
+	bool RecreateFields(uint32_t language, const ColourScheme& colours, uint32_t p_infoTimeout)
+	{
+		void * const heapTop = GetHeapTop();
+		void * const oldFieldsStart = fieldsStart;
+		const uint32_t oldFieldsSize = static_cast<unsigned char *>(fieldsEnd) - static_cast<unsigned char *>(fieldsStart);
+		if (GetFreeMemory() < oldFieldsSize + RecreateFieldsReserve)
+		{
+			return false;
+		}
+
+		CreateFields(language, colours, p_infoTimeout);
+		const uint32_t newFieldsSize = static_cast<unsigned char *>(fieldsEnd) - static_cast<unsigned char *>(fieldsStart);
+		SetHeapTop(heapTop);
+		if (newFieldsSize > oldFieldsSize)
+		{
+			return false;
+		}
+
+		SetHeapTop(oldFieldsStart);
+		CreateFields(language, colours, p_infoTimeout);
+		SetHeapTop(heapTop);
+
+		// Forget the state that belonged to the old fields
+		currentTab = nullptr;
+		currentButton.Clear();
+		fieldBeingAdjusted.Clear();
+		keyboardIsDisplayed = false;
+		keyboardShifted = false;
+		eventToConfirm = evNull;
+
+		// Make the update functions apply the current values to the new fields, even though they haven't changed
+		const uint8_t axes = numVisibleAxes;
+		numVisibleAxes = 0;
+		UpdateGeometry(axes, isDelta);
+		allAxesHomed = false;
+		UpdateAllHomed();
+		AllToolsSeen();
+		UpdatePrintingFields();
+
+		ChangePage(tabSetup);								// we were changed from the Setup tab, so go back to it
+		return true;
+	}
+
 	// This is called when no job is active/paused
 	void ShowFilesButton()
 	{
@@ -1312,15 +1382,15 @@ namespace UI
 		{
 			return;
 		}
-		// The table gives us a pointer to the label field, which is followed by 8 buttons. So we need to show or hide 9 fields.
+		// The table gives us a pointer to the label field, which is followed by the row of buttons. So we need to show or hide 2 fields.
 		DisplayField *f = moveAxisRows[slot];
-		for (int i = 0; i < 9 && f != nullptr; ++i)
+		for (int i = 0; i < 2 && f != nullptr; ++i)
 		{
 			mgr.Show(f, b);
-			if (i > 0) // actual move buttons
+			if (i > 0 && axisLetter != nullptr) // actual move buttons
 			{
-				TextButtonForAxis *textButton = static_cast<TextButtonForAxis*>(f);
-				textButton->SetAxisLetter(axisLetter[0]);
+				TextButtonRowForAxis *buttonRow = static_cast<TextButtonRowForAxis*>(f);
+				buttonRow->SetAxisLetter(axisLetter[0]);
 			}
 			f = f->next;
 		}
@@ -1447,7 +1517,9 @@ namespace UI
 	static uint32_t simulatedTime;
 	static uint32_t jobDuration;
 	static uint32_t jobWarmUpDuration;
+	static bool jobWarmingUp;						// true if the host reports that the job is still warming up
 	static String<50> timesLeftText;
+	static uint32_t lastJobTimerTick;				// when we last advanced the job timers, either locally or from a host update
 
 	static const char *GetStatusString(OM::PrinterStatus status)
 	{
@@ -1481,6 +1553,7 @@ namespace UI
 				// Starting a new print, so clear the times
 				timesLeft[0] = timesLeft[1] = timesLeft[2] = 0;
 				simulatedTime = 0;
+				jobWarmingUp = false;
 			}
 			SetLastFileSimulated(newStatus == OM::PrinterStatus::simulating);
 			if (oldStatus != newStatus)
@@ -1502,7 +1575,7 @@ namespace UI
 			nameField->SetValue(machineName.c_str());		// if we are on the print tab then it may still be set to the file that was being printed
 			if (IsPrintingStatus(oldStatus))
 			{
-				mgr.Refresh(true);		// Ending a print creates a popup and that will prevent removing some of the elements hidden so force it here
+				mgr.StartRefresh();		// Ending a print creates a popup and that will prevent removing some of the elements hidden so force it here
 			}
 			[[fallthrough]];
 		case OM::PrinterStatus::configuring:
@@ -1591,24 +1664,70 @@ namespace UI
 		mgr.Show(timeLeftField, true);
 	}
 
+	// The host values are authoritative, so we restart the local one second tick whenever we receive one
 	void UpdateTimesLeft(size_t index, unsigned int seconds)
 	{
 		if (index < (int)ARRAY_SIZE(timesLeft))
 		{
 			timesLeft[index] = seconds;
+			lastJobTimerTick = SystemTick::GetTickCount();
 			UpdateTimesLeftText();
 		}
 	}
 
+	// While the job is warming up the host counts the warm-up time in both the job duration and the warm-up duration, so they stay within a second of each other
+	static void UpdateWarmingUp()
+	{
+		jobWarmingUp = jobWarmUpDuration != 0 && jobWarmUpDuration + 1 >= jobDuration;
+	}
+
 	void UpdateDuration(uint32_t duration)
 	{
 		jobDuration = duration;
+		UpdateWarmingUp();
+		lastJobTimerTick = SystemTick::GetTickCount();
+		UpdateTimesLeftText();
+	}
+
+	// Advance the job timers locally between host updates, so that they tick every second however often we fetch them
+	static void AdvanceJobTimers()
+	{
+		const uint32_t now = SystemTick::GetTickCount();
+		if (now - lastJobTimerTick < SystemTick::TicksPerSecond)
+		{
+			return;
+		}
+		lastJobTimerTick += SystemTick::TicksPerSecond;
+		if (now - lastJobTimerTick >= SystemTick::TicksPerSecond)
+		{
+			lastJobTimerTick = now;						// we fell behind, don't try to catch up
+		}
+
+		const OM::PrinterStatus status = GetStatus();
+		if (status != OM::PrinterStatus::printing && status != OM::PrinterStatus::simulating)
+		{
+			return;
+		}
+
+		++jobDuration;
+		if (jobWarmingUp)
+		{
+			++jobWarmUpDuration;						// keep the simulated time left steady until the warm-up ends
+		}
+		for (int& t : timesLeft)
+		{
+			if (t > 1)
+			{
+				--t;
+			}
+		}
 		UpdateTimesLeftText();
 	}
 
 	void UpdateWarmupDuration(uint32_t warmupDuration)
 	{
 		jobWarmUpDuration = warmupDuration;
+		UpdateWarmingUp();
 		UpdateTimesLeftText();
 	}
 
@@ -1643,7 +1762,7 @@ namespace UI
 			mgr.SetRoot(commonRoot);
 			break;
 		}
-		mgr.Refresh(true);
+		mgr.StartRefresh();			// the main loop draws the new page a slice at a time
 	}
 
 	// Change to the page indicated. Return true if the page has a permanently-visible button.
@@ -1773,6 +1892,7 @@ namespace UI
 		{
 			MessageLog::UpdateMessages(false);
 		}
+		AdvanceJobTimers();
 		if (alertTicks != 0 && SystemTick::GetTickCount() - whenAlertReceived >= alertTicks)
 		{
 			ClearAlertOrResponse();
@@ -2103,6 +2223,18 @@ namespace UI
 		return alertMode < 2;
 	}
 
+	// Scroll the message rows up by 'numRows' rows in hardware, if they are on display and the display can do it.
+	// Return true if we did, in which case the caller must move the values of the message fields to match.
+	bool ScrollMessageRows(unsigned int numRows)
+	{
+		if (currentTab != tabMsg || mgr.GetPopup() != nullptr || mgr.IsRefreshing() || !lcd.setScrollArea(firstMessageRow, numMessageRows * rowTextHeight))
+		{
+			return false;
+		}
+		lcd.scrollUp(numRows * rowTextHeight);
+		return true;
+	}
+
 	void ProcessSimpleAlert(const char* _ecv_array text)
 	{
 		if (alertMode < 2)												// if the current alert doesn't require acknowledgement
@@ -2265,6 +2397,13 @@ namespace UI
 		return currentFile != nullptr;
 	}
 
+	// This is called when the host has changed the baud rate or log level using a control command
+	void UpdateCommsSettings()
+	{
+		baudRateButton->SetValue(nvData.GetBaudRate());
+		logLevelButton->SetText(strings->logLevelNames[(unsigned int)MessageLog::LogLevelGet()]);
+	}
+
 	static void DoEmergencyStop()
 	{
 		// We send M112 for the benefit of old firmware, and F0 0F (an invalid UTF8 sequence) for new firmware
@@ -2590,8 +2729,11 @@ namespace UI
 				break;
 			case evMoveAxis:
 				{
-					TextButtonForAxis *textButton = static_cast<TextButtonForAxis*>(bp.GetButton());
-					const char letter = textButton->GetAxisLetter();
+					// The move popup has a row of buttons for each axis, the alert popup has single buttons
+					const ButtonBase * const button = bp.GetButton();
+					const char letter = (button->parent == movePopup)
+										? static_cast<const TextButtonRowForAxis*>(button)->GetAxisLetter()
+										: static_cast<const TextButtonForAxis*>(button)->GetAxisLetter();
 					SerialIo::Sendf("G91 G1 %s%c%s F%d G90\n", islower(letter) ? "'" : "", letter, bp.GetSParam(), nvData.GetFeedrate());
 				}
 				break;
@@ -2963,11 +3105,15 @@ namespace UI
 					const uint8_t newColours = (uint8_t)bp.GetIParam();
 					if (nvData.SetColourScheme(newColours))
 					{
+						mgr.ClearPopup(false);					// take the popup down before its memory is reused, everything gets redrawn anyway
 						SaveSettings();
-						Reset();
+						RecreateUserInterface();
+					}
+					else
+					{
+						mgr.ClearPopup();
 					}
 				}
-				mgr.ClearPopup();
 				break;
 
 			case evSetLanguage:
@@ -2980,11 +3126,15 @@ namespace UI
 					const uint8_t newLanguage = (uint8_t)bp.GetIParam();
 					if (nvData.SetLanguage(newLanguage))
 					{
+						mgr.ClearPopup(false);					// take the popup down before its memory is reused, everything gets redrawn anyway
 						SaveSettings();
-						Reset();
+						RecreateUserInterface();
+					}
+					else
+					{
+						mgr.ClearPopup();
 					}
 				}
-				mgr.ClearPopup();
 				break;
 
 			case evSetDimmingType:
@@ -3386,7 +3536,7 @@ namespace UI
 
 			if (currentTab == tabControl)
 			{
-				mgr.Refresh(true);
+				mgr.StartRefresh();
 			}
 		}
 	}
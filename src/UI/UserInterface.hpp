@@ -23,7 +23,7 @@
 #include <General/StringFunctions.h>
 
 extern MainWindow mgr;
-extern IntegerField *freeMem;
+extern IntegerField *freeMem, *slowestRefresh;
 extern StaticTextField *debugField;
 extern StaticTextField *touchCalibInstruction;
 extern StaticTextField *messageTextFields[], *messageTimeFields[];
@@ -37,6 +37,7 @@ namespace UI
 {
 	extern unsigned int GetNumLanguages();
 	extern void CreateFields(uint32_t language, const ColourScheme& colours, uint32_t p_infoTimeout);
+	extern bool RecreateFields(uint32_t language, const ColourScheme& colours, uint32_t p_infoTimeout);
 	extern void InitColourScheme(const ColourScheme *scheme);
 	extern void ActivateScreensaver();
 	extern bool DeactivateScreensaver();
@@ -71,12 +72,14 @@ namespace UI
 	extern void ProcessSimpleAlert(const char* _ecv_array text);
 	extern void NewResponseReceived(const char* _ecv_array text);
 	extern bool CanDimDisplay();
+	extern bool ScrollMessageRows(unsigned int numRows);
 	extern void UpdateFileLastModifiedText(const char data[]);
 	extern void UpdateFileGeneratedByText(const char data[]);
 	extern void UpdateFileObjectHeight(float f);
 	extern void UpdateFileLayerHeight(float f);
 	extern void UpdateFileSize(int size);
 	extern void UpdateFileFilament(int len);
+	extern void UpdateCommsSettings();
 	extern bool UpdateFileThumbnailChunk(const struct Thumbnail &thumbnail, uint32_t pixels_offset, const qoi_rgba_t *pixels, size_t pixels_count);
 	extern void UpdateFanPercent(size_t fanIndex, int rpm);
 	extern void UpdateActiveTemperature(size_t index, int ival);
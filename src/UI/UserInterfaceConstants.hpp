@@ -62,8 +62,13 @@ const PixelNumber touchCalibMargin = 15;
 
 const PixelNumber ColourGradientWidth = 2 * 128;
 
+#if USE_PACKED_FONTS
+extern uint8_t glcd19x21_packed[];			// declare which fonts we will be using
+#define DEFAULT_FONT	glcd19x21_packed
+#else
 extern uint8_t glcd19x21[];				// declare which fonts we will be using
 #define DEFAULT_FONT	glcd19x21
+#endif
 
 #elif DISPLAY_X == 800
 const unsigned int MaxSlots = 7;
@@ -107,8 +112,13 @@ const PixelNumber touchCalibMargin = 22;
 
 const PixelNumber ColourGradientWidth = 3 * 128;
 
+#if USE_PACKED_FONTS
+extern uint8_t glcd28x32_packed[];			// declare which fonts we will be using
+#define DEFAULT_FONT	glcd28x32_packed
+#else
 extern uint8_t glcd28x32[];				// declare which fonts we will be using
 #define DEFAULT_FONT	glcd28x32
+#endif
 
 #else
 